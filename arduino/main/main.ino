@@ -37,7 +37,9 @@
    ========================================================= */
 
 #define PASSWORD_LENGTH 8
-#define UART_BAUDRATE   115200
+#define UART_BAUDRATE   115200  // must match KEYPAD_UART_BAUD on the ESP32
+
+#define HEARTBEAT_MS    100     // resend key state this often when idle
 
 /* =========================================================
    SYSTEM STATE MACHINE
@@ -99,13 +101,117 @@ Keypad keypad = Keypad(
 );
 
 /* =========================================================
-   UART (ESP32) — GUARDED TX
+   UART (ESP32) — FRAMED BINARY PROTOCOL
+   Same format as main/keypad_proto.h on the ESP32 side:
+     0xA5 | type<<4 | count | seq | payload | crc8
    ========================================================= */
 
-void uartSendKey(char key)
+#define KP_SYNC            0xA5
+#define KP_TYPE_KEYS       0
+#define KP_TYPE_STATUS     1
+#define KP_MAXBATCH        8
+#define KP_STATUS_LOCKED   0
+#define KP_STATUS_UNLOCKED 1
+
+static uint8_t  txSeq;
+static uint16_t batch[KP_MAXBATCH];    // key states not yet sent
+static uint8_t  batchCount;
+static uint16_t keyState;
+static unsigned long lastSent;
+
+uint8_t crc8(const uint8_t *p, uint8_t len)
 {
-    if (systemState == STATE_UNLOCKED) {
-        Serial.write(key);
+    uint8_t crc = 0;
+
+    while (len--) {
+        crc ^= *p++;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+void sendFrame(uint8_t type, const uint8_t *payload, uint8_t count, uint8_t len)
+{
+    uint8_t frame[3 + KP_MAXBATCH * 2 + 1];
+
+    frame[0] = KP_SYNC;
+    frame[1] = (type << 4) | count;
+    frame[2] = txSeq++;
+    memcpy(frame + 3, payload, len);
+    frame[3 + len] = crc8(frame + 1, 2 + len);
+    Serial.write(frame, 4 + len);
+    lastSent = millis();
+}
+
+void sendStatus(uint8_t status)
+{
+    sendFrame(KP_TYPE_STATUS, &status, 1, 1);
+}
+
+/* Queue a key state; if the batch is full the newest state replaces
+   the last one, the ESP32 only needs the transitions it can act on */
+void queueKeyState(uint16_t mask)
+{
+    if (batchCount == KP_MAXBATCH) {
+        batchCount--;
+    }
+    batch[batchCount++] = mask;
+    keyState = mask;
+}
+
+/* Send the batch once the TX buffer can take the whole frame without
+   blocking; while the line is busy states pile up and go together */
+void flushKeyStates(void)
+{
+    uint8_t payload[KP_MAXBATCH * 2];
+
+    if (systemState != STATE_UNLOCKED) {
+        return;
+    }
+    if (!batchCount && millis() - lastSent >= HEARTBEAT_MS) {
+        batch[batchCount++] = keyState;
+    }
+    if (!batchCount || Serial.availableForWrite() < 4 + batchCount * 2) {
+        return;
+    }
+    for (uint8_t i = 0; i < batchCount; i++) {
+        payload[i * 2]     = batch[i] & 0xff;
+        payload[i * 2 + 1] = batch[i] >> 8;
+    }
+    sendFrame(KP_TYPE_KEYS, payload, batchCount, batchCount * 2);
+    batchCount = 0;
+}
+
+/* Scan the keypad and queue the new state if any key changed. Bit n
+   is key n of keypadMap in row order (the library's kcode). */
+void scanKeys(void)
+{
+    uint16_t mask = 0;
+    char pressed = 0;
+
+    if (!keypad.getKeys()) {
+        return;
+    }
+    for (uint8_t i = 0; i < LIST_MAX; i++) {
+        const Key &k = keypad.key[i];
+
+        if (k.kstate == PRESSED || k.kstate == HOLD) {
+            mask |= 1 << k.kcode;
+        }
+        if (k.kstate == PRESSED && k.stateChanged) {
+            pressed = k.kchar;
+        }
+    }
+    if (mask != keyState) {
+        queueKeyState(mask);
+    }
+    if (pressed) {
+        lcd.setCursor(12, 0);  // Move to position after "Key pressed:"
+        lcd.print("  ");       // Clear previous key
+        lcd.setCursor(12, 0);  // Move back
+        lcd.print(pressed);    // Show new key
     }
 }
 
@@ -140,20 +246,6 @@ void resetAuthentication(void)
 
 void handleKeypadInput(char key)
 {
-    if (systemState == STATE_UNLOCKED) {
-        Serial.print("Key pressed: ");
-        Serial.println(key);
-
-        // Update LCD to show the pressed key
-        lcd.setCursor(12, 0);  // Move to position after "Key pressed:"
-        lcd.print("  ");       // Clear previous key
-        lcd.setCursor(12, 0);  // Move back
-        lcd.print(key);        // Show new key
-
-        uartSendKey(key);
-        return;
-    }
-
     systemState = STATE_AUTHENTICATING;
 
     if (inputIndex < PASSWORD_LENGTH) {
@@ -171,7 +263,7 @@ void handleKeypadInput(char key)
             lcd.print("Key pressed:");
 
             systemState = STATE_UNLOCKED;
-            Serial.println("AUTH_OK");
+            sendStatus(KP_STATUS_UNLOCKED);
 
         } else {
             lcd.clear();
@@ -200,6 +292,12 @@ void setup(void)
 
 void loop(void)
 {
+    if (systemState == STATE_UNLOCKED) {
+        scanKeys();
+        flushKeyStates();
+        return;
+    }
+
     char key = keypad.getKey();
 
     if (key) {
@@ -0,0 +1,118 @@
+#include "doomtype.h"
+#include "doomdef.h"
+#include "d_event.h"
+#include "d_main.h"
+#include "g_game.h"
+#include "lprintf.h"
+#include "i_input.h"
+
+#include "esp_attr.h"
+#include "esp_timer.h"
+
+// Input event ring
+//
+// Multi-producer (GPIO ISR, UART task), single consumer (I_StartTic).
+// A producer claims a slot by advancing ringhead with a CAS, fills it and
+// then publishes it by bumping the slot's seq; the consumer only reads
+// slots whose seq says they are published. No locks, so an ISR can
+// preempt a task halfway through posting without either blocking.
+//
+// seq counts in laps: a slot is free for position pos when its seq equals
+// the lap base (pos & ~RINGMASK), and holds the event for pos when it
+// equals lap base + 1. A zeroed ring is an empty ring.
+
+#define INPUT_RINGSIZE 64   // power of two
+#define RINGMASK       (INPUT_RINGSIZE-1)
+
+typedef struct {
+    unsigned seq;
+    byte     action;
+    byte     down;
+    unsigned time;          // esp_timer microseconds, low 32 bits
+} inputevent_t;
+
+static inputevent_t ring[INPUT_RINGSIZE];
+static unsigned ringhead;   // next position to claim
+static unsigned ringtail;   // next position to drain
+static unsigned dropped;
+
+void IRAM_ATTR I_PostInput(inputaction_t action, boolean down)
+{
+    unsigned pos = __atomic_load_n(&ringhead, __ATOMIC_RELAXED);
+
+    for (;;) {
+        inputevent_t *ev = &ring[pos & RINGMASK];
+        int dif = (int)(__atomic_load_n(&ev->seq, __ATOMIC_ACQUIRE) - (pos & ~RINGMASK));
+
+        if (dif == 0) {
+            if (__atomic_compare_exchange_n(&ringhead, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                ev->action = action;
+                ev->down = down;
+                ev->time = (unsigned)esp_timer_get_time();
+                __atomic_store_n(&ev->seq, (pos & ~RINGMASK) + 1, __ATOMIC_RELEASE);
+                return;
+            }
+        } else if (dif < 0) {
+            // full, the consumer is a lap behind
+            __atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);
+            return;
+        } else {
+            pos = __atomic_load_n(&ringhead, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+// Input latency: time from an event being posted to it reaching
+// D_PostEvent, which happens right before the tic's G_BuildTiccmd.
+static unsigned latencysum, latencymax, latencycount;
+
+static int *const actionkeys[NUMINPUTACTIONS] = {
+    [IA_UP]           = &key_up,
+    [IA_DOWN]         = &key_down,
+    [IA_LEFT]         = &key_left,
+    [IA_RIGHT]        = &key_right,
+    [IA_FIRE]         = &key_fire,
+    [IA_USE]          = &key_use,
+    [IA_STRAFELEFT]   = &key_strafeleft,
+    [IA_STRAFERIGHT]  = &key_straferight,
+    [IA_ENTER]        = &key_enter,
+    [IA_ESCAPE]       = &key_escape,
+    [IA_MAP]          = &key_map,
+    [IA_WEAPONTOGGLE] = &key_weapontoggle,
+};
+
+void I_ProcessInput(void)
+{
+    unsigned now = (unsigned)esp_timer_get_time();
+
+    for (;;) {
+        inputevent_t *ev = &ring[ringtail & RINGMASK];
+        unsigned lap = ringtail & ~RINGMASK;
+        event_t event;
+        unsigned latency;
+
+        if (__atomic_load_n(&ev->seq, __ATOMIC_ACQUIRE) != lap + 1)
+            break;
+
+        event.type = ev->down ? ev_keydown : ev_keyup;
+        event.data1 = *actionkeys[ev->action];
+        event.data2 = event.data3 = 0;
+        latency = now - ev->time;
+
+        __atomic_store_n(&ev->seq, lap + INPUT_RINGSIZE, __ATOMIC_RELEASE);
+        ringtail++;
+
+        D_PostEvent(&event);
+
+        latencysum += latency;
+        if (latency > latencymax)
+            latencymax = latency;
+        if (++latencycount == 256) {
+            lprintf(LO_DEBUG, "I_ProcessInput: latency avg %uus max %uus, %u dropped\n",
+                    latencysum / latencycount, latencymax,
+                    __atomic_load_n(&dropped, __ATOMIC_RELAXED));
+            latencysum = latencymax = latencycount = 0;
+        }
+    }
+}
@@ -1,4 +1,11 @@
 #include "doomtype.h"
+#include "doomdef.h"
+#include "i_input.h"
+
+#include "driver/gpio.h"
+#include "hal/gpio_ll.h"
+#include "esp_attr.h"
+#include "sdkconfig.h"
 
 // PrBoom expects these globals
 int usejoystick = 0;
@@ -7,7 +14,61 @@ int joyright    = 0;
 int joyup       = 0;
 int joydown     = 0;
 
-// Stub for jsInit() called in app_main
-void jsInit(void) {
-    // nothing yet, joystick not implemented
+// GPIO buttons, active low with the internal pull-up. A pin of -1 in
+// menuconfig leaves that button out. buttonIsr runs with the flash cache
+// possibly disabled, so the table lives in DRAM and the pin is read
+// straight from the GPIO registers rather than through gpio_get_level.
+
+static const DRAM_ATTR struct {
+    int pin;
+    inputaction_t action;
+} buttons[] = {
+    { CONFIG_HW_BTN_UP_GPIO,     IA_UP     },
+    { CONFIG_HW_BTN_DOWN_GPIO,   IA_DOWN   },
+    { CONFIG_HW_BTN_LEFT_GPIO,   IA_LEFT   },
+    { CONFIG_HW_BTN_RIGHT_GPIO,  IA_RIGHT  },
+    { CONFIG_HW_BTN_FIRE_GPIO,   IA_FIRE   },
+    { CONFIG_HW_BTN_USE_GPIO,    IA_USE    },
+    { CONFIG_HW_BTN_ENTER_GPIO,  IA_ENTER  },
+    { CONFIG_HW_BTN_ESCAPE_GPIO, IA_ESCAPE },
+};
+
+#define NUMBUTTONS (sizeof buttons / sizeof *buttons)
+
+static byte buttondown[NUMBUTTONS];
+
+static void IRAM_ATTR buttonIsr(void *arg)
+{
+    int i = (int)arg;
+    byte down = !gpio_ll_get_level(&GPIO, buttons[i].pin);
+
+    // Both edges interrupt; only pass on actual changes, so contact
+    // bounce costs at most a spurious press/release pair.
+    if (down != buttondown[i]) {
+        buttondown[i] = down;
+        I_PostInput(buttons[i].action, down);
+    }
+}
+
+void jsInit(void)
+{
+    int i;
+
+    for (i = 0; i < NUMBUTTONS; i++) {
+        if (buttons[i].pin < 0)
+            continue;
+
+        gpio_config_t cfg = {
+            .pin_bit_mask = 1ULL << buttons[i].pin,
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_ENABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_ANYEDGE,
+        };
+        gpio_config(&cfg);
+
+        // Installing twice just returns an error we don't care about
+        gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+        gpio_isr_handler_add(buttons[i].pin, buttonIsr, (void *)i);
+    }
 }
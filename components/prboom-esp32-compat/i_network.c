@@ -31,6 +31,10 @@
  *  and client, with SERVER defined for the former to select some extra
  *  functions. Handles socket creation, and packet send and receive.
  *
+ *  Plain BSD sockets, so the same code runs over lwIP on the ESP32 and
+ *  over the loopback interface of a host for testing. All sockets are
+ *  non-blocking; I_WaitForPacket is the only place we sleep.
+ *
  *-----------------------------------------------------------------------------*/
 
 # include "config.h"
@@ -48,54 +52,169 @@
 
 #ifdef HAVE_NET
 
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
 
 #include "protocol.h"
 #include "i_network.h"
+#include "i_system.h"
 #include "lprintf.h"
 
+/* Port the server listens on if none is given with -net */
+#define NET_DEFAULTPORT 5030
+
+/* Packets in the pool; NetUpdate needs two at a time, the rest are
+ * headroom. Must fit the bits of packetfree. */
+#define NET_POOLSIZE 8
+
+UDP_SOCKET udp_socket = -1;
+UDP_CHANNEL sentfrom;
+size_t sentbytes, recvdbytes;
+
+static byte *packetpool;
+static unsigned packetfree;  /* bit set = pool entry free */
+
 void I_ShutdownNetwork(void)
 {
+  if (udp_socket != -1) {
+    I_CloseSocket(udp_socket);
+    udp_socket = -1;
+  }
+  free(packetpool);
+  packetpool = NULL;
+  packetfree = 0;
 }
 
 void I_InitNetwork(void)
 {
+  if (packetpool)
+    return;
+  if (!(packetpool = malloc(NET_POOLSIZE * NET_MAXPACKET)))
+    I_Error("I_InitNetwork: Failed to allocate packet pool");
+  packetfree = (1u << NET_POOLSIZE) - 1;
+  atexit(I_ShutdownNetwork);
 }
 
 UDP_PACKET *I_AllocPacket(int size)
 {
+  int i;
+  void *p;
+
+  if (size > NET_MAXPACKET)
+    I_Error("I_AllocPacket: %d byte packet too large", size);
+
+  for (i=0; i<NET_POOLSIZE; i++)
+    if (packetfree & (1u << i)) {
+      packetfree &= ~(1u << i);
+      return (UDP_PACKET *)(packetpool + i*NET_MAXPACKET);
+    }
+
+  /* Pool exhausted or not set up yet, fall back to the heap */
+  if (!(p = malloc(NET_MAXPACKET)))
+    I_Error("I_AllocPacket: Out of memory");
+  return p;
 }
 
 void I_FreePacket(UDP_PACKET *packet)
 {
+  byte *p = (byte *)packet;
+
+  if (packetpool && p >= packetpool && p < packetpool + NET_POOLSIZE*NET_MAXPACKET)
+    packetfree |= 1u << ((p - packetpool) / NET_MAXPACKET);
+  else
+    free(packet);
 }
 
 void I_WaitForPacket(int ms)
 {
+  fd_set fds;
+  struct timeval tv;
+
+  if (udp_socket == -1)
+    return;
+
+  FD_ZERO(&fds);
+  FD_SET(udp_socket, &fds);
+  tv.tv_sec = ms / 1000;
+  tv.tv_usec = (ms % 1000) * 1000;
+  select(udp_socket + 1, &fds, NULL, NULL, &tv);
 }
 
+/*
+ * I_ConnectToServer
+ *
+ * Resolve "host[:port]" and connect the socket to it, so that plain
+ * send/recv talk to the server and packets from anyone else are
+ * dropped by the stack. Returns 0 on success, -1 on failure.
+ */
 int I_ConnectToServer(const char *serv)
 {
+  char server[500], *p;
+  struct sockaddr_in addr;
+  struct hostent *host;
+  unsigned short port = NET_DEFAULTPORT;
+
+  if (strlen(serv) >= sizeof server)
+    return -1;
+  strcpy(server, serv);
+  if ((p = strchr(server, ':'))) {
+    *p++ = '\0';
+    port = atoi(p);
+  }
+
+  memset(&addr, 0, sizeof addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (!inet_aton(server, &addr.sin_addr)) {
+    if (!(host = gethostbyname(server)) || host->h_addrtype != AF_INET)
+      return -1;
+    memcpy(&addr.sin_addr, host->h_addr_list[0], sizeof addr.sin_addr);
+  }
+
+  if (connect(udp_socket, (struct sockaddr *)&addr, sizeof addr) == -1)
+    return -1;
+  lprintf(LO_INFO, "I_ConnectToServer: %s:%u\n", inet_ntoa(addr.sin_addr), port);
   return 0;
 }
 
 void I_Disconnect(void)
 {
-}
+  struct sockaddr addr;
 
-UDP_SOCKET I_Socket(Uint16 port)
-{
+  /* Connecting to AF_UNSPEC dissolves the association */
+  memset(&addr, 0, sizeof addr);
+  addr.sa_family = AF_UNSPEC;
+  connect(udp_socket, &addr, sizeof addr);
 }
 
-void I_CloseSocket(UDP_SOCKET sock)
+UDP_SOCKET I_Socket(unsigned short port)
 {
-}
+  struct sockaddr_in addr;
+  UDP_SOCKET sock = socket(AF_INET, SOCK_DGRAM, 0);
 
-UDP_CHANNEL I_RegisterPlayer(IPaddress *ipaddr)
-{
+  if (sock == -1)
+    I_Error("I_Socket: socket: %s", strerror(errno));
+
+  fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+
+  memset(&addr, 0, sizeof addr);
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(sock, (struct sockaddr *)&addr, sizeof addr) == -1)
+    I_Error("I_Socket: bind to port %u: %s", port, strerror(errno));
+
+  return sock;
 }
 
-void I_UnRegisterPlayer(UDP_CHANNEL channel)
+void I_CloseSocket(UDP_SOCKET sock)
 {
+  close(sock);
 }
 
 /*
@@ -117,21 +236,49 @@ static byte ChecksumPacket(const packet_header_t* buffer, size_t len)
   return sum;
 }
 
+/*
+ * I_GetPacket
+ *
+ * Receive the next packet straight into buffer, skipping any that are
+ * runts or fail the checksum. Returns its length, or 0 if nothing is
+ * waiting. A packet that fills the buffer and fails the checksum was
+ * cut short to fit, which is said, not just skipped.
+ */
 size_t I_GetPacket(packet_header_t* buffer, size_t buflen)
 {
-  return 0;
+  for (;;) {
+    socklen_t fromlen = sizeof sentfrom;
+    int len = recvfrom(udp_socket, (void *)buffer, buflen, 0, &sentfrom, &fromlen);
+
+    if (len <= 0)
+      return 0;
+    recvdbytes += len;
+    if ((size_t)len >= sizeof *buffer && buffer->checksum == ChecksumPacket(buffer, len))
+      return len;
+    if ((size_t)len == buflen)
+      lprintf(LO_WARN, "I_GetPacket: dropped a packet over %u bytes\n", (unsigned)buflen);
+  }
 }
 
 void I_SendPacket(packet_header_t* packet, size_t len)
 {
+  packet->checksum = ChecksumPacket(packet, len);
+  if (send(udp_socket, (const void *)packet, len, 0) == (ssize_t)len)
+    sentbytes += len;
 }
 
 void I_SendPacketTo(packet_header_t* packet, size_t len, UDP_CHANNEL *to)
 {
+  packet->checksum = ChecksumPacket(packet, len);
+  if (sendto(udp_socket, (const void *)packet, len, 0, to, sizeof *to) == (ssize_t)len)
+    sentbytes += len;
 }
 
 void I_PrintAddress(FILE* fp, UDP_CHANNEL *addr)
 {
+  const struct sockaddr_in *sin = (const void *)addr;
+
+  fprintf(fp, "%s:%u", inet_ntoa(sin->sin_addr), ntohs(sin->sin_port));
 }
 
 #endif /* HAVE_NET */
@@ -12,6 +12,7 @@
 // المكاتب الخاصة بـ ESP32 المحدثة
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_system.h"
 #include "esp_timer.h"
 #include "esp_log.h"
@@ -153,6 +154,55 @@ void I_Quit(void)
     esp_restart();
 }
 
+static SemaphoreHandle_t io_lock;      // serialises I_Mmap reads
+static SemaphoreHandle_t background_done;
+static void (*background_job)(void);
+
+static void backgroundTask(void *arg)
+{
+    (void)arg;
+    background_job();
+    xSemaphoreGive(background_done);
+    vTaskDelete(NULL);
+}
+
+// Runs on the core the engine isn't pinned to, below the sound task
+boolean I_StartBackground(void (*job)(void))
+{
+    if (background_job)
+        I_WaitBackground();
+
+    if (!io_lock)
+        io_lock = xSemaphoreCreateMutex();
+    if (!background_done)
+        background_done = xSemaphoreCreateBinary();
+    if (!io_lock || !background_done)
+        return false;
+
+    background_job = job;
+    if (xTaskCreatePinnedToCore(&backgroundTask, "background", 4096, NULL, 2, NULL, 1) != pdPASS) {
+        background_job = NULL;
+        return false;
+    }
+    return true;
+}
+
+void I_WaitBackground(void)
+{
+    if (!background_job)
+        return;
+    xSemaphoreTake(background_done, portMAX_DELAY);
+    background_job = NULL;
+}
+
+boolean I_BackgroundDone(void)
+{
+    if (background_job && xSemaphoreTake(background_done, 0) != pdTRUE)
+        return false;
+    background_job = NULL;
+    return true;
+}
+
 void *I_Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
 {
     (void)addr;
@@ -163,18 +213,29 @@ void *I_Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offse
     if (!buf)
         return NULL;
 
+    // The seek and read have to be one step while a background job
+    // may be reading from the same file
+    if (io_lock)
+        xSemaphoreTake(io_lock, portMAX_DELAY);
+
     // Seek to lump position
     if (lseek(fd, offset, SEEK_SET) < 0) {
+        if (io_lock)
+            xSemaphoreGive(io_lock);
         free(buf);
         return NULL;
     }
 
     // Read lump data
     if (read(fd, buf, length) != (ssize_t)length) {
+        if (io_lock)
+            xSemaphoreGive(io_lock);
         free(buf);
         return NULL;
     }
 
+    if (io_lock)
+        xSemaphoreGive(io_lock);
     return buf;
 }
 int I_Lseek(int fd, off_t offset, int whence)
@@ -249,9 +310,13 @@ fixed_t I_GetTimeFrac(void)
     return (usecs << 16) / (1000000 / 35);
 }
  
+// Where the engine keeps what it writes: save games, and the TRANMAP
+// and blockmap caches. There's no working directory on the ESP32 for
+// "." to mean, so it's the card the WADs are on; with no card mounted
+// the fopens fail and the caches are rebuilt each time, as before.
 const char* I_DoomExeDir(void)
 {
-    return "."; // or "/spiffs" if using SPIFFS
+    return "/sdcard";
 }
 
 int I_GetRandomTimeSeed(void)
@@ -14,11 +14,14 @@
 #include "w_wad.h"
 #include "st_stuff.h"
 #include "lprintf.h"
+#include "i_system.h"
+#include "GAMMATBL.h"
 
 // مكاتب ESP-IDF الحديثة
 #include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "i_input.h"
 #include "spi_lcd.h" // تأكد أن هذا الملف محدث ليدعم SPI Bus الموحد
 
 static const char *TAG = "DOOM_VIDEO";
@@ -27,9 +30,27 @@ int use_fullscreen = 0;
 int use_doublebuffer = 0;
 
 // لوحة الألوان المحسنة
-int16_t lcdpal[256];
-
-void I_StartTic(void) {}
+// The palette the display task converts with, one of lcdpals
+static const int16_t blackpal[256];
+const int16_t *lcdpal = blackpal;
+
+// Every PLAYPAL palette already converted for the LCD, with the current
+// gamma level applied; I_SetPalette just points lcdpal at one of them
+static int16_t *lcdpals;
+static int numlcdpals;
+static int lcdpalgamma = -1;
+
+#ifdef CONFIG_DOOM_RENDER_RGB565
+// The engine renders RGB565 itself; palette changes are handled by
+// V_SetPalette rebuilding the 16-bit colormaps, lcdpal is unused
+#define I_VIDEOMODE VID_MODE16
+#else
+#define I_VIDEOMODE VID_MODE8
+#endif
+
+void I_StartTic(void) {
+    I_ProcessInput();
+}
 
 void I_ShutdownGraphics(void) {}
 
@@ -41,24 +62,53 @@ int I_StartDisplay(void) {
     return true;
 }
 
-// دالة تحويل لوحة ألوان Doom إلى تنسيق RGB565 الخاص بشاشات SPI
-void I_SetPalette(int pal) {
+static void I_BuildLCDPalettes(void) {
     int pplump = W_GetNumForName("PLAYPAL");
     const byte *palette = W_CacheLumpNum(pplump);
-    palette += pal * (3 * 256);
+    const byte *gtable = GAMMATBL_dat + 256*usegamma;
+    int starttime = I_GetTime_SaveMS();
+
+    // The display task may still be converting a frame through these
+    // tables, so they are allocated once and rebuilt in place on a gamma
+    // change; at worst one frame goes out with mixed gamma levels
+    if (!lcdpals) {
+        numlcdpals = W_LumpLength(pplump) / (3*256);
+        lcdpals = malloc(numlcdpals * 256 * sizeof *lcdpals);
+        if (!lcdpals)
+            I_Error("I_BuildLCDPalettes: no memory for %d palettes", numlcdpals);
+    }
 
-    for (int i = 0; i < 256; i++) {
+    for (int i = 0; i < numlcdpals * 256; i++) {
         // تحويل 8-bit RGB إلى 16-bit RGB565 مع عكس الـ Bytes لتناسب الـ SPI
-        uint16_t r = (palette[0] >> 3) << 11;
-        uint16_t g = (palette[1] >> 2) << 5;
-        uint16_t b = (palette[2] >> 3);
+        uint16_t r = (gtable[palette[0]] >> 3) << 11;
+        uint16_t g = (gtable[palette[1]] >> 2) << 5;
+        uint16_t b = (gtable[palette[2]] >> 3);
         uint16_t color = r | g | b;
-        
+
         // تحويل Big Endian لأن أغلب شاشات SPI تستقبله هكذا
-        lcdpal[i] = (color << 8) | (color >> 8);
+        lcdpals[i] = (color << 8) | (color >> 8);
         palette += 3;
     }
     W_UnlockLumpNum(pplump);
+    lcdpalgamma = usegamma;
+
+    lprintf(LO_INFO, "I_BuildLCDPalettes: %d palettes, gamma %d, %dms\n",
+            numlcdpals, usegamma, I_GetTime_SaveMS() - starttime);
+}
+
+// دالة تحويل لوحة ألوان Doom إلى تنسيق RGB565 الخاص بشاشات SPI
+void I_SetPalette(int pal) {
+    if (V_GetMode() != VID_MODE8)
+        return;
+
+    // Only a gamma change, or the first call, needs PLAYPAL
+    if (lcdpalgamma != usegamma)
+        I_BuildLCDPalettes();
+    if (pal < 0 || pal >= numlcdpals)
+        pal = 0;
+
+    // The display task picks this up at the start of its next frame
+    lcdpal = lcdpals + pal * 256;
 }
 
 // دالة إنهاء تحديث الإطار وإرساله للشاشة
@@ -67,7 +117,8 @@ void I_FinishUpdate(void) {
     uint16_t *scr = (uint16_t *)screens[0].data;
 
     // إرسال البيانات إلى الدرايفر المحدث
-    // ملاحظة: Doom ترسم بـ 8-bit، والدرايفر يجب أن يحولها لـ 16-bit باستخدام lcdpal
+    // ملاحظة: في وضع 8-bit يحولها الدرايفر لـ 16-bit باستخدام lcdpal،
+    // وفي وضع RGB565 يرسلها كما هي
     spi_lcd_send(scr);
 }
 
@@ -76,7 +127,7 @@ void I_PreInitGraphics(void) {
     
     // تخصيص ذاكرة الشاشة في الـ Internal RAM لسرعة قصوى إذا أمكن
     // أو في الـ PSRAM إذا كانت الذاكرة الداخلية لا تكفي
-    size_t sz = SCREENWIDTH * SCREENHEIGHT;
+    size_t sz = SCREENWIDTH * SCREENHEIGHT * V_GetModePixelDepth(I_VIDEOMODE);
     screens[0].data = heap_caps_malloc(sz, MALLOC_CAP_8BIT);
     
     if (!screens[0].data) {
@@ -91,18 +142,22 @@ void I_PreInitGraphics(void) {
 }
 
 void I_SetRes(void) {
+    int pitch = SCREENWIDTH * V_GetPixelDepth();
+
     for (int i = 0; i < 3; i++) {
         screens[i].width = SCREENWIDTH;
         screens[i].height = SCREENHEIGHT;
-        screens[i].byte_pitch = SCREENWIDTH; // Pitch لـ 8-bit هو نفس العرض
-        screens[i].short_pitch = SCREENWIDTH / 2;
-        screens[i].int_pitch = SCREENWIDTH / 4;
+        screens[i].byte_pitch = pitch;
+        screens[i].short_pitch = pitch / 2;
+        screens[i].int_pitch = pitch / 4;
     }
 
     // إعداد شاشة الـ Status Bar
     screens[4].width = SCREENWIDTH;
     screens[4].height = (ST_SCALED_HEIGHT + 1);
-    screens[4].byte_pitch = SCREENWIDTH;
+    screens[4].byte_pitch = pitch;
+    screens[4].short_pitch = pitch / 2;
+    screens[4].int_pitch = pitch / 4;
 
     ESP_LOGI(TAG, "Resolution set to %dx%d", SCREENWIDTH, SCREENHEIGHT);
 }
@@ -121,9 +176,9 @@ void I_InitGraphics(void) {
 }
 
 void I_UpdateVideoMode(void) {
-    ESP_LOGI(TAG, "Setting Video Mode: 8-bit Palette Mode");
-    
-    V_InitMode(VID_MODE8); 
+    ESP_LOGI(TAG, "Setting Video Mode: %d-bit", V_GetModePixelDepth(I_VIDEOMODE) * 8);
+
+    V_InitMode(I_VIDEOMODE);
     I_SetRes();
     R_InitBuffer(SCREENWIDTH, SCREENHEIGHT);
 }
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "doomtype.h"
+
+// Things an input source can ask for. They are mapped to the configured
+// Doom keys (key_up etc.) when the event is drained, so rebinding keys in
+// the menu applies to buttons and the keypad as well.
+typedef enum {
+    IA_UP,
+    IA_DOWN,
+    IA_LEFT,
+    IA_RIGHT,
+    IA_FIRE,
+    IA_USE,
+    IA_STRAFELEFT,
+    IA_STRAFERIGHT,
+    IA_ENTER,
+    IA_ESCAPE,
+    IA_MAP,
+    IA_WEAPONTOGGLE,
+    NUMINPUTACTIONS
+} inputaction_t;
+
+// Queue a press/release. Lock-free, safe to call from ISRs and from any
+// task; the event is timestamped here. Drops the event if the ring is full.
+void I_PostInput(inputaction_t action, boolean down);
+
+// Drain queued events into D_PostEvent. Called from I_StartTic.
+void I_ProcessInput(void);
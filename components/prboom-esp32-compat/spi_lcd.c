@@ -38,6 +38,12 @@
 //You want this, especially at higher framerates. The 2nd buffer is allocated in iram anyway, so isn't really in the way.
 #define DOUBLE_BUFFER
 
+#ifdef CONFIG_DOOM_RENDER_RGB565
+//The engine renders RGB565 itself. A copy of that would be 150K, so the display task reads the
+//engine's frame directly and the engine waits for it to be done before drawing the next one.
+#undef DOUBLE_BUFFER
+#endif
+
 
 /*
  The LCD needs a bunch of command/argument values to be initialized. They are stored in this struct.
@@ -253,7 +259,11 @@ SemaphoreHandle_t dispDoneSem = NULL;
 #define NO_SIM_TRANS 5 //Amount of SPI transfers to queue in parallel
 #define MEM_PER_TRANS 320*2 //in 16-bit words
 
-extern int16_t lcdpal[256];
+extern const int16_t *lcdpal;
+
+// lcdpal as it was when the frame being sent was finished, so that a
+// palette change doesn't land halfway down the screen
+static const int16_t *volatile framePal;
 
 void IRAM_ATTR displayTask(void *arg) {
 	int x, i;
@@ -308,6 +318,7 @@ void IRAM_ATTR displayTask(void *arg) {
 	while(1) {
 		xSemaphoreTake(dispSem, portMAX_DELAY);
 //		printf("Display task: frame.\n");
+		const int16_t *pal=framePal;
 #ifndef DOUBLE_BUFFER
 		uint8_t *myData=(uint8_t*)currFbPtr;
 #endif
@@ -318,14 +329,23 @@ void IRAM_ATTR displayTask(void *arg) {
 #ifdef DOUBLE_BUFFER
 			for (i=0; i<MEM_PER_TRANS; i+=4) {
 				uint32_t d=currFbPtr[(x+i)/4];
-				dmamem[idx][i+0]=lcdpal[(d>>0)&0xff];
-				dmamem[idx][i+1]=lcdpal[(d>>8)&0xff];
-				dmamem[idx][i+2]=lcdpal[(d>>16)&0xff];
-				dmamem[idx][i+3]=lcdpal[(d>>24)&0xff];
+				dmamem[idx][i+0]=pal[(d>>0)&0xff];
+				dmamem[idx][i+1]=pal[(d>>8)&0xff];
+				dmamem[idx][i+2]=pal[(d>>16)&0xff];
+				dmamem[idx][i+3]=pal[(d>>24)&0xff];
+			}
+#elif defined(CONFIG_DOOM_RENDER_RGB565)
+			//Native RGB565, the LCD wants it big-endian. Swap two pixels at a time.
+			const uint32_t *src=(const uint32_t*)myData;
+			uint32_t *dst=(uint32_t*)dmamem[idx];
+			for (i=0; i<MEM_PER_TRANS/2; i++) {
+				uint32_t d=src[i];
+				dst[i]=((d>>8)&0x00ff00ffu)|((d<<8)&0xff00ff00u);
 			}
+			myData+=MEM_PER_TRANS*2;
 #else
 			for (i=0; i<MEM_PER_TRANS; i++) {
-				dmamem[idx][i]=lcdpal[myData[i]];
+				dmamem[idx][i]=pal[myData[i]];
 			}
 			myData+=MEM_PER_TRANS;
 #endif
@@ -370,10 +390,10 @@ void spi_lcd_wait_finish() {
 void spi_lcd_send(uint16_t *scr) {
 #ifdef DOUBLE_BUFFER
 	memcpy(currFbPtr, scr, 320*240);
-	//Theoretically, also should double-buffer the lcdpal array... ahwell.
 #else
 	currFbPtr=scr;
 #endif
+	framePal=lcdpal;
 	xSemaphoreGive(dispSem);
 }
 
@@ -1,3417 +0,0 @@
-const unsigned char SINETABL_dat[] = {
-  0x19, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
-  0xaf, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
-  0x46, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00,
-  0xdd, 0x01, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00,
-  0x74, 0x02, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00,
-  0x0b, 0x03, 0x00, 0x00, 0x3d, 0x03, 0x00, 0x00, 0x6f, 0x03, 0x00, 0x00,
-  0xa1, 0x03, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00,
-  0x38, 0x04, 0x00, 0x00, 0x6a, 0x04, 0x00, 0x00, 0x9d, 0x04, 0x00, 0x00,
-  0xcf, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x33, 0x05, 0x00, 0x00,
-  0x66, 0x05, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00,
-  0xfc, 0x05, 0x00, 0x00, 0x2f, 0x06, 0x00, 0x00, 0x61, 0x06, 0x00, 0x00,
-  0x93, 0x06, 0x00, 0x00, 0xc5, 0x06, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00,
-  0x2a, 0x07, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00, 0x8e, 0x07, 0x00, 0x00,
-  0xc1, 0x07, 0x00, 0x00, 0xf3, 0x07, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00,
-  0x57, 0x08, 0x00, 0x00, 0x8a, 0x08, 0x00, 0x00, 0xbc, 0x08, 0x00, 0x00,
-  0xee, 0x08, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00, 0x53, 0x09, 0x00, 0x00,
-  0x85, 0x09, 0x00, 0x00, 0xb7, 0x09, 0x00, 0x00, 0xe9, 0x09, 0x00, 0x00,
-  0x1b, 0x0a, 0x00, 0x00, 0x4e, 0x0a, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00,
-  0xb2, 0x0a, 0x00, 0x00, 0xe4, 0x0a, 0x00, 0x00, 0x17, 0x0b, 0x00, 0x00,
-  0x49, 0x0b, 0x00, 0x00, 0x7b, 0x0b, 0x00, 0x00, 0xad, 0x0b, 0x00, 0x00,
-  0xdf, 0x0b, 0x00, 0x00, 0x12, 0x0c, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00,
-  0x76, 0x0c, 0x00, 0x00, 0xa8, 0x0c, 0x00, 0x00, 0xdb, 0x0c, 0x00, 0x00,
-  0x0d, 0x0d, 0x00, 0x00, 0x3f, 0x0d, 0x00, 0x00, 0x71, 0x0d, 0x00, 0x00,
-  0xa3, 0x0d, 0x00, 0x00, 0xd5, 0x0d, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00,
-  0x3a, 0x0e, 0x00, 0x00, 0x6c, 0x0e, 0x00, 0x00, 0x9e, 0x0e, 0x00, 0x00,
-  0xd0, 0x0e, 0x00, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x35, 0x0f, 0x00, 0x00,
-  0x67, 0x0f, 0x00, 0x00, 0x99, 0x0f, 0x00, 0x00, 0xcb, 0x0f, 0x00, 0x00,
-  0xfd, 0x0f, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x62, 0x10, 0x00, 0x00,
-  0x94, 0x10, 0x00, 0x00, 0xc6, 0x10, 0x00, 0x00, 0xf8, 0x10, 0x00, 0x00,
-  0x2a, 0x11, 0x00, 0x00, 0x5d, 0x11, 0x00, 0x00, 0x8f, 0x11, 0x00, 0x00,
-  0xc1, 0x11, 0x00, 0x00, 0xf3, 0x11, 0x00, 0x00, 0x25, 0x12, 0x00, 0x00,
-  0x57, 0x12, 0x00, 0x00, 0x89, 0x12, 0x00, 0x00, 0xbc, 0x12, 0x00, 0x00,
-  0xee, 0x12, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x52, 0x13, 0x00, 0x00,
-  0x84, 0x13, 0x00, 0x00, 0xb6, 0x13, 0x00, 0x00, 0xe8, 0x13, 0x00, 0x00,
-  0x1a, 0x14, 0x00, 0x00, 0x4d, 0x14, 0x00, 0x00, 0x7f, 0x14, 0x00, 0x00,
-  0xb1, 0x14, 0x00, 0x00, 0xe3, 0x14, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00,
-  0x47, 0x15, 0x00, 0x00, 0x79, 0x15, 0x00, 0x00, 0xab, 0x15, 0x00, 0x00,
-  0xdd, 0x15, 0x00, 0x00, 0x0f, 0x16, 0x00, 0x00, 0x41, 0x16, 0x00, 0x00,
-  0x74, 0x16, 0x00, 0x00, 0xa6, 0x16, 0x00, 0x00, 0xd8, 0x16, 0x00, 0x00,
-  0x0a, 0x17, 0x00, 0x00, 0x3c, 0x17, 0x00, 0x00, 0x6e, 0x17, 0x00, 0x00,
-  0xa0, 0x17, 0x00, 0x00, 0xd2, 0x17, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00,
-  0x36, 0x18, 0x00, 0x00, 0x68, 0x18, 0x00, 0x00, 0x9a, 0x18, 0x00, 0x00,
-  0xcc, 0x18, 0x00, 0x00, 0xfe, 0x18, 0x00, 0x00, 0x30, 0x19, 0x00, 0x00,
-  0x62, 0x19, 0x00, 0x00, 0x94, 0x19, 0x00, 0x00, 0xc6, 0x19, 0x00, 0x00,
-  0xf8, 0x19, 0x00, 0x00, 0x2a, 0x1a, 0x00, 0x00, 0x5c, 0x1a, 0x00, 0x00,
-  0x8e, 0x1a, 0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00, 0xf2, 0x1a, 0x00, 0x00,
-  0x24, 0x1b, 0x00, 0x00, 0x56, 0x1b, 0x00, 0x00, 0x88, 0x1b, 0x00, 0x00,
-  0xba, 0x1b, 0x00, 0x00, 0xec, 0x1b, 0x00, 0x00, 0x1e, 0x1c, 0x00, 0x00,
-  0x50, 0x1c, 0x00, 0x00, 0x82, 0x1c, 0x00, 0x00, 0xb4, 0x1c, 0x00, 0x00,
-  0xe6, 0x1c, 0x00, 0x00, 0x18, 0x1d, 0x00, 0x00, 0x4a, 0x1d, 0x00, 0x00,
-  0x7c, 0x1d, 0x00, 0x00, 0xae, 0x1d, 0x00, 0x00, 0xe0, 0x1d, 0x00, 0x00,
-  0x11, 0x1e, 0x00, 0x00, 0x43, 0x1e, 0x00, 0x00, 0x75, 0x1e, 0x00, 0x00,
-  0xa7, 0x1e, 0x00, 0x00, 0xd9, 0x1e, 0x00, 0x00, 0x0b, 0x1f, 0x00, 0x00,
-  0x3d, 0x1f, 0x00, 0x00, 0x6f, 0x1f, 0x00, 0x00, 0xa1, 0x1f, 0x00, 0x00,
-  0xd3, 0x1f, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x36, 0x20, 0x00, 0x00,
-  0x68, 0x20, 0x00, 0x00, 0x9a, 0x20, 0x00, 0x00, 0xcc, 0x20, 0x00, 0x00,
-  0xfe, 0x20, 0x00, 0x00, 0x30, 0x21, 0x00, 0x00, 0x61, 0x21, 0x00, 0x00,
-  0x93, 0x21, 0x00, 0x00, 0xc5, 0x21, 0x00, 0x00, 0xf7, 0x21, 0x00, 0x00,
-  0x29, 0x22, 0x00, 0x00, 0x5a, 0x22, 0x00, 0x00, 0x8c, 0x22, 0x00, 0x00,
-  0xbe, 0x22, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x22, 0x23, 0x00, 0x00,
-  0x53, 0x23, 0x00, 0x00, 0x85, 0x23, 0x00, 0x00, 0xb7, 0x23, 0x00, 0x00,
-  0xe9, 0x23, 0x00, 0x00, 0x1b, 0x24, 0x00, 0x00, 0x4c, 0x24, 0x00, 0x00,
-  0x7e, 0x24, 0x00, 0x00, 0xb0, 0x24, 0x00, 0x00, 0xe2, 0x24, 0x00, 0x00,
-  0x13, 0x25, 0x00, 0x00, 0x45, 0x25, 0x00, 0x00, 0x77, 0x25, 0x00, 0x00,
-  0xa8, 0x25, 0x00, 0x00, 0xda, 0x25, 0x00, 0x00, 0x0c, 0x26, 0x00, 0x00,
-  0x3e, 0x26, 0x00, 0x00, 0x6f, 0x26, 0x00, 0x00, 0xa1, 0x26, 0x00, 0x00,
-  0xd3, 0x26, 0x00, 0x00, 0x04, 0x27, 0x00, 0x00, 0x36, 0x27, 0x00, 0x00,
-  0x68, 0x27, 0x00, 0x00, 0x99, 0x27, 0x00, 0x00, 0xcb, 0x27, 0x00, 0x00,
-  0xfd, 0x27, 0x00, 0x00, 0x2e, 0x28, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00,
-  0x92, 0x28, 0x00, 0x00, 0xc3, 0x28, 0x00, 0x00, 0xf5, 0x28, 0x00, 0x00,
-  0x26, 0x29, 0x00, 0x00, 0x58, 0x29, 0x00, 0x00, 0x8a, 0x29, 0x00, 0x00,
-  0xbb, 0x29, 0x00, 0x00, 0xed, 0x29, 0x00, 0x00, 0x1e, 0x2a, 0x00, 0x00,
-  0x50, 0x2a, 0x00, 0x00, 0x82, 0x2a, 0x00, 0x00, 0xb3, 0x2a, 0x00, 0x00,
-  0xe5, 0x2a, 0x00, 0x00, 0x16, 0x2b, 0x00, 0x00, 0x48, 0x2b, 0x00, 0x00,
-  0x79, 0x2b, 0x00, 0x00, 0xab, 0x2b, 0x00, 0x00, 0xdc, 0x2b, 0x00, 0x00,
-  0x0e, 0x2c, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x00, 0x71, 0x2c, 0x00, 0x00,
-  0xa2, 0x2c, 0x00, 0x00, 0xd4, 0x2c, 0x00, 0x00, 0x05, 0x2d, 0x00, 0x00,
-  0x37, 0x2d, 0x00, 0x00, 0x68, 0x2d, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0x00,
-  0xcb, 0x2d, 0x00, 0x00, 0xfd, 0x2d, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x00,
-  0x60, 0x2e, 0x00, 0x00, 0x91, 0x2e, 0x00, 0x00, 0xc2, 0x2e, 0x00, 0x00,
-  0xf4, 0x2e, 0x00, 0x00, 0x25, 0x2f, 0x00, 0x00, 0x57, 0x2f, 0x00, 0x00,
-  0x88, 0x2f, 0x00, 0x00, 0xba, 0x2f, 0x00, 0x00, 0xeb, 0x2f, 0x00, 0x00,
-  0x1c, 0x30, 0x00, 0x00, 0x4e, 0x30, 0x00, 0x00, 0x7f, 0x30, 0x00, 0x00,
-  0xb0, 0x30, 0x00, 0x00, 0xe2, 0x30, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00,
-  0x44, 0x31, 0x00, 0x00, 0x76, 0x31, 0x00, 0x00, 0xa7, 0x31, 0x00, 0x00,
-  0xd8, 0x31, 0x00, 0x00, 0x0a, 0x32, 0x00, 0x00, 0x3b, 0x32, 0x00, 0x00,
-  0x6c, 0x32, 0x00, 0x00, 0x9d, 0x32, 0x00, 0x00, 0xcf, 0x32, 0x00, 0x00,
-  0x00, 0x33, 0x00, 0x00, 0x31, 0x33, 0x00, 0x00, 0x62, 0x33, 0x00, 0x00,
-  0x94, 0x33, 0x00, 0x00, 0xc5, 0x33, 0x00, 0x00, 0xf6, 0x33, 0x00, 0x00,
-  0x27, 0x34, 0x00, 0x00, 0x59, 0x34, 0x00, 0x00, 0x8a, 0x34, 0x00, 0x00,
-  0xbb, 0x34, 0x00, 0x00, 0xec, 0x34, 0x00, 0x00, 0x1d, 0x35, 0x00, 0x00,
-  0x4f, 0x35, 0x00, 0x00, 0x80, 0x35, 0x00, 0x00, 0xb1, 0x35, 0x00, 0x00,
-  0xe2, 0x35, 0x00, 0x00, 0x13, 0x36, 0x00, 0x00, 0x44, 0x36, 0x00, 0x00,
-  0x75, 0x36, 0x00, 0x00, 0xa6, 0x36, 0x00, 0x00, 0xd8, 0x36, 0x00, 0x00,
-  0x09, 0x37, 0x00, 0x00, 0x3a, 0x37, 0x00, 0x00, 0x6b, 0x37, 0x00, 0x00,
-  0x9c, 0x37, 0x00, 0x00, 0xcd, 0x37, 0x00, 0x00, 0xfe, 0x37, 0x00, 0x00,
-  0x2f, 0x38, 0x00, 0x00, 0x60, 0x38, 0x00, 0x00, 0x91, 0x38, 0x00, 0x00,
-  0xc2, 0x38, 0x00, 0x00, 0xf3, 0x38, 0x00, 0x00, 0x24, 0x39, 0x00, 0x00,
-  0x55, 0x39, 0x00, 0x00, 0x86, 0x39, 0x00, 0x00, 0xb7, 0x39, 0x00, 0x00,
-  0xe8, 0x39, 0x00, 0x00, 0x19, 0x3a, 0x00, 0x00, 0x4a, 0x3a, 0x00, 0x00,
-  0x7b, 0x3a, 0x00, 0x00, 0xac, 0x3a, 0x00, 0x00, 0xdd, 0x3a, 0x00, 0x00,
-  0x0e, 0x3b, 0x00, 0x00, 0x3f, 0x3b, 0x00, 0x00, 0x6f, 0x3b, 0x00, 0x00,
-  0xa0, 0x3b, 0x00, 0x00, 0xd1, 0x3b, 0x00, 0x00, 0x02, 0x3c, 0x00, 0x00,
-  0x33, 0x3c, 0x00, 0x00, 0x64, 0x3c, 0x00, 0x00, 0x95, 0x3c, 0x00, 0x00,
-  0xc5, 0x3c, 0x00, 0x00, 0xf6, 0x3c, 0x00, 0x00, 0x27, 0x3d, 0x00, 0x00,
-  0x58, 0x3d, 0x00, 0x00, 0x89, 0x3d, 0x00, 0x00, 0xba, 0x3d, 0x00, 0x00,
-  0xea, 0x3d, 0x00, 0x00, 0x1b, 0x3e, 0x00, 0x00, 0x4c, 0x3e, 0x00, 0x00,
-  0x7d, 0x3e, 0x00, 0x00, 0xad, 0x3e, 0x00, 0x00, 0xde, 0x3e, 0x00, 0x00,
-  0x0f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x70, 0x3f, 0x00, 0x00,
-  0xa1, 0x3f, 0x00, 0x00, 0xd2, 0x3f, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-  0x33, 0x40, 0x00, 0x00, 0x64, 0x40, 0x00, 0x00, 0x94, 0x40, 0x00, 0x00,
-  0xc5, 0x40, 0x00, 0x00, 0xf5, 0x40, 0x00, 0x00, 0x26, 0x41, 0x00, 0x00,
-  0x57, 0x41, 0x00, 0x00, 0x87, 0x41, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00,
-  0xe8, 0x41, 0x00, 0x00, 0x19, 0x42, 0x00, 0x00, 0x4a, 0x42, 0x00, 0x00,
-  0x7a, 0x42, 0x00, 0x00, 0xab, 0x42, 0x00, 0x00, 0xdb, 0x42, 0x00, 0x00,
-  0x0c, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00,
-  0x9d, 0x43, 0x00, 0x00, 0xce, 0x43, 0x00, 0x00, 0xfe, 0x43, 0x00, 0x00,
-  0x2f, 0x44, 0x00, 0x00, 0x5f, 0x44, 0x00, 0x00, 0x8f, 0x44, 0x00, 0x00,
-  0xc0, 0x44, 0x00, 0x00, 0xf0, 0x44, 0x00, 0x00, 0x21, 0x45, 0x00, 0x00,
-  0x51, 0x45, 0x00, 0x00, 0x81, 0x45, 0x00, 0x00, 0xb2, 0x45, 0x00, 0x00,
-  0xe2, 0x45, 0x00, 0x00, 0x13, 0x46, 0x00, 0x00, 0x43, 0x46, 0x00, 0x00,
-  0x73, 0x46, 0x00, 0x00, 0xa4, 0x46, 0x00, 0x00, 0xd4, 0x46, 0x00, 0x00,
-  0x04, 0x47, 0x00, 0x00, 0x34, 0x47, 0x00, 0x00, 0x65, 0x47, 0x00, 0x00,
-  0x95, 0x47, 0x00, 0x00, 0xc5, 0x47, 0x00, 0x00, 0xf5, 0x47, 0x00, 0x00,
-  0x26, 0x48, 0x00, 0x00, 0x56, 0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x00,
-  0xb6, 0x48, 0x00, 0x00, 0xe7, 0x48, 0x00, 0x00, 0x17, 0x49, 0x00, 0x00,
-  0x47, 0x49, 0x00, 0x00, 0x77, 0x49, 0x00, 0x00, 0xa7, 0x49, 0x00, 0x00,
-  0xd7, 0x49, 0x00, 0x00, 0x07, 0x4a, 0x00, 0x00, 0x38, 0x4a, 0x00, 0x00,
-  0x68, 0x4a, 0x00, 0x00, 0x98, 0x4a, 0x00, 0x00, 0xc8, 0x4a, 0x00, 0x00,
-  0xf8, 0x4a, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x00, 0x58, 0x4b, 0x00, 0x00,
-  0x88, 0x4b, 0x00, 0x00, 0xb8, 0x4b, 0x00, 0x00, 0xe8, 0x4b, 0x00, 0x00,
-  0x18, 0x4c, 0x00, 0x00, 0x48, 0x4c, 0x00, 0x00, 0x78, 0x4c, 0x00, 0x00,
-  0xa8, 0x4c, 0x00, 0x00, 0xd8, 0x4c, 0x00, 0x00, 0x08, 0x4d, 0x00, 0x00,
-  0x38, 0x4d, 0x00, 0x00, 0x68, 0x4d, 0x00, 0x00, 0x98, 0x4d, 0x00, 0x00,
-  0xc8, 0x4d, 0x00, 0x00, 0xf7, 0x4d, 0x00, 0x00, 0x27, 0x4e, 0x00, 0x00,
-  0x57, 0x4e, 0x00, 0x00, 0x87, 0x4e, 0x00, 0x00, 0xb7, 0x4e, 0x00, 0x00,
-  0xe7, 0x4e, 0x00, 0x00, 0x16, 0x4f, 0x00, 0x00, 0x46, 0x4f, 0x00, 0x00,
-  0x76, 0x4f, 0x00, 0x00, 0xa6, 0x4f, 0x00, 0x00, 0xd6, 0x4f, 0x00, 0x00,
-  0x05, 0x50, 0x00, 0x00, 0x35, 0x50, 0x00, 0x00, 0x65, 0x50, 0x00, 0x00,
-  0x95, 0x50, 0x00, 0x00, 0xc4, 0x50, 0x00, 0x00, 0xf4, 0x50, 0x00, 0x00,
-  0x24, 0x51, 0x00, 0x00, 0x53, 0x51, 0x00, 0x00, 0x83, 0x51, 0x00, 0x00,
-  0xb3, 0x51, 0x00, 0x00, 0xe2, 0x51, 0x00, 0x00, 0x12, 0x52, 0x00, 0x00,
-  0x41, 0x52, 0x00, 0x00, 0x71, 0x52, 0x00, 0x00, 0xa1, 0x52, 0x00, 0x00,
-  0xd0, 0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x2f, 0x53, 0x00, 0x00,
-  0x5f, 0x53, 0x00, 0x00, 0x8e, 0x53, 0x00, 0x00, 0xbe, 0x53, 0x00, 0x00,
-  0xed, 0x53, 0x00, 0x00, 0x1d, 0x54, 0x00, 0x00, 0x4c, 0x54, 0x00, 0x00,
-  0x7c, 0x54, 0x00, 0x00, 0xab, 0x54, 0x00, 0x00, 0xdb, 0x54, 0x00, 0x00,
-  0x0a, 0x55, 0x00, 0x00, 0x39, 0x55, 0x00, 0x00, 0x69, 0x55, 0x00, 0x00,
-  0x98, 0x55, 0x00, 0x00, 0xc8, 0x55, 0x00, 0x00, 0xf7, 0x55, 0x00, 0x00,
-  0x26, 0x56, 0x00, 0x00, 0x56, 0x56, 0x00, 0x00, 0x85, 0x56, 0x00, 0x00,
-  0xb4, 0x56, 0x00, 0x00, 0xe3, 0x56, 0x00, 0x00, 0x13, 0x57, 0x00, 0x00,
-  0x42, 0x57, 0x00, 0x00, 0x71, 0x57, 0x00, 0x00, 0xa1, 0x57, 0x00, 0x00,
-  0xd0, 0x57, 0x00, 0x00, 0xff, 0x57, 0x00, 0x00, 0x2e, 0x58, 0x00, 0x00,
-  0x5d, 0x58, 0x00, 0x00, 0x8c, 0x58, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00,
-  0xeb, 0x58, 0x00, 0x00, 0x1a, 0x59, 0x00, 0x00, 0x49, 0x59, 0x00, 0x00,
-  0x78, 0x59, 0x00, 0x00, 0xa7, 0x59, 0x00, 0x00, 0xd6, 0x59, 0x00, 0x00,
-  0x05, 0x5a, 0x00, 0x00, 0x34, 0x5a, 0x00, 0x00, 0x63, 0x5a, 0x00, 0x00,
-  0x92, 0x5a, 0x00, 0x00, 0xc1, 0x5a, 0x00, 0x00, 0xf0, 0x5a, 0x00, 0x00,
-  0x1f, 0x5b, 0x00, 0x00, 0x4e, 0x5b, 0x00, 0x00, 0x7d, 0x5b, 0x00, 0x00,
-  0xac, 0x5b, 0x00, 0x00, 0xdb, 0x5b, 0x00, 0x00, 0x0a, 0x5c, 0x00, 0x00,
-  0x39, 0x5c, 0x00, 0x00, 0x68, 0x5c, 0x00, 0x00, 0x97, 0x5c, 0x00, 0x00,
-  0xc6, 0x5c, 0x00, 0x00, 0xf4, 0x5c, 0x00, 0x00, 0x23, 0x5d, 0x00, 0x00,
-  0x52, 0x5d, 0x00, 0x00, 0x81, 0x5d, 0x00, 0x00, 0xb0, 0x5d, 0x00, 0x00,
-  0xde, 0x5d, 0x00, 0x00, 0x0d, 0x5e, 0x00, 0x00, 0x3c, 0x5e, 0x00, 0x00,
-  0x6b, 0x5e, 0x00, 0x00, 0x99, 0x5e, 0x00, 0x00, 0xc8, 0x5e, 0x00, 0x00,
-  0xf7, 0x5e, 0x00, 0x00, 0x25, 0x5f, 0x00, 0x00, 0x54, 0x5f, 0x00, 0x00,
-  0x83, 0x5f, 0x00, 0x00, 0xb1, 0x5f, 0x00, 0x00, 0xe0, 0x5f, 0x00, 0x00,
-  0x0f, 0x60, 0x00, 0x00, 0x3d, 0x60, 0x00, 0x00, 0x6c, 0x60, 0x00, 0x00,
-  0x9a, 0x60, 0x00, 0x00, 0xc9, 0x60, 0x00, 0x00, 0xf7, 0x60, 0x00, 0x00,
-  0x26, 0x61, 0x00, 0x00, 0x54, 0x61, 0x00, 0x00, 0x83, 0x61, 0x00, 0x00,
-  0xb1, 0x61, 0x00, 0x00, 0xe0, 0x61, 0x00, 0x00, 0x0e, 0x62, 0x00, 0x00,
-  0x3d, 0x62, 0x00, 0x00, 0x6b, 0x62, 0x00, 0x00, 0x99, 0x62, 0x00, 0x00,
-  0xc8, 0x62, 0x00, 0x00, 0xf6, 0x62, 0x00, 0x00, 0x25, 0x63, 0x00, 0x00,
-  0x53, 0x63, 0x00, 0x00, 0x81, 0x63, 0x00, 0x00, 0xb0, 0x63, 0x00, 0x00,
-  0xde, 0x63, 0x00, 0x00, 0x0c, 0x64, 0x00, 0x00, 0x3a, 0x64, 0x00, 0x00,
-  0x69, 0x64, 0x00, 0x00, 0x97, 0x64, 0x00, 0x00, 0xc5, 0x64, 0x00, 0x00,
-  0xf3, 0x64, 0x00, 0x00, 0x21, 0x65, 0x00, 0x00, 0x50, 0x65, 0x00, 0x00,
-  0x7e, 0x65, 0x00, 0x00, 0xac, 0x65, 0x00, 0x00, 0xda, 0x65, 0x00, 0x00,
-  0x08, 0x66, 0x00, 0x00, 0x36, 0x66, 0x00, 0x00, 0x64, 0x66, 0x00, 0x00,
-  0x92, 0x66, 0x00, 0x00, 0xc0, 0x66, 0x00, 0x00, 0xee, 0x66, 0x00, 0x00,
-  0x1c, 0x67, 0x00, 0x00, 0x4a, 0x67, 0x00, 0x00, 0x78, 0x67, 0x00, 0x00,
-  0xa6, 0x67, 0x00, 0x00, 0xd4, 0x67, 0x00, 0x00, 0x02, 0x68, 0x00, 0x00,
-  0x30, 0x68, 0x00, 0x00, 0x5e, 0x68, 0x00, 0x00, 0x8c, 0x68, 0x00, 0x00,
-  0xba, 0x68, 0x00, 0x00, 0xe8, 0x68, 0x00, 0x00, 0x16, 0x69, 0x00, 0x00,
-  0x43, 0x69, 0x00, 0x00, 0x71, 0x69, 0x00, 0x00, 0x9f, 0x69, 0x00, 0x00,
-  0xcd, 0x69, 0x00, 0x00, 0xfb, 0x69, 0x00, 0x00, 0x28, 0x6a, 0x00, 0x00,
-  0x56, 0x6a, 0x00, 0x00, 0x84, 0x6a, 0x00, 0x00, 0xb1, 0x6a, 0x00, 0x00,
-  0xdf, 0x6a, 0x00, 0x00, 0x0d, 0x6b, 0x00, 0x00, 0x3a, 0x6b, 0x00, 0x00,
-  0x68, 0x6b, 0x00, 0x00, 0x96, 0x6b, 0x00, 0x00, 0xc3, 0x6b, 0x00, 0x00,
-  0xf1, 0x6b, 0x00, 0x00, 0x1e, 0x6c, 0x00, 0x00, 0x4c, 0x6c, 0x00, 0x00,
-  0x7a, 0x6c, 0x00, 0x00, 0xa7, 0x6c, 0x00, 0x00, 0xd5, 0x6c, 0x00, 0x00,
-  0x02, 0x6d, 0x00, 0x00, 0x30, 0x6d, 0x00, 0x00, 0x5d, 0x6d, 0x00, 0x00,
-  0x8a, 0x6d, 0x00, 0x00, 0xb8, 0x6d, 0x00, 0x00, 0xe5, 0x6d, 0x00, 0x00,
-  0x13, 0x6e, 0x00, 0x00, 0x40, 0x6e, 0x00, 0x00, 0x6d, 0x6e, 0x00, 0x00,
-  0x9b, 0x6e, 0x00, 0x00, 0xc8, 0x6e, 0x00, 0x00, 0xf5, 0x6e, 0x00, 0x00,
-  0x23, 0x6f, 0x00, 0x00, 0x50, 0x6f, 0x00, 0x00, 0x7d, 0x6f, 0x00, 0x00,
-  0xaa, 0x6f, 0x00, 0x00, 0xd8, 0x6f, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00,
-  0x32, 0x70, 0x00, 0x00, 0x5f, 0x70, 0x00, 0x00, 0x8c, 0x70, 0x00, 0x00,
-  0xba, 0x70, 0x00, 0x00, 0xe7, 0x70, 0x00, 0x00, 0x14, 0x71, 0x00, 0x00,
-  0x41, 0x71, 0x00, 0x00, 0x6e, 0x71, 0x00, 0x00, 0x9b, 0x71, 0x00, 0x00,
-  0xc8, 0x71, 0x00, 0x00, 0xf5, 0x71, 0x00, 0x00, 0x22, 0x72, 0x00, 0x00,
-  0x4f, 0x72, 0x00, 0x00, 0x7c, 0x72, 0x00, 0x00, 0xa9, 0x72, 0x00, 0x00,
-  0xd6, 0x72, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x30, 0x73, 0x00, 0x00,
-  0x5d, 0x73, 0x00, 0x00, 0x89, 0x73, 0x00, 0x00, 0xb6, 0x73, 0x00, 0x00,
-  0xe3, 0x73, 0x00, 0x00, 0x10, 0x74, 0x00, 0x00, 0x3d, 0x74, 0x00, 0x00,
-  0x69, 0x74, 0x00, 0x00, 0x96, 0x74, 0x00, 0x00, 0xc3, 0x74, 0x00, 0x00,
-  0xf0, 0x74, 0x00, 0x00, 0x1c, 0x75, 0x00, 0x00, 0x49, 0x75, 0x00, 0x00,
-  0x76, 0x75, 0x00, 0x00, 0xa2, 0x75, 0x00, 0x00, 0xcf, 0x75, 0x00, 0x00,
-  0xfc, 0x75, 0x00, 0x00, 0x28, 0x76, 0x00, 0x00, 0x55, 0x76, 0x00, 0x00,
-  0x81, 0x76, 0x00, 0x00, 0xae, 0x76, 0x00, 0x00, 0xda, 0x76, 0x00, 0x00,
-  0x07, 0x77, 0x00, 0x00, 0x33, 0x77, 0x00, 0x00, 0x60, 0x77, 0x00, 0x00,
-  0x8c, 0x77, 0x00, 0x00, 0xb9, 0x77, 0x00, 0x00, 0xe5, 0x77, 0x00, 0x00,
-  0x12, 0x78, 0x00, 0x00, 0x3e, 0x78, 0x00, 0x00, 0x6a, 0x78, 0x00, 0x00,
-  0x97, 0x78, 0x00, 0x00, 0xc3, 0x78, 0x00, 0x00, 0xef, 0x78, 0x00, 0x00,
-  0x1c, 0x79, 0x00, 0x00, 0x48, 0x79, 0x00, 0x00, 0x74, 0x79, 0x00, 0x00,
-  0xa0, 0x79, 0x00, 0x00, 0xcd, 0x79, 0x00, 0x00, 0xf9, 0x79, 0x00, 0x00,
-  0x25, 0x7a, 0x00, 0x00, 0x51, 0x7a, 0x00, 0x00, 0x7d, 0x7a, 0x00, 0x00,
-  0xaa, 0x7a, 0x00, 0x00, 0xd6, 0x7a, 0x00, 0x00, 0x02, 0x7b, 0x00, 0x00,
-  0x2e, 0x7b, 0x00, 0x00, 0x5a, 0x7b, 0x00, 0x00, 0x86, 0x7b, 0x00, 0x00,
-  0xb2, 0x7b, 0x00, 0x00, 0xde, 0x7b, 0x00, 0x00, 0x0a, 0x7c, 0x00, 0x00,
-  0x36, 0x7c, 0x00, 0x00, 0x62, 0x7c, 0x00, 0x00, 0x8e, 0x7c, 0x00, 0x00,
-  0xba, 0x7c, 0x00, 0x00, 0xe6, 0x7c, 0x00, 0x00, 0x11, 0x7d, 0x00, 0x00,
-  0x3d, 0x7d, 0x00, 0x00, 0x69, 0x7d, 0x00, 0x00, 0x95, 0x7d, 0x00, 0x00,
-  0xc1, 0x7d, 0x00, 0x00, 0xec, 0x7d, 0x00, 0x00, 0x18, 0x7e, 0x00, 0x00,
-  0x44, 0x7e, 0x00, 0x00, 0x70, 0x7e, 0x00, 0x00, 0x9b, 0x7e, 0x00, 0x00,
-  0xc7, 0x7e, 0x00, 0x00, 0xf3, 0x7e, 0x00, 0x00, 0x1e, 0x7f, 0x00, 0x00,
-  0x4a, 0x7f, 0x00, 0x00, 0x76, 0x7f, 0x00, 0x00, 0xa1, 0x7f, 0x00, 0x00,
-  0xcd, 0x7f, 0x00, 0x00, 0xf8, 0x7f, 0x00, 0x00, 0x24, 0x80, 0x00, 0x00,
-  0x4f, 0x80, 0x00, 0x00, 0x7b, 0x80, 0x00, 0x00, 0xa6, 0x80, 0x00, 0x00,
-  0xd2, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x29, 0x81, 0x00, 0x00,
-  0x54, 0x81, 0x00, 0x00, 0x7f, 0x81, 0x00, 0x00, 0xab, 0x81, 0x00, 0x00,
-  0xd6, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x2d, 0x82, 0x00, 0x00,
-  0x58, 0x82, 0x00, 0x00, 0x83, 0x82, 0x00, 0x00, 0xae, 0x82, 0x00, 0x00,
-  0xda, 0x82, 0x00, 0x00, 0x05, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00,
-  0x5b, 0x83, 0x00, 0x00, 0x86, 0x83, 0x00, 0x00, 0xb1, 0x83, 0x00, 0x00,
-  0xdc, 0x83, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x33, 0x84, 0x00, 0x00,
-  0x5e, 0x84, 0x00, 0x00, 0x89, 0x84, 0x00, 0x00, 0xb4, 0x84, 0x00, 0x00,
-  0xdf, 0x84, 0x00, 0x00, 0x09, 0x85, 0x00, 0x00, 0x34, 0x85, 0x00, 0x00,
-  0x5f, 0x85, 0x00, 0x00, 0x8a, 0x85, 0x00, 0x00, 0xb5, 0x85, 0x00, 0x00,
-  0xe0, 0x85, 0x00, 0x00, 0x0b, 0x86, 0x00, 0x00, 0x36, 0x86, 0x00, 0x00,
-  0x60, 0x86, 0x00, 0x00, 0x8b, 0x86, 0x00, 0x00, 0xb6, 0x86, 0x00, 0x00,
-  0xe1, 0x86, 0x00, 0x00, 0x0b, 0x87, 0x00, 0x00, 0x36, 0x87, 0x00, 0x00,
-  0x61, 0x87, 0x00, 0x00, 0x8b, 0x87, 0x00, 0x00, 0xb6, 0x87, 0x00, 0x00,
-  0xe1, 0x87, 0x00, 0x00, 0x0b, 0x88, 0x00, 0x00, 0x36, 0x88, 0x00, 0x00,
-  0x60, 0x88, 0x00, 0x00, 0x8b, 0x88, 0x00, 0x00, 0xb5, 0x88, 0x00, 0x00,
-  0xe0, 0x88, 0x00, 0x00, 0x0a, 0x89, 0x00, 0x00, 0x35, 0x89, 0x00, 0x00,
-  0x5f, 0x89, 0x00, 0x00, 0x8a, 0x89, 0x00, 0x00, 0xb4, 0x89, 0x00, 0x00,
-  0xde, 0x89, 0x00, 0x00, 0x09, 0x8a, 0x00, 0x00, 0x33, 0x8a, 0x00, 0x00,
-  0x5d, 0x8a, 0x00, 0x00, 0x88, 0x8a, 0x00, 0x00, 0xb2, 0x8a, 0x00, 0x00,
-  0xdc, 0x8a, 0x00, 0x00, 0x06, 0x8b, 0x00, 0x00, 0x31, 0x8b, 0x00, 0x00,
-  0x5b, 0x8b, 0x00, 0x00, 0x85, 0x8b, 0x00, 0x00, 0xaf, 0x8b, 0x00, 0x00,
-  0xd9, 0x8b, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x2d, 0x8c, 0x00, 0x00,
-  0x57, 0x8c, 0x00, 0x00, 0x81, 0x8c, 0x00, 0x00, 0xab, 0x8c, 0x00, 0x00,
-  0xd5, 0x8c, 0x00, 0x00, 0xff, 0x8c, 0x00, 0x00, 0x29, 0x8d, 0x00, 0x00,
-  0x53, 0x8d, 0x00, 0x00, 0x7d, 0x8d, 0x00, 0x00, 0xa7, 0x8d, 0x00, 0x00,
-  0xd1, 0x8d, 0x00, 0x00, 0xfb, 0x8d, 0x00, 0x00, 0x24, 0x8e, 0x00, 0x00,
-  0x4e, 0x8e, 0x00, 0x00, 0x78, 0x8e, 0x00, 0x00, 0xa2, 0x8e, 0x00, 0x00,
-  0xcb, 0x8e, 0x00, 0x00, 0xf5, 0x8e, 0x00, 0x00, 0x1f, 0x8f, 0x00, 0x00,
-  0x49, 0x8f, 0x00, 0x00, 0x72, 0x8f, 0x00, 0x00, 0x9c, 0x8f, 0x00, 0x00,
-  0xc5, 0x8f, 0x00, 0x00, 0xef, 0x8f, 0x00, 0x00, 0x19, 0x90, 0x00, 0x00,
-  0x42, 0x90, 0x00, 0x00, 0x6c, 0x90, 0x00, 0x00, 0x95, 0x90, 0x00, 0x00,
-  0xbf, 0x90, 0x00, 0x00, 0xe8, 0x90, 0x00, 0x00, 0x11, 0x91, 0x00, 0x00,
-  0x3b, 0x91, 0x00, 0x00, 0x64, 0x91, 0x00, 0x00, 0x8e, 0x91, 0x00, 0x00,
-  0xb7, 0x91, 0x00, 0x00, 0xe0, 0x91, 0x00, 0x00, 0x0a, 0x92, 0x00, 0x00,
-  0x33, 0x92, 0x00, 0x00, 0x5c, 0x92, 0x00, 0x00, 0x85, 0x92, 0x00, 0x00,
-  0xaf, 0x92, 0x00, 0x00, 0xd8, 0x92, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00,
-  0x2a, 0x93, 0x00, 0x00, 0x53, 0x93, 0x00, 0x00, 0x7c, 0x93, 0x00, 0x00,
-  0xa5, 0x93, 0x00, 0x00, 0xce, 0x93, 0x00, 0x00, 0xf7, 0x93, 0x00, 0x00,
-  0x20, 0x94, 0x00, 0x00, 0x49, 0x94, 0x00, 0x00, 0x72, 0x94, 0x00, 0x00,
-  0x9b, 0x94, 0x00, 0x00, 0xc4, 0x94, 0x00, 0x00, 0xed, 0x94, 0x00, 0x00,
-  0x16, 0x95, 0x00, 0x00, 0x3f, 0x95, 0x00, 0x00, 0x68, 0x95, 0x00, 0x00,
-  0x90, 0x95, 0x00, 0x00, 0xb9, 0x95, 0x00, 0x00, 0xe2, 0x95, 0x00, 0x00,
-  0x0b, 0x96, 0x00, 0x00, 0x33, 0x96, 0x00, 0x00, 0x5c, 0x96, 0x00, 0x00,
-  0x85, 0x96, 0x00, 0x00, 0xad, 0x96, 0x00, 0x00, 0xd6, 0x96, 0x00, 0x00,
-  0xff, 0x96, 0x00, 0x00, 0x27, 0x97, 0x00, 0x00, 0x50, 0x97, 0x00, 0x00,
-  0x78, 0x97, 0x00, 0x00, 0xa1, 0x97, 0x00, 0x00, 0xc9, 0x97, 0x00, 0x00,
-  0xf2, 0x97, 0x00, 0x00, 0x1a, 0x98, 0x00, 0x00, 0x43, 0x98, 0x00, 0x00,
-  0x6b, 0x98, 0x00, 0x00, 0x93, 0x98, 0x00, 0x00, 0xbc, 0x98, 0x00, 0x00,
-  0xe4, 0x98, 0x00, 0x00, 0x0c, 0x99, 0x00, 0x00, 0x35, 0x99, 0x00, 0x00,
-  0x5d, 0x99, 0x00, 0x00, 0x85, 0x99, 0x00, 0x00, 0xad, 0x99, 0x00, 0x00,
-  0xd6, 0x99, 0x00, 0x00, 0xfe, 0x99, 0x00, 0x00, 0x26, 0x9a, 0x00, 0x00,
-  0x4e, 0x9a, 0x00, 0x00, 0x76, 0x9a, 0x00, 0x00, 0x9e, 0x9a, 0x00, 0x00,
-  0xc6, 0x9a, 0x00, 0x00, 0xee, 0x9a, 0x00, 0x00, 0x16, 0x9b, 0x00, 0x00,
-  0x3e, 0x9b, 0x00, 0x00, 0x66, 0x9b, 0x00, 0x00, 0x8e, 0x9b, 0x00, 0x00,
-  0xb6, 0x9b, 0x00, 0x00, 0xde, 0x9b, 0x00, 0x00, 0x06, 0x9c, 0x00, 0x00,
-  0x2e, 0x9c, 0x00, 0x00, 0x55, 0x9c, 0x00, 0x00, 0x7d, 0x9c, 0x00, 0x00,
-  0xa5, 0x9c, 0x00, 0x00, 0xcd, 0x9c, 0x00, 0x00, 0xf4, 0x9c, 0x00, 0x00,
-  0x1c, 0x9d, 0x00, 0x00, 0x44, 0x9d, 0x00, 0x00, 0x6c, 0x9d, 0x00, 0x00,
-  0x93, 0x9d, 0x00, 0x00, 0xbb, 0x9d, 0x00, 0x00, 0xe2, 0x9d, 0x00, 0x00,
-  0x0a, 0x9e, 0x00, 0x00, 0x31, 0x9e, 0x00, 0x00, 0x59, 0x9e, 0x00, 0x00,
-  0x80, 0x9e, 0x00, 0x00, 0xa8, 0x9e, 0x00, 0x00, 0xcf, 0x9e, 0x00, 0x00,
-  0xf7, 0x9e, 0x00, 0x00, 0x1e, 0x9f, 0x00, 0x00, 0x45, 0x9f, 0x00, 0x00,
-  0x6d, 0x9f, 0x00, 0x00, 0x94, 0x9f, 0x00, 0x00, 0xbb, 0x9f, 0x00, 0x00,
-  0xe3, 0x9f, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x31, 0xa0, 0x00, 0x00,
-  0x58, 0xa0, 0x00, 0x00, 0x7f, 0xa0, 0x00, 0x00, 0xa7, 0xa0, 0x00, 0x00,
-  0xce, 0xa0, 0x00, 0x00, 0xf5, 0xa0, 0x00, 0x00, 0x1c, 0xa1, 0x00, 0x00,
-  0x43, 0xa1, 0x00, 0x00, 0x6a, 0xa1, 0x00, 0x00, 0x91, 0xa1, 0x00, 0x00,
-  0xb8, 0xa1, 0x00, 0x00, 0xdf, 0xa1, 0x00, 0x00, 0x06, 0xa2, 0x00, 0x00,
-  0x2d, 0xa2, 0x00, 0x00, 0x54, 0xa2, 0x00, 0x00, 0x7b, 0xa2, 0x00, 0x00,
-  0xa1, 0xa2, 0x00, 0x00, 0xc8, 0xa2, 0x00, 0x00, 0xef, 0xa2, 0x00, 0x00,
-  0x16, 0xa3, 0x00, 0x00, 0x3c, 0xa3, 0x00, 0x00, 0x63, 0xa3, 0x00, 0x00,
-  0x8a, 0xa3, 0x00, 0x00, 0xb0, 0xa3, 0x00, 0x00, 0xd7, 0xa3, 0x00, 0x00,
-  0xfe, 0xa3, 0x00, 0x00, 0x24, 0xa4, 0x00, 0x00, 0x4b, 0xa4, 0x00, 0x00,
-  0x71, 0xa4, 0x00, 0x00, 0x98, 0xa4, 0x00, 0x00, 0xbe, 0xa4, 0x00, 0x00,
-  0xe5, 0xa4, 0x00, 0x00, 0x0b, 0xa5, 0x00, 0x00, 0x32, 0xa5, 0x00, 0x00,
-  0x58, 0xa5, 0x00, 0x00, 0x7e, 0xa5, 0x00, 0x00, 0xa5, 0xa5, 0x00, 0x00,
-  0xcb, 0xa5, 0x00, 0x00, 0xf1, 0xa5, 0x00, 0x00, 0x18, 0xa6, 0x00, 0x00,
-  0x3e, 0xa6, 0x00, 0x00, 0x64, 0xa6, 0x00, 0x00, 0x8a, 0xa6, 0x00, 0x00,
-  0xb0, 0xa6, 0x00, 0x00, 0xd7, 0xa6, 0x00, 0x00, 0xfd, 0xa6, 0x00, 0x00,
-  0x23, 0xa7, 0x00, 0x00, 0x49, 0xa7, 0x00, 0x00, 0x6f, 0xa7, 0x00, 0x00,
-  0x95, 0xa7, 0x00, 0x00, 0xbb, 0xa7, 0x00, 0x00, 0xe1, 0xa7, 0x00, 0x00,
-  0x07, 0xa8, 0x00, 0x00, 0x2d, 0xa8, 0x00, 0x00, 0x53, 0xa8, 0x00, 0x00,
-  0x78, 0xa8, 0x00, 0x00, 0x9e, 0xa8, 0x00, 0x00, 0xc4, 0xa8, 0x00, 0x00,
-  0xea, 0xa8, 0x00, 0x00, 0x10, 0xa9, 0x00, 0x00, 0x35, 0xa9, 0x00, 0x00,
-  0x5b, 0xa9, 0x00, 0x00, 0x81, 0xa9, 0x00, 0x00, 0xa6, 0xa9, 0x00, 0x00,
-  0xcc, 0xa9, 0x00, 0x00, 0xf2, 0xa9, 0x00, 0x00, 0x17, 0xaa, 0x00, 0x00,
-  0x3d, 0xaa, 0x00, 0x00, 0x62, 0xaa, 0x00, 0x00, 0x88, 0xaa, 0x00, 0x00,
-  0xad, 0xaa, 0x00, 0x00, 0xd3, 0xaa, 0x00, 0x00, 0xf8, 0xaa, 0x00, 0x00,
-  0x1e, 0xab, 0x00, 0x00, 0x43, 0xab, 0x00, 0x00, 0x68, 0xab, 0x00, 0x00,
-  0x8e, 0xab, 0x00, 0x00, 0xb3, 0xab, 0x00, 0x00, 0xd8, 0xab, 0x00, 0x00,
-  0xfd, 0xab, 0x00, 0x00, 0x23, 0xac, 0x00, 0x00, 0x48, 0xac, 0x00, 0x00,
-  0x6d, 0xac, 0x00, 0x00, 0x92, 0xac, 0x00, 0x00, 0xb7, 0xac, 0x00, 0x00,
-  0xdc, 0xac, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00, 0x26, 0xad, 0x00, 0x00,
-  0x4b, 0xad, 0x00, 0x00, 0x70, 0xad, 0x00, 0x00, 0x95, 0xad, 0x00, 0x00,
-  0xba, 0xad, 0x00, 0x00, 0xdf, 0xad, 0x00, 0x00, 0x04, 0xae, 0x00, 0x00,
-  0x29, 0xae, 0x00, 0x00, 0x4e, 0xae, 0x00, 0x00, 0x73, 0xae, 0x00, 0x00,
-  0x97, 0xae, 0x00, 0x00, 0xbc, 0xae, 0x00, 0x00, 0xe1, 0xae, 0x00, 0x00,
-  0x06, 0xaf, 0x00, 0x00, 0x2a, 0xaf, 0x00, 0x00, 0x4f, 0xaf, 0x00, 0x00,
-  0x73, 0xaf, 0x00, 0x00, 0x98, 0xaf, 0x00, 0x00, 0xbd, 0xaf, 0x00, 0x00,
-  0xe1, 0xaf, 0x00, 0x00, 0x06, 0xb0, 0x00, 0x00, 0x2a, 0xb0, 0x00, 0x00,
-  0x4f, 0xb0, 0x00, 0x00, 0x73, 0xb0, 0x00, 0x00, 0x97, 0xb0, 0x00, 0x00,
-  0xbc, 0xb0, 0x00, 0x00, 0xe0, 0xb0, 0x00, 0x00, 0x04, 0xb1, 0x00, 0x00,
-  0x29, 0xb1, 0x00, 0x00, 0x4d, 0xb1, 0x00, 0x00, 0x71, 0xb1, 0x00, 0x00,
-  0x96, 0xb1, 0x00, 0x00, 0xba, 0xb1, 0x00, 0x00, 0xde, 0xb1, 0x00, 0x00,
-  0x02, 0xb2, 0x00, 0x00, 0x26, 0xb2, 0x00, 0x00, 0x4a, 0xb2, 0x00, 0x00,
-  0x6e, 0xb2, 0x00, 0x00, 0x92, 0xb2, 0x00, 0x00, 0xb6, 0xb2, 0x00, 0x00,
-  0xda, 0xb2, 0x00, 0x00, 0xfe, 0xb2, 0x00, 0x00, 0x22, 0xb3, 0x00, 0x00,
-  0x46, 0xb3, 0x00, 0x00, 0x6a, 0xb3, 0x00, 0x00, 0x8e, 0xb3, 0x00, 0x00,
-  0xb2, 0xb3, 0x00, 0x00, 0xd5, 0xb3, 0x00, 0x00, 0xf9, 0xb3, 0x00, 0x00,
-  0x1d, 0xb4, 0x00, 0x00, 0x41, 0xb4, 0x00, 0x00, 0x64, 0xb4, 0x00, 0x00,
-  0x88, 0xb4, 0x00, 0x00, 0xac, 0xb4, 0x00, 0x00, 0xcf, 0xb4, 0x00, 0x00,
-  0xf3, 0xb4, 0x00, 0x00, 0x16, 0xb5, 0x00, 0x00, 0x3a, 0xb5, 0x00, 0x00,
-  0x5d, 0xb5, 0x00, 0x00, 0x81, 0xb5, 0x00, 0x00, 0xa4, 0xb5, 0x00, 0x00,
-  0xc8, 0xb5, 0x00, 0x00, 0xeb, 0xb5, 0x00, 0x00, 0x0e, 0xb6, 0x00, 0x00,
-  0x32, 0xb6, 0x00, 0x00, 0x55, 0xb6, 0x00, 0x00, 0x78, 0xb6, 0x00, 0x00,
-  0x9b, 0xb6, 0x00, 0x00, 0xbf, 0xb6, 0x00, 0x00, 0xe2, 0xb6, 0x00, 0x00,
-  0x05, 0xb7, 0x00, 0x00, 0x28, 0xb7, 0x00, 0x00, 0x4b, 0xb7, 0x00, 0x00,
-  0x6e, 0xb7, 0x00, 0x00, 0x91, 0xb7, 0x00, 0x00, 0xb4, 0xb7, 0x00, 0x00,
-  0xd7, 0xb7, 0x00, 0x00, 0xfa, 0xb7, 0x00, 0x00, 0x1d, 0xb8, 0x00, 0x00,
-  0x40, 0xb8, 0x00, 0x00, 0x63, 0xb8, 0x00, 0x00, 0x86, 0xb8, 0x00, 0x00,
-  0xa9, 0xb8, 0x00, 0x00, 0xcc, 0xb8, 0x00, 0x00, 0xee, 0xb8, 0x00, 0x00,
-  0x11, 0xb9, 0x00, 0x00, 0x34, 0xb9, 0x00, 0x00, 0x56, 0xb9, 0x00, 0x00,
-  0x79, 0xb9, 0x00, 0x00, 0x9c, 0xb9, 0x00, 0x00, 0xbe, 0xb9, 0x00, 0x00,
-  0xe1, 0xb9, 0x00, 0x00, 0x03, 0xba, 0x00, 0x00, 0x26, 0xba, 0x00, 0x00,
-  0x48, 0xba, 0x00, 0x00, 0x6b, 0xba, 0x00, 0x00, 0x8d, 0xba, 0x00, 0x00,
-  0xb0, 0xba, 0x00, 0x00, 0xd2, 0xba, 0x00, 0x00, 0xf4, 0xba, 0x00, 0x00,
-  0x17, 0xbb, 0x00, 0x00, 0x39, 0xbb, 0x00, 0x00, 0x5b, 0xbb, 0x00, 0x00,
-  0x7e, 0xbb, 0x00, 0x00, 0xa0, 0xbb, 0x00, 0x00, 0xc2, 0xbb, 0x00, 0x00,
-  0xe4, 0xbb, 0x00, 0x00, 0x06, 0xbc, 0x00, 0x00, 0x28, 0xbc, 0x00, 0x00,
-  0x4a, 0xbc, 0x00, 0x00, 0x6d, 0xbc, 0x00, 0x00, 0x8f, 0xbc, 0x00, 0x00,
-  0xb1, 0xbc, 0x00, 0x00, 0xd2, 0xbc, 0x00, 0x00, 0xf4, 0xbc, 0x00, 0x00,
-  0x16, 0xbd, 0x00, 0x00, 0x38, 0xbd, 0x00, 0x00, 0x5a, 0xbd, 0x00, 0x00,
-  0x7c, 0xbd, 0x00, 0x00, 0x9e, 0xbd, 0x00, 0x00, 0xbf, 0xbd, 0x00, 0x00,
-  0xe1, 0xbd, 0x00, 0x00, 0x03, 0xbe, 0x00, 0x00, 0x24, 0xbe, 0x00, 0x00,
-  0x46, 0xbe, 0x00, 0x00, 0x68, 0xbe, 0x00, 0x00, 0x89, 0xbe, 0x00, 0x00,
-  0xab, 0xbe, 0x00, 0x00, 0xcc, 0xbe, 0x00, 0x00, 0xee, 0xbe, 0x00, 0x00,
-  0x0f, 0xbf, 0x00, 0x00, 0x31, 0xbf, 0x00, 0x00, 0x52, 0xbf, 0x00, 0x00,
-  0x74, 0xbf, 0x00, 0x00, 0x95, 0xbf, 0x00, 0x00, 0xb6, 0xbf, 0x00, 0x00,
-  0xd8, 0xbf, 0x00, 0x00, 0xf9, 0xbf, 0x00, 0x00, 0x1a, 0xc0, 0x00, 0x00,
-  0x3b, 0xc0, 0x00, 0x00, 0x5c, 0xc0, 0x00, 0x00, 0x7e, 0xc0, 0x00, 0x00,
-  0x9f, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xe1, 0xc0, 0x00, 0x00,
-  0x02, 0xc1, 0x00, 0x00, 0x23, 0xc1, 0x00, 0x00, 0x44, 0xc1, 0x00, 0x00,
-  0x65, 0xc1, 0x00, 0x00, 0x86, 0xc1, 0x00, 0x00, 0xa7, 0xc1, 0x00, 0x00,
-  0xc8, 0xc1, 0x00, 0x00, 0xe8, 0xc1, 0x00, 0x00, 0x09, 0xc2, 0x00, 0x00,
-  0x2a, 0xc2, 0x00, 0x00, 0x4b, 0xc2, 0x00, 0x00, 0x6b, 0xc2, 0x00, 0x00,
-  0x8c, 0xc2, 0x00, 0x00, 0xad, 0xc2, 0x00, 0x00, 0xcd, 0xc2, 0x00, 0x00,
-  0xee, 0xc2, 0x00, 0x00, 0x0f, 0xc3, 0x00, 0x00, 0x2f, 0xc3, 0x00, 0x00,
-  0x50, 0xc3, 0x00, 0x00, 0x70, 0xc3, 0x00, 0x00, 0x91, 0xc3, 0x00, 0x00,
-  0xb1, 0xc3, 0x00, 0x00, 0xd1, 0xc3, 0x00, 0x00, 0xf2, 0xc3, 0x00, 0x00,
-  0x12, 0xc4, 0x00, 0x00, 0x32, 0xc4, 0x00, 0x00, 0x53, 0xc4, 0x00, 0x00,
-  0x73, 0xc4, 0x00, 0x00, 0x93, 0xc4, 0x00, 0x00, 0xb3, 0xc4, 0x00, 0x00,
-  0xd3, 0xc4, 0x00, 0x00, 0xf4, 0xc4, 0x00, 0x00, 0x14, 0xc5, 0x00, 0x00,
-  0x34, 0xc5, 0x00, 0x00, 0x54, 0xc5, 0x00, 0x00, 0x74, 0xc5, 0x00, 0x00,
-  0x94, 0xc5, 0x00, 0x00, 0xb4, 0xc5, 0x00, 0x00, 0xd4, 0xc5, 0x00, 0x00,
-  0xf3, 0xc5, 0x00, 0x00, 0x13, 0xc6, 0x00, 0x00, 0x33, 0xc6, 0x00, 0x00,
-  0x53, 0xc6, 0x00, 0x00, 0x73, 0xc6, 0x00, 0x00, 0x92, 0xc6, 0x00, 0x00,
-  0xb2, 0xc6, 0x00, 0x00, 0xd2, 0xc6, 0x00, 0x00, 0xf1, 0xc6, 0x00, 0x00,
-  0x11, 0xc7, 0x00, 0x00, 0x31, 0xc7, 0x00, 0x00, 0x50, 0xc7, 0x00, 0x00,
-  0x70, 0xc7, 0x00, 0x00, 0x8f, 0xc7, 0x00, 0x00, 0xaf, 0xc7, 0x00, 0x00,
-  0xce, 0xc7, 0x00, 0x00, 0xee, 0xc7, 0x00, 0x00, 0x0d, 0xc8, 0x00, 0x00,
-  0x2c, 0xc8, 0x00, 0x00, 0x4c, 0xc8, 0x00, 0x00, 0x6b, 0xc8, 0x00, 0x00,
-  0x8a, 0xc8, 0x00, 0x00, 0xa9, 0xc8, 0x00, 0x00, 0xc9, 0xc8, 0x00, 0x00,
-  0xe8, 0xc8, 0x00, 0x00, 0x07, 0xc9, 0x00, 0x00, 0x26, 0xc9, 0x00, 0x00,
-  0x45, 0xc9, 0x00, 0x00, 0x64, 0xc9, 0x00, 0x00, 0x83, 0xc9, 0x00, 0x00,
-  0xa2, 0xc9, 0x00, 0x00, 0xc1, 0xc9, 0x00, 0x00, 0xe0, 0xc9, 0x00, 0x00,
-  0xff, 0xc9, 0x00, 0x00, 0x1e, 0xca, 0x00, 0x00, 0x3d, 0xca, 0x00, 0x00,
-  0x5b, 0xca, 0x00, 0x00, 0x7a, 0xca, 0x00, 0x00, 0x99, 0xca, 0x00, 0x00,
-  0xb8, 0xca, 0x00, 0x00, 0xd6, 0xca, 0x00, 0x00, 0xf5, 0xca, 0x00, 0x00,
-  0x14, 0xcb, 0x00, 0x00, 0x32, 0xcb, 0x00, 0x00, 0x51, 0xcb, 0x00, 0x00,
-  0x6f, 0xcb, 0x00, 0x00, 0x8e, 0xcb, 0x00, 0x00, 0xac, 0xcb, 0x00, 0x00,
-  0xcb, 0xcb, 0x00, 0x00, 0xe9, 0xcb, 0x00, 0x00, 0x07, 0xcc, 0x00, 0x00,
-  0x26, 0xcc, 0x00, 0x00, 0x44, 0xcc, 0x00, 0x00, 0x62, 0xcc, 0x00, 0x00,
-  0x81, 0xcc, 0x00, 0x00, 0x9f, 0xcc, 0x00, 0x00, 0xbd, 0xcc, 0x00, 0x00,
-  0xdb, 0xcc, 0x00, 0x00, 0xf9, 0xcc, 0x00, 0x00, 0x17, 0xcd, 0x00, 0x00,
-  0x36, 0xcd, 0x00, 0x00, 0x54, 0xcd, 0x00, 0x00, 0x72, 0xcd, 0x00, 0x00,
-  0x90, 0xcd, 0x00, 0x00, 0xad, 0xcd, 0x00, 0x00, 0xcb, 0xcd, 0x00, 0x00,
-  0xe9, 0xcd, 0x00, 0x00, 0x07, 0xce, 0x00, 0x00, 0x25, 0xce, 0x00, 0x00,
-  0x43, 0xce, 0x00, 0x00, 0x60, 0xce, 0x00, 0x00, 0x7e, 0xce, 0x00, 0x00,
-  0x9c, 0xce, 0x00, 0x00, 0xba, 0xce, 0x00, 0x00, 0xd7, 0xce, 0x00, 0x00,
-  0xf5, 0xce, 0x00, 0x00, 0x12, 0xcf, 0x00, 0x00, 0x30, 0xcf, 0x00, 0x00,
-  0x4d, 0xcf, 0x00, 0x00, 0x6b, 0xcf, 0x00, 0x00, 0x88, 0xcf, 0x00, 0x00,
-  0xa6, 0xcf, 0x00, 0x00, 0xc3, 0xcf, 0x00, 0x00, 0xe0, 0xcf, 0x00, 0x00,
-  0xfe, 0xcf, 0x00, 0x00, 0x1b, 0xd0, 0x00, 0x00, 0x38, 0xd0, 0x00, 0x00,
-  0x56, 0xd0, 0x00, 0x00, 0x73, 0xd0, 0x00, 0x00, 0x90, 0xd0, 0x00, 0x00,
-  0xad, 0xd0, 0x00, 0x00, 0xca, 0xd0, 0x00, 0x00, 0xe7, 0xd0, 0x00, 0x00,
-  0x04, 0xd1, 0x00, 0x00, 0x21, 0xd1, 0x00, 0x00, 0x3e, 0xd1, 0x00, 0x00,
-  0x5b, 0xd1, 0x00, 0x00, 0x78, 0xd1, 0x00, 0x00, 0x95, 0xd1, 0x00, 0x00,
-  0xb2, 0xd1, 0x00, 0x00, 0xcf, 0xd1, 0x00, 0x00, 0xeb, 0xd1, 0x00, 0x00,
-  0x08, 0xd2, 0x00, 0x00, 0x25, 0xd2, 0x00, 0x00, 0x42, 0xd2, 0x00, 0x00,
-  0x5e, 0xd2, 0x00, 0x00, 0x7b, 0xd2, 0x00, 0x00, 0x97, 0xd2, 0x00, 0x00,
-  0xb4, 0xd2, 0x00, 0x00, 0xd1, 0xd2, 0x00, 0x00, 0xed, 0xd2, 0x00, 0x00,
-  0x0a, 0xd3, 0x00, 0x00, 0x26, 0xd3, 0x00, 0x00, 0x42, 0xd3, 0x00, 0x00,
-  0x5f, 0xd3, 0x00, 0x00, 0x7b, 0xd3, 0x00, 0x00, 0x97, 0xd3, 0x00, 0x00,
-  0xb4, 0xd3, 0x00, 0x00, 0xd0, 0xd3, 0x00, 0x00, 0xec, 0xd3, 0x00, 0x00,
-  0x08, 0xd4, 0x00, 0x00, 0x24, 0xd4, 0x00, 0x00, 0x41, 0xd4, 0x00, 0x00,
-  0x5d, 0xd4, 0x00, 0x00, 0x79, 0xd4, 0x00, 0x00, 0x95, 0xd4, 0x00, 0x00,
-  0xb1, 0xd4, 0x00, 0x00, 0xcd, 0xd4, 0x00, 0x00, 0xe9, 0xd4, 0x00, 0x00,
-  0x05, 0xd5, 0x00, 0x00, 0x20, 0xd5, 0x00, 0x00, 0x3c, 0xd5, 0x00, 0x00,
-  0x58, 0xd5, 0x00, 0x00, 0x74, 0xd5, 0x00, 0x00, 0x90, 0xd5, 0x00, 0x00,
-  0xab, 0xd5, 0x00, 0x00, 0xc7, 0xd5, 0x00, 0x00, 0xe3, 0xd5, 0x00, 0x00,
-  0xfe, 0xd5, 0x00, 0x00, 0x1a, 0xd6, 0x00, 0x00, 0x35, 0xd6, 0x00, 0x00,
-  0x51, 0xd6, 0x00, 0x00, 0x6c, 0xd6, 0x00, 0x00, 0x88, 0xd6, 0x00, 0x00,
-  0xa3, 0xd6, 0x00, 0x00, 0xbe, 0xd6, 0x00, 0x00, 0xda, 0xd6, 0x00, 0x00,
-  0xf5, 0xd6, 0x00, 0x00, 0x10, 0xd7, 0x00, 0x00, 0x2c, 0xd7, 0x00, 0x00,
-  0x47, 0xd7, 0x00, 0x00, 0x62, 0xd7, 0x00, 0x00, 0x7d, 0xd7, 0x00, 0x00,
-  0x98, 0xd7, 0x00, 0x00, 0xb3, 0xd7, 0x00, 0x00, 0xce, 0xd7, 0x00, 0x00,
-  0xea, 0xd7, 0x00, 0x00, 0x04, 0xd8, 0x00, 0x00, 0x1f, 0xd8, 0x00, 0x00,
-  0x3a, 0xd8, 0x00, 0x00, 0x55, 0xd8, 0x00, 0x00, 0x70, 0xd8, 0x00, 0x00,
-  0x8b, 0xd8, 0x00, 0x00, 0xa6, 0xd8, 0x00, 0x00, 0xc1, 0xd8, 0x00, 0x00,
-  0xdb, 0xd8, 0x00, 0x00, 0xf6, 0xd8, 0x00, 0x00, 0x11, 0xd9, 0x00, 0x00,
-  0x2b, 0xd9, 0x00, 0x00, 0x46, 0xd9, 0x00, 0x00, 0x60, 0xd9, 0x00, 0x00,
-  0x7b, 0xd9, 0x00, 0x00, 0x95, 0xd9, 0x00, 0x00, 0xb0, 0xd9, 0x00, 0x00,
-  0xca, 0xd9, 0x00, 0x00, 0xe5, 0xd9, 0x00, 0x00, 0xff, 0xd9, 0x00, 0x00,
-  0x19, 0xda, 0x00, 0x00, 0x34, 0xda, 0x00, 0x00, 0x4e, 0xda, 0x00, 0x00,
-  0x68, 0xda, 0x00, 0x00, 0x82, 0xda, 0x00, 0x00, 0x9d, 0xda, 0x00, 0x00,
-  0xb7, 0xda, 0x00, 0x00, 0xd1, 0xda, 0x00, 0x00, 0xeb, 0xda, 0x00, 0x00,
-  0x05, 0xdb, 0x00, 0x00, 0x1f, 0xdb, 0x00, 0x00, 0x39, 0xdb, 0x00, 0x00,
-  0x53, 0xdb, 0x00, 0x00, 0x6d, 0xdb, 0x00, 0x00, 0x87, 0xdb, 0x00, 0x00,
-  0xa1, 0xdb, 0x00, 0x00, 0xba, 0xdb, 0x00, 0x00, 0xd4, 0xdb, 0x00, 0x00,
-  0xee, 0xdb, 0x00, 0x00, 0x08, 0xdc, 0x00, 0x00, 0x21, 0xdc, 0x00, 0x00,
-  0x3b, 0xdc, 0x00, 0x00, 0x54, 0xdc, 0x00, 0x00, 0x6e, 0xdc, 0x00, 0x00,
-  0x88, 0xdc, 0x00, 0x00, 0xa1, 0xdc, 0x00, 0x00, 0xbb, 0xdc, 0x00, 0x00,
-  0xd4, 0xdc, 0x00, 0x00, 0xed, 0xdc, 0x00, 0x00, 0x07, 0xdd, 0x00, 0x00,
-  0x20, 0xdd, 0x00, 0x00, 0x39, 0xdd, 0x00, 0x00, 0x53, 0xdd, 0x00, 0x00,
-  0x6c, 0xdd, 0x00, 0x00, 0x85, 0xdd, 0x00, 0x00, 0x9e, 0xdd, 0x00, 0x00,
-  0xb8, 0xdd, 0x00, 0x00, 0xd1, 0xdd, 0x00, 0x00, 0xea, 0xdd, 0x00, 0x00,
-  0x03, 0xde, 0x00, 0x00, 0x1c, 0xde, 0x00, 0x00, 0x35, 0xde, 0x00, 0x00,
-  0x4e, 0xde, 0x00, 0x00, 0x67, 0xde, 0x00, 0x00, 0x7f, 0xde, 0x00, 0x00,
-  0x98, 0xde, 0x00, 0x00, 0xb1, 0xde, 0x00, 0x00, 0xca, 0xde, 0x00, 0x00,
-  0xe3, 0xde, 0x00, 0x00, 0xfb, 0xde, 0x00, 0x00, 0x14, 0xdf, 0x00, 0x00,
-  0x2d, 0xdf, 0x00, 0x00, 0x45, 0xdf, 0x00, 0x00, 0x5e, 0xdf, 0x00, 0x00,
-  0x76, 0xdf, 0x00, 0x00, 0x8f, 0xdf, 0x00, 0x00, 0xa7, 0xdf, 0x00, 0x00,
-  0xc0, 0xdf, 0x00, 0x00, 0xd8, 0xdf, 0x00, 0x00, 0xf1, 0xdf, 0x00, 0x00,
-  0x09, 0xe0, 0x00, 0x00, 0x21, 0xe0, 0x00, 0x00, 0x3a, 0xe0, 0x00, 0x00,
-  0x52, 0xe0, 0x00, 0x00, 0x6a, 0xe0, 0x00, 0x00, 0x82, 0xe0, 0x00, 0x00,
-  0x9a, 0xe0, 0x00, 0x00, 0xb2, 0xe0, 0x00, 0x00, 0xca, 0xe0, 0x00, 0x00,
-  0xe2, 0xe0, 0x00, 0x00, 0xfa, 0xe0, 0x00, 0x00, 0x12, 0xe1, 0x00, 0x00,
-  0x2a, 0xe1, 0x00, 0x00, 0x42, 0xe1, 0x00, 0x00, 0x5a, 0xe1, 0x00, 0x00,
-  0x72, 0xe1, 0x00, 0x00, 0x8a, 0xe1, 0x00, 0x00, 0xa2, 0xe1, 0x00, 0x00,
-  0xb9, 0xe1, 0x00, 0x00, 0xd1, 0xe1, 0x00, 0x00, 0xe9, 0xe1, 0x00, 0x00,
-  0x00, 0xe2, 0x00, 0x00, 0x18, 0xe2, 0x00, 0x00, 0x2f, 0xe2, 0x00, 0x00,
-  0x47, 0xe2, 0x00, 0x00, 0x5e, 0xe2, 0x00, 0x00, 0x76, 0xe2, 0x00, 0x00,
-  0x8d, 0xe2, 0x00, 0x00, 0xa5, 0xe2, 0x00, 0x00, 0xbc, 0xe2, 0x00, 0x00,
-  0xd3, 0xe2, 0x00, 0x00, 0xeb, 0xe2, 0x00, 0x00, 0x02, 0xe3, 0x00, 0x00,
-  0x19, 0xe3, 0x00, 0x00, 0x30, 0xe3, 0x00, 0x00, 0x47, 0xe3, 0x00, 0x00,
-  0x5f, 0xe3, 0x00, 0x00, 0x76, 0xe3, 0x00, 0x00, 0x8d, 0xe3, 0x00, 0x00,
-  0xa4, 0xe3, 0x00, 0x00, 0xbb, 0xe3, 0x00, 0x00, 0xd2, 0xe3, 0x00, 0x00,
-  0xe9, 0xe3, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x16, 0xe4, 0x00, 0x00,
-  0x2d, 0xe4, 0x00, 0x00, 0x44, 0xe4, 0x00, 0x00, 0x5b, 0xe4, 0x00, 0x00,
-  0x71, 0xe4, 0x00, 0x00, 0x88, 0xe4, 0x00, 0x00, 0x9f, 0xe4, 0x00, 0x00,
-  0xb5, 0xe4, 0x00, 0x00, 0xcc, 0xe4, 0x00, 0x00, 0xe2, 0xe4, 0x00, 0x00,
-  0xf9, 0xe4, 0x00, 0x00, 0x0f, 0xe5, 0x00, 0x00, 0x26, 0xe5, 0x00, 0x00,
-  0x3c, 0xe5, 0x00, 0x00, 0x52, 0xe5, 0x00, 0x00, 0x69, 0xe5, 0x00, 0x00,
-  0x7f, 0xe5, 0x00, 0x00, 0x95, 0xe5, 0x00, 0x00, 0xab, 0xe5, 0x00, 0x00,
-  0xc2, 0xe5, 0x00, 0x00, 0xd8, 0xe5, 0x00, 0x00, 0xee, 0xe5, 0x00, 0x00,
-  0x04, 0xe6, 0x00, 0x00, 0x1a, 0xe6, 0x00, 0x00, 0x30, 0xe6, 0x00, 0x00,
-  0x46, 0xe6, 0x00, 0x00, 0x5c, 0xe6, 0x00, 0x00, 0x72, 0xe6, 0x00, 0x00,
-  0x88, 0xe6, 0x00, 0x00, 0x9e, 0xe6, 0x00, 0x00, 0xb3, 0xe6, 0x00, 0x00,
-  0xc9, 0xe6, 0x00, 0x00, 0xdf, 0xe6, 0x00, 0x00, 0xf5, 0xe6, 0x00, 0x00,
-  0x0a, 0xe7, 0x00, 0x00, 0x20, 0xe7, 0x00, 0x00, 0x36, 0xe7, 0x00, 0x00,
-  0x4b, 0xe7, 0x00, 0x00, 0x61, 0xe7, 0x00, 0x00, 0x76, 0xe7, 0x00, 0x00,
-  0x8c, 0xe7, 0x00, 0x00, 0xa1, 0xe7, 0x00, 0x00, 0xb6, 0xe7, 0x00, 0x00,
-  0xcc, 0xe7, 0x00, 0x00, 0xe1, 0xe7, 0x00, 0x00, 0xf6, 0xe7, 0x00, 0x00,
-  0x0c, 0xe8, 0x00, 0x00, 0x21, 0xe8, 0x00, 0x00, 0x36, 0xe8, 0x00, 0x00,
-  0x4b, 0xe8, 0x00, 0x00, 0x60, 0xe8, 0x00, 0x00, 0x75, 0xe8, 0x00, 0x00,
-  0x8a, 0xe8, 0x00, 0x00, 0x9f, 0xe8, 0x00, 0x00, 0xb4, 0xe8, 0x00, 0x00,
-  0xc9, 0xe8, 0x00, 0x00, 0xde, 0xe8, 0x00, 0x00, 0xf3, 0xe8, 0x00, 0x00,
-  0x08, 0xe9, 0x00, 0x00, 0x1d, 0xe9, 0x00, 0x00, 0x31, 0xe9, 0x00, 0x00,
-  0x46, 0xe9, 0x00, 0x00, 0x5b, 0xe9, 0x00, 0x00, 0x6f, 0xe9, 0x00, 0x00,
-  0x84, 0xe9, 0x00, 0x00, 0x99, 0xe9, 0x00, 0x00, 0xad, 0xe9, 0x00, 0x00,
-  0xc2, 0xe9, 0x00, 0x00, 0xd6, 0xe9, 0x00, 0x00, 0xeb, 0xe9, 0x00, 0x00,
-  0xff, 0xe9, 0x00, 0x00, 0x13, 0xea, 0x00, 0x00, 0x28, 0xea, 0x00, 0x00,
-  0x3c, 0xea, 0x00, 0x00, 0x50, 0xea, 0x00, 0x00, 0x64, 0xea, 0x00, 0x00,
-  0x79, 0xea, 0x00, 0x00, 0x8d, 0xea, 0x00, 0x00, 0xa1, 0xea, 0x00, 0x00,
-  0xb5, 0xea, 0x00, 0x00, 0xc9, 0xea, 0x00, 0x00, 0xdd, 0xea, 0x00, 0x00,
-  0xf1, 0xea, 0x00, 0x00, 0x05, 0xeb, 0x00, 0x00, 0x19, 0xeb, 0x00, 0x00,
-  0x2d, 0xeb, 0x00, 0x00, 0x41, 0xeb, 0x00, 0x00, 0x54, 0xeb, 0x00, 0x00,
-  0x68, 0xeb, 0x00, 0x00, 0x7c, 0xeb, 0x00, 0x00, 0x90, 0xeb, 0x00, 0x00,
-  0xa3, 0xeb, 0x00, 0x00, 0xb7, 0xeb, 0x00, 0x00, 0xcb, 0xeb, 0x00, 0x00,
-  0xde, 0xeb, 0x00, 0x00, 0xf2, 0xeb, 0x00, 0x00, 0x05, 0xec, 0x00, 0x00,
-  0x19, 0xec, 0x00, 0x00, 0x2c, 0xec, 0x00, 0x00, 0x3f, 0xec, 0x00, 0x00,
-  0x53, 0xec, 0x00, 0x00, 0x66, 0xec, 0x00, 0x00, 0x79, 0xec, 0x00, 0x00,
-  0x8c, 0xec, 0x00, 0x00, 0xa0, 0xec, 0x00, 0x00, 0xb3, 0xec, 0x00, 0x00,
-  0xc6, 0xec, 0x00, 0x00, 0xd9, 0xec, 0x00, 0x00, 0xec, 0xec, 0x00, 0x00,
-  0xff, 0xec, 0x00, 0x00, 0x12, 0xed, 0x00, 0x00, 0x25, 0xed, 0x00, 0x00,
-  0x38, 0xed, 0x00, 0x00, 0x4b, 0xed, 0x00, 0x00, 0x5e, 0xed, 0x00, 0x00,
-  0x71, 0xed, 0x00, 0x00, 0x83, 0xed, 0x00, 0x00, 0x96, 0xed, 0x00, 0x00,
-  0xa9, 0xed, 0x00, 0x00, 0xbb, 0xed, 0x00, 0x00, 0xce, 0xed, 0x00, 0x00,
-  0xe1, 0xed, 0x00, 0x00, 0xf3, 0xed, 0x00, 0x00, 0x06, 0xee, 0x00, 0x00,
-  0x18, 0xee, 0x00, 0x00, 0x2b, 0xee, 0x00, 0x00, 0x3d, 0xee, 0x00, 0x00,
-  0x4f, 0xee, 0x00, 0x00, 0x62, 0xee, 0x00, 0x00, 0x74, 0xee, 0x00, 0x00,
-  0x86, 0xee, 0x00, 0x00, 0x99, 0xee, 0x00, 0x00, 0xab, 0xee, 0x00, 0x00,
-  0xbd, 0xee, 0x00, 0x00, 0xcf, 0xee, 0x00, 0x00, 0xe1, 0xee, 0x00, 0x00,
-  0xf3, 0xee, 0x00, 0x00, 0x05, 0xef, 0x00, 0x00, 0x17, 0xef, 0x00, 0x00,
-  0x29, 0xef, 0x00, 0x00, 0x3b, 0xef, 0x00, 0x00, 0x4d, 0xef, 0x00, 0x00,
-  0x5f, 0xef, 0x00, 0x00, 0x71, 0xef, 0x00, 0x00, 0x82, 0xef, 0x00, 0x00,
-  0x94, 0xef, 0x00, 0x00, 0xa6, 0xef, 0x00, 0x00, 0xb7, 0xef, 0x00, 0x00,
-  0xc9, 0xef, 0x00, 0x00, 0xdb, 0xef, 0x00, 0x00, 0xec, 0xef, 0x00, 0x00,
-  0xfe, 0xef, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x21, 0xf0, 0x00, 0x00,
-  0x32, 0xf0, 0x00, 0x00, 0x43, 0xf0, 0x00, 0x00, 0x55, 0xf0, 0x00, 0x00,
-  0x66, 0xf0, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x00, 0x89, 0xf0, 0x00, 0x00,
-  0x9a, 0xf0, 0x00, 0x00, 0xab, 0xf0, 0x00, 0x00, 0xbc, 0xf0, 0x00, 0x00,
-  0xcd, 0xf0, 0x00, 0x00, 0xde, 0xf0, 0x00, 0x00, 0xef, 0xf0, 0x00, 0x00,
-  0x00, 0xf1, 0x00, 0x00, 0x11, 0xf1, 0x00, 0x00, 0x22, 0xf1, 0x00, 0x00,
-  0x33, 0xf1, 0x00, 0x00, 0x44, 0xf1, 0x00, 0x00, 0x54, 0xf1, 0x00, 0x00,
-  0x65, 0xf1, 0x00, 0x00, 0x76, 0xf1, 0x00, 0x00, 0x87, 0xf1, 0x00, 0x00,
-  0x97, 0xf1, 0x00, 0x00, 0xa8, 0xf1, 0x00, 0x00, 0xb8, 0xf1, 0x00, 0x00,
-  0xc9, 0xf1, 0x00, 0x00, 0xd9, 0xf1, 0x00, 0x00, 0xea, 0xf1, 0x00, 0x00,
-  0xfa, 0xf1, 0x00, 0x00, 0x0b, 0xf2, 0x00, 0x00, 0x1b, 0xf2, 0x00, 0x00,
-  0x2b, 0xf2, 0x00, 0x00, 0x3c, 0xf2, 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00,
-  0x5c, 0xf2, 0x00, 0x00, 0x6c, 0xf2, 0x00, 0x00, 0x7c, 0xf2, 0x00, 0x00,
-  0x8c, 0xf2, 0x00, 0x00, 0x9c, 0xf2, 0x00, 0x00, 0xad, 0xf2, 0x00, 0x00,
-  0xbd, 0xf2, 0x00, 0x00, 0xcc, 0xf2, 0x00, 0x00, 0xdc, 0xf2, 0x00, 0x00,
-  0xec, 0xf2, 0x00, 0x00, 0xfc, 0xf2, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00,
-  0x1c, 0xf3, 0x00, 0x00, 0x2b, 0xf3, 0x00, 0x00, 0x3b, 0xf3, 0x00, 0x00,
-  0x4b, 0xf3, 0x00, 0x00, 0x5a, 0xf3, 0x00, 0x00, 0x6a, 0xf3, 0x00, 0x00,
-  0x79, 0xf3, 0x00, 0x00, 0x89, 0xf3, 0x00, 0x00, 0x98, 0xf3, 0x00, 0x00,
-  0xa8, 0xf3, 0x00, 0x00, 0xb7, 0xf3, 0x00, 0x00, 0xc7, 0xf3, 0x00, 0x00,
-  0xd6, 0xf3, 0x00, 0x00, 0xe5, 0xf3, 0x00, 0x00, 0xf5, 0xf3, 0x00, 0x00,
-  0x04, 0xf4, 0x00, 0x00, 0x13, 0xf4, 0x00, 0x00, 0x22, 0xf4, 0x00, 0x00,
-  0x31, 0xf4, 0x00, 0x00, 0x40, 0xf4, 0x00, 0x00, 0x4f, 0xf4, 0x00, 0x00,
-  0x5e, 0xf4, 0x00, 0x00, 0x6d, 0xf4, 0x00, 0x00, 0x7c, 0xf4, 0x00, 0x00,
-  0x8b, 0xf4, 0x00, 0x00, 0x9a, 0xf4, 0x00, 0x00, 0xa9, 0xf4, 0x00, 0x00,
-  0xb8, 0xf4, 0x00, 0x00, 0xc6, 0xf4, 0x00, 0x00, 0xd5, 0xf4, 0x00, 0x00,
-  0xe4, 0xf4, 0x00, 0x00, 0xf2, 0xf4, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00,
-  0x0f, 0xf5, 0x00, 0x00, 0x1e, 0xf5, 0x00, 0x00, 0x2c, 0xf5, 0x00, 0x00,
-  0x3b, 0xf5, 0x00, 0x00, 0x49, 0xf5, 0x00, 0x00, 0x58, 0xf5, 0x00, 0x00,
-  0x66, 0xf5, 0x00, 0x00, 0x74, 0xf5, 0x00, 0x00, 0x82, 0xf5, 0x00, 0x00,
-  0x91, 0xf5, 0x00, 0x00, 0x9f, 0xf5, 0x00, 0x00, 0xad, 0xf5, 0x00, 0x00,
-  0xbb, 0xf5, 0x00, 0x00, 0xc9, 0xf5, 0x00, 0x00, 0xd7, 0xf5, 0x00, 0x00,
-  0xe5, 0xf5, 0x00, 0x00, 0xf3, 0xf5, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00,
-  0x0f, 0xf6, 0x00, 0x00, 0x1d, 0xf6, 0x00, 0x00, 0x2b, 0xf6, 0x00, 0x00,
-  0x38, 0xf6, 0x00, 0x00, 0x46, 0xf6, 0x00, 0x00, 0x54, 0xf6, 0x00, 0x00,
-  0x62, 0xf6, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x00, 0x7d, 0xf6, 0x00, 0x00,
-  0x8a, 0xf6, 0x00, 0x00, 0x98, 0xf6, 0x00, 0x00, 0xa5, 0xf6, 0x00, 0x00,
-  0xb3, 0xf6, 0x00, 0x00, 0xc0, 0xf6, 0x00, 0x00, 0xce, 0xf6, 0x00, 0x00,
-  0xdb, 0xf6, 0x00, 0x00, 0xe8, 0xf6, 0x00, 0x00, 0xf5, 0xf6, 0x00, 0x00,
-  0x03, 0xf7, 0x00, 0x00, 0x10, 0xf7, 0x00, 0x00, 0x1d, 0xf7, 0x00, 0x00,
-  0x2a, 0xf7, 0x00, 0x00, 0x37, 0xf7, 0x00, 0x00, 0x44, 0xf7, 0x00, 0x00,
-  0x51, 0xf7, 0x00, 0x00, 0x5e, 0xf7, 0x00, 0x00, 0x6b, 0xf7, 0x00, 0x00,
-  0x78, 0xf7, 0x00, 0x00, 0x85, 0xf7, 0x00, 0x00, 0x92, 0xf7, 0x00, 0x00,
-  0x9e, 0xf7, 0x00, 0x00, 0xab, 0xf7, 0x00, 0x00, 0xb8, 0xf7, 0x00, 0x00,
-  0xc5, 0xf7, 0x00, 0x00, 0xd1, 0xf7, 0x00, 0x00, 0xde, 0xf7, 0x00, 0x00,
-  0xea, 0xf7, 0x00, 0x00, 0xf7, 0xf7, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00,
-  0x10, 0xf8, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x28, 0xf8, 0x00, 0x00,
-  0x35, 0xf8, 0x00, 0x00, 0x41, 0xf8, 0x00, 0x00, 0x4d, 0xf8, 0x00, 0x00,
-  0x5a, 0xf8, 0x00, 0x00, 0x66, 0xf8, 0x00, 0x00, 0x72, 0xf8, 0x00, 0x00,
-  0x7e, 0xf8, 0x00, 0x00, 0x8a, 0xf8, 0x00, 0x00, 0x96, 0xf8, 0x00, 0x00,
-  0xa2, 0xf8, 0x00, 0x00, 0xae, 0xf8, 0x00, 0x00, 0xba, 0xf8, 0x00, 0x00,
-  0xc6, 0xf8, 0x00, 0x00, 0xd2, 0xf8, 0x00, 0x00, 0xdd, 0xf8, 0x00, 0x00,
-  0xe9, 0xf8, 0x00, 0x00, 0xf5, 0xf8, 0x00, 0x00, 0x01, 0xf9, 0x00, 0x00,
-  0x0c, 0xf9, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x00, 0x23, 0xf9, 0x00, 0x00,
-  0x2f, 0xf9, 0x00, 0x00, 0x3b, 0xf9, 0x00, 0x00, 0x46, 0xf9, 0x00, 0x00,
-  0x51, 0xf9, 0x00, 0x00, 0x5d, 0xf9, 0x00, 0x00, 0x68, 0xf9, 0x00, 0x00,
-  0x73, 0xf9, 0x00, 0x00, 0x7f, 0xf9, 0x00, 0x00, 0x8a, 0xf9, 0x00, 0x00,
-  0x95, 0xf9, 0x00, 0x00, 0xa0, 0xf9, 0x00, 0x00, 0xab, 0xf9, 0x00, 0x00,
-  0xb7, 0xf9, 0x00, 0x00, 0xc2, 0xf9, 0x00, 0x00, 0xcd, 0xf9, 0x00, 0x00,
-  0xd8, 0xf9, 0x00, 0x00, 0xe3, 0xf9, 0x00, 0x00, 0xed, 0xf9, 0x00, 0x00,
-  0xf8, 0xf9, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x0e, 0xfa, 0x00, 0x00,
-  0x19, 0xfa, 0x00, 0x00, 0x23, 0xfa, 0x00, 0x00, 0x2e, 0xfa, 0x00, 0x00,
-  0x39, 0xfa, 0x00, 0x00, 0x43, 0xfa, 0x00, 0x00, 0x4e, 0xfa, 0x00, 0x00,
-  0x58, 0xfa, 0x00, 0x00, 0x63, 0xfa, 0x00, 0x00, 0x6d, 0xfa, 0x00, 0x00,
-  0x78, 0xfa, 0x00, 0x00, 0x82, 0xfa, 0x00, 0x00, 0x8c, 0xfa, 0x00, 0x00,
-  0x97, 0xfa, 0x00, 0x00, 0xa1, 0xfa, 0x00, 0x00, 0xab, 0xfa, 0x00, 0x00,
-  0xb5, 0xfa, 0x00, 0x00, 0xc0, 0xfa, 0x00, 0x00, 0xca, 0xfa, 0x00, 0x00,
-  0xd4, 0xfa, 0x00, 0x00, 0xde, 0xfa, 0x00, 0x00, 0xe8, 0xfa, 0x00, 0x00,
-  0xf2, 0xfa, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00,
-  0x0f, 0xfb, 0x00, 0x00, 0x19, 0xfb, 0x00, 0x00, 0x23, 0xfb, 0x00, 0x00,
-  0x2d, 0xfb, 0x00, 0x00, 0x36, 0xfb, 0x00, 0x00, 0x40, 0xfb, 0x00, 0x00,
-  0x4a, 0xfb, 0x00, 0x00, 0x53, 0xfb, 0x00, 0x00, 0x5d, 0xfb, 0x00, 0x00,
-  0x66, 0xfb, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x00, 0x79, 0xfb, 0x00, 0x00,
-  0x83, 0xfb, 0x00, 0x00, 0x8c, 0xfb, 0x00, 0x00, 0x95, 0xfb, 0x00, 0x00,
-  0x9e, 0xfb, 0x00, 0x00, 0xa8, 0xfb, 0x00, 0x00, 0xb1, 0xfb, 0x00, 0x00,
-  0xba, 0xfb, 0x00, 0x00, 0xc3, 0xfb, 0x00, 0x00, 0xcc, 0xfb, 0x00, 0x00,
-  0xd5, 0xfb, 0x00, 0x00, 0xde, 0xfb, 0x00, 0x00, 0xe7, 0xfb, 0x00, 0x00,
-  0xf0, 0xfb, 0x00, 0x00, 0xf9, 0xfb, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00,
-  0x0b, 0xfc, 0x00, 0x00, 0x14, 0xfc, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00,
-  0x25, 0xfc, 0x00, 0x00, 0x2e, 0xfc, 0x00, 0x00, 0x36, 0xfc, 0x00, 0x00,
-  0x3f, 0xfc, 0x00, 0x00, 0x48, 0xfc, 0x00, 0x00, 0x50, 0xfc, 0x00, 0x00,
-  0x59, 0xfc, 0x00, 0x00, 0x61, 0xfc, 0x00, 0x00, 0x69, 0xfc, 0x00, 0x00,
-  0x72, 0xfc, 0x00, 0x00, 0x7a, 0xfc, 0x00, 0x00, 0x82, 0xfc, 0x00, 0x00,
-  0x8b, 0xfc, 0x00, 0x00, 0x93, 0xfc, 0x00, 0x00, 0x9b, 0xfc, 0x00, 0x00,
-  0xa3, 0xfc, 0x00, 0x00, 0xab, 0xfc, 0x00, 0x00, 0xb3, 0xfc, 0x00, 0x00,
-  0xbb, 0xfc, 0x00, 0x00, 0xc3, 0xfc, 0x00, 0x00, 0xcb, 0xfc, 0x00, 0x00,
-  0xd3, 0xfc, 0x00, 0x00, 0xdb, 0xfc, 0x00, 0x00, 0xe3, 0xfc, 0x00, 0x00,
-  0xeb, 0xfc, 0x00, 0x00, 0xf2, 0xfc, 0x00, 0x00, 0xfa, 0xfc, 0x00, 0x00,
-  0x02, 0xfd, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x00, 0x11, 0xfd, 0x00, 0x00,
-  0x19, 0xfd, 0x00, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x28, 0xfd, 0x00, 0x00,
-  0x2f, 0xfd, 0x00, 0x00, 0x36, 0xfd, 0x00, 0x00, 0x3e, 0xfd, 0x00, 0x00,
-  0x45, 0xfd, 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00, 0x54, 0xfd, 0x00, 0x00,
-  0x5b, 0xfd, 0x00, 0x00, 0x62, 0xfd, 0x00, 0x00, 0x69, 0xfd, 0x00, 0x00,
-  0x70, 0xfd, 0x00, 0x00, 0x77, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0x00, 0x00,
-  0x86, 0xfd, 0x00, 0x00, 0x8c, 0xfd, 0x00, 0x00, 0x93, 0xfd, 0x00, 0x00,
-  0x9a, 0xfd, 0x00, 0x00, 0xa1, 0xfd, 0x00, 0x00, 0xa8, 0xfd, 0x00, 0x00,
-  0xaf, 0xfd, 0x00, 0x00, 0xb5, 0xfd, 0x00, 0x00, 0xbc, 0xfd, 0x00, 0x00,
-  0xc3, 0xfd, 0x00, 0x00, 0xc9, 0xfd, 0x00, 0x00, 0xd0, 0xfd, 0x00, 0x00,
-  0xd6, 0xfd, 0x00, 0x00, 0xdd, 0xfd, 0x00, 0x00, 0xe3, 0xfd, 0x00, 0x00,
-  0xea, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf7, 0xfd, 0x00, 0x00,
-  0xfd, 0xfd, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x09, 0xfe, 0x00, 0x00,
-  0x10, 0xfe, 0x00, 0x00, 0x16, 0xfe, 0x00, 0x00, 0x1c, 0xfe, 0x00, 0x00,
-  0x22, 0xfe, 0x00, 0x00, 0x28, 0xfe, 0x00, 0x00, 0x2e, 0xfe, 0x00, 0x00,
-  0x34, 0xfe, 0x00, 0x00, 0x3a, 0xfe, 0x00, 0x00, 0x40, 0xfe, 0x00, 0x00,
-  0x46, 0xfe, 0x00, 0x00, 0x4b, 0xfe, 0x00, 0x00, 0x51, 0xfe, 0x00, 0x00,
-  0x57, 0xfe, 0x00, 0x00, 0x5d, 0xfe, 0x00, 0x00, 0x62, 0xfe, 0x00, 0x00,
-  0x68, 0xfe, 0x00, 0x00, 0x6d, 0xfe, 0x00, 0x00, 0x73, 0xfe, 0x00, 0x00,
-  0x78, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x00, 0x83, 0xfe, 0x00, 0x00,
-  0x89, 0xfe, 0x00, 0x00, 0x8e, 0xfe, 0x00, 0x00, 0x93, 0xfe, 0x00, 0x00,
-  0x99, 0xfe, 0x00, 0x00, 0x9e, 0xfe, 0x00, 0x00, 0xa3, 0xfe, 0x00, 0x00,
-  0xa8, 0xfe, 0x00, 0x00, 0xad, 0xfe, 0x00, 0x00, 0xb2, 0xfe, 0x00, 0x00,
-  0xb7, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0xc1, 0xfe, 0x00, 0x00,
-  0xc6, 0xfe, 0x00, 0x00, 0xcb, 0xfe, 0x00, 0x00, 0xd0, 0xfe, 0x00, 0x00,
-  0xd5, 0xfe, 0x00, 0x00, 0xda, 0xfe, 0x00, 0x00, 0xde, 0xfe, 0x00, 0x00,
-  0xe3, 0xfe, 0x00, 0x00, 0xe8, 0xfe, 0x00, 0x00, 0xec, 0xfe, 0x00, 0x00,
-  0xf1, 0xfe, 0x00, 0x00, 0xf6, 0xfe, 0x00, 0x00, 0xfa, 0xfe, 0x00, 0x00,
-  0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00,
-  0x0c, 0xff, 0x00, 0x00, 0x10, 0xff, 0x00, 0x00, 0x14, 0xff, 0x00, 0x00,
-  0x19, 0xff, 0x00, 0x00, 0x1d, 0xff, 0x00, 0x00, 0x21, 0xff, 0x00, 0x00,
-  0x25, 0xff, 0x00, 0x00, 0x29, 0xff, 0x00, 0x00, 0x2d, 0xff, 0x00, 0x00,
-  0x31, 0xff, 0x00, 0x00, 0x35, 0xff, 0x00, 0x00, 0x39, 0xff, 0x00, 0x00,
-  0x3d, 0xff, 0x00, 0x00, 0x41, 0xff, 0x00, 0x00, 0x45, 0xff, 0x00, 0x00,
-  0x48, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x50, 0xff, 0x00, 0x00,
-  0x53, 0xff, 0x00, 0x00, 0x57, 0xff, 0x00, 0x00, 0x5b, 0xff, 0x00, 0x00,
-  0x5e, 0xff, 0x00, 0x00, 0x62, 0xff, 0x00, 0x00, 0x65, 0xff, 0x00, 0x00,
-  0x69, 0xff, 0x00, 0x00, 0x6c, 0xff, 0x00, 0x00, 0x6f, 0xff, 0x00, 0x00,
-  0x73, 0xff, 0x00, 0x00, 0x76, 0xff, 0x00, 0x00, 0x79, 0xff, 0x00, 0x00,
-  0x7c, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x83, 0xff, 0x00, 0x00,
-  0x86, 0xff, 0x00, 0x00, 0x89, 0xff, 0x00, 0x00, 0x8c, 0xff, 0x00, 0x00,
-  0x8f, 0xff, 0x00, 0x00, 0x92, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00,
-  0x97, 0xff, 0x00, 0x00, 0x9a, 0xff, 0x00, 0x00, 0x9d, 0xff, 0x00, 0x00,
-  0xa0, 0xff, 0x00, 0x00, 0xa2, 0xff, 0x00, 0x00, 0xa5, 0xff, 0x00, 0x00,
-  0xa8, 0xff, 0x00, 0x00, 0xaa, 0xff, 0x00, 0x00, 0xad, 0xff, 0x00, 0x00,
-  0xaf, 0xff, 0x00, 0x00, 0xb2, 0xff, 0x00, 0x00, 0xb4, 0xff, 0x00, 0x00,
-  0xb7, 0xff, 0x00, 0x00, 0xb9, 0xff, 0x00, 0x00, 0xbb, 0xff, 0x00, 0x00,
-  0xbe, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x00, 0x00,
-  0xc4, 0xff, 0x00, 0x00, 0xc6, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00,
-  0xca, 0xff, 0x00, 0x00, 0xcc, 0xff, 0x00, 0x00, 0xce, 0xff, 0x00, 0x00,
-  0xd0, 0xff, 0x00, 0x00, 0xd2, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00,
-  0xd6, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00,
-  0xdb, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00,
-  0xe0, 0xff, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00,
-  0xe4, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00,
-  0xe9, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00,
-  0xec, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00,
-  0xf0, 0xff, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xf2, 0xff, 0x00, 0x00,
-  0xf3, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00,
-  0xf6, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00,
-  0xf8, 0xff, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00,
-  0xfa, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00,
-  0xfc, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00,
-  0xfd, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00,
-  0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00,
-  0xfd, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00,
-  0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00,
-  0xfa, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00,
-  0xf8, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00,
-  0xf6, 0xff, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00,
-  0xf3, 0xff, 0x00, 0x00, 0xf2, 0xff, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00,
-  0xf0, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00,
-  0xec, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00,
-  0xe9, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00,
-  0xe4, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00,
-  0xe0, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00,
-  0xdb, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00,
-  0xd6, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd2, 0xff, 0x00, 0x00,
-  0xd0, 0xff, 0x00, 0x00, 0xce, 0xff, 0x00, 0x00, 0xcc, 0xff, 0x00, 0x00,
-  0xca, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc6, 0xff, 0x00, 0x00,
-  0xc4, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00,
-  0xbe, 0xff, 0x00, 0x00, 0xbb, 0xff, 0x00, 0x00, 0xb9, 0xff, 0x00, 0x00,
-  0xb7, 0xff, 0x00, 0x00, 0xb4, 0xff, 0x00, 0x00, 0xb2, 0xff, 0x00, 0x00,
-  0xaf, 0xff, 0x00, 0x00, 0xad, 0xff, 0x00, 0x00, 0xaa, 0xff, 0x00, 0x00,
-  0xa8, 0xff, 0x00, 0x00, 0xa5, 0xff, 0x00, 0x00, 0xa2, 0xff, 0x00, 0x00,
-  0xa0, 0xff, 0x00, 0x00, 0x9d, 0xff, 0x00, 0x00, 0x9a, 0xff, 0x00, 0x00,
-  0x97, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0x92, 0xff, 0x00, 0x00,
-  0x8f, 0xff, 0x00, 0x00, 0x8c, 0xff, 0x00, 0x00, 0x89, 0xff, 0x00, 0x00,
-  0x86, 0xff, 0x00, 0x00, 0x83, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00,
-  0x7c, 0xff, 0x00, 0x00, 0x79, 0xff, 0x00, 0x00, 0x76, 0xff, 0x00, 0x00,
-  0x73, 0xff, 0x00, 0x00, 0x6f, 0xff, 0x00, 0x00, 0x6c, 0xff, 0x00, 0x00,
-  0x69, 0xff, 0x00, 0x00, 0x65, 0xff, 0x00, 0x00, 0x62, 0xff, 0x00, 0x00,
-  0x5e, 0xff, 0x00, 0x00, 0x5b, 0xff, 0x00, 0x00, 0x57, 0xff, 0x00, 0x00,
-  0x53, 0xff, 0x00, 0x00, 0x50, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00,
-  0x48, 0xff, 0x00, 0x00, 0x45, 0xff, 0x00, 0x00, 0x41, 0xff, 0x00, 0x00,
-  0x3d, 0xff, 0x00, 0x00, 0x39, 0xff, 0x00, 0x00, 0x35, 0xff, 0x00, 0x00,
-  0x31, 0xff, 0x00, 0x00, 0x2d, 0xff, 0x00, 0x00, 0x29, 0xff, 0x00, 0x00,
-  0x25, 0xff, 0x00, 0x00, 0x21, 0xff, 0x00, 0x00, 0x1d, 0xff, 0x00, 0x00,
-  0x19, 0xff, 0x00, 0x00, 0x14, 0xff, 0x00, 0x00, 0x10, 0xff, 0x00, 0x00,
-  0x0c, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00,
-  0xff, 0xfe, 0x00, 0x00, 0xfa, 0xfe, 0x00, 0x00, 0xf6, 0xfe, 0x00, 0x00,
-  0xf1, 0xfe, 0x00, 0x00, 0xec, 0xfe, 0x00, 0x00, 0xe8, 0xfe, 0x00, 0x00,
-  0xe3, 0xfe, 0x00, 0x00, 0xde, 0xfe, 0x00, 0x00, 0xda, 0xfe, 0x00, 0x00,
-  0xd5, 0xfe, 0x00, 0x00, 0xd0, 0xfe, 0x00, 0x00, 0xcb, 0xfe, 0x00, 0x00,
-  0xc6, 0xfe, 0x00, 0x00, 0xc1, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00,
-  0xb7, 0xfe, 0x00, 0x00, 0xb2, 0xfe, 0x00, 0x00, 0xad, 0xfe, 0x00, 0x00,
-  0xa8, 0xfe, 0x00, 0x00, 0xa3, 0xfe, 0x00, 0x00, 0x9e, 0xfe, 0x00, 0x00,
-  0x99, 0xfe, 0x00, 0x00, 0x93, 0xfe, 0x00, 0x00, 0x8e, 0xfe, 0x00, 0x00,
-  0x89, 0xfe, 0x00, 0x00, 0x83, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x00,
-  0x78, 0xfe, 0x00, 0x00, 0x73, 0xfe, 0x00, 0x00, 0x6d, 0xfe, 0x00, 0x00,
-  0x68, 0xfe, 0x00, 0x00, 0x62, 0xfe, 0x00, 0x00, 0x5d, 0xfe, 0x00, 0x00,
-  0x57, 0xfe, 0x00, 0x00, 0x51, 0xfe, 0x00, 0x00, 0x4b, 0xfe, 0x00, 0x00,
-  0x46, 0xfe, 0x00, 0x00, 0x40, 0xfe, 0x00, 0x00, 0x3a, 0xfe, 0x00, 0x00,
-  0x34, 0xfe, 0x00, 0x00, 0x2e, 0xfe, 0x00, 0x00, 0x28, 0xfe, 0x00, 0x00,
-  0x22, 0xfe, 0x00, 0x00, 0x1c, 0xfe, 0x00, 0x00, 0x16, 0xfe, 0x00, 0x00,
-  0x10, 0xfe, 0x00, 0x00, 0x09, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00,
-  0xfd, 0xfd, 0x00, 0x00, 0xf7, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00,
-  0xea, 0xfd, 0x00, 0x00, 0xe3, 0xfd, 0x00, 0x00, 0xdd, 0xfd, 0x00, 0x00,
-  0xd6, 0xfd, 0x00, 0x00, 0xd0, 0xfd, 0x00, 0x00, 0xc9, 0xfd, 0x00, 0x00,
-  0xc3, 0xfd, 0x00, 0x00, 0xbc, 0xfd, 0x00, 0x00, 0xb5, 0xfd, 0x00, 0x00,
-  0xaf, 0xfd, 0x00, 0x00, 0xa8, 0xfd, 0x00, 0x00, 0xa1, 0xfd, 0x00, 0x00,
-  0x9a, 0xfd, 0x00, 0x00, 0x93, 0xfd, 0x00, 0x00, 0x8c, 0xfd, 0x00, 0x00,
-  0x86, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0x00, 0x00, 0x77, 0xfd, 0x00, 0x00,
-  0x70, 0xfd, 0x00, 0x00, 0x69, 0xfd, 0x00, 0x00, 0x62, 0xfd, 0x00, 0x00,
-  0x5b, 0xfd, 0x00, 0x00, 0x54, 0xfd, 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00,
-  0x45, 0xfd, 0x00, 0x00, 0x3e, 0xfd, 0x00, 0x00, 0x36, 0xfd, 0x00, 0x00,
-  0x2f, 0xfd, 0x00, 0x00, 0x28, 0xfd, 0x00, 0x00, 0x20, 0xfd, 0x00, 0x00,
-  0x19, 0xfd, 0x00, 0x00, 0x11, 0xfd, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x00,
-  0x02, 0xfd, 0x00, 0x00, 0xfa, 0xfc, 0x00, 0x00, 0xf2, 0xfc, 0x00, 0x00,
-  0xeb, 0xfc, 0x00, 0x00, 0xe3, 0xfc, 0x00, 0x00, 0xdb, 0xfc, 0x00, 0x00,
-  0xd3, 0xfc, 0x00, 0x00, 0xcb, 0xfc, 0x00, 0x00, 0xc3, 0xfc, 0x00, 0x00,
-  0xbb, 0xfc, 0x00, 0x00, 0xb3, 0xfc, 0x00, 0x00, 0xab, 0xfc, 0x00, 0x00,
-  0xa3, 0xfc, 0x00, 0x00, 0x9b, 0xfc, 0x00, 0x00, 0x93, 0xfc, 0x00, 0x00,
-  0x8b, 0xfc, 0x00, 0x00, 0x82, 0xfc, 0x00, 0x00, 0x7a, 0xfc, 0x00, 0x00,
-  0x72, 0xfc, 0x00, 0x00, 0x69, 0xfc, 0x00, 0x00, 0x61, 0xfc, 0x00, 0x00,
-  0x58, 0xfc, 0x00, 0x00, 0x50, 0xfc, 0x00, 0x00, 0x48, 0xfc, 0x00, 0x00,
-  0x3f, 0xfc, 0x00, 0x00, 0x36, 0xfc, 0x00, 0x00, 0x2e, 0xfc, 0x00, 0x00,
-  0x25, 0xfc, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x14, 0xfc, 0x00, 0x00,
-  0x0b, 0xfc, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0xf9, 0xfb, 0x00, 0x00,
-  0xf0, 0xfb, 0x00, 0x00, 0xe7, 0xfb, 0x00, 0x00, 0xde, 0xfb, 0x00, 0x00,
-  0xd5, 0xfb, 0x00, 0x00, 0xcc, 0xfb, 0x00, 0x00, 0xc3, 0xfb, 0x00, 0x00,
-  0xba, 0xfb, 0x00, 0x00, 0xb1, 0xfb, 0x00, 0x00, 0xa8, 0xfb, 0x00, 0x00,
-  0x9e, 0xfb, 0x00, 0x00, 0x95, 0xfb, 0x00, 0x00, 0x8c, 0xfb, 0x00, 0x00,
-  0x83, 0xfb, 0x00, 0x00, 0x79, 0xfb, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x00,
-  0x66, 0xfb, 0x00, 0x00, 0x5d, 0xfb, 0x00, 0x00, 0x53, 0xfb, 0x00, 0x00,
-  0x4a, 0xfb, 0x00, 0x00, 0x40, 0xfb, 0x00, 0x00, 0x36, 0xfb, 0x00, 0x00,
-  0x2d, 0xfb, 0x00, 0x00, 0x23, 0xfb, 0x00, 0x00, 0x19, 0xfb, 0x00, 0x00,
-  0x0f, 0xfb, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x00,
-  0xf2, 0xfa, 0x00, 0x00, 0xe8, 0xfa, 0x00, 0x00, 0xde, 0xfa, 0x00, 0x00,
-  0xd4, 0xfa, 0x00, 0x00, 0xca, 0xfa, 0x00, 0x00, 0xc0, 0xfa, 0x00, 0x00,
-  0xb5, 0xfa, 0x00, 0x00, 0xab, 0xfa, 0x00, 0x00, 0xa1, 0xfa, 0x00, 0x00,
-  0x97, 0xfa, 0x00, 0x00, 0x8c, 0xfa, 0x00, 0x00, 0x82, 0xfa, 0x00, 0x00,
-  0x78, 0xfa, 0x00, 0x00, 0x6d, 0xfa, 0x00, 0x00, 0x63, 0xfa, 0x00, 0x00,
-  0x58, 0xfa, 0x00, 0x00, 0x4e, 0xfa, 0x00, 0x00, 0x43, 0xfa, 0x00, 0x00,
-  0x39, 0xfa, 0x00, 0x00, 0x2e, 0xfa, 0x00, 0x00, 0x23, 0xfa, 0x00, 0x00,
-  0x19, 0xfa, 0x00, 0x00, 0x0e, 0xfa, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00,
-  0xf8, 0xf9, 0x00, 0x00, 0xed, 0xf9, 0x00, 0x00, 0xe3, 0xf9, 0x00, 0x00,
-  0xd8, 0xf9, 0x00, 0x00, 0xcd, 0xf9, 0x00, 0x00, 0xc2, 0xf9, 0x00, 0x00,
-  0xb7, 0xf9, 0x00, 0x00, 0xab, 0xf9, 0x00, 0x00, 0xa0, 0xf9, 0x00, 0x00,
-  0x95, 0xf9, 0x00, 0x00, 0x8a, 0xf9, 0x00, 0x00, 0x7f, 0xf9, 0x00, 0x00,
-  0x73, 0xf9, 0x00, 0x00, 0x68, 0xf9, 0x00, 0x00, 0x5d, 0xf9, 0x00, 0x00,
-  0x51, 0xf9, 0x00, 0x00, 0x46, 0xf9, 0x00, 0x00, 0x3b, 0xf9, 0x00, 0x00,
-  0x2f, 0xf9, 0x00, 0x00, 0x23, 0xf9, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x00,
-  0x0c, 0xf9, 0x00, 0x00, 0x01, 0xf9, 0x00, 0x00, 0xf5, 0xf8, 0x00, 0x00,
-  0xe9, 0xf8, 0x00, 0x00, 0xdd, 0xf8, 0x00, 0x00, 0xd2, 0xf8, 0x00, 0x00,
-  0xc6, 0xf8, 0x00, 0x00, 0xba, 0xf8, 0x00, 0x00, 0xae, 0xf8, 0x00, 0x00,
-  0xa2, 0xf8, 0x00, 0x00, 0x96, 0xf8, 0x00, 0x00, 0x8a, 0xf8, 0x00, 0x00,
-  0x7e, 0xf8, 0x00, 0x00, 0x72, 0xf8, 0x00, 0x00, 0x66, 0xf8, 0x00, 0x00,
-  0x5a, 0xf8, 0x00, 0x00, 0x4d, 0xf8, 0x00, 0x00, 0x41, 0xf8, 0x00, 0x00,
-  0x35, 0xf8, 0x00, 0x00, 0x28, 0xf8, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x00,
-  0x10, 0xf8, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0xf7, 0xf7, 0x00, 0x00,
-  0xea, 0xf7, 0x00, 0x00, 0xde, 0xf7, 0x00, 0x00, 0xd1, 0xf7, 0x00, 0x00,
-  0xc5, 0xf7, 0x00, 0x00, 0xb8, 0xf7, 0x00, 0x00, 0xab, 0xf7, 0x00, 0x00,
-  0x9e, 0xf7, 0x00, 0x00, 0x92, 0xf7, 0x00, 0x00, 0x85, 0xf7, 0x00, 0x00,
-  0x78, 0xf7, 0x00, 0x00, 0x6b, 0xf7, 0x00, 0x00, 0x5e, 0xf7, 0x00, 0x00,
-  0x51, 0xf7, 0x00, 0x00, 0x44, 0xf7, 0x00, 0x00, 0x37, 0xf7, 0x00, 0x00,
-  0x2a, 0xf7, 0x00, 0x00, 0x1d, 0xf7, 0x00, 0x00, 0x10, 0xf7, 0x00, 0x00,
-  0x03, 0xf7, 0x00, 0x00, 0xf5, 0xf6, 0x00, 0x00, 0xe8, 0xf6, 0x00, 0x00,
-  0xdb, 0xf6, 0x00, 0x00, 0xce, 0xf6, 0x00, 0x00, 0xc0, 0xf6, 0x00, 0x00,
-  0xb3, 0xf6, 0x00, 0x00, 0xa5, 0xf6, 0x00, 0x00, 0x98, 0xf6, 0x00, 0x00,
-  0x8a, 0xf6, 0x00, 0x00, 0x7d, 0xf6, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x00,
-  0x62, 0xf6, 0x00, 0x00, 0x54, 0xf6, 0x00, 0x00, 0x46, 0xf6, 0x00, 0x00,
-  0x38, 0xf6, 0x00, 0x00, 0x2b, 0xf6, 0x00, 0x00, 0x1d, 0xf6, 0x00, 0x00,
-  0x0f, 0xf6, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0xf3, 0xf5, 0x00, 0x00,
-  0xe5, 0xf5, 0x00, 0x00, 0xd7, 0xf5, 0x00, 0x00, 0xc9, 0xf5, 0x00, 0x00,
-  0xbb, 0xf5, 0x00, 0x00, 0xad, 0xf5, 0x00, 0x00, 0x9f, 0xf5, 0x00, 0x00,
-  0x91, 0xf5, 0x00, 0x00, 0x82, 0xf5, 0x00, 0x00, 0x74, 0xf5, 0x00, 0x00,
-  0x66, 0xf5, 0x00, 0x00, 0x58, 0xf5, 0x00, 0x00, 0x49, 0xf5, 0x00, 0x00,
-  0x3b, 0xf5, 0x00, 0x00, 0x2c, 0xf5, 0x00, 0x00, 0x1e, 0xf5, 0x00, 0x00,
-  0x0f, 0xf5, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0xf2, 0xf4, 0x00, 0x00,
-  0xe4, 0xf4, 0x00, 0x00, 0xd5, 0xf4, 0x00, 0x00, 0xc6, 0xf4, 0x00, 0x00,
-  0xb8, 0xf4, 0x00, 0x00, 0xa9, 0xf4, 0x00, 0x00, 0x9a, 0xf4, 0x00, 0x00,
-  0x8b, 0xf4, 0x00, 0x00, 0x7c, 0xf4, 0x00, 0x00, 0x6d, 0xf4, 0x00, 0x00,
-  0x5e, 0xf4, 0x00, 0x00, 0x4f, 0xf4, 0x00, 0x00, 0x40, 0xf4, 0x00, 0x00,
-  0x31, 0xf4, 0x00, 0x00, 0x22, 0xf4, 0x00, 0x00, 0x13, 0xf4, 0x00, 0x00,
-  0x04, 0xf4, 0x00, 0x00, 0xf5, 0xf3, 0x00, 0x00, 0xe5, 0xf3, 0x00, 0x00,
-  0xd6, 0xf3, 0x00, 0x00, 0xc7, 0xf3, 0x00, 0x00, 0xb7, 0xf3, 0x00, 0x00,
-  0xa8, 0xf3, 0x00, 0x00, 0x98, 0xf3, 0x00, 0x00, 0x89, 0xf3, 0x00, 0x00,
-  0x79, 0xf3, 0x00, 0x00, 0x6a, 0xf3, 0x00, 0x00, 0x5a, 0xf3, 0x00, 0x00,
-  0x4b, 0xf3, 0x00, 0x00, 0x3b, 0xf3, 0x00, 0x00, 0x2b, 0xf3, 0x00, 0x00,
-  0x1c, 0xf3, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0xfc, 0xf2, 0x00, 0x00,
-  0xec, 0xf2, 0x00, 0x00, 0xdc, 0xf2, 0x00, 0x00, 0xcc, 0xf2, 0x00, 0x00,
-  0xbd, 0xf2, 0x00, 0x00, 0xad, 0xf2, 0x00, 0x00, 0x9c, 0xf2, 0x00, 0x00,
-  0x8c, 0xf2, 0x00, 0x00, 0x7c, 0xf2, 0x00, 0x00, 0x6c, 0xf2, 0x00, 0x00,
-  0x5c, 0xf2, 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00, 0x3c, 0xf2, 0x00, 0x00,
-  0x2b, 0xf2, 0x00, 0x00, 0x1b, 0xf2, 0x00, 0x00, 0x0b, 0xf2, 0x00, 0x00,
-  0xfa, 0xf1, 0x00, 0x00, 0xea, 0xf1, 0x00, 0x00, 0xd9, 0xf1, 0x00, 0x00,
-  0xc9, 0xf1, 0x00, 0x00, 0xb8, 0xf1, 0x00, 0x00, 0xa8, 0xf1, 0x00, 0x00,
-  0x97, 0xf1, 0x00, 0x00, 0x87, 0xf1, 0x00, 0x00, 0x76, 0xf1, 0x00, 0x00,
-  0x65, 0xf1, 0x00, 0x00, 0x54, 0xf1, 0x00, 0x00, 0x44, 0xf1, 0x00, 0x00,
-  0x33, 0xf1, 0x00, 0x00, 0x22, 0xf1, 0x00, 0x00, 0x11, 0xf1, 0x00, 0x00,
-  0x00, 0xf1, 0x00, 0x00, 0xef, 0xf0, 0x00, 0x00, 0xde, 0xf0, 0x00, 0x00,
-  0xcd, 0xf0, 0x00, 0x00, 0xbc, 0xf0, 0x00, 0x00, 0xab, 0xf0, 0x00, 0x00,
-  0x9a, 0xf0, 0x00, 0x00, 0x89, 0xf0, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x00,
-  0x66, 0xf0, 0x00, 0x00, 0x55, 0xf0, 0x00, 0x00, 0x43, 0xf0, 0x00, 0x00,
-  0x32, 0xf0, 0x00, 0x00, 0x21, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
-  0xfe, 0xef, 0x00, 0x00, 0xec, 0xef, 0x00, 0x00, 0xdb, 0xef, 0x00, 0x00,
-  0xc9, 0xef, 0x00, 0x00, 0xb7, 0xef, 0x00, 0x00, 0xa6, 0xef, 0x00, 0x00,
-  0x94, 0xef, 0x00, 0x00, 0x82, 0xef, 0x00, 0x00, 0x71, 0xef, 0x00, 0x00,
-  0x5f, 0xef, 0x00, 0x00, 0x4d, 0xef, 0x00, 0x00, 0x3b, 0xef, 0x00, 0x00,
-  0x29, 0xef, 0x00, 0x00, 0x17, 0xef, 0x00, 0x00, 0x05, 0xef, 0x00, 0x00,
-  0xf3, 0xee, 0x00, 0x00, 0xe1, 0xee, 0x00, 0x00, 0xcf, 0xee, 0x00, 0x00,
-  0xbd, 0xee, 0x00, 0x00, 0xab, 0xee, 0x00, 0x00, 0x99, 0xee, 0x00, 0x00,
-  0x86, 0xee, 0x00, 0x00, 0x74, 0xee, 0x00, 0x00, 0x62, 0xee, 0x00, 0x00,
-  0x4f, 0xee, 0x00, 0x00, 0x3d, 0xee, 0x00, 0x00, 0x2b, 0xee, 0x00, 0x00,
-  0x18, 0xee, 0x00, 0x00, 0x06, 0xee, 0x00, 0x00, 0xf3, 0xed, 0x00, 0x00,
-  0xe1, 0xed, 0x00, 0x00, 0xce, 0xed, 0x00, 0x00, 0xbb, 0xed, 0x00, 0x00,
-  0xa9, 0xed, 0x00, 0x00, 0x96, 0xed, 0x00, 0x00, 0x83, 0xed, 0x00, 0x00,
-  0x71, 0xed, 0x00, 0x00, 0x5e, 0xed, 0x00, 0x00, 0x4b, 0xed, 0x00, 0x00,
-  0x38, 0xed, 0x00, 0x00, 0x25, 0xed, 0x00, 0x00, 0x12, 0xed, 0x00, 0x00,
-  0xff, 0xec, 0x00, 0x00, 0xec, 0xec, 0x00, 0x00, 0xd9, 0xec, 0x00, 0x00,
-  0xc6, 0xec, 0x00, 0x00, 0xb3, 0xec, 0x00, 0x00, 0xa0, 0xec, 0x00, 0x00,
-  0x8c, 0xec, 0x00, 0x00, 0x79, 0xec, 0x00, 0x00, 0x66, 0xec, 0x00, 0x00,
-  0x53, 0xec, 0x00, 0x00, 0x3f, 0xec, 0x00, 0x00, 0x2c, 0xec, 0x00, 0x00,
-  0x19, 0xec, 0x00, 0x00, 0x05, 0xec, 0x00, 0x00, 0xf2, 0xeb, 0x00, 0x00,
-  0xde, 0xeb, 0x00, 0x00, 0xcb, 0xeb, 0x00, 0x00, 0xb7, 0xeb, 0x00, 0x00,
-  0xa3, 0xeb, 0x00, 0x00, 0x90, 0xeb, 0x00, 0x00, 0x7c, 0xeb, 0x00, 0x00,
-  0x68, 0xeb, 0x00, 0x00, 0x54, 0xeb, 0x00, 0x00, 0x41, 0xeb, 0x00, 0x00,
-  0x2d, 0xeb, 0x00, 0x00, 0x19, 0xeb, 0x00, 0x00, 0x05, 0xeb, 0x00, 0x00,
-  0xf1, 0xea, 0x00, 0x00, 0xdd, 0xea, 0x00, 0x00, 0xc9, 0xea, 0x00, 0x00,
-  0xb5, 0xea, 0x00, 0x00, 0xa1, 0xea, 0x00, 0x00, 0x8d, 0xea, 0x00, 0x00,
-  0x79, 0xea, 0x00, 0x00, 0x64, 0xea, 0x00, 0x00, 0x50, 0xea, 0x00, 0x00,
-  0x3c, 0xea, 0x00, 0x00, 0x28, 0xea, 0x00, 0x00, 0x13, 0xea, 0x00, 0x00,
-  0xff, 0xe9, 0x00, 0x00, 0xeb, 0xe9, 0x00, 0x00, 0xd6, 0xe9, 0x00, 0x00,
-  0xc2, 0xe9, 0x00, 0x00, 0xad, 0xe9, 0x00, 0x00, 0x99, 0xe9, 0x00, 0x00,
-  0x84, 0xe9, 0x00, 0x00, 0x6f, 0xe9, 0x00, 0x00, 0x5b, 0xe9, 0x00, 0x00,
-  0x46, 0xe9, 0x00, 0x00, 0x31, 0xe9, 0x00, 0x00, 0x1d, 0xe9, 0x00, 0x00,
-  0x08, 0xe9, 0x00, 0x00, 0xf3, 0xe8, 0x00, 0x00, 0xde, 0xe8, 0x00, 0x00,
-  0xc9, 0xe8, 0x00, 0x00, 0xb4, 0xe8, 0x00, 0x00, 0x9f, 0xe8, 0x00, 0x00,
-  0x8a, 0xe8, 0x00, 0x00, 0x75, 0xe8, 0x00, 0x00, 0x60, 0xe8, 0x00, 0x00,
-  0x4b, 0xe8, 0x00, 0x00, 0x36, 0xe8, 0x00, 0x00, 0x21, 0xe8, 0x00, 0x00,
-  0x0c, 0xe8, 0x00, 0x00, 0xf6, 0xe7, 0x00, 0x00, 0xe1, 0xe7, 0x00, 0x00,
-  0xcc, 0xe7, 0x00, 0x00, 0xb6, 0xe7, 0x00, 0x00, 0xa1, 0xe7, 0x00, 0x00,
-  0x8c, 0xe7, 0x00, 0x00, 0x76, 0xe7, 0x00, 0x00, 0x61, 0xe7, 0x00, 0x00,
-  0x4b, 0xe7, 0x00, 0x00, 0x36, 0xe7, 0x00, 0x00, 0x20, 0xe7, 0x00, 0x00,
-  0x0a, 0xe7, 0x00, 0x00, 0xf5, 0xe6, 0x00, 0x00, 0xdf, 0xe6, 0x00, 0x00,
-  0xc9, 0xe6, 0x00, 0x00, 0xb3, 0xe6, 0x00, 0x00, 0x9e, 0xe6, 0x00, 0x00,
-  0x88, 0xe6, 0x00, 0x00, 0x72, 0xe6, 0x00, 0x00, 0x5c, 0xe6, 0x00, 0x00,
-  0x46, 0xe6, 0x00, 0x00, 0x30, 0xe6, 0x00, 0x00, 0x1a, 0xe6, 0x00, 0x00,
-  0x04, 0xe6, 0x00, 0x00, 0xee, 0xe5, 0x00, 0x00, 0xd8, 0xe5, 0x00, 0x00,
-  0xc2, 0xe5, 0x00, 0x00, 0xab, 0xe5, 0x00, 0x00, 0x95, 0xe5, 0x00, 0x00,
-  0x7f, 0xe5, 0x00, 0x00, 0x69, 0xe5, 0x00, 0x00, 0x52, 0xe5, 0x00, 0x00,
-  0x3c, 0xe5, 0x00, 0x00, 0x26, 0xe5, 0x00, 0x00, 0x0f, 0xe5, 0x00, 0x00,
-  0xf9, 0xe4, 0x00, 0x00, 0xe2, 0xe4, 0x00, 0x00, 0xcc, 0xe4, 0x00, 0x00,
-  0xb5, 0xe4, 0x00, 0x00, 0x9f, 0xe4, 0x00, 0x00, 0x88, 0xe4, 0x00, 0x00,
-  0x71, 0xe4, 0x00, 0x00, 0x5b, 0xe4, 0x00, 0x00, 0x44, 0xe4, 0x00, 0x00,
-  0x2d, 0xe4, 0x00, 0x00, 0x16, 0xe4, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00,
-  0xe9, 0xe3, 0x00, 0x00, 0xd2, 0xe3, 0x00, 0x00, 0xbb, 0xe3, 0x00, 0x00,
-  0xa4, 0xe3, 0x00, 0x00, 0x8d, 0xe3, 0x00, 0x00, 0x76, 0xe3, 0x00, 0x00,
-  0x5f, 0xe3, 0x00, 0x00, 0x47, 0xe3, 0x00, 0x00, 0x30, 0xe3, 0x00, 0x00,
-  0x19, 0xe3, 0x00, 0x00, 0x02, 0xe3, 0x00, 0x00, 0xeb, 0xe2, 0x00, 0x00,
-  0xd3, 0xe2, 0x00, 0x00, 0xbc, 0xe2, 0x00, 0x00, 0xa5, 0xe2, 0x00, 0x00,
-  0x8d, 0xe2, 0x00, 0x00, 0x76, 0xe2, 0x00, 0x00, 0x5e, 0xe2, 0x00, 0x00,
-  0x47, 0xe2, 0x00, 0x00, 0x2f, 0xe2, 0x00, 0x00, 0x18, 0xe2, 0x00, 0x00,
-  0x00, 0xe2, 0x00, 0x00, 0xe9, 0xe1, 0x00, 0x00, 0xd1, 0xe1, 0x00, 0x00,
-  0xb9, 0xe1, 0x00, 0x00, 0xa2, 0xe1, 0x00, 0x00, 0x8a, 0xe1, 0x00, 0x00,
-  0x72, 0xe1, 0x00, 0x00, 0x5a, 0xe1, 0x00, 0x00, 0x42, 0xe1, 0x00, 0x00,
-  0x2a, 0xe1, 0x00, 0x00, 0x12, 0xe1, 0x00, 0x00, 0xfa, 0xe0, 0x00, 0x00,
-  0xe2, 0xe0, 0x00, 0x00, 0xca, 0xe0, 0x00, 0x00, 0xb2, 0xe0, 0x00, 0x00,
-  0x9a, 0xe0, 0x00, 0x00, 0x82, 0xe0, 0x00, 0x00, 0x6a, 0xe0, 0x00, 0x00,
-  0x52, 0xe0, 0x00, 0x00, 0x3a, 0xe0, 0x00, 0x00, 0x21, 0xe0, 0x00, 0x00,
-  0x09, 0xe0, 0x00, 0x00, 0xf1, 0xdf, 0x00, 0x00, 0xd8, 0xdf, 0x00, 0x00,
-  0xc0, 0xdf, 0x00, 0x00, 0xa7, 0xdf, 0x00, 0x00, 0x8f, 0xdf, 0x00, 0x00,
-  0x76, 0xdf, 0x00, 0x00, 0x5e, 0xdf, 0x00, 0x00, 0x45, 0xdf, 0x00, 0x00,
-  0x2d, 0xdf, 0x00, 0x00, 0x14, 0xdf, 0x00, 0x00, 0xfb, 0xde, 0x00, 0x00,
-  0xe3, 0xde, 0x00, 0x00, 0xca, 0xde, 0x00, 0x00, 0xb1, 0xde, 0x00, 0x00,
-  0x98, 0xde, 0x00, 0x00, 0x7f, 0xde, 0x00, 0x00, 0x67, 0xde, 0x00, 0x00,
-  0x4e, 0xde, 0x00, 0x00, 0x35, 0xde, 0x00, 0x00, 0x1c, 0xde, 0x00, 0x00,
-  0x03, 0xde, 0x00, 0x00, 0xea, 0xdd, 0x00, 0x00, 0xd1, 0xdd, 0x00, 0x00,
-  0xb8, 0xdd, 0x00, 0x00, 0x9e, 0xdd, 0x00, 0x00, 0x85, 0xdd, 0x00, 0x00,
-  0x6c, 0xdd, 0x00, 0x00, 0x53, 0xdd, 0x00, 0x00, 0x39, 0xdd, 0x00, 0x00,
-  0x20, 0xdd, 0x00, 0x00, 0x07, 0xdd, 0x00, 0x00, 0xed, 0xdc, 0x00, 0x00,
-  0xd4, 0xdc, 0x00, 0x00, 0xbb, 0xdc, 0x00, 0x00, 0xa1, 0xdc, 0x00, 0x00,
-  0x88, 0xdc, 0x00, 0x00, 0x6e, 0xdc, 0x00, 0x00, 0x54, 0xdc, 0x00, 0x00,
-  0x3b, 0xdc, 0x00, 0x00, 0x21, 0xdc, 0x00, 0x00, 0x08, 0xdc, 0x00, 0x00,
-  0xee, 0xdb, 0x00, 0x00, 0xd4, 0xdb, 0x00, 0x00, 0xba, 0xdb, 0x00, 0x00,
-  0xa1, 0xdb, 0x00, 0x00, 0x87, 0xdb, 0x00, 0x00, 0x6d, 0xdb, 0x00, 0x00,
-  0x53, 0xdb, 0x00, 0x00, 0x39, 0xdb, 0x00, 0x00, 0x1f, 0xdb, 0x00, 0x00,
-  0x05, 0xdb, 0x00, 0x00, 0xeb, 0xda, 0x00, 0x00, 0xd1, 0xda, 0x00, 0x00,
-  0xb7, 0xda, 0x00, 0x00, 0x9d, 0xda, 0x00, 0x00, 0x82, 0xda, 0x00, 0x00,
-  0x68, 0xda, 0x00, 0x00, 0x4e, 0xda, 0x00, 0x00, 0x34, 0xda, 0x00, 0x00,
-  0x19, 0xda, 0x00, 0x00, 0xff, 0xd9, 0x00, 0x00, 0xe5, 0xd9, 0x00, 0x00,
-  0xca, 0xd9, 0x00, 0x00, 0xb0, 0xd9, 0x00, 0x00, 0x95, 0xd9, 0x00, 0x00,
-  0x7b, 0xd9, 0x00, 0x00, 0x60, 0xd9, 0x00, 0x00, 0x46, 0xd9, 0x00, 0x00,
-  0x2b, 0xd9, 0x00, 0x00, 0x11, 0xd9, 0x00, 0x00, 0xf6, 0xd8, 0x00, 0x00,
-  0xdb, 0xd8, 0x00, 0x00, 0xc1, 0xd8, 0x00, 0x00, 0xa6, 0xd8, 0x00, 0x00,
-  0x8b, 0xd8, 0x00, 0x00, 0x70, 0xd8, 0x00, 0x00, 0x55, 0xd8, 0x00, 0x00,
-  0x3a, 0xd8, 0x00, 0x00, 0x1f, 0xd8, 0x00, 0x00, 0x04, 0xd8, 0x00, 0x00,
-  0xea, 0xd7, 0x00, 0x00, 0xce, 0xd7, 0x00, 0x00, 0xb3, 0xd7, 0x00, 0x00,
-  0x98, 0xd7, 0x00, 0x00, 0x7d, 0xd7, 0x00, 0x00, 0x62, 0xd7, 0x00, 0x00,
-  0x47, 0xd7, 0x00, 0x00, 0x2c, 0xd7, 0x00, 0x00, 0x10, 0xd7, 0x00, 0x00,
-  0xf5, 0xd6, 0x00, 0x00, 0xda, 0xd6, 0x00, 0x00, 0xbe, 0xd6, 0x00, 0x00,
-  0xa3, 0xd6, 0x00, 0x00, 0x88, 0xd6, 0x00, 0x00, 0x6c, 0xd6, 0x00, 0x00,
-  0x51, 0xd6, 0x00, 0x00, 0x35, 0xd6, 0x00, 0x00, 0x1a, 0xd6, 0x00, 0x00,
-  0xfe, 0xd5, 0x00, 0x00, 0xe3, 0xd5, 0x00, 0x00, 0xc7, 0xd5, 0x00, 0x00,
-  0xab, 0xd5, 0x00, 0x00, 0x90, 0xd5, 0x00, 0x00, 0x74, 0xd5, 0x00, 0x00,
-  0x58, 0xd5, 0x00, 0x00, 0x3c, 0xd5, 0x00, 0x00, 0x20, 0xd5, 0x00, 0x00,
-  0x05, 0xd5, 0x00, 0x00, 0xe9, 0xd4, 0x00, 0x00, 0xcd, 0xd4, 0x00, 0x00,
-  0xb1, 0xd4, 0x00, 0x00, 0x95, 0xd4, 0x00, 0x00, 0x79, 0xd4, 0x00, 0x00,
-  0x5d, 0xd4, 0x00, 0x00, 0x41, 0xd4, 0x00, 0x00, 0x24, 0xd4, 0x00, 0x00,
-  0x08, 0xd4, 0x00, 0x00, 0xec, 0xd3, 0x00, 0x00, 0xd0, 0xd3, 0x00, 0x00,
-  0xb4, 0xd3, 0x00, 0x00, 0x97, 0xd3, 0x00, 0x00, 0x7b, 0xd3, 0x00, 0x00,
-  0x5f, 0xd3, 0x00, 0x00, 0x42, 0xd3, 0x00, 0x00, 0x26, 0xd3, 0x00, 0x00,
-  0x0a, 0xd3, 0x00, 0x00, 0xed, 0xd2, 0x00, 0x00, 0xd1, 0xd2, 0x00, 0x00,
-  0xb4, 0xd2, 0x00, 0x00, 0x97, 0xd2, 0x00, 0x00, 0x7b, 0xd2, 0x00, 0x00,
-  0x5e, 0xd2, 0x00, 0x00, 0x42, 0xd2, 0x00, 0x00, 0x25, 0xd2, 0x00, 0x00,
-  0x08, 0xd2, 0x00, 0x00, 0xeb, 0xd1, 0x00, 0x00, 0xcf, 0xd1, 0x00, 0x00,
-  0xb2, 0xd1, 0x00, 0x00, 0x95, 0xd1, 0x00, 0x00, 0x78, 0xd1, 0x00, 0x00,
-  0x5b, 0xd1, 0x00, 0x00, 0x3e, 0xd1, 0x00, 0x00, 0x21, 0xd1, 0x00, 0x00,
-  0x04, 0xd1, 0x00, 0x00, 0xe7, 0xd0, 0x00, 0x00, 0xca, 0xd0, 0x00, 0x00,
-  0xad, 0xd0, 0x00, 0x00, 0x90, 0xd0, 0x00, 0x00, 0x73, 0xd0, 0x00, 0x00,
-  0x56, 0xd0, 0x00, 0x00, 0x38, 0xd0, 0x00, 0x00, 0x1b, 0xd0, 0x00, 0x00,
-  0xfe, 0xcf, 0x00, 0x00, 0xe0, 0xcf, 0x00, 0x00, 0xc3, 0xcf, 0x00, 0x00,
-  0xa6, 0xcf, 0x00, 0x00, 0x88, 0xcf, 0x00, 0x00, 0x6b, 0xcf, 0x00, 0x00,
-  0x4d, 0xcf, 0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x12, 0xcf, 0x00, 0x00,
-  0xf5, 0xce, 0x00, 0x00, 0xd7, 0xce, 0x00, 0x00, 0xba, 0xce, 0x00, 0x00,
-  0x9c, 0xce, 0x00, 0x00, 0x7e, 0xce, 0x00, 0x00, 0x60, 0xce, 0x00, 0x00,
-  0x43, 0xce, 0x00, 0x00, 0x25, 0xce, 0x00, 0x00, 0x07, 0xce, 0x00, 0x00,
-  0xe9, 0xcd, 0x00, 0x00, 0xcb, 0xcd, 0x00, 0x00, 0xad, 0xcd, 0x00, 0x00,
-  0x90, 0xcd, 0x00, 0x00, 0x72, 0xcd, 0x00, 0x00, 0x54, 0xcd, 0x00, 0x00,
-  0x36, 0xcd, 0x00, 0x00, 0x17, 0xcd, 0x00, 0x00, 0xf9, 0xcc, 0x00, 0x00,
-  0xdb, 0xcc, 0x00, 0x00, 0xbd, 0xcc, 0x00, 0x00, 0x9f, 0xcc, 0x00, 0x00,
-  0x81, 0xcc, 0x00, 0x00, 0x62, 0xcc, 0x00, 0x00, 0x44, 0xcc, 0x00, 0x00,
-  0x26, 0xcc, 0x00, 0x00, 0x07, 0xcc, 0x00, 0x00, 0xe9, 0xcb, 0x00, 0x00,
-  0xcb, 0xcb, 0x00, 0x00, 0xac, 0xcb, 0x00, 0x00, 0x8e, 0xcb, 0x00, 0x00,
-  0x6f, 0xcb, 0x00, 0x00, 0x51, 0xcb, 0x00, 0x00, 0x32, 0xcb, 0x00, 0x00,
-  0x14, 0xcb, 0x00, 0x00, 0xf5, 0xca, 0x00, 0x00, 0xd6, 0xca, 0x00, 0x00,
-  0xb8, 0xca, 0x00, 0x00, 0x99, 0xca, 0x00, 0x00, 0x7a, 0xca, 0x00, 0x00,
-  0x5b, 0xca, 0x00, 0x00, 0x3d, 0xca, 0x00, 0x00, 0x1e, 0xca, 0x00, 0x00,
-  0xff, 0xc9, 0x00, 0x00, 0xe0, 0xc9, 0x00, 0x00, 0xc1, 0xc9, 0x00, 0x00,
-  0xa2, 0xc9, 0x00, 0x00, 0x83, 0xc9, 0x00, 0x00, 0x64, 0xc9, 0x00, 0x00,
-  0x45, 0xc9, 0x00, 0x00, 0x26, 0xc9, 0x00, 0x00, 0x07, 0xc9, 0x00, 0x00,
-  0xe8, 0xc8, 0x00, 0x00, 0xc9, 0xc8, 0x00, 0x00, 0xa9, 0xc8, 0x00, 0x00,
-  0x8a, 0xc8, 0x00, 0x00, 0x6b, 0xc8, 0x00, 0x00, 0x4c, 0xc8, 0x00, 0x00,
-  0x2c, 0xc8, 0x00, 0x00, 0x0d, 0xc8, 0x00, 0x00, 0xee, 0xc7, 0x00, 0x00,
-  0xce, 0xc7, 0x00, 0x00, 0xaf, 0xc7, 0x00, 0x00, 0x8f, 0xc7, 0x00, 0x00,
-  0x70, 0xc7, 0x00, 0x00, 0x50, 0xc7, 0x00, 0x00, 0x31, 0xc7, 0x00, 0x00,
-  0x11, 0xc7, 0x00, 0x00, 0xf1, 0xc6, 0x00, 0x00, 0xd2, 0xc6, 0x00, 0x00,
-  0xb2, 0xc6, 0x00, 0x00, 0x92, 0xc6, 0x00, 0x00, 0x73, 0xc6, 0x00, 0x00,
-  0x53, 0xc6, 0x00, 0x00, 0x33, 0xc6, 0x00, 0x00, 0x13, 0xc6, 0x00, 0x00,
-  0xf3, 0xc5, 0x00, 0x00, 0xd4, 0xc5, 0x00, 0x00, 0xb4, 0xc5, 0x00, 0x00,
-  0x94, 0xc5, 0x00, 0x00, 0x74, 0xc5, 0x00, 0x00, 0x54, 0xc5, 0x00, 0x00,
-  0x34, 0xc5, 0x00, 0x00, 0x14, 0xc5, 0x00, 0x00, 0xf4, 0xc4, 0x00, 0x00,
-  0xd3, 0xc4, 0x00, 0x00, 0xb3, 0xc4, 0x00, 0x00, 0x93, 0xc4, 0x00, 0x00,
-  0x73, 0xc4, 0x00, 0x00, 0x53, 0xc4, 0x00, 0x00, 0x32, 0xc4, 0x00, 0x00,
-  0x12, 0xc4, 0x00, 0x00, 0xf2, 0xc3, 0x00, 0x00, 0xd1, 0xc3, 0x00, 0x00,
-  0xb1, 0xc3, 0x00, 0x00, 0x91, 0xc3, 0x00, 0x00, 0x70, 0xc3, 0x00, 0x00,
-  0x50, 0xc3, 0x00, 0x00, 0x2f, 0xc3, 0x00, 0x00, 0x0f, 0xc3, 0x00, 0x00,
-  0xee, 0xc2, 0x00, 0x00, 0xcd, 0xc2, 0x00, 0x00, 0xad, 0xc2, 0x00, 0x00,
-  0x8c, 0xc2, 0x00, 0x00, 0x6b, 0xc2, 0x00, 0x00, 0x4b, 0xc2, 0x00, 0x00,
-  0x2a, 0xc2, 0x00, 0x00, 0x09, 0xc2, 0x00, 0x00, 0xe8, 0xc1, 0x00, 0x00,
-  0xc8, 0xc1, 0x00, 0x00, 0xa7, 0xc1, 0x00, 0x00, 0x86, 0xc1, 0x00, 0x00,
-  0x65, 0xc1, 0x00, 0x00, 0x44, 0xc1, 0x00, 0x00, 0x23, 0xc1, 0x00, 0x00,
-  0x02, 0xc1, 0x00, 0x00, 0xe1, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-  0x9f, 0xc0, 0x00, 0x00, 0x7e, 0xc0, 0x00, 0x00, 0x5c, 0xc0, 0x00, 0x00,
-  0x3b, 0xc0, 0x00, 0x00, 0x1a, 0xc0, 0x00, 0x00, 0xf9, 0xbf, 0x00, 0x00,
-  0xd8, 0xbf, 0x00, 0x00, 0xb6, 0xbf, 0x00, 0x00, 0x95, 0xbf, 0x00, 0x00,
-  0x74, 0xbf, 0x00, 0x00, 0x52, 0xbf, 0x00, 0x00, 0x31, 0xbf, 0x00, 0x00,
-  0x0f, 0xbf, 0x00, 0x00, 0xee, 0xbe, 0x00, 0x00, 0xcc, 0xbe, 0x00, 0x00,
-  0xab, 0xbe, 0x00, 0x00, 0x89, 0xbe, 0x00, 0x00, 0x68, 0xbe, 0x00, 0x00,
-  0x46, 0xbe, 0x00, 0x00, 0x24, 0xbe, 0x00, 0x00, 0x03, 0xbe, 0x00, 0x00,
-  0xe1, 0xbd, 0x00, 0x00, 0xbf, 0xbd, 0x00, 0x00, 0x9e, 0xbd, 0x00, 0x00,
-  0x7c, 0xbd, 0x00, 0x00, 0x5a, 0xbd, 0x00, 0x00, 0x38, 0xbd, 0x00, 0x00,
-  0x16, 0xbd, 0x00, 0x00, 0xf4, 0xbc, 0x00, 0x00, 0xd2, 0xbc, 0x00, 0x00,
-  0xb0, 0xbc, 0x00, 0x00, 0x8f, 0xbc, 0x00, 0x00, 0x6d, 0xbc, 0x00, 0x00,
-  0x4a, 0xbc, 0x00, 0x00, 0x28, 0xbc, 0x00, 0x00, 0x06, 0xbc, 0x00, 0x00,
-  0xe4, 0xbb, 0x00, 0x00, 0xc2, 0xbb, 0x00, 0x00, 0xa0, 0xbb, 0x00, 0x00,
-  0x7e, 0xbb, 0x00, 0x00, 0x5b, 0xbb, 0x00, 0x00, 0x39, 0xbb, 0x00, 0x00,
-  0x17, 0xbb, 0x00, 0x00, 0xf4, 0xba, 0x00, 0x00, 0xd2, 0xba, 0x00, 0x00,
-  0xb0, 0xba, 0x00, 0x00, 0x8d, 0xba, 0x00, 0x00, 0x6b, 0xba, 0x00, 0x00,
-  0x48, 0xba, 0x00, 0x00, 0x26, 0xba, 0x00, 0x00, 0x03, 0xba, 0x00, 0x00,
-  0xe1, 0xb9, 0x00, 0x00, 0xbe, 0xb9, 0x00, 0x00, 0x9c, 0xb9, 0x00, 0x00,
-  0x79, 0xb9, 0x00, 0x00, 0x56, 0xb9, 0x00, 0x00, 0x34, 0xb9, 0x00, 0x00,
-  0x11, 0xb9, 0x00, 0x00, 0xee, 0xb8, 0x00, 0x00, 0xcc, 0xb8, 0x00, 0x00,
-  0xa9, 0xb8, 0x00, 0x00, 0x86, 0xb8, 0x00, 0x00, 0x63, 0xb8, 0x00, 0x00,
-  0x40, 0xb8, 0x00, 0x00, 0x1d, 0xb8, 0x00, 0x00, 0xfa, 0xb7, 0x00, 0x00,
-  0xd7, 0xb7, 0x00, 0x00, 0xb4, 0xb7, 0x00, 0x00, 0x91, 0xb7, 0x00, 0x00,
-  0x6e, 0xb7, 0x00, 0x00, 0x4b, 0xb7, 0x00, 0x00, 0x28, 0xb7, 0x00, 0x00,
-  0x05, 0xb7, 0x00, 0x00, 0xe2, 0xb6, 0x00, 0x00, 0xbf, 0xb6, 0x00, 0x00,
-  0x9b, 0xb6, 0x00, 0x00, 0x78, 0xb6, 0x00, 0x00, 0x55, 0xb6, 0x00, 0x00,
-  0x32, 0xb6, 0x00, 0x00, 0x0e, 0xb6, 0x00, 0x00, 0xeb, 0xb5, 0x00, 0x00,
-  0xc8, 0xb5, 0x00, 0x00, 0xa4, 0xb5, 0x00, 0x00, 0x81, 0xb5, 0x00, 0x00,
-  0x5d, 0xb5, 0x00, 0x00, 0x3a, 0xb5, 0x00, 0x00, 0x16, 0xb5, 0x00, 0x00,
-  0xf3, 0xb4, 0x00, 0x00, 0xcf, 0xb4, 0x00, 0x00, 0xac, 0xb4, 0x00, 0x00,
-  0x88, 0xb4, 0x00, 0x00, 0x64, 0xb4, 0x00, 0x00, 0x41, 0xb4, 0x00, 0x00,
-  0x1d, 0xb4, 0x00, 0x00, 0xf9, 0xb3, 0x00, 0x00, 0xd5, 0xb3, 0x00, 0x00,
-  0xb2, 0xb3, 0x00, 0x00, 0x8e, 0xb3, 0x00, 0x00, 0x6a, 0xb3, 0x00, 0x00,
-  0x46, 0xb3, 0x00, 0x00, 0x22, 0xb3, 0x00, 0x00, 0xfe, 0xb2, 0x00, 0x00,
-  0xda, 0xb2, 0x00, 0x00, 0xb6, 0xb2, 0x00, 0x00, 0x92, 0xb2, 0x00, 0x00,
-  0x6e, 0xb2, 0x00, 0x00, 0x4a, 0xb2, 0x00, 0x00, 0x26, 0xb2, 0x00, 0x00,
-  0x02, 0xb2, 0x00, 0x00, 0xde, 0xb1, 0x00, 0x00, 0xba, 0xb1, 0x00, 0x00,
-  0x96, 0xb1, 0x00, 0x00, 0x71, 0xb1, 0x00, 0x00, 0x4d, 0xb1, 0x00, 0x00,
-  0x29, 0xb1, 0x00, 0x00, 0x04, 0xb1, 0x00, 0x00, 0xe0, 0xb0, 0x00, 0x00,
-  0xbc, 0xb0, 0x00, 0x00, 0x97, 0xb0, 0x00, 0x00, 0x73, 0xb0, 0x00, 0x00,
-  0x4f, 0xb0, 0x00, 0x00, 0x2a, 0xb0, 0x00, 0x00, 0x06, 0xb0, 0x00, 0x00,
-  0xe1, 0xaf, 0x00, 0x00, 0xbd, 0xaf, 0x00, 0x00, 0x98, 0xaf, 0x00, 0x00,
-  0x73, 0xaf, 0x00, 0x00, 0x4f, 0xaf, 0x00, 0x00, 0x2a, 0xaf, 0x00, 0x00,
-  0x06, 0xaf, 0x00, 0x00, 0xe1, 0xae, 0x00, 0x00, 0xbc, 0xae, 0x00, 0x00,
-  0x97, 0xae, 0x00, 0x00, 0x73, 0xae, 0x00, 0x00, 0x4e, 0xae, 0x00, 0x00,
-  0x29, 0xae, 0x00, 0x00, 0x04, 0xae, 0x00, 0x00, 0xdf, 0xad, 0x00, 0x00,
-  0xba, 0xad, 0x00, 0x00, 0x95, 0xad, 0x00, 0x00, 0x70, 0xad, 0x00, 0x00,
-  0x4b, 0xad, 0x00, 0x00, 0x26, 0xad, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00,
-  0xdc, 0xac, 0x00, 0x00, 0xb7, 0xac, 0x00, 0x00, 0x92, 0xac, 0x00, 0x00,
-  0x6d, 0xac, 0x00, 0x00, 0x48, 0xac, 0x00, 0x00, 0x23, 0xac, 0x00, 0x00,
-  0xfd, 0xab, 0x00, 0x00, 0xd8, 0xab, 0x00, 0x00, 0xb3, 0xab, 0x00, 0x00,
-  0x8e, 0xab, 0x00, 0x00, 0x68, 0xab, 0x00, 0x00, 0x43, 0xab, 0x00, 0x00,
-  0x1e, 0xab, 0x00, 0x00, 0xf8, 0xaa, 0x00, 0x00, 0xd3, 0xaa, 0x00, 0x00,
-  0xad, 0xaa, 0x00, 0x00, 0x88, 0xaa, 0x00, 0x00, 0x62, 0xaa, 0x00, 0x00,
-  0x3d, 0xaa, 0x00, 0x00, 0x17, 0xaa, 0x00, 0x00, 0xf2, 0xa9, 0x00, 0x00,
-  0xcc, 0xa9, 0x00, 0x00, 0xa6, 0xa9, 0x00, 0x00, 0x81, 0xa9, 0x00, 0x00,
-  0x5b, 0xa9, 0x00, 0x00, 0x35, 0xa9, 0x00, 0x00, 0x10, 0xa9, 0x00, 0x00,
-  0xea, 0xa8, 0x00, 0x00, 0xc4, 0xa8, 0x00, 0x00, 0x9e, 0xa8, 0x00, 0x00,
-  0x78, 0xa8, 0x00, 0x00, 0x53, 0xa8, 0x00, 0x00, 0x2d, 0xa8, 0x00, 0x00,
-  0x07, 0xa8, 0x00, 0x00, 0xe1, 0xa7, 0x00, 0x00, 0xbb, 0xa7, 0x00, 0x00,
-  0x95, 0xa7, 0x00, 0x00, 0x6f, 0xa7, 0x00, 0x00, 0x49, 0xa7, 0x00, 0x00,
-  0x23, 0xa7, 0x00, 0x00, 0xfd, 0xa6, 0x00, 0x00, 0xd7, 0xa6, 0x00, 0x00,
-  0xb0, 0xa6, 0x00, 0x00, 0x8a, 0xa6, 0x00, 0x00, 0x64, 0xa6, 0x00, 0x00,
-  0x3e, 0xa6, 0x00, 0x00, 0x18, 0xa6, 0x00, 0x00, 0xf1, 0xa5, 0x00, 0x00,
-  0xcb, 0xa5, 0x00, 0x00, 0xa5, 0xa5, 0x00, 0x00, 0x7e, 0xa5, 0x00, 0x00,
-  0x58, 0xa5, 0x00, 0x00, 0x32, 0xa5, 0x00, 0x00, 0x0b, 0xa5, 0x00, 0x00,
-  0xe5, 0xa4, 0x00, 0x00, 0xbe, 0xa4, 0x00, 0x00, 0x98, 0xa4, 0x00, 0x00,
-  0x71, 0xa4, 0x00, 0x00, 0x4b, 0xa4, 0x00, 0x00, 0x24, 0xa4, 0x00, 0x00,
-  0xfe, 0xa3, 0x00, 0x00, 0xd7, 0xa3, 0x00, 0x00, 0xb0, 0xa3, 0x00, 0x00,
-  0x8a, 0xa3, 0x00, 0x00, 0x63, 0xa3, 0x00, 0x00, 0x3c, 0xa3, 0x00, 0x00,
-  0x16, 0xa3, 0x00, 0x00, 0xef, 0xa2, 0x00, 0x00, 0xc8, 0xa2, 0x00, 0x00,
-  0xa1, 0xa2, 0x00, 0x00, 0x7b, 0xa2, 0x00, 0x00, 0x54, 0xa2, 0x00, 0x00,
-  0x2d, 0xa2, 0x00, 0x00, 0x06, 0xa2, 0x00, 0x00, 0xdf, 0xa1, 0x00, 0x00,
-  0xb8, 0xa1, 0x00, 0x00, 0x91, 0xa1, 0x00, 0x00, 0x6a, 0xa1, 0x00, 0x00,
-  0x43, 0xa1, 0x00, 0x00, 0x1c, 0xa1, 0x00, 0x00, 0xf5, 0xa0, 0x00, 0x00,
-  0xce, 0xa0, 0x00, 0x00, 0xa7, 0xa0, 0x00, 0x00, 0x80, 0xa0, 0x00, 0x00,
-  0x58, 0xa0, 0x00, 0x00, 0x31, 0xa0, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00,
-  0xe3, 0x9f, 0x00, 0x00, 0xbb, 0x9f, 0x00, 0x00, 0x94, 0x9f, 0x00, 0x00,
-  0x6d, 0x9f, 0x00, 0x00, 0x45, 0x9f, 0x00, 0x00, 0x1e, 0x9f, 0x00, 0x00,
-  0xf7, 0x9e, 0x00, 0x00, 0xcf, 0x9e, 0x00, 0x00, 0xa8, 0x9e, 0x00, 0x00,
-  0x80, 0x9e, 0x00, 0x00, 0x59, 0x9e, 0x00, 0x00, 0x31, 0x9e, 0x00, 0x00,
-  0x0a, 0x9e, 0x00, 0x00, 0xe2, 0x9d, 0x00, 0x00, 0xbb, 0x9d, 0x00, 0x00,
-  0x93, 0x9d, 0x00, 0x00, 0x6c, 0x9d, 0x00, 0x00, 0x44, 0x9d, 0x00, 0x00,
-  0x1c, 0x9d, 0x00, 0x00, 0xf4, 0x9c, 0x00, 0x00, 0xcd, 0x9c, 0x00, 0x00,
-  0xa5, 0x9c, 0x00, 0x00, 0x7d, 0x9c, 0x00, 0x00, 0x55, 0x9c, 0x00, 0x00,
-  0x2e, 0x9c, 0x00, 0x00, 0x06, 0x9c, 0x00, 0x00, 0xde, 0x9b, 0x00, 0x00,
-  0xb6, 0x9b, 0x00, 0x00, 0x8e, 0x9b, 0x00, 0x00, 0x66, 0x9b, 0x00, 0x00,
-  0x3e, 0x9b, 0x00, 0x00, 0x16, 0x9b, 0x00, 0x00, 0xee, 0x9a, 0x00, 0x00,
-  0xc6, 0x9a, 0x00, 0x00, 0x9e, 0x9a, 0x00, 0x00, 0x76, 0x9a, 0x00, 0x00,
-  0x4e, 0x9a, 0x00, 0x00, 0x26, 0x9a, 0x00, 0x00, 0xfe, 0x99, 0x00, 0x00,
-  0xd6, 0x99, 0x00, 0x00, 0xad, 0x99, 0x00, 0x00, 0x85, 0x99, 0x00, 0x00,
-  0x5d, 0x99, 0x00, 0x00, 0x35, 0x99, 0x00, 0x00, 0x0c, 0x99, 0x00, 0x00,
-  0xe4, 0x98, 0x00, 0x00, 0xbc, 0x98, 0x00, 0x00, 0x93, 0x98, 0x00, 0x00,
-  0x6b, 0x98, 0x00, 0x00, 0x43, 0x98, 0x00, 0x00, 0x1a, 0x98, 0x00, 0x00,
-  0xf2, 0x97, 0x00, 0x00, 0xc9, 0x97, 0x00, 0x00, 0xa1, 0x97, 0x00, 0x00,
-  0x78, 0x97, 0x00, 0x00, 0x50, 0x97, 0x00, 0x00, 0x27, 0x97, 0x00, 0x00,
-  0xff, 0x96, 0x00, 0x00, 0xd6, 0x96, 0x00, 0x00, 0xad, 0x96, 0x00, 0x00,
-  0x85, 0x96, 0x00, 0x00, 0x5c, 0x96, 0x00, 0x00, 0x33, 0x96, 0x00, 0x00,
-  0x0b, 0x96, 0x00, 0x00, 0xe2, 0x95, 0x00, 0x00, 0xb9, 0x95, 0x00, 0x00,
-  0x90, 0x95, 0x00, 0x00, 0x68, 0x95, 0x00, 0x00, 0x3f, 0x95, 0x00, 0x00,
-  0x16, 0x95, 0x00, 0x00, 0xed, 0x94, 0x00, 0x00, 0xc4, 0x94, 0x00, 0x00,
-  0x9b, 0x94, 0x00, 0x00, 0x72, 0x94, 0x00, 0x00, 0x49, 0x94, 0x00, 0x00,
-  0x20, 0x94, 0x00, 0x00, 0xf7, 0x93, 0x00, 0x00, 0xce, 0x93, 0x00, 0x00,
-  0xa5, 0x93, 0x00, 0x00, 0x7c, 0x93, 0x00, 0x00, 0x53, 0x93, 0x00, 0x00,
-  0x2a, 0x93, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0xd8, 0x92, 0x00, 0x00,
-  0xaf, 0x92, 0x00, 0x00, 0x85, 0x92, 0x00, 0x00, 0x5c, 0x92, 0x00, 0x00,
-  0x33, 0x92, 0x00, 0x00, 0x0a, 0x92, 0x00, 0x00, 0xe0, 0x91, 0x00, 0x00,
-  0xb7, 0x91, 0x00, 0x00, 0x8e, 0x91, 0x00, 0x00, 0x64, 0x91, 0x00, 0x00,
-  0x3b, 0x91, 0x00, 0x00, 0x11, 0x91, 0x00, 0x00, 0xe8, 0x90, 0x00, 0x00,
-  0xbf, 0x90, 0x00, 0x00, 0x95, 0x90, 0x00, 0x00, 0x6c, 0x90, 0x00, 0x00,
-  0x42, 0x90, 0x00, 0x00, 0x19, 0x90, 0x00, 0x00, 0xef, 0x8f, 0x00, 0x00,
-  0xc5, 0x8f, 0x00, 0x00, 0x9c, 0x8f, 0x00, 0x00, 0x72, 0x8f, 0x00, 0x00,
-  0x49, 0x8f, 0x00, 0x00, 0x1f, 0x8f, 0x00, 0x00, 0xf5, 0x8e, 0x00, 0x00,
-  0xcc, 0x8e, 0x00, 0x00, 0xa2, 0x8e, 0x00, 0x00, 0x78, 0x8e, 0x00, 0x00,
-  0x4e, 0x8e, 0x00, 0x00, 0x24, 0x8e, 0x00, 0x00, 0xfb, 0x8d, 0x00, 0x00,
-  0xd1, 0x8d, 0x00, 0x00, 0xa7, 0x8d, 0x00, 0x00, 0x7d, 0x8d, 0x00, 0x00,
-  0x53, 0x8d, 0x00, 0x00, 0x29, 0x8d, 0x00, 0x00, 0xff, 0x8c, 0x00, 0x00,
-  0xd5, 0x8c, 0x00, 0x00, 0xab, 0x8c, 0x00, 0x00, 0x81, 0x8c, 0x00, 0x00,
-  0x57, 0x8c, 0x00, 0x00, 0x2d, 0x8c, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00,
-  0xd9, 0x8b, 0x00, 0x00, 0xaf, 0x8b, 0x00, 0x00, 0x85, 0x8b, 0x00, 0x00,
-  0x5b, 0x8b, 0x00, 0x00, 0x31, 0x8b, 0x00, 0x00, 0x06, 0x8b, 0x00, 0x00,
-  0xdc, 0x8a, 0x00, 0x00, 0xb2, 0x8a, 0x00, 0x00, 0x88, 0x8a, 0x00, 0x00,
-  0x5d, 0x8a, 0x00, 0x00, 0x33, 0x8a, 0x00, 0x00, 0x09, 0x8a, 0x00, 0x00,
-  0xde, 0x89, 0x00, 0x00, 0xb4, 0x89, 0x00, 0x00, 0x8a, 0x89, 0x00, 0x00,
-  0x5f, 0x89, 0x00, 0x00, 0x35, 0x89, 0x00, 0x00, 0x0a, 0x89, 0x00, 0x00,
-  0xe0, 0x88, 0x00, 0x00, 0xb5, 0x88, 0x00, 0x00, 0x8b, 0x88, 0x00, 0x00,
-  0x60, 0x88, 0x00, 0x00, 0x36, 0x88, 0x00, 0x00, 0x0b, 0x88, 0x00, 0x00,
-  0xe1, 0x87, 0x00, 0x00, 0xb6, 0x87, 0x00, 0x00, 0x8b, 0x87, 0x00, 0x00,
-  0x61, 0x87, 0x00, 0x00, 0x36, 0x87, 0x00, 0x00, 0x0b, 0x87, 0x00, 0x00,
-  0xe1, 0x86, 0x00, 0x00, 0xb6, 0x86, 0x00, 0x00, 0x8b, 0x86, 0x00, 0x00,
-  0x60, 0x86, 0x00, 0x00, 0x36, 0x86, 0x00, 0x00, 0x0b, 0x86, 0x00, 0x00,
-  0xe0, 0x85, 0x00, 0x00, 0xb5, 0x85, 0x00, 0x00, 0x8a, 0x85, 0x00, 0x00,
-  0x5f, 0x85, 0x00, 0x00, 0x34, 0x85, 0x00, 0x00, 0x09, 0x85, 0x00, 0x00,
-  0xdf, 0x84, 0x00, 0x00, 0xb4, 0x84, 0x00, 0x00, 0x89, 0x84, 0x00, 0x00,
-  0x5e, 0x84, 0x00, 0x00, 0x33, 0x84, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00,
-  0xdc, 0x83, 0x00, 0x00, 0xb1, 0x83, 0x00, 0x00, 0x86, 0x83, 0x00, 0x00,
-  0x5b, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x05, 0x83, 0x00, 0x00,
-  0xda, 0x82, 0x00, 0x00, 0xae, 0x82, 0x00, 0x00, 0x83, 0x82, 0x00, 0x00,
-  0x58, 0x82, 0x00, 0x00, 0x2d, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
-  0xd6, 0x81, 0x00, 0x00, 0xab, 0x81, 0x00, 0x00, 0x7f, 0x81, 0x00, 0x00,
-  0x54, 0x81, 0x00, 0x00, 0x29, 0x81, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00,
-  0xd2, 0x80, 0x00, 0x00, 0xa6, 0x80, 0x00, 0x00, 0x7b, 0x80, 0x00, 0x00,
-  0x4f, 0x80, 0x00, 0x00, 0x24, 0x80, 0x00, 0x00, 0xf8, 0x7f, 0x00, 0x00,
-  0xcd, 0x7f, 0x00, 0x00, 0xa1, 0x7f, 0x00, 0x00, 0x76, 0x7f, 0x00, 0x00,
-  0x4a, 0x7f, 0x00, 0x00, 0x1e, 0x7f, 0x00, 0x00, 0xf3, 0x7e, 0x00, 0x00,
-  0xc7, 0x7e, 0x00, 0x00, 0x9b, 0x7e, 0x00, 0x00, 0x70, 0x7e, 0x00, 0x00,
-  0x44, 0x7e, 0x00, 0x00, 0x18, 0x7e, 0x00, 0x00, 0xec, 0x7d, 0x00, 0x00,
-  0xc1, 0x7d, 0x00, 0x00, 0x95, 0x7d, 0x00, 0x00, 0x69, 0x7d, 0x00, 0x00,
-  0x3d, 0x7d, 0x00, 0x00, 0x11, 0x7d, 0x00, 0x00, 0xe6, 0x7c, 0x00, 0x00,
-  0xba, 0x7c, 0x00, 0x00, 0x8e, 0x7c, 0x00, 0x00, 0x62, 0x7c, 0x00, 0x00,
-  0x36, 0x7c, 0x00, 0x00, 0x0a, 0x7c, 0x00, 0x00, 0xde, 0x7b, 0x00, 0x00,
-  0xb2, 0x7b, 0x00, 0x00, 0x86, 0x7b, 0x00, 0x00, 0x5a, 0x7b, 0x00, 0x00,
-  0x2e, 0x7b, 0x00, 0x00, 0x02, 0x7b, 0x00, 0x00, 0xd6, 0x7a, 0x00, 0x00,
-  0xaa, 0x7a, 0x00, 0x00, 0x7d, 0x7a, 0x00, 0x00, 0x51, 0x7a, 0x00, 0x00,
-  0x25, 0x7a, 0x00, 0x00, 0xf9, 0x79, 0x00, 0x00, 0xcd, 0x79, 0x00, 0x00,
-  0xa0, 0x79, 0x00, 0x00, 0x74, 0x79, 0x00, 0x00, 0x48, 0x79, 0x00, 0x00,
-  0x1c, 0x79, 0x00, 0x00, 0xef, 0x78, 0x00, 0x00, 0xc3, 0x78, 0x00, 0x00,
-  0x97, 0x78, 0x00, 0x00, 0x6a, 0x78, 0x00, 0x00, 0x3e, 0x78, 0x00, 0x00,
-  0x12, 0x78, 0x00, 0x00, 0xe5, 0x77, 0x00, 0x00, 0xb9, 0x77, 0x00, 0x00,
-  0x8c, 0x77, 0x00, 0x00, 0x60, 0x77, 0x00, 0x00, 0x33, 0x77, 0x00, 0x00,
-  0x07, 0x77, 0x00, 0x00, 0xda, 0x76, 0x00, 0x00, 0xae, 0x76, 0x00, 0x00,
-  0x81, 0x76, 0x00, 0x00, 0x55, 0x76, 0x00, 0x00, 0x28, 0x76, 0x00, 0x00,
-  0xfc, 0x75, 0x00, 0x00, 0xcf, 0x75, 0x00, 0x00, 0xa2, 0x75, 0x00, 0x00,
-  0x76, 0x75, 0x00, 0x00, 0x49, 0x75, 0x00, 0x00, 0x1c, 0x75, 0x00, 0x00,
-  0xf0, 0x74, 0x00, 0x00, 0xc3, 0x74, 0x00, 0x00, 0x96, 0x74, 0x00, 0x00,
-  0x69, 0x74, 0x00, 0x00, 0x3d, 0x74, 0x00, 0x00, 0x10, 0x74, 0x00, 0x00,
-  0xe3, 0x73, 0x00, 0x00, 0xb6, 0x73, 0x00, 0x00, 0x89, 0x73, 0x00, 0x00,
-  0x5d, 0x73, 0x00, 0x00, 0x30, 0x73, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00,
-  0xd6, 0x72, 0x00, 0x00, 0xa9, 0x72, 0x00, 0x00, 0x7c, 0x72, 0x00, 0x00,
-  0x4f, 0x72, 0x00, 0x00, 0x22, 0x72, 0x00, 0x00, 0xf5, 0x71, 0x00, 0x00,
-  0xc8, 0x71, 0x00, 0x00, 0x9b, 0x71, 0x00, 0x00, 0x6e, 0x71, 0x00, 0x00,
-  0x41, 0x71, 0x00, 0x00, 0x14, 0x71, 0x00, 0x00, 0xe7, 0x70, 0x00, 0x00,
-  0xba, 0x70, 0x00, 0x00, 0x8c, 0x70, 0x00, 0x00, 0x5f, 0x70, 0x00, 0x00,
-  0x32, 0x70, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00, 0xd8, 0x6f, 0x00, 0x00,
-  0xaa, 0x6f, 0x00, 0x00, 0x7d, 0x6f, 0x00, 0x00, 0x50, 0x6f, 0x00, 0x00,
-  0x23, 0x6f, 0x00, 0x00, 0xf5, 0x6e, 0x00, 0x00, 0xc8, 0x6e, 0x00, 0x00,
-  0x9b, 0x6e, 0x00, 0x00, 0x6d, 0x6e, 0x00, 0x00, 0x40, 0x6e, 0x00, 0x00,
-  0x13, 0x6e, 0x00, 0x00, 0xe5, 0x6d, 0x00, 0x00, 0xb8, 0x6d, 0x00, 0x00,
-  0x8a, 0x6d, 0x00, 0x00, 0x5d, 0x6d, 0x00, 0x00, 0x30, 0x6d, 0x00, 0x00,
-  0x02, 0x6d, 0x00, 0x00, 0xd5, 0x6c, 0x00, 0x00, 0xa7, 0x6c, 0x00, 0x00,
-  0x7a, 0x6c, 0x00, 0x00, 0x4c, 0x6c, 0x00, 0x00, 0x1e, 0x6c, 0x00, 0x00,
-  0xf1, 0x6b, 0x00, 0x00, 0xc3, 0x6b, 0x00, 0x00, 0x96, 0x6b, 0x00, 0x00,
-  0x68, 0x6b, 0x00, 0x00, 0x3a, 0x6b, 0x00, 0x00, 0x0d, 0x6b, 0x00, 0x00,
-  0xdf, 0x6a, 0x00, 0x00, 0xb1, 0x6a, 0x00, 0x00, 0x84, 0x6a, 0x00, 0x00,
-  0x56, 0x6a, 0x00, 0x00, 0x28, 0x6a, 0x00, 0x00, 0xfb, 0x69, 0x00, 0x00,
-  0xcd, 0x69, 0x00, 0x00, 0x9f, 0x69, 0x00, 0x00, 0x71, 0x69, 0x00, 0x00,
-  0x43, 0x69, 0x00, 0x00, 0x16, 0x69, 0x00, 0x00, 0xe8, 0x68, 0x00, 0x00,
-  0xba, 0x68, 0x00, 0x00, 0x8c, 0x68, 0x00, 0x00, 0x5e, 0x68, 0x00, 0x00,
-  0x30, 0x68, 0x00, 0x00, 0x02, 0x68, 0x00, 0x00, 0xd4, 0x67, 0x00, 0x00,
-  0xa6, 0x67, 0x00, 0x00, 0x78, 0x67, 0x00, 0x00, 0x4a, 0x67, 0x00, 0x00,
-  0x1c, 0x67, 0x00, 0x00, 0xee, 0x66, 0x00, 0x00, 0xc0, 0x66, 0x00, 0x00,
-  0x92, 0x66, 0x00, 0x00, 0x64, 0x66, 0x00, 0x00, 0x36, 0x66, 0x00, 0x00,
-  0x08, 0x66, 0x00, 0x00, 0xda, 0x65, 0x00, 0x00, 0xac, 0x65, 0x00, 0x00,
-  0x7e, 0x65, 0x00, 0x00, 0x50, 0x65, 0x00, 0x00, 0x21, 0x65, 0x00, 0x00,
-  0xf3, 0x64, 0x00, 0x00, 0xc5, 0x64, 0x00, 0x00, 0x97, 0x64, 0x00, 0x00,
-  0x69, 0x64, 0x00, 0x00, 0x3a, 0x64, 0x00, 0x00, 0x0c, 0x64, 0x00, 0x00,
-  0xde, 0x63, 0x00, 0x00, 0xb0, 0x63, 0x00, 0x00, 0x81, 0x63, 0x00, 0x00,
-  0x53, 0x63, 0x00, 0x00, 0x25, 0x63, 0x00, 0x00, 0xf6, 0x62, 0x00, 0x00,
-  0xc8, 0x62, 0x00, 0x00, 0x99, 0x62, 0x00, 0x00, 0x6b, 0x62, 0x00, 0x00,
-  0x3d, 0x62, 0x00, 0x00, 0x0e, 0x62, 0x00, 0x00, 0xe0, 0x61, 0x00, 0x00,
-  0xb1, 0x61, 0x00, 0x00, 0x83, 0x61, 0x00, 0x00, 0x54, 0x61, 0x00, 0x00,
-  0x26, 0x61, 0x00, 0x00, 0xf7, 0x60, 0x00, 0x00, 0xc9, 0x60, 0x00, 0x00,
-  0x9a, 0x60, 0x00, 0x00, 0x6c, 0x60, 0x00, 0x00, 0x3d, 0x60, 0x00, 0x00,
-  0x0f, 0x60, 0x00, 0x00, 0xe0, 0x5f, 0x00, 0x00, 0xb1, 0x5f, 0x00, 0x00,
-  0x83, 0x5f, 0x00, 0x00, 0x54, 0x5f, 0x00, 0x00, 0x25, 0x5f, 0x00, 0x00,
-  0xf7, 0x5e, 0x00, 0x00, 0xc8, 0x5e, 0x00, 0x00, 0x99, 0x5e, 0x00, 0x00,
-  0x6b, 0x5e, 0x00, 0x00, 0x3c, 0x5e, 0x00, 0x00, 0x0d, 0x5e, 0x00, 0x00,
-  0xde, 0x5d, 0x00, 0x00, 0xb0, 0x5d, 0x00, 0x00, 0x81, 0x5d, 0x00, 0x00,
-  0x52, 0x5d, 0x00, 0x00, 0x23, 0x5d, 0x00, 0x00, 0xf4, 0x5c, 0x00, 0x00,
-  0xc6, 0x5c, 0x00, 0x00, 0x97, 0x5c, 0x00, 0x00, 0x68, 0x5c, 0x00, 0x00,
-  0x39, 0x5c, 0x00, 0x00, 0x0a, 0x5c, 0x00, 0x00, 0xdb, 0x5b, 0x00, 0x00,
-  0xac, 0x5b, 0x00, 0x00, 0x7d, 0x5b, 0x00, 0x00, 0x4e, 0x5b, 0x00, 0x00,
-  0x1f, 0x5b, 0x00, 0x00, 0xf0, 0x5a, 0x00, 0x00, 0xc1, 0x5a, 0x00, 0x00,
-  0x92, 0x5a, 0x00, 0x00, 0x63, 0x5a, 0x00, 0x00, 0x34, 0x5a, 0x00, 0x00,
-  0x05, 0x5a, 0x00, 0x00, 0xd6, 0x59, 0x00, 0x00, 0xa7, 0x59, 0x00, 0x00,
-  0x78, 0x59, 0x00, 0x00, 0x49, 0x59, 0x00, 0x00, 0x1a, 0x59, 0x00, 0x00,
-  0xeb, 0x58, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x8c, 0x58, 0x00, 0x00,
-  0x5d, 0x58, 0x00, 0x00, 0x2e, 0x58, 0x00, 0x00, 0xff, 0x57, 0x00, 0x00,
-  0xd0, 0x57, 0x00, 0x00, 0xa1, 0x57, 0x00, 0x00, 0x71, 0x57, 0x00, 0x00,
-  0x42, 0x57, 0x00, 0x00, 0x13, 0x57, 0x00, 0x00, 0xe3, 0x56, 0x00, 0x00,
-  0xb4, 0x56, 0x00, 0x00, 0x85, 0x56, 0x00, 0x00, 0x56, 0x56, 0x00, 0x00,
-  0x26, 0x56, 0x00, 0x00, 0xf7, 0x55, 0x00, 0x00, 0xc8, 0x55, 0x00, 0x00,
-  0x98, 0x55, 0x00, 0x00, 0x69, 0x55, 0x00, 0x00, 0x39, 0x55, 0x00, 0x00,
-  0x0a, 0x55, 0x00, 0x00, 0xdb, 0x54, 0x00, 0x00, 0xab, 0x54, 0x00, 0x00,
-  0x7c, 0x54, 0x00, 0x00, 0x4c, 0x54, 0x00, 0x00, 0x1d, 0x54, 0x00, 0x00,
-  0xed, 0x53, 0x00, 0x00, 0xbe, 0x53, 0x00, 0x00, 0x8e, 0x53, 0x00, 0x00,
-  0x5f, 0x53, 0x00, 0x00, 0x2f, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
-  0xd0, 0x52, 0x00, 0x00, 0xa1, 0x52, 0x00, 0x00, 0x71, 0x52, 0x00, 0x00,
-  0x41, 0x52, 0x00, 0x00, 0x12, 0x52, 0x00, 0x00, 0xe2, 0x51, 0x00, 0x00,
-  0xb3, 0x51, 0x00, 0x00, 0x83, 0x51, 0x00, 0x00, 0x53, 0x51, 0x00, 0x00,
-  0x24, 0x51, 0x00, 0x00, 0xf4, 0x50, 0x00, 0x00, 0xc4, 0x50, 0x00, 0x00,
-  0x95, 0x50, 0x00, 0x00, 0x65, 0x50, 0x00, 0x00, 0x35, 0x50, 0x00, 0x00,
-  0x05, 0x50, 0x00, 0x00, 0xd6, 0x4f, 0x00, 0x00, 0xa6, 0x4f, 0x00, 0x00,
-  0x76, 0x4f, 0x00, 0x00, 0x46, 0x4f, 0x00, 0x00, 0x16, 0x4f, 0x00, 0x00,
-  0xe7, 0x4e, 0x00, 0x00, 0xb7, 0x4e, 0x00, 0x00, 0x87, 0x4e, 0x00, 0x00,
-  0x57, 0x4e, 0x00, 0x00, 0x27, 0x4e, 0x00, 0x00, 0xf7, 0x4d, 0x00, 0x00,
-  0xc8, 0x4d, 0x00, 0x00, 0x98, 0x4d, 0x00, 0x00, 0x68, 0x4d, 0x00, 0x00,
-  0x38, 0x4d, 0x00, 0x00, 0x08, 0x4d, 0x00, 0x00, 0xd8, 0x4c, 0x00, 0x00,
-  0xa8, 0x4c, 0x00, 0x00, 0x78, 0x4c, 0x00, 0x00, 0x48, 0x4c, 0x00, 0x00,
-  0x18, 0x4c, 0x00, 0x00, 0xe8, 0x4b, 0x00, 0x00, 0xb8, 0x4b, 0x00, 0x00,
-  0x88, 0x4b, 0x00, 0x00, 0x58, 0x4b, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x00,
-  0xf8, 0x4a, 0x00, 0x00, 0xc8, 0x4a, 0x00, 0x00, 0x98, 0x4a, 0x00, 0x00,
-  0x68, 0x4a, 0x00, 0x00, 0x38, 0x4a, 0x00, 0x00, 0x07, 0x4a, 0x00, 0x00,
-  0xd7, 0x49, 0x00, 0x00, 0xa7, 0x49, 0x00, 0x00, 0x77, 0x49, 0x00, 0x00,
-  0x47, 0x49, 0x00, 0x00, 0x17, 0x49, 0x00, 0x00, 0xe7, 0x48, 0x00, 0x00,
-  0xb6, 0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x00, 0x56, 0x48, 0x00, 0x00,
-  0x26, 0x48, 0x00, 0x00, 0xf5, 0x47, 0x00, 0x00, 0xc5, 0x47, 0x00, 0x00,
-  0x95, 0x47, 0x00, 0x00, 0x65, 0x47, 0x00, 0x00, 0x34, 0x47, 0x00, 0x00,
-  0x04, 0x47, 0x00, 0x00, 0xd4, 0x46, 0x00, 0x00, 0xa4, 0x46, 0x00, 0x00,
-  0x73, 0x46, 0x00, 0x00, 0x43, 0x46, 0x00, 0x00, 0x13, 0x46, 0x00, 0x00,
-  0xe2, 0x45, 0x00, 0x00, 0xb2, 0x45, 0x00, 0x00, 0x81, 0x45, 0x00, 0x00,
-  0x51, 0x45, 0x00, 0x00, 0x21, 0x45, 0x00, 0x00, 0xf0, 0x44, 0x00, 0x00,
-  0xc0, 0x44, 0x00, 0x00, 0x8f, 0x44, 0x00, 0x00, 0x5f, 0x44, 0x00, 0x00,
-  0x2f, 0x44, 0x00, 0x00, 0xfe, 0x43, 0x00, 0x00, 0xce, 0x43, 0x00, 0x00,
-  0x9d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00,
-  0x0c, 0x43, 0x00, 0x00, 0xdb, 0x42, 0x00, 0x00, 0xab, 0x42, 0x00, 0x00,
-  0x7a, 0x42, 0x00, 0x00, 0x4a, 0x42, 0x00, 0x00, 0x19, 0x42, 0x00, 0x00,
-  0xe8, 0x41, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x87, 0x41, 0x00, 0x00,
-  0x57, 0x41, 0x00, 0x00, 0x26, 0x41, 0x00, 0x00, 0xf5, 0x40, 0x00, 0x00,
-  0xc5, 0x40, 0x00, 0x00, 0x94, 0x40, 0x00, 0x00, 0x64, 0x40, 0x00, 0x00,
-  0x33, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0xd2, 0x3f, 0x00, 0x00,
-  0xa1, 0x3f, 0x00, 0x00, 0x70, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00,
-  0x0f, 0x3f, 0x00, 0x00, 0xde, 0x3e, 0x00, 0x00, 0xad, 0x3e, 0x00, 0x00,
-  0x7d, 0x3e, 0x00, 0x00, 0x4c, 0x3e, 0x00, 0x00, 0x1b, 0x3e, 0x00, 0x00,
-  0xea, 0x3d, 0x00, 0x00, 0xba, 0x3d, 0x00, 0x00, 0x89, 0x3d, 0x00, 0x00,
-  0x58, 0x3d, 0x00, 0x00, 0x27, 0x3d, 0x00, 0x00, 0xf6, 0x3c, 0x00, 0x00,
-  0xc5, 0x3c, 0x00, 0x00, 0x95, 0x3c, 0x00, 0x00, 0x64, 0x3c, 0x00, 0x00,
-  0x33, 0x3c, 0x00, 0x00, 0x02, 0x3c, 0x00, 0x00, 0xd1, 0x3b, 0x00, 0x00,
-  0xa0, 0x3b, 0x00, 0x00, 0x6f, 0x3b, 0x00, 0x00, 0x3f, 0x3b, 0x00, 0x00,
-  0x0e, 0x3b, 0x00, 0x00, 0xdd, 0x3a, 0x00, 0x00, 0xac, 0x3a, 0x00, 0x00,
-  0x7b, 0x3a, 0x00, 0x00, 0x4a, 0x3a, 0x00, 0x00, 0x19, 0x3a, 0x00, 0x00,
-  0xe8, 0x39, 0x00, 0x00, 0xb7, 0x39, 0x00, 0x00, 0x86, 0x39, 0x00, 0x00,
-  0x55, 0x39, 0x00, 0x00, 0x24, 0x39, 0x00, 0x00, 0xf3, 0x38, 0x00, 0x00,
-  0xc2, 0x38, 0x00, 0x00, 0x91, 0x38, 0x00, 0x00, 0x60, 0x38, 0x00, 0x00,
-  0x2f, 0x38, 0x00, 0x00, 0xfe, 0x37, 0x00, 0x00, 0xcd, 0x37, 0x00, 0x00,
-  0x9c, 0x37, 0x00, 0x00, 0x6b, 0x37, 0x00, 0x00, 0x3a, 0x37, 0x00, 0x00,
-  0x09, 0x37, 0x00, 0x00, 0xd8, 0x36, 0x00, 0x00, 0xa6, 0x36, 0x00, 0x00,
-  0x75, 0x36, 0x00, 0x00, 0x44, 0x36, 0x00, 0x00, 0x13, 0x36, 0x00, 0x00,
-  0xe2, 0x35, 0x00, 0x00, 0xb1, 0x35, 0x00, 0x00, 0x80, 0x35, 0x00, 0x00,
-  0x4e, 0x35, 0x00, 0x00, 0x1d, 0x35, 0x00, 0x00, 0xec, 0x34, 0x00, 0x00,
-  0xbb, 0x34, 0x00, 0x00, 0x8a, 0x34, 0x00, 0x00, 0x59, 0x34, 0x00, 0x00,
-  0x27, 0x34, 0x00, 0x00, 0xf6, 0x33, 0x00, 0x00, 0xc5, 0x33, 0x00, 0x00,
-  0x94, 0x33, 0x00, 0x00, 0x62, 0x33, 0x00, 0x00, 0x31, 0x33, 0x00, 0x00,
-  0x00, 0x33, 0x00, 0x00, 0xcf, 0x32, 0x00, 0x00, 0x9d, 0x32, 0x00, 0x00,
-  0x6c, 0x32, 0x00, 0x00, 0x3b, 0x32, 0x00, 0x00, 0x0a, 0x32, 0x00, 0x00,
-  0xd8, 0x31, 0x00, 0x00, 0xa7, 0x31, 0x00, 0x00, 0x76, 0x31, 0x00, 0x00,
-  0x44, 0x31, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00, 0xe2, 0x30, 0x00, 0x00,
-  0xb0, 0x30, 0x00, 0x00, 0x7f, 0x30, 0x00, 0x00, 0x4e, 0x30, 0x00, 0x00,
-  0x1c, 0x30, 0x00, 0x00, 0xeb, 0x2f, 0x00, 0x00, 0xba, 0x2f, 0x00, 0x00,
-  0x88, 0x2f, 0x00, 0x00, 0x57, 0x2f, 0x00, 0x00, 0x25, 0x2f, 0x00, 0x00,
-  0xf4, 0x2e, 0x00, 0x00, 0xc2, 0x2e, 0x00, 0x00, 0x91, 0x2e, 0x00, 0x00,
-  0x60, 0x2e, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x00, 0xfd, 0x2d, 0x00, 0x00,
-  0xcb, 0x2d, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0x00, 0x68, 0x2d, 0x00, 0x00,
-  0x37, 0x2d, 0x00, 0x00, 0x05, 0x2d, 0x00, 0x00, 0xd4, 0x2c, 0x00, 0x00,
-  0xa2, 0x2c, 0x00, 0x00, 0x71, 0x2c, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x00,
-  0x0e, 0x2c, 0x00, 0x00, 0xdc, 0x2b, 0x00, 0x00, 0xab, 0x2b, 0x00, 0x00,
-  0x79, 0x2b, 0x00, 0x00, 0x48, 0x2b, 0x00, 0x00, 0x16, 0x2b, 0x00, 0x00,
-  0xe5, 0x2a, 0x00, 0x00, 0xb3, 0x2a, 0x00, 0x00, 0x82, 0x2a, 0x00, 0x00,
-  0x50, 0x2a, 0x00, 0x00, 0x1e, 0x2a, 0x00, 0x00, 0xed, 0x29, 0x00, 0x00,
-  0xbb, 0x29, 0x00, 0x00, 0x8a, 0x29, 0x00, 0x00, 0x58, 0x29, 0x00, 0x00,
-  0x26, 0x29, 0x00, 0x00, 0xf5, 0x28, 0x00, 0x00, 0xc3, 0x28, 0x00, 0x00,
-  0x92, 0x28, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00, 0x2e, 0x28, 0x00, 0x00,
-  0xfd, 0x27, 0x00, 0x00, 0xcb, 0x27, 0x00, 0x00, 0x99, 0x27, 0x00, 0x00,
-  0x68, 0x27, 0x00, 0x00, 0x36, 0x27, 0x00, 0x00, 0x04, 0x27, 0x00, 0x00,
-  0xd3, 0x26, 0x00, 0x00, 0xa1, 0x26, 0x00, 0x00, 0x6f, 0x26, 0x00, 0x00,
-  0x3e, 0x26, 0x00, 0x00, 0x0c, 0x26, 0x00, 0x00, 0xda, 0x25, 0x00, 0x00,
-  0xa8, 0x25, 0x00, 0x00, 0x77, 0x25, 0x00, 0x00, 0x45, 0x25, 0x00, 0x00,
-  0x13, 0x25, 0x00, 0x00, 0xe2, 0x24, 0x00, 0x00, 0xb0, 0x24, 0x00, 0x00,
-  0x7e, 0x24, 0x00, 0x00, 0x4c, 0x24, 0x00, 0x00, 0x1b, 0x24, 0x00, 0x00,
-  0xe9, 0x23, 0x00, 0x00, 0xb7, 0x23, 0x00, 0x00, 0x85, 0x23, 0x00, 0x00,
-  0x53, 0x23, 0x00, 0x00, 0x22, 0x23, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00,
-  0xbe, 0x22, 0x00, 0x00, 0x8c, 0x22, 0x00, 0x00, 0x5a, 0x22, 0x00, 0x00,
-  0x29, 0x22, 0x00, 0x00, 0xf7, 0x21, 0x00, 0x00, 0xc5, 0x21, 0x00, 0x00,
-  0x93, 0x21, 0x00, 0x00, 0x61, 0x21, 0x00, 0x00, 0x30, 0x21, 0x00, 0x00,
-  0xfe, 0x20, 0x00, 0x00, 0xcc, 0x20, 0x00, 0x00, 0x9a, 0x20, 0x00, 0x00,
-  0x68, 0x20, 0x00, 0x00, 0x36, 0x20, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00,
-  0xd3, 0x1f, 0x00, 0x00, 0xa1, 0x1f, 0x00, 0x00, 0x6f, 0x1f, 0x00, 0x00,
-  0x3d, 0x1f, 0x00, 0x00, 0x0b, 0x1f, 0x00, 0x00, 0xd9, 0x1e, 0x00, 0x00,
-  0xa7, 0x1e, 0x00, 0x00, 0x75, 0x1e, 0x00, 0x00, 0x43, 0x1e, 0x00, 0x00,
-  0x11, 0x1e, 0x00, 0x00, 0xe0, 0x1d, 0x00, 0x00, 0xae, 0x1d, 0x00, 0x00,
-  0x7c, 0x1d, 0x00, 0x00, 0x4a, 0x1d, 0x00, 0x00, 0x18, 0x1d, 0x00, 0x00,
-  0xe6, 0x1c, 0x00, 0x00, 0xb4, 0x1c, 0x00, 0x00, 0x82, 0x1c, 0x00, 0x00,
-  0x50, 0x1c, 0x00, 0x00, 0x1e, 0x1c, 0x00, 0x00, 0xec, 0x1b, 0x00, 0x00,
-  0xba, 0x1b, 0x00, 0x00, 0x88, 0x1b, 0x00, 0x00, 0x56, 0x1b, 0x00, 0x00,
-  0x24, 0x1b, 0x00, 0x00, 0xf2, 0x1a, 0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00,
-  0x8e, 0x1a, 0x00, 0x00, 0x5c, 0x1a, 0x00, 0x00, 0x2a, 0x1a, 0x00, 0x00,
-  0xf8, 0x19, 0x00, 0x00, 0xc6, 0x19, 0x00, 0x00, 0x94, 0x19, 0x00, 0x00,
-  0x62, 0x19, 0x00, 0x00, 0x30, 0x19, 0x00, 0x00, 0xfe, 0x18, 0x00, 0x00,
-  0xcc, 0x18, 0x00, 0x00, 0x9a, 0x18, 0x00, 0x00, 0x68, 0x18, 0x00, 0x00,
-  0x36, 0x18, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00, 0xd2, 0x17, 0x00, 0x00,
-  0xa0, 0x17, 0x00, 0x00, 0x6e, 0x17, 0x00, 0x00, 0x3c, 0x17, 0x00, 0x00,
-  0x0a, 0x17, 0x00, 0x00, 0xd8, 0x16, 0x00, 0x00, 0xa6, 0x16, 0x00, 0x00,
-  0x74, 0x16, 0x00, 0x00, 0x41, 0x16, 0x00, 0x00, 0x0f, 0x16, 0x00, 0x00,
-  0xdd, 0x15, 0x00, 0x00, 0xab, 0x15, 0x00, 0x00, 0x79, 0x15, 0x00, 0x00,
-  0x47, 0x15, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0xe3, 0x14, 0x00, 0x00,
-  0xb1, 0x14, 0x00, 0x00, 0x7f, 0x14, 0x00, 0x00, 0x4d, 0x14, 0x00, 0x00,
-  0x1a, 0x14, 0x00, 0x00, 0xe8, 0x13, 0x00, 0x00, 0xb6, 0x13, 0x00, 0x00,
-  0x84, 0x13, 0x00, 0x00, 0x52, 0x13, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00,
-  0xee, 0x12, 0x00, 0x00, 0xbc, 0x12, 0x00, 0x00, 0x89, 0x12, 0x00, 0x00,
-  0x57, 0x12, 0x00, 0x00, 0x25, 0x12, 0x00, 0x00, 0xf3, 0x11, 0x00, 0x00,
-  0xc1, 0x11, 0x00, 0x00, 0x8f, 0x11, 0x00, 0x00, 0x5d, 0x11, 0x00, 0x00,
-  0x2a, 0x11, 0x00, 0x00, 0xf8, 0x10, 0x00, 0x00, 0xc6, 0x10, 0x00, 0x00,
-  0x94, 0x10, 0x00, 0x00, 0x62, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00,
-  0xfd, 0x0f, 0x00, 0x00, 0xcb, 0x0f, 0x00, 0x00, 0x99, 0x0f, 0x00, 0x00,
-  0x67, 0x0f, 0x00, 0x00, 0x35, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x00, 0x00,
-  0xd0, 0x0e, 0x00, 0x00, 0x9e, 0x0e, 0x00, 0x00, 0x6c, 0x0e, 0x00, 0x00,
-  0x3a, 0x0e, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00, 0xd5, 0x0d, 0x00, 0x00,
-  0xa3, 0x0d, 0x00, 0x00, 0x71, 0x0d, 0x00, 0x00, 0x3f, 0x0d, 0x00, 0x00,
-  0x0d, 0x0d, 0x00, 0x00, 0xdb, 0x0c, 0x00, 0x00, 0xa8, 0x0c, 0x00, 0x00,
-  0x76, 0x0c, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00, 0x12, 0x0c, 0x00, 0x00,
-  0xdf, 0x0b, 0x00, 0x00, 0xad, 0x0b, 0x00, 0x00, 0x7b, 0x0b, 0x00, 0x00,
-  0x49, 0x0b, 0x00, 0x00, 0x17, 0x0b, 0x00, 0x00, 0xe4, 0x0a, 0x00, 0x00,
-  0xb2, 0x0a, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0x4e, 0x0a, 0x00, 0x00,
-  0x1b, 0x0a, 0x00, 0x00, 0xe9, 0x09, 0x00, 0x00, 0xb7, 0x09, 0x00, 0x00,
-  0x85, 0x09, 0x00, 0x00, 0x53, 0x09, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00,
-  0xee, 0x08, 0x00, 0x00, 0xbc, 0x08, 0x00, 0x00, 0x8a, 0x08, 0x00, 0x00,
-  0x57, 0x08, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0xf3, 0x07, 0x00, 0x00,
-  0xc1, 0x07, 0x00, 0x00, 0x8e, 0x07, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00,
-  0x2a, 0x07, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0xc5, 0x06, 0x00, 0x00,
-  0x93, 0x06, 0x00, 0x00, 0x61, 0x06, 0x00, 0x00, 0x2f, 0x06, 0x00, 0x00,
-  0xfc, 0x05, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00,
-  0x66, 0x05, 0x00, 0x00, 0x33, 0x05, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00,
-  0xcf, 0x04, 0x00, 0x00, 0x9d, 0x04, 0x00, 0x00, 0x6a, 0x04, 0x00, 0x00,
-  0x38, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00,
-  0xa1, 0x03, 0x00, 0x00, 0x6f, 0x03, 0x00, 0x00, 0x3d, 0x03, 0x00, 0x00,
-  0x0b, 0x03, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00,
-  0x74, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x00,
-  0xdd, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00,
-  0x46, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00,
-  0xaf, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff,
-  0x83, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff,
-  0xec, 0xfe, 0xff, 0xff, 0xba, 0xfe, 0xff, 0xff, 0x88, 0xfe, 0xff, 0xff,
-  0x55, 0xfe, 0xff, 0xff, 0x23, 0xfe, 0xff, 0xff, 0xf1, 0xfd, 0xff, 0xff,
-  0xbe, 0xfd, 0xff, 0xff, 0x8c, 0xfd, 0xff, 0xff, 0x5a, 0xfd, 0xff, 0xff,
-  0x28, 0xfd, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0xc3, 0xfc, 0xff, 0xff,
-  0x91, 0xfc, 0xff, 0xff, 0x5f, 0xfc, 0xff, 0xff, 0x2c, 0xfc, 0xff, 0xff,
-  0xfa, 0xfb, 0xff, 0xff, 0xc8, 0xfb, 0xff, 0xff, 0x96, 0xfb, 0xff, 0xff,
-  0x63, 0xfb, 0xff, 0xff, 0x31, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-  0xcd, 0xfa, 0xff, 0xff, 0x9a, 0xfa, 0xff, 0xff, 0x68, 0xfa, 0xff, 0xff,
-  0x36, 0xfa, 0xff, 0xff, 0x04, 0xfa, 0xff, 0xff, 0xd1, 0xf9, 0xff, 0xff,
-  0x9f, 0xf9, 0xff, 0xff, 0x6d, 0xf9, 0xff, 0xff, 0x3b, 0xf9, 0xff, 0xff,
-  0x08, 0xf9, 0xff, 0xff, 0xd6, 0xf8, 0xff, 0xff, 0xa4, 0xf8, 0xff, 0xff,
-  0x72, 0xf8, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x0d, 0xf8, 0xff, 0xff,
-  0xdb, 0xf7, 0xff, 0xff, 0xa9, 0xf7, 0xff, 0xff, 0x76, 0xf7, 0xff, 0xff,
-  0x44, 0xf7, 0xff, 0xff, 0x12, 0xf7, 0xff, 0xff, 0xe0, 0xf6, 0xff, 0xff,
-  0xad, 0xf6, 0xff, 0xff, 0x7b, 0xf6, 0xff, 0xff, 0x49, 0xf6, 0xff, 0xff,
-  0x17, 0xf6, 0xff, 0xff, 0xe4, 0xf5, 0xff, 0xff, 0xb2, 0xf5, 0xff, 0xff,
-  0x80, 0xf5, 0xff, 0xff, 0x4e, 0xf5, 0xff, 0xff, 0x1c, 0xf5, 0xff, 0xff,
-  0xe9, 0xf4, 0xff, 0xff, 0xb7, 0xf4, 0xff, 0xff, 0x85, 0xf4, 0xff, 0xff,
-  0x53, 0xf4, 0xff, 0xff, 0x21, 0xf4, 0xff, 0xff, 0xee, 0xf3, 0xff, 0xff,
-  0xbc, 0xf3, 0xff, 0xff, 0x8a, 0xf3, 0xff, 0xff, 0x58, 0xf3, 0xff, 0xff,
-  0x25, 0xf3, 0xff, 0xff, 0xf3, 0xf2, 0xff, 0xff, 0xc1, 0xf2, 0xff, 0xff,
-  0x8f, 0xf2, 0xff, 0xff, 0x5d, 0xf2, 0xff, 0xff, 0x2b, 0xf2, 0xff, 0xff,
-  0xf8, 0xf1, 0xff, 0xff, 0xc6, 0xf1, 0xff, 0xff, 0x94, 0xf1, 0xff, 0xff,
-  0x62, 0xf1, 0xff, 0xff, 0x30, 0xf1, 0xff, 0xff, 0xfd, 0xf0, 0xff, 0xff,
-  0xcb, 0xf0, 0xff, 0xff, 0x99, 0xf0, 0xff, 0xff, 0x67, 0xf0, 0xff, 0xff,
-  0x35, 0xf0, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xd0, 0xef, 0xff, 0xff,
-  0x9e, 0xef, 0xff, 0xff, 0x6c, 0xef, 0xff, 0xff, 0x3a, 0xef, 0xff, 0xff,
-  0x08, 0xef, 0xff, 0xff, 0xd6, 0xee, 0xff, 0xff, 0xa3, 0xee, 0xff, 0xff,
-  0x71, 0xee, 0xff, 0xff, 0x3f, 0xee, 0xff, 0xff, 0x0d, 0xee, 0xff, 0xff,
-  0xdb, 0xed, 0xff, 0xff, 0xa9, 0xed, 0xff, 0xff, 0x77, 0xed, 0xff, 0xff,
-  0x44, 0xed, 0xff, 0xff, 0x12, 0xed, 0xff, 0xff, 0xe0, 0xec, 0xff, 0xff,
-  0xae, 0xec, 0xff, 0xff, 0x7c, 0xec, 0xff, 0xff, 0x4a, 0xec, 0xff, 0xff,
-  0x18, 0xec, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xb3, 0xeb, 0xff, 0xff,
-  0x81, 0xeb, 0xff, 0xff, 0x4f, 0xeb, 0xff, 0xff, 0x1d, 0xeb, 0xff, 0xff,
-  0xeb, 0xea, 0xff, 0xff, 0xb9, 0xea, 0xff, 0xff, 0x87, 0xea, 0xff, 0xff,
-  0x55, 0xea, 0xff, 0xff, 0x23, 0xea, 0xff, 0xff, 0xf1, 0xe9, 0xff, 0xff,
-  0xbf, 0xe9, 0xff, 0xff, 0x8c, 0xe9, 0xff, 0xff, 0x5a, 0xe9, 0xff, 0xff,
-  0x28, 0xe9, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xc4, 0xe8, 0xff, 0xff,
-  0x92, 0xe8, 0xff, 0xff, 0x60, 0xe8, 0xff, 0xff, 0x2e, 0xe8, 0xff, 0xff,
-  0xfc, 0xe7, 0xff, 0xff, 0xca, 0xe7, 0xff, 0xff, 0x98, 0xe7, 0xff, 0xff,
-  0x66, 0xe7, 0xff, 0xff, 0x34, 0xe7, 0xff, 0xff, 0x02, 0xe7, 0xff, 0xff,
-  0xd0, 0xe6, 0xff, 0xff, 0x9e, 0xe6, 0xff, 0xff, 0x6c, 0xe6, 0xff, 0xff,
-  0x3a, 0xe6, 0xff, 0xff, 0x08, 0xe6, 0xff, 0xff, 0xd6, 0xe5, 0xff, 0xff,
-  0xa4, 0xe5, 0xff, 0xff, 0x72, 0xe5, 0xff, 0xff, 0x40, 0xe5, 0xff, 0xff,
-  0x0e, 0xe5, 0xff, 0xff, 0xdc, 0xe4, 0xff, 0xff, 0xaa, 0xe4, 0xff, 0xff,
-  0x78, 0xe4, 0xff, 0xff, 0x46, 0xe4, 0xff, 0xff, 0x14, 0xe4, 0xff, 0xff,
-  0xe2, 0xe3, 0xff, 0xff, 0xb0, 0xe3, 0xff, 0xff, 0x7e, 0xe3, 0xff, 0xff,
-  0x4c, 0xe3, 0xff, 0xff, 0x1a, 0xe3, 0xff, 0xff, 0xe8, 0xe2, 0xff, 0xff,
-  0xb6, 0xe2, 0xff, 0xff, 0x84, 0xe2, 0xff, 0xff, 0x52, 0xe2, 0xff, 0xff,
-  0x20, 0xe2, 0xff, 0xff, 0xef, 0xe1, 0xff, 0xff, 0xbd, 0xe1, 0xff, 0xff,
-  0x8b, 0xe1, 0xff, 0xff, 0x59, 0xe1, 0xff, 0xff, 0x27, 0xe1, 0xff, 0xff,
-  0xf5, 0xe0, 0xff, 0xff, 0xc3, 0xe0, 0xff, 0xff, 0x91, 0xe0, 0xff, 0xff,
-  0x5f, 0xe0, 0xff, 0xff, 0x2d, 0xe0, 0xff, 0xff, 0xfc, 0xdf, 0xff, 0xff,
-  0xca, 0xdf, 0xff, 0xff, 0x98, 0xdf, 0xff, 0xff, 0x66, 0xdf, 0xff, 0xff,
-  0x34, 0xdf, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xd0, 0xde, 0xff, 0xff,
-  0x9f, 0xde, 0xff, 0xff, 0x6d, 0xde, 0xff, 0xff, 0x3b, 0xde, 0xff, 0xff,
-  0x09, 0xde, 0xff, 0xff, 0xd7, 0xdd, 0xff, 0xff, 0xa6, 0xdd, 0xff, 0xff,
-  0x74, 0xdd, 0xff, 0xff, 0x42, 0xdd, 0xff, 0xff, 0x10, 0xdd, 0xff, 0xff,
-  0xde, 0xdc, 0xff, 0xff, 0xad, 0xdc, 0xff, 0xff, 0x7b, 0xdc, 0xff, 0xff,
-  0x49, 0xdc, 0xff, 0xff, 0x17, 0xdc, 0xff, 0xff, 0xe5, 0xdb, 0xff, 0xff,
-  0xb4, 0xdb, 0xff, 0xff, 0x82, 0xdb, 0xff, 0xff, 0x50, 0xdb, 0xff, 0xff,
-  0x1e, 0xdb, 0xff, 0xff, 0xed, 0xda, 0xff, 0xff, 0xbb, 0xda, 0xff, 0xff,
-  0x89, 0xda, 0xff, 0xff, 0x58, 0xda, 0xff, 0xff, 0x26, 0xda, 0xff, 0xff,
-  0xf4, 0xd9, 0xff, 0xff, 0xc2, 0xd9, 0xff, 0xff, 0x91, 0xd9, 0xff, 0xff,
-  0x5f, 0xd9, 0xff, 0xff, 0x2d, 0xd9, 0xff, 0xff, 0xfc, 0xd8, 0xff, 0xff,
-  0xca, 0xd8, 0xff, 0xff, 0x98, 0xd8, 0xff, 0xff, 0x67, 0xd8, 0xff, 0xff,
-  0x35, 0xd8, 0xff, 0xff, 0x03, 0xd8, 0xff, 0xff, 0xd2, 0xd7, 0xff, 0xff,
-  0xa0, 0xd7, 0xff, 0xff, 0x6e, 0xd7, 0xff, 0xff, 0x3d, 0xd7, 0xff, 0xff,
-  0x0b, 0xd7, 0xff, 0xff, 0xda, 0xd6, 0xff, 0xff, 0xa8, 0xd6, 0xff, 0xff,
-  0x76, 0xd6, 0xff, 0xff, 0x45, 0xd6, 0xff, 0xff, 0x13, 0xd6, 0xff, 0xff,
-  0xe2, 0xd5, 0xff, 0xff, 0xb0, 0xd5, 0xff, 0xff, 0x7e, 0xd5, 0xff, 0xff,
-  0x4d, 0xd5, 0xff, 0xff, 0x1b, 0xd5, 0xff, 0xff, 0xea, 0xd4, 0xff, 0xff,
-  0xb8, 0xd4, 0xff, 0xff, 0x87, 0xd4, 0xff, 0xff, 0x55, 0xd4, 0xff, 0xff,
-  0x24, 0xd4, 0xff, 0xff, 0xf2, 0xd3, 0xff, 0xff, 0xc1, 0xd3, 0xff, 0xff,
-  0x8f, 0xd3, 0xff, 0xff, 0x5e, 0xd3, 0xff, 0xff, 0x2c, 0xd3, 0xff, 0xff,
-  0xfb, 0xd2, 0xff, 0xff, 0xc9, 0xd2, 0xff, 0xff, 0x98, 0xd2, 0xff, 0xff,
-  0x66, 0xd2, 0xff, 0xff, 0x35, 0xd2, 0xff, 0xff, 0x03, 0xd2, 0xff, 0xff,
-  0xd2, 0xd1, 0xff, 0xff, 0xa0, 0xd1, 0xff, 0xff, 0x6f, 0xd1, 0xff, 0xff,
-  0x3e, 0xd1, 0xff, 0xff, 0x0c, 0xd1, 0xff, 0xff, 0xdb, 0xd0, 0xff, 0xff,
-  0xa9, 0xd0, 0xff, 0xff, 0x78, 0xd0, 0xff, 0xff, 0x46, 0xd0, 0xff, 0xff,
-  0x15, 0xd0, 0xff, 0xff, 0xe4, 0xcf, 0xff, 0xff, 0xb2, 0xcf, 0xff, 0xff,
-  0x81, 0xcf, 0xff, 0xff, 0x50, 0xcf, 0xff, 0xff, 0x1e, 0xcf, 0xff, 0xff,
-  0xed, 0xce, 0xff, 0xff, 0xbc, 0xce, 0xff, 0xff, 0x8a, 0xce, 0xff, 0xff,
-  0x59, 0xce, 0xff, 0xff, 0x28, 0xce, 0xff, 0xff, 0xf6, 0xcd, 0xff, 0xff,
-  0xc5, 0xcd, 0xff, 0xff, 0x94, 0xcd, 0xff, 0xff, 0x63, 0xcd, 0xff, 0xff,
-  0x31, 0xcd, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0xcf, 0xcc, 0xff, 0xff,
-  0x9e, 0xcc, 0xff, 0xff, 0x6c, 0xcc, 0xff, 0xff, 0x3b, 0xcc, 0xff, 0xff,
-  0x0a, 0xcc, 0xff, 0xff, 0xd9, 0xcb, 0xff, 0xff, 0xa7, 0xcb, 0xff, 0xff,
-  0x76, 0xcb, 0xff, 0xff, 0x45, 0xcb, 0xff, 0xff, 0x14, 0xcb, 0xff, 0xff,
-  0xe3, 0xca, 0xff, 0xff, 0xb1, 0xca, 0xff, 0xff, 0x80, 0xca, 0xff, 0xff,
-  0x4f, 0xca, 0xff, 0xff, 0x1e, 0xca, 0xff, 0xff, 0xed, 0xc9, 0xff, 0xff,
-  0xbc, 0xc9, 0xff, 0xff, 0x8b, 0xc9, 0xff, 0xff, 0x5a, 0xc9, 0xff, 0xff,
-  0x28, 0xc9, 0xff, 0xff, 0xf7, 0xc8, 0xff, 0xff, 0xc6, 0xc8, 0xff, 0xff,
-  0x95, 0xc8, 0xff, 0xff, 0x64, 0xc8, 0xff, 0xff, 0x33, 0xc8, 0xff, 0xff,
-  0x02, 0xc8, 0xff, 0xff, 0xd1, 0xc7, 0xff, 0xff, 0xa0, 0xc7, 0xff, 0xff,
-  0x6f, 0xc7, 0xff, 0xff, 0x3e, 0xc7, 0xff, 0xff, 0x0d, 0xc7, 0xff, 0xff,
-  0xdc, 0xc6, 0xff, 0xff, 0xab, 0xc6, 0xff, 0xff, 0x7a, 0xc6, 0xff, 0xff,
-  0x49, 0xc6, 0xff, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xe7, 0xc5, 0xff, 0xff,
-  0xb6, 0xc5, 0xff, 0xff, 0x85, 0xc5, 0xff, 0xff, 0x54, 0xc5, 0xff, 0xff,
-  0x23, 0xc5, 0xff, 0xff, 0xf2, 0xc4, 0xff, 0xff, 0xc1, 0xc4, 0xff, 0xff,
-  0x91, 0xc4, 0xff, 0xff, 0x60, 0xc4, 0xff, 0xff, 0x2f, 0xc4, 0xff, 0xff,
-  0xfe, 0xc3, 0xff, 0xff, 0xcd, 0xc3, 0xff, 0xff, 0x9c, 0xc3, 0xff, 0xff,
-  0x6b, 0xc3, 0xff, 0xff, 0x3b, 0xc3, 0xff, 0xff, 0x0a, 0xc3, 0xff, 0xff,
-  0xd9, 0xc2, 0xff, 0xff, 0xa8, 0xc2, 0xff, 0xff, 0x77, 0xc2, 0xff, 0xff,
-  0x46, 0xc2, 0xff, 0xff, 0x16, 0xc2, 0xff, 0xff, 0xe5, 0xc1, 0xff, 0xff,
-  0xb4, 0xc1, 0xff, 0xff, 0x83, 0xc1, 0xff, 0xff, 0x53, 0xc1, 0xff, 0xff,
-  0x22, 0xc1, 0xff, 0xff, 0xf1, 0xc0, 0xff, 0xff, 0xc1, 0xc0, 0xff, 0xff,
-  0x90, 0xc0, 0xff, 0xff, 0x5f, 0xc0, 0xff, 0xff, 0x2e, 0xc0, 0xff, 0xff,
-  0xfe, 0xbf, 0xff, 0xff, 0xcd, 0xbf, 0xff, 0xff, 0x9c, 0xbf, 0xff, 0xff,
-  0x6c, 0xbf, 0xff, 0xff, 0x3b, 0xbf, 0xff, 0xff, 0x0b, 0xbf, 0xff, 0xff,
-  0xda, 0xbe, 0xff, 0xff, 0xa9, 0xbe, 0xff, 0xff, 0x79, 0xbe, 0xff, 0xff,
-  0x48, 0xbe, 0xff, 0xff, 0x18, 0xbe, 0xff, 0xff, 0xe7, 0xbd, 0xff, 0xff,
-  0xb6, 0xbd, 0xff, 0xff, 0x86, 0xbd, 0xff, 0xff, 0x55, 0xbd, 0xff, 0xff,
-  0x25, 0xbd, 0xff, 0xff, 0xf4, 0xbc, 0xff, 0xff, 0xc4, 0xbc, 0xff, 0xff,
-  0x93, 0xbc, 0xff, 0xff, 0x63, 0xbc, 0xff, 0xff, 0x32, 0xbc, 0xff, 0xff,
-  0x02, 0xbc, 0xff, 0xff, 0xd1, 0xbb, 0xff, 0xff, 0xa1, 0xbb, 0xff, 0xff,
-  0x71, 0xbb, 0xff, 0xff, 0x40, 0xbb, 0xff, 0xff, 0x10, 0xbb, 0xff, 0xff,
-  0xdf, 0xba, 0xff, 0xff, 0xaf, 0xba, 0xff, 0xff, 0x7f, 0xba, 0xff, 0xff,
-  0x4e, 0xba, 0xff, 0xff, 0x1e, 0xba, 0xff, 0xff, 0xed, 0xb9, 0xff, 0xff,
-  0xbd, 0xb9, 0xff, 0xff, 0x8d, 0xb9, 0xff, 0xff, 0x5c, 0xb9, 0xff, 0xff,
-  0x2c, 0xb9, 0xff, 0xff, 0xfc, 0xb8, 0xff, 0xff, 0xcc, 0xb8, 0xff, 0xff,
-  0x9b, 0xb8, 0xff, 0xff, 0x6b, 0xb8, 0xff, 0xff, 0x3b, 0xb8, 0xff, 0xff,
-  0x0b, 0xb8, 0xff, 0xff, 0xda, 0xb7, 0xff, 0xff, 0xaa, 0xb7, 0xff, 0xff,
-  0x7a, 0xb7, 0xff, 0xff, 0x4a, 0xb7, 0xff, 0xff, 0x19, 0xb7, 0xff, 0xff,
-  0xe9, 0xb6, 0xff, 0xff, 0xb9, 0xb6, 0xff, 0xff, 0x89, 0xb6, 0xff, 0xff,
-  0x59, 0xb6, 0xff, 0xff, 0x29, 0xb6, 0xff, 0xff, 0xf9, 0xb5, 0xff, 0xff,
-  0xc8, 0xb5, 0xff, 0xff, 0x98, 0xb5, 0xff, 0xff, 0x68, 0xb5, 0xff, 0xff,
-  0x38, 0xb5, 0xff, 0xff, 0x08, 0xb5, 0xff, 0xff, 0xd8, 0xb4, 0xff, 0xff,
-  0xa8, 0xb4, 0xff, 0xff, 0x78, 0xb4, 0xff, 0xff, 0x48, 0xb4, 0xff, 0xff,
-  0x18, 0xb4, 0xff, 0xff, 0xe8, 0xb3, 0xff, 0xff, 0xb8, 0xb3, 0xff, 0xff,
-  0x88, 0xb3, 0xff, 0xff, 0x58, 0xb3, 0xff, 0xff, 0x28, 0xb3, 0xff, 0xff,
-  0xf8, 0xb2, 0xff, 0xff, 0xc8, 0xb2, 0xff, 0xff, 0x98, 0xb2, 0xff, 0xff,
-  0x68, 0xb2, 0xff, 0xff, 0x38, 0xb2, 0xff, 0xff, 0x09, 0xb2, 0xff, 0xff,
-  0xd9, 0xb1, 0xff, 0xff, 0xa9, 0xb1, 0xff, 0xff, 0x79, 0xb1, 0xff, 0xff,
-  0x49, 0xb1, 0xff, 0xff, 0x19, 0xb1, 0xff, 0xff, 0xea, 0xb0, 0xff, 0xff,
-  0xba, 0xb0, 0xff, 0xff, 0x8a, 0xb0, 0xff, 0xff, 0x5a, 0xb0, 0xff, 0xff,
-  0x2a, 0xb0, 0xff, 0xff, 0xfb, 0xaf, 0xff, 0xff, 0xcb, 0xaf, 0xff, 0xff,
-  0x9b, 0xaf, 0xff, 0xff, 0x6b, 0xaf, 0xff, 0xff, 0x3c, 0xaf, 0xff, 0xff,
-  0x0c, 0xaf, 0xff, 0xff, 0xdc, 0xae, 0xff, 0xff, 0xad, 0xae, 0xff, 0xff,
-  0x7d, 0xae, 0xff, 0xff, 0x4d, 0xae, 0xff, 0xff, 0x1e, 0xae, 0xff, 0xff,
-  0xee, 0xad, 0xff, 0xff, 0xbf, 0xad, 0xff, 0xff, 0x8f, 0xad, 0xff, 0xff,
-  0x5f, 0xad, 0xff, 0xff, 0x30, 0xad, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff,
-  0xd1, 0xac, 0xff, 0xff, 0xa1, 0xac, 0xff, 0xff, 0x72, 0xac, 0xff, 0xff,
-  0x42, 0xac, 0xff, 0xff, 0x13, 0xac, 0xff, 0xff, 0xe3, 0xab, 0xff, 0xff,
-  0xb4, 0xab, 0xff, 0xff, 0x84, 0xab, 0xff, 0xff, 0x55, 0xab, 0xff, 0xff,
-  0x25, 0xab, 0xff, 0xff, 0xf6, 0xaa, 0xff, 0xff, 0xc7, 0xaa, 0xff, 0xff,
-  0x97, 0xaa, 0xff, 0xff, 0x68, 0xaa, 0xff, 0xff, 0x38, 0xaa, 0xff, 0xff,
-  0x09, 0xaa, 0xff, 0xff, 0xda, 0xa9, 0xff, 0xff, 0xaa, 0xa9, 0xff, 0xff,
-  0x7b, 0xa9, 0xff, 0xff, 0x4c, 0xa9, 0xff, 0xff, 0x1d, 0xa9, 0xff, 0xff,
-  0xed, 0xa8, 0xff, 0xff, 0xbe, 0xa8, 0xff, 0xff, 0x8f, 0xa8, 0xff, 0xff,
-  0x5f, 0xa8, 0xff, 0xff, 0x30, 0xa8, 0xff, 0xff, 0x01, 0xa8, 0xff, 0xff,
-  0xd2, 0xa7, 0xff, 0xff, 0xa3, 0xa7, 0xff, 0xff, 0x74, 0xa7, 0xff, 0xff,
-  0x44, 0xa7, 0xff, 0xff, 0x15, 0xa7, 0xff, 0xff, 0xe6, 0xa6, 0xff, 0xff,
-  0xb7, 0xa6, 0xff, 0xff, 0x88, 0xa6, 0xff, 0xff, 0x59, 0xa6, 0xff, 0xff,
-  0x2a, 0xa6, 0xff, 0xff, 0xfb, 0xa5, 0xff, 0xff, 0xcc, 0xa5, 0xff, 0xff,
-  0x9d, 0xa5, 0xff, 0xff, 0x6e, 0xa5, 0xff, 0xff, 0x3f, 0xa5, 0xff, 0xff,
-  0x10, 0xa5, 0xff, 0xff, 0xe1, 0xa4, 0xff, 0xff, 0xb2, 0xa4, 0xff, 0xff,
-  0x83, 0xa4, 0xff, 0xff, 0x54, 0xa4, 0xff, 0xff, 0x25, 0xa4, 0xff, 0xff,
-  0xf6, 0xa3, 0xff, 0xff, 0xc7, 0xa3, 0xff, 0xff, 0x98, 0xa3, 0xff, 0xff,
-  0x69, 0xa3, 0xff, 0xff, 0x3a, 0xa3, 0xff, 0xff, 0x0c, 0xa3, 0xff, 0xff,
-  0xdd, 0xa2, 0xff, 0xff, 0xae, 0xa2, 0xff, 0xff, 0x7f, 0xa2, 0xff, 0xff,
-  0x50, 0xa2, 0xff, 0xff, 0x22, 0xa2, 0xff, 0xff, 0xf3, 0xa1, 0xff, 0xff,
-  0xc4, 0xa1, 0xff, 0xff, 0x95, 0xa1, 0xff, 0xff, 0x67, 0xa1, 0xff, 0xff,
-  0x38, 0xa1, 0xff, 0xff, 0x09, 0xa1, 0xff, 0xff, 0xdb, 0xa0, 0xff, 0xff,
-  0xac, 0xa0, 0xff, 0xff, 0x7d, 0xa0, 0xff, 0xff, 0x4f, 0xa0, 0xff, 0xff,
-  0x20, 0xa0, 0xff, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0xc3, 0x9f, 0xff, 0xff,
-  0x94, 0x9f, 0xff, 0xff, 0x66, 0x9f, 0xff, 0xff, 0x37, 0x9f, 0xff, 0xff,
-  0x09, 0x9f, 0xff, 0xff, 0xda, 0x9e, 0xff, 0xff, 0xac, 0x9e, 0xff, 0xff,
-  0x7d, 0x9e, 0xff, 0xff, 0x4f, 0x9e, 0xff, 0xff, 0x20, 0x9e, 0xff, 0xff,
-  0xf2, 0x9d, 0xff, 0xff, 0xc3, 0x9d, 0xff, 0xff, 0x95, 0x9d, 0xff, 0xff,
-  0x67, 0x9d, 0xff, 0xff, 0x38, 0x9d, 0xff, 0xff, 0x0a, 0x9d, 0xff, 0xff,
-  0xdb, 0x9c, 0xff, 0xff, 0xad, 0x9c, 0xff, 0xff, 0x7f, 0x9c, 0xff, 0xff,
-  0x50, 0x9c, 0xff, 0xff, 0x22, 0x9c, 0xff, 0xff, 0xf4, 0x9b, 0xff, 0xff,
-  0xc6, 0x9b, 0xff, 0xff, 0x97, 0x9b, 0xff, 0xff, 0x69, 0x9b, 0xff, 0xff,
-  0x3b, 0x9b, 0xff, 0xff, 0x0d, 0x9b, 0xff, 0xff, 0xdf, 0x9a, 0xff, 0xff,
-  0xb0, 0x9a, 0xff, 0xff, 0x82, 0x9a, 0xff, 0xff, 0x54, 0x9a, 0xff, 0xff,
-  0x26, 0x9a, 0xff, 0xff, 0xf8, 0x99, 0xff, 0xff, 0xca, 0x99, 0xff, 0xff,
-  0x9c, 0x99, 0xff, 0xff, 0x6e, 0x99, 0xff, 0xff, 0x40, 0x99, 0xff, 0xff,
-  0x12, 0x99, 0xff, 0xff, 0xe4, 0x98, 0xff, 0xff, 0xb6, 0x98, 0xff, 0xff,
-  0x88, 0x98, 0xff, 0xff, 0x5a, 0x98, 0xff, 0xff, 0x2c, 0x98, 0xff, 0xff,
-  0xfe, 0x97, 0xff, 0xff, 0xd0, 0x97, 0xff, 0xff, 0xa2, 0x97, 0xff, 0xff,
-  0x74, 0x97, 0xff, 0xff, 0x46, 0x97, 0xff, 0xff, 0x18, 0x97, 0xff, 0xff,
-  0xea, 0x96, 0xff, 0xff, 0xbd, 0x96, 0xff, 0xff, 0x8f, 0x96, 0xff, 0xff,
-  0x61, 0x96, 0xff, 0xff, 0x33, 0x96, 0xff, 0xff, 0x05, 0x96, 0xff, 0xff,
-  0xd8, 0x95, 0xff, 0xff, 0xaa, 0x95, 0xff, 0xff, 0x7c, 0x95, 0xff, 0xff,
-  0x4f, 0x95, 0xff, 0xff, 0x21, 0x95, 0xff, 0xff, 0xf3, 0x94, 0xff, 0xff,
-  0xc6, 0x94, 0xff, 0xff, 0x98, 0x94, 0xff, 0xff, 0x6a, 0x94, 0xff, 0xff,
-  0x3d, 0x94, 0xff, 0xff, 0x0f, 0x94, 0xff, 0xff, 0xe2, 0x93, 0xff, 0xff,
-  0xb4, 0x93, 0xff, 0xff, 0x86, 0x93, 0xff, 0xff, 0x59, 0x93, 0xff, 0xff,
-  0x2b, 0x93, 0xff, 0xff, 0xfe, 0x92, 0xff, 0xff, 0xd0, 0x92, 0xff, 0xff,
-  0xa3, 0x92, 0xff, 0xff, 0x76, 0x92, 0xff, 0xff, 0x48, 0x92, 0xff, 0xff,
-  0x1b, 0x92, 0xff, 0xff, 0xed, 0x91, 0xff, 0xff, 0xc0, 0x91, 0xff, 0xff,
-  0x93, 0x91, 0xff, 0xff, 0x65, 0x91, 0xff, 0xff, 0x38, 0x91, 0xff, 0xff,
-  0x0b, 0x91, 0xff, 0xff, 0xdd, 0x90, 0xff, 0xff, 0xb0, 0x90, 0xff, 0xff,
-  0x83, 0x90, 0xff, 0xff, 0x56, 0x90, 0xff, 0xff, 0x28, 0x90, 0xff, 0xff,
-  0xfb, 0x8f, 0xff, 0xff, 0xce, 0x8f, 0xff, 0xff, 0xa1, 0x8f, 0xff, 0xff,
-  0x74, 0x8f, 0xff, 0xff, 0x46, 0x8f, 0xff, 0xff, 0x19, 0x8f, 0xff, 0xff,
-  0xec, 0x8e, 0xff, 0xff, 0xbf, 0x8e, 0xff, 0xff, 0x92, 0x8e, 0xff, 0xff,
-  0x65, 0x8e, 0xff, 0xff, 0x38, 0x8e, 0xff, 0xff, 0x0b, 0x8e, 0xff, 0xff,
-  0xde, 0x8d, 0xff, 0xff, 0xb1, 0x8d, 0xff, 0xff, 0x84, 0x8d, 0xff, 0xff,
-  0x57, 0x8d, 0xff, 0xff, 0x2a, 0x8d, 0xff, 0xff, 0xfd, 0x8c, 0xff, 0xff,
-  0xd0, 0x8c, 0xff, 0xff, 0xa3, 0x8c, 0xff, 0xff, 0x77, 0x8c, 0xff, 0xff,
-  0x4a, 0x8c, 0xff, 0xff, 0x1d, 0x8c, 0xff, 0xff, 0xf0, 0x8b, 0xff, 0xff,
-  0xc3, 0x8b, 0xff, 0xff, 0x97, 0x8b, 0xff, 0xff, 0x6a, 0x8b, 0xff, 0xff,
-  0x3d, 0x8b, 0xff, 0xff, 0x10, 0x8b, 0xff, 0xff, 0xe4, 0x8a, 0xff, 0xff,
-  0xb7, 0x8a, 0xff, 0xff, 0x8a, 0x8a, 0xff, 0xff, 0x5e, 0x8a, 0xff, 0xff,
-  0x31, 0x8a, 0xff, 0xff, 0x04, 0x8a, 0xff, 0xff, 0xd8, 0x89, 0xff, 0xff,
-  0xab, 0x89, 0xff, 0xff, 0x7f, 0x89, 0xff, 0xff, 0x52, 0x89, 0xff, 0xff,
-  0x26, 0x89, 0xff, 0xff, 0xf9, 0x88, 0xff, 0xff, 0xcd, 0x88, 0xff, 0xff,
-  0xa0, 0x88, 0xff, 0xff, 0x74, 0x88, 0xff, 0xff, 0x47, 0x88, 0xff, 0xff,
-  0x1b, 0x88, 0xff, 0xff, 0xee, 0x87, 0xff, 0xff, 0xc2, 0x87, 0xff, 0xff,
-  0x96, 0x87, 0xff, 0xff, 0x69, 0x87, 0xff, 0xff, 0x3d, 0x87, 0xff, 0xff,
-  0x11, 0x87, 0xff, 0xff, 0xe4, 0x86, 0xff, 0xff, 0xb8, 0x86, 0xff, 0xff,
-  0x8c, 0x86, 0xff, 0xff, 0x60, 0x86, 0xff, 0xff, 0x33, 0x86, 0xff, 0xff,
-  0x07, 0x86, 0xff, 0xff, 0xdb, 0x85, 0xff, 0xff, 0xaf, 0x85, 0xff, 0xff,
-  0x83, 0x85, 0xff, 0xff, 0x56, 0x85, 0xff, 0xff, 0x2a, 0x85, 0xff, 0xff,
-  0xfe, 0x84, 0xff, 0xff, 0xd2, 0x84, 0xff, 0xff, 0xa6, 0x84, 0xff, 0xff,
-  0x7a, 0x84, 0xff, 0xff, 0x4e, 0x84, 0xff, 0xff, 0x22, 0x84, 0xff, 0xff,
-  0xf6, 0x83, 0xff, 0xff, 0xca, 0x83, 0xff, 0xff, 0x9e, 0x83, 0xff, 0xff,
-  0x72, 0x83, 0xff, 0xff, 0x46, 0x83, 0xff, 0xff, 0x1a, 0x83, 0xff, 0xff,
-  0xef, 0x82, 0xff, 0xff, 0xc3, 0x82, 0xff, 0xff, 0x97, 0x82, 0xff, 0xff,
-  0x6b, 0x82, 0xff, 0xff, 0x3f, 0x82, 0xff, 0xff, 0x14, 0x82, 0xff, 0xff,
-  0xe8, 0x81, 0xff, 0xff, 0xbc, 0x81, 0xff, 0xff, 0x90, 0x81, 0xff, 0xff,
-  0x65, 0x81, 0xff, 0xff, 0x39, 0x81, 0xff, 0xff, 0x0d, 0x81, 0xff, 0xff,
-  0xe2, 0x80, 0xff, 0xff, 0xb6, 0x80, 0xff, 0xff, 0x8a, 0x80, 0xff, 0xff,
-  0x5f, 0x80, 0xff, 0xff, 0x33, 0x80, 0xff, 0xff, 0x08, 0x80, 0xff, 0xff,
-  0xdc, 0x7f, 0xff, 0xff, 0xb1, 0x7f, 0xff, 0xff, 0x85, 0x7f, 0xff, 0xff,
-  0x5a, 0x7f, 0xff, 0xff, 0x2e, 0x7f, 0xff, 0xff, 0x03, 0x7f, 0xff, 0xff,
-  0xd7, 0x7e, 0xff, 0xff, 0xac, 0x7e, 0xff, 0xff, 0x81, 0x7e, 0xff, 0xff,
-  0x55, 0x7e, 0xff, 0xff, 0x2a, 0x7e, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff,
-  0xd3, 0x7d, 0xff, 0xff, 0xa8, 0x7d, 0xff, 0xff, 0x7d, 0x7d, 0xff, 0xff,
-  0x52, 0x7d, 0xff, 0xff, 0x26, 0x7d, 0xff, 0xff, 0xfb, 0x7c, 0xff, 0xff,
-  0xd0, 0x7c, 0xff, 0xff, 0xa5, 0x7c, 0xff, 0xff, 0x7a, 0x7c, 0xff, 0xff,
-  0x4f, 0x7c, 0xff, 0xff, 0x24, 0x7c, 0xff, 0xff, 0xf9, 0x7b, 0xff, 0xff,
-  0xcd, 0x7b, 0xff, 0xff, 0xa2, 0x7b, 0xff, 0xff, 0x77, 0x7b, 0xff, 0xff,
-  0x4c, 0x7b, 0xff, 0xff, 0x21, 0x7b, 0xff, 0xff, 0xf7, 0x7a, 0xff, 0xff,
-  0xcc, 0x7a, 0xff, 0xff, 0xa1, 0x7a, 0xff, 0xff, 0x76, 0x7a, 0xff, 0xff,
-  0x4b, 0x7a, 0xff, 0xff, 0x20, 0x7a, 0xff, 0xff, 0xf5, 0x79, 0xff, 0xff,
-  0xca, 0x79, 0xff, 0xff, 0xa0, 0x79, 0xff, 0xff, 0x75, 0x79, 0xff, 0xff,
-  0x4a, 0x79, 0xff, 0xff, 0x1f, 0x79, 0xff, 0xff, 0xf5, 0x78, 0xff, 0xff,
-  0xca, 0x78, 0xff, 0xff, 0x9f, 0x78, 0xff, 0xff, 0x75, 0x78, 0xff, 0xff,
-  0x4a, 0x78, 0xff, 0xff, 0x1f, 0x78, 0xff, 0xff, 0xf5, 0x77, 0xff, 0xff,
-  0xca, 0x77, 0xff, 0xff, 0xa0, 0x77, 0xff, 0xff, 0x75, 0x77, 0xff, 0xff,
-  0x4b, 0x77, 0xff, 0xff, 0x20, 0x77, 0xff, 0xff, 0xf6, 0x76, 0xff, 0xff,
-  0xcb, 0x76, 0xff, 0xff, 0xa1, 0x76, 0xff, 0xff, 0x76, 0x76, 0xff, 0xff,
-  0x4c, 0x76, 0xff, 0xff, 0x22, 0x76, 0xff, 0xff, 0xf7, 0x75, 0xff, 0xff,
-  0xcd, 0x75, 0xff, 0xff, 0xa3, 0x75, 0xff, 0xff, 0x78, 0x75, 0xff, 0xff,
-  0x4e, 0x75, 0xff, 0xff, 0x24, 0x75, 0xff, 0xff, 0xfa, 0x74, 0xff, 0xff,
-  0xcf, 0x74, 0xff, 0xff, 0xa5, 0x74, 0xff, 0xff, 0x7b, 0x74, 0xff, 0xff,
-  0x51, 0x74, 0xff, 0xff, 0x27, 0x74, 0xff, 0xff, 0xfd, 0x73, 0xff, 0xff,
-  0xd3, 0x73, 0xff, 0xff, 0xa9, 0x73, 0xff, 0xff, 0x7f, 0x73, 0xff, 0xff,
-  0x55, 0x73, 0xff, 0xff, 0x2b, 0x73, 0xff, 0xff, 0x01, 0x73, 0xff, 0xff,
-  0xd7, 0x72, 0xff, 0xff, 0xad, 0x72, 0xff, 0xff, 0x83, 0x72, 0xff, 0xff,
-  0x59, 0x72, 0xff, 0xff, 0x2f, 0x72, 0xff, 0xff, 0x05, 0x72, 0xff, 0xff,
-  0xdc, 0x71, 0xff, 0xff, 0xb2, 0x71, 0xff, 0xff, 0x88, 0x71, 0xff, 0xff,
-  0x5e, 0x71, 0xff, 0xff, 0x35, 0x71, 0xff, 0xff, 0x0b, 0x71, 0xff, 0xff,
-  0xe1, 0x70, 0xff, 0xff, 0xb7, 0x70, 0xff, 0xff, 0x8e, 0x70, 0xff, 0xff,
-  0x64, 0x70, 0xff, 0xff, 0x3b, 0x70, 0xff, 0xff, 0x11, 0x70, 0xff, 0xff,
-  0xe7, 0x6f, 0xff, 0xff, 0xbe, 0x6f, 0xff, 0xff, 0x94, 0x6f, 0xff, 0xff,
-  0x6b, 0x6f, 0xff, 0xff, 0x41, 0x6f, 0xff, 0xff, 0x18, 0x6f, 0xff, 0xff,
-  0xef, 0x6e, 0xff, 0xff, 0xc5, 0x6e, 0xff, 0xff, 0x9c, 0x6e, 0xff, 0xff,
-  0x72, 0x6e, 0xff, 0xff, 0x49, 0x6e, 0xff, 0xff, 0x20, 0x6e, 0xff, 0xff,
-  0xf6, 0x6d, 0xff, 0xff, 0xcd, 0x6d, 0xff, 0xff, 0xa4, 0x6d, 0xff, 0xff,
-  0x7b, 0x6d, 0xff, 0xff, 0x51, 0x6d, 0xff, 0xff, 0x28, 0x6d, 0xff, 0xff,
-  0xff, 0x6c, 0xff, 0xff, 0xd6, 0x6c, 0xff, 0xff, 0xad, 0x6c, 0xff, 0xff,
-  0x84, 0x6c, 0xff, 0xff, 0x5b, 0x6c, 0xff, 0xff, 0x32, 0x6c, 0xff, 0xff,
-  0x09, 0x6c, 0xff, 0xff, 0xe0, 0x6b, 0xff, 0xff, 0xb7, 0x6b, 0xff, 0xff,
-  0x8e, 0x6b, 0xff, 0xff, 0x65, 0x6b, 0xff, 0xff, 0x3c, 0x6b, 0xff, 0xff,
-  0x13, 0x6b, 0xff, 0xff, 0xea, 0x6a, 0xff, 0xff, 0xc1, 0x6a, 0xff, 0xff,
-  0x98, 0x6a, 0xff, 0xff, 0x70, 0x6a, 0xff, 0xff, 0x47, 0x6a, 0xff, 0xff,
-  0x1e, 0x6a, 0xff, 0xff, 0xf5, 0x69, 0xff, 0xff, 0xcd, 0x69, 0xff, 0xff,
-  0xa4, 0x69, 0xff, 0xff, 0x7b, 0x69, 0xff, 0xff, 0x53, 0x69, 0xff, 0xff,
-  0x2a, 0x69, 0xff, 0xff, 0x01, 0x69, 0xff, 0xff, 0xd9, 0x68, 0xff, 0xff,
-  0xb0, 0x68, 0xff, 0xff, 0x88, 0x68, 0xff, 0xff, 0x5f, 0x68, 0xff, 0xff,
-  0x37, 0x68, 0xff, 0xff, 0x0e, 0x68, 0xff, 0xff, 0xe6, 0x67, 0xff, 0xff,
-  0xbd, 0x67, 0xff, 0xff, 0x95, 0x67, 0xff, 0xff, 0x6d, 0x67, 0xff, 0xff,
-  0x44, 0x67, 0xff, 0xff, 0x1c, 0x67, 0xff, 0xff, 0xf4, 0x66, 0xff, 0xff,
-  0xcb, 0x66, 0xff, 0xff, 0xa3, 0x66, 0xff, 0xff, 0x7b, 0x66, 0xff, 0xff,
-  0x53, 0x66, 0xff, 0xff, 0x2a, 0x66, 0xff, 0xff, 0x02, 0x66, 0xff, 0xff,
-  0xda, 0x65, 0xff, 0xff, 0xb2, 0x65, 0xff, 0xff, 0x8a, 0x65, 0xff, 0xff,
-  0x62, 0x65, 0xff, 0xff, 0x3a, 0x65, 0xff, 0xff, 0x12, 0x65, 0xff, 0xff,
-  0xea, 0x64, 0xff, 0xff, 0xc2, 0x64, 0xff, 0xff, 0x9a, 0x64, 0xff, 0xff,
-  0x72, 0x64, 0xff, 0xff, 0x4a, 0x64, 0xff, 0xff, 0x22, 0x64, 0xff, 0xff,
-  0xfa, 0x63, 0xff, 0xff, 0xd2, 0x63, 0xff, 0xff, 0xab, 0x63, 0xff, 0xff,
-  0x83, 0x63, 0xff, 0xff, 0x5b, 0x63, 0xff, 0xff, 0x33, 0x63, 0xff, 0xff,
-  0x0c, 0x63, 0xff, 0xff, 0xe4, 0x62, 0xff, 0xff, 0xbc, 0x62, 0xff, 0xff,
-  0x95, 0x62, 0xff, 0xff, 0x6d, 0x62, 0xff, 0xff, 0x45, 0x62, 0xff, 0xff,
-  0x1e, 0x62, 0xff, 0xff, 0xf6, 0x61, 0xff, 0xff, 0xcf, 0x61, 0xff, 0xff,
-  0xa7, 0x61, 0xff, 0xff, 0x80, 0x61, 0xff, 0xff, 0x58, 0x61, 0xff, 0xff,
-  0x31, 0x61, 0xff, 0xff, 0x09, 0x61, 0xff, 0xff, 0xe2, 0x60, 0xff, 0xff,
-  0xbb, 0x60, 0xff, 0xff, 0x93, 0x60, 0xff, 0xff, 0x6c, 0x60, 0xff, 0xff,
-  0x45, 0x60, 0xff, 0xff, 0x1d, 0x60, 0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff,
-  0xcf, 0x5f, 0xff, 0xff, 0xa8, 0x5f, 0xff, 0xff, 0x81, 0x5f, 0xff, 0xff,
-  0x59, 0x5f, 0xff, 0xff, 0x32, 0x5f, 0xff, 0xff, 0x0b, 0x5f, 0xff, 0xff,
-  0xe4, 0x5e, 0xff, 0xff, 0xbd, 0x5e, 0xff, 0xff, 0x96, 0x5e, 0xff, 0xff,
-  0x6f, 0x5e, 0xff, 0xff, 0x48, 0x5e, 0xff, 0xff, 0x21, 0x5e, 0xff, 0xff,
-  0xfa, 0x5d, 0xff, 0xff, 0xd3, 0x5d, 0xff, 0xff, 0xac, 0x5d, 0xff, 0xff,
-  0x85, 0x5d, 0xff, 0xff, 0x5f, 0x5d, 0xff, 0xff, 0x38, 0x5d, 0xff, 0xff,
-  0x11, 0x5d, 0xff, 0xff, 0xea, 0x5c, 0xff, 0xff, 0xc4, 0x5c, 0xff, 0xff,
-  0x9d, 0x5c, 0xff, 0xff, 0x76, 0x5c, 0xff, 0xff, 0x50, 0x5c, 0xff, 0xff,
-  0x29, 0x5c, 0xff, 0xff, 0x02, 0x5c, 0xff, 0xff, 0xdc, 0x5b, 0xff, 0xff,
-  0xb5, 0x5b, 0xff, 0xff, 0x8f, 0x5b, 0xff, 0xff, 0x68, 0x5b, 0xff, 0xff,
-  0x42, 0x5b, 0xff, 0xff, 0x1b, 0x5b, 0xff, 0xff, 0xf5, 0x5a, 0xff, 0xff,
-  0xce, 0x5a, 0xff, 0xff, 0xa8, 0x5a, 0xff, 0xff, 0x82, 0x5a, 0xff, 0xff,
-  0x5b, 0x5a, 0xff, 0xff, 0x35, 0x5a, 0xff, 0xff, 0x0f, 0x5a, 0xff, 0xff,
-  0xe8, 0x59, 0xff, 0xff, 0xc2, 0x59, 0xff, 0xff, 0x9c, 0x59, 0xff, 0xff,
-  0x76, 0x59, 0xff, 0xff, 0x50, 0x59, 0xff, 0xff, 0x29, 0x59, 0xff, 0xff,
-  0x03, 0x59, 0xff, 0xff, 0xdd, 0x58, 0xff, 0xff, 0xb7, 0x58, 0xff, 0xff,
-  0x91, 0x58, 0xff, 0xff, 0x6b, 0x58, 0xff, 0xff, 0x45, 0x58, 0xff, 0xff,
-  0x1f, 0x58, 0xff, 0xff, 0xf9, 0x57, 0xff, 0xff, 0xd3, 0x57, 0xff, 0xff,
-  0xad, 0x57, 0xff, 0xff, 0x88, 0x57, 0xff, 0xff, 0x62, 0x57, 0xff, 0xff,
-  0x3c, 0x57, 0xff, 0xff, 0x16, 0x57, 0xff, 0xff, 0xf0, 0x56, 0xff, 0xff,
-  0xcb, 0x56, 0xff, 0xff, 0xa5, 0x56, 0xff, 0xff, 0x7f, 0x56, 0xff, 0xff,
-  0x5a, 0x56, 0xff, 0xff, 0x34, 0x56, 0xff, 0xff, 0x0e, 0x56, 0xff, 0xff,
-  0xe9, 0x55, 0xff, 0xff, 0xc3, 0x55, 0xff, 0xff, 0x9e, 0x55, 0xff, 0xff,
-  0x78, 0x55, 0xff, 0xff, 0x53, 0x55, 0xff, 0xff, 0x2d, 0x55, 0xff, 0xff,
-  0x08, 0x55, 0xff, 0xff, 0xe2, 0x54, 0xff, 0xff, 0xbd, 0x54, 0xff, 0xff,
-  0x98, 0x54, 0xff, 0xff, 0x72, 0x54, 0xff, 0xff, 0x4d, 0x54, 0xff, 0xff,
-  0x28, 0x54, 0xff, 0xff, 0x03, 0x54, 0xff, 0xff, 0xdd, 0x53, 0xff, 0xff,
-  0xb8, 0x53, 0xff, 0xff, 0x93, 0x53, 0xff, 0xff, 0x6e, 0x53, 0xff, 0xff,
-  0x49, 0x53, 0xff, 0xff, 0x24, 0x53, 0xff, 0xff, 0xff, 0x52, 0xff, 0xff,
-  0xda, 0x52, 0xff, 0xff, 0xb5, 0x52, 0xff, 0xff, 0x90, 0x52, 0xff, 0xff,
-  0x6b, 0x52, 0xff, 0xff, 0x46, 0x52, 0xff, 0xff, 0x21, 0x52, 0xff, 0xff,
-  0xfc, 0x51, 0xff, 0xff, 0xd7, 0x51, 0xff, 0xff, 0xb2, 0x51, 0xff, 0xff,
-  0x8d, 0x51, 0xff, 0xff, 0x69, 0x51, 0xff, 0xff, 0x44, 0x51, 0xff, 0xff,
-  0x1f, 0x51, 0xff, 0xff, 0xfa, 0x50, 0xff, 0xff, 0xd6, 0x50, 0xff, 0xff,
-  0xb1, 0x50, 0xff, 0xff, 0x8d, 0x50, 0xff, 0xff, 0x68, 0x50, 0xff, 0xff,
-  0x43, 0x50, 0xff, 0xff, 0x1f, 0x50, 0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff,
-  0xd6, 0x4f, 0xff, 0xff, 0xb1, 0x4f, 0xff, 0xff, 0x8d, 0x4f, 0xff, 0xff,
-  0x69, 0x4f, 0xff, 0xff, 0x44, 0x4f, 0xff, 0xff, 0x20, 0x4f, 0xff, 0xff,
-  0xfc, 0x4e, 0xff, 0xff, 0xd7, 0x4e, 0xff, 0xff, 0xb3, 0x4e, 0xff, 0xff,
-  0x8f, 0x4e, 0xff, 0xff, 0x6a, 0x4e, 0xff, 0xff, 0x46, 0x4e, 0xff, 0xff,
-  0x22, 0x4e, 0xff, 0xff, 0xfe, 0x4d, 0xff, 0xff, 0xda, 0x4d, 0xff, 0xff,
-  0xb6, 0x4d, 0xff, 0xff, 0x92, 0x4d, 0xff, 0xff, 0x6e, 0x4d, 0xff, 0xff,
-  0x4a, 0x4d, 0xff, 0xff, 0x26, 0x4d, 0xff, 0xff, 0x02, 0x4d, 0xff, 0xff,
-  0xde, 0x4c, 0xff, 0xff, 0xba, 0x4c, 0xff, 0xff, 0x96, 0x4c, 0xff, 0xff,
-  0x72, 0x4c, 0xff, 0xff, 0x4e, 0x4c, 0xff, 0xff, 0x2b, 0x4c, 0xff, 0xff,
-  0x07, 0x4c, 0xff, 0xff, 0xe3, 0x4b, 0xff, 0xff, 0xbf, 0x4b, 0xff, 0xff,
-  0x9c, 0x4b, 0xff, 0xff, 0x78, 0x4b, 0xff, 0xff, 0x54, 0x4b, 0xff, 0xff,
-  0x31, 0x4b, 0xff, 0xff, 0x0d, 0x4b, 0xff, 0xff, 0xea, 0x4a, 0xff, 0xff,
-  0xc6, 0x4a, 0xff, 0xff, 0xa3, 0x4a, 0xff, 0xff, 0x7f, 0x4a, 0xff, 0xff,
-  0x5c, 0x4a, 0xff, 0xff, 0x38, 0x4a, 0xff, 0xff, 0x15, 0x4a, 0xff, 0xff,
-  0xf2, 0x49, 0xff, 0xff, 0xce, 0x49, 0xff, 0xff, 0xab, 0x49, 0xff, 0xff,
-  0x88, 0x49, 0xff, 0xff, 0x65, 0x49, 0xff, 0xff, 0x41, 0x49, 0xff, 0xff,
-  0x1e, 0x49, 0xff, 0xff, 0xfb, 0x48, 0xff, 0xff, 0xd8, 0x48, 0xff, 0xff,
-  0xb5, 0x48, 0xff, 0xff, 0x92, 0x48, 0xff, 0xff, 0x6f, 0x48, 0xff, 0xff,
-  0x4c, 0x48, 0xff, 0xff, 0x29, 0x48, 0xff, 0xff, 0x06, 0x48, 0xff, 0xff,
-  0xe3, 0x47, 0xff, 0xff, 0xc0, 0x47, 0xff, 0xff, 0x9d, 0x47, 0xff, 0xff,
-  0x7a, 0x47, 0xff, 0xff, 0x57, 0x47, 0xff, 0xff, 0x34, 0x47, 0xff, 0xff,
-  0x12, 0x47, 0xff, 0xff, 0xef, 0x46, 0xff, 0xff, 0xcc, 0x46, 0xff, 0xff,
-  0xaa, 0x46, 0xff, 0xff, 0x87, 0x46, 0xff, 0xff, 0x64, 0x46, 0xff, 0xff,
-  0x42, 0x46, 0xff, 0xff, 0x1f, 0x46, 0xff, 0xff, 0xfd, 0x45, 0xff, 0xff,
-  0xda, 0x45, 0xff, 0xff, 0xb8, 0x45, 0xff, 0xff, 0x95, 0x45, 0xff, 0xff,
-  0x73, 0x45, 0xff, 0xff, 0x50, 0x45, 0xff, 0xff, 0x2e, 0x45, 0xff, 0xff,
-  0x0c, 0x45, 0xff, 0xff, 0xe9, 0x44, 0xff, 0xff, 0xc7, 0x44, 0xff, 0xff,
-  0xa5, 0x44, 0xff, 0xff, 0x82, 0x44, 0xff, 0xff, 0x60, 0x44, 0xff, 0xff,
-  0x3e, 0x44, 0xff, 0xff, 0x1c, 0x44, 0xff, 0xff, 0xfa, 0x43, 0xff, 0xff,
-  0xd8, 0x43, 0xff, 0xff, 0xb6, 0x43, 0xff, 0xff, 0x94, 0x43, 0xff, 0xff,
-  0x71, 0x43, 0xff, 0xff, 0x50, 0x43, 0xff, 0xff, 0x2e, 0x43, 0xff, 0xff,
-  0x0c, 0x43, 0xff, 0xff, 0xea, 0x42, 0xff, 0xff, 0xc8, 0x42, 0xff, 0xff,
-  0xa6, 0x42, 0xff, 0xff, 0x84, 0x42, 0xff, 0xff, 0x62, 0x42, 0xff, 0xff,
-  0x41, 0x42, 0xff, 0xff, 0x1f, 0x42, 0xff, 0xff, 0xfd, 0x41, 0xff, 0xff,
-  0xdc, 0x41, 0xff, 0xff, 0xba, 0x41, 0xff, 0xff, 0x98, 0x41, 0xff, 0xff,
-  0x77, 0x41, 0xff, 0xff, 0x55, 0x41, 0xff, 0xff, 0x34, 0x41, 0xff, 0xff,
-  0x12, 0x41, 0xff, 0xff, 0xf1, 0x40, 0xff, 0xff, 0xcf, 0x40, 0xff, 0xff,
-  0xae, 0x40, 0xff, 0xff, 0x8c, 0x40, 0xff, 0xff, 0x6b, 0x40, 0xff, 0xff,
-  0x4a, 0x40, 0xff, 0xff, 0x28, 0x40, 0xff, 0xff, 0x07, 0x40, 0xff, 0xff,
-  0xe6, 0x3f, 0xff, 0xff, 0xc5, 0x3f, 0xff, 0xff, 0xa4, 0x3f, 0xff, 0xff,
-  0x82, 0x3f, 0xff, 0xff, 0x61, 0x3f, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xff,
-  0x1f, 0x3f, 0xff, 0xff, 0xfe, 0x3e, 0xff, 0xff, 0xdd, 0x3e, 0xff, 0xff,
-  0xbc, 0x3e, 0xff, 0xff, 0x9b, 0x3e, 0xff, 0xff, 0x7a, 0x3e, 0xff, 0xff,
-  0x59, 0x3e, 0xff, 0xff, 0x38, 0x3e, 0xff, 0xff, 0x18, 0x3e, 0xff, 0xff,
-  0xf7, 0x3d, 0xff, 0xff, 0xd6, 0x3d, 0xff, 0xff, 0xb5, 0x3d, 0xff, 0xff,
-  0x95, 0x3d, 0xff, 0xff, 0x74, 0x3d, 0xff, 0xff, 0x53, 0x3d, 0xff, 0xff,
-  0x33, 0x3d, 0xff, 0xff, 0x12, 0x3d, 0xff, 0xff, 0xf1, 0x3c, 0xff, 0xff,
-  0xd1, 0x3c, 0xff, 0xff, 0xb0, 0x3c, 0xff, 0xff, 0x90, 0x3c, 0xff, 0xff,
-  0x6f, 0x3c, 0xff, 0xff, 0x4f, 0x3c, 0xff, 0xff, 0x2f, 0x3c, 0xff, 0xff,
-  0x0e, 0x3c, 0xff, 0xff, 0xee, 0x3b, 0xff, 0xff, 0xce, 0x3b, 0xff, 0xff,
-  0xad, 0x3b, 0xff, 0xff, 0x8d, 0x3b, 0xff, 0xff, 0x6d, 0x3b, 0xff, 0xff,
-  0x4d, 0x3b, 0xff, 0xff, 0x2d, 0x3b, 0xff, 0xff, 0x0c, 0x3b, 0xff, 0xff,
-  0xec, 0x3a, 0xff, 0xff, 0xcc, 0x3a, 0xff, 0xff, 0xac, 0x3a, 0xff, 0xff,
-  0x8c, 0x3a, 0xff, 0xff, 0x6c, 0x3a, 0xff, 0xff, 0x4c, 0x3a, 0xff, 0xff,
-  0x2c, 0x3a, 0xff, 0xff, 0x0d, 0x3a, 0xff, 0xff, 0xed, 0x39, 0xff, 0xff,
-  0xcd, 0x39, 0xff, 0xff, 0xad, 0x39, 0xff, 0xff, 0x8d, 0x39, 0xff, 0xff,
-  0x6e, 0x39, 0xff, 0xff, 0x4e, 0x39, 0xff, 0xff, 0x2e, 0x39, 0xff, 0xff,
-  0x0f, 0x39, 0xff, 0xff, 0xef, 0x38, 0xff, 0xff, 0xcf, 0x38, 0xff, 0xff,
-  0xb0, 0x38, 0xff, 0xff, 0x90, 0x38, 0xff, 0xff, 0x71, 0x38, 0xff, 0xff,
-  0x51, 0x38, 0xff, 0xff, 0x32, 0x38, 0xff, 0xff, 0x12, 0x38, 0xff, 0xff,
-  0xf3, 0x37, 0xff, 0xff, 0xd4, 0x37, 0xff, 0xff, 0xb4, 0x37, 0xff, 0xff,
-  0x95, 0x37, 0xff, 0xff, 0x76, 0x37, 0xff, 0xff, 0x57, 0x37, 0xff, 0xff,
-  0x37, 0x37, 0xff, 0xff, 0x18, 0x37, 0xff, 0xff, 0xf9, 0x36, 0xff, 0xff,
-  0xda, 0x36, 0xff, 0xff, 0xbb, 0x36, 0xff, 0xff, 0x9c, 0x36, 0xff, 0xff,
-  0x7d, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x3f, 0x36, 0xff, 0xff,
-  0x20, 0x36, 0xff, 0xff, 0x01, 0x36, 0xff, 0xff, 0xe2, 0x35, 0xff, 0xff,
-  0xc3, 0x35, 0xff, 0xff, 0xa5, 0x35, 0xff, 0xff, 0x86, 0x35, 0xff, 0xff,
-  0x67, 0x35, 0xff, 0xff, 0x48, 0x35, 0xff, 0xff, 0x2a, 0x35, 0xff, 0xff,
-  0x0b, 0x35, 0xff, 0xff, 0xec, 0x34, 0xff, 0xff, 0xce, 0x34, 0xff, 0xff,
-  0xaf, 0x34, 0xff, 0xff, 0x91, 0x34, 0xff, 0xff, 0x72, 0x34, 0xff, 0xff,
-  0x54, 0x34, 0xff, 0xff, 0x35, 0x34, 0xff, 0xff, 0x17, 0x34, 0xff, 0xff,
-  0xf9, 0x33, 0xff, 0xff, 0xda, 0x33, 0xff, 0xff, 0xbc, 0x33, 0xff, 0xff,
-  0x9e, 0x33, 0xff, 0xff, 0x7f, 0x33, 0xff, 0xff, 0x61, 0x33, 0xff, 0xff,
-  0x43, 0x33, 0xff, 0xff, 0x25, 0x33, 0xff, 0xff, 0x07, 0x33, 0xff, 0xff,
-  0xe9, 0x32, 0xff, 0xff, 0xca, 0x32, 0xff, 0xff, 0xac, 0x32, 0xff, 0xff,
-  0x8e, 0x32, 0xff, 0xff, 0x70, 0x32, 0xff, 0xff, 0x53, 0x32, 0xff, 0xff,
-  0x35, 0x32, 0xff, 0xff, 0x17, 0x32, 0xff, 0xff, 0xf9, 0x31, 0xff, 0xff,
-  0xdb, 0x31, 0xff, 0xff, 0xbd, 0x31, 0xff, 0xff, 0xa0, 0x31, 0xff, 0xff,
-  0x82, 0x31, 0xff, 0xff, 0x64, 0x31, 0xff, 0xff, 0x46, 0x31, 0xff, 0xff,
-  0x29, 0x31, 0xff, 0xff, 0x0b, 0x31, 0xff, 0xff, 0xee, 0x30, 0xff, 0xff,
-  0xd0, 0x30, 0xff, 0xff, 0xb3, 0x30, 0xff, 0xff, 0x95, 0x30, 0xff, 0xff,
-  0x78, 0x30, 0xff, 0xff, 0x5a, 0x30, 0xff, 0xff, 0x3d, 0x30, 0xff, 0xff,
-  0x20, 0x30, 0xff, 0xff, 0x02, 0x30, 0xff, 0xff, 0xe5, 0x2f, 0xff, 0xff,
-  0xc8, 0x2f, 0xff, 0xff, 0xaa, 0x2f, 0xff, 0xff, 0x8d, 0x2f, 0xff, 0xff,
-  0x70, 0x2f, 0xff, 0xff, 0x53, 0x2f, 0xff, 0xff, 0x36, 0x2f, 0xff, 0xff,
-  0x19, 0x2f, 0xff, 0xff, 0xfc, 0x2e, 0xff, 0xff, 0xdf, 0x2e, 0xff, 0xff,
-  0xc2, 0x2e, 0xff, 0xff, 0xa5, 0x2e, 0xff, 0xff, 0x88, 0x2e, 0xff, 0xff,
-  0x6b, 0x2e, 0xff, 0xff, 0x4e, 0x2e, 0xff, 0xff, 0x31, 0x2e, 0xff, 0xff,
-  0x15, 0x2e, 0xff, 0xff, 0xf8, 0x2d, 0xff, 0xff, 0xdb, 0x2d, 0xff, 0xff,
-  0xbe, 0x2d, 0xff, 0xff, 0xa2, 0x2d, 0xff, 0xff, 0x85, 0x2d, 0xff, 0xff,
-  0x69, 0x2d, 0xff, 0xff, 0x4c, 0x2d, 0xff, 0xff, 0x2f, 0x2d, 0xff, 0xff,
-  0x13, 0x2d, 0xff, 0xff, 0xf6, 0x2c, 0xff, 0xff, 0xda, 0x2c, 0xff, 0xff,
-  0xbe, 0x2c, 0xff, 0xff, 0xa1, 0x2c, 0xff, 0xff, 0x85, 0x2c, 0xff, 0xff,
-  0x69, 0x2c, 0xff, 0xff, 0x4c, 0x2c, 0xff, 0xff, 0x30, 0x2c, 0xff, 0xff,
-  0x14, 0x2c, 0xff, 0xff, 0xf8, 0x2b, 0xff, 0xff, 0xdc, 0x2b, 0xff, 0xff,
-  0xbf, 0x2b, 0xff, 0xff, 0xa3, 0x2b, 0xff, 0xff, 0x87, 0x2b, 0xff, 0xff,
-  0x6b, 0x2b, 0xff, 0xff, 0x4f, 0x2b, 0xff, 0xff, 0x33, 0x2b, 0xff, 0xff,
-  0x17, 0x2b, 0xff, 0xff, 0xfb, 0x2a, 0xff, 0xff, 0xe0, 0x2a, 0xff, 0xff,
-  0xc4, 0x2a, 0xff, 0xff, 0xa8, 0x2a, 0xff, 0xff, 0x8c, 0x2a, 0xff, 0xff,
-  0x70, 0x2a, 0xff, 0xff, 0x55, 0x2a, 0xff, 0xff, 0x39, 0x2a, 0xff, 0xff,
-  0x1d, 0x2a, 0xff, 0xff, 0x02, 0x2a, 0xff, 0xff, 0xe6, 0x29, 0xff, 0xff,
-  0xcb, 0x29, 0xff, 0xff, 0xaf, 0x29, 0xff, 0xff, 0x94, 0x29, 0xff, 0xff,
-  0x78, 0x29, 0xff, 0xff, 0x5d, 0x29, 0xff, 0xff, 0x42, 0x29, 0xff, 0xff,
-  0x26, 0x29, 0xff, 0xff, 0x0b, 0x29, 0xff, 0xff, 0xf0, 0x28, 0xff, 0xff,
-  0xd4, 0x28, 0xff, 0xff, 0xb9, 0x28, 0xff, 0xff, 0x9e, 0x28, 0xff, 0xff,
-  0x83, 0x28, 0xff, 0xff, 0x68, 0x28, 0xff, 0xff, 0x4d, 0x28, 0xff, 0xff,
-  0x32, 0x28, 0xff, 0xff, 0x16, 0x28, 0xff, 0xff, 0xfc, 0x27, 0xff, 0xff,
-  0xe1, 0x27, 0xff, 0xff, 0xc6, 0x27, 0xff, 0xff, 0xab, 0x27, 0xff, 0xff,
-  0x90, 0x27, 0xff, 0xff, 0x75, 0x27, 0xff, 0xff, 0x5a, 0x27, 0xff, 0xff,
-  0x3f, 0x27, 0xff, 0xff, 0x25, 0x27, 0xff, 0xff, 0x0a, 0x27, 0xff, 0xff,
-  0xef, 0x26, 0xff, 0xff, 0xd5, 0x26, 0xff, 0xff, 0xba, 0x26, 0xff, 0xff,
-  0xa0, 0x26, 0xff, 0xff, 0x85, 0x26, 0xff, 0xff, 0x6b, 0x26, 0xff, 0xff,
-  0x50, 0x26, 0xff, 0xff, 0x36, 0x26, 0xff, 0xff, 0x1b, 0x26, 0xff, 0xff,
-  0x01, 0x26, 0xff, 0xff, 0xe7, 0x25, 0xff, 0xff, 0xcc, 0x25, 0xff, 0xff,
-  0xb2, 0x25, 0xff, 0xff, 0x98, 0x25, 0xff, 0xff, 0x7e, 0x25, 0xff, 0xff,
-  0x63, 0x25, 0xff, 0xff, 0x49, 0x25, 0xff, 0xff, 0x2f, 0x25, 0xff, 0xff,
-  0x15, 0x25, 0xff, 0xff, 0xfb, 0x24, 0xff, 0xff, 0xe1, 0x24, 0xff, 0xff,
-  0xc7, 0x24, 0xff, 0xff, 0xad, 0x24, 0xff, 0xff, 0x93, 0x24, 0xff, 0xff,
-  0x79, 0x24, 0xff, 0xff, 0x5f, 0x24, 0xff, 0xff, 0x46, 0x24, 0xff, 0xff,
-  0x2c, 0x24, 0xff, 0xff, 0x12, 0x24, 0xff, 0xff, 0xf8, 0x23, 0xff, 0xff,
-  0xdf, 0x23, 0xff, 0xff, 0xc5, 0x23, 0xff, 0xff, 0xac, 0x23, 0xff, 0xff,
-  0x92, 0x23, 0xff, 0xff, 0x78, 0x23, 0xff, 0xff, 0x5f, 0x23, 0xff, 0xff,
-  0x45, 0x23, 0xff, 0xff, 0x2c, 0x23, 0xff, 0xff, 0x13, 0x23, 0xff, 0xff,
-  0xf9, 0x22, 0xff, 0xff, 0xe0, 0x22, 0xff, 0xff, 0xc7, 0x22, 0xff, 0xff,
-  0xad, 0x22, 0xff, 0xff, 0x94, 0x22, 0xff, 0xff, 0x7b, 0x22, 0xff, 0xff,
-  0x62, 0x22, 0xff, 0xff, 0x48, 0x22, 0xff, 0xff, 0x2f, 0x22, 0xff, 0xff,
-  0x16, 0x22, 0xff, 0xff, 0xfd, 0x21, 0xff, 0xff, 0xe4, 0x21, 0xff, 0xff,
-  0xcb, 0x21, 0xff, 0xff, 0xb2, 0x21, 0xff, 0xff, 0x99, 0x21, 0xff, 0xff,
-  0x81, 0x21, 0xff, 0xff, 0x68, 0x21, 0xff, 0xff, 0x4f, 0x21, 0xff, 0xff,
-  0x36, 0x21, 0xff, 0xff, 0x1d, 0x21, 0xff, 0xff, 0x05, 0x21, 0xff, 0xff,
-  0xec, 0x20, 0xff, 0xff, 0xd3, 0x20, 0xff, 0xff, 0xbb, 0x20, 0xff, 0xff,
-  0xa2, 0x20, 0xff, 0xff, 0x8a, 0x20, 0xff, 0xff, 0x71, 0x20, 0xff, 0xff,
-  0x59, 0x20, 0xff, 0xff, 0x40, 0x20, 0xff, 0xff, 0x28, 0x20, 0xff, 0xff,
-  0x0f, 0x20, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff, 0xdf, 0x1f, 0xff, 0xff,
-  0xc6, 0x1f, 0xff, 0xff, 0xae, 0x1f, 0xff, 0xff, 0x96, 0x1f, 0xff, 0xff,
-  0x7e, 0x1f, 0xff, 0xff, 0x66, 0x1f, 0xff, 0xff, 0x4e, 0x1f, 0xff, 0xff,
-  0x36, 0x1f, 0xff, 0xff, 0x1e, 0x1f, 0xff, 0xff, 0x06, 0x1f, 0xff, 0xff,
-  0xee, 0x1e, 0xff, 0xff, 0xd6, 0x1e, 0xff, 0xff, 0xbe, 0x1e, 0xff, 0xff,
-  0xa6, 0x1e, 0xff, 0xff, 0x8e, 0x1e, 0xff, 0xff, 0x76, 0x1e, 0xff, 0xff,
-  0x5e, 0x1e, 0xff, 0xff, 0x47, 0x1e, 0xff, 0xff, 0x2f, 0x1e, 0xff, 0xff,
-  0x17, 0x1e, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0xe8, 0x1d, 0xff, 0xff,
-  0xd1, 0x1d, 0xff, 0xff, 0xb9, 0x1d, 0xff, 0xff, 0xa2, 0x1d, 0xff, 0xff,
-  0x8a, 0x1d, 0xff, 0xff, 0x73, 0x1d, 0xff, 0xff, 0x5b, 0x1d, 0xff, 0xff,
-  0x44, 0x1d, 0xff, 0xff, 0x2d, 0x1d, 0xff, 0xff, 0x15, 0x1d, 0xff, 0xff,
-  0xfe, 0x1c, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xd0, 0x1c, 0xff, 0xff,
-  0xb9, 0x1c, 0xff, 0xff, 0xa1, 0x1c, 0xff, 0xff, 0x8a, 0x1c, 0xff, 0xff,
-  0x73, 0x1c, 0xff, 0xff, 0x5c, 0x1c, 0xff, 0xff, 0x45, 0x1c, 0xff, 0xff,
-  0x2e, 0x1c, 0xff, 0xff, 0x17, 0x1c, 0xff, 0xff, 0x01, 0x1c, 0xff, 0xff,
-  0xea, 0x1b, 0xff, 0xff, 0xd3, 0x1b, 0xff, 0xff, 0xbc, 0x1b, 0xff, 0xff,
-  0xa5, 0x1b, 0xff, 0xff, 0x8f, 0x1b, 0xff, 0xff, 0x78, 0x1b, 0xff, 0xff,
-  0x61, 0x1b, 0xff, 0xff, 0x4b, 0x1b, 0xff, 0xff, 0x34, 0x1b, 0xff, 0xff,
-  0x1e, 0x1b, 0xff, 0xff, 0x07, 0x1b, 0xff, 0xff, 0xf1, 0x1a, 0xff, 0xff,
-  0xda, 0x1a, 0xff, 0xff, 0xc4, 0x1a, 0xff, 0xff, 0xae, 0x1a, 0xff, 0xff,
-  0x97, 0x1a, 0xff, 0xff, 0x81, 0x1a, 0xff, 0xff, 0x6b, 0x1a, 0xff, 0xff,
-  0x55, 0x1a, 0xff, 0xff, 0x3e, 0x1a, 0xff, 0xff, 0x28, 0x1a, 0xff, 0xff,
-  0x12, 0x1a, 0xff, 0xff, 0xfc, 0x19, 0xff, 0xff, 0xe6, 0x19, 0xff, 0xff,
-  0xd0, 0x19, 0xff, 0xff, 0xba, 0x19, 0xff, 0xff, 0xa4, 0x19, 0xff, 0xff,
-  0x8e, 0x19, 0xff, 0xff, 0x78, 0x19, 0xff, 0xff, 0x62, 0x19, 0xff, 0xff,
-  0x4d, 0x19, 0xff, 0xff, 0x37, 0x19, 0xff, 0xff, 0x21, 0x19, 0xff, 0xff,
-  0x0b, 0x19, 0xff, 0xff, 0xf6, 0x18, 0xff, 0xff, 0xe0, 0x18, 0xff, 0xff,
-  0xca, 0x18, 0xff, 0xff, 0xb5, 0x18, 0xff, 0xff, 0x9f, 0x18, 0xff, 0xff,
-  0x8a, 0x18, 0xff, 0xff, 0x74, 0x18, 0xff, 0xff, 0x5f, 0x18, 0xff, 0xff,
-  0x4a, 0x18, 0xff, 0xff, 0x34, 0x18, 0xff, 0xff, 0x1f, 0x18, 0xff, 0xff,
-  0x0a, 0x18, 0xff, 0xff, 0xf4, 0x17, 0xff, 0xff, 0xdf, 0x17, 0xff, 0xff,
-  0xca, 0x17, 0xff, 0xff, 0xb5, 0x17, 0xff, 0xff, 0xa0, 0x17, 0xff, 0xff,
-  0x8b, 0x17, 0xff, 0xff, 0x76, 0x17, 0xff, 0xff, 0x61, 0x17, 0xff, 0xff,
-  0x4c, 0x17, 0xff, 0xff, 0x37, 0x17, 0xff, 0xff, 0x22, 0x17, 0xff, 0xff,
-  0x0d, 0x17, 0xff, 0xff, 0xf8, 0x16, 0xff, 0xff, 0xe3, 0x16, 0xff, 0xff,
-  0xcf, 0x16, 0xff, 0xff, 0xba, 0x16, 0xff, 0xff, 0xa5, 0x16, 0xff, 0xff,
-  0x91, 0x16, 0xff, 0xff, 0x7c, 0x16, 0xff, 0xff, 0x67, 0x16, 0xff, 0xff,
-  0x53, 0x16, 0xff, 0xff, 0x3e, 0x16, 0xff, 0xff, 0x2a, 0x16, 0xff, 0xff,
-  0x15, 0x16, 0xff, 0xff, 0x01, 0x16, 0xff, 0xff, 0xed, 0x15, 0xff, 0xff,
-  0xd8, 0x15, 0xff, 0xff, 0xc4, 0x15, 0xff, 0xff, 0xb0, 0x15, 0xff, 0xff,
-  0x9c, 0x15, 0xff, 0xff, 0x87, 0x15, 0xff, 0xff, 0x73, 0x15, 0xff, 0xff,
-  0x5f, 0x15, 0xff, 0xff, 0x4b, 0x15, 0xff, 0xff, 0x37, 0x15, 0xff, 0xff,
-  0x23, 0x15, 0xff, 0xff, 0x0f, 0x15, 0xff, 0xff, 0xfb, 0x14, 0xff, 0xff,
-  0xe7, 0x14, 0xff, 0xff, 0xd3, 0x14, 0xff, 0xff, 0xbf, 0x14, 0xff, 0xff,
-  0xac, 0x14, 0xff, 0xff, 0x98, 0x14, 0xff, 0xff, 0x84, 0x14, 0xff, 0xff,
-  0x70, 0x14, 0xff, 0xff, 0x5d, 0x14, 0xff, 0xff, 0x49, 0x14, 0xff, 0xff,
-  0x35, 0x14, 0xff, 0xff, 0x22, 0x14, 0xff, 0xff, 0x0e, 0x14, 0xff, 0xff,
-  0xfb, 0x13, 0xff, 0xff, 0xe7, 0x13, 0xff, 0xff, 0xd4, 0x13, 0xff, 0xff,
-  0xc1, 0x13, 0xff, 0xff, 0xad, 0x13, 0xff, 0xff, 0x9a, 0x13, 0xff, 0xff,
-  0x87, 0x13, 0xff, 0xff, 0x74, 0x13, 0xff, 0xff, 0x60, 0x13, 0xff, 0xff,
-  0x4d, 0x13, 0xff, 0xff, 0x3a, 0x13, 0xff, 0xff, 0x27, 0x13, 0xff, 0xff,
-  0x14, 0x13, 0xff, 0xff, 0x01, 0x13, 0xff, 0xff, 0xee, 0x12, 0xff, 0xff,
-  0xdb, 0x12, 0xff, 0xff, 0xc8, 0x12, 0xff, 0xff, 0xb5, 0x12, 0xff, 0xff,
-  0xa2, 0x12, 0xff, 0xff, 0x8f, 0x12, 0xff, 0xff, 0x7d, 0x12, 0xff, 0xff,
-  0x6a, 0x12, 0xff, 0xff, 0x57, 0x12, 0xff, 0xff, 0x45, 0x12, 0xff, 0xff,
-  0x32, 0x12, 0xff, 0xff, 0x1f, 0x12, 0xff, 0xff, 0x0d, 0x12, 0xff, 0xff,
-  0xfa, 0x11, 0xff, 0xff, 0xe8, 0x11, 0xff, 0xff, 0xd5, 0x11, 0xff, 0xff,
-  0xc3, 0x11, 0xff, 0xff, 0xb1, 0x11, 0xff, 0xff, 0x9e, 0x11, 0xff, 0xff,
-  0x8c, 0x11, 0xff, 0xff, 0x7a, 0x11, 0xff, 0xff, 0x67, 0x11, 0xff, 0xff,
-  0x55, 0x11, 0xff, 0xff, 0x43, 0x11, 0xff, 0xff, 0x31, 0x11, 0xff, 0xff,
-  0x1f, 0x11, 0xff, 0xff, 0x0d, 0x11, 0xff, 0xff, 0xfb, 0x10, 0xff, 0xff,
-  0xe9, 0x10, 0xff, 0xff, 0xd7, 0x10, 0xff, 0xff, 0xc5, 0x10, 0xff, 0xff,
-  0xb3, 0x10, 0xff, 0xff, 0xa1, 0x10, 0xff, 0xff, 0x8f, 0x10, 0xff, 0xff,
-  0x7e, 0x10, 0xff, 0xff, 0x6c, 0x10, 0xff, 0xff, 0x5a, 0x10, 0xff, 0xff,
-  0x49, 0x10, 0xff, 0xff, 0x37, 0x10, 0xff, 0xff, 0x25, 0x10, 0xff, 0xff,
-  0x14, 0x10, 0xff, 0xff, 0x02, 0x10, 0xff, 0xff, 0xf1, 0x0f, 0xff, 0xff,
-  0xdf, 0x0f, 0xff, 0xff, 0xce, 0x0f, 0xff, 0xff, 0xbd, 0x0f, 0xff, 0xff,
-  0xab, 0x0f, 0xff, 0xff, 0x9a, 0x0f, 0xff, 0xff, 0x89, 0x0f, 0xff, 0xff,
-  0x77, 0x0f, 0xff, 0xff, 0x66, 0x0f, 0xff, 0xff, 0x55, 0x0f, 0xff, 0xff,
-  0x44, 0x0f, 0xff, 0xff, 0x33, 0x0f, 0xff, 0xff, 0x22, 0x0f, 0xff, 0xff,
-  0x11, 0x0f, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xef, 0x0e, 0xff, 0xff,
-  0xde, 0x0e, 0xff, 0xff, 0xcd, 0x0e, 0xff, 0xff, 0xbc, 0x0e, 0xff, 0xff,
-  0xac, 0x0e, 0xff, 0xff, 0x9b, 0x0e, 0xff, 0xff, 0x8a, 0x0e, 0xff, 0xff,
-  0x79, 0x0e, 0xff, 0xff, 0x69, 0x0e, 0xff, 0xff, 0x58, 0x0e, 0xff, 0xff,
-  0x48, 0x0e, 0xff, 0xff, 0x37, 0x0e, 0xff, 0xff, 0x27, 0x0e, 0xff, 0xff,
-  0x16, 0x0e, 0xff, 0xff, 0x06, 0x0e, 0xff, 0xff, 0xf5, 0x0d, 0xff, 0xff,
-  0xe5, 0x0d, 0xff, 0xff, 0xd5, 0x0d, 0xff, 0xff, 0xc4, 0x0d, 0xff, 0xff,
-  0xb4, 0x0d, 0xff, 0xff, 0xa4, 0x0d, 0xff, 0xff, 0x94, 0x0d, 0xff, 0xff,
-  0x84, 0x0d, 0xff, 0xff, 0x74, 0x0d, 0xff, 0xff, 0x64, 0x0d, 0xff, 0xff,
-  0x53, 0x0d, 0xff, 0xff, 0x43, 0x0d, 0xff, 0xff, 0x34, 0x0d, 0xff, 0xff,
-  0x24, 0x0d, 0xff, 0xff, 0x14, 0x0d, 0xff, 0xff, 0x04, 0x0d, 0xff, 0xff,
-  0xf4, 0x0c, 0xff, 0xff, 0xe4, 0x0c, 0xff, 0xff, 0xd5, 0x0c, 0xff, 0xff,
-  0xc5, 0x0c, 0xff, 0xff, 0xb5, 0x0c, 0xff, 0xff, 0xa6, 0x0c, 0xff, 0xff,
-  0x96, 0x0c, 0xff, 0xff, 0x87, 0x0c, 0xff, 0xff, 0x77, 0x0c, 0xff, 0xff,
-  0x68, 0x0c, 0xff, 0xff, 0x58, 0x0c, 0xff, 0xff, 0x49, 0x0c, 0xff, 0xff,
-  0x39, 0x0c, 0xff, 0xff, 0x2a, 0x0c, 0xff, 0xff, 0x1b, 0x0c, 0xff, 0xff,
-  0x0b, 0x0c, 0xff, 0xff, 0xfc, 0x0b, 0xff, 0xff, 0xed, 0x0b, 0xff, 0xff,
-  0xde, 0x0b, 0xff, 0xff, 0xcf, 0x0b, 0xff, 0xff, 0xc0, 0x0b, 0xff, 0xff,
-  0xb1, 0x0b, 0xff, 0xff, 0xa2, 0x0b, 0xff, 0xff, 0x93, 0x0b, 0xff, 0xff,
-  0x84, 0x0b, 0xff, 0xff, 0x75, 0x0b, 0xff, 0xff, 0x66, 0x0b, 0xff, 0xff,
-  0x57, 0x0b, 0xff, 0xff, 0x48, 0x0b, 0xff, 0xff, 0x3a, 0x0b, 0xff, 0xff,
-  0x2b, 0x0b, 0xff, 0xff, 0x1c, 0x0b, 0xff, 0xff, 0x0e, 0x0b, 0xff, 0xff,
-  0xff, 0x0a, 0xff, 0xff, 0xf1, 0x0a, 0xff, 0xff, 0xe2, 0x0a, 0xff, 0xff,
-  0xd4, 0x0a, 0xff, 0xff, 0xc5, 0x0a, 0xff, 0xff, 0xb7, 0x0a, 0xff, 0xff,
-  0xa8, 0x0a, 0xff, 0xff, 0x9a, 0x0a, 0xff, 0xff, 0x8c, 0x0a, 0xff, 0xff,
-  0x7e, 0x0a, 0xff, 0xff, 0x6f, 0x0a, 0xff, 0xff, 0x61, 0x0a, 0xff, 0xff,
-  0x53, 0x0a, 0xff, 0xff, 0x45, 0x0a, 0xff, 0xff, 0x37, 0x0a, 0xff, 0xff,
-  0x29, 0x0a, 0xff, 0xff, 0x1b, 0x0a, 0xff, 0xff, 0x0d, 0x0a, 0xff, 0xff,
-  0xff, 0x09, 0xff, 0xff, 0xf1, 0x09, 0xff, 0xff, 0xe3, 0x09, 0xff, 0xff,
-  0xd5, 0x09, 0xff, 0xff, 0xc8, 0x09, 0xff, 0xff, 0xba, 0x09, 0xff, 0xff,
-  0xac, 0x09, 0xff, 0xff, 0x9e, 0x09, 0xff, 0xff, 0x91, 0x09, 0xff, 0xff,
-  0x83, 0x09, 0xff, 0xff, 0x76, 0x09, 0xff, 0xff, 0x68, 0x09, 0xff, 0xff,
-  0x5b, 0x09, 0xff, 0xff, 0x4d, 0x09, 0xff, 0xff, 0x40, 0x09, 0xff, 0xff,
-  0x32, 0x09, 0xff, 0xff, 0x25, 0x09, 0xff, 0xff, 0x18, 0x09, 0xff, 0xff,
-  0x0b, 0x09, 0xff, 0xff, 0xfd, 0x08, 0xff, 0xff, 0xf0, 0x08, 0xff, 0xff,
-  0xe3, 0x08, 0xff, 0xff, 0xd6, 0x08, 0xff, 0xff, 0xc9, 0x08, 0xff, 0xff,
-  0xbc, 0x08, 0xff, 0xff, 0xaf, 0x08, 0xff, 0xff, 0xa2, 0x08, 0xff, 0xff,
-  0x95, 0x08, 0xff, 0xff, 0x88, 0x08, 0xff, 0xff, 0x7b, 0x08, 0xff, 0xff,
-  0x6e, 0x08, 0xff, 0xff, 0x62, 0x08, 0xff, 0xff, 0x55, 0x08, 0xff, 0xff,
-  0x48, 0x08, 0xff, 0xff, 0x3b, 0x08, 0xff, 0xff, 0x2f, 0x08, 0xff, 0xff,
-  0x22, 0x08, 0xff, 0xff, 0x16, 0x08, 0xff, 0xff, 0x09, 0x08, 0xff, 0xff,
-  0xfd, 0x07, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xe4, 0x07, 0xff, 0xff,
-  0xd8, 0x07, 0xff, 0xff, 0xcb, 0x07, 0xff, 0xff, 0xbf, 0x07, 0xff, 0xff,
-  0xb3, 0x07, 0xff, 0xff, 0xa6, 0x07, 0xff, 0xff, 0x9a, 0x07, 0xff, 0xff,
-  0x8e, 0x07, 0xff, 0xff, 0x82, 0x07, 0xff, 0xff, 0x76, 0x07, 0xff, 0xff,
-  0x6a, 0x07, 0xff, 0xff, 0x5e, 0x07, 0xff, 0xff, 0x52, 0x07, 0xff, 0xff,
-  0x46, 0x07, 0xff, 0xff, 0x3a, 0x07, 0xff, 0xff, 0x2e, 0x07, 0xff, 0xff,
-  0x23, 0x07, 0xff, 0xff, 0x17, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff,
-  0xff, 0x06, 0xff, 0xff, 0xf4, 0x06, 0xff, 0xff, 0xe8, 0x06, 0xff, 0xff,
-  0xdd, 0x06, 0xff, 0xff, 0xd1, 0x06, 0xff, 0xff, 0xc5, 0x06, 0xff, 0xff,
-  0xba, 0x06, 0xff, 0xff, 0xaf, 0x06, 0xff, 0xff, 0xa3, 0x06, 0xff, 0xff,
-  0x98, 0x06, 0xff, 0xff, 0x8d, 0x06, 0xff, 0xff, 0x81, 0x06, 0xff, 0xff,
-  0x76, 0x06, 0xff, 0xff, 0x6b, 0x06, 0xff, 0xff, 0x60, 0x06, 0xff, 0xff,
-  0x55, 0x06, 0xff, 0xff, 0x49, 0x06, 0xff, 0xff, 0x3e, 0x06, 0xff, 0xff,
-  0x33, 0x06, 0xff, 0xff, 0x28, 0x06, 0xff, 0xff, 0x1d, 0x06, 0xff, 0xff,
-  0x13, 0x06, 0xff, 0xff, 0x08, 0x06, 0xff, 0xff, 0xfd, 0x05, 0xff, 0xff,
-  0xf2, 0x05, 0xff, 0xff, 0xe7, 0x05, 0xff, 0xff, 0xdd, 0x05, 0xff, 0xff,
-  0xd2, 0x05, 0xff, 0xff, 0xc7, 0x05, 0xff, 0xff, 0xbd, 0x05, 0xff, 0xff,
-  0xb2, 0x05, 0xff, 0xff, 0xa8, 0x05, 0xff, 0xff, 0x9d, 0x05, 0xff, 0xff,
-  0x93, 0x05, 0xff, 0xff, 0x88, 0x05, 0xff, 0xff, 0x7e, 0x05, 0xff, 0xff,
-  0x74, 0x05, 0xff, 0xff, 0x69, 0x05, 0xff, 0xff, 0x5f, 0x05, 0xff, 0xff,
-  0x55, 0x05, 0xff, 0xff, 0x4b, 0x05, 0xff, 0xff, 0x40, 0x05, 0xff, 0xff,
-  0x36, 0x05, 0xff, 0xff, 0x2c, 0x05, 0xff, 0xff, 0x22, 0x05, 0xff, 0xff,
-  0x18, 0x05, 0xff, 0xff, 0x0e, 0x05, 0xff, 0xff, 0x04, 0x05, 0xff, 0xff,
-  0xfb, 0x04, 0xff, 0xff, 0xf1, 0x04, 0xff, 0xff, 0xe7, 0x04, 0xff, 0xff,
-  0xdd, 0x04, 0xff, 0xff, 0xd3, 0x04, 0xff, 0xff, 0xca, 0x04, 0xff, 0xff,
-  0xc0, 0x04, 0xff, 0xff, 0xb6, 0x04, 0xff, 0xff, 0xad, 0x04, 0xff, 0xff,
-  0xa3, 0x04, 0xff, 0xff, 0x9a, 0x04, 0xff, 0xff, 0x90, 0x04, 0xff, 0xff,
-  0x87, 0x04, 0xff, 0xff, 0x7d, 0x04, 0xff, 0xff, 0x74, 0x04, 0xff, 0xff,
-  0x6b, 0x04, 0xff, 0xff, 0x62, 0x04, 0xff, 0xff, 0x58, 0x04, 0xff, 0xff,
-  0x4f, 0x04, 0xff, 0xff, 0x46, 0x04, 0xff, 0xff, 0x3d, 0x04, 0xff, 0xff,
-  0x34, 0x04, 0xff, 0xff, 0x2b, 0x04, 0xff, 0xff, 0x22, 0x04, 0xff, 0xff,
-  0x19, 0x04, 0xff, 0xff, 0x10, 0x04, 0xff, 0xff, 0x07, 0x04, 0xff, 0xff,
-  0xfe, 0x03, 0xff, 0xff, 0xf5, 0x03, 0xff, 0xff, 0xec, 0x03, 0xff, 0xff,
-  0xe4, 0x03, 0xff, 0xff, 0xdb, 0x03, 0xff, 0xff, 0xd2, 0x03, 0xff, 0xff,
-  0xca, 0x03, 0xff, 0xff, 0xc1, 0x03, 0xff, 0xff, 0xb8, 0x03, 0xff, 0xff,
-  0xb0, 0x03, 0xff, 0xff, 0xa7, 0x03, 0xff, 0xff, 0x9f, 0x03, 0xff, 0xff,
-  0x97, 0x03, 0xff, 0xff, 0x8e, 0x03, 0xff, 0xff, 0x86, 0x03, 0xff, 0xff,
-  0x7e, 0x03, 0xff, 0xff, 0x75, 0x03, 0xff, 0xff, 0x6d, 0x03, 0xff, 0xff,
-  0x65, 0x03, 0xff, 0xff, 0x5d, 0x03, 0xff, 0xff, 0x55, 0x03, 0xff, 0xff,
-  0x4d, 0x03, 0xff, 0xff, 0x45, 0x03, 0xff, 0xff, 0x3d, 0x03, 0xff, 0xff,
-  0x35, 0x03, 0xff, 0xff, 0x2d, 0x03, 0xff, 0xff, 0x25, 0x03, 0xff, 0xff,
-  0x1d, 0x03, 0xff, 0xff, 0x15, 0x03, 0xff, 0xff, 0x0e, 0x03, 0xff, 0xff,
-  0x06, 0x03, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xf7, 0x02, 0xff, 0xff,
-  0xef, 0x02, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xe0, 0x02, 0xff, 0xff,
-  0xd8, 0x02, 0xff, 0xff, 0xd1, 0x02, 0xff, 0xff, 0xca, 0x02, 0xff, 0xff,
-  0xc2, 0x02, 0xff, 0xff, 0xbb, 0x02, 0xff, 0xff, 0xb4, 0x02, 0xff, 0xff,
-  0xac, 0x02, 0xff, 0xff, 0xa5, 0x02, 0xff, 0xff, 0x9e, 0x02, 0xff, 0xff,
-  0x97, 0x02, 0xff, 0xff, 0x90, 0x02, 0xff, 0xff, 0x89, 0x02, 0xff, 0xff,
-  0x81, 0x02, 0xff, 0xff, 0x7a, 0x02, 0xff, 0xff, 0x74, 0x02, 0xff, 0xff,
-  0x6d, 0x02, 0xff, 0xff, 0x66, 0x02, 0xff, 0xff, 0x5f, 0x02, 0xff, 0xff,
-  0x58, 0x02, 0xff, 0xff, 0x51, 0x02, 0xff, 0xff, 0x4b, 0x02, 0xff, 0xff,
-  0x44, 0x02, 0xff, 0xff, 0x3d, 0x02, 0xff, 0xff, 0x37, 0x02, 0xff, 0xff,
-  0x30, 0x02, 0xff, 0xff, 0x2a, 0x02, 0xff, 0xff, 0x23, 0x02, 0xff, 0xff,
-  0x1d, 0x02, 0xff, 0xff, 0x16, 0x02, 0xff, 0xff, 0x10, 0x02, 0xff, 0xff,
-  0x09, 0x02, 0xff, 0xff, 0x03, 0x02, 0xff, 0xff, 0xfd, 0x01, 0xff, 0xff,
-  0xf7, 0x01, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xea, 0x01, 0xff, 0xff,
-  0xe4, 0x01, 0xff, 0xff, 0xde, 0x01, 0xff, 0xff, 0xd8, 0x01, 0xff, 0xff,
-  0xd2, 0x01, 0xff, 0xff, 0xcc, 0x01, 0xff, 0xff, 0xc6, 0x01, 0xff, 0xff,
-  0xc0, 0x01, 0xff, 0xff, 0xba, 0x01, 0xff, 0xff, 0xb5, 0x01, 0xff, 0xff,
-  0xaf, 0x01, 0xff, 0xff, 0xa9, 0x01, 0xff, 0xff, 0xa3, 0x01, 0xff, 0xff,
-  0x9e, 0x01, 0xff, 0xff, 0x98, 0x01, 0xff, 0xff, 0x93, 0x01, 0xff, 0xff,
-  0x8d, 0x01, 0xff, 0xff, 0x88, 0x01, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff,
-  0x7d, 0x01, 0xff, 0xff, 0x77, 0x01, 0xff, 0xff, 0x72, 0x01, 0xff, 0xff,
-  0x6d, 0x01, 0xff, 0xff, 0x67, 0x01, 0xff, 0xff, 0x62, 0x01, 0xff, 0xff,
-  0x5d, 0x01, 0xff, 0xff, 0x58, 0x01, 0xff, 0xff, 0x53, 0x01, 0xff, 0xff,
-  0x4e, 0x01, 0xff, 0xff, 0x49, 0x01, 0xff, 0xff, 0x44, 0x01, 0xff, 0xff,
-  0x3f, 0x01, 0xff, 0xff, 0x3a, 0x01, 0xff, 0xff, 0x35, 0x01, 0xff, 0xff,
-  0x30, 0x01, 0xff, 0xff, 0x2b, 0x01, 0xff, 0xff, 0x26, 0x01, 0xff, 0xff,
-  0x22, 0x01, 0xff, 0xff, 0x1d, 0x01, 0xff, 0xff, 0x18, 0x01, 0xff, 0xff,
-  0x14, 0x01, 0xff, 0xff, 0x0f, 0x01, 0xff, 0xff, 0x0a, 0x01, 0xff, 0xff,
-  0x06, 0x01, 0xff, 0xff, 0x01, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff,
-  0xf9, 0x00, 0xff, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff,
-  0xec, 0x00, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xe3, 0x00, 0xff, 0xff,
-  0xdf, 0x00, 0xff, 0xff, 0xdb, 0x00, 0xff, 0xff, 0xd7, 0x00, 0xff, 0xff,
-  0xd3, 0x00, 0xff, 0xff, 0xcf, 0x00, 0xff, 0xff, 0xcb, 0x00, 0xff, 0xff,
-  0xc7, 0x00, 0xff, 0xff, 0xc3, 0x00, 0xff, 0xff, 0xbf, 0x00, 0xff, 0xff,
-  0xbb, 0x00, 0xff, 0xff, 0xb8, 0x00, 0xff, 0xff, 0xb4, 0x00, 0xff, 0xff,
-  0xb0, 0x00, 0xff, 0xff, 0xad, 0x00, 0xff, 0xff, 0xa9, 0x00, 0xff, 0xff,
-  0xa5, 0x00, 0xff, 0xff, 0xa2, 0x00, 0xff, 0xff, 0x9e, 0x00, 0xff, 0xff,
-  0x9b, 0x00, 0xff, 0xff, 0x97, 0x00, 0xff, 0xff, 0x94, 0x00, 0xff, 0xff,
-  0x91, 0x00, 0xff, 0xff, 0x8d, 0x00, 0xff, 0xff, 0x8a, 0x00, 0xff, 0xff,
-  0x87, 0x00, 0xff, 0xff, 0x84, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff,
-  0x7d, 0x00, 0xff, 0xff, 0x7a, 0x00, 0xff, 0xff, 0x77, 0x00, 0xff, 0xff,
-  0x74, 0x00, 0xff, 0xff, 0x71, 0x00, 0xff, 0xff, 0x6e, 0x00, 0xff, 0xff,
-  0x6b, 0x00, 0xff, 0xff, 0x69, 0x00, 0xff, 0xff, 0x66, 0x00, 0xff, 0xff,
-  0x63, 0x00, 0xff, 0xff, 0x60, 0x00, 0xff, 0xff, 0x5e, 0x00, 0xff, 0xff,
-  0x5b, 0x00, 0xff, 0xff, 0x58, 0x00, 0xff, 0xff, 0x56, 0x00, 0xff, 0xff,
-  0x53, 0x00, 0xff, 0xff, 0x51, 0x00, 0xff, 0xff, 0x4e, 0x00, 0xff, 0xff,
-  0x4c, 0x00, 0xff, 0xff, 0x49, 0x00, 0xff, 0xff, 0x47, 0x00, 0xff, 0xff,
-  0x45, 0x00, 0xff, 0xff, 0x42, 0x00, 0xff, 0xff, 0x40, 0x00, 0xff, 0xff,
-  0x3e, 0x00, 0xff, 0xff, 0x3c, 0x00, 0xff, 0xff, 0x3a, 0x00, 0xff, 0xff,
-  0x38, 0x00, 0xff, 0xff, 0x36, 0x00, 0xff, 0xff, 0x34, 0x00, 0xff, 0xff,
-  0x32, 0x00, 0xff, 0xff, 0x30, 0x00, 0xff, 0xff, 0x2e, 0x00, 0xff, 0xff,
-  0x2c, 0x00, 0xff, 0xff, 0x2a, 0x00, 0xff, 0xff, 0x28, 0x00, 0xff, 0xff,
-  0x27, 0x00, 0xff, 0xff, 0x25, 0x00, 0xff, 0xff, 0x23, 0x00, 0xff, 0xff,
-  0x22, 0x00, 0xff, 0xff, 0x20, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff,
-  0x1d, 0x00, 0xff, 0xff, 0x1c, 0x00, 0xff, 0xff, 0x1a, 0x00, 0xff, 0xff,
-  0x19, 0x00, 0xff, 0xff, 0x17, 0x00, 0xff, 0xff, 0x16, 0x00, 0xff, 0xff,
-  0x15, 0x00, 0xff, 0xff, 0x14, 0x00, 0xff, 0xff, 0x12, 0x00, 0xff, 0xff,
-  0x11, 0x00, 0xff, 0xff, 0x10, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff,
-  0x0e, 0x00, 0xff, 0xff, 0x0d, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff,
-  0x0b, 0x00, 0xff, 0xff, 0x0a, 0x00, 0xff, 0xff, 0x09, 0x00, 0xff, 0xff,
-  0x09, 0x00, 0xff, 0xff, 0x08, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff,
-  0x06, 0x00, 0xff, 0xff, 0x06, 0x00, 0xff, 0xff, 0x05, 0x00, 0xff, 0xff,
-  0x05, 0x00, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff,
-  0x03, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff,
-  0x02, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff,
-  0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff,
-  0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff,
-  0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff,
-  0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff,
-  0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff,
-  0x02, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff,
-  0x04, 0x00, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff, 0x05, 0x00, 0xff, 0xff,
-  0x05, 0x00, 0xff, 0xff, 0x06, 0x00, 0xff, 0xff, 0x06, 0x00, 0xff, 0xff,
-  0x07, 0x00, 0xff, 0xff, 0x08, 0x00, 0xff, 0xff, 0x09, 0x00, 0xff, 0xff,
-  0x09, 0x00, 0xff, 0xff, 0x0a, 0x00, 0xff, 0xff, 0x0b, 0x00, 0xff, 0xff,
-  0x0c, 0x00, 0xff, 0xff, 0x0d, 0x00, 0xff, 0xff, 0x0e, 0x00, 0xff, 0xff,
-  0x0f, 0x00, 0xff, 0xff, 0x10, 0x00, 0xff, 0xff, 0x11, 0x00, 0xff, 0xff,
-  0x12, 0x00, 0xff, 0xff, 0x14, 0x00, 0xff, 0xff, 0x15, 0x00, 0xff, 0xff,
-  0x16, 0x00, 0xff, 0xff, 0x17, 0x00, 0xff, 0xff, 0x19, 0x00, 0xff, 0xff,
-  0x1a, 0x00, 0xff, 0xff, 0x1c, 0x00, 0xff, 0xff, 0x1d, 0x00, 0xff, 0xff,
-  0x1f, 0x00, 0xff, 0xff, 0x20, 0x00, 0xff, 0xff, 0x22, 0x00, 0xff, 0xff,
-  0x23, 0x00, 0xff, 0xff, 0x25, 0x00, 0xff, 0xff, 0x27, 0x00, 0xff, 0xff,
-  0x28, 0x00, 0xff, 0xff, 0x2a, 0x00, 0xff, 0xff, 0x2c, 0x00, 0xff, 0xff,
-  0x2e, 0x00, 0xff, 0xff, 0x30, 0x00, 0xff, 0xff, 0x32, 0x00, 0xff, 0xff,
-  0x34, 0x00, 0xff, 0xff, 0x36, 0x00, 0xff, 0xff, 0x38, 0x00, 0xff, 0xff,
-  0x3a, 0x00, 0xff, 0xff, 0x3c, 0x00, 0xff, 0xff, 0x3e, 0x00, 0xff, 0xff,
-  0x40, 0x00, 0xff, 0xff, 0x42, 0x00, 0xff, 0xff, 0x45, 0x00, 0xff, 0xff,
-  0x47, 0x00, 0xff, 0xff, 0x49, 0x00, 0xff, 0xff, 0x4c, 0x00, 0xff, 0xff,
-  0x4e, 0x00, 0xff, 0xff, 0x51, 0x00, 0xff, 0xff, 0x53, 0x00, 0xff, 0xff,
-  0x56, 0x00, 0xff, 0xff, 0x58, 0x00, 0xff, 0xff, 0x5b, 0x00, 0xff, 0xff,
-  0x5e, 0x00, 0xff, 0xff, 0x60, 0x00, 0xff, 0xff, 0x63, 0x00, 0xff, 0xff,
-  0x66, 0x00, 0xff, 0xff, 0x69, 0x00, 0xff, 0xff, 0x6b, 0x00, 0xff, 0xff,
-  0x6e, 0x00, 0xff, 0xff, 0x71, 0x00, 0xff, 0xff, 0x74, 0x00, 0xff, 0xff,
-  0x77, 0x00, 0xff, 0xff, 0x7a, 0x00, 0xff, 0xff, 0x7d, 0x00, 0xff, 0xff,
-  0x80, 0x00, 0xff, 0xff, 0x84, 0x00, 0xff, 0xff, 0x87, 0x00, 0xff, 0xff,
-  0x8a, 0x00, 0xff, 0xff, 0x8d, 0x00, 0xff, 0xff, 0x91, 0x00, 0xff, 0xff,
-  0x94, 0x00, 0xff, 0xff, 0x97, 0x00, 0xff, 0xff, 0x9b, 0x00, 0xff, 0xff,
-  0x9e, 0x00, 0xff, 0xff, 0xa2, 0x00, 0xff, 0xff, 0xa5, 0x00, 0xff, 0xff,
-  0xa9, 0x00, 0xff, 0xff, 0xad, 0x00, 0xff, 0xff, 0xb0, 0x00, 0xff, 0xff,
-  0xb4, 0x00, 0xff, 0xff, 0xb8, 0x00, 0xff, 0xff, 0xbb, 0x00, 0xff, 0xff,
-  0xbf, 0x00, 0xff, 0xff, 0xc3, 0x00, 0xff, 0xff, 0xc7, 0x00, 0xff, 0xff,
-  0xcb, 0x00, 0xff, 0xff, 0xcf, 0x00, 0xff, 0xff, 0xd3, 0x00, 0xff, 0xff,
-  0xd7, 0x00, 0xff, 0xff, 0xdb, 0x00, 0xff, 0xff, 0xdf, 0x00, 0xff, 0xff,
-  0xe3, 0x00, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xec, 0x00, 0xff, 0xff,
-  0xf0, 0x00, 0xff, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff,
-  0xfd, 0x00, 0xff, 0xff, 0x01, 0x01, 0xff, 0xff, 0x06, 0x01, 0xff, 0xff,
-  0x0a, 0x01, 0xff, 0xff, 0x0f, 0x01, 0xff, 0xff, 0x14, 0x01, 0xff, 0xff,
-  0x18, 0x01, 0xff, 0xff, 0x1d, 0x01, 0xff, 0xff, 0x22, 0x01, 0xff, 0xff,
-  0x26, 0x01, 0xff, 0xff, 0x2b, 0x01, 0xff, 0xff, 0x30, 0x01, 0xff, 0xff,
-  0x35, 0x01, 0xff, 0xff, 0x3a, 0x01, 0xff, 0xff, 0x3f, 0x01, 0xff, 0xff,
-  0x44, 0x01, 0xff, 0xff, 0x49, 0x01, 0xff, 0xff, 0x4e, 0x01, 0xff, 0xff,
-  0x53, 0x01, 0xff, 0xff, 0x58, 0x01, 0xff, 0xff, 0x5d, 0x01, 0xff, 0xff,
-  0x62, 0x01, 0xff, 0xff, 0x67, 0x01, 0xff, 0xff, 0x6d, 0x01, 0xff, 0xff,
-  0x72, 0x01, 0xff, 0xff, 0x77, 0x01, 0xff, 0xff, 0x7d, 0x01, 0xff, 0xff,
-  0x82, 0x01, 0xff, 0xff, 0x88, 0x01, 0xff, 0xff, 0x8d, 0x01, 0xff, 0xff,
-  0x93, 0x01, 0xff, 0xff, 0x98, 0x01, 0xff, 0xff, 0x9e, 0x01, 0xff, 0xff,
-  0xa3, 0x01, 0xff, 0xff, 0xa9, 0x01, 0xff, 0xff, 0xaf, 0x01, 0xff, 0xff,
-  0xb5, 0x01, 0xff, 0xff, 0xba, 0x01, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff,
-  0xc6, 0x01, 0xff, 0xff, 0xcc, 0x01, 0xff, 0xff, 0xd2, 0x01, 0xff, 0xff,
-  0xd8, 0x01, 0xff, 0xff, 0xde, 0x01, 0xff, 0xff, 0xe4, 0x01, 0xff, 0xff,
-  0xea, 0x01, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xf7, 0x01, 0xff, 0xff,
-  0xfd, 0x01, 0xff, 0xff, 0x03, 0x02, 0xff, 0xff, 0x09, 0x02, 0xff, 0xff,
-  0x10, 0x02, 0xff, 0xff, 0x16, 0x02, 0xff, 0xff, 0x1d, 0x02, 0xff, 0xff,
-  0x23, 0x02, 0xff, 0xff, 0x2a, 0x02, 0xff, 0xff, 0x30, 0x02, 0xff, 0xff,
-  0x37, 0x02, 0xff, 0xff, 0x3d, 0x02, 0xff, 0xff, 0x44, 0x02, 0xff, 0xff,
-  0x4b, 0x02, 0xff, 0xff, 0x51, 0x02, 0xff, 0xff, 0x58, 0x02, 0xff, 0xff,
-  0x5f, 0x02, 0xff, 0xff, 0x66, 0x02, 0xff, 0xff, 0x6d, 0x02, 0xff, 0xff,
-  0x74, 0x02, 0xff, 0xff, 0x7a, 0x02, 0xff, 0xff, 0x81, 0x02, 0xff, 0xff,
-  0x89, 0x02, 0xff, 0xff, 0x90, 0x02, 0xff, 0xff, 0x97, 0x02, 0xff, 0xff,
-  0x9e, 0x02, 0xff, 0xff, 0xa5, 0x02, 0xff, 0xff, 0xac, 0x02, 0xff, 0xff,
-  0xb4, 0x02, 0xff, 0xff, 0xbb, 0x02, 0xff, 0xff, 0xc2, 0x02, 0xff, 0xff,
-  0xca, 0x02, 0xff, 0xff, 0xd1, 0x02, 0xff, 0xff, 0xd8, 0x02, 0xff, 0xff,
-  0xe0, 0x02, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xef, 0x02, 0xff, 0xff,
-  0xf7, 0x02, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff, 0x06, 0x03, 0xff, 0xff,
-  0x0e, 0x03, 0xff, 0xff, 0x15, 0x03, 0xff, 0xff, 0x1d, 0x03, 0xff, 0xff,
-  0x25, 0x03, 0xff, 0xff, 0x2d, 0x03, 0xff, 0xff, 0x35, 0x03, 0xff, 0xff,
-  0x3d, 0x03, 0xff, 0xff, 0x45, 0x03, 0xff, 0xff, 0x4d, 0x03, 0xff, 0xff,
-  0x55, 0x03, 0xff, 0xff, 0x5d, 0x03, 0xff, 0xff, 0x65, 0x03, 0xff, 0xff,
-  0x6d, 0x03, 0xff, 0xff, 0x75, 0x03, 0xff, 0xff, 0x7e, 0x03, 0xff, 0xff,
-  0x86, 0x03, 0xff, 0xff, 0x8e, 0x03, 0xff, 0xff, 0x97, 0x03, 0xff, 0xff,
-  0x9f, 0x03, 0xff, 0xff, 0xa7, 0x03, 0xff, 0xff, 0xb0, 0x03, 0xff, 0xff,
-  0xb8, 0x03, 0xff, 0xff, 0xc1, 0x03, 0xff, 0xff, 0xca, 0x03, 0xff, 0xff,
-  0xd2, 0x03, 0xff, 0xff, 0xdb, 0x03, 0xff, 0xff, 0xe4, 0x03, 0xff, 0xff,
-  0xec, 0x03, 0xff, 0xff, 0xf5, 0x03, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff,
-  0x07, 0x04, 0xff, 0xff, 0x10, 0x04, 0xff, 0xff, 0x19, 0x04, 0xff, 0xff,
-  0x22, 0x04, 0xff, 0xff, 0x2b, 0x04, 0xff, 0xff, 0x34, 0x04, 0xff, 0xff,
-  0x3d, 0x04, 0xff, 0xff, 0x46, 0x04, 0xff, 0xff, 0x4f, 0x04, 0xff, 0xff,
-  0x58, 0x04, 0xff, 0xff, 0x62, 0x04, 0xff, 0xff, 0x6b, 0x04, 0xff, 0xff,
-  0x74, 0x04, 0xff, 0xff, 0x7d, 0x04, 0xff, 0xff, 0x87, 0x04, 0xff, 0xff,
-  0x90, 0x04, 0xff, 0xff, 0x9a, 0x04, 0xff, 0xff, 0xa3, 0x04, 0xff, 0xff,
-  0xad, 0x04, 0xff, 0xff, 0xb6, 0x04, 0xff, 0xff, 0xc0, 0x04, 0xff, 0xff,
-  0xca, 0x04, 0xff, 0xff, 0xd3, 0x04, 0xff, 0xff, 0xdd, 0x04, 0xff, 0xff,
-  0xe7, 0x04, 0xff, 0xff, 0xf1, 0x04, 0xff, 0xff, 0xfb, 0x04, 0xff, 0xff,
-  0x04, 0x05, 0xff, 0xff, 0x0e, 0x05, 0xff, 0xff, 0x18, 0x05, 0xff, 0xff,
-  0x22, 0x05, 0xff, 0xff, 0x2c, 0x05, 0xff, 0xff, 0x36, 0x05, 0xff, 0xff,
-  0x40, 0x05, 0xff, 0xff, 0x4b, 0x05, 0xff, 0xff, 0x55, 0x05, 0xff, 0xff,
-  0x5f, 0x05, 0xff, 0xff, 0x69, 0x05, 0xff, 0xff, 0x74, 0x05, 0xff, 0xff,
-  0x7e, 0x05, 0xff, 0xff, 0x88, 0x05, 0xff, 0xff, 0x93, 0x05, 0xff, 0xff,
-  0x9d, 0x05, 0xff, 0xff, 0xa8, 0x05, 0xff, 0xff, 0xb2, 0x05, 0xff, 0xff,
-  0xbd, 0x05, 0xff, 0xff, 0xc7, 0x05, 0xff, 0xff, 0xd2, 0x05, 0xff, 0xff,
-  0xdd, 0x05, 0xff, 0xff, 0xe7, 0x05, 0xff, 0xff, 0xf2, 0x05, 0xff, 0xff,
-  0xfd, 0x05, 0xff, 0xff, 0x08, 0x06, 0xff, 0xff, 0x13, 0x06, 0xff, 0xff,
-  0x1d, 0x06, 0xff, 0xff, 0x28, 0x06, 0xff, 0xff, 0x33, 0x06, 0xff, 0xff,
-  0x3e, 0x06, 0xff, 0xff, 0x49, 0x06, 0xff, 0xff, 0x55, 0x06, 0xff, 0xff,
-  0x60, 0x06, 0xff, 0xff, 0x6b, 0x06, 0xff, 0xff, 0x76, 0x06, 0xff, 0xff,
-  0x81, 0x06, 0xff, 0xff, 0x8d, 0x06, 0xff, 0xff, 0x98, 0x06, 0xff, 0xff,
-  0xa3, 0x06, 0xff, 0xff, 0xaf, 0x06, 0xff, 0xff, 0xba, 0x06, 0xff, 0xff,
-  0xc5, 0x06, 0xff, 0xff, 0xd1, 0x06, 0xff, 0xff, 0xdd, 0x06, 0xff, 0xff,
-  0xe8, 0x06, 0xff, 0xff, 0xf4, 0x06, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff,
-  0x0b, 0x07, 0xff, 0xff, 0x17, 0x07, 0xff, 0xff, 0x23, 0x07, 0xff, 0xff,
-  0x2e, 0x07, 0xff, 0xff, 0x3a, 0x07, 0xff, 0xff, 0x46, 0x07, 0xff, 0xff,
-  0x52, 0x07, 0xff, 0xff, 0x5e, 0x07, 0xff, 0xff, 0x6a, 0x07, 0xff, 0xff,
-  0x76, 0x07, 0xff, 0xff, 0x82, 0x07, 0xff, 0xff, 0x8e, 0x07, 0xff, 0xff,
-  0x9a, 0x07, 0xff, 0xff, 0xa6, 0x07, 0xff, 0xff, 0xb3, 0x07, 0xff, 0xff,
-  0xbf, 0x07, 0xff, 0xff, 0xcb, 0x07, 0xff, 0xff, 0xd8, 0x07, 0xff, 0xff,
-  0xe4, 0x07, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xfd, 0x07, 0xff, 0xff,
-  0x09, 0x08, 0xff, 0xff, 0x16, 0x08, 0xff, 0xff, 0x22, 0x08, 0xff, 0xff,
-  0x2f, 0x08, 0xff, 0xff, 0x3b, 0x08, 0xff, 0xff, 0x48, 0x08, 0xff, 0xff,
-  0x55, 0x08, 0xff, 0xff, 0x62, 0x08, 0xff, 0xff, 0x6e, 0x08, 0xff, 0xff,
-  0x7b, 0x08, 0xff, 0xff, 0x88, 0x08, 0xff, 0xff, 0x95, 0x08, 0xff, 0xff,
-  0xa2, 0x08, 0xff, 0xff, 0xaf, 0x08, 0xff, 0xff, 0xbc, 0x08, 0xff, 0xff,
-  0xc9, 0x08, 0xff, 0xff, 0xd6, 0x08, 0xff, 0xff, 0xe3, 0x08, 0xff, 0xff,
-  0xf0, 0x08, 0xff, 0xff, 0xfd, 0x08, 0xff, 0xff, 0x0b, 0x09, 0xff, 0xff,
-  0x18, 0x09, 0xff, 0xff, 0x25, 0x09, 0xff, 0xff, 0x32, 0x09, 0xff, 0xff,
-  0x40, 0x09, 0xff, 0xff, 0x4d, 0x09, 0xff, 0xff, 0x5b, 0x09, 0xff, 0xff,
-  0x68, 0x09, 0xff, 0xff, 0x76, 0x09, 0xff, 0xff, 0x83, 0x09, 0xff, 0xff,
-  0x91, 0x09, 0xff, 0xff, 0x9e, 0x09, 0xff, 0xff, 0xac, 0x09, 0xff, 0xff,
-  0xba, 0x09, 0xff, 0xff, 0xc8, 0x09, 0xff, 0xff, 0xd5, 0x09, 0xff, 0xff,
-  0xe3, 0x09, 0xff, 0xff, 0xf1, 0x09, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff,
-  0x0d, 0x0a, 0xff, 0xff, 0x1b, 0x0a, 0xff, 0xff, 0x29, 0x0a, 0xff, 0xff,
-  0x37, 0x0a, 0xff, 0xff, 0x45, 0x0a, 0xff, 0xff, 0x53, 0x0a, 0xff, 0xff,
-  0x61, 0x0a, 0xff, 0xff, 0x6f, 0x0a, 0xff, 0xff, 0x7e, 0x0a, 0xff, 0xff,
-  0x8c, 0x0a, 0xff, 0xff, 0x9a, 0x0a, 0xff, 0xff, 0xa8, 0x0a, 0xff, 0xff,
-  0xb7, 0x0a, 0xff, 0xff, 0xc5, 0x0a, 0xff, 0xff, 0xd4, 0x0a, 0xff, 0xff,
-  0xe2, 0x0a, 0xff, 0xff, 0xf1, 0x0a, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff,
-  0x0e, 0x0b, 0xff, 0xff, 0x1c, 0x0b, 0xff, 0xff, 0x2b, 0x0b, 0xff, 0xff,
-  0x3a, 0x0b, 0xff, 0xff, 0x48, 0x0b, 0xff, 0xff, 0x57, 0x0b, 0xff, 0xff,
-  0x66, 0x0b, 0xff, 0xff, 0x75, 0x0b, 0xff, 0xff, 0x84, 0x0b, 0xff, 0xff,
-  0x93, 0x0b, 0xff, 0xff, 0xa2, 0x0b, 0xff, 0xff, 0xb1, 0x0b, 0xff, 0xff,
-  0xc0, 0x0b, 0xff, 0xff, 0xcf, 0x0b, 0xff, 0xff, 0xde, 0x0b, 0xff, 0xff,
-  0xed, 0x0b, 0xff, 0xff, 0xfc, 0x0b, 0xff, 0xff, 0x0b, 0x0c, 0xff, 0xff,
-  0x1b, 0x0c, 0xff, 0xff, 0x2a, 0x0c, 0xff, 0xff, 0x39, 0x0c, 0xff, 0xff,
-  0x49, 0x0c, 0xff, 0xff, 0x58, 0x0c, 0xff, 0xff, 0x68, 0x0c, 0xff, 0xff,
-  0x77, 0x0c, 0xff, 0xff, 0x87, 0x0c, 0xff, 0xff, 0x96, 0x0c, 0xff, 0xff,
-  0xa6, 0x0c, 0xff, 0xff, 0xb5, 0x0c, 0xff, 0xff, 0xc5, 0x0c, 0xff, 0xff,
-  0xd5, 0x0c, 0xff, 0xff, 0xe4, 0x0c, 0xff, 0xff, 0xf4, 0x0c, 0xff, 0xff,
-  0x04, 0x0d, 0xff, 0xff, 0x14, 0x0d, 0xff, 0xff, 0x24, 0x0d, 0xff, 0xff,
-  0x34, 0x0d, 0xff, 0xff, 0x43, 0x0d, 0xff, 0xff, 0x53, 0x0d, 0xff, 0xff,
-  0x64, 0x0d, 0xff, 0xff, 0x74, 0x0d, 0xff, 0xff, 0x84, 0x0d, 0xff, 0xff,
-  0x94, 0x0d, 0xff, 0xff, 0xa4, 0x0d, 0xff, 0xff, 0xb4, 0x0d, 0xff, 0xff,
-  0xc4, 0x0d, 0xff, 0xff, 0xd5, 0x0d, 0xff, 0xff, 0xe5, 0x0d, 0xff, 0xff,
-  0xf5, 0x0d, 0xff, 0xff, 0x06, 0x0e, 0xff, 0xff, 0x16, 0x0e, 0xff, 0xff,
-  0x27, 0x0e, 0xff, 0xff, 0x37, 0x0e, 0xff, 0xff, 0x48, 0x0e, 0xff, 0xff,
-  0x58, 0x0e, 0xff, 0xff, 0x69, 0x0e, 0xff, 0xff, 0x79, 0x0e, 0xff, 0xff,
-  0x8a, 0x0e, 0xff, 0xff, 0x9b, 0x0e, 0xff, 0xff, 0xac, 0x0e, 0xff, 0xff,
-  0xbc, 0x0e, 0xff, 0xff, 0xcd, 0x0e, 0xff, 0xff, 0xde, 0x0e, 0xff, 0xff,
-  0xef, 0x0e, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x11, 0x0f, 0xff, 0xff,
-  0x22, 0x0f, 0xff, 0xff, 0x33, 0x0f, 0xff, 0xff, 0x44, 0x0f, 0xff, 0xff,
-  0x55, 0x0f, 0xff, 0xff, 0x66, 0x0f, 0xff, 0xff, 0x77, 0x0f, 0xff, 0xff,
-  0x89, 0x0f, 0xff, 0xff, 0x9a, 0x0f, 0xff, 0xff, 0xab, 0x0f, 0xff, 0xff,
-  0xbd, 0x0f, 0xff, 0xff, 0xce, 0x0f, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff,
-  0xf1, 0x0f, 0xff, 0xff, 0x02, 0x10, 0xff, 0xff, 0x14, 0x10, 0xff, 0xff,
-  0x25, 0x10, 0xff, 0xff, 0x37, 0x10, 0xff, 0xff, 0x49, 0x10, 0xff, 0xff,
-  0x5a, 0x10, 0xff, 0xff, 0x6c, 0x10, 0xff, 0xff, 0x7e, 0x10, 0xff, 0xff,
-  0x8f, 0x10, 0xff, 0xff, 0xa1, 0x10, 0xff, 0xff, 0xb3, 0x10, 0xff, 0xff,
-  0xc5, 0x10, 0xff, 0xff, 0xd7, 0x10, 0xff, 0xff, 0xe9, 0x10, 0xff, 0xff,
-  0xfb, 0x10, 0xff, 0xff, 0x0d, 0x11, 0xff, 0xff, 0x1f, 0x11, 0xff, 0xff,
-  0x31, 0x11, 0xff, 0xff, 0x43, 0x11, 0xff, 0xff, 0x55, 0x11, 0xff, 0xff,
-  0x67, 0x11, 0xff, 0xff, 0x7a, 0x11, 0xff, 0xff, 0x8c, 0x11, 0xff, 0xff,
-  0x9e, 0x11, 0xff, 0xff, 0xb1, 0x11, 0xff, 0xff, 0xc3, 0x11, 0xff, 0xff,
-  0xd5, 0x11, 0xff, 0xff, 0xe8, 0x11, 0xff, 0xff, 0xfa, 0x11, 0xff, 0xff,
-  0x0d, 0x12, 0xff, 0xff, 0x1f, 0x12, 0xff, 0xff, 0x32, 0x12, 0xff, 0xff,
-  0x45, 0x12, 0xff, 0xff, 0x57, 0x12, 0xff, 0xff, 0x6a, 0x12, 0xff, 0xff,
-  0x7d, 0x12, 0xff, 0xff, 0x8f, 0x12, 0xff, 0xff, 0xa2, 0x12, 0xff, 0xff,
-  0xb5, 0x12, 0xff, 0xff, 0xc8, 0x12, 0xff, 0xff, 0xdb, 0x12, 0xff, 0xff,
-  0xee, 0x12, 0xff, 0xff, 0x01, 0x13, 0xff, 0xff, 0x14, 0x13, 0xff, 0xff,
-  0x27, 0x13, 0xff, 0xff, 0x3a, 0x13, 0xff, 0xff, 0x4d, 0x13, 0xff, 0xff,
-  0x60, 0x13, 0xff, 0xff, 0x74, 0x13, 0xff, 0xff, 0x87, 0x13, 0xff, 0xff,
-  0x9a, 0x13, 0xff, 0xff, 0xad, 0x13, 0xff, 0xff, 0xc1, 0x13, 0xff, 0xff,
-  0xd4, 0x13, 0xff, 0xff, 0xe7, 0x13, 0xff, 0xff, 0xfb, 0x13, 0xff, 0xff,
-  0x0e, 0x14, 0xff, 0xff, 0x22, 0x14, 0xff, 0xff, 0x35, 0x14, 0xff, 0xff,
-  0x49, 0x14, 0xff, 0xff, 0x5d, 0x14, 0xff, 0xff, 0x70, 0x14, 0xff, 0xff,
-  0x84, 0x14, 0xff, 0xff, 0x98, 0x14, 0xff, 0xff, 0xac, 0x14, 0xff, 0xff,
-  0xbf, 0x14, 0xff, 0xff, 0xd3, 0x14, 0xff, 0xff, 0xe7, 0x14, 0xff, 0xff,
-  0xfb, 0x14, 0xff, 0xff, 0x0f, 0x15, 0xff, 0xff, 0x23, 0x15, 0xff, 0xff,
-  0x37, 0x15, 0xff, 0xff, 0x4b, 0x15, 0xff, 0xff, 0x5f, 0x15, 0xff, 0xff,
-  0x73, 0x15, 0xff, 0xff, 0x87, 0x15, 0xff, 0xff, 0x9c, 0x15, 0xff, 0xff,
-  0xb0, 0x15, 0xff, 0xff, 0xc4, 0x15, 0xff, 0xff, 0xd8, 0x15, 0xff, 0xff,
-  0xed, 0x15, 0xff, 0xff, 0x01, 0x16, 0xff, 0xff, 0x15, 0x16, 0xff, 0xff,
-  0x2a, 0x16, 0xff, 0xff, 0x3e, 0x16, 0xff, 0xff, 0x53, 0x16, 0xff, 0xff,
-  0x67, 0x16, 0xff, 0xff, 0x7c, 0x16, 0xff, 0xff, 0x91, 0x16, 0xff, 0xff,
-  0xa5, 0x16, 0xff, 0xff, 0xba, 0x16, 0xff, 0xff, 0xcf, 0x16, 0xff, 0xff,
-  0xe3, 0x16, 0xff, 0xff, 0xf8, 0x16, 0xff, 0xff, 0x0d, 0x17, 0xff, 0xff,
-  0x22, 0x17, 0xff, 0xff, 0x37, 0x17, 0xff, 0xff, 0x4c, 0x17, 0xff, 0xff,
-  0x61, 0x17, 0xff, 0xff, 0x76, 0x17, 0xff, 0xff, 0x8b, 0x17, 0xff, 0xff,
-  0xa0, 0x17, 0xff, 0xff, 0xb5, 0x17, 0xff, 0xff, 0xca, 0x17, 0xff, 0xff,
-  0xdf, 0x17, 0xff, 0xff, 0xf4, 0x17, 0xff, 0xff, 0x0a, 0x18, 0xff, 0xff,
-  0x1f, 0x18, 0xff, 0xff, 0x34, 0x18, 0xff, 0xff, 0x4a, 0x18, 0xff, 0xff,
-  0x5f, 0x18, 0xff, 0xff, 0x74, 0x18, 0xff, 0xff, 0x8a, 0x18, 0xff, 0xff,
-  0x9f, 0x18, 0xff, 0xff, 0xb5, 0x18, 0xff, 0xff, 0xcb, 0x18, 0xff, 0xff,
-  0xe0, 0x18, 0xff, 0xff, 0xf6, 0x18, 0xff, 0xff, 0x0b, 0x19, 0xff, 0xff,
-  0x21, 0x19, 0xff, 0xff, 0x37, 0x19, 0xff, 0xff, 0x4d, 0x19, 0xff, 0xff,
-  0x62, 0x19, 0xff, 0xff, 0x78, 0x19, 0xff, 0xff, 0x8e, 0x19, 0xff, 0xff,
-  0xa4, 0x19, 0xff, 0xff, 0xba, 0x19, 0xff, 0xff, 0xd0, 0x19, 0xff, 0xff,
-  0xe6, 0x19, 0xff, 0xff, 0xfc, 0x19, 0xff, 0xff, 0x12, 0x1a, 0xff, 0xff,
-  0x28, 0x1a, 0xff, 0xff, 0x3e, 0x1a, 0xff, 0xff, 0x55, 0x1a, 0xff, 0xff,
-  0x6b, 0x1a, 0xff, 0xff, 0x81, 0x1a, 0xff, 0xff, 0x97, 0x1a, 0xff, 0xff,
-  0xae, 0x1a, 0xff, 0xff, 0xc4, 0x1a, 0xff, 0xff, 0xda, 0x1a, 0xff, 0xff,
-  0xf1, 0x1a, 0xff, 0xff, 0x07, 0x1b, 0xff, 0xff, 0x1e, 0x1b, 0xff, 0xff,
-  0x34, 0x1b, 0xff, 0xff, 0x4b, 0x1b, 0xff, 0xff, 0x61, 0x1b, 0xff, 0xff,
-  0x78, 0x1b, 0xff, 0xff, 0x8f, 0x1b, 0xff, 0xff, 0xa5, 0x1b, 0xff, 0xff,
-  0xbc, 0x1b, 0xff, 0xff, 0xd3, 0x1b, 0xff, 0xff, 0xea, 0x1b, 0xff, 0xff,
-  0x01, 0x1c, 0xff, 0xff, 0x17, 0x1c, 0xff, 0xff, 0x2e, 0x1c, 0xff, 0xff,
-  0x45, 0x1c, 0xff, 0xff, 0x5c, 0x1c, 0xff, 0xff, 0x73, 0x1c, 0xff, 0xff,
-  0x8a, 0x1c, 0xff, 0xff, 0xa1, 0x1c, 0xff, 0xff, 0xb9, 0x1c, 0xff, 0xff,
-  0xd0, 0x1c, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xfe, 0x1c, 0xff, 0xff,
-  0x15, 0x1d, 0xff, 0xff, 0x2d, 0x1d, 0xff, 0xff, 0x44, 0x1d, 0xff, 0xff,
-  0x5b, 0x1d, 0xff, 0xff, 0x73, 0x1d, 0xff, 0xff, 0x8a, 0x1d, 0xff, 0xff,
-  0xa2, 0x1d, 0xff, 0xff, 0xb9, 0x1d, 0xff, 0xff, 0xd1, 0x1d, 0xff, 0xff,
-  0xe8, 0x1d, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x17, 0x1e, 0xff, 0xff,
-  0x2f, 0x1e, 0xff, 0xff, 0x47, 0x1e, 0xff, 0xff, 0x5e, 0x1e, 0xff, 0xff,
-  0x76, 0x1e, 0xff, 0xff, 0x8e, 0x1e, 0xff, 0xff, 0xa6, 0x1e, 0xff, 0xff,
-  0xbe, 0x1e, 0xff, 0xff, 0xd6, 0x1e, 0xff, 0xff, 0xee, 0x1e, 0xff, 0xff,
-  0x06, 0x1f, 0xff, 0xff, 0x1e, 0x1f, 0xff, 0xff, 0x36, 0x1f, 0xff, 0xff,
-  0x4e, 0x1f, 0xff, 0xff, 0x66, 0x1f, 0xff, 0xff, 0x7e, 0x1f, 0xff, 0xff,
-  0x96, 0x1f, 0xff, 0xff, 0xae, 0x1f, 0xff, 0xff, 0xc6, 0x1f, 0xff, 0xff,
-  0xdf, 0x1f, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff, 0x0f, 0x20, 0xff, 0xff,
-  0x28, 0x20, 0xff, 0xff, 0x40, 0x20, 0xff, 0xff, 0x59, 0x20, 0xff, 0xff,
-  0x71, 0x20, 0xff, 0xff, 0x8a, 0x20, 0xff, 0xff, 0xa2, 0x20, 0xff, 0xff,
-  0xbb, 0x20, 0xff, 0xff, 0xd3, 0x20, 0xff, 0xff, 0xec, 0x20, 0xff, 0xff,
-  0x05, 0x21, 0xff, 0xff, 0x1d, 0x21, 0xff, 0xff, 0x36, 0x21, 0xff, 0xff,
-  0x4f, 0x21, 0xff, 0xff, 0x68, 0x21, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff,
-  0x99, 0x21, 0xff, 0xff, 0xb2, 0x21, 0xff, 0xff, 0xcb, 0x21, 0xff, 0xff,
-  0xe4, 0x21, 0xff, 0xff, 0xfd, 0x21, 0xff, 0xff, 0x16, 0x22, 0xff, 0xff,
-  0x2f, 0x22, 0xff, 0xff, 0x48, 0x22, 0xff, 0xff, 0x62, 0x22, 0xff, 0xff,
-  0x7b, 0x22, 0xff, 0xff, 0x94, 0x22, 0xff, 0xff, 0xad, 0x22, 0xff, 0xff,
-  0xc7, 0x22, 0xff, 0xff, 0xe0, 0x22, 0xff, 0xff, 0xf9, 0x22, 0xff, 0xff,
-  0x13, 0x23, 0xff, 0xff, 0x2c, 0x23, 0xff, 0xff, 0x45, 0x23, 0xff, 0xff,
-  0x5f, 0x23, 0xff, 0xff, 0x78, 0x23, 0xff, 0xff, 0x92, 0x23, 0xff, 0xff,
-  0xac, 0x23, 0xff, 0xff, 0xc5, 0x23, 0xff, 0xff, 0xdf, 0x23, 0xff, 0xff,
-  0xf8, 0x23, 0xff, 0xff, 0x12, 0x24, 0xff, 0xff, 0x2c, 0x24, 0xff, 0xff,
-  0x46, 0x24, 0xff, 0xff, 0x5f, 0x24, 0xff, 0xff, 0x79, 0x24, 0xff, 0xff,
-  0x93, 0x24, 0xff, 0xff, 0xad, 0x24, 0xff, 0xff, 0xc7, 0x24, 0xff, 0xff,
-  0xe1, 0x24, 0xff, 0xff, 0xfb, 0x24, 0xff, 0xff, 0x15, 0x25, 0xff, 0xff,
-  0x2f, 0x25, 0xff, 0xff, 0x49, 0x25, 0xff, 0xff, 0x63, 0x25, 0xff, 0xff,
-  0x7e, 0x25, 0xff, 0xff, 0x98, 0x25, 0xff, 0xff, 0xb2, 0x25, 0xff, 0xff,
-  0xcc, 0x25, 0xff, 0xff, 0xe7, 0x25, 0xff, 0xff, 0x01, 0x26, 0xff, 0xff,
-  0x1b, 0x26, 0xff, 0xff, 0x36, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff,
-  0x6b, 0x26, 0xff, 0xff, 0x85, 0x26, 0xff, 0xff, 0xa0, 0x26, 0xff, 0xff,
-  0xba, 0x26, 0xff, 0xff, 0xd5, 0x26, 0xff, 0xff, 0xef, 0x26, 0xff, 0xff,
-  0x0a, 0x27, 0xff, 0xff, 0x25, 0x27, 0xff, 0xff, 0x3f, 0x27, 0xff, 0xff,
-  0x5a, 0x27, 0xff, 0xff, 0x75, 0x27, 0xff, 0xff, 0x90, 0x27, 0xff, 0xff,
-  0xab, 0x27, 0xff, 0xff, 0xc6, 0x27, 0xff, 0xff, 0xe1, 0x27, 0xff, 0xff,
-  0xfc, 0x27, 0xff, 0xff, 0x16, 0x28, 0xff, 0xff, 0x32, 0x28, 0xff, 0xff,
-  0x4d, 0x28, 0xff, 0xff, 0x68, 0x28, 0xff, 0xff, 0x83, 0x28, 0xff, 0xff,
-  0x9e, 0x28, 0xff, 0xff, 0xb9, 0x28, 0xff, 0xff, 0xd4, 0x28, 0xff, 0xff,
-  0xf0, 0x28, 0xff, 0xff, 0x0b, 0x29, 0xff, 0xff, 0x26, 0x29, 0xff, 0xff,
-  0x42, 0x29, 0xff, 0xff, 0x5d, 0x29, 0xff, 0xff, 0x78, 0x29, 0xff, 0xff,
-  0x94, 0x29, 0xff, 0xff, 0xaf, 0x29, 0xff, 0xff, 0xcb, 0x29, 0xff, 0xff,
-  0xe6, 0x29, 0xff, 0xff, 0x02, 0x2a, 0xff, 0xff, 0x1d, 0x2a, 0xff, 0xff,
-  0x39, 0x2a, 0xff, 0xff, 0x55, 0x2a, 0xff, 0xff, 0x70, 0x2a, 0xff, 0xff,
-  0x8c, 0x2a, 0xff, 0xff, 0xa8, 0x2a, 0xff, 0xff, 0xc4, 0x2a, 0xff, 0xff,
-  0xe0, 0x2a, 0xff, 0xff, 0xfb, 0x2a, 0xff, 0xff, 0x17, 0x2b, 0xff, 0xff,
-  0x33, 0x2b, 0xff, 0xff, 0x4f, 0x2b, 0xff, 0xff, 0x6b, 0x2b, 0xff, 0xff,
-  0x87, 0x2b, 0xff, 0xff, 0xa3, 0x2b, 0xff, 0xff, 0xbf, 0x2b, 0xff, 0xff,
-  0xdc, 0x2b, 0xff, 0xff, 0xf8, 0x2b, 0xff, 0xff, 0x14, 0x2c, 0xff, 0xff,
-  0x30, 0x2c, 0xff, 0xff, 0x4c, 0x2c, 0xff, 0xff, 0x69, 0x2c, 0xff, 0xff,
-  0x85, 0x2c, 0xff, 0xff, 0xa1, 0x2c, 0xff, 0xff, 0xbe, 0x2c, 0xff, 0xff,
-  0xda, 0x2c, 0xff, 0xff, 0xf6, 0x2c, 0xff, 0xff, 0x13, 0x2d, 0xff, 0xff,
-  0x2f, 0x2d, 0xff, 0xff, 0x4c, 0x2d, 0xff, 0xff, 0x69, 0x2d, 0xff, 0xff,
-  0x85, 0x2d, 0xff, 0xff, 0xa2, 0x2d, 0xff, 0xff, 0xbe, 0x2d, 0xff, 0xff,
-  0xdb, 0x2d, 0xff, 0xff, 0xf8, 0x2d, 0xff, 0xff, 0x15, 0x2e, 0xff, 0xff,
-  0x31, 0x2e, 0xff, 0xff, 0x4e, 0x2e, 0xff, 0xff, 0x6b, 0x2e, 0xff, 0xff,
-  0x88, 0x2e, 0xff, 0xff, 0xa5, 0x2e, 0xff, 0xff, 0xc2, 0x2e, 0xff, 0xff,
-  0xdf, 0x2e, 0xff, 0xff, 0xfc, 0x2e, 0xff, 0xff, 0x19, 0x2f, 0xff, 0xff,
-  0x36, 0x2f, 0xff, 0xff, 0x53, 0x2f, 0xff, 0xff, 0x70, 0x2f, 0xff, 0xff,
-  0x8d, 0x2f, 0xff, 0xff, 0xaa, 0x2f, 0xff, 0xff, 0xc8, 0x2f, 0xff, 0xff,
-  0xe5, 0x2f, 0xff, 0xff, 0x02, 0x30, 0xff, 0xff, 0x20, 0x30, 0xff, 0xff,
-  0x3d, 0x30, 0xff, 0xff, 0x5a, 0x30, 0xff, 0xff, 0x78, 0x30, 0xff, 0xff,
-  0x95, 0x30, 0xff, 0xff, 0xb3, 0x30, 0xff, 0xff, 0xd0, 0x30, 0xff, 0xff,
-  0xee, 0x30, 0xff, 0xff, 0x0b, 0x31, 0xff, 0xff, 0x29, 0x31, 0xff, 0xff,
-  0x46, 0x31, 0xff, 0xff, 0x64, 0x31, 0xff, 0xff, 0x82, 0x31, 0xff, 0xff,
-  0xa0, 0x31, 0xff, 0xff, 0xbd, 0x31, 0xff, 0xff, 0xdb, 0x31, 0xff, 0xff,
-  0xf9, 0x31, 0xff, 0xff, 0x17, 0x32, 0xff, 0xff, 0x35, 0x32, 0xff, 0xff,
-  0x53, 0x32, 0xff, 0xff, 0x70, 0x32, 0xff, 0xff, 0x8e, 0x32, 0xff, 0xff,
-  0xac, 0x32, 0xff, 0xff, 0xca, 0x32, 0xff, 0xff, 0xe9, 0x32, 0xff, 0xff,
-  0x07, 0x33, 0xff, 0xff, 0x25, 0x33, 0xff, 0xff, 0x43, 0x33, 0xff, 0xff,
-  0x61, 0x33, 0xff, 0xff, 0x7f, 0x33, 0xff, 0xff, 0x9e, 0x33, 0xff, 0xff,
-  0xbc, 0x33, 0xff, 0xff, 0xda, 0x33, 0xff, 0xff, 0xf9, 0x33, 0xff, 0xff,
-  0x17, 0x34, 0xff, 0xff, 0x35, 0x34, 0xff, 0xff, 0x54, 0x34, 0xff, 0xff,
-  0x72, 0x34, 0xff, 0xff, 0x91, 0x34, 0xff, 0xff, 0xaf, 0x34, 0xff, 0xff,
-  0xce, 0x34, 0xff, 0xff, 0xec, 0x34, 0xff, 0xff, 0x0b, 0x35, 0xff, 0xff,
-  0x2a, 0x35, 0xff, 0xff, 0x48, 0x35, 0xff, 0xff, 0x67, 0x35, 0xff, 0xff,
-  0x86, 0x35, 0xff, 0xff, 0xa5, 0x35, 0xff, 0xff, 0xc3, 0x35, 0xff, 0xff,
-  0xe2, 0x35, 0xff, 0xff, 0x01, 0x36, 0xff, 0xff, 0x20, 0x36, 0xff, 0xff,
-  0x3f, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x7d, 0x36, 0xff, 0xff,
-  0x9c, 0x36, 0xff, 0xff, 0xbb, 0x36, 0xff, 0xff, 0xda, 0x36, 0xff, 0xff,
-  0xf9, 0x36, 0xff, 0xff, 0x18, 0x37, 0xff, 0xff, 0x37, 0x37, 0xff, 0xff,
-  0x57, 0x37, 0xff, 0xff, 0x76, 0x37, 0xff, 0xff, 0x95, 0x37, 0xff, 0xff,
-  0xb4, 0x37, 0xff, 0xff, 0xd4, 0x37, 0xff, 0xff, 0xf3, 0x37, 0xff, 0xff,
-  0x12, 0x38, 0xff, 0xff, 0x32, 0x38, 0xff, 0xff, 0x51, 0x38, 0xff, 0xff,
-  0x71, 0x38, 0xff, 0xff, 0x90, 0x38, 0xff, 0xff, 0xb0, 0x38, 0xff, 0xff,
-  0xcf, 0x38, 0xff, 0xff, 0xef, 0x38, 0xff, 0xff, 0x0f, 0x39, 0xff, 0xff,
-  0x2e, 0x39, 0xff, 0xff, 0x4e, 0x39, 0xff, 0xff, 0x6e, 0x39, 0xff, 0xff,
-  0x8d, 0x39, 0xff, 0xff, 0xad, 0x39, 0xff, 0xff, 0xcd, 0x39, 0xff, 0xff,
-  0xed, 0x39, 0xff, 0xff, 0x0d, 0x3a, 0xff, 0xff, 0x2c, 0x3a, 0xff, 0xff,
-  0x4c, 0x3a, 0xff, 0xff, 0x6c, 0x3a, 0xff, 0xff, 0x8c, 0x3a, 0xff, 0xff,
-  0xac, 0x3a, 0xff, 0xff, 0xcc, 0x3a, 0xff, 0xff, 0xec, 0x3a, 0xff, 0xff,
-  0x0c, 0x3b, 0xff, 0xff, 0x2d, 0x3b, 0xff, 0xff, 0x4d, 0x3b, 0xff, 0xff,
-  0x6d, 0x3b, 0xff, 0xff, 0x8d, 0x3b, 0xff, 0xff, 0xad, 0x3b, 0xff, 0xff,
-  0xce, 0x3b, 0xff, 0xff, 0xee, 0x3b, 0xff, 0xff, 0x0e, 0x3c, 0xff, 0xff,
-  0x2f, 0x3c, 0xff, 0xff, 0x4f, 0x3c, 0xff, 0xff, 0x6f, 0x3c, 0xff, 0xff,
-  0x90, 0x3c, 0xff, 0xff, 0xb0, 0x3c, 0xff, 0xff, 0xd1, 0x3c, 0xff, 0xff,
-  0xf1, 0x3c, 0xff, 0xff, 0x12, 0x3d, 0xff, 0xff, 0x33, 0x3d, 0xff, 0xff,
-  0x53, 0x3d, 0xff, 0xff, 0x74, 0x3d, 0xff, 0xff, 0x95, 0x3d, 0xff, 0xff,
-  0xb5, 0x3d, 0xff, 0xff, 0xd6, 0x3d, 0xff, 0xff, 0xf7, 0x3d, 0xff, 0xff,
-  0x18, 0x3e, 0xff, 0xff, 0x38, 0x3e, 0xff, 0xff, 0x59, 0x3e, 0xff, 0xff,
-  0x7a, 0x3e, 0xff, 0xff, 0x9b, 0x3e, 0xff, 0xff, 0xbc, 0x3e, 0xff, 0xff,
-  0xdd, 0x3e, 0xff, 0xff, 0xfe, 0x3e, 0xff, 0xff, 0x1f, 0x3f, 0xff, 0xff,
-  0x40, 0x3f, 0xff, 0xff, 0x61, 0x3f, 0xff, 0xff, 0x82, 0x3f, 0xff, 0xff,
-  0xa4, 0x3f, 0xff, 0xff, 0xc5, 0x3f, 0xff, 0xff, 0xe6, 0x3f, 0xff, 0xff,
-  0x07, 0x40, 0xff, 0xff, 0x28, 0x40, 0xff, 0xff, 0x4a, 0x40, 0xff, 0xff,
-  0x6b, 0x40, 0xff, 0xff, 0x8c, 0x40, 0xff, 0xff, 0xae, 0x40, 0xff, 0xff,
-  0xcf, 0x40, 0xff, 0xff, 0xf1, 0x40, 0xff, 0xff, 0x12, 0x41, 0xff, 0xff,
-  0x34, 0x41, 0xff, 0xff, 0x55, 0x41, 0xff, 0xff, 0x77, 0x41, 0xff, 0xff,
-  0x98, 0x41, 0xff, 0xff, 0xba, 0x41, 0xff, 0xff, 0xdc, 0x41, 0xff, 0xff,
-  0xfd, 0x41, 0xff, 0xff, 0x1f, 0x42, 0xff, 0xff, 0x41, 0x42, 0xff, 0xff,
-  0x62, 0x42, 0xff, 0xff, 0x84, 0x42, 0xff, 0xff, 0xa6, 0x42, 0xff, 0xff,
-  0xc8, 0x42, 0xff, 0xff, 0xea, 0x42, 0xff, 0xff, 0x0c, 0x43, 0xff, 0xff,
-  0x2e, 0x43, 0xff, 0xff, 0x4f, 0x43, 0xff, 0xff, 0x71, 0x43, 0xff, 0xff,
-  0x93, 0x43, 0xff, 0xff, 0xb6, 0x43, 0xff, 0xff, 0xd8, 0x43, 0xff, 0xff,
-  0xfa, 0x43, 0xff, 0xff, 0x1c, 0x44, 0xff, 0xff, 0x3e, 0x44, 0xff, 0xff,
-  0x60, 0x44, 0xff, 0xff, 0x82, 0x44, 0xff, 0xff, 0xa5, 0x44, 0xff, 0xff,
-  0xc7, 0x44, 0xff, 0xff, 0xe9, 0x44, 0xff, 0xff, 0x0c, 0x45, 0xff, 0xff,
-  0x2e, 0x45, 0xff, 0xff, 0x50, 0x45, 0xff, 0xff, 0x73, 0x45, 0xff, 0xff,
-  0x95, 0x45, 0xff, 0xff, 0xb8, 0x45, 0xff, 0xff, 0xda, 0x45, 0xff, 0xff,
-  0xfd, 0x45, 0xff, 0xff, 0x1f, 0x46, 0xff, 0xff, 0x42, 0x46, 0xff, 0xff,
-  0x64, 0x46, 0xff, 0xff, 0x87, 0x46, 0xff, 0xff, 0xaa, 0x46, 0xff, 0xff,
-  0xcc, 0x46, 0xff, 0xff, 0xef, 0x46, 0xff, 0xff, 0x12, 0x47, 0xff, 0xff,
-  0x35, 0x47, 0xff, 0xff, 0x57, 0x47, 0xff, 0xff, 0x7a, 0x47, 0xff, 0xff,
-  0x9d, 0x47, 0xff, 0xff, 0xc0, 0x47, 0xff, 0xff, 0xe3, 0x47, 0xff, 0xff,
-  0x06, 0x48, 0xff, 0xff, 0x29, 0x48, 0xff, 0xff, 0x4c, 0x48, 0xff, 0xff,
-  0x6f, 0x48, 0xff, 0xff, 0x92, 0x48, 0xff, 0xff, 0xb5, 0x48, 0xff, 0xff,
-  0xd8, 0x48, 0xff, 0xff, 0xfb, 0x48, 0xff, 0xff, 0x1e, 0x49, 0xff, 0xff,
-  0x41, 0x49, 0xff, 0xff, 0x65, 0x49, 0xff, 0xff, 0x88, 0x49, 0xff, 0xff,
-  0xab, 0x49, 0xff, 0xff, 0xce, 0x49, 0xff, 0xff, 0xf2, 0x49, 0xff, 0xff,
-  0x15, 0x4a, 0xff, 0xff, 0x38, 0x4a, 0xff, 0xff, 0x5c, 0x4a, 0xff, 0xff,
-  0x7f, 0x4a, 0xff, 0xff, 0xa3, 0x4a, 0xff, 0xff, 0xc6, 0x4a, 0xff, 0xff,
-  0xea, 0x4a, 0xff, 0xff, 0x0d, 0x4b, 0xff, 0xff, 0x31, 0x4b, 0xff, 0xff,
-  0x55, 0x4b, 0xff, 0xff, 0x78, 0x4b, 0xff, 0xff, 0x9c, 0x4b, 0xff, 0xff,
-  0xbf, 0x4b, 0xff, 0xff, 0xe3, 0x4b, 0xff, 0xff, 0x07, 0x4c, 0xff, 0xff,
-  0x2b, 0x4c, 0xff, 0xff, 0x4e, 0x4c, 0xff, 0xff, 0x72, 0x4c, 0xff, 0xff,
-  0x96, 0x4c, 0xff, 0xff, 0xba, 0x4c, 0xff, 0xff, 0xde, 0x4c, 0xff, 0xff,
-  0x02, 0x4d, 0xff, 0xff, 0x26, 0x4d, 0xff, 0xff, 0x4a, 0x4d, 0xff, 0xff,
-  0x6e, 0x4d, 0xff, 0xff, 0x92, 0x4d, 0xff, 0xff, 0xb6, 0x4d, 0xff, 0xff,
-  0xda, 0x4d, 0xff, 0xff, 0xfe, 0x4d, 0xff, 0xff, 0x22, 0x4e, 0xff, 0xff,
-  0x46, 0x4e, 0xff, 0xff, 0x6a, 0x4e, 0xff, 0xff, 0x8f, 0x4e, 0xff, 0xff,
-  0xb3, 0x4e, 0xff, 0xff, 0xd7, 0x4e, 0xff, 0xff, 0xfc, 0x4e, 0xff, 0xff,
-  0x20, 0x4f, 0xff, 0xff, 0x44, 0x4f, 0xff, 0xff, 0x69, 0x4f, 0xff, 0xff,
-  0x8d, 0x4f, 0xff, 0xff, 0xb1, 0x4f, 0xff, 0xff, 0xd6, 0x4f, 0xff, 0xff,
-  0xfa, 0x4f, 0xff, 0xff, 0x1f, 0x50, 0xff, 0xff, 0x43, 0x50, 0xff, 0xff,
-  0x68, 0x50, 0xff, 0xff, 0x8d, 0x50, 0xff, 0xff, 0xb1, 0x50, 0xff, 0xff,
-  0xd6, 0x50, 0xff, 0xff, 0xfa, 0x50, 0xff, 0xff, 0x1f, 0x51, 0xff, 0xff,
-  0x44, 0x51, 0xff, 0xff, 0x69, 0x51, 0xff, 0xff, 0x8d, 0x51, 0xff, 0xff,
-  0xb2, 0x51, 0xff, 0xff, 0xd7, 0x51, 0xff, 0xff, 0xfc, 0x51, 0xff, 0xff,
-  0x21, 0x52, 0xff, 0xff, 0x46, 0x52, 0xff, 0xff, 0x6b, 0x52, 0xff, 0xff,
-  0x90, 0x52, 0xff, 0xff, 0xb5, 0x52, 0xff, 0xff, 0xda, 0x52, 0xff, 0xff,
-  0xff, 0x52, 0xff, 0xff, 0x24, 0x53, 0xff, 0xff, 0x49, 0x53, 0xff, 0xff,
-  0x6e, 0x53, 0xff, 0xff, 0x93, 0x53, 0xff, 0xff, 0xb8, 0x53, 0xff, 0xff,
-  0xdd, 0x53, 0xff, 0xff, 0x03, 0x54, 0xff, 0xff, 0x28, 0x54, 0xff, 0xff,
-  0x4d, 0x54, 0xff, 0xff, 0x72, 0x54, 0xff, 0xff, 0x98, 0x54, 0xff, 0xff,
-  0xbd, 0x54, 0xff, 0xff, 0xe2, 0x54, 0xff, 0xff, 0x08, 0x55, 0xff, 0xff,
-  0x2d, 0x55, 0xff, 0xff, 0x53, 0x55, 0xff, 0xff, 0x78, 0x55, 0xff, 0xff,
-  0x9e, 0x55, 0xff, 0xff, 0xc3, 0x55, 0xff, 0xff, 0xe9, 0x55, 0xff, 0xff,
-  0x0e, 0x56, 0xff, 0xff, 0x34, 0x56, 0xff, 0xff, 0x5a, 0x56, 0xff, 0xff,
-  0x7f, 0x56, 0xff, 0xff, 0xa5, 0x56, 0xff, 0xff, 0xcb, 0x56, 0xff, 0xff,
-  0xf0, 0x56, 0xff, 0xff, 0x16, 0x57, 0xff, 0xff, 0x3c, 0x57, 0xff, 0xff,
-  0x62, 0x57, 0xff, 0xff, 0x88, 0x57, 0xff, 0xff, 0xad, 0x57, 0xff, 0xff,
-  0xd3, 0x57, 0xff, 0xff, 0xf9, 0x57, 0xff, 0xff, 0x1f, 0x58, 0xff, 0xff,
-  0x45, 0x58, 0xff, 0xff, 0x6b, 0x58, 0xff, 0xff, 0x91, 0x58, 0xff, 0xff,
-  0xb7, 0x58, 0xff, 0xff, 0xdd, 0x58, 0xff, 0xff, 0x03, 0x59, 0xff, 0xff,
-  0x29, 0x59, 0xff, 0xff, 0x50, 0x59, 0xff, 0xff, 0x76, 0x59, 0xff, 0xff,
-  0x9c, 0x59, 0xff, 0xff, 0xc2, 0x59, 0xff, 0xff, 0xe8, 0x59, 0xff, 0xff,
-  0x0f, 0x5a, 0xff, 0xff, 0x35, 0x5a, 0xff, 0xff, 0x5b, 0x5a, 0xff, 0xff,
-  0x82, 0x5a, 0xff, 0xff, 0xa8, 0x5a, 0xff, 0xff, 0xce, 0x5a, 0xff, 0xff,
-  0xf5, 0x5a, 0xff, 0xff, 0x1b, 0x5b, 0xff, 0xff, 0x42, 0x5b, 0xff, 0xff,
-  0x68, 0x5b, 0xff, 0xff, 0x8f, 0x5b, 0xff, 0xff, 0xb5, 0x5b, 0xff, 0xff,
-  0xdc, 0x5b, 0xff, 0xff, 0x02, 0x5c, 0xff, 0xff, 0x29, 0x5c, 0xff, 0xff,
-  0x50, 0x5c, 0xff, 0xff, 0x76, 0x5c, 0xff, 0xff, 0x9d, 0x5c, 0xff, 0xff,
-  0xc4, 0x5c, 0xff, 0xff, 0xea, 0x5c, 0xff, 0xff, 0x11, 0x5d, 0xff, 0xff,
-  0x38, 0x5d, 0xff, 0xff, 0x5f, 0x5d, 0xff, 0xff, 0x85, 0x5d, 0xff, 0xff,
-  0xac, 0x5d, 0xff, 0xff, 0xd3, 0x5d, 0xff, 0xff, 0xfa, 0x5d, 0xff, 0xff,
-  0x21, 0x5e, 0xff, 0xff, 0x48, 0x5e, 0xff, 0xff, 0x6f, 0x5e, 0xff, 0xff,
-  0x96, 0x5e, 0xff, 0xff, 0xbd, 0x5e, 0xff, 0xff, 0xe4, 0x5e, 0xff, 0xff,
-  0x0b, 0x5f, 0xff, 0xff, 0x32, 0x5f, 0xff, 0xff, 0x59, 0x5f, 0xff, 0xff,
-  0x81, 0x5f, 0xff, 0xff, 0xa8, 0x5f, 0xff, 0xff, 0xcf, 0x5f, 0xff, 0xff,
-  0xf6, 0x5f, 0xff, 0xff, 0x1d, 0x60, 0xff, 0xff, 0x45, 0x60, 0xff, 0xff,
-  0x6c, 0x60, 0xff, 0xff, 0x93, 0x60, 0xff, 0xff, 0xbb, 0x60, 0xff, 0xff,
-  0xe2, 0x60, 0xff, 0xff, 0x09, 0x61, 0xff, 0xff, 0x31, 0x61, 0xff, 0xff,
-  0x58, 0x61, 0xff, 0xff, 0x80, 0x61, 0xff, 0xff, 0xa7, 0x61, 0xff, 0xff,
-  0xcf, 0x61, 0xff, 0xff, 0xf6, 0x61, 0xff, 0xff, 0x1e, 0x62, 0xff, 0xff,
-  0x45, 0x62, 0xff, 0xff, 0x6d, 0x62, 0xff, 0xff, 0x95, 0x62, 0xff, 0xff,
-  0xbc, 0x62, 0xff, 0xff, 0xe4, 0x62, 0xff, 0xff, 0x0c, 0x63, 0xff, 0xff,
-  0x33, 0x63, 0xff, 0xff, 0x5b, 0x63, 0xff, 0xff, 0x83, 0x63, 0xff, 0xff,
-  0xab, 0x63, 0xff, 0xff, 0xd2, 0x63, 0xff, 0xff, 0xfa, 0x63, 0xff, 0xff,
-  0x22, 0x64, 0xff, 0xff, 0x4a, 0x64, 0xff, 0xff, 0x72, 0x64, 0xff, 0xff,
-  0x9a, 0x64, 0xff, 0xff, 0xc2, 0x64, 0xff, 0xff, 0xea, 0x64, 0xff, 0xff,
-  0x12, 0x65, 0xff, 0xff, 0x3a, 0x65, 0xff, 0xff, 0x62, 0x65, 0xff, 0xff,
-  0x8a, 0x65, 0xff, 0xff, 0xb2, 0x65, 0xff, 0xff, 0xda, 0x65, 0xff, 0xff,
-  0x02, 0x66, 0xff, 0xff, 0x2a, 0x66, 0xff, 0xff, 0x53, 0x66, 0xff, 0xff,
-  0x7b, 0x66, 0xff, 0xff, 0xa3, 0x66, 0xff, 0xff, 0xcb, 0x66, 0xff, 0xff,
-  0xf4, 0x66, 0xff, 0xff, 0x1c, 0x67, 0xff, 0xff, 0x44, 0x67, 0xff, 0xff,
-  0x6d, 0x67, 0xff, 0xff, 0x95, 0x67, 0xff, 0xff, 0xbd, 0x67, 0xff, 0xff,
-  0xe6, 0x67, 0xff, 0xff, 0x0e, 0x68, 0xff, 0xff, 0x37, 0x68, 0xff, 0xff,
-  0x5f, 0x68, 0xff, 0xff, 0x88, 0x68, 0xff, 0xff, 0xb0, 0x68, 0xff, 0xff,
-  0xd9, 0x68, 0xff, 0xff, 0x01, 0x69, 0xff, 0xff, 0x2a, 0x69, 0xff, 0xff,
-  0x53, 0x69, 0xff, 0xff, 0x7b, 0x69, 0xff, 0xff, 0xa4, 0x69, 0xff, 0xff,
-  0xcd, 0x69, 0xff, 0xff, 0xf5, 0x69, 0xff, 0xff, 0x1e, 0x6a, 0xff, 0xff,
-  0x47, 0x6a, 0xff, 0xff, 0x70, 0x6a, 0xff, 0xff, 0x98, 0x6a, 0xff, 0xff,
-  0xc1, 0x6a, 0xff, 0xff, 0xea, 0x6a, 0xff, 0xff, 0x13, 0x6b, 0xff, 0xff,
-  0x3c, 0x6b, 0xff, 0xff, 0x65, 0x6b, 0xff, 0xff, 0x8e, 0x6b, 0xff, 0xff,
-  0xb7, 0x6b, 0xff, 0xff, 0xe0, 0x6b, 0xff, 0xff, 0x09, 0x6c, 0xff, 0xff,
-  0x32, 0x6c, 0xff, 0xff, 0x5b, 0x6c, 0xff, 0xff, 0x84, 0x6c, 0xff, 0xff,
-  0xad, 0x6c, 0xff, 0xff, 0xd6, 0x6c, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff,
-  0x28, 0x6d, 0xff, 0xff, 0x52, 0x6d, 0xff, 0xff, 0x7b, 0x6d, 0xff, 0xff,
-  0xa4, 0x6d, 0xff, 0xff, 0xcd, 0x6d, 0xff, 0xff, 0xf6, 0x6d, 0xff, 0xff,
-  0x20, 0x6e, 0xff, 0xff, 0x49, 0x6e, 0xff, 0xff, 0x72, 0x6e, 0xff, 0xff,
-  0x9c, 0x6e, 0xff, 0xff, 0xc5, 0x6e, 0xff, 0xff, 0xef, 0x6e, 0xff, 0xff,
-  0x18, 0x6f, 0xff, 0xff, 0x41, 0x6f, 0xff, 0xff, 0x6b, 0x6f, 0xff, 0xff,
-  0x94, 0x6f, 0xff, 0xff, 0xbe, 0x6f, 0xff, 0xff, 0xe7, 0x6f, 0xff, 0xff,
-  0x11, 0x70, 0xff, 0xff, 0x3b, 0x70, 0xff, 0xff, 0x64, 0x70, 0xff, 0xff,
-  0x8e, 0x70, 0xff, 0xff, 0xb7, 0x70, 0xff, 0xff, 0xe1, 0x70, 0xff, 0xff,
-  0x0b, 0x71, 0xff, 0xff, 0x34, 0x71, 0xff, 0xff, 0x5e, 0x71, 0xff, 0xff,
-  0x88, 0x71, 0xff, 0xff, 0xb2, 0x71, 0xff, 0xff, 0xdc, 0x71, 0xff, 0xff,
-  0x05, 0x72, 0xff, 0xff, 0x2f, 0x72, 0xff, 0xff, 0x59, 0x72, 0xff, 0xff,
-  0x83, 0x72, 0xff, 0xff, 0xad, 0x72, 0xff, 0xff, 0xd7, 0x72, 0xff, 0xff,
-  0x01, 0x73, 0xff, 0xff, 0x2b, 0x73, 0xff, 0xff, 0x55, 0x73, 0xff, 0xff,
-  0x7f, 0x73, 0xff, 0xff, 0xa9, 0x73, 0xff, 0xff, 0xd3, 0x73, 0xff, 0xff,
-  0xfd, 0x73, 0xff, 0xff, 0x27, 0x74, 0xff, 0xff, 0x51, 0x74, 0xff, 0xff,
-  0x7b, 0x74, 0xff, 0xff, 0xa5, 0x74, 0xff, 0xff, 0xcf, 0x74, 0xff, 0xff,
-  0xfa, 0x74, 0xff, 0xff, 0x24, 0x75, 0xff, 0xff, 0x4e, 0x75, 0xff, 0xff,
-  0x78, 0x75, 0xff, 0xff, 0xa3, 0x75, 0xff, 0xff, 0xcd, 0x75, 0xff, 0xff,
-  0xf7, 0x75, 0xff, 0xff, 0x22, 0x76, 0xff, 0xff, 0x4c, 0x76, 0xff, 0xff,
-  0x76, 0x76, 0xff, 0xff, 0xa1, 0x76, 0xff, 0xff, 0xcb, 0x76, 0xff, 0xff,
-  0xf6, 0x76, 0xff, 0xff, 0x20, 0x77, 0xff, 0xff, 0x4b, 0x77, 0xff, 0xff,
-  0x75, 0x77, 0xff, 0xff, 0xa0, 0x77, 0xff, 0xff, 0xca, 0x77, 0xff, 0xff,
-  0xf5, 0x77, 0xff, 0xff, 0x1f, 0x78, 0xff, 0xff, 0x4a, 0x78, 0xff, 0xff,
-  0x75, 0x78, 0xff, 0xff, 0x9f, 0x78, 0xff, 0xff, 0xca, 0x78, 0xff, 0xff,
-  0xf5, 0x78, 0xff, 0xff, 0x1f, 0x79, 0xff, 0xff, 0x4a, 0x79, 0xff, 0xff,
-  0x75, 0x79, 0xff, 0xff, 0xa0, 0x79, 0xff, 0xff, 0xca, 0x79, 0xff, 0xff,
-  0xf5, 0x79, 0xff, 0xff, 0x20, 0x7a, 0xff, 0xff, 0x4b, 0x7a, 0xff, 0xff,
-  0x76, 0x7a, 0xff, 0xff, 0xa1, 0x7a, 0xff, 0xff, 0xcc, 0x7a, 0xff, 0xff,
-  0xf7, 0x7a, 0xff, 0xff, 0x21, 0x7b, 0xff, 0xff, 0x4c, 0x7b, 0xff, 0xff,
-  0x77, 0x7b, 0xff, 0xff, 0xa2, 0x7b, 0xff, 0xff, 0xcd, 0x7b, 0xff, 0xff,
-  0xf9, 0x7b, 0xff, 0xff, 0x24, 0x7c, 0xff, 0xff, 0x4f, 0x7c, 0xff, 0xff,
-  0x7a, 0x7c, 0xff, 0xff, 0xa5, 0x7c, 0xff, 0xff, 0xd0, 0x7c, 0xff, 0xff,
-  0xfb, 0x7c, 0xff, 0xff, 0x26, 0x7d, 0xff, 0xff, 0x52, 0x7d, 0xff, 0xff,
-  0x7d, 0x7d, 0xff, 0xff, 0xa8, 0x7d, 0xff, 0xff, 0xd3, 0x7d, 0xff, 0xff,
-  0xff, 0x7d, 0xff, 0xff, 0x2a, 0x7e, 0xff, 0xff, 0x55, 0x7e, 0xff, 0xff,
-  0x81, 0x7e, 0xff, 0xff, 0xac, 0x7e, 0xff, 0xff, 0xd7, 0x7e, 0xff, 0xff,
-  0x03, 0x7f, 0xff, 0xff, 0x2e, 0x7f, 0xff, 0xff, 0x5a, 0x7f, 0xff, 0xff,
-  0x85, 0x7f, 0xff, 0xff, 0xb1, 0x7f, 0xff, 0xff, 0xdc, 0x7f, 0xff, 0xff,
-  0x08, 0x80, 0xff, 0xff, 0x33, 0x80, 0xff, 0xff, 0x5f, 0x80, 0xff, 0xff,
-  0x8a, 0x80, 0xff, 0xff, 0xb6, 0x80, 0xff, 0xff, 0xe2, 0x80, 0xff, 0xff,
-  0x0d, 0x81, 0xff, 0xff, 0x39, 0x81, 0xff, 0xff, 0x65, 0x81, 0xff, 0xff,
-  0x90, 0x81, 0xff, 0xff, 0xbc, 0x81, 0xff, 0xff, 0xe8, 0x81, 0xff, 0xff,
-  0x14, 0x82, 0xff, 0xff, 0x3f, 0x82, 0xff, 0xff, 0x6b, 0x82, 0xff, 0xff,
-  0x97, 0x82, 0xff, 0xff, 0xc3, 0x82, 0xff, 0xff, 0xef, 0x82, 0xff, 0xff,
-  0x1a, 0x83, 0xff, 0xff, 0x46, 0x83, 0xff, 0xff, 0x72, 0x83, 0xff, 0xff,
-  0x9e, 0x83, 0xff, 0xff, 0xca, 0x83, 0xff, 0xff, 0xf6, 0x83, 0xff, 0xff,
-  0x22, 0x84, 0xff, 0xff, 0x4e, 0x84, 0xff, 0xff, 0x7a, 0x84, 0xff, 0xff,
-  0xa6, 0x84, 0xff, 0xff, 0xd2, 0x84, 0xff, 0xff, 0xfe, 0x84, 0xff, 0xff,
-  0x2a, 0x85, 0xff, 0xff, 0x56, 0x85, 0xff, 0xff, 0x83, 0x85, 0xff, 0xff,
-  0xaf, 0x85, 0xff, 0xff, 0xdb, 0x85, 0xff, 0xff, 0x07, 0x86, 0xff, 0xff,
-  0x33, 0x86, 0xff, 0xff, 0x60, 0x86, 0xff, 0xff, 0x8c, 0x86, 0xff, 0xff,
-  0xb8, 0x86, 0xff, 0xff, 0xe4, 0x86, 0xff, 0xff, 0x11, 0x87, 0xff, 0xff,
-  0x3d, 0x87, 0xff, 0xff, 0x69, 0x87, 0xff, 0xff, 0x96, 0x87, 0xff, 0xff,
-  0xc2, 0x87, 0xff, 0xff, 0xee, 0x87, 0xff, 0xff, 0x1b, 0x88, 0xff, 0xff,
-  0x47, 0x88, 0xff, 0xff, 0x74, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff,
-  0xcd, 0x88, 0xff, 0xff, 0xf9, 0x88, 0xff, 0xff, 0x26, 0x89, 0xff, 0xff,
-  0x52, 0x89, 0xff, 0xff, 0x7f, 0x89, 0xff, 0xff, 0xab, 0x89, 0xff, 0xff,
-  0xd8, 0x89, 0xff, 0xff, 0x04, 0x8a, 0xff, 0xff, 0x31, 0x8a, 0xff, 0xff,
-  0x5e, 0x8a, 0xff, 0xff, 0x8a, 0x8a, 0xff, 0xff, 0xb7, 0x8a, 0xff, 0xff,
-  0xe4, 0x8a, 0xff, 0xff, 0x10, 0x8b, 0xff, 0xff, 0x3d, 0x8b, 0xff, 0xff,
-  0x6a, 0x8b, 0xff, 0xff, 0x97, 0x8b, 0xff, 0xff, 0xc3, 0x8b, 0xff, 0xff,
-  0xf0, 0x8b, 0xff, 0xff, 0x1d, 0x8c, 0xff, 0xff, 0x4a, 0x8c, 0xff, 0xff,
-  0x77, 0x8c, 0xff, 0xff, 0xa3, 0x8c, 0xff, 0xff, 0xd0, 0x8c, 0xff, 0xff,
-  0xfd, 0x8c, 0xff, 0xff, 0x2a, 0x8d, 0xff, 0xff, 0x57, 0x8d, 0xff, 0xff,
-  0x84, 0x8d, 0xff, 0xff, 0xb1, 0x8d, 0xff, 0xff, 0xde, 0x8d, 0xff, 0xff,
-  0x0b, 0x8e, 0xff, 0xff, 0x38, 0x8e, 0xff, 0xff, 0x65, 0x8e, 0xff, 0xff,
-  0x92, 0x8e, 0xff, 0xff, 0xbf, 0x8e, 0xff, 0xff, 0xec, 0x8e, 0xff, 0xff,
-  0x19, 0x8f, 0xff, 0xff, 0x46, 0x8f, 0xff, 0xff, 0x74, 0x8f, 0xff, 0xff,
-  0xa1, 0x8f, 0xff, 0xff, 0xce, 0x8f, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff,
-  0x28, 0x90, 0xff, 0xff, 0x56, 0x90, 0xff, 0xff, 0x83, 0x90, 0xff, 0xff,
-  0xb0, 0x90, 0xff, 0xff, 0xdd, 0x90, 0xff, 0xff, 0x0b, 0x91, 0xff, 0xff,
-  0x38, 0x91, 0xff, 0xff, 0x65, 0x91, 0xff, 0xff, 0x93, 0x91, 0xff, 0xff,
-  0xc0, 0x91, 0xff, 0xff, 0xed, 0x91, 0xff, 0xff, 0x1b, 0x92, 0xff, 0xff,
-  0x48, 0x92, 0xff, 0xff, 0x76, 0x92, 0xff, 0xff, 0xa3, 0x92, 0xff, 0xff,
-  0xd0, 0x92, 0xff, 0xff, 0xfe, 0x92, 0xff, 0xff, 0x2b, 0x93, 0xff, 0xff,
-  0x59, 0x93, 0xff, 0xff, 0x86, 0x93, 0xff, 0xff, 0xb4, 0x93, 0xff, 0xff,
-  0xe2, 0x93, 0xff, 0xff, 0x0f, 0x94, 0xff, 0xff, 0x3d, 0x94, 0xff, 0xff,
-  0x6a, 0x94, 0xff, 0xff, 0x98, 0x94, 0xff, 0xff, 0xc6, 0x94, 0xff, 0xff,
-  0xf3, 0x94, 0xff, 0xff, 0x21, 0x95, 0xff, 0xff, 0x4f, 0x95, 0xff, 0xff,
-  0x7c, 0x95, 0xff, 0xff, 0xaa, 0x95, 0xff, 0xff, 0xd8, 0x95, 0xff, 0xff,
-  0x05, 0x96, 0xff, 0xff, 0x33, 0x96, 0xff, 0xff, 0x61, 0x96, 0xff, 0xff,
-  0x8f, 0x96, 0xff, 0xff, 0xbd, 0x96, 0xff, 0xff, 0xea, 0x96, 0xff, 0xff,
-  0x18, 0x97, 0xff, 0xff, 0x46, 0x97, 0xff, 0xff, 0x74, 0x97, 0xff, 0xff,
-  0xa2, 0x97, 0xff, 0xff, 0xd0, 0x97, 0xff, 0xff, 0xfe, 0x97, 0xff, 0xff,
-  0x2c, 0x98, 0xff, 0xff, 0x5a, 0x98, 0xff, 0xff, 0x88, 0x98, 0xff, 0xff,
-  0xb6, 0x98, 0xff, 0xff, 0xe4, 0x98, 0xff, 0xff, 0x12, 0x99, 0xff, 0xff,
-  0x40, 0x99, 0xff, 0xff, 0x6e, 0x99, 0xff, 0xff, 0x9c, 0x99, 0xff, 0xff,
-  0xca, 0x99, 0xff, 0xff, 0xf8, 0x99, 0xff, 0xff, 0x26, 0x9a, 0xff, 0xff,
-  0x54, 0x9a, 0xff, 0xff, 0x82, 0x9a, 0xff, 0xff, 0xb0, 0x9a, 0xff, 0xff,
-  0xdf, 0x9a, 0xff, 0xff, 0x0d, 0x9b, 0xff, 0xff, 0x3b, 0x9b, 0xff, 0xff,
-  0x69, 0x9b, 0xff, 0xff, 0x97, 0x9b, 0xff, 0xff, 0xc6, 0x9b, 0xff, 0xff,
-  0xf4, 0x9b, 0xff, 0xff, 0x22, 0x9c, 0xff, 0xff, 0x50, 0x9c, 0xff, 0xff,
-  0x7f, 0x9c, 0xff, 0xff, 0xad, 0x9c, 0xff, 0xff, 0xdb, 0x9c, 0xff, 0xff,
-  0x0a, 0x9d, 0xff, 0xff, 0x38, 0x9d, 0xff, 0xff, 0x67, 0x9d, 0xff, 0xff,
-  0x95, 0x9d, 0xff, 0xff, 0xc3, 0x9d, 0xff, 0xff, 0xf2, 0x9d, 0xff, 0xff,
-  0x20, 0x9e, 0xff, 0xff, 0x4f, 0x9e, 0xff, 0xff, 0x7d, 0x9e, 0xff, 0xff,
-  0xac, 0x9e, 0xff, 0xff, 0xda, 0x9e, 0xff, 0xff, 0x09, 0x9f, 0xff, 0xff,
-  0x37, 0x9f, 0xff, 0xff, 0x66, 0x9f, 0xff, 0xff, 0x94, 0x9f, 0xff, 0xff,
-  0xc3, 0x9f, 0xff, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0x20, 0xa0, 0xff, 0xff,
-  0x4f, 0xa0, 0xff, 0xff, 0x7d, 0xa0, 0xff, 0xff, 0xac, 0xa0, 0xff, 0xff,
-  0xdb, 0xa0, 0xff, 0xff, 0x09, 0xa1, 0xff, 0xff, 0x38, 0xa1, 0xff, 0xff,
-  0x67, 0xa1, 0xff, 0xff, 0x95, 0xa1, 0xff, 0xff, 0xc4, 0xa1, 0xff, 0xff,
-  0xf3, 0xa1, 0xff, 0xff, 0x22, 0xa2, 0xff, 0xff, 0x50, 0xa2, 0xff, 0xff,
-  0x7f, 0xa2, 0xff, 0xff, 0xae, 0xa2, 0xff, 0xff, 0xdd, 0xa2, 0xff, 0xff,
-  0x0c, 0xa3, 0xff, 0xff, 0x3a, 0xa3, 0xff, 0xff, 0x69, 0xa3, 0xff, 0xff,
-  0x98, 0xa3, 0xff, 0xff, 0xc7, 0xa3, 0xff, 0xff, 0xf6, 0xa3, 0xff, 0xff,
-  0x25, 0xa4, 0xff, 0xff, 0x54, 0xa4, 0xff, 0xff, 0x83, 0xa4, 0xff, 0xff,
-  0xb2, 0xa4, 0xff, 0xff, 0xe1, 0xa4, 0xff, 0xff, 0x10, 0xa5, 0xff, 0xff,
-  0x3f, 0xa5, 0xff, 0xff, 0x6e, 0xa5, 0xff, 0xff, 0x9d, 0xa5, 0xff, 0xff,
-  0xcc, 0xa5, 0xff, 0xff, 0xfb, 0xa5, 0xff, 0xff, 0x2a, 0xa6, 0xff, 0xff,
-  0x59, 0xa6, 0xff, 0xff, 0x88, 0xa6, 0xff, 0xff, 0xb7, 0xa6, 0xff, 0xff,
-  0xe6, 0xa6, 0xff, 0xff, 0x15, 0xa7, 0xff, 0xff, 0x44, 0xa7, 0xff, 0xff,
-  0x74, 0xa7, 0xff, 0xff, 0xa3, 0xa7, 0xff, 0xff, 0xd2, 0xa7, 0xff, 0xff,
-  0x01, 0xa8, 0xff, 0xff, 0x30, 0xa8, 0xff, 0xff, 0x60, 0xa8, 0xff, 0xff,
-  0x8f, 0xa8, 0xff, 0xff, 0xbe, 0xa8, 0xff, 0xff, 0xed, 0xa8, 0xff, 0xff,
-  0x1d, 0xa9, 0xff, 0xff, 0x4c, 0xa9, 0xff, 0xff, 0x7b, 0xa9, 0xff, 0xff,
-  0xaa, 0xa9, 0xff, 0xff, 0xda, 0xa9, 0xff, 0xff, 0x09, 0xaa, 0xff, 0xff,
-  0x38, 0xaa, 0xff, 0xff, 0x68, 0xaa, 0xff, 0xff, 0x97, 0xaa, 0xff, 0xff,
-  0xc7, 0xaa, 0xff, 0xff, 0xf6, 0xaa, 0xff, 0xff, 0x25, 0xab, 0xff, 0xff,
-  0x55, 0xab, 0xff, 0xff, 0x84, 0xab, 0xff, 0xff, 0xb4, 0xab, 0xff, 0xff,
-  0xe3, 0xab, 0xff, 0xff, 0x13, 0xac, 0xff, 0xff, 0x42, 0xac, 0xff, 0xff,
-  0x72, 0xac, 0xff, 0xff, 0xa1, 0xac, 0xff, 0xff, 0xd1, 0xac, 0xff, 0xff,
-  0x00, 0xad, 0xff, 0xff, 0x30, 0xad, 0xff, 0xff, 0x5f, 0xad, 0xff, 0xff,
-  0x8f, 0xad, 0xff, 0xff, 0xbf, 0xad, 0xff, 0xff, 0xee, 0xad, 0xff, 0xff,
-  0x1e, 0xae, 0xff, 0xff, 0x4d, 0xae, 0xff, 0xff, 0x7d, 0xae, 0xff, 0xff,
-  0xad, 0xae, 0xff, 0xff, 0xdc, 0xae, 0xff, 0xff, 0x0c, 0xaf, 0xff, 0xff,
-  0x3c, 0xaf, 0xff, 0xff, 0x6b, 0xaf, 0xff, 0xff, 0x9b, 0xaf, 0xff, 0xff,
-  0xcb, 0xaf, 0xff, 0xff, 0xfb, 0xaf, 0xff, 0xff, 0x2a, 0xb0, 0xff, 0xff,
-  0x5a, 0xb0, 0xff, 0xff, 0x8a, 0xb0, 0xff, 0xff, 0xba, 0xb0, 0xff, 0xff,
-  0xea, 0xb0, 0xff, 0xff, 0x19, 0xb1, 0xff, 0xff, 0x49, 0xb1, 0xff, 0xff,
-  0x79, 0xb1, 0xff, 0xff, 0xa9, 0xb1, 0xff, 0xff, 0xd9, 0xb1, 0xff, 0xff,
-  0x09, 0xb2, 0xff, 0xff, 0x38, 0xb2, 0xff, 0xff, 0x68, 0xb2, 0xff, 0xff,
-  0x98, 0xb2, 0xff, 0xff, 0xc8, 0xb2, 0xff, 0xff, 0xf8, 0xb2, 0xff, 0xff,
-  0x28, 0xb3, 0xff, 0xff, 0x58, 0xb3, 0xff, 0xff, 0x88, 0xb3, 0xff, 0xff,
-  0xb8, 0xb3, 0xff, 0xff, 0xe8, 0xb3, 0xff, 0xff, 0x18, 0xb4, 0xff, 0xff,
-  0x48, 0xb4, 0xff, 0xff, 0x78, 0xb4, 0xff, 0xff, 0xa8, 0xb4, 0xff, 0xff,
-  0xd8, 0xb4, 0xff, 0xff, 0x08, 0xb5, 0xff, 0xff, 0x38, 0xb5, 0xff, 0xff,
-  0x68, 0xb5, 0xff, 0xff, 0x98, 0xb5, 0xff, 0xff, 0xc8, 0xb5, 0xff, 0xff,
-  0xf9, 0xb5, 0xff, 0xff, 0x29, 0xb6, 0xff, 0xff, 0x59, 0xb6, 0xff, 0xff,
-  0x89, 0xb6, 0xff, 0xff, 0xb9, 0xb6, 0xff, 0xff, 0xe9, 0xb6, 0xff, 0xff,
-  0x19, 0xb7, 0xff, 0xff, 0x4a, 0xb7, 0xff, 0xff, 0x7a, 0xb7, 0xff, 0xff,
-  0xaa, 0xb7, 0xff, 0xff, 0xda, 0xb7, 0xff, 0xff, 0x0b, 0xb8, 0xff, 0xff,
-  0x3b, 0xb8, 0xff, 0xff, 0x6b, 0xb8, 0xff, 0xff, 0x9b, 0xb8, 0xff, 0xff,
-  0xcc, 0xb8, 0xff, 0xff, 0xfc, 0xb8, 0xff, 0xff, 0x2c, 0xb9, 0xff, 0xff,
-  0x5c, 0xb9, 0xff, 0xff, 0x8d, 0xb9, 0xff, 0xff, 0xbd, 0xb9, 0xff, 0xff,
-  0xed, 0xb9, 0xff, 0xff, 0x1e, 0xba, 0xff, 0xff, 0x4e, 0xba, 0xff, 0xff,
-  0x7f, 0xba, 0xff, 0xff, 0xaf, 0xba, 0xff, 0xff, 0xdf, 0xba, 0xff, 0xff,
-  0x10, 0xbb, 0xff, 0xff, 0x40, 0xbb, 0xff, 0xff, 0x71, 0xbb, 0xff, 0xff,
-  0xa1, 0xbb, 0xff, 0xff, 0xd1, 0xbb, 0xff, 0xff, 0x02, 0xbc, 0xff, 0xff,
-  0x32, 0xbc, 0xff, 0xff, 0x63, 0xbc, 0xff, 0xff, 0x93, 0xbc, 0xff, 0xff,
-  0xc4, 0xbc, 0xff, 0xff, 0xf4, 0xbc, 0xff, 0xff, 0x25, 0xbd, 0xff, 0xff,
-  0x55, 0xbd, 0xff, 0xff, 0x86, 0xbd, 0xff, 0xff, 0xb6, 0xbd, 0xff, 0xff,
-  0xe7, 0xbd, 0xff, 0xff, 0x18, 0xbe, 0xff, 0xff, 0x48, 0xbe, 0xff, 0xff,
-  0x79, 0xbe, 0xff, 0xff, 0xa9, 0xbe, 0xff, 0xff, 0xda, 0xbe, 0xff, 0xff,
-  0x0b, 0xbf, 0xff, 0xff, 0x3b, 0xbf, 0xff, 0xff, 0x6c, 0xbf, 0xff, 0xff,
-  0x9c, 0xbf, 0xff, 0xff, 0xcd, 0xbf, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff,
-  0x2e, 0xc0, 0xff, 0xff, 0x5f, 0xc0, 0xff, 0xff, 0x90, 0xc0, 0xff, 0xff,
-  0xc1, 0xc0, 0xff, 0xff, 0xf1, 0xc0, 0xff, 0xff, 0x22, 0xc1, 0xff, 0xff,
-  0x53, 0xc1, 0xff, 0xff, 0x83, 0xc1, 0xff, 0xff, 0xb4, 0xc1, 0xff, 0xff,
-  0xe5, 0xc1, 0xff, 0xff, 0x16, 0xc2, 0xff, 0xff, 0x46, 0xc2, 0xff, 0xff,
-  0x77, 0xc2, 0xff, 0xff, 0xa8, 0xc2, 0xff, 0xff, 0xd9, 0xc2, 0xff, 0xff,
-  0x0a, 0xc3, 0xff, 0xff, 0x3b, 0xc3, 0xff, 0xff, 0x6b, 0xc3, 0xff, 0xff,
-  0x9c, 0xc3, 0xff, 0xff, 0xcd, 0xc3, 0xff, 0xff, 0xfe, 0xc3, 0xff, 0xff,
-  0x2f, 0xc4, 0xff, 0xff, 0x60, 0xc4, 0xff, 0xff, 0x91, 0xc4, 0xff, 0xff,
-  0xc1, 0xc4, 0xff, 0xff, 0xf2, 0xc4, 0xff, 0xff, 0x23, 0xc5, 0xff, 0xff,
-  0x54, 0xc5, 0xff, 0xff, 0x85, 0xc5, 0xff, 0xff, 0xb6, 0xc5, 0xff, 0xff,
-  0xe7, 0xc5, 0xff, 0xff, 0x18, 0xc6, 0xff, 0xff, 0x49, 0xc6, 0xff, 0xff,
-  0x7a, 0xc6, 0xff, 0xff, 0xab, 0xc6, 0xff, 0xff, 0xdc, 0xc6, 0xff, 0xff,
-  0x0d, 0xc7, 0xff, 0xff, 0x3e, 0xc7, 0xff, 0xff, 0x6f, 0xc7, 0xff, 0xff,
-  0xa0, 0xc7, 0xff, 0xff, 0xd1, 0xc7, 0xff, 0xff, 0x02, 0xc8, 0xff, 0xff,
-  0x33, 0xc8, 0xff, 0xff, 0x64, 0xc8, 0xff, 0xff, 0x95, 0xc8, 0xff, 0xff,
-  0xc6, 0xc8, 0xff, 0xff, 0xf7, 0xc8, 0xff, 0xff, 0x28, 0xc9, 0xff, 0xff,
-  0x5a, 0xc9, 0xff, 0xff, 0x8b, 0xc9, 0xff, 0xff, 0xbc, 0xc9, 0xff, 0xff,
-  0xed, 0xc9, 0xff, 0xff, 0x1e, 0xca, 0xff, 0xff, 0x4f, 0xca, 0xff, 0xff,
-  0x80, 0xca, 0xff, 0xff, 0xb1, 0xca, 0xff, 0xff, 0xe3, 0xca, 0xff, 0xff,
-  0x14, 0xcb, 0xff, 0xff, 0x45, 0xcb, 0xff, 0xff, 0x76, 0xcb, 0xff, 0xff,
-  0xa7, 0xcb, 0xff, 0xff, 0xd9, 0xcb, 0xff, 0xff, 0x0a, 0xcc, 0xff, 0xff,
-  0x3b, 0xcc, 0xff, 0xff, 0x6c, 0xcc, 0xff, 0xff, 0x9e, 0xcc, 0xff, 0xff,
-  0xcf, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x31, 0xcd, 0xff, 0xff,
-  0x63, 0xcd, 0xff, 0xff, 0x94, 0xcd, 0xff, 0xff, 0xc5, 0xcd, 0xff, 0xff,
-  0xf6, 0xcd, 0xff, 0xff, 0x28, 0xce, 0xff, 0xff, 0x59, 0xce, 0xff, 0xff,
-  0x8a, 0xce, 0xff, 0xff, 0xbc, 0xce, 0xff, 0xff, 0xed, 0xce, 0xff, 0xff,
-  0x1e, 0xcf, 0xff, 0xff, 0x50, 0xcf, 0xff, 0xff, 0x81, 0xcf, 0xff, 0xff,
-  0xb2, 0xcf, 0xff, 0xff, 0xe4, 0xcf, 0xff, 0xff, 0x15, 0xd0, 0xff, 0xff,
-  0x47, 0xd0, 0xff, 0xff, 0x78, 0xd0, 0xff, 0xff, 0xa9, 0xd0, 0xff, 0xff,
-  0xdb, 0xd0, 0xff, 0xff, 0x0c, 0xd1, 0xff, 0xff, 0x3e, 0xd1, 0xff, 0xff,
-  0x6f, 0xd1, 0xff, 0xff, 0xa0, 0xd1, 0xff, 0xff, 0xd2, 0xd1, 0xff, 0xff,
-  0x03, 0xd2, 0xff, 0xff, 0x35, 0xd2, 0xff, 0xff, 0x66, 0xd2, 0xff, 0xff,
-  0x98, 0xd2, 0xff, 0xff, 0xc9, 0xd2, 0xff, 0xff, 0xfb, 0xd2, 0xff, 0xff,
-  0x2c, 0xd3, 0xff, 0xff, 0x5e, 0xd3, 0xff, 0xff, 0x8f, 0xd3, 0xff, 0xff,
-  0xc1, 0xd3, 0xff, 0xff, 0xf2, 0xd3, 0xff, 0xff, 0x24, 0xd4, 0xff, 0xff,
-  0x55, 0xd4, 0xff, 0xff, 0x87, 0xd4, 0xff, 0xff, 0xb8, 0xd4, 0xff, 0xff,
-  0xea, 0xd4, 0xff, 0xff, 0x1b, 0xd5, 0xff, 0xff, 0x4d, 0xd5, 0xff, 0xff,
-  0x7e, 0xd5, 0xff, 0xff, 0xb0, 0xd5, 0xff, 0xff, 0xe2, 0xd5, 0xff, 0xff,
-  0x13, 0xd6, 0xff, 0xff, 0x45, 0xd6, 0xff, 0xff, 0x76, 0xd6, 0xff, 0xff,
-  0xa8, 0xd6, 0xff, 0xff, 0xda, 0xd6, 0xff, 0xff, 0x0b, 0xd7, 0xff, 0xff,
-  0x3d, 0xd7, 0xff, 0xff, 0x6e, 0xd7, 0xff, 0xff, 0xa0, 0xd7, 0xff, 0xff,
-  0xd2, 0xd7, 0xff, 0xff, 0x03, 0xd8, 0xff, 0xff, 0x35, 0xd8, 0xff, 0xff,
-  0x67, 0xd8, 0xff, 0xff, 0x98, 0xd8, 0xff, 0xff, 0xca, 0xd8, 0xff, 0xff,
-  0xfc, 0xd8, 0xff, 0xff, 0x2d, 0xd9, 0xff, 0xff, 0x5f, 0xd9, 0xff, 0xff,
-  0x91, 0xd9, 0xff, 0xff, 0xc2, 0xd9, 0xff, 0xff, 0xf4, 0xd9, 0xff, 0xff,
-  0x26, 0xda, 0xff, 0xff, 0x58, 0xda, 0xff, 0xff, 0x89, 0xda, 0xff, 0xff,
-  0xbb, 0xda, 0xff, 0xff, 0xed, 0xda, 0xff, 0xff, 0x1e, 0xdb, 0xff, 0xff,
-  0x50, 0xdb, 0xff, 0xff, 0x82, 0xdb, 0xff, 0xff, 0xb4, 0xdb, 0xff, 0xff,
-  0xe5, 0xdb, 0xff, 0xff, 0x17, 0xdc, 0xff, 0xff, 0x49, 0xdc, 0xff, 0xff,
-  0x7b, 0xdc, 0xff, 0xff, 0xad, 0xdc, 0xff, 0xff, 0xde, 0xdc, 0xff, 0xff,
-  0x10, 0xdd, 0xff, 0xff, 0x42, 0xdd, 0xff, 0xff, 0x74, 0xdd, 0xff, 0xff,
-  0xa6, 0xdd, 0xff, 0xff, 0xd7, 0xdd, 0xff, 0xff, 0x09, 0xde, 0xff, 0xff,
-  0x3b, 0xde, 0xff, 0xff, 0x6d, 0xde, 0xff, 0xff, 0x9f, 0xde, 0xff, 0xff,
-  0xd0, 0xde, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0x34, 0xdf, 0xff, 0xff,
-  0x66, 0xdf, 0xff, 0xff, 0x98, 0xdf, 0xff, 0xff, 0xca, 0xdf, 0xff, 0xff,
-  0xfc, 0xdf, 0xff, 0xff, 0x2d, 0xe0, 0xff, 0xff, 0x5f, 0xe0, 0xff, 0xff,
-  0x91, 0xe0, 0xff, 0xff, 0xc3, 0xe0, 0xff, 0xff, 0xf5, 0xe0, 0xff, 0xff,
-  0x27, 0xe1, 0xff, 0xff, 0x59, 0xe1, 0xff, 0xff, 0x8b, 0xe1, 0xff, 0xff,
-  0xbd, 0xe1, 0xff, 0xff, 0xef, 0xe1, 0xff, 0xff, 0x20, 0xe2, 0xff, 0xff,
-  0x52, 0xe2, 0xff, 0xff, 0x84, 0xe2, 0xff, 0xff, 0xb6, 0xe2, 0xff, 0xff,
-  0xe8, 0xe2, 0xff, 0xff, 0x1a, 0xe3, 0xff, 0xff, 0x4c, 0xe3, 0xff, 0xff,
-  0x7e, 0xe3, 0xff, 0xff, 0xb0, 0xe3, 0xff, 0xff, 0xe2, 0xe3, 0xff, 0xff,
-  0x14, 0xe4, 0xff, 0xff, 0x46, 0xe4, 0xff, 0xff, 0x78, 0xe4, 0xff, 0xff,
-  0xaa, 0xe4, 0xff, 0xff, 0xdc, 0xe4, 0xff, 0xff, 0x0e, 0xe5, 0xff, 0xff,
-  0x40, 0xe5, 0xff, 0xff, 0x72, 0xe5, 0xff, 0xff, 0xa4, 0xe5, 0xff, 0xff,
-  0xd6, 0xe5, 0xff, 0xff, 0x08, 0xe6, 0xff, 0xff, 0x3a, 0xe6, 0xff, 0xff,
-  0x6c, 0xe6, 0xff, 0xff, 0x9e, 0xe6, 0xff, 0xff, 0xd0, 0xe6, 0xff, 0xff,
-  0x02, 0xe7, 0xff, 0xff, 0x34, 0xe7, 0xff, 0xff, 0x66, 0xe7, 0xff, 0xff,
-  0x98, 0xe7, 0xff, 0xff, 0xca, 0xe7, 0xff, 0xff, 0xfc, 0xe7, 0xff, 0xff,
-  0x2e, 0xe8, 0xff, 0xff, 0x60, 0xe8, 0xff, 0xff, 0x92, 0xe8, 0xff, 0xff,
-  0xc4, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0x28, 0xe9, 0xff, 0xff,
-  0x5a, 0xe9, 0xff, 0xff, 0x8d, 0xe9, 0xff, 0xff, 0xbf, 0xe9, 0xff, 0xff,
-  0xf1, 0xe9, 0xff, 0xff, 0x23, 0xea, 0xff, 0xff, 0x55, 0xea, 0xff, 0xff,
-  0x87, 0xea, 0xff, 0xff, 0xb9, 0xea, 0xff, 0xff, 0xeb, 0xea, 0xff, 0xff,
-  0x1d, 0xeb, 0xff, 0xff, 0x4f, 0xeb, 0xff, 0xff, 0x81, 0xeb, 0xff, 0xff,
-  0xb3, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0x18, 0xec, 0xff, 0xff,
-  0x4a, 0xec, 0xff, 0xff, 0x7c, 0xec, 0xff, 0xff, 0xae, 0xec, 0xff, 0xff,
-  0xe0, 0xec, 0xff, 0xff, 0x12, 0xed, 0xff, 0xff, 0x44, 0xed, 0xff, 0xff,
-  0x77, 0xed, 0xff, 0xff, 0xa9, 0xed, 0xff, 0xff, 0xdb, 0xed, 0xff, 0xff,
-  0x0d, 0xee, 0xff, 0xff, 0x3f, 0xee, 0xff, 0xff, 0x71, 0xee, 0xff, 0xff,
-  0xa3, 0xee, 0xff, 0xff, 0xd6, 0xee, 0xff, 0xff, 0x08, 0xef, 0xff, 0xff,
-  0x3a, 0xef, 0xff, 0xff, 0x6c, 0xef, 0xff, 0xff, 0x9e, 0xef, 0xff, 0xff,
-  0xd0, 0xef, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0x35, 0xf0, 0xff, 0xff,
-  0x67, 0xf0, 0xff, 0xff, 0x99, 0xf0, 0xff, 0xff, 0xcb, 0xf0, 0xff, 0xff,
-  0xfd, 0xf0, 0xff, 0xff, 0x30, 0xf1, 0xff, 0xff, 0x62, 0xf1, 0xff, 0xff,
-  0x94, 0xf1, 0xff, 0xff, 0xc6, 0xf1, 0xff, 0xff, 0xf8, 0xf1, 0xff, 0xff,
-  0x2b, 0xf2, 0xff, 0xff, 0x5d, 0xf2, 0xff, 0xff, 0x8f, 0xf2, 0xff, 0xff,
-  0xc1, 0xf2, 0xff, 0xff, 0xf3, 0xf2, 0xff, 0xff, 0x25, 0xf3, 0xff, 0xff,
-  0x58, 0xf3, 0xff, 0xff, 0x8a, 0xf3, 0xff, 0xff, 0xbc, 0xf3, 0xff, 0xff,
-  0xee, 0xf3, 0xff, 0xff, 0x21, 0xf4, 0xff, 0xff, 0x53, 0xf4, 0xff, 0xff,
-  0x85, 0xf4, 0xff, 0xff, 0xb7, 0xf4, 0xff, 0xff, 0xe9, 0xf4, 0xff, 0xff,
-  0x1c, 0xf5, 0xff, 0xff, 0x4e, 0xf5, 0xff, 0xff, 0x80, 0xf5, 0xff, 0xff,
-  0xb2, 0xf5, 0xff, 0xff, 0xe4, 0xf5, 0xff, 0xff, 0x17, 0xf6, 0xff, 0xff,
-  0x49, 0xf6, 0xff, 0xff, 0x7b, 0xf6, 0xff, 0xff, 0xad, 0xf6, 0xff, 0xff,
-  0xe0, 0xf6, 0xff, 0xff, 0x12, 0xf7, 0xff, 0xff, 0x44, 0xf7, 0xff, 0xff,
-  0x76, 0xf7, 0xff, 0xff, 0xa9, 0xf7, 0xff, 0xff, 0xdb, 0xf7, 0xff, 0xff,
-  0x0d, 0xf8, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x72, 0xf8, 0xff, 0xff,
-  0xa4, 0xf8, 0xff, 0xff, 0xd6, 0xf8, 0xff, 0xff, 0x08, 0xf9, 0xff, 0xff,
-  0x3b, 0xf9, 0xff, 0xff, 0x6d, 0xf9, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff,
-  0xd1, 0xf9, 0xff, 0xff, 0x04, 0xfa, 0xff, 0xff, 0x36, 0xfa, 0xff, 0xff,
-  0x68, 0xfa, 0xff, 0xff, 0x9a, 0xfa, 0xff, 0xff, 0xcd, 0xfa, 0xff, 0xff,
-  0xff, 0xfa, 0xff, 0xff, 0x31, 0xfb, 0xff, 0xff, 0x63, 0xfb, 0xff, 0xff,
-  0x96, 0xfb, 0xff, 0xff, 0xc8, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff,
-  0x2c, 0xfc, 0xff, 0xff, 0x5f, 0xfc, 0xff, 0xff, 0x91, 0xfc, 0xff, 0xff,
-  0xc3, 0xfc, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0x28, 0xfd, 0xff, 0xff,
-  0x5a, 0xfd, 0xff, 0xff, 0x8c, 0xfd, 0xff, 0xff, 0xbe, 0xfd, 0xff, 0xff,
-  0xf1, 0xfd, 0xff, 0xff, 0x23, 0xfe, 0xff, 0xff, 0x55, 0xfe, 0xff, 0xff,
-  0x88, 0xfe, 0xff, 0xff, 0xba, 0xfe, 0xff, 0xff, 0xec, 0xfe, 0xff, 0xff,
-  0x1e, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-  0xb5, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x4b, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
-  0xe2, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00,
-  0x78, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00,
-  0x0f, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00,
-  0xa6, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00,
-  0x3d, 0x03, 0x00, 0x00, 0x6f, 0x03, 0x00, 0x00, 0xa1, 0x03, 0x00, 0x00,
-  0xd4, 0x03, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00,
-  0x6a, 0x04, 0x00, 0x00, 0x9d, 0x04, 0x00, 0x00, 0xcf, 0x04, 0x00, 0x00,
-  0x01, 0x05, 0x00, 0x00, 0x33, 0x05, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00,
-  0x98, 0x05, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00,
-  0x2f, 0x06, 0x00, 0x00, 0x61, 0x06, 0x00, 0x00, 0x93, 0x06, 0x00, 0x00,
-  0xc5, 0x06, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x2a, 0x07, 0x00, 0x00,
-  0x5c, 0x07, 0x00, 0x00, 0x8e, 0x07, 0x00, 0x00, 0xc1, 0x07, 0x00, 0x00,
-  0xf3, 0x07, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0x57, 0x08, 0x00, 0x00,
-  0x8a, 0x08, 0x00, 0x00, 0xbc, 0x08, 0x00, 0x00, 0xee, 0x08, 0x00, 0x00,
-  0x20, 0x09, 0x00, 0x00, 0x53, 0x09, 0x00, 0x00, 0x85, 0x09, 0x00, 0x00,
-  0xb7, 0x09, 0x00, 0x00, 0xe9, 0x09, 0x00, 0x00, 0x1b, 0x0a, 0x00, 0x00,
-  0x4e, 0x0a, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0xb2, 0x0a, 0x00, 0x00,
-  0xe4, 0x0a, 0x00, 0x00, 0x17, 0x0b, 0x00, 0x00, 0x49, 0x0b, 0x00, 0x00,
-  0x7b, 0x0b, 0x00, 0x00, 0xad, 0x0b, 0x00, 0x00, 0xdf, 0x0b, 0x00, 0x00,
-  0x12, 0x0c, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x00,
-  0xa8, 0x0c, 0x00, 0x00, 0xdb, 0x0c, 0x00, 0x00, 0x0d, 0x0d, 0x00, 0x00,
-  0x3f, 0x0d, 0x00, 0x00, 0x71, 0x0d, 0x00, 0x00, 0xa3, 0x0d, 0x00, 0x00,
-  0xd6, 0x0d, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00, 0x3a, 0x0e, 0x00, 0x00,
-  0x6c, 0x0e, 0x00, 0x00, 0x9e, 0x0e, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0x00,
-  0x03, 0x0f, 0x00, 0x00, 0x35, 0x0f, 0x00, 0x00, 0x67, 0x0f, 0x00, 0x00,
-  0x99, 0x0f, 0x00, 0x00, 0xcb, 0x0f, 0x00, 0x00, 0xfd, 0x0f, 0x00, 0x00,
-  0x30, 0x10, 0x00, 0x00, 0x62, 0x10, 0x00, 0x00, 0x94, 0x10, 0x00, 0x00,
-  0xc6, 0x10, 0x00, 0x00, 0xf8, 0x10, 0x00, 0x00, 0x2a, 0x11, 0x00, 0x00,
-  0x5d, 0x11, 0x00, 0x00, 0x8f, 0x11, 0x00, 0x00, 0xc1, 0x11, 0x00, 0x00,
-  0xf3, 0x11, 0x00, 0x00, 0x25, 0x12, 0x00, 0x00, 0x57, 0x12, 0x00, 0x00,
-  0x89, 0x12, 0x00, 0x00, 0xbc, 0x12, 0x00, 0x00, 0xee, 0x12, 0x00, 0x00,
-  0x20, 0x13, 0x00, 0x00, 0x52, 0x13, 0x00, 0x00, 0x84, 0x13, 0x00, 0x00,
-  0xb6, 0x13, 0x00, 0x00, 0xe8, 0x13, 0x00, 0x00, 0x1a, 0x14, 0x00, 0x00,
-  0x4d, 0x14, 0x00, 0x00, 0x7f, 0x14, 0x00, 0x00, 0xb1, 0x14, 0x00, 0x00,
-  0xe3, 0x14, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0x47, 0x15, 0x00, 0x00,
-  0x79, 0x15, 0x00, 0x00, 0xab, 0x15, 0x00, 0x00, 0xdd, 0x15, 0x00, 0x00,
-  0x0f, 0x16, 0x00, 0x00, 0x41, 0x16, 0x00, 0x00, 0x73, 0x16, 0x00, 0x00,
-  0xa6, 0x16, 0x00, 0x00, 0xd8, 0x16, 0x00, 0x00, 0x0a, 0x17, 0x00, 0x00,
-  0x3c, 0x17, 0x00, 0x00, 0x6e, 0x17, 0x00, 0x00, 0xa0, 0x17, 0x00, 0x00,
-  0xd2, 0x17, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00,
-  0x68, 0x18, 0x00, 0x00, 0x9a, 0x18, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00,
-  0xfe, 0x18, 0x00, 0x00, 0x30, 0x19, 0x00, 0x00, 0x62, 0x19, 0x00, 0x00,
-  0x94, 0x19, 0x00, 0x00, 0xc6, 0x19, 0x00, 0x00, 0xf8, 0x19, 0x00, 0x00,
-  0x2a, 0x1a, 0x00, 0x00, 0x5c, 0x1a, 0x00, 0x00, 0x8e, 0x1a, 0x00, 0x00,
-  0xc0, 0x1a, 0x00, 0x00, 0xf2, 0x1a, 0x00, 0x00, 0x24, 0x1b, 0x00, 0x00,
-  0x56, 0x1b, 0x00, 0x00, 0x88, 0x1b, 0x00, 0x00, 0xba, 0x1b, 0x00, 0x00,
-  0xec, 0x1b, 0x00, 0x00, 0x1e, 0x1c, 0x00, 0x00, 0x50, 0x1c, 0x00, 0x00,
-  0x82, 0x1c, 0x00, 0x00, 0xb4, 0x1c, 0x00, 0x00, 0xe6, 0x1c, 0x00, 0x00,
-  0x18, 0x1d, 0x00, 0x00, 0x4a, 0x1d, 0x00, 0x00, 0x7c, 0x1d, 0x00, 0x00,
-  0xae, 0x1d, 0x00, 0x00, 0xe0, 0x1d, 0x00, 0x00, 0x11, 0x1e, 0x00, 0x00,
-  0x43, 0x1e, 0x00, 0x00, 0x75, 0x1e, 0x00, 0x00, 0xa7, 0x1e, 0x00, 0x00,
-  0xd9, 0x1e, 0x00, 0x00, 0x0b, 0x1f, 0x00, 0x00, 0x3d, 0x1f, 0x00, 0x00,
-  0x6f, 0x1f, 0x00, 0x00, 0xa1, 0x1f, 0x00, 0x00, 0xd3, 0x1f, 0x00, 0x00,
-  0x04, 0x20, 0x00, 0x00, 0x36, 0x20, 0x00, 0x00, 0x68, 0x20, 0x00, 0x00,
-  0x9a, 0x20, 0x00, 0x00, 0xcc, 0x20, 0x00, 0x00, 0xfe, 0x20, 0x00, 0x00,
-  0x30, 0x21, 0x00, 0x00, 0x61, 0x21, 0x00, 0x00, 0x93, 0x21, 0x00, 0x00,
-  0xc5, 0x21, 0x00, 0x00, 0xf7, 0x21, 0x00, 0x00, 0x29, 0x22, 0x00, 0x00,
-  0x5a, 0x22, 0x00, 0x00, 0x8c, 0x22, 0x00, 0x00, 0xbe, 0x22, 0x00, 0x00,
-  0xf0, 0x22, 0x00, 0x00, 0x22, 0x23, 0x00, 0x00, 0x53, 0x23, 0x00, 0x00,
-  0x85, 0x23, 0x00, 0x00, 0xb7, 0x23, 0x00, 0x00, 0xe9, 0x23, 0x00, 0x00,
-  0x1b, 0x24, 0x00, 0x00, 0x4c, 0x24, 0x00, 0x00, 0x7e, 0x24, 0x00, 0x00,
-  0xb0, 0x24, 0x00, 0x00, 0xe2, 0x24, 0x00, 0x00, 0x13, 0x25, 0x00, 0x00,
-  0x45, 0x25, 0x00, 0x00, 0x77, 0x25, 0x00, 0x00, 0xa8, 0x25, 0x00, 0x00,
-  0xda, 0x25, 0x00, 0x00, 0x0c, 0x26, 0x00, 0x00, 0x3e, 0x26, 0x00, 0x00,
-  0x6f, 0x26, 0x00, 0x00, 0xa1, 0x26, 0x00, 0x00, 0xd3, 0x26, 0x00, 0x00,
-  0x04, 0x27, 0x00, 0x00, 0x36, 0x27, 0x00, 0x00, 0x68, 0x27, 0x00, 0x00,
-  0x99, 0x27, 0x00, 0x00, 0xcb, 0x27, 0x00, 0x00, 0xfd, 0x27, 0x00, 0x00,
-  0x2e, 0x28, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00, 0x92, 0x28, 0x00, 0x00,
-  0xc3, 0x28, 0x00, 0x00, 0xf5, 0x28, 0x00, 0x00, 0x26, 0x29, 0x00, 0x00,
-  0x58, 0x29, 0x00, 0x00, 0x8a, 0x29, 0x00, 0x00, 0xbb, 0x29, 0x00, 0x00,
-  0xed, 0x29, 0x00, 0x00, 0x1e, 0x2a, 0x00, 0x00, 0x50, 0x2a, 0x00, 0x00,
-  0x82, 0x2a, 0x00, 0x00, 0xb3, 0x2a, 0x00, 0x00, 0xe5, 0x2a, 0x00, 0x00,
-  0x16, 0x2b, 0x00, 0x00, 0x48, 0x2b, 0x00, 0x00, 0x79, 0x2b, 0x00, 0x00,
-  0xab, 0x2b, 0x00, 0x00, 0xdc, 0x2b, 0x00, 0x00, 0x0e, 0x2c, 0x00, 0x00,
-  0x3f, 0x2c, 0x00, 0x00, 0x71, 0x2c, 0x00, 0x00, 0xa2, 0x2c, 0x00, 0x00,
-  0xd4, 0x2c, 0x00, 0x00, 0x05, 0x2d, 0x00, 0x00, 0x37, 0x2d, 0x00, 0x00,
-  0x68, 0x2d, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0x00, 0xcb, 0x2d, 0x00, 0x00,
-  0xfd, 0x2d, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x00, 0x60, 0x2e, 0x00, 0x00,
-  0x91, 0x2e, 0x00, 0x00, 0xc2, 0x2e, 0x00, 0x00, 0xf4, 0x2e, 0x00, 0x00,
-  0x25, 0x2f, 0x00, 0x00, 0x57, 0x2f, 0x00, 0x00, 0x88, 0x2f, 0x00, 0x00,
-  0xba, 0x2f, 0x00, 0x00, 0xeb, 0x2f, 0x00, 0x00, 0x1c, 0x30, 0x00, 0x00,
-  0x4e, 0x30, 0x00, 0x00, 0x7f, 0x30, 0x00, 0x00, 0xb0, 0x30, 0x00, 0x00,
-  0xe2, 0x30, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00, 0x44, 0x31, 0x00, 0x00,
-  0x76, 0x31, 0x00, 0x00, 0xa7, 0x31, 0x00, 0x00, 0xd8, 0x31, 0x00, 0x00,
-  0x0a, 0x32, 0x00, 0x00, 0x3b, 0x32, 0x00, 0x00, 0x6c, 0x32, 0x00, 0x00,
-  0x9d, 0x32, 0x00, 0x00, 0xcf, 0x32, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00,
-  0x31, 0x33, 0x00, 0x00, 0x62, 0x33, 0x00, 0x00, 0x94, 0x33, 0x00, 0x00,
-  0xc5, 0x33, 0x00, 0x00, 0xf6, 0x33, 0x00, 0x00, 0x27, 0x34, 0x00, 0x00,
-  0x59, 0x34, 0x00, 0x00, 0x8a, 0x34, 0x00, 0x00, 0xbb, 0x34, 0x00, 0x00,
-  0xec, 0x34, 0x00, 0x00, 0x1d, 0x35, 0x00, 0x00, 0x4f, 0x35, 0x00, 0x00,
-  0x80, 0x35, 0x00, 0x00, 0xb1, 0x35, 0x00, 0x00, 0xe2, 0x35, 0x00, 0x00,
-  0x13, 0x36, 0x00, 0x00, 0x44, 0x36, 0x00, 0x00, 0x75, 0x36, 0x00, 0x00,
-  0xa6, 0x36, 0x00, 0x00, 0xd8, 0x36, 0x00, 0x00, 0x09, 0x37, 0x00, 0x00,
-  0x3a, 0x37, 0x00, 0x00, 0x6b, 0x37, 0x00, 0x00, 0x9c, 0x37, 0x00, 0x00,
-  0xcd, 0x37, 0x00, 0x00, 0xfe, 0x37, 0x00, 0x00, 0x2f, 0x38, 0x00, 0x00,
-  0x60, 0x38, 0x00, 0x00, 0x91, 0x38, 0x00, 0x00, 0xc2, 0x38, 0x00, 0x00,
-  0xf3, 0x38, 0x00, 0x00, 0x24, 0x39, 0x00, 0x00, 0x55, 0x39, 0x00, 0x00,
-  0x86, 0x39, 0x00, 0x00, 0xb7, 0x39, 0x00, 0x00, 0xe8, 0x39, 0x00, 0x00,
-  0x19, 0x3a, 0x00, 0x00, 0x4a, 0x3a, 0x00, 0x00, 0x7b, 0x3a, 0x00, 0x00,
-  0xac, 0x3a, 0x00, 0x00, 0xdd, 0x3a, 0x00, 0x00, 0x0e, 0x3b, 0x00, 0x00,
-  0x3f, 0x3b, 0x00, 0x00, 0x6f, 0x3b, 0x00, 0x00, 0xa0, 0x3b, 0x00, 0x00,
-  0xd1, 0x3b, 0x00, 0x00, 0x02, 0x3c, 0x00, 0x00, 0x33, 0x3c, 0x00, 0x00,
-  0x64, 0x3c, 0x00, 0x00, 0x95, 0x3c, 0x00, 0x00, 0xc5, 0x3c, 0x00, 0x00,
-  0xf6, 0x3c, 0x00, 0x00, 0x27, 0x3d, 0x00, 0x00, 0x58, 0x3d, 0x00, 0x00,
-  0x89, 0x3d, 0x00, 0x00, 0xba, 0x3d, 0x00, 0x00, 0xea, 0x3d, 0x00, 0x00,
-  0x1b, 0x3e, 0x00, 0x00, 0x4c, 0x3e, 0x00, 0x00, 0x7d, 0x3e, 0x00, 0x00,
-  0xad, 0x3e, 0x00, 0x00, 0xde, 0x3e, 0x00, 0x00, 0x0f, 0x3f, 0x00, 0x00,
-  0x3f, 0x3f, 0x00, 0x00, 0x70, 0x3f, 0x00, 0x00, 0xa1, 0x3f, 0x00, 0x00,
-  0xd2, 0x3f, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x33, 0x40, 0x00, 0x00,
-  0x64, 0x40, 0x00, 0x00, 0x94, 0x40, 0x00, 0x00, 0xc5, 0x40, 0x00, 0x00,
-  0xf5, 0x40, 0x00, 0x00, 0x26, 0x41, 0x00, 0x00, 0x57, 0x41, 0x00, 0x00,
-  0x87, 0x41, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00,
-  0x19, 0x42, 0x00, 0x00, 0x4a, 0x42, 0x00, 0x00, 0x7a, 0x42, 0x00, 0x00,
-  0xab, 0x42, 0x00, 0x00, 0xdb, 0x42, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00,
-  0x3c, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x9d, 0x43, 0x00, 0x00,
-  0xce, 0x43, 0x00, 0x00, 0xfe, 0x43, 0x00, 0x00, 0x2f, 0x44, 0x00, 0x00,
-  0x5f, 0x44, 0x00, 0x00, 0x8f, 0x44, 0x00, 0x00, 0xc0, 0x44, 0x00, 0x00,
-  0xf0, 0x44, 0x00, 0x00, 0x21, 0x45, 0x00, 0x00, 0x51, 0x45, 0x00, 0x00,
-  0x81, 0x45, 0x00, 0x00, 0xb2, 0x45, 0x00, 0x00, 0xe2, 0x45, 0x00, 0x00,
-  0x13, 0x46, 0x00, 0x00, 0x43, 0x46, 0x00, 0x00, 0x73, 0x46, 0x00, 0x00,
-  0xa4, 0x46, 0x00, 0x00, 0xd4, 0x46, 0x00, 0x00, 0x04, 0x47, 0x00, 0x00,
-  0x34, 0x47, 0x00, 0x00, 0x65, 0x47, 0x00, 0x00, 0x95, 0x47, 0x00, 0x00,
-  0xc5, 0x47, 0x00, 0x00, 0xf5, 0x47, 0x00, 0x00, 0x26, 0x48, 0x00, 0x00,
-  0x56, 0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x00, 0xb6, 0x48, 0x00, 0x00,
-  0xe7, 0x48, 0x00, 0x00, 0x17, 0x49, 0x00, 0x00, 0x47, 0x49, 0x00, 0x00,
-  0x77, 0x49, 0x00, 0x00, 0xa7, 0x49, 0x00, 0x00, 0xd7, 0x49, 0x00, 0x00,
-  0x07, 0x4a, 0x00, 0x00, 0x38, 0x4a, 0x00, 0x00, 0x68, 0x4a, 0x00, 0x00,
-  0x98, 0x4a, 0x00, 0x00, 0xc8, 0x4a, 0x00, 0x00, 0xf8, 0x4a, 0x00, 0x00,
-  0x28, 0x4b, 0x00, 0x00, 0x58, 0x4b, 0x00, 0x00, 0x88, 0x4b, 0x00, 0x00,
-  0xb8, 0x4b, 0x00, 0x00, 0xe8, 0x4b, 0x00, 0x00, 0x18, 0x4c, 0x00, 0x00,
-  0x48, 0x4c, 0x00, 0x00, 0x78, 0x4c, 0x00, 0x00, 0xa8, 0x4c, 0x00, 0x00,
-  0xd8, 0x4c, 0x00, 0x00, 0x08, 0x4d, 0x00, 0x00, 0x38, 0x4d, 0x00, 0x00,
-  0x68, 0x4d, 0x00, 0x00, 0x98, 0x4d, 0x00, 0x00, 0xc8, 0x4d, 0x00, 0x00,
-  0xf7, 0x4d, 0x00, 0x00, 0x27, 0x4e, 0x00, 0x00, 0x57, 0x4e, 0x00, 0x00,
-  0x87, 0x4e, 0x00, 0x00, 0xb7, 0x4e, 0x00, 0x00, 0xe7, 0x4e, 0x00, 0x00,
-  0x16, 0x4f, 0x00, 0x00, 0x46, 0x4f, 0x00, 0x00, 0x76, 0x4f, 0x00, 0x00,
-  0xa6, 0x4f, 0x00, 0x00, 0xd6, 0x4f, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-  0x35, 0x50, 0x00, 0x00, 0x65, 0x50, 0x00, 0x00, 0x95, 0x50, 0x00, 0x00,
-  0xc4, 0x50, 0x00, 0x00, 0xf4, 0x50, 0x00, 0x00, 0x24, 0x51, 0x00, 0x00,
-  0x53, 0x51, 0x00, 0x00, 0x83, 0x51, 0x00, 0x00, 0xb3, 0x51, 0x00, 0x00,
-  0xe2, 0x51, 0x00, 0x00, 0x12, 0x52, 0x00, 0x00, 0x41, 0x52, 0x00, 0x00,
-  0x71, 0x52, 0x00, 0x00, 0xa1, 0x52, 0x00, 0x00, 0xd0, 0x52, 0x00, 0x00,
-  0x00, 0x53, 0x00, 0x00, 0x2f, 0x53, 0x00, 0x00, 0x5f, 0x53, 0x00, 0x00,
-  0x8e, 0x53, 0x00, 0x00, 0xbe, 0x53, 0x00, 0x00, 0xed, 0x53, 0x00, 0x00,
-  0x1d, 0x54, 0x00, 0x00, 0x4c, 0x54, 0x00, 0x00, 0x7c, 0x54, 0x00, 0x00,
-  0xab, 0x54, 0x00, 0x00, 0xdb, 0x54, 0x00, 0x00, 0x0a, 0x55, 0x00, 0x00,
-  0x39, 0x55, 0x00, 0x00, 0x69, 0x55, 0x00, 0x00, 0x98, 0x55, 0x00, 0x00,
-  0xc8, 0x55, 0x00, 0x00, 0xf7, 0x55, 0x00, 0x00, 0x26, 0x56, 0x00, 0x00,
-  0x56, 0x56, 0x00, 0x00, 0x85, 0x56, 0x00, 0x00, 0xb4, 0x56, 0x00, 0x00,
-  0xe3, 0x56, 0x00, 0x00, 0x13, 0x57, 0x00, 0x00, 0x42, 0x57, 0x00, 0x00,
-  0x71, 0x57, 0x00, 0x00, 0xa0, 0x57, 0x00, 0x00, 0xd0, 0x57, 0x00, 0x00,
-  0xff, 0x57, 0x00, 0x00, 0x2e, 0x58, 0x00, 0x00, 0x5d, 0x58, 0x00, 0x00,
-  0x8c, 0x58, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0xeb, 0x58, 0x00, 0x00,
-  0x1a, 0x59, 0x00, 0x00, 0x49, 0x59, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00,
-  0xa7, 0x59, 0x00, 0x00, 0xd6, 0x59, 0x00, 0x00, 0x05, 0x5a, 0x00, 0x00,
-  0x34, 0x5a, 0x00, 0x00, 0x63, 0x5a, 0x00, 0x00, 0x92, 0x5a, 0x00, 0x00,
-  0xc1, 0x5a, 0x00, 0x00, 0xf0, 0x5a, 0x00, 0x00, 0x1f, 0x5b, 0x00, 0x00,
-  0x4e, 0x5b, 0x00, 0x00, 0x7d, 0x5b, 0x00, 0x00, 0xac, 0x5b, 0x00, 0x00,
-  0xdb, 0x5b, 0x00, 0x00, 0x0a, 0x5c, 0x00, 0x00, 0x39, 0x5c, 0x00, 0x00,
-  0x68, 0x5c, 0x00, 0x00, 0x97, 0x5c, 0x00, 0x00, 0xc6, 0x5c, 0x00, 0x00,
-  0xf4, 0x5c, 0x00, 0x00, 0x23, 0x5d, 0x00, 0x00, 0x52, 0x5d, 0x00, 0x00,
-  0x81, 0x5d, 0x00, 0x00, 0xb0, 0x5d, 0x00, 0x00, 0xde, 0x5d, 0x00, 0x00,
-  0x0d, 0x5e, 0x00, 0x00, 0x3c, 0x5e, 0x00, 0x00, 0x6b, 0x5e, 0x00, 0x00,
-  0x99, 0x5e, 0x00, 0x00, 0xc8, 0x5e, 0x00, 0x00, 0xf7, 0x5e, 0x00, 0x00,
-  0x25, 0x5f, 0x00, 0x00, 0x54, 0x5f, 0x00, 0x00, 0x83, 0x5f, 0x00, 0x00,
-  0xb1, 0x5f, 0x00, 0x00, 0xe0, 0x5f, 0x00, 0x00, 0x0f, 0x60, 0x00, 0x00,
-  0x3d, 0x60, 0x00, 0x00, 0x6c, 0x60, 0x00, 0x00, 0x9a, 0x60, 0x00, 0x00,
-  0xc9, 0x60, 0x00, 0x00, 0xf7, 0x60, 0x00, 0x00, 0x26, 0x61, 0x00, 0x00,
-  0x54, 0x61, 0x00, 0x00, 0x83, 0x61, 0x00, 0x00, 0xb1, 0x61, 0x00, 0x00,
-  0xe0, 0x61, 0x00, 0x00, 0x0e, 0x62, 0x00, 0x00, 0x3d, 0x62, 0x00, 0x00,
-  0x6b, 0x62, 0x00, 0x00, 0x99, 0x62, 0x00, 0x00, 0xc8, 0x62, 0x00, 0x00,
-  0xf6, 0x62, 0x00, 0x00, 0x25, 0x63, 0x00, 0x00, 0x53, 0x63, 0x00, 0x00,
-  0x81, 0x63, 0x00, 0x00, 0xb0, 0x63, 0x00, 0x00, 0xde, 0x63, 0x00, 0x00,
-  0x0c, 0x64, 0x00, 0x00, 0x3a, 0x64, 0x00, 0x00, 0x69, 0x64, 0x00, 0x00,
-  0x97, 0x64, 0x00, 0x00, 0xc5, 0x64, 0x00, 0x00, 0xf3, 0x64, 0x00, 0x00,
-  0x21, 0x65, 0x00, 0x00, 0x50, 0x65, 0x00, 0x00, 0x7e, 0x65, 0x00, 0x00,
-  0xac, 0x65, 0x00, 0x00, 0xda, 0x65, 0x00, 0x00, 0x08, 0x66, 0x00, 0x00,
-  0x36, 0x66, 0x00, 0x00, 0x64, 0x66, 0x00, 0x00, 0x92, 0x66, 0x00, 0x00,
-  0xc0, 0x66, 0x00, 0x00, 0xee, 0x66, 0x00, 0x00, 0x1c, 0x67, 0x00, 0x00,
-  0x4a, 0x67, 0x00, 0x00, 0x78, 0x67, 0x00, 0x00, 0xa6, 0x67, 0x00, 0x00,
-  0xd4, 0x67, 0x00, 0x00, 0x02, 0x68, 0x00, 0x00, 0x30, 0x68, 0x00, 0x00,
-  0x5e, 0x68, 0x00, 0x00, 0x8c, 0x68, 0x00, 0x00, 0xba, 0x68, 0x00, 0x00,
-  0xe8, 0x68, 0x00, 0x00, 0x16, 0x69, 0x00, 0x00, 0x43, 0x69, 0x00, 0x00,
-  0x71, 0x69, 0x00, 0x00, 0x9f, 0x69, 0x00, 0x00, 0xcd, 0x69, 0x00, 0x00,
-  0xfb, 0x69, 0x00, 0x00, 0x28, 0x6a, 0x00, 0x00, 0x56, 0x6a, 0x00, 0x00,
-  0x84, 0x6a, 0x00, 0x00, 0xb1, 0x6a, 0x00, 0x00, 0xdf, 0x6a, 0x00, 0x00,
-  0x0d, 0x6b, 0x00, 0x00, 0x3a, 0x6b, 0x00, 0x00, 0x68, 0x6b, 0x00, 0x00,
-  0x96, 0x6b, 0x00, 0x00, 0xc3, 0x6b, 0x00, 0x00, 0xf1, 0x6b, 0x00, 0x00,
-  0x1e, 0x6c, 0x00, 0x00, 0x4c, 0x6c, 0x00, 0x00, 0x7a, 0x6c, 0x00, 0x00,
-  0xa7, 0x6c, 0x00, 0x00, 0xd5, 0x6c, 0x00, 0x00, 0x02, 0x6d, 0x00, 0x00,
-  0x30, 0x6d, 0x00, 0x00, 0x5d, 0x6d, 0x00, 0x00, 0x8a, 0x6d, 0x00, 0x00,
-  0xb8, 0x6d, 0x00, 0x00, 0xe5, 0x6d, 0x00, 0x00, 0x13, 0x6e, 0x00, 0x00,
-  0x40, 0x6e, 0x00, 0x00, 0x6d, 0x6e, 0x00, 0x00, 0x9b, 0x6e, 0x00, 0x00,
-  0xc8, 0x6e, 0x00, 0x00, 0xf5, 0x6e, 0x00, 0x00, 0x23, 0x6f, 0x00, 0x00,
-  0x50, 0x6f, 0x00, 0x00, 0x7d, 0x6f, 0x00, 0x00, 0xaa, 0x6f, 0x00, 0x00,
-  0xd8, 0x6f, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00, 0x32, 0x70, 0x00, 0x00,
-  0x5f, 0x70, 0x00, 0x00, 0x8c, 0x70, 0x00, 0x00, 0xba, 0x70, 0x00, 0x00,
-  0xe7, 0x70, 0x00, 0x00, 0x14, 0x71, 0x00, 0x00, 0x41, 0x71, 0x00, 0x00,
-  0x6e, 0x71, 0x00, 0x00, 0x9b, 0x71, 0x00, 0x00, 0xc8, 0x71, 0x00, 0x00,
-  0xf5, 0x71, 0x00, 0x00, 0x22, 0x72, 0x00, 0x00, 0x4f, 0x72, 0x00, 0x00,
-  0x7c, 0x72, 0x00, 0x00, 0xa9, 0x72, 0x00, 0x00, 0xd6, 0x72, 0x00, 0x00,
-  0x03, 0x73, 0x00, 0x00, 0x30, 0x73, 0x00, 0x00, 0x5d, 0x73, 0x00, 0x00,
-  0x89, 0x73, 0x00, 0x00, 0xb6, 0x73, 0x00, 0x00, 0xe3, 0x73, 0x00, 0x00,
-  0x10, 0x74, 0x00, 0x00, 0x3d, 0x74, 0x00, 0x00, 0x69, 0x74, 0x00, 0x00,
-  0x96, 0x74, 0x00, 0x00, 0xc3, 0x74, 0x00, 0x00, 0xf0, 0x74, 0x00, 0x00,
-  0x1c, 0x75, 0x00, 0x00, 0x49, 0x75, 0x00, 0x00, 0x76, 0x75, 0x00, 0x00,
-  0xa2, 0x75, 0x00, 0x00, 0xcf, 0x75, 0x00, 0x00, 0xfc, 0x75, 0x00, 0x00,
-  0x28, 0x76, 0x00, 0x00, 0x55, 0x76, 0x00, 0x00, 0x81, 0x76, 0x00, 0x00,
-  0xae, 0x76, 0x00, 0x00, 0xdb, 0x76, 0x00, 0x00, 0x07, 0x77, 0x00, 0x00,
-  0x34, 0x77, 0x00, 0x00, 0x60, 0x77, 0x00, 0x00, 0x8c, 0x77, 0x00, 0x00,
-  0xb9, 0x77, 0x00, 0x00, 0xe5, 0x77, 0x00, 0x00, 0x12, 0x78, 0x00, 0x00,
-  0x3e, 0x78, 0x00, 0x00, 0x6a, 0x78, 0x00, 0x00, 0x97, 0x78, 0x00, 0x00,
-  0xc3, 0x78, 0x00, 0x00, 0xef, 0x78, 0x00, 0x00, 0x1c, 0x79, 0x00, 0x00,
-  0x48, 0x79, 0x00, 0x00, 0x74, 0x79, 0x00, 0x00, 0xa0, 0x79, 0x00, 0x00,
-  0xcd, 0x79, 0x00, 0x00, 0xf9, 0x79, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x00,
-  0x51, 0x7a, 0x00, 0x00, 0x7d, 0x7a, 0x00, 0x00, 0xaa, 0x7a, 0x00, 0x00,
-  0xd6, 0x7a, 0x00, 0x00, 0x02, 0x7b, 0x00, 0x00, 0x2e, 0x7b, 0x00, 0x00,
-  0x5a, 0x7b, 0x00, 0x00, 0x86, 0x7b, 0x00, 0x00, 0xb2, 0x7b, 0x00, 0x00,
-  0xde, 0x7b, 0x00, 0x00, 0x0a, 0x7c, 0x00, 0x00, 0x36, 0x7c, 0x00, 0x00,
-  0x62, 0x7c, 0x00, 0x00, 0x8e, 0x7c, 0x00, 0x00, 0xba, 0x7c, 0x00, 0x00,
-  0xe6, 0x7c, 0x00, 0x00, 0x11, 0x7d, 0x00, 0x00, 0x3d, 0x7d, 0x00, 0x00,
-  0x69, 0x7d, 0x00, 0x00, 0x95, 0x7d, 0x00, 0x00, 0xc1, 0x7d, 0x00, 0x00,
-  0xec, 0x7d, 0x00, 0x00, 0x18, 0x7e, 0x00, 0x00, 0x44, 0x7e, 0x00, 0x00,
-  0x70, 0x7e, 0x00, 0x00, 0x9b, 0x7e, 0x00, 0x00, 0xc7, 0x7e, 0x00, 0x00,
-  0xf3, 0x7e, 0x00, 0x00, 0x1e, 0x7f, 0x00, 0x00, 0x4a, 0x7f, 0x00, 0x00,
-  0x76, 0x7f, 0x00, 0x00, 0xa1, 0x7f, 0x00, 0x00, 0xcd, 0x7f, 0x00, 0x00,
-  0xf8, 0x7f, 0x00, 0x00, 0x24, 0x80, 0x00, 0x00, 0x4f, 0x80, 0x00, 0x00,
-  0x7b, 0x80, 0x00, 0x00, 0xa6, 0x80, 0x00, 0x00, 0xd2, 0x80, 0x00, 0x00,
-  0xfd, 0x80, 0x00, 0x00, 0x29, 0x81, 0x00, 0x00, 0x54, 0x81, 0x00, 0x00,
-  0x7f, 0x81, 0x00, 0x00, 0xab, 0x81, 0x00, 0x00, 0xd6, 0x81, 0x00, 0x00,
-  0x01, 0x82, 0x00, 0x00, 0x2d, 0x82, 0x00, 0x00, 0x58, 0x82, 0x00, 0x00,
-  0x83, 0x82, 0x00, 0x00, 0xae, 0x82, 0x00, 0x00, 0xda, 0x82, 0x00, 0x00,
-  0x05, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x5b, 0x83, 0x00, 0x00,
-  0x86, 0x83, 0x00, 0x00, 0xb1, 0x83, 0x00, 0x00, 0xdc, 0x83, 0x00, 0x00,
-  0x07, 0x84, 0x00, 0x00, 0x33, 0x84, 0x00, 0x00, 0x5e, 0x84, 0x00, 0x00,
-  0x89, 0x84, 0x00, 0x00, 0xb4, 0x84, 0x00, 0x00, 0xdf, 0x84, 0x00, 0x00,
-  0x09, 0x85, 0x00, 0x00, 0x34, 0x85, 0x00, 0x00, 0x5f, 0x85, 0x00, 0x00,
-  0x8a, 0x85, 0x00, 0x00, 0xb5, 0x85, 0x00, 0x00, 0xe0, 0x85, 0x00, 0x00,
-  0x0b, 0x86, 0x00, 0x00, 0x36, 0x86, 0x00, 0x00, 0x60, 0x86, 0x00, 0x00,
-  0x8b, 0x86, 0x00, 0x00, 0xb6, 0x86, 0x00, 0x00, 0xe1, 0x86, 0x00, 0x00,
-  0x0b, 0x87, 0x00, 0x00, 0x36, 0x87, 0x00, 0x00, 0x61, 0x87, 0x00, 0x00,
-  0x8b, 0x87, 0x00, 0x00, 0xb6, 0x87, 0x00, 0x00, 0xe1, 0x87, 0x00, 0x00,
-  0x0b, 0x88, 0x00, 0x00, 0x36, 0x88, 0x00, 0x00, 0x60, 0x88, 0x00, 0x00,
-  0x8b, 0x88, 0x00, 0x00, 0xb5, 0x88, 0x00, 0x00, 0xe0, 0x88, 0x00, 0x00,
-  0x0a, 0x89, 0x00, 0x00, 0x35, 0x89, 0x00, 0x00, 0x5f, 0x89, 0x00, 0x00,
-  0x8a, 0x89, 0x00, 0x00, 0xb4, 0x89, 0x00, 0x00, 0xde, 0x89, 0x00, 0x00,
-  0x09, 0x8a, 0x00, 0x00, 0x33, 0x8a, 0x00, 0x00, 0x5d, 0x8a, 0x00, 0x00,
-  0x88, 0x8a, 0x00, 0x00, 0xb2, 0x8a, 0x00, 0x00, 0xdc, 0x8a, 0x00, 0x00,
-  0x06, 0x8b, 0x00, 0x00, 0x31, 0x8b, 0x00, 0x00, 0x5b, 0x8b, 0x00, 0x00,
-  0x85, 0x8b, 0x00, 0x00, 0xaf, 0x8b, 0x00, 0x00, 0xd9, 0x8b, 0x00, 0x00,
-  0x03, 0x8c, 0x00, 0x00, 0x2d, 0x8c, 0x00, 0x00, 0x57, 0x8c, 0x00, 0x00,
-  0x81, 0x8c, 0x00, 0x00, 0xab, 0x8c, 0x00, 0x00, 0xd5, 0x8c, 0x00, 0x00,
-  0xff, 0x8c, 0x00, 0x00, 0x29, 0x8d, 0x00, 0x00, 0x53, 0x8d, 0x00, 0x00,
-  0x7d, 0x8d, 0x00, 0x00, 0xa7, 0x8d, 0x00, 0x00, 0xd1, 0x8d, 0x00, 0x00,
-  0xfb, 0x8d, 0x00, 0x00, 0x24, 0x8e, 0x00, 0x00, 0x4e, 0x8e, 0x00, 0x00,
-  0x78, 0x8e, 0x00, 0x00, 0xa2, 0x8e, 0x00, 0x00, 0xcc, 0x8e, 0x00, 0x00,
-  0xf5, 0x8e, 0x00, 0x00, 0x1f, 0x8f, 0x00, 0x00, 0x49, 0x8f, 0x00, 0x00,
-  0x72, 0x8f, 0x00, 0x00, 0x9c, 0x8f, 0x00, 0x00, 0xc5, 0x8f, 0x00, 0x00,
-  0xef, 0x8f, 0x00, 0x00, 0x19, 0x90, 0x00, 0x00, 0x42, 0x90, 0x00, 0x00,
-  0x6c, 0x90, 0x00, 0x00, 0x95, 0x90, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00,
-  0xe8, 0x90, 0x00, 0x00, 0x11, 0x91, 0x00, 0x00, 0x3b, 0x91, 0x00, 0x00,
-  0x64, 0x91, 0x00, 0x00, 0x8e, 0x91, 0x00, 0x00, 0xb7, 0x91, 0x00, 0x00,
-  0xe0, 0x91, 0x00, 0x00, 0x0a, 0x92, 0x00, 0x00, 0x33, 0x92, 0x00, 0x00,
-  0x5c, 0x92, 0x00, 0x00, 0x85, 0x92, 0x00, 0x00, 0xaf, 0x92, 0x00, 0x00,
-  0xd8, 0x92, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0x2a, 0x93, 0x00, 0x00,
-  0x53, 0x93, 0x00, 0x00, 0x7c, 0x93, 0x00, 0x00, 0xa5, 0x93, 0x00, 0x00,
-  0xce, 0x93, 0x00, 0x00, 0xf7, 0x93, 0x00, 0x00, 0x20, 0x94, 0x00, 0x00,
-  0x49, 0x94, 0x00, 0x00, 0x72, 0x94, 0x00, 0x00, 0x9b, 0x94, 0x00, 0x00,
-  0xc4, 0x94, 0x00, 0x00, 0xed, 0x94, 0x00, 0x00, 0x16, 0x95, 0x00, 0x00,
-  0x3f, 0x95, 0x00, 0x00, 0x68, 0x95, 0x00, 0x00, 0x90, 0x95, 0x00, 0x00,
-  0xb9, 0x95, 0x00, 0x00, 0xe2, 0x95, 0x00, 0x00, 0x0b, 0x96, 0x00, 0x00,
-  0x33, 0x96, 0x00, 0x00, 0x5c, 0x96, 0x00, 0x00, 0x85, 0x96, 0x00, 0x00,
-  0xad, 0x96, 0x00, 0x00, 0xd6, 0x96, 0x00, 0x00, 0xff, 0x96, 0x00, 0x00,
-  0x27, 0x97, 0x00, 0x00, 0x50, 0x97, 0x00, 0x00, 0x78, 0x97, 0x00, 0x00,
-  0xa1, 0x97, 0x00, 0x00, 0xc9, 0x97, 0x00, 0x00, 0xf2, 0x97, 0x00, 0x00,
-  0x1a, 0x98, 0x00, 0x00, 0x43, 0x98, 0x00, 0x00, 0x6b, 0x98, 0x00, 0x00,
-  0x93, 0x98, 0x00, 0x00, 0xbc, 0x98, 0x00, 0x00, 0xe4, 0x98, 0x00, 0x00,
-  0x0c, 0x99, 0x00, 0x00, 0x35, 0x99, 0x00, 0x00, 0x5d, 0x99, 0x00, 0x00,
-  0x85, 0x99, 0x00, 0x00, 0xad, 0x99, 0x00, 0x00, 0xd6, 0x99, 0x00, 0x00,
-  0xfe, 0x99, 0x00, 0x00, 0x26, 0x9a, 0x00, 0x00, 0x4e, 0x9a, 0x00, 0x00,
-  0x76, 0x9a, 0x00, 0x00, 0x9e, 0x9a, 0x00, 0x00, 0xc6, 0x9a, 0x00, 0x00,
-  0xee, 0x9a, 0x00, 0x00, 0x16, 0x9b, 0x00, 0x00, 0x3e, 0x9b, 0x00, 0x00,
-  0x66, 0x9b, 0x00, 0x00, 0x8e, 0x9b, 0x00, 0x00, 0xb6, 0x9b, 0x00, 0x00,
-  0xde, 0x9b, 0x00, 0x00, 0x06, 0x9c, 0x00, 0x00, 0x2e, 0x9c, 0x00, 0x00,
-  0x55, 0x9c, 0x00, 0x00, 0x7d, 0x9c, 0x00, 0x00, 0xa5, 0x9c, 0x00, 0x00,
-  0xcd, 0x9c, 0x00, 0x00, 0xf4, 0x9c, 0x00, 0x00, 0x1c, 0x9d, 0x00, 0x00,
-  0x44, 0x9d, 0x00, 0x00, 0x6b, 0x9d, 0x00, 0x00, 0x93, 0x9d, 0x00, 0x00,
-  0xbb, 0x9d, 0x00, 0x00, 0xe2, 0x9d, 0x00, 0x00, 0x0a, 0x9e, 0x00, 0x00,
-  0x31, 0x9e, 0x00, 0x00, 0x59, 0x9e, 0x00, 0x00, 0x80, 0x9e, 0x00, 0x00,
-  0xa8, 0x9e, 0x00, 0x00, 0xcf, 0x9e, 0x00, 0x00, 0xf7, 0x9e, 0x00, 0x00,
-  0x1e, 0x9f, 0x00, 0x00, 0x45, 0x9f, 0x00, 0x00, 0x6d, 0x9f, 0x00, 0x00,
-  0x94, 0x9f, 0x00, 0x00, 0xbb, 0x9f, 0x00, 0x00, 0xe3, 0x9f, 0x00, 0x00,
-  0x0a, 0xa0, 0x00, 0x00, 0x31, 0xa0, 0x00, 0x00, 0x58, 0xa0, 0x00, 0x00,
-  0x7f, 0xa0, 0x00, 0x00, 0xa7, 0xa0, 0x00, 0x00, 0xce, 0xa0, 0x00, 0x00,
-  0xf5, 0xa0, 0x00, 0x00, 0x1c, 0xa1, 0x00, 0x00, 0x43, 0xa1, 0x00, 0x00,
-  0x6a, 0xa1, 0x00, 0x00, 0x91, 0xa1, 0x00, 0x00, 0xb8, 0xa1, 0x00, 0x00,
-  0xdf, 0xa1, 0x00, 0x00, 0x06, 0xa2, 0x00, 0x00, 0x2d, 0xa2, 0x00, 0x00,
-  0x54, 0xa2, 0x00, 0x00, 0x7b, 0xa2, 0x00, 0x00, 0xa1, 0xa2, 0x00, 0x00,
-  0xc8, 0xa2, 0x00, 0x00, 0xef, 0xa2, 0x00, 0x00, 0x16, 0xa3, 0x00, 0x00,
-  0x3c, 0xa3, 0x00, 0x00, 0x63, 0xa3, 0x00, 0x00, 0x8a, 0xa3, 0x00, 0x00,
-  0xb0, 0xa3, 0x00, 0x00, 0xd7, 0xa3, 0x00, 0x00, 0xfe, 0xa3, 0x00, 0x00,
-  0x24, 0xa4, 0x00, 0x00, 0x4b, 0xa4, 0x00, 0x00, 0x71, 0xa4, 0x00, 0x00,
-  0x98, 0xa4, 0x00, 0x00, 0xbe, 0xa4, 0x00, 0x00, 0xe5, 0xa4, 0x00, 0x00,
-  0x0b, 0xa5, 0x00, 0x00, 0x32, 0xa5, 0x00, 0x00, 0x58, 0xa5, 0x00, 0x00,
-  0x7e, 0xa5, 0x00, 0x00, 0xa5, 0xa5, 0x00, 0x00, 0xcb, 0xa5, 0x00, 0x00,
-  0xf1, 0xa5, 0x00, 0x00, 0x18, 0xa6, 0x00, 0x00, 0x3e, 0xa6, 0x00, 0x00,
-  0x64, 0xa6, 0x00, 0x00, 0x8a, 0xa6, 0x00, 0x00, 0xb0, 0xa6, 0x00, 0x00,
-  0xd7, 0xa6, 0x00, 0x00, 0xfd, 0xa6, 0x00, 0x00, 0x23, 0xa7, 0x00, 0x00,
-  0x49, 0xa7, 0x00, 0x00, 0x6f, 0xa7, 0x00, 0x00, 0x95, 0xa7, 0x00, 0x00,
-  0xbb, 0xa7, 0x00, 0x00, 0xe1, 0xa7, 0x00, 0x00, 0x07, 0xa8, 0x00, 0x00,
-  0x2d, 0xa8, 0x00, 0x00, 0x53, 0xa8, 0x00, 0x00, 0x78, 0xa8, 0x00, 0x00,
-  0x9e, 0xa8, 0x00, 0x00, 0xc4, 0xa8, 0x00, 0x00, 0xea, 0xa8, 0x00, 0x00,
-  0x10, 0xa9, 0x00, 0x00, 0x35, 0xa9, 0x00, 0x00, 0x5b, 0xa9, 0x00, 0x00,
-  0x81, 0xa9, 0x00, 0x00, 0xa6, 0xa9, 0x00, 0x00, 0xcc, 0xa9, 0x00, 0x00,
-  0xf2, 0xa9, 0x00, 0x00, 0x17, 0xaa, 0x00, 0x00, 0x3d, 0xaa, 0x00, 0x00,
-  0x62, 0xaa, 0x00, 0x00, 0x88, 0xaa, 0x00, 0x00, 0xad, 0xaa, 0x00, 0x00,
-  0xd3, 0xaa, 0x00, 0x00, 0xf8, 0xaa, 0x00, 0x00, 0x1e, 0xab, 0x00, 0x00,
-  0x43, 0xab, 0x00, 0x00, 0x68, 0xab, 0x00, 0x00, 0x8e, 0xab, 0x00, 0x00,
-  0xb3, 0xab, 0x00, 0x00, 0xd8, 0xab, 0x00, 0x00, 0xfd, 0xab, 0x00, 0x00,
-  0x23, 0xac, 0x00, 0x00, 0x48, 0xac, 0x00, 0x00, 0x6d, 0xac, 0x00, 0x00,
-  0x92, 0xac, 0x00, 0x00, 0xb7, 0xac, 0x00, 0x00, 0xdc, 0xac, 0x00, 0x00,
-  0x01, 0xad, 0x00, 0x00, 0x26, 0xad, 0x00, 0x00, 0x4b, 0xad, 0x00, 0x00,
-  0x70, 0xad, 0x00, 0x00, 0x95, 0xad, 0x00, 0x00, 0xba, 0xad, 0x00, 0x00,
-  0xdf, 0xad, 0x00, 0x00, 0x04, 0xae, 0x00, 0x00, 0x29, 0xae, 0x00, 0x00,
-  0x4e, 0xae, 0x00, 0x00, 0x73, 0xae, 0x00, 0x00, 0x97, 0xae, 0x00, 0x00,
-  0xbc, 0xae, 0x00, 0x00, 0xe1, 0xae, 0x00, 0x00, 0x06, 0xaf, 0x00, 0x00,
-  0x2a, 0xaf, 0x00, 0x00, 0x4f, 0xaf, 0x00, 0x00, 0x73, 0xaf, 0x00, 0x00,
-  0x98, 0xaf, 0x00, 0x00, 0xbd, 0xaf, 0x00, 0x00, 0xe1, 0xaf, 0x00, 0x00,
-  0x06, 0xb0, 0x00, 0x00, 0x2a, 0xb0, 0x00, 0x00, 0x4f, 0xb0, 0x00, 0x00,
-  0x73, 0xb0, 0x00, 0x00, 0x97, 0xb0, 0x00, 0x00, 0xbc, 0xb0, 0x00, 0x00,
-  0xe0, 0xb0, 0x00, 0x00, 0x04, 0xb1, 0x00, 0x00, 0x29, 0xb1, 0x00, 0x00,
-  0x4d, 0xb1, 0x00, 0x00, 0x71, 0xb1, 0x00, 0x00, 0x96, 0xb1, 0x00, 0x00,
-  0xba, 0xb1, 0x00, 0x00, 0xde, 0xb1, 0x00, 0x00, 0x02, 0xb2, 0x00, 0x00,
-  0x26, 0xb2, 0x00, 0x00, 0x4a, 0xb2, 0x00, 0x00, 0x6e, 0xb2, 0x00, 0x00,
-  0x92, 0xb2, 0x00, 0x00, 0xb6, 0xb2, 0x00, 0x00, 0xda, 0xb2, 0x00, 0x00,
-  0xfe, 0xb2, 0x00, 0x00, 0x22, 0xb3, 0x00, 0x00, 0x46, 0xb3, 0x00, 0x00,
-  0x6a, 0xb3, 0x00, 0x00, 0x8e, 0xb3, 0x00, 0x00, 0xb2, 0xb3, 0x00, 0x00,
-  0xd5, 0xb3, 0x00, 0x00, 0xf9, 0xb3, 0x00, 0x00, 0x1d, 0xb4, 0x00, 0x00,
-  0x41, 0xb4, 0x00, 0x00, 0x64, 0xb4, 0x00, 0x00, 0x88, 0xb4, 0x00, 0x00,
-  0xac, 0xb4, 0x00, 0x00, 0xcf, 0xb4, 0x00, 0x00, 0xf3, 0xb4, 0x00, 0x00,
-  0x16, 0xb5, 0x00, 0x00, 0x3a, 0xb5, 0x00, 0x00, 0x5d, 0xb5, 0x00, 0x00,
-  0x81, 0xb5, 0x00, 0x00, 0xa4, 0xb5, 0x00, 0x00, 0xc8, 0xb5, 0x00, 0x00,
-  0xeb, 0xb5, 0x00, 0x00, 0x0e, 0xb6, 0x00, 0x00, 0x32, 0xb6, 0x00, 0x00,
-  0x55, 0xb6, 0x00, 0x00, 0x78, 0xb6, 0x00, 0x00, 0x9b, 0xb6, 0x00, 0x00,
-  0xbf, 0xb6, 0x00, 0x00, 0xe2, 0xb6, 0x00, 0x00, 0x05, 0xb7, 0x00, 0x00,
-  0x28, 0xb7, 0x00, 0x00, 0x4b, 0xb7, 0x00, 0x00, 0x6e, 0xb7, 0x00, 0x00,
-  0x91, 0xb7, 0x00, 0x00, 0xb4, 0xb7, 0x00, 0x00, 0xd7, 0xb7, 0x00, 0x00,
-  0xfa, 0xb7, 0x00, 0x00, 0x1d, 0xb8, 0x00, 0x00, 0x40, 0xb8, 0x00, 0x00,
-  0x63, 0xb8, 0x00, 0x00, 0x86, 0xb8, 0x00, 0x00, 0xa9, 0xb8, 0x00, 0x00,
-  0xcc, 0xb8, 0x00, 0x00, 0xee, 0xb8, 0x00, 0x00, 0x11, 0xb9, 0x00, 0x00,
-  0x34, 0xb9, 0x00, 0x00, 0x56, 0xb9, 0x00, 0x00, 0x79, 0xb9, 0x00, 0x00,
-  0x9c, 0xb9, 0x00, 0x00, 0xbe, 0xb9, 0x00, 0x00, 0xe1, 0xb9, 0x00, 0x00,
-  0x03, 0xba, 0x00, 0x00, 0x26, 0xba, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00,
-  0x6b, 0xba, 0x00, 0x00, 0x8d, 0xba, 0x00, 0x00, 0xb0, 0xba, 0x00, 0x00,
-  0xd2, 0xba, 0x00, 0x00, 0xf5, 0xba, 0x00, 0x00, 0x17, 0xbb, 0x00, 0x00,
-  0x39, 0xbb, 0x00, 0x00, 0x5b, 0xbb, 0x00, 0x00, 0x7e, 0xbb, 0x00, 0x00,
-  0xa0, 0xbb, 0x00, 0x00, 0xc2, 0xbb, 0x00, 0x00, 0xe4, 0xbb, 0x00, 0x00,
-  0x06, 0xbc, 0x00, 0x00, 0x28, 0xbc, 0x00, 0x00, 0x4a, 0xbc, 0x00, 0x00,
-  0x6d, 0xbc, 0x00, 0x00, 0x8f, 0xbc, 0x00, 0x00, 0xb1, 0xbc, 0x00, 0x00,
-  0xd2, 0xbc, 0x00, 0x00, 0xf4, 0xbc, 0x00, 0x00, 0x16, 0xbd, 0x00, 0x00,
-  0x38, 0xbd, 0x00, 0x00, 0x5a, 0xbd, 0x00, 0x00, 0x7c, 0xbd, 0x00, 0x00,
-  0x9e, 0xbd, 0x00, 0x00, 0xbf, 0xbd, 0x00, 0x00, 0xe1, 0xbd, 0x00, 0x00,
-  0x03, 0xbe, 0x00, 0x00, 0x24, 0xbe, 0x00, 0x00, 0x46, 0xbe, 0x00, 0x00,
-  0x68, 0xbe, 0x00, 0x00, 0x89, 0xbe, 0x00, 0x00, 0xab, 0xbe, 0x00, 0x00,
-  0xcc, 0xbe, 0x00, 0x00, 0xee, 0xbe, 0x00, 0x00, 0x0f, 0xbf, 0x00, 0x00,
-  0x31, 0xbf, 0x00, 0x00, 0x52, 0xbf, 0x00, 0x00, 0x74, 0xbf, 0x00, 0x00,
-  0x95, 0xbf, 0x00, 0x00, 0xb6, 0xbf, 0x00, 0x00, 0xd8, 0xbf, 0x00, 0x00,
-  0xf9, 0xbf, 0x00, 0x00, 0x1a, 0xc0, 0x00, 0x00, 0x3b, 0xc0, 0x00, 0x00,
-  0x5c, 0xc0, 0x00, 0x00, 0x7e, 0xc0, 0x00, 0x00, 0x9f, 0xc0, 0x00, 0x00,
-  0xc0, 0xc0, 0x00, 0x00, 0xe1, 0xc0, 0x00, 0x00, 0x02, 0xc1, 0x00, 0x00,
-  0x23, 0xc1, 0x00, 0x00, 0x44, 0xc1, 0x00, 0x00, 0x65, 0xc1, 0x00, 0x00,
-  0x86, 0xc1, 0x00, 0x00, 0xa7, 0xc1, 0x00, 0x00, 0xc8, 0xc1, 0x00, 0x00,
-  0xe8, 0xc1, 0x00, 0x00, 0x09, 0xc2, 0x00, 0x00, 0x2a, 0xc2, 0x00, 0x00,
-  0x4b, 0xc2, 0x00, 0x00, 0x6b, 0xc2, 0x00, 0x00, 0x8c, 0xc2, 0x00, 0x00,
-  0xad, 0xc2, 0x00, 0x00, 0xcd, 0xc2, 0x00, 0x00, 0xee, 0xc2, 0x00, 0x00,
-  0x0f, 0xc3, 0x00, 0x00, 0x2f, 0xc3, 0x00, 0x00, 0x50, 0xc3, 0x00, 0x00,
-  0x70, 0xc3, 0x00, 0x00, 0x90, 0xc3, 0x00, 0x00, 0xb1, 0xc3, 0x00, 0x00,
-  0xd1, 0xc3, 0x00, 0x00, 0xf2, 0xc3, 0x00, 0x00, 0x12, 0xc4, 0x00, 0x00,
-  0x32, 0xc4, 0x00, 0x00, 0x53, 0xc4, 0x00, 0x00, 0x73, 0xc4, 0x00, 0x00,
-  0x93, 0xc4, 0x00, 0x00, 0xb3, 0xc4, 0x00, 0x00, 0xd3, 0xc4, 0x00, 0x00,
-  0xf4, 0xc4, 0x00, 0x00, 0x14, 0xc5, 0x00, 0x00, 0x34, 0xc5, 0x00, 0x00,
-  0x54, 0xc5, 0x00, 0x00, 0x74, 0xc5, 0x00, 0x00, 0x94, 0xc5, 0x00, 0x00,
-  0xb4, 0xc5, 0x00, 0x00, 0xd4, 0xc5, 0x00, 0x00, 0xf3, 0xc5, 0x00, 0x00,
-  0x13, 0xc6, 0x00, 0x00, 0x33, 0xc6, 0x00, 0x00, 0x53, 0xc6, 0x00, 0x00,
-  0x73, 0xc6, 0x00, 0x00, 0x92, 0xc6, 0x00, 0x00, 0xb2, 0xc6, 0x00, 0x00,
-  0xd2, 0xc6, 0x00, 0x00, 0xf1, 0xc6, 0x00, 0x00, 0x11, 0xc7, 0x00, 0x00,
-  0x31, 0xc7, 0x00, 0x00, 0x50, 0xc7, 0x00, 0x00, 0x70, 0xc7, 0x00, 0x00,
-  0x8f, 0xc7, 0x00, 0x00, 0xaf, 0xc7, 0x00, 0x00, 0xce, 0xc7, 0x00, 0x00,
-  0xee, 0xc7, 0x00, 0x00, 0x0d, 0xc8, 0x00, 0x00, 0x2c, 0xc8, 0x00, 0x00,
-  0x4c, 0xc8, 0x00, 0x00, 0x6b, 0xc8, 0x00, 0x00, 0x8a, 0xc8, 0x00, 0x00,
-  0xa9, 0xc8, 0x00, 0x00, 0xc9, 0xc8, 0x00, 0x00, 0xe8, 0xc8, 0x00, 0x00,
-  0x07, 0xc9, 0x00, 0x00, 0x26, 0xc9, 0x00, 0x00, 0x45, 0xc9, 0x00, 0x00,
-  0x64, 0xc9, 0x00, 0x00, 0x83, 0xc9, 0x00, 0x00, 0xa2, 0xc9, 0x00, 0x00,
-  0xc1, 0xc9, 0x00, 0x00, 0xe0, 0xc9, 0x00, 0x00, 0xff, 0xc9, 0x00, 0x00,
-  0x1e, 0xca, 0x00, 0x00, 0x3d, 0xca, 0x00, 0x00, 0x5b, 0xca, 0x00, 0x00,
-  0x7a, 0xca, 0x00, 0x00, 0x99, 0xca, 0x00, 0x00, 0xb8, 0xca, 0x00, 0x00,
-  0xd6, 0xca, 0x00, 0x00, 0xf5, 0xca, 0x00, 0x00, 0x14, 0xcb, 0x00, 0x00,
-  0x32, 0xcb, 0x00, 0x00, 0x51, 0xcb, 0x00, 0x00, 0x6f, 0xcb, 0x00, 0x00,
-  0x8e, 0xcb, 0x00, 0x00, 0xac, 0xcb, 0x00, 0x00, 0xcb, 0xcb, 0x00, 0x00,
-  0xe9, 0xcb, 0x00, 0x00, 0x07, 0xcc, 0x00, 0x00, 0x26, 0xcc, 0x00, 0x00,
-  0x44, 0xcc, 0x00, 0x00, 0x62, 0xcc, 0x00, 0x00, 0x81, 0xcc, 0x00, 0x00,
-  0x9f, 0xcc, 0x00, 0x00, 0xbd, 0xcc, 0x00, 0x00, 0xdb, 0xcc, 0x00, 0x00,
-  0xf9, 0xcc, 0x00, 0x00, 0x17, 0xcd, 0x00, 0x00, 0x36, 0xcd, 0x00, 0x00,
-  0x54, 0xcd, 0x00, 0x00, 0x72, 0xcd, 0x00, 0x00, 0x90, 0xcd, 0x00, 0x00,
-  0xad, 0xcd, 0x00, 0x00, 0xcb, 0xcd, 0x00, 0x00, 0xe9, 0xcd, 0x00, 0x00,
-  0x07, 0xce, 0x00, 0x00, 0x25, 0xce, 0x00, 0x00, 0x43, 0xce, 0x00, 0x00,
-  0x60, 0xce, 0x00, 0x00, 0x7e, 0xce, 0x00, 0x00, 0x9c, 0xce, 0x00, 0x00,
-  0xba, 0xce, 0x00, 0x00, 0xd7, 0xce, 0x00, 0x00, 0xf5, 0xce, 0x00, 0x00,
-  0x12, 0xcf, 0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x4d, 0xcf, 0x00, 0x00,
-  0x6b, 0xcf, 0x00, 0x00, 0x88, 0xcf, 0x00, 0x00, 0xa6, 0xcf, 0x00, 0x00,
-  0xc3, 0xcf, 0x00, 0x00, 0xe0, 0xcf, 0x00, 0x00, 0xfe, 0xcf, 0x00, 0x00,
-  0x1b, 0xd0, 0x00, 0x00, 0x38, 0xd0, 0x00, 0x00, 0x56, 0xd0, 0x00, 0x00,
-  0x73, 0xd0, 0x00, 0x00, 0x90, 0xd0, 0x00, 0x00, 0xad, 0xd0, 0x00, 0x00,
-  0xca, 0xd0, 0x00, 0x00, 0xe7, 0xd0, 0x00, 0x00, 0x04, 0xd1, 0x00, 0x00,
-  0x21, 0xd1, 0x00, 0x00, 0x3e, 0xd1, 0x00, 0x00, 0x5b, 0xd1, 0x00, 0x00,
-  0x78, 0xd1, 0x00, 0x00, 0x95, 0xd1, 0x00, 0x00, 0xb2, 0xd1, 0x00, 0x00,
-  0xcf, 0xd1, 0x00, 0x00, 0xeb, 0xd1, 0x00, 0x00, 0x08, 0xd2, 0x00, 0x00,
-  0x25, 0xd2, 0x00, 0x00, 0x42, 0xd2, 0x00, 0x00, 0x5e, 0xd2, 0x00, 0x00,
-  0x7b, 0xd2, 0x00, 0x00, 0x98, 0xd2, 0x00, 0x00, 0xb4, 0xd2, 0x00, 0x00,
-  0xd1, 0xd2, 0x00, 0x00, 0xed, 0xd2, 0x00, 0x00, 0x0a, 0xd3, 0x00, 0x00,
-  0x26, 0xd3, 0x00, 0x00, 0x42, 0xd3, 0x00, 0x00, 0x5f, 0xd3, 0x00, 0x00,
-  0x7b, 0xd3, 0x00, 0x00, 0x97, 0xd3, 0x00, 0x00, 0xb4, 0xd3, 0x00, 0x00,
-  0xd0, 0xd3, 0x00, 0x00, 0xec, 0xd3, 0x00, 0x00, 0x08, 0xd4, 0x00, 0x00,
-  0x25, 0xd4, 0x00, 0x00, 0x41, 0xd4, 0x00, 0x00, 0x5d, 0xd4, 0x00, 0x00,
-  0x79, 0xd4, 0x00, 0x00, 0x95, 0xd4, 0x00, 0x00, 0xb1, 0xd4, 0x00, 0x00,
-  0xcd, 0xd4, 0x00, 0x00, 0xe9, 0xd4, 0x00, 0x00, 0x05, 0xd5, 0x00, 0x00,
-  0x20, 0xd5, 0x00, 0x00, 0x3c, 0xd5, 0x00, 0x00, 0x58, 0xd5, 0x00, 0x00,
-  0x74, 0xd5, 0x00, 0x00, 0x90, 0xd5, 0x00, 0x00, 0xab, 0xd5, 0x00, 0x00,
-  0xc7, 0xd5, 0x00, 0x00, 0xe3, 0xd5, 0x00, 0x00, 0xfe, 0xd5, 0x00, 0x00,
-  0x1a, 0xd6, 0x00, 0x00, 0x35, 0xd6, 0x00, 0x00, 0x51, 0xd6, 0x00, 0x00,
-  0x6c, 0xd6, 0x00, 0x00, 0x88, 0xd6, 0x00, 0x00, 0xa3, 0xd6, 0x00, 0x00,
-  0xbe, 0xd6, 0x00, 0x00, 0xda, 0xd6, 0x00, 0x00, 0xf5, 0xd6, 0x00, 0x00,
-  0x10, 0xd7, 0x00, 0x00, 0x2c, 0xd7, 0x00, 0x00, 0x47, 0xd7, 0x00, 0x00,
-  0x62, 0xd7, 0x00, 0x00, 0x7d, 0xd7, 0x00, 0x00, 0x98, 0xd7, 0x00, 0x00,
-  0xb3, 0xd7, 0x00, 0x00, 0xce, 0xd7, 0x00, 0x00, 0xea, 0xd7, 0x00, 0x00,
-  0x04, 0xd8, 0x00, 0x00, 0x1f, 0xd8, 0x00, 0x00, 0x3a, 0xd8, 0x00, 0x00,
-  0x55, 0xd8, 0x00, 0x00, 0x70, 0xd8, 0x00, 0x00, 0x8b, 0xd8, 0x00, 0x00,
-  0xa6, 0xd8, 0x00, 0x00, 0xc1, 0xd8, 0x00, 0x00, 0xdb, 0xd8, 0x00, 0x00,
-  0xf6, 0xd8, 0x00, 0x00, 0x11, 0xd9, 0x00, 0x00, 0x2b, 0xd9, 0x00, 0x00,
-  0x46, 0xd9, 0x00, 0x00, 0x60, 0xd9, 0x00, 0x00, 0x7b, 0xd9, 0x00, 0x00,
-  0x95, 0xd9, 0x00, 0x00, 0xb0, 0xd9, 0x00, 0x00, 0xca, 0xd9, 0x00, 0x00,
-  0xe5, 0xd9, 0x00, 0x00, 0xff, 0xd9, 0x00, 0x00, 0x19, 0xda, 0x00, 0x00,
-  0x34, 0xda, 0x00, 0x00, 0x4e, 0xda, 0x00, 0x00, 0x68, 0xda, 0x00, 0x00,
-  0x82, 0xda, 0x00, 0x00, 0x9d, 0xda, 0x00, 0x00, 0xb7, 0xda, 0x00, 0x00,
-  0xd1, 0xda, 0x00, 0x00, 0xeb, 0xda, 0x00, 0x00, 0x05, 0xdb, 0x00, 0x00,
-  0x1f, 0xdb, 0x00, 0x00, 0x39, 0xdb, 0x00, 0x00, 0x53, 0xdb, 0x00, 0x00,
-  0x6d, 0xdb, 0x00, 0x00, 0x87, 0xdb, 0x00, 0x00, 0xa1, 0xdb, 0x00, 0x00,
-  0xba, 0xdb, 0x00, 0x00, 0xd4, 0xdb, 0x00, 0x00, 0xee, 0xdb, 0x00, 0x00,
-  0x08, 0xdc, 0x00, 0x00, 0x21, 0xdc, 0x00, 0x00, 0x3b, 0xdc, 0x00, 0x00,
-  0x54, 0xdc, 0x00, 0x00, 0x6e, 0xdc, 0x00, 0x00, 0x88, 0xdc, 0x00, 0x00,
-  0xa1, 0xdc, 0x00, 0x00, 0xbb, 0xdc, 0x00, 0x00, 0xd4, 0xdc, 0x00, 0x00,
-  0xed, 0xdc, 0x00, 0x00, 0x07, 0xdd, 0x00, 0x00, 0x20, 0xdd, 0x00, 0x00,
-  0x39, 0xdd, 0x00, 0x00, 0x53, 0xdd, 0x00, 0x00, 0x6c, 0xdd, 0x00, 0x00,
-  0x85, 0xdd, 0x00, 0x00, 0x9e, 0xdd, 0x00, 0x00, 0xb8, 0xdd, 0x00, 0x00,
-  0xd1, 0xdd, 0x00, 0x00, 0xea, 0xdd, 0x00, 0x00, 0x03, 0xde, 0x00, 0x00,
-  0x1c, 0xde, 0x00, 0x00, 0x35, 0xde, 0x00, 0x00, 0x4e, 0xde, 0x00, 0x00,
-  0x67, 0xde, 0x00, 0x00, 0x7f, 0xde, 0x00, 0x00, 0x98, 0xde, 0x00, 0x00,
-  0xb1, 0xde, 0x00, 0x00, 0xca, 0xde, 0x00, 0x00, 0xe3, 0xde, 0x00, 0x00,
-  0xfb, 0xde, 0x00, 0x00, 0x14, 0xdf, 0x00, 0x00, 0x2d, 0xdf, 0x00, 0x00,
-  0x45, 0xdf, 0x00, 0x00, 0x5e, 0xdf, 0x00, 0x00, 0x76, 0xdf, 0x00, 0x00,
-  0x8f, 0xdf, 0x00, 0x00, 0xa7, 0xdf, 0x00, 0x00, 0xc0, 0xdf, 0x00, 0x00,
-  0xd8, 0xdf, 0x00, 0x00, 0xf1, 0xdf, 0x00, 0x00, 0x09, 0xe0, 0x00, 0x00,
-  0x21, 0xe0, 0x00, 0x00, 0x3a, 0xe0, 0x00, 0x00, 0x52, 0xe0, 0x00, 0x00,
-  0x6a, 0xe0, 0x00, 0x00, 0x82, 0xe0, 0x00, 0x00, 0x9a, 0xe0, 0x00, 0x00,
-  0xb2, 0xe0, 0x00, 0x00, 0xca, 0xe0, 0x00, 0x00, 0xe2, 0xe0, 0x00, 0x00,
-  0xfa, 0xe0, 0x00, 0x00, 0x12, 0xe1, 0x00, 0x00, 0x2a, 0xe1, 0x00, 0x00,
-  0x42, 0xe1, 0x00, 0x00, 0x5a, 0xe1, 0x00, 0x00, 0x72, 0xe1, 0x00, 0x00,
-  0x8a, 0xe1, 0x00, 0x00, 0xa2, 0xe1, 0x00, 0x00, 0xb9, 0xe1, 0x00, 0x00,
-  0xd1, 0xe1, 0x00, 0x00, 0xe9, 0xe1, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00,
-  0x18, 0xe2, 0x00, 0x00, 0x2f, 0xe2, 0x00, 0x00, 0x47, 0xe2, 0x00, 0x00,
-  0x5e, 0xe2, 0x00, 0x00, 0x76, 0xe2, 0x00, 0x00, 0x8d, 0xe2, 0x00, 0x00,
-  0xa5, 0xe2, 0x00, 0x00, 0xbc, 0xe2, 0x00, 0x00, 0xd3, 0xe2, 0x00, 0x00,
-  0xeb, 0xe2, 0x00, 0x00, 0x02, 0xe3, 0x00, 0x00, 0x19, 0xe3, 0x00, 0x00,
-  0x30, 0xe3, 0x00, 0x00, 0x47, 0xe3, 0x00, 0x00, 0x5f, 0xe3, 0x00, 0x00,
-  0x76, 0xe3, 0x00, 0x00, 0x8d, 0xe3, 0x00, 0x00, 0xa4, 0xe3, 0x00, 0x00,
-  0xbb, 0xe3, 0x00, 0x00, 0xd2, 0xe3, 0x00, 0x00, 0xe9, 0xe3, 0x00, 0x00,
-  0xff, 0xe3, 0x00, 0x00, 0x16, 0xe4, 0x00, 0x00, 0x2d, 0xe4, 0x00, 0x00,
-  0x44, 0xe4, 0x00, 0x00, 0x5b, 0xe4, 0x00, 0x00, 0x71, 0xe4, 0x00, 0x00,
-  0x88, 0xe4, 0x00, 0x00, 0x9f, 0xe4, 0x00, 0x00, 0xb5, 0xe4, 0x00, 0x00,
-  0xcc, 0xe4, 0x00, 0x00, 0xe2, 0xe4, 0x00, 0x00, 0xf9, 0xe4, 0x00, 0x00,
-  0x0f, 0xe5, 0x00, 0x00, 0x26, 0xe5, 0x00, 0x00, 0x3c, 0xe5, 0x00, 0x00,
-  0x52, 0xe5, 0x00, 0x00, 0x69, 0xe5, 0x00, 0x00, 0x7f, 0xe5, 0x00, 0x00,
-  0x95, 0xe5, 0x00, 0x00, 0xab, 0xe5, 0x00, 0x00, 0xc2, 0xe5, 0x00, 0x00,
-  0xd8, 0xe5, 0x00, 0x00, 0xee, 0xe5, 0x00, 0x00, 0x04, 0xe6, 0x00, 0x00,
-  0x1a, 0xe6, 0x00, 0x00, 0x30, 0xe6, 0x00, 0x00, 0x46, 0xe6, 0x00, 0x00,
-  0x5c, 0xe6, 0x00, 0x00, 0x72, 0xe6, 0x00, 0x00, 0x88, 0xe6, 0x00, 0x00,
-  0x9e, 0xe6, 0x00, 0x00, 0xb3, 0xe6, 0x00, 0x00, 0xc9, 0xe6, 0x00, 0x00,
-  0xdf, 0xe6, 0x00, 0x00, 0xf5, 0xe6, 0x00, 0x00, 0x0a, 0xe7, 0x00, 0x00,
-  0x20, 0xe7, 0x00, 0x00, 0x36, 0xe7, 0x00, 0x00, 0x4b, 0xe7, 0x00, 0x00,
-  0x61, 0xe7, 0x00, 0x00, 0x76, 0xe7, 0x00, 0x00, 0x8c, 0xe7, 0x00, 0x00,
-  0xa1, 0xe7, 0x00, 0x00, 0xb6, 0xe7, 0x00, 0x00, 0xcc, 0xe7, 0x00, 0x00,
-  0xe1, 0xe7, 0x00, 0x00, 0xf6, 0xe7, 0x00, 0x00, 0x0c, 0xe8, 0x00, 0x00,
-  0x21, 0xe8, 0x00, 0x00, 0x36, 0xe8, 0x00, 0x00, 0x4b, 0xe8, 0x00, 0x00,
-  0x60, 0xe8, 0x00, 0x00, 0x75, 0xe8, 0x00, 0x00, 0x8a, 0xe8, 0x00, 0x00,
-  0x9f, 0xe8, 0x00, 0x00, 0xb4, 0xe8, 0x00, 0x00, 0xc9, 0xe8, 0x00, 0x00,
-  0xde, 0xe8, 0x00, 0x00, 0xf3, 0xe8, 0x00, 0x00, 0x08, 0xe9, 0x00, 0x00,
-  0x1d, 0xe9, 0x00, 0x00, 0x31, 0xe9, 0x00, 0x00, 0x46, 0xe9, 0x00, 0x00,
-  0x5b, 0xe9, 0x00, 0x00, 0x6f, 0xe9, 0x00, 0x00, 0x84, 0xe9, 0x00, 0x00,
-  0x99, 0xe9, 0x00, 0x00, 0xad, 0xe9, 0x00, 0x00, 0xc2, 0xe9, 0x00, 0x00,
-  0xd6, 0xe9, 0x00, 0x00, 0xeb, 0xe9, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00,
-  0x13, 0xea, 0x00, 0x00, 0x28, 0xea, 0x00, 0x00, 0x3c, 0xea, 0x00, 0x00,
-  0x50, 0xea, 0x00, 0x00, 0x64, 0xea, 0x00, 0x00, 0x79, 0xea, 0x00, 0x00,
-  0x8d, 0xea, 0x00, 0x00, 0xa1, 0xea, 0x00, 0x00, 0xb5, 0xea, 0x00, 0x00,
-  0xc9, 0xea, 0x00, 0x00, 0xdd, 0xea, 0x00, 0x00, 0xf1, 0xea, 0x00, 0x00,
-  0x05, 0xeb, 0x00, 0x00, 0x19, 0xeb, 0x00, 0x00, 0x2d, 0xeb, 0x00, 0x00,
-  0x41, 0xeb, 0x00, 0x00, 0x54, 0xeb, 0x00, 0x00, 0x68, 0xeb, 0x00, 0x00,
-  0x7c, 0xeb, 0x00, 0x00, 0x90, 0xeb, 0x00, 0x00, 0xa3, 0xeb, 0x00, 0x00,
-  0xb7, 0xeb, 0x00, 0x00, 0xcb, 0xeb, 0x00, 0x00, 0xde, 0xeb, 0x00, 0x00,
-  0xf2, 0xeb, 0x00, 0x00, 0x05, 0xec, 0x00, 0x00, 0x19, 0xec, 0x00, 0x00,
-  0x2c, 0xec, 0x00, 0x00, 0x3f, 0xec, 0x00, 0x00, 0x53, 0xec, 0x00, 0x00,
-  0x66, 0xec, 0x00, 0x00, 0x79, 0xec, 0x00, 0x00, 0x8c, 0xec, 0x00, 0x00,
-  0xa0, 0xec, 0x00, 0x00, 0xb3, 0xec, 0x00, 0x00, 0xc6, 0xec, 0x00, 0x00,
-  0xd9, 0xec, 0x00, 0x00, 0xec, 0xec, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00,
-  0x12, 0xed, 0x00, 0x00, 0x25, 0xed, 0x00, 0x00, 0x38, 0xed, 0x00, 0x00,
-  0x4b, 0xed, 0x00, 0x00, 0x5e, 0xed, 0x00, 0x00, 0x71, 0xed, 0x00, 0x00,
-  0x83, 0xed, 0x00, 0x00, 0x96, 0xed, 0x00, 0x00, 0xa9, 0xed, 0x00, 0x00,
-  0xbb, 0xed, 0x00, 0x00, 0xce, 0xed, 0x00, 0x00, 0xe1, 0xed, 0x00, 0x00,
-  0xf3, 0xed, 0x00, 0x00, 0x06, 0xee, 0x00, 0x00, 0x18, 0xee, 0x00, 0x00,
-  0x2b, 0xee, 0x00, 0x00, 0x3d, 0xee, 0x00, 0x00, 0x4f, 0xee, 0x00, 0x00,
-  0x62, 0xee, 0x00, 0x00, 0x74, 0xee, 0x00, 0x00, 0x86, 0xee, 0x00, 0x00,
-  0x99, 0xee, 0x00, 0x00, 0xab, 0xee, 0x00, 0x00, 0xbd, 0xee, 0x00, 0x00,
-  0xcf, 0xee, 0x00, 0x00, 0xe1, 0xee, 0x00, 0x00, 0xf3, 0xee, 0x00, 0x00,
-  0x05, 0xef, 0x00, 0x00, 0x17, 0xef, 0x00, 0x00, 0x29, 0xef, 0x00, 0x00,
-  0x3b, 0xef, 0x00, 0x00, 0x4d, 0xef, 0x00, 0x00, 0x5f, 0xef, 0x00, 0x00,
-  0x71, 0xef, 0x00, 0x00, 0x82, 0xef, 0x00, 0x00, 0x94, 0xef, 0x00, 0x00,
-  0xa6, 0xef, 0x00, 0x00, 0xb7, 0xef, 0x00, 0x00, 0xc9, 0xef, 0x00, 0x00,
-  0xdb, 0xef, 0x00, 0x00, 0xec, 0xef, 0x00, 0x00, 0xfe, 0xef, 0x00, 0x00,
-  0x0f, 0xf0, 0x00, 0x00, 0x21, 0xf0, 0x00, 0x00, 0x32, 0xf0, 0x00, 0x00,
-  0x43, 0xf0, 0x00, 0x00, 0x55, 0xf0, 0x00, 0x00, 0x66, 0xf0, 0x00, 0x00,
-  0x77, 0xf0, 0x00, 0x00, 0x89, 0xf0, 0x00, 0x00, 0x9a, 0xf0, 0x00, 0x00,
-  0xab, 0xf0, 0x00, 0x00, 0xbc, 0xf0, 0x00, 0x00, 0xcd, 0xf0, 0x00, 0x00,
-  0xde, 0xf0, 0x00, 0x00, 0xef, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00,
-  0x11, 0xf1, 0x00, 0x00, 0x22, 0xf1, 0x00, 0x00, 0x33, 0xf1, 0x00, 0x00,
-  0x44, 0xf1, 0x00, 0x00, 0x54, 0xf1, 0x00, 0x00, 0x65, 0xf1, 0x00, 0x00,
-  0x76, 0xf1, 0x00, 0x00, 0x87, 0xf1, 0x00, 0x00, 0x97, 0xf1, 0x00, 0x00,
-  0xa8, 0xf1, 0x00, 0x00, 0xb8, 0xf1, 0x00, 0x00, 0xc9, 0xf1, 0x00, 0x00,
-  0xd9, 0xf1, 0x00, 0x00, 0xea, 0xf1, 0x00, 0x00, 0xfa, 0xf1, 0x00, 0x00,
-  0x0b, 0xf2, 0x00, 0x00, 0x1b, 0xf2, 0x00, 0x00, 0x2b, 0xf2, 0x00, 0x00,
-  0x3c, 0xf2, 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00, 0x5c, 0xf2, 0x00, 0x00,
-  0x6c, 0xf2, 0x00, 0x00, 0x7c, 0xf2, 0x00, 0x00, 0x8c, 0xf2, 0x00, 0x00,
-  0x9c, 0xf2, 0x00, 0x00, 0xad, 0xf2, 0x00, 0x00, 0xbd, 0xf2, 0x00, 0x00,
-  0xcc, 0xf2, 0x00, 0x00, 0xdc, 0xf2, 0x00, 0x00, 0xec, 0xf2, 0x00, 0x00,
-  0xfc, 0xf2, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0x1c, 0xf3, 0x00, 0x00,
-  0x2b, 0xf3, 0x00, 0x00, 0x3b, 0xf3, 0x00, 0x00, 0x4b, 0xf3, 0x00, 0x00,
-  0x5a, 0xf3, 0x00, 0x00, 0x6a, 0xf3, 0x00, 0x00, 0x79, 0xf3, 0x00, 0x00,
-  0x89, 0xf3, 0x00, 0x00, 0x98, 0xf3, 0x00, 0x00, 0xa8, 0xf3, 0x00, 0x00,
-  0xb7, 0xf3, 0x00, 0x00, 0xc7, 0xf3, 0x00, 0x00, 0xd6, 0xf3, 0x00, 0x00,
-  0xe5, 0xf3, 0x00, 0x00, 0xf5, 0xf3, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00,
-  0x13, 0xf4, 0x00, 0x00, 0x22, 0xf4, 0x00, 0x00, 0x31, 0xf4, 0x00, 0x00,
-  0x40, 0xf4, 0x00, 0x00, 0x4f, 0xf4, 0x00, 0x00, 0x5e, 0xf4, 0x00, 0x00,
-  0x6d, 0xf4, 0x00, 0x00, 0x7c, 0xf4, 0x00, 0x00, 0x8b, 0xf4, 0x00, 0x00,
-  0x9a, 0xf4, 0x00, 0x00, 0xa9, 0xf4, 0x00, 0x00, 0xb8, 0xf4, 0x00, 0x00,
-  0xc6, 0xf4, 0x00, 0x00, 0xd5, 0xf4, 0x00, 0x00, 0xe4, 0xf4, 0x00, 0x00,
-  0xf2, 0xf4, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x0f, 0xf5, 0x00, 0x00,
-  0x1e, 0xf5, 0x00, 0x00, 0x2c, 0xf5, 0x00, 0x00, 0x3b, 0xf5, 0x00, 0x00,
-  0x49, 0xf5, 0x00, 0x00, 0x58, 0xf5, 0x00, 0x00, 0x66, 0xf5, 0x00, 0x00,
-  0x74, 0xf5, 0x00, 0x00, 0x82, 0xf5, 0x00, 0x00, 0x91, 0xf5, 0x00, 0x00,
-  0x9f, 0xf5, 0x00, 0x00, 0xad, 0xf5, 0x00, 0x00, 0xbb, 0xf5, 0x00, 0x00,
-  0xc9, 0xf5, 0x00, 0x00, 0xd7, 0xf5, 0x00, 0x00, 0xe5, 0xf5, 0x00, 0x00,
-  0xf3, 0xf5, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x0f, 0xf6, 0x00, 0x00,
-  0x1d, 0xf6, 0x00, 0x00, 0x2b, 0xf6, 0x00, 0x00, 0x38, 0xf6, 0x00, 0x00,
-  0x46, 0xf6, 0x00, 0x00, 0x54, 0xf6, 0x00, 0x00, 0x62, 0xf6, 0x00, 0x00,
-  0x6f, 0xf6, 0x00, 0x00, 0x7d, 0xf6, 0x00, 0x00, 0x8a, 0xf6, 0x00, 0x00,
-  0x98, 0xf6, 0x00, 0x00, 0xa5, 0xf6, 0x00, 0x00, 0xb3, 0xf6, 0x00, 0x00,
-  0xc0, 0xf6, 0x00, 0x00, 0xce, 0xf6, 0x00, 0x00, 0xdb, 0xf6, 0x00, 0x00,
-  0xe8, 0xf6, 0x00, 0x00, 0xf5, 0xf6, 0x00, 0x00, 0x03, 0xf7, 0x00, 0x00,
-  0x10, 0xf7, 0x00, 0x00, 0x1d, 0xf7, 0x00, 0x00, 0x2a, 0xf7, 0x00, 0x00,
-  0x37, 0xf7, 0x00, 0x00, 0x44, 0xf7, 0x00, 0x00, 0x51, 0xf7, 0x00, 0x00,
-  0x5e, 0xf7, 0x00, 0x00, 0x6b, 0xf7, 0x00, 0x00, 0x78, 0xf7, 0x00, 0x00,
-  0x85, 0xf7, 0x00, 0x00, 0x92, 0xf7, 0x00, 0x00, 0x9e, 0xf7, 0x00, 0x00,
-  0xab, 0xf7, 0x00, 0x00, 0xb8, 0xf7, 0x00, 0x00, 0xc5, 0xf7, 0x00, 0x00,
-  0xd1, 0xf7, 0x00, 0x00, 0xde, 0xf7, 0x00, 0x00, 0xea, 0xf7, 0x00, 0x00,
-  0xf7, 0xf7, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x10, 0xf8, 0x00, 0x00,
-  0x1c, 0xf8, 0x00, 0x00, 0x28, 0xf8, 0x00, 0x00, 0x35, 0xf8, 0x00, 0x00,
-  0x41, 0xf8, 0x00, 0x00, 0x4d, 0xf8, 0x00, 0x00, 0x5a, 0xf8, 0x00, 0x00,
-  0x66, 0xf8, 0x00, 0x00, 0x72, 0xf8, 0x00, 0x00, 0x7e, 0xf8, 0x00, 0x00,
-  0x8a, 0xf8, 0x00, 0x00, 0x96, 0xf8, 0x00, 0x00, 0xa2, 0xf8, 0x00, 0x00,
-  0xae, 0xf8, 0x00, 0x00, 0xba, 0xf8, 0x00, 0x00, 0xc6, 0xf8, 0x00, 0x00,
-  0xd2, 0xf8, 0x00, 0x00, 0xdd, 0xf8, 0x00, 0x00, 0xe9, 0xf8, 0x00, 0x00,
-  0xf5, 0xf8, 0x00, 0x00, 0x01, 0xf9, 0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00,
-  0x18, 0xf9, 0x00, 0x00, 0x23, 0xf9, 0x00, 0x00, 0x2f, 0xf9, 0x00, 0x00,
-  0x3b, 0xf9, 0x00, 0x00, 0x46, 0xf9, 0x00, 0x00, 0x51, 0xf9, 0x00, 0x00,
-  0x5d, 0xf9, 0x00, 0x00, 0x68, 0xf9, 0x00, 0x00, 0x73, 0xf9, 0x00, 0x00,
-  0x7f, 0xf9, 0x00, 0x00, 0x8a, 0xf9, 0x00, 0x00, 0x95, 0xf9, 0x00, 0x00,
-  0xa0, 0xf9, 0x00, 0x00, 0xab, 0xf9, 0x00, 0x00, 0xb7, 0xf9, 0x00, 0x00,
-  0xc2, 0xf9, 0x00, 0x00, 0xcd, 0xf9, 0x00, 0x00, 0xd8, 0xf9, 0x00, 0x00,
-  0xe3, 0xf9, 0x00, 0x00, 0xed, 0xf9, 0x00, 0x00, 0xf8, 0xf9, 0x00, 0x00,
-  0x03, 0xfa, 0x00, 0x00, 0x0e, 0xfa, 0x00, 0x00, 0x19, 0xfa, 0x00, 0x00,
-  0x23, 0xfa, 0x00, 0x00, 0x2e, 0xfa, 0x00, 0x00, 0x39, 0xfa, 0x00, 0x00,
-  0x43, 0xfa, 0x00, 0x00, 0x4e, 0xfa, 0x00, 0x00, 0x58, 0xfa, 0x00, 0x00,
-  0x63, 0xfa, 0x00, 0x00, 0x6d, 0xfa, 0x00, 0x00, 0x78, 0xfa, 0x00, 0x00,
-  0x82, 0xfa, 0x00, 0x00, 0x8c, 0xfa, 0x00, 0x00, 0x97, 0xfa, 0x00, 0x00,
-  0xa1, 0xfa, 0x00, 0x00, 0xab, 0xfa, 0x00, 0x00, 0xb5, 0xfa, 0x00, 0x00,
-  0xc0, 0xfa, 0x00, 0x00, 0xca, 0xfa, 0x00, 0x00, 0xd4, 0xfa, 0x00, 0x00,
-  0xde, 0xfa, 0x00, 0x00, 0xe8, 0xfa, 0x00, 0x00, 0xf2, 0xfa, 0x00, 0x00,
-  0xfc, 0xfa, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x0f, 0xfb, 0x00, 0x00,
-  0x19, 0xfb, 0x00, 0x00, 0x23, 0xfb, 0x00, 0x00, 0x2d, 0xfb, 0x00, 0x00,
-  0x36, 0xfb, 0x00, 0x00, 0x40, 0xfb, 0x00, 0x00, 0x4a, 0xfb, 0x00, 0x00,
-  0x53, 0xfb, 0x00, 0x00, 0x5d, 0xfb, 0x00, 0x00, 0x66, 0xfb, 0x00, 0x00,
-  0x70, 0xfb, 0x00, 0x00, 0x79, 0xfb, 0x00, 0x00, 0x83, 0xfb, 0x00, 0x00,
-  0x8c, 0xfb, 0x00, 0x00, 0x95, 0xfb, 0x00, 0x00, 0x9e, 0xfb, 0x00, 0x00,
-  0xa8, 0xfb, 0x00, 0x00, 0xb1, 0xfb, 0x00, 0x00, 0xba, 0xfb, 0x00, 0x00,
-  0xc3, 0xfb, 0x00, 0x00, 0xcc, 0xfb, 0x00, 0x00, 0xd5, 0xfb, 0x00, 0x00,
-  0xde, 0xfb, 0x00, 0x00, 0xe7, 0xfb, 0x00, 0x00, 0xf0, 0xfb, 0x00, 0x00,
-  0xf9, 0xfb, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x0b, 0xfc, 0x00, 0x00,
-  0x14, 0xfc, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x25, 0xfc, 0x00, 0x00,
-  0x2e, 0xfc, 0x00, 0x00, 0x36, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00,
-  0x48, 0xfc, 0x00, 0x00, 0x50, 0xfc, 0x00, 0x00, 0x58, 0xfc, 0x00, 0x00,
-  0x61, 0xfc, 0x00, 0x00, 0x69, 0xfc, 0x00, 0x00, 0x72, 0xfc, 0x00, 0x00,
-  0x7a, 0xfc, 0x00, 0x00, 0x82, 0xfc, 0x00, 0x00, 0x8b, 0xfc, 0x00, 0x00,
-  0x93, 0xfc, 0x00, 0x00, 0x9b, 0xfc, 0x00, 0x00, 0xa3, 0xfc, 0x00, 0x00,
-  0xab, 0xfc, 0x00, 0x00, 0xb3, 0xfc, 0x00, 0x00, 0xbb, 0xfc, 0x00, 0x00,
-  0xc3, 0xfc, 0x00, 0x00, 0xcb, 0xfc, 0x00, 0x00, 0xd3, 0xfc, 0x00, 0x00,
-  0xdb, 0xfc, 0x00, 0x00, 0xe3, 0xfc, 0x00, 0x00, 0xeb, 0xfc, 0x00, 0x00,
-  0xf2, 0xfc, 0x00, 0x00, 0xfa, 0xfc, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00,
-  0x09, 0xfd, 0x00, 0x00, 0x11, 0xfd, 0x00, 0x00, 0x19, 0xfd, 0x00, 0x00,
-  0x20, 0xfd, 0x00, 0x00, 0x28, 0xfd, 0x00, 0x00, 0x2f, 0xfd, 0x00, 0x00,
-  0x36, 0xfd, 0x00, 0x00, 0x3e, 0xfd, 0x00, 0x00, 0x45, 0xfd, 0x00, 0x00,
-  0x4c, 0xfd, 0x00, 0x00, 0x54, 0xfd, 0x00, 0x00, 0x5b, 0xfd, 0x00, 0x00,
-  0x62, 0xfd, 0x00, 0x00, 0x69, 0xfd, 0x00, 0x00, 0x70, 0xfd, 0x00, 0x00,
-  0x77, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0x00, 0x00, 0x86, 0xfd, 0x00, 0x00,
-  0x8c, 0xfd, 0x00, 0x00, 0x93, 0xfd, 0x00, 0x00, 0x9a, 0xfd, 0x00, 0x00,
-  0xa1, 0xfd, 0x00, 0x00, 0xa8, 0xfd, 0x00, 0x00, 0xaf, 0xfd, 0x00, 0x00,
-  0xb5, 0xfd, 0x00, 0x00, 0xbc, 0xfd, 0x00, 0x00, 0xc3, 0xfd, 0x00, 0x00,
-  0xc9, 0xfd, 0x00, 0x00, 0xd0, 0xfd, 0x00, 0x00, 0xd6, 0xfd, 0x00, 0x00,
-  0xdd, 0xfd, 0x00, 0x00, 0xe3, 0xfd, 0x00, 0x00, 0xea, 0xfd, 0x00, 0x00,
-  0xf0, 0xfd, 0x00, 0x00, 0xf7, 0xfd, 0x00, 0x00, 0xfd, 0xfd, 0x00, 0x00,
-  0x03, 0xfe, 0x00, 0x00, 0x09, 0xfe, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x00,
-  0x16, 0xfe, 0x00, 0x00, 0x1c, 0xfe, 0x00, 0x00, 0x22, 0xfe, 0x00, 0x00,
-  0x28, 0xfe, 0x00, 0x00, 0x2e, 0xfe, 0x00, 0x00, 0x34, 0xfe, 0x00, 0x00,
-  0x3a, 0xfe, 0x00, 0x00, 0x40, 0xfe, 0x00, 0x00, 0x46, 0xfe, 0x00, 0x00,
-  0x4b, 0xfe, 0x00, 0x00, 0x51, 0xfe, 0x00, 0x00, 0x57, 0xfe, 0x00, 0x00,
-  0x5d, 0xfe, 0x00, 0x00, 0x62, 0xfe, 0x00, 0x00, 0x68, 0xfe, 0x00, 0x00,
-  0x6d, 0xfe, 0x00, 0x00, 0x73, 0xfe, 0x00, 0x00, 0x78, 0xfe, 0x00, 0x00,
-  0x7e, 0xfe, 0x00, 0x00, 0x83, 0xfe, 0x00, 0x00, 0x89, 0xfe, 0x00, 0x00,
-  0x8e, 0xfe, 0x00, 0x00, 0x93, 0xfe, 0x00, 0x00, 0x99, 0xfe, 0x00, 0x00,
-  0x9e, 0xfe, 0x00, 0x00, 0xa3, 0xfe, 0x00, 0x00, 0xa8, 0xfe, 0x00, 0x00,
-  0xad, 0xfe, 0x00, 0x00, 0xb2, 0xfe, 0x00, 0x00, 0xb7, 0xfe, 0x00, 0x00,
-  0xbc, 0xfe, 0x00, 0x00, 0xc1, 0xfe, 0x00, 0x00, 0xc6, 0xfe, 0x00, 0x00,
-  0xcb, 0xfe, 0x00, 0x00, 0xd0, 0xfe, 0x00, 0x00, 0xd5, 0xfe, 0x00, 0x00,
-  0xda, 0xfe, 0x00, 0x00, 0xde, 0xfe, 0x00, 0x00, 0xe3, 0xfe, 0x00, 0x00,
-  0xe8, 0xfe, 0x00, 0x00, 0xec, 0xfe, 0x00, 0x00, 0xf1, 0xfe, 0x00, 0x00,
-  0xf6, 0xfe, 0x00, 0x00, 0xfa, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00,
-  0x03, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x0c, 0xff, 0x00, 0x00,
-  0x10, 0xff, 0x00, 0x00, 0x14, 0xff, 0x00, 0x00, 0x19, 0xff, 0x00, 0x00,
-  0x1d, 0xff, 0x00, 0x00, 0x21, 0xff, 0x00, 0x00, 0x25, 0xff, 0x00, 0x00,
-  0x29, 0xff, 0x00, 0x00, 0x2d, 0xff, 0x00, 0x00, 0x31, 0xff, 0x00, 0x00,
-  0x35, 0xff, 0x00, 0x00, 0x39, 0xff, 0x00, 0x00, 0x3d, 0xff, 0x00, 0x00,
-  0x41, 0xff, 0x00, 0x00, 0x45, 0xff, 0x00, 0x00, 0x48, 0xff, 0x00, 0x00,
-  0x4c, 0xff, 0x00, 0x00, 0x50, 0xff, 0x00, 0x00, 0x53, 0xff, 0x00, 0x00,
-  0x57, 0xff, 0x00, 0x00, 0x5b, 0xff, 0x00, 0x00, 0x5e, 0xff, 0x00, 0x00,
-  0x62, 0xff, 0x00, 0x00, 0x65, 0xff, 0x00, 0x00, 0x69, 0xff, 0x00, 0x00,
-  0x6c, 0xff, 0x00, 0x00, 0x6f, 0xff, 0x00, 0x00, 0x73, 0xff, 0x00, 0x00,
-  0x76, 0xff, 0x00, 0x00, 0x79, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00,
-  0x80, 0xff, 0x00, 0x00, 0x83, 0xff, 0x00, 0x00, 0x86, 0xff, 0x00, 0x00,
-  0x89, 0xff, 0x00, 0x00, 0x8c, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x00, 0x00,
-  0x92, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0x97, 0xff, 0x00, 0x00,
-  0x9a, 0xff, 0x00, 0x00, 0x9d, 0xff, 0x00, 0x00, 0xa0, 0xff, 0x00, 0x00,
-  0xa2, 0xff, 0x00, 0x00, 0xa5, 0xff, 0x00, 0x00, 0xa8, 0xff, 0x00, 0x00,
-  0xaa, 0xff, 0x00, 0x00, 0xad, 0xff, 0x00, 0x00, 0xaf, 0xff, 0x00, 0x00,
-  0xb2, 0xff, 0x00, 0x00, 0xb4, 0xff, 0x00, 0x00, 0xb7, 0xff, 0x00, 0x00,
-  0xb9, 0xff, 0x00, 0x00, 0xbb, 0xff, 0x00, 0x00, 0xbe, 0xff, 0x00, 0x00,
-  0xc0, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x00, 0x00, 0xc4, 0xff, 0x00, 0x00,
-  0xc6, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xca, 0xff, 0x00, 0x00,
-  0xcc, 0xff, 0x00, 0x00, 0xce, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x00, 0x00,
-  0xd2, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd6, 0xff, 0x00, 0x00,
-  0xd8, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xdb, 0xff, 0x00, 0x00,
-  0xdd, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00,
-  0xe1, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe4, 0xff, 0x00, 0x00,
-  0xe6, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00,
-  0xea, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00,
-  0xee, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00,
-  0xf1, 0xff, 0x00, 0x00, 0xf2, 0xff, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x00,
-  0xf4, 0xff, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00,
-  0xf7, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00,
-  0xf9, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00,
-  0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00,
-  0xfc, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00,
-  0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00
-};
-unsigned int SINETABL_dat_len = 40960;
@@ -1,1369 +0,0 @@
-const unsigned char TANGTABL_dat[] = {
-  0xa0, 0x1d, 0xd0, 0xf5, 0x88, 0xc5, 0x9a, 0xfc, 0xa8, 0x78, 0xf6, 0xfd,
-  0x7c, 0x7b, 0x8b, 0xfe, 0xfc, 0x43, 0xde, 0xfe, 0x11, 0xf2, 0x12, 0xff,
-  0x91, 0x6a, 0x37, 0xff, 0x55, 0x29, 0x52, 0xff, 0x19, 0x9d, 0x66, 0xff,
-  0x9b, 0xc2, 0x76, 0xff, 0xc9, 0xd4, 0x83, 0xff, 0x08, 0xa1, 0x8e, 0xff,
-  0x01, 0xb3, 0x97, 0xff, 0xfe, 0x6c, 0x9f, 0xff, 0x29, 0x16, 0xa6, 0xff,
-  0x50, 0xe3, 0xab, 0xff, 0x75, 0xfc, 0xb0, 0xff, 0x72, 0x80, 0xb5, 0xff,
-  0x79, 0x87, 0xb9, 0xff, 0xc2, 0x24, 0xbd, 0xff, 0xc7, 0x67, 0xc0, 0xff,
-  0x21, 0x5d, 0xc3, 0xff, 0x2a, 0x0f, 0xc6, 0xff, 0x7a, 0x86, 0xc8, 0xff,
-  0x43, 0xca, 0xca, 0xff, 0x93, 0xe0, 0xcc, 0xff, 0x92, 0xce, 0xce, 0xff,
-  0xa5, 0x98, 0xd0, 0xff, 0x93, 0x42, 0xd2, 0xff, 0xa2, 0xcf, 0xd3, 0xff,
-  0xa9, 0x42, 0xd5, 0xff, 0x22, 0x9e, 0xd6, 0xff, 0x3b, 0xe4, 0xd7, 0xff,
-  0xdc, 0x16, 0xd9, 0xff, 0xb8, 0x37, 0xda, 0xff, 0x4e, 0x48, 0xdb, 0xff,
-  0xf6, 0x49, 0xdc, 0xff, 0xe1, 0x3d, 0xdd, 0xff, 0x21, 0x25, 0xde, 0xff,
-  0xac, 0x00, 0xdf, 0xff, 0x61, 0xd1, 0xdf, 0xff, 0x07, 0x98, 0xe0, 0xff,
-  0x55, 0x55, 0xe1, 0xff, 0xf0, 0x09, 0xe2, 0xff, 0x6e, 0xb6, 0xe2, 0xff,
-  0x57, 0x5b, 0xe3, 0xff, 0x2a, 0xf9, 0xe3, 0xff, 0x51, 0x90, 0xe4, 0xff,
-  0x44, 0x21, 0xe5, 0xff, 0x5c, 0xac, 0xe5, 0xff, 0xf3, 0x31, 0xe6, 0xff,
-  0x5a, 0xb2, 0xe6, 0xff, 0xde, 0x2d, 0xe7, 0xff, 0xc4, 0xa4, 0xe7, 0xff,
-  0x4e, 0x17, 0xe8, 0xff, 0xb8, 0x85, 0xe8, 0xff, 0x39, 0xf0, 0xe8, 0xff,
-  0x07, 0x57, 0xe9, 0xff, 0x52, 0xba, 0xe9, 0xff, 0x47, 0x1a, 0xea, 0xff,
-  0x10, 0x77, 0xea, 0xff, 0xd6, 0xd0, 0xea, 0xff, 0xbc, 0x27, 0xeb, 0xff,
-  0xe7, 0x7b, 0xeb, 0xff, 0x76, 0xcd, 0xeb, 0xff, 0x88, 0x1c, 0xec, 0xff,
-  0x39, 0x69, 0xec, 0xff, 0xa6, 0xb3, 0xec, 0xff, 0xe6, 0xfb, 0xec, 0xff,
-  0x13, 0x42, 0xed, 0xff, 0x43, 0x86, 0xed, 0xff, 0x8a, 0xc8, 0xed, 0xff,
-  0xff, 0x08, 0xee, 0xff, 0xb2, 0x47, 0xee, 0xff, 0xb7, 0x84, 0xee, 0xff,
-  0x1f, 0xc0, 0xee, 0xff, 0xfa, 0xf9, 0xee, 0xff, 0x57, 0x32, 0xef, 0xff,
-  0x44, 0x69, 0xef, 0xff, 0xd1, 0x9e, 0xef, 0xff, 0x09, 0xd3, 0xef, 0xff,
-  0xfa, 0x05, 0xf0, 0xff, 0xae, 0x37, 0xf0, 0xff, 0x33, 0x68, 0xf0, 0xff,
-  0x92, 0x97, 0xf0, 0xff, 0xd5, 0xc5, 0xf0, 0xff, 0x07, 0xf3, 0xf0, 0xff,
-  0x32, 0x1f, 0xf1, 0xff, 0x5d, 0x4a, 0xf1, 0xff, 0x91, 0x74, 0xf1, 0xff,
-  0xd7, 0x9d, 0xf1, 0xff, 0x36, 0xc6, 0xf1, 0xff, 0xb6, 0xed, 0xf1, 0xff,
-  0x5f, 0x14, 0xf2, 0xff, 0x36, 0x3a, 0xf2, 0xff, 0x43, 0x5f, 0xf2, 0xff,
-  0x8b, 0x83, 0xf2, 0xff, 0x16, 0xa7, 0xf2, 0xff, 0xe7, 0xc9, 0xf2, 0xff,
-  0x07, 0xec, 0xf2, 0xff, 0x78, 0x0d, 0xf3, 0xff, 0x41, 0x2e, 0xf3, 0xff,
-  0x66, 0x4e, 0xf3, 0xff, 0xed, 0x6d, 0xf3, 0xff, 0xda, 0x8c, 0xf3, 0xff,
-  0x31, 0xab, 0xf3, 0xff, 0xf7, 0xc8, 0xf3, 0xff, 0x2f, 0xe6, 0xf3, 0xff,
-  0xdd, 0x02, 0xf4, 0xff, 0x06, 0x1f, 0xf4, 0xff, 0xad, 0x3a, 0xf4, 0xff,
-  0xd4, 0x55, 0xf4, 0xff, 0x81, 0x70, 0xf4, 0xff, 0xb6, 0x8a, 0xf4, 0xff,
-  0x75, 0xa4, 0xf4, 0xff, 0xc3, 0xbd, 0xf4, 0xff, 0xa2, 0xd6, 0xf4, 0xff,
-  0x15, 0xef, 0xf4, 0xff, 0x1e, 0x07, 0xf5, 0xff, 0xc1, 0x1e, 0xf5, 0xff,
-  0x00, 0x36, 0xf5, 0xff, 0xdd, 0x4c, 0xf5, 0xff, 0x5a, 0x63, 0xf5, 0xff,
-  0x7b, 0x79, 0xf5, 0xff, 0x41, 0x8f, 0xf5, 0xff, 0xaf, 0xa4, 0xf5, 0xff,
-  0xc6, 0xb9, 0xf5, 0xff, 0x88, 0xce, 0xf5, 0xff, 0xf8, 0xe2, 0xf5, 0xff,
-  0x18, 0xf7, 0xf5, 0xff, 0xe8, 0x0a, 0xf6, 0xff, 0x6c, 0x1e, 0xf6, 0xff,
-  0xa5, 0x31, 0xf6, 0xff, 0x95, 0x44, 0xf6, 0xff, 0x3c, 0x57, 0xf6, 0xff,
-  0x9d, 0x69, 0xf6, 0xff, 0xba, 0x7b, 0xf6, 0xff, 0x93, 0x8d, 0xf6, 0xff,
-  0x2b, 0x9f, 0xf6, 0xff, 0x82, 0xb0, 0xf6, 0xff, 0x9a, 0xc1, 0xf6, 0xff,
-  0x75, 0xd2, 0xf6, 0xff, 0x13, 0xe3, 0xf6, 0xff, 0x77, 0xf3, 0xf6, 0xff,
-  0xa0, 0x03, 0xf7, 0xff, 0x91, 0x13, 0xf7, 0xff, 0x4b, 0x23, 0xf7, 0xff,
-  0xce, 0x32, 0xf7, 0xff, 0x1b, 0x42, 0xf7, 0xff, 0x35, 0x51, 0xf7, 0xff,
-  0x1b, 0x60, 0xf7, 0xff, 0xd0, 0x6e, 0xf7, 0xff, 0x53, 0x7d, 0xf7, 0xff,
-  0xa6, 0x8b, 0xf7, 0xff, 0xc9, 0x99, 0xf7, 0xff, 0xbf, 0xa7, 0xf7, 0xff,
-  0x86, 0xb5, 0xf7, 0xff, 0x22, 0xc3, 0xf7, 0xff, 0x91, 0xd0, 0xf7, 0xff,
-  0xd6, 0xdd, 0xf7, 0xff, 0xf0, 0xea, 0xf7, 0xff, 0xe2, 0xf7, 0xf7, 0xff,
-  0xaa, 0x04, 0xf8, 0xff, 0x4b, 0x11, 0xf8, 0xff, 0xc5, 0x1d, 0xf8, 0xff,
-  0x18, 0x2a, 0xf8, 0xff, 0x46, 0x36, 0xf8, 0xff, 0x4f, 0x42, 0xf8, 0xff,
-  0x33, 0x4e, 0xf8, 0xff, 0xf3, 0x59, 0xf8, 0xff, 0x91, 0x65, 0xf8, 0xff,
-  0x0c, 0x71, 0xf8, 0xff, 0x65, 0x7c, 0xf8, 0xff, 0x9d, 0x87, 0xf8, 0xff,
-  0xb4, 0x92, 0xf8, 0xff, 0xab, 0x9d, 0xf8, 0xff, 0x82, 0xa8, 0xf8, 0xff,
-  0x3a, 0xb3, 0xf8, 0xff, 0xd4, 0xbd, 0xf8, 0xff, 0x4f, 0xc8, 0xf8, 0xff,
-  0xad, 0xd2, 0xf8, 0xff, 0xee, 0xdc, 0xf8, 0xff, 0x13, 0xe7, 0xf8, 0xff,
-  0x1b, 0xf1, 0xf8, 0xff, 0x08, 0xfb, 0xf8, 0xff, 0xd9, 0x04, 0xf9, 0xff,
-  0x90, 0x0e, 0xf9, 0xff, 0x2c, 0x18, 0xf9, 0xff, 0xaf, 0x21, 0xf9, 0xff,
-  0x18, 0x2b, 0xf9, 0xff, 0x67, 0x34, 0xf9, 0xff, 0x9e, 0x3d, 0xf9, 0xff,
-  0xbd, 0x46, 0xf9, 0xff, 0xc4, 0x4f, 0xf9, 0xff, 0xb3, 0x58, 0xf9, 0xff,
-  0x8b, 0x61, 0xf9, 0xff, 0x4c, 0x6a, 0xf9, 0xff, 0xf7, 0x72, 0xf9, 0xff,
-  0x8b, 0x7b, 0xf9, 0xff, 0x09, 0x84, 0xf9, 0xff, 0x72, 0x8c, 0xf9, 0xff,
-  0xc6, 0x94, 0xf9, 0xff, 0x05, 0x9d, 0xf9, 0xff, 0x2f, 0xa5, 0xf9, 0xff,
-  0x45, 0xad, 0xf9, 0xff, 0x48, 0xb5, 0xf9, 0xff, 0x36, 0xbd, 0xf9, 0xff,
-  0x11, 0xc5, 0xf9, 0xff, 0xd9, 0xcc, 0xf9, 0xff, 0x8e, 0xd4, 0xf9, 0xff,
-  0x30, 0xdc, 0xf9, 0xff, 0xc0, 0xe3, 0xf9, 0xff, 0x3e, 0xeb, 0xf9, 0xff,
-  0xaa, 0xf2, 0xf9, 0xff, 0x05, 0xfa, 0xf9, 0xff, 0x4e, 0x01, 0xfa, 0xff,
-  0x86, 0x08, 0xfa, 0xff, 0xae, 0x0f, 0xfa, 0xff, 0xc5, 0x16, 0xfa, 0xff,
-  0xcb, 0x1d, 0xfa, 0xff, 0xc1, 0x24, 0xfa, 0xff, 0xa8, 0x2b, 0xfa, 0xff,
-  0x7e, 0x32, 0xfa, 0xff, 0x45, 0x39, 0xfa, 0xff, 0xfd, 0x3f, 0xfa, 0xff,
-  0xa6, 0x46, 0xfa, 0xff, 0x40, 0x4d, 0xfa, 0xff, 0xcb, 0x53, 0xfa, 0xff,
-  0x47, 0x5a, 0xfa, 0xff, 0xb5, 0x60, 0xfa, 0xff, 0x16, 0x67, 0xfa, 0xff,
-  0x68, 0x6d, 0xfa, 0xff, 0xac, 0x73, 0xfa, 0xff, 0xe3, 0x79, 0xfa, 0xff,
-  0x0c, 0x80, 0xfa, 0xff, 0x28, 0x86, 0xfa, 0xff, 0x37, 0x8c, 0xfa, 0xff,
-  0x39, 0x92, 0xfa, 0xff, 0x2f, 0x98, 0xfa, 0xff, 0x18, 0x9e, 0xfa, 0xff,
-  0xf4, 0xa3, 0xfa, 0xff, 0xc4, 0xa9, 0xfa, 0xff, 0x88, 0xaf, 0xfa, 0xff,
-  0x40, 0xb5, 0xfa, 0xff, 0xec, 0xba, 0xfa, 0xff, 0x8c, 0xc0, 0xfa, 0xff,
-  0x21, 0xc6, 0xfa, 0xff, 0xaa, 0xcb, 0xfa, 0xff, 0x29, 0xd1, 0xfa, 0xff,
-  0x9c, 0xd6, 0xfa, 0xff, 0x04, 0xdc, 0xfa, 0xff, 0x61, 0xe1, 0xfa, 0xff,
-  0xb3, 0xe6, 0xfa, 0xff, 0xfb, 0xeb, 0xfa, 0xff, 0x38, 0xf1, 0xfa, 0xff,
-  0x6b, 0xf6, 0xfa, 0xff, 0x94, 0xfb, 0xfa, 0xff, 0xb2, 0x00, 0xfb, 0xff,
-  0xc7, 0x05, 0xfb, 0xff, 0xd2, 0x0a, 0xfb, 0xff, 0xd3, 0x0f, 0xfb, 0xff,
-  0xca, 0x14, 0xfb, 0xff, 0xb7, 0x19, 0xfb, 0xff, 0x9c, 0x1e, 0xfb, 0xff,
-  0x77, 0x23, 0xfb, 0xff, 0x48, 0x28, 0xfb, 0xff, 0x11, 0x2d, 0xfb, 0xff,
-  0xd0, 0x31, 0xfb, 0xff, 0x87, 0x36, 0xfb, 0xff, 0x34, 0x3b, 0xfb, 0xff,
-  0xd9, 0x3f, 0xfb, 0xff, 0x76, 0x44, 0xfb, 0xff, 0x09, 0x49, 0xfb, 0xff,
-  0x95, 0x4d, 0xfb, 0xff, 0x18, 0x52, 0xfb, 0xff, 0x93, 0x56, 0xfb, 0xff,
-  0x05, 0x5b, 0xfb, 0xff, 0x70, 0x5f, 0xfb, 0xff, 0xd2, 0x63, 0xfb, 0xff,
-  0x2d, 0x68, 0xfb, 0xff, 0x80, 0x6c, 0xfb, 0xff, 0xcb, 0x70, 0xfb, 0xff,
-  0x0e, 0x75, 0xfb, 0xff, 0x4a, 0x79, 0xfb, 0xff, 0x7e, 0x7d, 0xfb, 0xff,
-  0xab, 0x81, 0xfb, 0xff, 0xd1, 0x85, 0xfb, 0xff, 0xef, 0x89, 0xfb, 0xff,
-  0x06, 0x8e, 0xfb, 0xff, 0x16, 0x92, 0xfb, 0xff, 0x1f, 0x96, 0xfb, 0xff,
-  0x21, 0x9a, 0xfb, 0xff, 0x1c, 0x9e, 0xfb, 0xff, 0x10, 0xa2, 0xfb, 0xff,
-  0xfe, 0xa5, 0xfb, 0xff, 0xe4, 0xa9, 0xfb, 0xff, 0xc5, 0xad, 0xfb, 0xff,
-  0x9e, 0xb1, 0xfb, 0xff, 0x71, 0xb5, 0xfb, 0xff, 0x3e, 0xb9, 0xfb, 0xff,
-  0x04, 0xbd, 0xfb, 0xff, 0xc4, 0xc0, 0xfb, 0xff, 0x7e, 0xc4, 0xfb, 0xff,
-  0x32, 0xc8, 0xfb, 0xff, 0xdf, 0xcb, 0xfb, 0xff, 0x87, 0xcf, 0xfb, 0xff,
-  0x28, 0xd3, 0xfb, 0xff, 0xc4, 0xd6, 0xfb, 0xff, 0x5a, 0xda, 0xfb, 0xff,
-  0xe9, 0xdd, 0xfb, 0xff, 0x73, 0xe1, 0xfb, 0xff, 0xf8, 0xe4, 0xfb, 0xff,
-  0x77, 0xe8, 0xfb, 0xff, 0xf0, 0xeb, 0xfb, 0xff, 0x63, 0xef, 0xfb, 0xff,
-  0xd1, 0xf2, 0xfb, 0xff, 0x3a, 0xf6, 0xfb, 0xff, 0x9d, 0xf9, 0xfb, 0xff,
-  0xfb, 0xfc, 0xfb, 0xff, 0x54, 0x00, 0xfc, 0xff, 0xa7, 0x03, 0xfc, 0xff,
-  0xf5, 0x06, 0xfc, 0xff, 0x3e, 0x0a, 0xfc, 0xff, 0x82, 0x0d, 0xfc, 0xff,
-  0xc1, 0x10, 0xfc, 0xff, 0xfb, 0x13, 0xfc, 0xff, 0x30, 0x17, 0xfc, 0xff,
-  0x60, 0x1a, 0xfc, 0xff, 0x8b, 0x1d, 0xfc, 0xff, 0xb2, 0x20, 0xfc, 0xff,
-  0xd3, 0x23, 0xfc, 0xff, 0xf0, 0x26, 0xfc, 0xff, 0x08, 0x2a, 0xfc, 0xff,
-  0x1c, 0x2d, 0xfc, 0xff, 0x2b, 0x30, 0xfc, 0xff, 0x35, 0x33, 0xfc, 0xff,
-  0x3b, 0x36, 0xfc, 0xff, 0x3c, 0x39, 0xfc, 0xff, 0x39, 0x3c, 0xfc, 0xff,
-  0x32, 0x3f, 0xfc, 0xff, 0x26, 0x42, 0xfc, 0xff, 0x16, 0x45, 0xfc, 0xff,
-  0x01, 0x48, 0xfc, 0xff, 0xe9, 0x4a, 0xfc, 0xff, 0xcc, 0x4d, 0xfc, 0xff,
-  0xab, 0x50, 0xfc, 0xff, 0x85, 0x53, 0xfc, 0xff, 0x5c, 0x56, 0xfc, 0xff,
-  0x2e, 0x59, 0xfc, 0xff, 0xfd, 0x5b, 0xfc, 0xff, 0xc7, 0x5e, 0xfc, 0xff,
-  0x8e, 0x61, 0xfc, 0xff, 0x51, 0x64, 0xfc, 0xff, 0x0f, 0x67, 0xfc, 0xff,
-  0xca, 0x69, 0xfc, 0xff, 0x81, 0x6c, 0xfc, 0xff, 0x34, 0x6f, 0xfc, 0xff,
-  0xe4, 0x71, 0xfc, 0xff, 0x90, 0x74, 0xfc, 0xff, 0x38, 0x77, 0xfc, 0xff,
-  0xdc, 0x79, 0xfc, 0xff, 0x7d, 0x7c, 0xfc, 0xff, 0x1a, 0x7f, 0xfc, 0xff,
-  0xb3, 0x81, 0xfc, 0xff, 0x49, 0x84, 0xfc, 0xff, 0xdb, 0x86, 0xfc, 0xff,
-  0x6a, 0x89, 0xfc, 0xff, 0xf6, 0x8b, 0xfc, 0xff, 0x7e, 0x8e, 0xfc, 0xff,
-  0x02, 0x91, 0xfc, 0xff, 0x83, 0x93, 0xfc, 0xff, 0x01, 0x96, 0xfc, 0xff,
-  0x7c, 0x98, 0xfc, 0xff, 0xf3, 0x9a, 0xfc, 0xff, 0x67, 0x9d, 0xfc, 0xff,
-  0xd7, 0x9f, 0xfc, 0xff, 0x45, 0xa2, 0xfc, 0xff, 0xaf, 0xa4, 0xfc, 0xff,
-  0x16, 0xa7, 0xfc, 0xff, 0x7a, 0xa9, 0xfc, 0xff, 0xdb, 0xab, 0xfc, 0xff,
-  0x38, 0xae, 0xfc, 0xff, 0x93, 0xb0, 0xfc, 0xff, 0xeb, 0xb2, 0xfc, 0xff,
-  0x3f, 0xb5, 0xfc, 0xff, 0x91, 0xb7, 0xfc, 0xff, 0xdf, 0xb9, 0xfc, 0xff,
-  0x2b, 0xbc, 0xfc, 0xff, 0x73, 0xbe, 0xfc, 0xff, 0xb9, 0xc0, 0xfc, 0xff,
-  0xfc, 0xc2, 0xfc, 0xff, 0x3c, 0xc5, 0xfc, 0xff, 0x79, 0xc7, 0xfc, 0xff,
-  0xb3, 0xc9, 0xfc, 0xff, 0xeb, 0xcb, 0xfc, 0xff, 0x20, 0xce, 0xfc, 0xff,
-  0x51, 0xd0, 0xfc, 0xff, 0x81, 0xd2, 0xfc, 0xff, 0xad, 0xd4, 0xfc, 0xff,
-  0xd7, 0xd6, 0xfc, 0xff, 0xfe, 0xd8, 0xfc, 0xff, 0x23, 0xdb, 0xfc, 0xff,
-  0x44, 0xdd, 0xfc, 0xff, 0x64, 0xdf, 0xfc, 0xff, 0x80, 0xe1, 0xfc, 0xff,
-  0x9a, 0xe3, 0xfc, 0xff, 0xb2, 0xe5, 0xfc, 0xff, 0xc7, 0xe7, 0xfc, 0xff,
-  0xd9, 0xe9, 0xfc, 0xff, 0xe9, 0xeb, 0xfc, 0xff, 0xf6, 0xed, 0xfc, 0xff,
-  0x01, 0xf0, 0xfc, 0xff, 0x0a, 0xf2, 0xfc, 0xff, 0x10, 0xf4, 0xfc, 0xff,
-  0x13, 0xf6, 0xfc, 0xff, 0x14, 0xf8, 0xfc, 0xff, 0x13, 0xfa, 0xfc, 0xff,
-  0x10, 0xfc, 0xfc, 0xff, 0x0a, 0xfe, 0xfc, 0xff, 0x02, 0x00, 0xfd, 0xff,
-  0xf7, 0x01, 0xfd, 0xff, 0xea, 0x03, 0xfd, 0xff, 0xdb, 0x05, 0xfd, 0xff,
-  0xca, 0x07, 0xfd, 0xff, 0xb6, 0x09, 0xfd, 0xff, 0xa1, 0x0b, 0xfd, 0xff,
-  0x89, 0x0d, 0xfd, 0xff, 0x6e, 0x0f, 0xfd, 0xff, 0x52, 0x11, 0xfd, 0xff,
-  0x33, 0x13, 0xfd, 0xff, 0x13, 0x15, 0xfd, 0xff, 0xf0, 0x16, 0xfd, 0xff,
-  0xcb, 0x18, 0xfd, 0xff, 0xa3, 0x1a, 0xfd, 0xff, 0x7a, 0x1c, 0xfd, 0xff,
-  0x4f, 0x1e, 0xfd, 0xff, 0x22, 0x20, 0xfd, 0xff, 0xf2, 0x21, 0xfd, 0xff,
-  0xc1, 0x23, 0xfd, 0xff, 0x8d, 0x25, 0xfd, 0xff, 0x58, 0x27, 0xfd, 0xff,
-  0x20, 0x29, 0xfd, 0xff, 0xe7, 0x2a, 0xfd, 0xff, 0xab, 0x2c, 0xfd, 0xff,
-  0x6e, 0x2e, 0xfd, 0xff, 0x2e, 0x30, 0xfd, 0xff, 0xed, 0x31, 0xfd, 0xff,
-  0xaa, 0x33, 0xfd, 0xff, 0x65, 0x35, 0xfd, 0xff, 0x1e, 0x37, 0xfd, 0xff,
-  0xd5, 0x38, 0xfd, 0xff, 0x8a, 0x3a, 0xfd, 0xff, 0x3e, 0x3c, 0xfd, 0xff,
-  0xef, 0x3d, 0xfd, 0xff, 0x9f, 0x3f, 0xfd, 0xff, 0x4d, 0x41, 0xfd, 0xff,
-  0xf9, 0x42, 0xfd, 0xff, 0xa3, 0x44, 0xfd, 0xff, 0x4c, 0x46, 0xfd, 0xff,
-  0xf2, 0x47, 0xfd, 0xff, 0x97, 0x49, 0xfd, 0xff, 0x3b, 0x4b, 0xfd, 0xff,
-  0xdc, 0x4c, 0xfd, 0xff, 0x7c, 0x4e, 0xfd, 0xff, 0x1a, 0x50, 0xfd, 0xff,
-  0xb6, 0x51, 0xfd, 0xff, 0x51, 0x53, 0xfd, 0xff, 0xea, 0x54, 0xfd, 0xff,
-  0x81, 0x56, 0xfd, 0xff, 0x17, 0x58, 0xfd, 0xff, 0xab, 0x59, 0xfd, 0xff,
-  0x3d, 0x5b, 0xfd, 0xff, 0xce, 0x5c, 0xfd, 0xff, 0x5d, 0x5e, 0xfd, 0xff,
-  0xeb, 0x5f, 0xfd, 0xff, 0x77, 0x61, 0xfd, 0xff, 0x01, 0x63, 0xfd, 0xff,
-  0x8a, 0x64, 0xfd, 0xff, 0x11, 0x66, 0xfd, 0xff, 0x97, 0x67, 0xfd, 0xff,
-  0x1b, 0x69, 0xfd, 0xff, 0x9d, 0x6a, 0xfd, 0xff, 0x1e, 0x6c, 0xfd, 0xff,
-  0x9e, 0x6d, 0xfd, 0xff, 0x1c, 0x6f, 0xfd, 0xff, 0x98, 0x70, 0xfd, 0xff,
-  0x13, 0x72, 0xfd, 0xff, 0x8d, 0x73, 0xfd, 0xff, 0x05, 0x75, 0xfd, 0xff,
-  0x7b, 0x76, 0xfd, 0xff, 0xf0, 0x77, 0xfd, 0xff, 0x64, 0x79, 0xfd, 0xff,
-  0xd6, 0x7a, 0xfd, 0xff, 0x47, 0x7c, 0xfd, 0xff, 0xb6, 0x7d, 0xfd, 0xff,
-  0x24, 0x7f, 0xfd, 0xff, 0x91, 0x80, 0xfd, 0xff, 0xfc, 0x81, 0xfd, 0xff,
-  0x66, 0x83, 0xfd, 0xff, 0xce, 0x84, 0xfd, 0xff, 0x35, 0x86, 0xfd, 0xff,
-  0x9b, 0x87, 0xfd, 0xff, 0xff, 0x88, 0xfd, 0xff, 0x62, 0x8a, 0xfd, 0xff,
-  0xc4, 0x8b, 0xfd, 0xff, 0x24, 0x8d, 0xfd, 0xff, 0x83, 0x8e, 0xfd, 0xff,
-  0xe1, 0x8f, 0xfd, 0xff, 0x3d, 0x91, 0xfd, 0xff, 0x99, 0x92, 0xfd, 0xff,
-  0xf2, 0x93, 0xfd, 0xff, 0x4b, 0x95, 0xfd, 0xff, 0xa2, 0x96, 0xfd, 0xff,
-  0xf8, 0x97, 0xfd, 0xff, 0x4d, 0x99, 0xfd, 0xff, 0xa0, 0x9a, 0xfd, 0xff,
-  0xf2, 0x9b, 0xfd, 0xff, 0x43, 0x9d, 0xfd, 0xff, 0x93, 0x9e, 0xfd, 0xff,
-  0xe2, 0x9f, 0xfd, 0xff, 0x2f, 0xa1, 0xfd, 0xff, 0x7b, 0xa2, 0xfd, 0xff,
-  0xc6, 0xa3, 0xfd, 0xff, 0x10, 0xa5, 0xfd, 0xff, 0x58, 0xa6, 0xfd, 0xff,
-  0x9f, 0xa7, 0xfd, 0xff, 0xe6, 0xa8, 0xfd, 0xff, 0x2b, 0xaa, 0xfd, 0xff,
-  0x6e, 0xab, 0xfd, 0xff, 0xb1, 0xac, 0xfd, 0xff, 0xf3, 0xad, 0xfd, 0xff,
-  0x33, 0xaf, 0xfd, 0xff, 0x72, 0xb0, 0xfd, 0xff, 0xb0, 0xb1, 0xfd, 0xff,
-  0xed, 0xb2, 0xfd, 0xff, 0x29, 0xb4, 0xfd, 0xff, 0x64, 0xb5, 0xfd, 0xff,
-  0x9d, 0xb6, 0xfd, 0xff, 0xd6, 0xb7, 0xfd, 0xff, 0x0d, 0xb9, 0xfd, 0xff,
-  0x44, 0xba, 0xfd, 0xff, 0x79, 0xbb, 0xfd, 0xff, 0xad, 0xbc, 0xfd, 0xff,
-  0xe0, 0xbd, 0xfd, 0xff, 0x13, 0xbf, 0xfd, 0xff, 0x44, 0xc0, 0xfd, 0xff,
-  0x74, 0xc1, 0xfd, 0xff, 0xa2, 0xc2, 0xfd, 0xff, 0xd0, 0xc3, 0xfd, 0xff,
-  0xfd, 0xc4, 0xfd, 0xff, 0x29, 0xc6, 0xfd, 0xff, 0x54, 0xc7, 0xfd, 0xff,
-  0x7e, 0xc8, 0xfd, 0xff, 0xa6, 0xc9, 0xfd, 0xff, 0xce, 0xca, 0xfd, 0xff,
-  0xf5, 0xcb, 0xfd, 0xff, 0x1b, 0xcd, 0xfd, 0xff, 0x40, 0xce, 0xfd, 0xff,
-  0x63, 0xcf, 0xfd, 0xff, 0x86, 0xd0, 0xfd, 0xff, 0xa8, 0xd1, 0xfd, 0xff,
-  0xc9, 0xd2, 0xfd, 0xff, 0xe9, 0xd3, 0xfd, 0xff, 0x08, 0xd5, 0xfd, 0xff,
-  0x26, 0xd6, 0xfd, 0xff, 0x43, 0xd7, 0xfd, 0xff, 0x5f, 0xd8, 0xfd, 0xff,
-  0x7a, 0xd9, 0xfd, 0xff, 0x95, 0xda, 0xfd, 0xff, 0xae, 0xdb, 0xfd, 0xff,
-  0xc6, 0xdc, 0xfd, 0xff, 0xde, 0xdd, 0xfd, 0xff, 0xf4, 0xde, 0xfd, 0xff,
-  0x0a, 0xe0, 0xfd, 0xff, 0x1f, 0xe1, 0xfd, 0xff, 0x33, 0xe2, 0xfd, 0xff,
-  0x46, 0xe3, 0xfd, 0xff, 0x58, 0xe4, 0xfd, 0xff, 0x69, 0xe5, 0xfd, 0xff,
-  0x79, 0xe6, 0xfd, 0xff, 0x89, 0xe7, 0xfd, 0xff, 0x97, 0xe8, 0xfd, 0xff,
-  0xa5, 0xe9, 0xfd, 0xff, 0xb2, 0xea, 0xfd, 0xff, 0xbe, 0xeb, 0xfd, 0xff,
-  0xc9, 0xec, 0xfd, 0xff, 0xd3, 0xed, 0xfd, 0xff, 0xdd, 0xee, 0xfd, 0xff,
-  0xe5, 0xef, 0xfd, 0xff, 0xed, 0xf0, 0xfd, 0xff, 0xf4, 0xf1, 0xfd, 0xff,
-  0xfa, 0xf2, 0xfd, 0xff, 0xff, 0xf3, 0xfd, 0xff, 0x04, 0xf5, 0xfd, 0xff,
-  0x07, 0xf6, 0xfd, 0xff, 0x0a, 0xf7, 0xfd, 0xff, 0x0c, 0xf8, 0xfd, 0xff,
-  0x0d, 0xf9, 0xfd, 0xff, 0x0e, 0xfa, 0xfd, 0xff, 0x0d, 0xfb, 0xfd, 0xff,
-  0x0c, 0xfc, 0xfd, 0xff, 0x0a, 0xfd, 0xfd, 0xff, 0x08, 0xfe, 0xfd, 0xff,
-  0x04, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfe, 0xff,
-  0xf5, 0x01, 0xfe, 0xff, 0xee, 0x02, 0xfe, 0xff, 0xe7, 0x03, 0xfe, 0xff,
-  0xdf, 0x04, 0xfe, 0xff, 0xd6, 0x05, 0xfe, 0xff, 0xcc, 0x06, 0xfe, 0xff,
-  0xc2, 0x07, 0xfe, 0xff, 0xb7, 0x08, 0xfe, 0xff, 0xab, 0x09, 0xfe, 0xff,
-  0x9f, 0x0a, 0xfe, 0xff, 0x91, 0x0b, 0xfe, 0xff, 0x83, 0x0c, 0xfe, 0xff,
-  0x75, 0x0d, 0xfe, 0xff, 0x65, 0x0e, 0xfe, 0xff, 0x55, 0x0f, 0xfe, 0xff,
-  0x44, 0x10, 0xfe, 0xff, 0x33, 0x11, 0xfe, 0xff, 0x20, 0x12, 0xfe, 0xff,
-  0x0d, 0x13, 0xfe, 0xff, 0xf9, 0x13, 0xfe, 0xff, 0xe5, 0x14, 0xfe, 0xff,
-  0xd0, 0x15, 0xfe, 0xff, 0xba, 0x16, 0xfe, 0xff, 0xa4, 0x17, 0xfe, 0xff,
-  0x8d, 0x18, 0xfe, 0xff, 0x75, 0x19, 0xfe, 0xff, 0x5c, 0x1a, 0xfe, 0xff,
-  0x43, 0x1b, 0xfe, 0xff, 0x29, 0x1c, 0xfe, 0xff, 0x0f, 0x1d, 0xfe, 0xff,
-  0xf4, 0x1d, 0xfe, 0xff, 0xd8, 0x1e, 0xfe, 0xff, 0xbb, 0x1f, 0xfe, 0xff,
-  0x9e, 0x20, 0xfe, 0xff, 0x80, 0x21, 0xfe, 0xff, 0x62, 0x22, 0xfe, 0xff,
-  0x43, 0x23, 0xfe, 0xff, 0x23, 0x24, 0xfe, 0xff, 0x03, 0x25, 0xfe, 0xff,
-  0xe2, 0x25, 0xfe, 0xff, 0xc0, 0x26, 0xfe, 0xff, 0x9e, 0x27, 0xfe, 0xff,
-  0x7b, 0x28, 0xfe, 0xff, 0x57, 0x29, 0xfe, 0xff, 0x33, 0x2a, 0xfe, 0xff,
-  0x0e, 0x2b, 0xfe, 0xff, 0xe9, 0x2b, 0xfe, 0xff, 0xc3, 0x2c, 0xfe, 0xff,
-  0x9c, 0x2d, 0xfe, 0xff, 0x75, 0x2e, 0xfe, 0xff, 0x4d, 0x2f, 0xfe, 0xff,
-  0x25, 0x30, 0xfe, 0xff, 0xfc, 0x30, 0xfe, 0xff, 0xd2, 0x31, 0xfe, 0xff,
-  0xa8, 0x32, 0xfe, 0xff, 0x7d, 0x33, 0xfe, 0xff, 0x52, 0x34, 0xfe, 0xff,
-  0x26, 0x35, 0xfe, 0xff, 0xfa, 0x35, 0xfe, 0xff, 0xcc, 0x36, 0xfe, 0xff,
-  0x9f, 0x37, 0xfe, 0xff, 0x71, 0x38, 0xfe, 0xff, 0x42, 0x39, 0xfe, 0xff,
-  0x12, 0x3a, 0xfe, 0xff, 0xe2, 0x3a, 0xfe, 0xff, 0xb2, 0x3b, 0xfe, 0xff,
-  0x81, 0x3c, 0xfe, 0xff, 0x4f, 0x3d, 0xfe, 0xff, 0x1d, 0x3e, 0xfe, 0xff,
-  0xea, 0x3e, 0xfe, 0xff, 0xb7, 0x3f, 0xfe, 0xff, 0x83, 0x40, 0xfe, 0xff,
-  0x4e, 0x41, 0xfe, 0xff, 0x19, 0x42, 0xfe, 0xff, 0xe4, 0x42, 0xfe, 0xff,
-  0xae, 0x43, 0xfe, 0xff, 0x77, 0x44, 0xfe, 0xff, 0x40, 0x45, 0xfe, 0xff,
-  0x09, 0x46, 0xfe, 0xff, 0xd0, 0x46, 0xfe, 0xff, 0x98, 0x47, 0xfe, 0xff,
-  0x5e, 0x48, 0xfe, 0xff, 0x25, 0x49, 0xfe, 0xff, 0xea, 0x49, 0xfe, 0xff,
-  0xb0, 0x4a, 0xfe, 0xff, 0x74, 0x4b, 0xfe, 0xff, 0x38, 0x4c, 0xfe, 0xff,
-  0xfc, 0x4c, 0xfe, 0xff, 0xbf, 0x4d, 0xfe, 0xff, 0x82, 0x4e, 0xfe, 0xff,
-  0x44, 0x4f, 0xfe, 0xff, 0x06, 0x50, 0xfe, 0xff, 0xc7, 0x50, 0xfe, 0xff,
-  0x88, 0x51, 0xfe, 0xff, 0x48, 0x52, 0xfe, 0xff, 0x07, 0x53, 0xfe, 0xff,
-  0xc6, 0x53, 0xfe, 0xff, 0x85, 0x54, 0xfe, 0xff, 0x43, 0x55, 0xfe, 0xff,
-  0x01, 0x56, 0xfe, 0xff, 0xbe, 0x56, 0xfe, 0xff, 0x7b, 0x57, 0xfe, 0xff,
-  0x37, 0x58, 0xfe, 0xff, 0xf3, 0x58, 0xfe, 0xff, 0xae, 0x59, 0xfe, 0xff,
-  0x69, 0x5a, 0xfe, 0xff, 0x23, 0x5b, 0xfe, 0xff, 0xdd, 0x5b, 0xfe, 0xff,
-  0x97, 0x5c, 0xfe, 0xff, 0x50, 0x5d, 0xfe, 0xff, 0x08, 0x5e, 0xfe, 0xff,
-  0xc0, 0x5e, 0xfe, 0xff, 0x78, 0x5f, 0xfe, 0xff, 0x2f, 0x60, 0xfe, 0xff,
-  0xe6, 0x60, 0xfe, 0xff, 0x9c, 0x61, 0xfe, 0xff, 0x52, 0x62, 0xfe, 0xff,
-  0x07, 0x63, 0xfe, 0xff, 0xbc, 0x63, 0xfe, 0xff, 0x70, 0x64, 0xfe, 0xff,
-  0x24, 0x65, 0xfe, 0xff, 0xd8, 0x65, 0xfe, 0xff, 0x8b, 0x66, 0xfe, 0xff,
-  0x3d, 0x67, 0xfe, 0xff, 0xef, 0x67, 0xfe, 0xff, 0xa1, 0x68, 0xfe, 0xff,
-  0x53, 0x69, 0xfe, 0xff, 0x03, 0x6a, 0xfe, 0xff, 0xb4, 0x6a, 0xfe, 0xff,
-  0x64, 0x6b, 0xfe, 0xff, 0x14, 0x6c, 0xfe, 0xff, 0xc3, 0x6c, 0xfe, 0xff,
-  0x72, 0x6d, 0xfe, 0xff, 0x20, 0x6e, 0xfe, 0xff, 0xce, 0x6e, 0xfe, 0xff,
-  0x7b, 0x6f, 0xfe, 0xff, 0x28, 0x70, 0xfe, 0xff, 0xd5, 0x70, 0xfe, 0xff,
-  0x81, 0x71, 0xfe, 0xff, 0x2d, 0x72, 0xfe, 0xff, 0xd9, 0x72, 0xfe, 0xff,
-  0x84, 0x73, 0xfe, 0xff, 0x2e, 0x74, 0xfe, 0xff, 0xd9, 0x74, 0xfe, 0xff,
-  0x82, 0x75, 0xfe, 0xff, 0x2c, 0x76, 0xfe, 0xff, 0xd5, 0x76, 0xfe, 0xff,
-  0x7e, 0x77, 0xfe, 0xff, 0x26, 0x78, 0xfe, 0xff, 0xce, 0x78, 0xfe, 0xff,
-  0x75, 0x79, 0xfe, 0xff, 0x1c, 0x7a, 0xfe, 0xff, 0xc3, 0x7a, 0xfe, 0xff,
-  0x69, 0x7b, 0xfe, 0xff, 0x0f, 0x7c, 0xfe, 0xff, 0xb4, 0x7c, 0xfe, 0xff,
-  0x5a, 0x7d, 0xfe, 0xff, 0xfe, 0x7d, 0xfe, 0xff, 0xa3, 0x7e, 0xfe, 0xff,
-  0x47, 0x7f, 0xfe, 0xff, 0xea, 0x7f, 0xfe, 0xff, 0x8d, 0x80, 0xfe, 0xff,
-  0x30, 0x81, 0xfe, 0xff, 0xd3, 0x81, 0xfe, 0xff, 0x75, 0x82, 0xfe, 0xff,
-  0x17, 0x83, 0xfe, 0xff, 0xb8, 0x83, 0xfe, 0xff, 0x59, 0x84, 0xfe, 0xff,
-  0xfa, 0x84, 0xfe, 0xff, 0x9a, 0x85, 0xfe, 0xff, 0x3a, 0x86, 0xfe, 0xff,
-  0xd9, 0x86, 0xfe, 0xff, 0x79, 0x87, 0xfe, 0xff, 0x17, 0x88, 0xfe, 0xff,
-  0xb6, 0x88, 0xfe, 0xff, 0x54, 0x89, 0xfe, 0xff, 0xf2, 0x89, 0xfe, 0xff,
-  0x8f, 0x8a, 0xfe, 0xff, 0x2c, 0x8b, 0xfe, 0xff, 0xc9, 0x8b, 0xfe, 0xff,
-  0x65, 0x8c, 0xfe, 0xff, 0x01, 0x8d, 0xfe, 0xff, 0x9d, 0x8d, 0xfe, 0xff,
-  0x38, 0x8e, 0xfe, 0xff, 0xd3, 0x8e, 0xfe, 0xff, 0x6e, 0x8f, 0xfe, 0xff,
-  0x08, 0x90, 0xfe, 0xff, 0xa2, 0x90, 0xfe, 0xff, 0x3c, 0x91, 0xfe, 0xff,
-  0xd5, 0x91, 0xfe, 0xff, 0x6e, 0x92, 0xfe, 0xff, 0x06, 0x93, 0xfe, 0xff,
-  0x9f, 0x93, 0xfe, 0xff, 0x37, 0x94, 0xfe, 0xff, 0xce, 0x94, 0xfe, 0xff,
-  0x66, 0x95, 0xfe, 0xff, 0xfd, 0x95, 0xfe, 0xff, 0x93, 0x96, 0xfe, 0xff,
-  0x29, 0x97, 0xfe, 0xff, 0xbf, 0x97, 0xfe, 0xff, 0x55, 0x98, 0xfe, 0xff,
-  0xea, 0x98, 0xfe, 0xff, 0x7f, 0x99, 0xfe, 0xff, 0x14, 0x9a, 0xfe, 0xff,
-  0xa8, 0x9a, 0xfe, 0xff, 0x3c, 0x9b, 0xfe, 0xff, 0xd0, 0x9b, 0xfe, 0xff,
-  0x64, 0x9c, 0xfe, 0xff, 0xf7, 0x9c, 0xfe, 0xff, 0x8a, 0x9d, 0xfe, 0xff,
-  0x1c, 0x9e, 0xfe, 0xff, 0xae, 0x9e, 0xfe, 0xff, 0x40, 0x9f, 0xfe, 0xff,
-  0xd2, 0x9f, 0xfe, 0xff, 0x63, 0xa0, 0xfe, 0xff, 0xf4, 0xa0, 0xfe, 0xff,
-  0x84, 0xa1, 0xfe, 0xff, 0x15, 0xa2, 0xfe, 0xff, 0xa5, 0xa2, 0xfe, 0xff,
-  0x34, 0xa3, 0xfe, 0xff, 0xc4, 0xa3, 0xfe, 0xff, 0x53, 0xa4, 0xfe, 0xff,
-  0xe2, 0xa4, 0xfe, 0xff, 0x70, 0xa5, 0xfe, 0xff, 0xff, 0xa5, 0xfe, 0xff,
-  0x8d, 0xa6, 0xfe, 0xff, 0x1a, 0xa7, 0xfe, 0xff, 0xa8, 0xa7, 0xfe, 0xff,
-  0x35, 0xa8, 0xfe, 0xff, 0xc1, 0xa8, 0xfe, 0xff, 0x4e, 0xa9, 0xfe, 0xff,
-  0xda, 0xa9, 0xfe, 0xff, 0x66, 0xaa, 0xfe, 0xff, 0xf2, 0xaa, 0xfe, 0xff,
-  0x7d, 0xab, 0xfe, 0xff, 0x08, 0xac, 0xfe, 0xff, 0x93, 0xac, 0xfe, 0xff,
-  0x1d, 0xad, 0xfe, 0xff, 0xa8, 0xad, 0xfe, 0xff, 0x31, 0xae, 0xfe, 0xff,
-  0xbb, 0xae, 0xfe, 0xff, 0x44, 0xaf, 0xfe, 0xff, 0xce, 0xaf, 0xfe, 0xff,
-  0x56, 0xb0, 0xfe, 0xff, 0xdf, 0xb0, 0xfe, 0xff, 0x67, 0xb1, 0xfe, 0xff,
-  0xef, 0xb1, 0xfe, 0xff, 0x77, 0xb2, 0xfe, 0xff, 0xfe, 0xb2, 0xfe, 0xff,
-  0x86, 0xb3, 0xfe, 0xff, 0x0c, 0xb4, 0xfe, 0xff, 0x93, 0xb4, 0xfe, 0xff,
-  0x1a, 0xb5, 0xfe, 0xff, 0xa0, 0xb5, 0xfe, 0xff, 0x25, 0xb6, 0xfe, 0xff,
-  0xab, 0xb6, 0xfe, 0xff, 0x30, 0xb7, 0xfe, 0xff, 0xb5, 0xb7, 0xfe, 0xff,
-  0x3a, 0xb8, 0xfe, 0xff, 0xbf, 0xb8, 0xfe, 0xff, 0x43, 0xb9, 0xfe, 0xff,
-  0xc7, 0xb9, 0xfe, 0xff, 0x4b, 0xba, 0xfe, 0xff, 0xce, 0xba, 0xfe, 0xff,
-  0x52, 0xbb, 0xfe, 0xff, 0xd5, 0xbb, 0xfe, 0xff, 0x57, 0xbc, 0xfe, 0xff,
-  0xda, 0xbc, 0xfe, 0xff, 0x5c, 0xbd, 0xfe, 0xff, 0xde, 0xbd, 0xfe, 0xff,
-  0x60, 0xbe, 0xfe, 0xff, 0xe1, 0xbe, 0xfe, 0xff, 0x62, 0xbf, 0xfe, 0xff,
-  0xe3, 0xbf, 0xfe, 0xff, 0x64, 0xc0, 0xfe, 0xff, 0xe5, 0xc0, 0xfe, 0xff,
-  0x65, 0xc1, 0xfe, 0xff, 0xe5, 0xc1, 0xfe, 0xff, 0x65, 0xc2, 0xfe, 0xff,
-  0xe4, 0xc2, 0xfe, 0xff, 0x63, 0xc3, 0xfe, 0xff, 0xe3, 0xc3, 0xfe, 0xff,
-  0x61, 0xc4, 0xfe, 0xff, 0xe0, 0xc4, 0xfe, 0xff, 0x5e, 0xc5, 0xfe, 0xff,
-  0xdc, 0xc5, 0xfe, 0xff, 0x5a, 0xc6, 0xfe, 0xff, 0xd8, 0xc6, 0xfe, 0xff,
-  0x55, 0xc7, 0xfe, 0xff, 0xd2, 0xc7, 0xfe, 0xff, 0x4f, 0xc8, 0xfe, 0xff,
-  0xcc, 0xc8, 0xfe, 0xff, 0x48, 0xc9, 0xfe, 0xff, 0xc4, 0xc9, 0xfe, 0xff,
-  0x40, 0xca, 0xfe, 0xff, 0xbc, 0xca, 0xfe, 0xff, 0x38, 0xcb, 0xfe, 0xff,
-  0xb3, 0xcb, 0xfe, 0xff, 0x2e, 0xcc, 0xfe, 0xff, 0xa9, 0xcc, 0xfe, 0xff,
-  0x23, 0xcd, 0xfe, 0xff, 0x9e, 0xcd, 0xfe, 0xff, 0x18, 0xce, 0xfe, 0xff,
-  0x92, 0xce, 0xfe, 0xff, 0x0c, 0xcf, 0xfe, 0xff, 0x85, 0xcf, 0xfe, 0xff,
-  0xfe, 0xcf, 0xfe, 0xff, 0x77, 0xd0, 0xfe, 0xff, 0xf0, 0xd0, 0xfe, 0xff,
-  0x69, 0xd1, 0xfe, 0xff, 0xe1, 0xd1, 0xfe, 0xff, 0x59, 0xd2, 0xfe, 0xff,
-  0xd1, 0xd2, 0xfe, 0xff, 0x49, 0xd3, 0xfe, 0xff, 0xc0, 0xd3, 0xfe, 0xff,
-  0x38, 0xd4, 0xfe, 0xff, 0xaf, 0xd4, 0xfe, 0xff, 0x26, 0xd5, 0xfe, 0xff,
-  0x9c, 0xd5, 0xfe, 0xff, 0x13, 0xd6, 0xfe, 0xff, 0x89, 0xd6, 0xfe, 0xff,
-  0xff, 0xd6, 0xfe, 0xff, 0x75, 0xd7, 0xfe, 0xff, 0xeb, 0xd7, 0xfe, 0xff,
-  0x60, 0xd8, 0xfe, 0xff, 0xd5, 0xd8, 0xfe, 0xff, 0x4a, 0xd9, 0xfe, 0xff,
-  0xbf, 0xd9, 0xfe, 0xff, 0x33, 0xda, 0xfe, 0xff, 0xa8, 0xda, 0xfe, 0xff,
-  0x1c, 0xdb, 0xfe, 0xff, 0x90, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfe, 0xff,
-  0x77, 0xdc, 0xfe, 0xff, 0xeb, 0xdc, 0xfe, 0xff, 0x5e, 0xdd, 0xfe, 0xff,
-  0xd1, 0xdd, 0xfe, 0xff, 0x44, 0xde, 0xfe, 0xff, 0xb6, 0xde, 0xfe, 0xff,
-  0x28, 0xdf, 0xfe, 0xff, 0x9b, 0xdf, 0xfe, 0xff, 0x0d, 0xe0, 0xfe, 0xff,
-  0x7e, 0xe0, 0xfe, 0xff, 0xf0, 0xe0, 0xfe, 0xff, 0x61, 0xe1, 0xfe, 0xff,
-  0xd2, 0xe1, 0xfe, 0xff, 0x43, 0xe2, 0xfe, 0xff, 0xb4, 0xe2, 0xfe, 0xff,
-  0x25, 0xe3, 0xfe, 0xff, 0x95, 0xe3, 0xfe, 0xff, 0x05, 0xe4, 0xfe, 0xff,
-  0x75, 0xe4, 0xfe, 0xff, 0xe5, 0xe4, 0xfe, 0xff, 0x55, 0xe5, 0xfe, 0xff,
-  0xc4, 0xe5, 0xfe, 0xff, 0x34, 0xe6, 0xfe, 0xff, 0xa3, 0xe6, 0xfe, 0xff,
-  0x12, 0xe7, 0xfe, 0xff, 0x80, 0xe7, 0xfe, 0xff, 0xef, 0xe7, 0xfe, 0xff,
-  0x5d, 0xe8, 0xfe, 0xff, 0xcb, 0xe8, 0xfe, 0xff, 0x39, 0xe9, 0xfe, 0xff,
-  0xa7, 0xe9, 0xfe, 0xff, 0x15, 0xea, 0xfe, 0xff, 0x82, 0xea, 0xfe, 0xff,
-  0xef, 0xea, 0xfe, 0xff, 0x5c, 0xeb, 0xfe, 0xff, 0xc9, 0xeb, 0xfe, 0xff,
-  0x36, 0xec, 0xfe, 0xff, 0xa2, 0xec, 0xfe, 0xff, 0x0f, 0xed, 0xfe, 0xff,
-  0x7b, 0xed, 0xfe, 0xff, 0xe7, 0xed, 0xfe, 0xff, 0x53, 0xee, 0xfe, 0xff,
-  0xbe, 0xee, 0xfe, 0xff, 0x2a, 0xef, 0xfe, 0xff, 0x95, 0xef, 0xfe, 0xff,
-  0x00, 0xf0, 0xfe, 0xff, 0x6b, 0xf0, 0xfe, 0xff, 0xd6, 0xf0, 0xfe, 0xff,
-  0x40, 0xf1, 0xfe, 0xff, 0xab, 0xf1, 0xfe, 0xff, 0x15, 0xf2, 0xfe, 0xff,
-  0x7f, 0xf2, 0xfe, 0xff, 0xe9, 0xf2, 0xfe, 0xff, 0x53, 0xf3, 0xfe, 0xff,
-  0xbc, 0xf3, 0xfe, 0xff, 0x26, 0xf4, 0xfe, 0xff, 0x8f, 0xf4, 0xfe, 0xff,
-  0xf8, 0xf4, 0xfe, 0xff, 0x61, 0xf5, 0xfe, 0xff, 0xc9, 0xf5, 0xfe, 0xff,
-  0x32, 0xf6, 0xfe, 0xff, 0x9a, 0xf6, 0xfe, 0xff, 0x03, 0xf7, 0xfe, 0xff,
-  0x6b, 0xf7, 0xfe, 0xff, 0xd3, 0xf7, 0xfe, 0xff, 0x3a, 0xf8, 0xfe, 0xff,
-  0xa2, 0xf8, 0xfe, 0xff, 0x09, 0xf9, 0xfe, 0xff, 0x70, 0xf9, 0xfe, 0xff,
-  0xd7, 0xf9, 0xfe, 0xff, 0x3e, 0xfa, 0xfe, 0xff, 0xa5, 0xfa, 0xfe, 0xff,
-  0x0c, 0xfb, 0xfe, 0xff, 0x72, 0xfb, 0xfe, 0xff, 0xd8, 0xfb, 0xfe, 0xff,
-  0x3e, 0xfc, 0xfe, 0xff, 0xa4, 0xfc, 0xfe, 0xff, 0x0a, 0xfd, 0xfe, 0xff,
-  0x70, 0xfd, 0xfe, 0xff, 0xd5, 0xfd, 0xfe, 0xff, 0x3b, 0xfe, 0xfe, 0xff,
-  0xa0, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xfe, 0xff, 0x6a, 0xff, 0xfe, 0xff,
-  0xce, 0xff, 0xfe, 0xff, 0x33, 0x00, 0xff, 0xff, 0x97, 0x00, 0xff, 0xff,
-  0xfb, 0x00, 0xff, 0xff, 0x5f, 0x01, 0xff, 0xff, 0xc3, 0x01, 0xff, 0xff,
-  0x27, 0x02, 0xff, 0xff, 0x8b, 0x02, 0xff, 0xff, 0xee, 0x02, 0xff, 0xff,
-  0x51, 0x03, 0xff, 0xff, 0xb5, 0x03, 0xff, 0xff, 0x18, 0x04, 0xff, 0xff,
-  0x7b, 0x04, 0xff, 0xff, 0xdd, 0x04, 0xff, 0xff, 0x40, 0x05, 0xff, 0xff,
-  0xa2, 0x05, 0xff, 0xff, 0x04, 0x06, 0xff, 0xff, 0x67, 0x06, 0xff, 0xff,
-  0xc9, 0x06, 0xff, 0xff, 0x2a, 0x07, 0xff, 0xff, 0x8c, 0x07, 0xff, 0xff,
-  0xee, 0x07, 0xff, 0xff, 0x4f, 0x08, 0xff, 0xff, 0xb0, 0x08, 0xff, 0xff,
-  0x11, 0x09, 0xff, 0xff, 0x72, 0x09, 0xff, 0xff, 0xd3, 0x09, 0xff, 0xff,
-  0x34, 0x0a, 0xff, 0xff, 0x94, 0x0a, 0xff, 0xff, 0xf5, 0x0a, 0xff, 0xff,
-  0x55, 0x0b, 0xff, 0xff, 0xb5, 0x0b, 0xff, 0xff, 0x15, 0x0c, 0xff, 0xff,
-  0x75, 0x0c, 0xff, 0xff, 0xd5, 0x0c, 0xff, 0xff, 0x34, 0x0d, 0xff, 0xff,
-  0x94, 0x0d, 0xff, 0xff, 0xf3, 0x0d, 0xff, 0xff, 0x52, 0x0e, 0xff, 0xff,
-  0xb1, 0x0e, 0xff, 0xff, 0x10, 0x0f, 0xff, 0xff, 0x6f, 0x0f, 0xff, 0xff,
-  0xcd, 0x0f, 0xff, 0xff, 0x2c, 0x10, 0xff, 0xff, 0x8a, 0x10, 0xff, 0xff,
-  0xe8, 0x10, 0xff, 0xff, 0x46, 0x11, 0xff, 0xff, 0xa4, 0x11, 0xff, 0xff,
-  0x02, 0x12, 0xff, 0xff, 0x5f, 0x12, 0xff, 0xff, 0xbd, 0x12, 0xff, 0xff,
-  0x1a, 0x13, 0xff, 0xff, 0x78, 0x13, 0xff, 0xff, 0xd5, 0x13, 0xff, 0xff,
-  0x32, 0x14, 0xff, 0xff, 0x8f, 0x14, 0xff, 0xff, 0xeb, 0x14, 0xff, 0xff,
-  0x48, 0x15, 0xff, 0xff, 0xa4, 0x15, 0xff, 0xff, 0x01, 0x16, 0xff, 0xff,
-  0x5d, 0x16, 0xff, 0xff, 0xb9, 0x16, 0xff, 0xff, 0x15, 0x17, 0xff, 0xff,
-  0x71, 0x17, 0xff, 0xff, 0xcc, 0x17, 0xff, 0xff, 0x28, 0x18, 0xff, 0xff,
-  0x83, 0x18, 0xff, 0xff, 0xdf, 0x18, 0xff, 0xff, 0x3a, 0x19, 0xff, 0xff,
-  0x95, 0x19, 0xff, 0xff, 0xf0, 0x19, 0xff, 0xff, 0x4b, 0x1a, 0xff, 0xff,
-  0xa5, 0x1a, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x5a, 0x1b, 0xff, 0xff,
-  0xb5, 0x1b, 0xff, 0xff, 0x0f, 0x1c, 0xff, 0xff, 0x69, 0x1c, 0xff, 0xff,
-  0xc3, 0x1c, 0xff, 0xff, 0x1d, 0x1d, 0xff, 0xff, 0x76, 0x1d, 0xff, 0xff,
-  0xd0, 0x1d, 0xff, 0xff, 0x29, 0x1e, 0xff, 0xff, 0x83, 0x1e, 0xff, 0xff,
-  0xdc, 0x1e, 0xff, 0xff, 0x35, 0x1f, 0xff, 0xff, 0x8e, 0x1f, 0xff, 0xff,
-  0xe7, 0x1f, 0xff, 0xff, 0x3f, 0x20, 0xff, 0xff, 0x98, 0x20, 0xff, 0xff,
-  0xf0, 0x20, 0xff, 0xff, 0x49, 0x21, 0xff, 0xff, 0xa1, 0x21, 0xff, 0xff,
-  0xf9, 0x21, 0xff, 0xff, 0x51, 0x22, 0xff, 0xff, 0xa9, 0x22, 0xff, 0xff,
-  0x01, 0x23, 0xff, 0xff, 0x59, 0x23, 0xff, 0xff, 0xb0, 0x23, 0xff, 0xff,
-  0x08, 0x24, 0xff, 0xff, 0x5f, 0x24, 0xff, 0xff, 0xb6, 0x24, 0xff, 0xff,
-  0x0d, 0x25, 0xff, 0xff, 0x64, 0x25, 0xff, 0xff, 0xbb, 0x25, 0xff, 0xff,
-  0x12, 0x26, 0xff, 0xff, 0x68, 0x26, 0xff, 0xff, 0xbf, 0x26, 0xff, 0xff,
-  0x15, 0x27, 0xff, 0xff, 0x6c, 0x27, 0xff, 0xff, 0xc2, 0x27, 0xff, 0xff,
-  0x18, 0x28, 0xff, 0xff, 0x6e, 0x28, 0xff, 0xff, 0xc4, 0x28, 0xff, 0xff,
-  0x19, 0x29, 0xff, 0xff, 0x6f, 0x29, 0xff, 0xff, 0xc5, 0x29, 0xff, 0xff,
-  0x1a, 0x2a, 0xff, 0xff, 0x6f, 0x2a, 0xff, 0xff, 0xc5, 0x2a, 0xff, 0xff,
-  0x1a, 0x2b, 0xff, 0xff, 0x6f, 0x2b, 0xff, 0xff, 0xc3, 0x2b, 0xff, 0xff,
-  0x18, 0x2c, 0xff, 0xff, 0x6d, 0x2c, 0xff, 0xff, 0xc1, 0x2c, 0xff, 0xff,
-  0x16, 0x2d, 0xff, 0xff, 0x6a, 0x2d, 0xff, 0xff, 0xbe, 0x2d, 0xff, 0xff,
-  0x13, 0x2e, 0xff, 0xff, 0x67, 0x2e, 0xff, 0xff, 0xba, 0x2e, 0xff, 0xff,
-  0x0e, 0x2f, 0xff, 0xff, 0x62, 0x2f, 0xff, 0xff, 0xb6, 0x2f, 0xff, 0xff,
-  0x09, 0x30, 0xff, 0xff, 0x5c, 0x30, 0xff, 0xff, 0xb0, 0x30, 0xff, 0xff,
-  0x03, 0x31, 0xff, 0xff, 0x56, 0x31, 0xff, 0xff, 0xa9, 0x31, 0xff, 0xff,
-  0xfc, 0x31, 0xff, 0xff, 0x4f, 0x32, 0xff, 0xff, 0xa1, 0x32, 0xff, 0xff,
-  0xf4, 0x32, 0xff, 0xff, 0x46, 0x33, 0xff, 0xff, 0x99, 0x33, 0xff, 0xff,
-  0xeb, 0x33, 0xff, 0xff, 0x3d, 0x34, 0xff, 0xff, 0x8f, 0x34, 0xff, 0xff,
-  0xe1, 0x34, 0xff, 0xff, 0x33, 0x35, 0xff, 0xff, 0x85, 0x35, 0xff, 0xff,
-  0xd6, 0x35, 0xff, 0xff, 0x28, 0x36, 0xff, 0xff, 0x79, 0x36, 0xff, 0xff,
-  0xcb, 0x36, 0xff, 0xff, 0x1c, 0x37, 0xff, 0xff, 0x6d, 0x37, 0xff, 0xff,
-  0xbe, 0x37, 0xff, 0xff, 0x0f, 0x38, 0xff, 0xff, 0x60, 0x38, 0xff, 0xff,
-  0xb1, 0x38, 0xff, 0xff, 0x02, 0x39, 0xff, 0xff, 0x52, 0x39, 0xff, 0xff,
-  0xa3, 0x39, 0xff, 0xff, 0xf3, 0x39, 0xff, 0xff, 0x43, 0x3a, 0xff, 0xff,
-  0x94, 0x3a, 0xff, 0xff, 0xe4, 0x3a, 0xff, 0xff, 0x34, 0x3b, 0xff, 0xff,
-  0x84, 0x3b, 0xff, 0xff, 0xd3, 0x3b, 0xff, 0xff, 0x23, 0x3c, 0xff, 0xff,
-  0x73, 0x3c, 0xff, 0xff, 0xc2, 0x3c, 0xff, 0xff, 0x12, 0x3d, 0xff, 0xff,
-  0x61, 0x3d, 0xff, 0xff, 0xb0, 0x3d, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff,
-  0x4f, 0x3e, 0xff, 0xff, 0x9e, 0x3e, 0xff, 0xff, 0xed, 0x3e, 0xff, 0xff,
-  0x3b, 0x3f, 0xff, 0xff, 0x8a, 0x3f, 0xff, 0xff, 0xd9, 0x3f, 0xff, 0xff,
-  0x27, 0x40, 0xff, 0xff, 0x76, 0x40, 0xff, 0xff, 0xc4, 0x40, 0xff, 0xff,
-  0x12, 0x41, 0xff, 0xff, 0x61, 0x41, 0xff, 0xff, 0xaf, 0x41, 0xff, 0xff,
-  0xfd, 0x41, 0xff, 0xff, 0x4b, 0x42, 0xff, 0xff, 0x98, 0x42, 0xff, 0xff,
-  0xe6, 0x42, 0xff, 0xff, 0x34, 0x43, 0xff, 0xff, 0x81, 0x43, 0xff, 0xff,
-  0xcf, 0x43, 0xff, 0xff, 0x1c, 0x44, 0xff, 0xff, 0x6a, 0x44, 0xff, 0xff,
-  0xb7, 0x44, 0xff, 0xff, 0x04, 0x45, 0xff, 0xff, 0x51, 0x45, 0xff, 0xff,
-  0x9e, 0x45, 0xff, 0xff, 0xeb, 0x45, 0xff, 0xff, 0x38, 0x46, 0xff, 0xff,
-  0x84, 0x46, 0xff, 0xff, 0xd1, 0x46, 0xff, 0xff, 0x1d, 0x47, 0xff, 0xff,
-  0x6a, 0x47, 0xff, 0xff, 0xb6, 0x47, 0xff, 0xff, 0x02, 0x48, 0xff, 0xff,
-  0x4f, 0x48, 0xff, 0xff, 0x9b, 0x48, 0xff, 0xff, 0xe7, 0x48, 0xff, 0xff,
-  0x33, 0x49, 0xff, 0xff, 0x7f, 0x49, 0xff, 0xff, 0xca, 0x49, 0xff, 0xff,
-  0x16, 0x4a, 0xff, 0xff, 0x62, 0x4a, 0xff, 0xff, 0xad, 0x4a, 0xff, 0xff,
-  0xf9, 0x4a, 0xff, 0xff, 0x44, 0x4b, 0xff, 0xff, 0x8f, 0x4b, 0xff, 0xff,
-  0xda, 0x4b, 0xff, 0xff, 0x26, 0x4c, 0xff, 0xff, 0x71, 0x4c, 0xff, 0xff,
-  0xbc, 0x4c, 0xff, 0xff, 0x06, 0x4d, 0xff, 0xff, 0x51, 0x4d, 0xff, 0xff,
-  0x9c, 0x4d, 0xff, 0xff, 0xe7, 0x4d, 0xff, 0xff, 0x31, 0x4e, 0xff, 0xff,
-  0x7c, 0x4e, 0xff, 0xff, 0xc6, 0x4e, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xff,
-  0x5b, 0x4f, 0xff, 0xff, 0xa5, 0x4f, 0xff, 0xff, 0xef, 0x4f, 0xff, 0xff,
-  0x39, 0x50, 0xff, 0xff, 0x83, 0x50, 0xff, 0xff, 0xcd, 0x50, 0xff, 0xff,
-  0x16, 0x51, 0xff, 0xff, 0x60, 0x51, 0xff, 0xff, 0xaa, 0x51, 0xff, 0xff,
-  0xf3, 0x51, 0xff, 0xff, 0x3d, 0x52, 0xff, 0xff, 0x86, 0x52, 0xff, 0xff,
-  0xcf, 0x52, 0xff, 0xff, 0x19, 0x53, 0xff, 0xff, 0x62, 0x53, 0xff, 0xff,
-  0xab, 0x53, 0xff, 0xff, 0xf4, 0x53, 0xff, 0xff, 0x3d, 0x54, 0xff, 0xff,
-  0x86, 0x54, 0xff, 0xff, 0xce, 0x54, 0xff, 0xff, 0x17, 0x55, 0xff, 0xff,
-  0x60, 0x55, 0xff, 0xff, 0xa8, 0x55, 0xff, 0xff, 0xf1, 0x55, 0xff, 0xff,
-  0x39, 0x56, 0xff, 0xff, 0x82, 0x56, 0xff, 0xff, 0xca, 0x56, 0xff, 0xff,
-  0x12, 0x57, 0xff, 0xff, 0x5a, 0x57, 0xff, 0xff, 0xa2, 0x57, 0xff, 0xff,
-  0xea, 0x57, 0xff, 0xff, 0x32, 0x58, 0xff, 0xff, 0x7a, 0x58, 0xff, 0xff,
-  0xc2, 0x58, 0xff, 0xff, 0x09, 0x59, 0xff, 0xff, 0x51, 0x59, 0xff, 0xff,
-  0x98, 0x59, 0xff, 0xff, 0xe0, 0x59, 0xff, 0xff, 0x27, 0x5a, 0xff, 0xff,
-  0x6f, 0x5a, 0xff, 0xff, 0xb6, 0x5a, 0xff, 0xff, 0xfd, 0x5a, 0xff, 0xff,
-  0x44, 0x5b, 0xff, 0xff, 0x8b, 0x5b, 0xff, 0xff, 0xd2, 0x5b, 0xff, 0xff,
-  0x19, 0x5c, 0xff, 0xff, 0x60, 0x5c, 0xff, 0xff, 0xa7, 0x5c, 0xff, 0xff,
-  0xed, 0x5c, 0xff, 0xff, 0x34, 0x5d, 0xff, 0xff, 0x7b, 0x5d, 0xff, 0xff,
-  0xc1, 0x5d, 0xff, 0xff, 0x07, 0x5e, 0xff, 0xff, 0x4e, 0x5e, 0xff, 0xff,
-  0x94, 0x5e, 0xff, 0xff, 0xda, 0x5e, 0xff, 0xff, 0x20, 0x5f, 0xff, 0xff,
-  0x67, 0x5f, 0xff, 0xff, 0xad, 0x5f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff,
-  0x38, 0x60, 0xff, 0xff, 0x7e, 0x60, 0xff, 0xff, 0xc4, 0x60, 0xff, 0xff,
-  0x0a, 0x61, 0xff, 0xff, 0x4f, 0x61, 0xff, 0xff, 0x95, 0x61, 0xff, 0xff,
-  0xda, 0x61, 0xff, 0xff, 0x20, 0x62, 0xff, 0xff, 0x65, 0x62, 0xff, 0xff,
-  0xaa, 0x62, 0xff, 0xff, 0xf0, 0x62, 0xff, 0xff, 0x35, 0x63, 0xff, 0xff,
-  0x7a, 0x63, 0xff, 0xff, 0xbf, 0x63, 0xff, 0xff, 0x04, 0x64, 0xff, 0xff,
-  0x49, 0x64, 0xff, 0xff, 0x8e, 0x64, 0xff, 0xff, 0xd2, 0x64, 0xff, 0xff,
-  0x17, 0x65, 0xff, 0xff, 0x5c, 0x65, 0xff, 0xff, 0xa0, 0x65, 0xff, 0xff,
-  0xe5, 0x65, 0xff, 0xff, 0x29, 0x66, 0xff, 0xff, 0x6e, 0x66, 0xff, 0xff,
-  0xb2, 0x66, 0xff, 0xff, 0xf6, 0x66, 0xff, 0xff, 0x3a, 0x67, 0xff, 0xff,
-  0x7e, 0x67, 0xff, 0xff, 0xc3, 0x67, 0xff, 0xff, 0x07, 0x68, 0xff, 0xff,
-  0x4b, 0x68, 0xff, 0xff, 0x8e, 0x68, 0xff, 0xff, 0xd2, 0x68, 0xff, 0xff,
-  0x16, 0x69, 0xff, 0xff, 0x5a, 0x69, 0xff, 0xff, 0x9d, 0x69, 0xff, 0xff,
-  0xe1, 0x69, 0xff, 0xff, 0x24, 0x6a, 0xff, 0xff, 0x68, 0x6a, 0xff, 0xff,
-  0xab, 0x6a, 0xff, 0xff, 0xef, 0x6a, 0xff, 0xff, 0x32, 0x6b, 0xff, 0xff,
-  0x75, 0x6b, 0xff, 0xff, 0xb8, 0x6b, 0xff, 0xff, 0xfb, 0x6b, 0xff, 0xff,
-  0x3e, 0x6c, 0xff, 0xff, 0x81, 0x6c, 0xff, 0xff, 0xc4, 0x6c, 0xff, 0xff,
-  0x07, 0x6d, 0xff, 0xff, 0x4a, 0x6d, 0xff, 0xff, 0x8d, 0x6d, 0xff, 0xff,
-  0xcf, 0x6d, 0xff, 0xff, 0x12, 0x6e, 0xff, 0xff, 0x55, 0x6e, 0xff, 0xff,
-  0x97, 0x6e, 0xff, 0xff, 0xda, 0x6e, 0xff, 0xff, 0x1c, 0x6f, 0xff, 0xff,
-  0x5e, 0x6f, 0xff, 0xff, 0xa1, 0x6f, 0xff, 0xff, 0xe3, 0x6f, 0xff, 0xff,
-  0x25, 0x70, 0xff, 0xff, 0x67, 0x70, 0xff, 0xff, 0xa9, 0x70, 0xff, 0xff,
-  0xeb, 0x70, 0xff, 0xff, 0x2d, 0x71, 0xff, 0xff, 0x6f, 0x71, 0xff, 0xff,
-  0xb1, 0x71, 0xff, 0xff, 0xf3, 0x71, 0xff, 0xff, 0x34, 0x72, 0xff, 0xff,
-  0x76, 0x72, 0xff, 0xff, 0xb8, 0x72, 0xff, 0xff, 0xf9, 0x72, 0xff, 0xff,
-  0x3b, 0x73, 0xff, 0xff, 0x7c, 0x73, 0xff, 0xff, 0xbd, 0x73, 0xff, 0xff,
-  0xff, 0x73, 0xff, 0xff, 0x40, 0x74, 0xff, 0xff, 0x81, 0x74, 0xff, 0xff,
-  0xc2, 0x74, 0xff, 0xff, 0x04, 0x75, 0xff, 0xff, 0x45, 0x75, 0xff, 0xff,
-  0x86, 0x75, 0xff, 0xff, 0xc7, 0x75, 0xff, 0xff, 0x07, 0x76, 0xff, 0xff,
-  0x48, 0x76, 0xff, 0xff, 0x89, 0x76, 0xff, 0xff, 0xca, 0x76, 0xff, 0xff,
-  0x0a, 0x77, 0xff, 0xff, 0x4b, 0x77, 0xff, 0xff, 0x8c, 0x77, 0xff, 0xff,
-  0xcc, 0x77, 0xff, 0xff, 0x0d, 0x78, 0xff, 0xff, 0x4d, 0x78, 0xff, 0xff,
-  0x8d, 0x78, 0xff, 0xff, 0xce, 0x78, 0xff, 0xff, 0x0e, 0x79, 0xff, 0xff,
-  0x4e, 0x79, 0xff, 0xff, 0x8e, 0x79, 0xff, 0xff, 0xce, 0x79, 0xff, 0xff,
-  0x0f, 0x7a, 0xff, 0xff, 0x4f, 0x7a, 0xff, 0xff, 0x8e, 0x7a, 0xff, 0xff,
-  0xce, 0x7a, 0xff, 0xff, 0x0e, 0x7b, 0xff, 0xff, 0x4e, 0x7b, 0xff, 0xff,
-  0x8e, 0x7b, 0xff, 0xff, 0xcd, 0x7b, 0xff, 0xff, 0x0d, 0x7c, 0xff, 0xff,
-  0x4d, 0x7c, 0xff, 0xff, 0x8c, 0x7c, 0xff, 0xff, 0xcc, 0x7c, 0xff, 0xff,
-  0x0b, 0x7d, 0xff, 0xff, 0x4b, 0x7d, 0xff, 0xff, 0x8a, 0x7d, 0xff, 0xff,
-  0xc9, 0x7d, 0xff, 0xff, 0x08, 0x7e, 0xff, 0xff, 0x48, 0x7e, 0xff, 0xff,
-  0x87, 0x7e, 0xff, 0xff, 0xc6, 0x7e, 0xff, 0xff, 0x05, 0x7f, 0xff, 0xff,
-  0x44, 0x7f, 0xff, 0xff, 0x83, 0x7f, 0xff, 0xff, 0xc2, 0x7f, 0xff, 0xff,
-  0x01, 0x80, 0xff, 0xff, 0x3f, 0x80, 0xff, 0xff, 0x7e, 0x80, 0xff, 0xff,
-  0xbd, 0x80, 0xff, 0xff, 0xfc, 0x80, 0xff, 0xff, 0x3a, 0x81, 0xff, 0xff,
-  0x79, 0x81, 0xff, 0xff, 0xb7, 0x81, 0xff, 0xff, 0xf6, 0x81, 0xff, 0xff,
-  0x34, 0x82, 0xff, 0xff, 0x73, 0x82, 0xff, 0xff, 0xb1, 0x82, 0xff, 0xff,
-  0xef, 0x82, 0xff, 0xff, 0x2d, 0x83, 0xff, 0xff, 0x6c, 0x83, 0xff, 0xff,
-  0xaa, 0x83, 0xff, 0xff, 0xe8, 0x83, 0xff, 0xff, 0x26, 0x84, 0xff, 0xff,
-  0x64, 0x84, 0xff, 0xff, 0xa2, 0x84, 0xff, 0xff, 0xe0, 0x84, 0xff, 0xff,
-  0x1e, 0x85, 0xff, 0xff, 0x5c, 0x85, 0xff, 0xff, 0x99, 0x85, 0xff, 0xff,
-  0xd7, 0x85, 0xff, 0xff, 0x15, 0x86, 0xff, 0xff, 0x52, 0x86, 0xff, 0xff,
-  0x90, 0x86, 0xff, 0xff, 0xce, 0x86, 0xff, 0xff, 0x0b, 0x87, 0xff, 0xff,
-  0x48, 0x87, 0xff, 0xff, 0x86, 0x87, 0xff, 0xff, 0xc3, 0x87, 0xff, 0xff,
-  0x01, 0x88, 0xff, 0xff, 0x3e, 0x88, 0xff, 0xff, 0x7b, 0x88, 0xff, 0xff,
-  0xb8, 0x88, 0xff, 0xff, 0xf6, 0x88, 0xff, 0xff, 0x33, 0x89, 0xff, 0xff,
-  0x70, 0x89, 0xff, 0xff, 0xad, 0x89, 0xff, 0xff, 0xea, 0x89, 0xff, 0xff,
-  0x27, 0x8a, 0xff, 0xff, 0x64, 0x8a, 0xff, 0xff, 0xa0, 0x8a, 0xff, 0xff,
-  0xdd, 0x8a, 0xff, 0xff, 0x1a, 0x8b, 0xff, 0xff, 0x57, 0x8b, 0xff, 0xff,
-  0x93, 0x8b, 0xff, 0xff, 0xd0, 0x8b, 0xff, 0xff, 0x0d, 0x8c, 0xff, 0xff,
-  0x49, 0x8c, 0xff, 0xff, 0x86, 0x8c, 0xff, 0xff, 0xc2, 0x8c, 0xff, 0xff,
-  0xff, 0x8c, 0xff, 0xff, 0x3b, 0x8d, 0xff, 0xff, 0x77, 0x8d, 0xff, 0xff,
-  0xb4, 0x8d, 0xff, 0xff, 0xf0, 0x8d, 0xff, 0xff, 0x2c, 0x8e, 0xff, 0xff,
-  0x68, 0x8e, 0xff, 0xff, 0xa4, 0x8e, 0xff, 0xff, 0xe1, 0x8e, 0xff, 0xff,
-  0x1d, 0x8f, 0xff, 0xff, 0x59, 0x8f, 0xff, 0xff, 0x95, 0x8f, 0xff, 0xff,
-  0xd1, 0x8f, 0xff, 0xff, 0x0c, 0x90, 0xff, 0xff, 0x48, 0x90, 0xff, 0xff,
-  0x84, 0x90, 0xff, 0xff, 0xc0, 0x90, 0xff, 0xff, 0xfc, 0x90, 0xff, 0xff,
-  0x37, 0x91, 0xff, 0xff, 0x73, 0x91, 0xff, 0xff, 0xaf, 0x91, 0xff, 0xff,
-  0xea, 0x91, 0xff, 0xff, 0x26, 0x92, 0xff, 0xff, 0x61, 0x92, 0xff, 0xff,
-  0x9d, 0x92, 0xff, 0xff, 0xd8, 0x92, 0xff, 0xff, 0x14, 0x93, 0xff, 0xff,
-  0x4f, 0x93, 0xff, 0xff, 0x8a, 0x93, 0xff, 0xff, 0xc5, 0x93, 0xff, 0xff,
-  0x01, 0x94, 0xff, 0xff, 0x3c, 0x94, 0xff, 0xff, 0x77, 0x94, 0xff, 0xff,
-  0xb2, 0x94, 0xff, 0xff, 0xed, 0x94, 0xff, 0xff, 0x28, 0x95, 0xff, 0xff,
-  0x63, 0x95, 0xff, 0xff, 0x9e, 0x95, 0xff, 0xff, 0xd9, 0x95, 0xff, 0xff,
-  0x14, 0x96, 0xff, 0xff, 0x4f, 0x96, 0xff, 0xff, 0x8a, 0x96, 0xff, 0xff,
-  0xc4, 0x96, 0xff, 0xff, 0xff, 0x96, 0xff, 0xff, 0x3a, 0x97, 0xff, 0xff,
-  0x75, 0x97, 0xff, 0xff, 0xaf, 0x97, 0xff, 0xff, 0xea, 0x97, 0xff, 0xff,
-  0x24, 0x98, 0xff, 0xff, 0x5f, 0x98, 0xff, 0xff, 0x99, 0x98, 0xff, 0xff,
-  0xd4, 0x98, 0xff, 0xff, 0x0e, 0x99, 0xff, 0xff, 0x49, 0x99, 0xff, 0xff,
-  0x83, 0x99, 0xff, 0xff, 0xbd, 0x99, 0xff, 0xff, 0xf8, 0x99, 0xff, 0xff,
-  0x32, 0x9a, 0xff, 0xff, 0x6c, 0x9a, 0xff, 0xff, 0xa6, 0x9a, 0xff, 0xff,
-  0xe0, 0x9a, 0xff, 0xff, 0x1a, 0x9b, 0xff, 0xff, 0x54, 0x9b, 0xff, 0xff,
-  0x8e, 0x9b, 0xff, 0xff, 0xc8, 0x9b, 0xff, 0xff, 0x02, 0x9c, 0xff, 0xff,
-  0x3c, 0x9c, 0xff, 0xff, 0x76, 0x9c, 0xff, 0xff, 0xb0, 0x9c, 0xff, 0xff,
-  0xea, 0x9c, 0xff, 0xff, 0x24, 0x9d, 0xff, 0xff, 0x5d, 0x9d, 0xff, 0xff,
-  0x97, 0x9d, 0xff, 0xff, 0xd1, 0x9d, 0xff, 0xff, 0x0a, 0x9e, 0xff, 0xff,
-  0x44, 0x9e, 0xff, 0xff, 0x7e, 0x9e, 0xff, 0xff, 0xb7, 0x9e, 0xff, 0xff,
-  0xf1, 0x9e, 0xff, 0xff, 0x2a, 0x9f, 0xff, 0xff, 0x64, 0x9f, 0xff, 0xff,
-  0x9d, 0x9f, 0xff, 0xff, 0xd6, 0x9f, 0xff, 0xff, 0x10, 0xa0, 0xff, 0xff,
-  0x49, 0xa0, 0xff, 0xff, 0x82, 0xa0, 0xff, 0xff, 0xbb, 0xa0, 0xff, 0xff,
-  0xf5, 0xa0, 0xff, 0xff, 0x2e, 0xa1, 0xff, 0xff, 0x67, 0xa1, 0xff, 0xff,
-  0xa0, 0xa1, 0xff, 0xff, 0xd9, 0xa1, 0xff, 0xff, 0x12, 0xa2, 0xff, 0xff,
-  0x4b, 0xa2, 0xff, 0xff, 0x84, 0xa2, 0xff, 0xff, 0xbd, 0xa2, 0xff, 0xff,
-  0xf6, 0xa2, 0xff, 0xff, 0x2f, 0xa3, 0xff, 0xff, 0x68, 0xa3, 0xff, 0xff,
-  0xa1, 0xa3, 0xff, 0xff, 0xd9, 0xa3, 0xff, 0xff, 0x12, 0xa4, 0xff, 0xff,
-  0x4b, 0xa4, 0xff, 0xff, 0x84, 0xa4, 0xff, 0xff, 0xbc, 0xa4, 0xff, 0xff,
-  0xf5, 0xa4, 0xff, 0xff, 0x2e, 0xa5, 0xff, 0xff, 0x66, 0xa5, 0xff, 0xff,
-  0x9f, 0xa5, 0xff, 0xff, 0xd7, 0xa5, 0xff, 0xff, 0x10, 0xa6, 0xff, 0xff,
-  0x48, 0xa6, 0xff, 0xff, 0x81, 0xa6, 0xff, 0xff, 0xb9, 0xa6, 0xff, 0xff,
-  0xf1, 0xa6, 0xff, 0xff, 0x2a, 0xa7, 0xff, 0xff, 0x62, 0xa7, 0xff, 0xff,
-  0x9a, 0xa7, 0xff, 0xff, 0xd3, 0xa7, 0xff, 0xff, 0x0b, 0xa8, 0xff, 0xff,
-  0x43, 0xa8, 0xff, 0xff, 0x7b, 0xa8, 0xff, 0xff, 0xb3, 0xa8, 0xff, 0xff,
-  0xeb, 0xa8, 0xff, 0xff, 0x23, 0xa9, 0xff, 0xff, 0x5b, 0xa9, 0xff, 0xff,
-  0x93, 0xa9, 0xff, 0xff, 0xcb, 0xa9, 0xff, 0xff, 0x03, 0xaa, 0xff, 0xff,
-  0x3b, 0xaa, 0xff, 0xff, 0x73, 0xaa, 0xff, 0xff, 0xab, 0xaa, 0xff, 0xff,
-  0xe3, 0xaa, 0xff, 0xff, 0x1b, 0xab, 0xff, 0xff, 0x52, 0xab, 0xff, 0xff,
-  0x8a, 0xab, 0xff, 0xff, 0xc2, 0xab, 0xff, 0xff, 0xfa, 0xab, 0xff, 0xff,
-  0x31, 0xac, 0xff, 0xff, 0x69, 0xac, 0xff, 0xff, 0xa1, 0xac, 0xff, 0xff,
-  0xd8, 0xac, 0xff, 0xff, 0x10, 0xad, 0xff, 0xff, 0x47, 0xad, 0xff, 0xff,
-  0x7f, 0xad, 0xff, 0xff, 0xb6, 0xad, 0xff, 0xff, 0xee, 0xad, 0xff, 0xff,
-  0x25, 0xae, 0xff, 0xff, 0x5c, 0xae, 0xff, 0xff, 0x94, 0xae, 0xff, 0xff,
-  0xcb, 0xae, 0xff, 0xff, 0x02, 0xaf, 0xff, 0xff, 0x3a, 0xaf, 0xff, 0xff,
-  0x71, 0xaf, 0xff, 0xff, 0xa8, 0xaf, 0xff, 0xff, 0xdf, 0xaf, 0xff, 0xff,
-  0x17, 0xb0, 0xff, 0xff, 0x4e, 0xb0, 0xff, 0xff, 0x85, 0xb0, 0xff, 0xff,
-  0xbc, 0xb0, 0xff, 0xff, 0xf3, 0xb0, 0xff, 0xff, 0x2a, 0xb1, 0xff, 0xff,
-  0x61, 0xb1, 0xff, 0xff, 0x98, 0xb1, 0xff, 0xff, 0xcf, 0xb1, 0xff, 0xff,
-  0x06, 0xb2, 0xff, 0xff, 0x3d, 0xb2, 0xff, 0xff, 0x74, 0xb2, 0xff, 0xff,
-  0xab, 0xb2, 0xff, 0xff, 0xe2, 0xb2, 0xff, 0xff, 0x18, 0xb3, 0xff, 0xff,
-  0x4f, 0xb3, 0xff, 0xff, 0x86, 0xb3, 0xff, 0xff, 0xbd, 0xb3, 0xff, 0xff,
-  0xf3, 0xb3, 0xff, 0xff, 0x2a, 0xb4, 0xff, 0xff, 0x61, 0xb4, 0xff, 0xff,
-  0x97, 0xb4, 0xff, 0xff, 0xce, 0xb4, 0xff, 0xff, 0x05, 0xb5, 0xff, 0xff,
-  0x3b, 0xb5, 0xff, 0xff, 0x72, 0xb5, 0xff, 0xff, 0xa8, 0xb5, 0xff, 0xff,
-  0xdf, 0xb5, 0xff, 0xff, 0x15, 0xb6, 0xff, 0xff, 0x4c, 0xb6, 0xff, 0xff,
-  0x82, 0xb6, 0xff, 0xff, 0xb8, 0xb6, 0xff, 0xff, 0xef, 0xb6, 0xff, 0xff,
-  0x25, 0xb7, 0xff, 0xff, 0x5b, 0xb7, 0xff, 0xff, 0x92, 0xb7, 0xff, 0xff,
-  0xc8, 0xb7, 0xff, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0x34, 0xb8, 0xff, 0xff,
-  0x6b, 0xb8, 0xff, 0xff, 0xa1, 0xb8, 0xff, 0xff, 0xd7, 0xb8, 0xff, 0xff,
-  0x0d, 0xb9, 0xff, 0xff, 0x43, 0xb9, 0xff, 0xff, 0x79, 0xb9, 0xff, 0xff,
-  0xaf, 0xb9, 0xff, 0xff, 0xe6, 0xb9, 0xff, 0xff, 0x1c, 0xba, 0xff, 0xff,
-  0x52, 0xba, 0xff, 0xff, 0x88, 0xba, 0xff, 0xff, 0xbd, 0xba, 0xff, 0xff,
-  0xf3, 0xba, 0xff, 0xff, 0x29, 0xbb, 0xff, 0xff, 0x5f, 0xbb, 0xff, 0xff,
-  0x95, 0xbb, 0xff, 0xff, 0xcb, 0xbb, 0xff, 0xff, 0x01, 0xbc, 0xff, 0xff,
-  0x37, 0xbc, 0xff, 0xff, 0x6c, 0xbc, 0xff, 0xff, 0xa2, 0xbc, 0xff, 0xff,
-  0xd8, 0xbc, 0xff, 0xff, 0x0e, 0xbd, 0xff, 0xff, 0x43, 0xbd, 0xff, 0xff,
-  0x79, 0xbd, 0xff, 0xff, 0xaf, 0xbd, 0xff, 0xff, 0xe4, 0xbd, 0xff, 0xff,
-  0x1a, 0xbe, 0xff, 0xff, 0x4f, 0xbe, 0xff, 0xff, 0x85, 0xbe, 0xff, 0xff,
-  0xba, 0xbe, 0xff, 0xff, 0xf0, 0xbe, 0xff, 0xff, 0x25, 0xbf, 0xff, 0xff,
-  0x5b, 0xbf, 0xff, 0xff, 0x90, 0xbf, 0xff, 0xff, 0xc6, 0xbf, 0xff, 0xff,
-  0xfb, 0xbf, 0xff, 0xff, 0x31, 0xc0, 0xff, 0xff, 0x66, 0xc0, 0xff, 0xff,
-  0x9b, 0xc0, 0xff, 0xff, 0xd1, 0xc0, 0xff, 0xff, 0x06, 0xc1, 0xff, 0xff,
-  0x3b, 0xc1, 0xff, 0xff, 0x71, 0xc1, 0xff, 0xff, 0xa6, 0xc1, 0xff, 0xff,
-  0xdb, 0xc1, 0xff, 0xff, 0x10, 0xc2, 0xff, 0xff, 0x46, 0xc2, 0xff, 0xff,
-  0x7b, 0xc2, 0xff, 0xff, 0xb0, 0xc2, 0xff, 0xff, 0xe5, 0xc2, 0xff, 0xff,
-  0x1a, 0xc3, 0xff, 0xff, 0x4f, 0xc3, 0xff, 0xff, 0x84, 0xc3, 0xff, 0xff,
-  0xb9, 0xc3, 0xff, 0xff, 0xee, 0xc3, 0xff, 0xff, 0x23, 0xc4, 0xff, 0xff,
-  0x58, 0xc4, 0xff, 0xff, 0x8d, 0xc4, 0xff, 0xff, 0xc2, 0xc4, 0xff, 0xff,
-  0xf7, 0xc4, 0xff, 0xff, 0x2c, 0xc5, 0xff, 0xff, 0x61, 0xc5, 0xff, 0xff,
-  0x96, 0xc5, 0xff, 0xff, 0xcb, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff,
-  0x35, 0xc6, 0xff, 0xff, 0x69, 0xc6, 0xff, 0xff, 0x9e, 0xc6, 0xff, 0xff,
-  0xd3, 0xc6, 0xff, 0xff, 0x08, 0xc7, 0xff, 0xff, 0x3d, 0xc7, 0xff, 0xff,
-  0x71, 0xc7, 0xff, 0xff, 0xa6, 0xc7, 0xff, 0xff, 0xdb, 0xc7, 0xff, 0xff,
-  0x0f, 0xc8, 0xff, 0xff, 0x44, 0xc8, 0xff, 0xff, 0x79, 0xc8, 0xff, 0xff,
-  0xad, 0xc8, 0xff, 0xff, 0xe2, 0xc8, 0xff, 0xff, 0x17, 0xc9, 0xff, 0xff,
-  0x4b, 0xc9, 0xff, 0xff, 0x80, 0xc9, 0xff, 0xff, 0xb4, 0xc9, 0xff, 0xff,
-  0xe9, 0xc9, 0xff, 0xff, 0x1d, 0xca, 0xff, 0xff, 0x52, 0xca, 0xff, 0xff,
-  0x86, 0xca, 0xff, 0xff, 0xbb, 0xca, 0xff, 0xff, 0xef, 0xca, 0xff, 0xff,
-  0x23, 0xcb, 0xff, 0xff, 0x58, 0xcb, 0xff, 0xff, 0x8c, 0xcb, 0xff, 0xff,
-  0xc1, 0xcb, 0xff, 0xff, 0xf5, 0xcb, 0xff, 0xff, 0x29, 0xcc, 0xff, 0xff,
-  0x5e, 0xcc, 0xff, 0xff, 0x92, 0xcc, 0xff, 0xff, 0xc6, 0xcc, 0xff, 0xff,
-  0xfa, 0xcc, 0xff, 0xff, 0x2f, 0xcd, 0xff, 0xff, 0x63, 0xcd, 0xff, 0xff,
-  0x97, 0xcd, 0xff, 0xff, 0xcb, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff,
-  0x34, 0xce, 0xff, 0xff, 0x68, 0xce, 0xff, 0xff, 0x9c, 0xce, 0xff, 0xff,
-  0xd0, 0xce, 0xff, 0xff, 0x04, 0xcf, 0xff, 0xff, 0x38, 0xcf, 0xff, 0xff,
-  0x6c, 0xcf, 0xff, 0xff, 0xa1, 0xcf, 0xff, 0xff, 0xd5, 0xcf, 0xff, 0xff,
-  0x09, 0xd0, 0xff, 0xff, 0x3d, 0xd0, 0xff, 0xff, 0x71, 0xd0, 0xff, 0xff,
-  0xa5, 0xd0, 0xff, 0xff, 0xd9, 0xd0, 0xff, 0xff, 0x0d, 0xd1, 0xff, 0xff,
-  0x41, 0xd1, 0xff, 0xff, 0x74, 0xd1, 0xff, 0xff, 0xa8, 0xd1, 0xff, 0xff,
-  0xdc, 0xd1, 0xff, 0xff, 0x10, 0xd2, 0xff, 0xff, 0x44, 0xd2, 0xff, 0xff,
-  0x78, 0xd2, 0xff, 0xff, 0xac, 0xd2, 0xff, 0xff, 0xe0, 0xd2, 0xff, 0xff,
-  0x13, 0xd3, 0xff, 0xff, 0x47, 0xd3, 0xff, 0xff, 0x7b, 0xd3, 0xff, 0xff,
-  0xaf, 0xd3, 0xff, 0xff, 0xe3, 0xd3, 0xff, 0xff, 0x16, 0xd4, 0xff, 0xff,
-  0x4a, 0xd4, 0xff, 0xff, 0x7e, 0xd4, 0xff, 0xff, 0xb2, 0xd4, 0xff, 0xff,
-  0xe5, 0xd4, 0xff, 0xff, 0x19, 0xd5, 0xff, 0xff, 0x4d, 0xd5, 0xff, 0xff,
-  0x80, 0xd5, 0xff, 0xff, 0xb4, 0xd5, 0xff, 0xff, 0xe7, 0xd5, 0xff, 0xff,
-  0x1b, 0xd6, 0xff, 0xff, 0x4f, 0xd6, 0xff, 0xff, 0x82, 0xd6, 0xff, 0xff,
-  0xb6, 0xd6, 0xff, 0xff, 0xe9, 0xd6, 0xff, 0xff, 0x1d, 0xd7, 0xff, 0xff,
-  0x51, 0xd7, 0xff, 0xff, 0x84, 0xd7, 0xff, 0xff, 0xb8, 0xd7, 0xff, 0xff,
-  0xeb, 0xd7, 0xff, 0xff, 0x1f, 0xd8, 0xff, 0xff, 0x52, 0xd8, 0xff, 0xff,
-  0x86, 0xd8, 0xff, 0xff, 0xb9, 0xd8, 0xff, 0xff, 0xec, 0xd8, 0xff, 0xff,
-  0x20, 0xd9, 0xff, 0xff, 0x53, 0xd9, 0xff, 0xff, 0x87, 0xd9, 0xff, 0xff,
-  0xba, 0xd9, 0xff, 0xff, 0xed, 0xd9, 0xff, 0xff, 0x21, 0xda, 0xff, 0xff,
-  0x54, 0xda, 0xff, 0xff, 0x88, 0xda, 0xff, 0xff, 0xbb, 0xda, 0xff, 0xff,
-  0xee, 0xda, 0xff, 0xff, 0x22, 0xdb, 0xff, 0xff, 0x55, 0xdb, 0xff, 0xff,
-  0x88, 0xdb, 0xff, 0xff, 0xbb, 0xdb, 0xff, 0xff, 0xef, 0xdb, 0xff, 0xff,
-  0x22, 0xdc, 0xff, 0xff, 0x55, 0xdc, 0xff, 0xff, 0x88, 0xdc, 0xff, 0xff,
-  0xbc, 0xdc, 0xff, 0xff, 0xef, 0xdc, 0xff, 0xff, 0x22, 0xdd, 0xff, 0xff,
-  0x55, 0xdd, 0xff, 0xff, 0x88, 0xdd, 0xff, 0xff, 0xbc, 0xdd, 0xff, 0xff,
-  0xef, 0xdd, 0xff, 0xff, 0x22, 0xde, 0xff, 0xff, 0x55, 0xde, 0xff, 0xff,
-  0x88, 0xde, 0xff, 0xff, 0xbb, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff,
-  0x22, 0xdf, 0xff, 0xff, 0x55, 0xdf, 0xff, 0xff, 0x88, 0xdf, 0xff, 0xff,
-  0xbb, 0xdf, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0x21, 0xe0, 0xff, 0xff,
-  0x54, 0xe0, 0xff, 0xff, 0x87, 0xe0, 0xff, 0xff, 0xba, 0xe0, 0xff, 0xff,
-  0xed, 0xe0, 0xff, 0xff, 0x20, 0xe1, 0xff, 0xff, 0x53, 0xe1, 0xff, 0xff,
-  0x86, 0xe1, 0xff, 0xff, 0xb9, 0xe1, 0xff, 0xff, 0xec, 0xe1, 0xff, 0xff,
-  0x1f, 0xe2, 0xff, 0xff, 0x52, 0xe2, 0xff, 0xff, 0x85, 0xe2, 0xff, 0xff,
-  0xb8, 0xe2, 0xff, 0xff, 0xeb, 0xe2, 0xff, 0xff, 0x1d, 0xe3, 0xff, 0xff,
-  0x50, 0xe3, 0xff, 0xff, 0x83, 0xe3, 0xff, 0xff, 0xb6, 0xe3, 0xff, 0xff,
-  0xe9, 0xe3, 0xff, 0xff, 0x1c, 0xe4, 0xff, 0xff, 0x4f, 0xe4, 0xff, 0xff,
-  0x82, 0xe4, 0xff, 0xff, 0xb4, 0xe4, 0xff, 0xff, 0xe7, 0xe4, 0xff, 0xff,
-  0x1a, 0xe5, 0xff, 0xff, 0x4d, 0xe5, 0xff, 0xff, 0x80, 0xe5, 0xff, 0xff,
-  0xb3, 0xe5, 0xff, 0xff, 0xe5, 0xe5, 0xff, 0xff, 0x18, 0xe6, 0xff, 0xff,
-  0x4b, 0xe6, 0xff, 0xff, 0x7e, 0xe6, 0xff, 0xff, 0xb0, 0xe6, 0xff, 0xff,
-  0xe3, 0xe6, 0xff, 0xff, 0x16, 0xe7, 0xff, 0xff, 0x49, 0xe7, 0xff, 0xff,
-  0x7b, 0xe7, 0xff, 0xff, 0xae, 0xe7, 0xff, 0xff, 0xe1, 0xe7, 0xff, 0xff,
-  0x14, 0xe8, 0xff, 0xff, 0x46, 0xe8, 0xff, 0xff, 0x79, 0xe8, 0xff, 0xff,
-  0xac, 0xe8, 0xff, 0xff, 0xde, 0xe8, 0xff, 0xff, 0x11, 0xe9, 0xff, 0xff,
-  0x44, 0xe9, 0xff, 0xff, 0x76, 0xe9, 0xff, 0xff, 0xa9, 0xe9, 0xff, 0xff,
-  0xdc, 0xe9, 0xff, 0xff, 0x0e, 0xea, 0xff, 0xff, 0x41, 0xea, 0xff, 0xff,
-  0x73, 0xea, 0xff, 0xff, 0xa6, 0xea, 0xff, 0xff, 0xd9, 0xea, 0xff, 0xff,
-  0x0b, 0xeb, 0xff, 0xff, 0x3e, 0xeb, 0xff, 0xff, 0x70, 0xeb, 0xff, 0xff,
-  0xa3, 0xeb, 0xff, 0xff, 0xd6, 0xeb, 0xff, 0xff, 0x08, 0xec, 0xff, 0xff,
-  0x3b, 0xec, 0xff, 0xff, 0x6d, 0xec, 0xff, 0xff, 0xa0, 0xec, 0xff, 0xff,
-  0xd2, 0xec, 0xff, 0xff, 0x05, 0xed, 0xff, 0xff, 0x38, 0xed, 0xff, 0xff,
-  0x6a, 0xed, 0xff, 0xff, 0x9d, 0xed, 0xff, 0xff, 0xcf, 0xed, 0xff, 0xff,
-  0x02, 0xee, 0xff, 0xff, 0x34, 0xee, 0xff, 0xff, 0x67, 0xee, 0xff, 0xff,
-  0x99, 0xee, 0xff, 0xff, 0xcc, 0xee, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xff,
-  0x31, 0xef, 0xff, 0xff, 0x63, 0xef, 0xff, 0xff, 0x96, 0xef, 0xff, 0xff,
-  0xc8, 0xef, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xff, 0x2d, 0xf0, 0xff, 0xff,
-  0x5f, 0xf0, 0xff, 0xff, 0x92, 0xf0, 0xff, 0xff, 0xc4, 0xf0, 0xff, 0xff,
-  0xf7, 0xf0, 0xff, 0xff, 0x29, 0xf1, 0xff, 0xff, 0x5c, 0xf1, 0xff, 0xff,
-  0x8e, 0xf1, 0xff, 0xff, 0xc0, 0xf1, 0xff, 0xff, 0xf3, 0xf1, 0xff, 0xff,
-  0x25, 0xf2, 0xff, 0xff, 0x58, 0xf2, 0xff, 0xff, 0x8a, 0xf2, 0xff, 0xff,
-  0xbd, 0xf2, 0xff, 0xff, 0xef, 0xf2, 0xff, 0xff, 0x21, 0xf3, 0xff, 0xff,
-  0x54, 0xf3, 0xff, 0xff, 0x86, 0xf3, 0xff, 0xff, 0xb8, 0xf3, 0xff, 0xff,
-  0xeb, 0xf3, 0xff, 0xff, 0x1d, 0xf4, 0xff, 0xff, 0x50, 0xf4, 0xff, 0xff,
-  0x82, 0xf4, 0xff, 0xff, 0xb4, 0xf4, 0xff, 0xff, 0xe7, 0xf4, 0xff, 0xff,
-  0x19, 0xf5, 0xff, 0xff, 0x4b, 0xf5, 0xff, 0xff, 0x7e, 0xf5, 0xff, 0xff,
-  0xb0, 0xf5, 0xff, 0xff, 0xe2, 0xf5, 0xff, 0xff, 0x15, 0xf6, 0xff, 0xff,
-  0x47, 0xf6, 0xff, 0xff, 0x79, 0xf6, 0xff, 0xff, 0xac, 0xf6, 0xff, 0xff,
-  0xde, 0xf6, 0xff, 0xff, 0x10, 0xf7, 0xff, 0xff, 0x43, 0xf7, 0xff, 0xff,
-  0x75, 0xf7, 0xff, 0xff, 0xa7, 0xf7, 0xff, 0xff, 0xda, 0xf7, 0xff, 0xff,
-  0x0c, 0xf8, 0xff, 0xff, 0x3e, 0xf8, 0xff, 0xff, 0x71, 0xf8, 0xff, 0xff,
-  0xa3, 0xf8, 0xff, 0xff, 0xd5, 0xf8, 0xff, 0xff, 0x08, 0xf9, 0xff, 0xff,
-  0x3a, 0xf9, 0xff, 0xff, 0x6c, 0xf9, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff,
-  0xd1, 0xf9, 0xff, 0xff, 0x03, 0xfa, 0xff, 0xff, 0x35, 0xfa, 0xff, 0xff,
-  0x68, 0xfa, 0xff, 0xff, 0x9a, 0xfa, 0xff, 0xff, 0xcc, 0xfa, 0xff, 0xff,
-  0xff, 0xfa, 0xff, 0xff, 0x31, 0xfb, 0xff, 0xff, 0x63, 0xfb, 0xff, 0xff,
-  0x95, 0xfb, 0xff, 0xff, 0xc8, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff,
-  0x2c, 0xfc, 0xff, 0xff, 0x5f, 0xfc, 0xff, 0xff, 0x91, 0xfc, 0xff, 0xff,
-  0xc3, 0xfc, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0x28, 0xfd, 0xff, 0xff,
-  0x5a, 0xfd, 0xff, 0xff, 0x8c, 0xfd, 0xff, 0xff, 0xbe, 0xfd, 0xff, 0xff,
-  0xf1, 0xfd, 0xff, 0xff, 0x23, 0xfe, 0xff, 0xff, 0x55, 0xfe, 0xff, 0xff,
-  0x88, 0xfe, 0xff, 0xff, 0xba, 0xfe, 0xff, 0xff, 0xec, 0xfe, 0xff, 0xff,
-  0x1e, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-  0xb5, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x4b, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
-  0xe2, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00,
-  0x78, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00,
-  0x0f, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00,
-  0xa6, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00,
-  0x3d, 0x03, 0x00, 0x00, 0x6f, 0x03, 0x00, 0x00, 0xa1, 0x03, 0x00, 0x00,
-  0xd4, 0x03, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00,
-  0x6b, 0x04, 0x00, 0x00, 0x9d, 0x04, 0x00, 0x00, 0xcf, 0x04, 0x00, 0x00,
-  0x01, 0x05, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00,
-  0x98, 0x05, 0x00, 0x00, 0xcb, 0x05, 0x00, 0x00, 0xfd, 0x05, 0x00, 0x00,
-  0x2f, 0x06, 0x00, 0x00, 0x61, 0x06, 0x00, 0x00, 0x94, 0x06, 0x00, 0x00,
-  0xc6, 0x06, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x00,
-  0x5d, 0x07, 0x00, 0x00, 0x8f, 0x07, 0x00, 0x00, 0xc2, 0x07, 0x00, 0x00,
-  0xf4, 0x07, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00, 0x59, 0x08, 0x00, 0x00,
-  0x8b, 0x08, 0x00, 0x00, 0xbd, 0x08, 0x00, 0x00, 0xf0, 0x08, 0x00, 0x00,
-  0x22, 0x09, 0x00, 0x00, 0x54, 0x09, 0x00, 0x00, 0x87, 0x09, 0x00, 0x00,
-  0xb9, 0x09, 0x00, 0x00, 0xeb, 0x09, 0x00, 0x00, 0x1e, 0x0a, 0x00, 0x00,
-  0x50, 0x0a, 0x00, 0x00, 0x82, 0x0a, 0x00, 0x00, 0xb5, 0x0a, 0x00, 0x00,
-  0xe7, 0x0a, 0x00, 0x00, 0x19, 0x0b, 0x00, 0x00, 0x4c, 0x0b, 0x00, 0x00,
-  0x7e, 0x0b, 0x00, 0x00, 0xb0, 0x0b, 0x00, 0x00, 0xe3, 0x0b, 0x00, 0x00,
-  0x15, 0x0c, 0x00, 0x00, 0x48, 0x0c, 0x00, 0x00, 0x7a, 0x0c, 0x00, 0x00,
-  0xac, 0x0c, 0x00, 0x00, 0xdf, 0x0c, 0x00, 0x00, 0x11, 0x0d, 0x00, 0x00,
-  0x43, 0x0d, 0x00, 0x00, 0x76, 0x0d, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0x00,
-  0xdb, 0x0d, 0x00, 0x00, 0x0d, 0x0e, 0x00, 0x00, 0x40, 0x0e, 0x00, 0x00,
-  0x72, 0x0e, 0x00, 0x00, 0xa4, 0x0e, 0x00, 0x00, 0xd7, 0x0e, 0x00, 0x00,
-  0x09, 0x0f, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00, 0x6e, 0x0f, 0x00, 0x00,
-  0xa1, 0x0f, 0x00, 0x00, 0xd3, 0x0f, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00,
-  0x38, 0x10, 0x00, 0x00, 0x6a, 0x10, 0x00, 0x00, 0x9d, 0x10, 0x00, 0x00,
-  0xcf, 0x10, 0x00, 0x00, 0x02, 0x11, 0x00, 0x00, 0x34, 0x11, 0x00, 0x00,
-  0x67, 0x11, 0x00, 0x00, 0x99, 0x11, 0x00, 0x00, 0xcc, 0x11, 0x00, 0x00,
-  0xfe, 0x11, 0x00, 0x00, 0x31, 0x12, 0x00, 0x00, 0x63, 0x12, 0x00, 0x00,
-  0x96, 0x12, 0x00, 0x00, 0xc8, 0x12, 0x00, 0x00, 0xfb, 0x12, 0x00, 0x00,
-  0x2e, 0x13, 0x00, 0x00, 0x60, 0x13, 0x00, 0x00, 0x93, 0x13, 0x00, 0x00,
-  0xc5, 0x13, 0x00, 0x00, 0xf8, 0x13, 0x00, 0x00, 0x2a, 0x14, 0x00, 0x00,
-  0x5d, 0x14, 0x00, 0x00, 0x90, 0x14, 0x00, 0x00, 0xc2, 0x14, 0x00, 0x00,
-  0xf5, 0x14, 0x00, 0x00, 0x27, 0x15, 0x00, 0x00, 0x5a, 0x15, 0x00, 0x00,
-  0x8d, 0x15, 0x00, 0x00, 0xbf, 0x15, 0x00, 0x00, 0xf2, 0x15, 0x00, 0x00,
-  0x24, 0x16, 0x00, 0x00, 0x57, 0x16, 0x00, 0x00, 0x8a, 0x16, 0x00, 0x00,
-  0xbc, 0x16, 0x00, 0x00, 0xef, 0x16, 0x00, 0x00, 0x22, 0x17, 0x00, 0x00,
-  0x54, 0x17, 0x00, 0x00, 0x87, 0x17, 0x00, 0x00, 0xba, 0x17, 0x00, 0x00,
-  0xec, 0x17, 0x00, 0x00, 0x1f, 0x18, 0x00, 0x00, 0x52, 0x18, 0x00, 0x00,
-  0x85, 0x18, 0x00, 0x00, 0xb7, 0x18, 0x00, 0x00, 0xea, 0x18, 0x00, 0x00,
-  0x1d, 0x19, 0x00, 0x00, 0x50, 0x19, 0x00, 0x00, 0x82, 0x19, 0x00, 0x00,
-  0xb5, 0x19, 0x00, 0x00, 0xe8, 0x19, 0x00, 0x00, 0x1b, 0x1a, 0x00, 0x00,
-  0x4d, 0x1a, 0x00, 0x00, 0x80, 0x1a, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00,
-  0xe6, 0x1a, 0x00, 0x00, 0x19, 0x1b, 0x00, 0x00, 0x4c, 0x1b, 0x00, 0x00,
-  0x7e, 0x1b, 0x00, 0x00, 0xb1, 0x1b, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x00,
-  0x17, 0x1c, 0x00, 0x00, 0x4a, 0x1c, 0x00, 0x00, 0x7d, 0x1c, 0x00, 0x00,
-  0xb0, 0x1c, 0x00, 0x00, 0xe3, 0x1c, 0x00, 0x00, 0x15, 0x1d, 0x00, 0x00,
-  0x48, 0x1d, 0x00, 0x00, 0x7b, 0x1d, 0x00, 0x00, 0xae, 0x1d, 0x00, 0x00,
-  0xe1, 0x1d, 0x00, 0x00, 0x14, 0x1e, 0x00, 0x00, 0x47, 0x1e, 0x00, 0x00,
-  0x7a, 0x1e, 0x00, 0x00, 0xad, 0x1e, 0x00, 0x00, 0xe0, 0x1e, 0x00, 0x00,
-  0x13, 0x1f, 0x00, 0x00, 0x46, 0x1f, 0x00, 0x00, 0x79, 0x1f, 0x00, 0x00,
-  0xac, 0x1f, 0x00, 0x00, 0xdf, 0x1f, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00,
-  0x45, 0x20, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0xab, 0x20, 0x00, 0x00,
-  0xde, 0x20, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x45, 0x21, 0x00, 0x00,
-  0x78, 0x21, 0x00, 0x00, 0xab, 0x21, 0x00, 0x00, 0xde, 0x21, 0x00, 0x00,
-  0x11, 0x22, 0x00, 0x00, 0x44, 0x22, 0x00, 0x00, 0x78, 0x22, 0x00, 0x00,
-  0xab, 0x22, 0x00, 0x00, 0xde, 0x22, 0x00, 0x00, 0x11, 0x23, 0x00, 0x00,
-  0x44, 0x23, 0x00, 0x00, 0x78, 0x23, 0x00, 0x00, 0xab, 0x23, 0x00, 0x00,
-  0xde, 0x23, 0x00, 0x00, 0x11, 0x24, 0x00, 0x00, 0x45, 0x24, 0x00, 0x00,
-  0x78, 0x24, 0x00, 0x00, 0xab, 0x24, 0x00, 0x00, 0xde, 0x24, 0x00, 0x00,
-  0x12, 0x25, 0x00, 0x00, 0x45, 0x25, 0x00, 0x00, 0x78, 0x25, 0x00, 0x00,
-  0xac, 0x25, 0x00, 0x00, 0xdf, 0x25, 0x00, 0x00, 0x13, 0x26, 0x00, 0x00,
-  0x46, 0x26, 0x00, 0x00, 0x79, 0x26, 0x00, 0x00, 0xad, 0x26, 0x00, 0x00,
-  0xe0, 0x26, 0x00, 0x00, 0x14, 0x27, 0x00, 0x00, 0x47, 0x27, 0x00, 0x00,
-  0x7a, 0x27, 0x00, 0x00, 0xae, 0x27, 0x00, 0x00, 0xe1, 0x27, 0x00, 0x00,
-  0x15, 0x28, 0x00, 0x00, 0x48, 0x28, 0x00, 0x00, 0x7c, 0x28, 0x00, 0x00,
-  0xaf, 0x28, 0x00, 0x00, 0xe3, 0x28, 0x00, 0x00, 0x17, 0x29, 0x00, 0x00,
-  0x4a, 0x29, 0x00, 0x00, 0x7e, 0x29, 0x00, 0x00, 0xb1, 0x29, 0x00, 0x00,
-  0xe5, 0x29, 0x00, 0x00, 0x19, 0x2a, 0x00, 0x00, 0x4c, 0x2a, 0x00, 0x00,
-  0x80, 0x2a, 0x00, 0x00, 0xb3, 0x2a, 0x00, 0x00, 0xe7, 0x2a, 0x00, 0x00,
-  0x1b, 0x2b, 0x00, 0x00, 0x4e, 0x2b, 0x00, 0x00, 0x82, 0x2b, 0x00, 0x00,
-  0xb6, 0x2b, 0x00, 0x00, 0xea, 0x2b, 0x00, 0x00, 0x1d, 0x2c, 0x00, 0x00,
-  0x51, 0x2c, 0x00, 0x00, 0x85, 0x2c, 0x00, 0x00, 0xb9, 0x2c, 0x00, 0x00,
-  0xed, 0x2c, 0x00, 0x00, 0x20, 0x2d, 0x00, 0x00, 0x54, 0x2d, 0x00, 0x00,
-  0x88, 0x2d, 0x00, 0x00, 0xbc, 0x2d, 0x00, 0x00, 0xf0, 0x2d, 0x00, 0x00,
-  0x24, 0x2e, 0x00, 0x00, 0x58, 0x2e, 0x00, 0x00, 0x8c, 0x2e, 0x00, 0x00,
-  0xbf, 0x2e, 0x00, 0x00, 0xf3, 0x2e, 0x00, 0x00, 0x27, 0x2f, 0x00, 0x00,
-  0x5b, 0x2f, 0x00, 0x00, 0x8f, 0x2f, 0x00, 0x00, 0xc3, 0x2f, 0x00, 0x00,
-  0xf7, 0x2f, 0x00, 0x00, 0x2b, 0x30, 0x00, 0x00, 0x5f, 0x30, 0x00, 0x00,
-  0x94, 0x30, 0x00, 0x00, 0xc8, 0x30, 0x00, 0x00, 0xfc, 0x30, 0x00, 0x00,
-  0x30, 0x31, 0x00, 0x00, 0x64, 0x31, 0x00, 0x00, 0x98, 0x31, 0x00, 0x00,
-  0xcc, 0x31, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x35, 0x32, 0x00, 0x00,
-  0x69, 0x32, 0x00, 0x00, 0x9d, 0x32, 0x00, 0x00, 0xd1, 0x32, 0x00, 0x00,
-  0x06, 0x33, 0x00, 0x00, 0x3a, 0x33, 0x00, 0x00, 0x6e, 0x33, 0x00, 0x00,
-  0xa2, 0x33, 0x00, 0x00, 0xd7, 0x33, 0x00, 0x00, 0x0b, 0x34, 0x00, 0x00,
-  0x3f, 0x34, 0x00, 0x00, 0x74, 0x34, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x00,
-  0xdd, 0x34, 0x00, 0x00, 0x11, 0x35, 0x00, 0x00, 0x45, 0x35, 0x00, 0x00,
-  0x7a, 0x35, 0x00, 0x00, 0xae, 0x35, 0x00, 0x00, 0xe3, 0x35, 0x00, 0x00,
-  0x17, 0x36, 0x00, 0x00, 0x4c, 0x36, 0x00, 0x00, 0x80, 0x36, 0x00, 0x00,
-  0xb5, 0x36, 0x00, 0x00, 0xe9, 0x36, 0x00, 0x00, 0x1e, 0x37, 0x00, 0x00,
-  0x53, 0x37, 0x00, 0x00, 0x87, 0x37, 0x00, 0x00, 0xbc, 0x37, 0x00, 0x00,
-  0xf1, 0x37, 0x00, 0x00, 0x25, 0x38, 0x00, 0x00, 0x5a, 0x38, 0x00, 0x00,
-  0x8f, 0x38, 0x00, 0x00, 0xc3, 0x38, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00,
-  0x2d, 0x39, 0x00, 0x00, 0x62, 0x39, 0x00, 0x00, 0x97, 0x39, 0x00, 0x00,
-  0xcb, 0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x35, 0x3a, 0x00, 0x00,
-  0x6a, 0x3a, 0x00, 0x00, 0x9f, 0x3a, 0x00, 0x00, 0xd4, 0x3a, 0x00, 0x00,
-  0x09, 0x3b, 0x00, 0x00, 0x3e, 0x3b, 0x00, 0x00, 0x73, 0x3b, 0x00, 0x00,
-  0xa8, 0x3b, 0x00, 0x00, 0xdd, 0x3b, 0x00, 0x00, 0x12, 0x3c, 0x00, 0x00,
-  0x47, 0x3c, 0x00, 0x00, 0x7c, 0x3c, 0x00, 0x00, 0xb1, 0x3c, 0x00, 0x00,
-  0xe6, 0x3c, 0x00, 0x00, 0x1b, 0x3d, 0x00, 0x00, 0x50, 0x3d, 0x00, 0x00,
-  0x85, 0x3d, 0x00, 0x00, 0xba, 0x3d, 0x00, 0x00, 0xf0, 0x3d, 0x00, 0x00,
-  0x25, 0x3e, 0x00, 0x00, 0x5a, 0x3e, 0x00, 0x00, 0x8f, 0x3e, 0x00, 0x00,
-  0xc5, 0x3e, 0x00, 0x00, 0xfa, 0x3e, 0x00, 0x00, 0x2f, 0x3f, 0x00, 0x00,
-  0x65, 0x3f, 0x00, 0x00, 0x9a, 0x3f, 0x00, 0x00, 0xcf, 0x3f, 0x00, 0x00,
-  0x05, 0x40, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00,
-  0xa5, 0x40, 0x00, 0x00, 0xdb, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
-  0x46, 0x41, 0x00, 0x00, 0x7b, 0x41, 0x00, 0x00, 0xb1, 0x41, 0x00, 0x00,
-  0xe6, 0x41, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x51, 0x42, 0x00, 0x00,
-  0x87, 0x42, 0x00, 0x00, 0xbd, 0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00,
-  0x28, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x94, 0x43, 0x00, 0x00,
-  0xc9, 0x43, 0x00, 0x00, 0xff, 0x43, 0x00, 0x00, 0x35, 0x44, 0x00, 0x00,
-  0x6b, 0x44, 0x00, 0x00, 0xa1, 0x44, 0x00, 0x00, 0xd7, 0x44, 0x00, 0x00,
-  0x0d, 0x45, 0x00, 0x00, 0x43, 0x45, 0x00, 0x00, 0x78, 0x45, 0x00, 0x00,
-  0xae, 0x45, 0x00, 0x00, 0xe4, 0x45, 0x00, 0x00, 0x1a, 0x46, 0x00, 0x00,
-  0x51, 0x46, 0x00, 0x00, 0x87, 0x46, 0x00, 0x00, 0xbd, 0x46, 0x00, 0x00,
-  0xf3, 0x46, 0x00, 0x00, 0x29, 0x47, 0x00, 0x00, 0x5f, 0x47, 0x00, 0x00,
-  0x95, 0x47, 0x00, 0x00, 0xcc, 0x47, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00,
-  0x38, 0x48, 0x00, 0x00, 0x6e, 0x48, 0x00, 0x00, 0xa5, 0x48, 0x00, 0x00,
-  0xdb, 0x48, 0x00, 0x00, 0x11, 0x49, 0x00, 0x00, 0x48, 0x49, 0x00, 0x00,
-  0x7e, 0x49, 0x00, 0x00, 0xb4, 0x49, 0x00, 0x00, 0xeb, 0x49, 0x00, 0x00,
-  0x21, 0x4a, 0x00, 0x00, 0x58, 0x4a, 0x00, 0x00, 0x8e, 0x4a, 0x00, 0x00,
-  0xc5, 0x4a, 0x00, 0x00, 0xfb, 0x4a, 0x00, 0x00, 0x32, 0x4b, 0x00, 0x00,
-  0x69, 0x4b, 0x00, 0x00, 0x9f, 0x4b, 0x00, 0x00, 0xd6, 0x4b, 0x00, 0x00,
-  0x0d, 0x4c, 0x00, 0x00, 0x43, 0x4c, 0x00, 0x00, 0x7a, 0x4c, 0x00, 0x00,
-  0xb1, 0x4c, 0x00, 0x00, 0xe8, 0x4c, 0x00, 0x00, 0x1e, 0x4d, 0x00, 0x00,
-  0x55, 0x4d, 0x00, 0x00, 0x8c, 0x4d, 0x00, 0x00, 0xc3, 0x4d, 0x00, 0x00,
-  0xfa, 0x4d, 0x00, 0x00, 0x31, 0x4e, 0x00, 0x00, 0x68, 0x4e, 0x00, 0x00,
-  0x9f, 0x4e, 0x00, 0x00, 0xd6, 0x4e, 0x00, 0x00, 0x0d, 0x4f, 0x00, 0x00,
-  0x44, 0x4f, 0x00, 0x00, 0x7b, 0x4f, 0x00, 0x00, 0xb2, 0x4f, 0x00, 0x00,
-  0xe9, 0x4f, 0x00, 0x00, 0x21, 0x50, 0x00, 0x00, 0x58, 0x50, 0x00, 0x00,
-  0x8f, 0x50, 0x00, 0x00, 0xc6, 0x50, 0x00, 0x00, 0xfe, 0x50, 0x00, 0x00,
-  0x35, 0x51, 0x00, 0x00, 0x6c, 0x51, 0x00, 0x00, 0xa4, 0x51, 0x00, 0x00,
-  0xdb, 0x51, 0x00, 0x00, 0x12, 0x52, 0x00, 0x00, 0x4a, 0x52, 0x00, 0x00,
-  0x81, 0x52, 0x00, 0x00, 0xb9, 0x52, 0x00, 0x00, 0xf0, 0x52, 0x00, 0x00,
-  0x28, 0x53, 0x00, 0x00, 0x5f, 0x53, 0x00, 0x00, 0x97, 0x53, 0x00, 0x00,
-  0xcf, 0x53, 0x00, 0x00, 0x06, 0x54, 0x00, 0x00, 0x3e, 0x54, 0x00, 0x00,
-  0x76, 0x54, 0x00, 0x00, 0xae, 0x54, 0x00, 0x00, 0xe5, 0x54, 0x00, 0x00,
-  0x1d, 0x55, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x8d, 0x55, 0x00, 0x00,
-  0xc5, 0x55, 0x00, 0x00, 0xfd, 0x55, 0x00, 0x00, 0x35, 0x56, 0x00, 0x00,
-  0x6d, 0x56, 0x00, 0x00, 0xa5, 0x56, 0x00, 0x00, 0xdd, 0x56, 0x00, 0x00,
-  0x15, 0x57, 0x00, 0x00, 0x4d, 0x57, 0x00, 0x00, 0x85, 0x57, 0x00, 0x00,
-  0xbd, 0x57, 0x00, 0x00, 0xf5, 0x57, 0x00, 0x00, 0x2d, 0x58, 0x00, 0x00,
-  0x66, 0x58, 0x00, 0x00, 0x9e, 0x58, 0x00, 0x00, 0xd6, 0x58, 0x00, 0x00,
-  0x0f, 0x59, 0x00, 0x00, 0x47, 0x59, 0x00, 0x00, 0x7f, 0x59, 0x00, 0x00,
-  0xb8, 0x59, 0x00, 0x00, 0xf0, 0x59, 0x00, 0x00, 0x29, 0x5a, 0x00, 0x00,
-  0x61, 0x5a, 0x00, 0x00, 0x9a, 0x5a, 0x00, 0x00, 0xd2, 0x5a, 0x00, 0x00,
-  0x0b, 0x5b, 0x00, 0x00, 0x44, 0x5b, 0x00, 0x00, 0x7c, 0x5b, 0x00, 0x00,
-  0xb5, 0x5b, 0x00, 0x00, 0xee, 0x5b, 0x00, 0x00, 0x27, 0x5c, 0x00, 0x00,
-  0x5f, 0x5c, 0x00, 0x00, 0x98, 0x5c, 0x00, 0x00, 0xd1, 0x5c, 0x00, 0x00,
-  0x0a, 0x5d, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00, 0x7c, 0x5d, 0x00, 0x00,
-  0xb5, 0x5d, 0x00, 0x00, 0xee, 0x5d, 0x00, 0x00, 0x27, 0x5e, 0x00, 0x00,
-  0x60, 0x5e, 0x00, 0x00, 0x99, 0x5e, 0x00, 0x00, 0xd2, 0x5e, 0x00, 0x00,
-  0x0b, 0x5f, 0x00, 0x00, 0x45, 0x5f, 0x00, 0x00, 0x7e, 0x5f, 0x00, 0x00,
-  0xb7, 0x5f, 0x00, 0x00, 0xf0, 0x5f, 0x00, 0x00, 0x2a, 0x60, 0x00, 0x00,
-  0x63, 0x60, 0x00, 0x00, 0x9c, 0x60, 0x00, 0x00, 0xd6, 0x60, 0x00, 0x00,
-  0x0f, 0x61, 0x00, 0x00, 0x49, 0x61, 0x00, 0x00, 0x82, 0x61, 0x00, 0x00,
-  0xbc, 0x61, 0x00, 0x00, 0xf6, 0x61, 0x00, 0x00, 0x2f, 0x62, 0x00, 0x00,
-  0x69, 0x62, 0x00, 0x00, 0xa3, 0x62, 0x00, 0x00, 0xdc, 0x62, 0x00, 0x00,
-  0x16, 0x63, 0x00, 0x00, 0x50, 0x63, 0x00, 0x00, 0x8a, 0x63, 0x00, 0x00,
-  0xc4, 0x63, 0x00, 0x00, 0xfe, 0x63, 0x00, 0x00, 0x38, 0x64, 0x00, 0x00,
-  0x72, 0x64, 0x00, 0x00, 0xac, 0x64, 0x00, 0x00, 0xe6, 0x64, 0x00, 0x00,
-  0x20, 0x65, 0x00, 0x00, 0x5a, 0x65, 0x00, 0x00, 0x94, 0x65, 0x00, 0x00,
-  0xce, 0x65, 0x00, 0x00, 0x08, 0x66, 0x00, 0x00, 0x43, 0x66, 0x00, 0x00,
-  0x7d, 0x66, 0x00, 0x00, 0xb7, 0x66, 0x00, 0x00, 0xf2, 0x66, 0x00, 0x00,
-  0x2c, 0x67, 0x00, 0x00, 0x67, 0x67, 0x00, 0x00, 0xa1, 0x67, 0x00, 0x00,
-  0xdc, 0x67, 0x00, 0x00, 0x16, 0x68, 0x00, 0x00, 0x51, 0x68, 0x00, 0x00,
-  0x8b, 0x68, 0x00, 0x00, 0xc6, 0x68, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00,
-  0x3c, 0x69, 0x00, 0x00, 0x76, 0x69, 0x00, 0x00, 0xb1, 0x69, 0x00, 0x00,
-  0xec, 0x69, 0x00, 0x00, 0x27, 0x6a, 0x00, 0x00, 0x62, 0x6a, 0x00, 0x00,
-  0x9d, 0x6a, 0x00, 0x00, 0xd8, 0x6a, 0x00, 0x00, 0x13, 0x6b, 0x00, 0x00,
-  0x4e, 0x6b, 0x00, 0x00, 0x89, 0x6b, 0x00, 0x00, 0xc4, 0x6b, 0x00, 0x00,
-  0xff, 0x6b, 0x00, 0x00, 0x3b, 0x6c, 0x00, 0x00, 0x76, 0x6c, 0x00, 0x00,
-  0xb1, 0x6c, 0x00, 0x00, 0xec, 0x6c, 0x00, 0x00, 0x28, 0x6d, 0x00, 0x00,
-  0x63, 0x6d, 0x00, 0x00, 0x9f, 0x6d, 0x00, 0x00, 0xda, 0x6d, 0x00, 0x00,
-  0x16, 0x6e, 0x00, 0x00, 0x51, 0x6e, 0x00, 0x00, 0x8d, 0x6e, 0x00, 0x00,
-  0xc9, 0x6e, 0x00, 0x00, 0x04, 0x6f, 0x00, 0x00, 0x40, 0x6f, 0x00, 0x00,
-  0x7c, 0x6f, 0x00, 0x00, 0xb8, 0x6f, 0x00, 0x00, 0xf4, 0x6f, 0x00, 0x00,
-  0x2f, 0x70, 0x00, 0x00, 0x6b, 0x70, 0x00, 0x00, 0xa7, 0x70, 0x00, 0x00,
-  0xe3, 0x70, 0x00, 0x00, 0x1f, 0x71, 0x00, 0x00, 0x5c, 0x71, 0x00, 0x00,
-  0x98, 0x71, 0x00, 0x00, 0xd4, 0x71, 0x00, 0x00, 0x10, 0x72, 0x00, 0x00,
-  0x4c, 0x72, 0x00, 0x00, 0x89, 0x72, 0x00, 0x00, 0xc5, 0x72, 0x00, 0x00,
-  0x01, 0x73, 0x00, 0x00, 0x3e, 0x73, 0x00, 0x00, 0x7a, 0x73, 0x00, 0x00,
-  0xb7, 0x73, 0x00, 0x00, 0xf3, 0x73, 0x00, 0x00, 0x30, 0x74, 0x00, 0x00,
-  0x6d, 0x74, 0x00, 0x00, 0xa9, 0x74, 0x00, 0x00, 0xe6, 0x74, 0x00, 0x00,
-  0x23, 0x75, 0x00, 0x00, 0x60, 0x75, 0x00, 0x00, 0x9c, 0x75, 0x00, 0x00,
-  0xd9, 0x75, 0x00, 0x00, 0x16, 0x76, 0x00, 0x00, 0x53, 0x76, 0x00, 0x00,
-  0x90, 0x76, 0x00, 0x00, 0xcd, 0x76, 0x00, 0x00, 0x0a, 0x77, 0x00, 0x00,
-  0x48, 0x77, 0x00, 0x00, 0x85, 0x77, 0x00, 0x00, 0xc2, 0x77, 0x00, 0x00,
-  0xff, 0x77, 0x00, 0x00, 0x3d, 0x78, 0x00, 0x00, 0x7a, 0x78, 0x00, 0x00,
-  0xb8, 0x78, 0x00, 0x00, 0xf5, 0x78, 0x00, 0x00, 0x32, 0x79, 0x00, 0x00,
-  0x70, 0x79, 0x00, 0x00, 0xae, 0x79, 0x00, 0x00, 0xeb, 0x79, 0x00, 0x00,
-  0x29, 0x7a, 0x00, 0x00, 0x67, 0x7a, 0x00, 0x00, 0xa4, 0x7a, 0x00, 0x00,
-  0xe2, 0x7a, 0x00, 0x00, 0x20, 0x7b, 0x00, 0x00, 0x5e, 0x7b, 0x00, 0x00,
-  0x9c, 0x7b, 0x00, 0x00, 0xda, 0x7b, 0x00, 0x00, 0x18, 0x7c, 0x00, 0x00,
-  0x56, 0x7c, 0x00, 0x00, 0x94, 0x7c, 0x00, 0x00, 0xd3, 0x7c, 0x00, 0x00,
-  0x11, 0x7d, 0x00, 0x00, 0x4f, 0x7d, 0x00, 0x00, 0x8d, 0x7d, 0x00, 0x00,
-  0xcc, 0x7d, 0x00, 0x00, 0x0a, 0x7e, 0x00, 0x00, 0x49, 0x7e, 0x00, 0x00,
-  0x87, 0x7e, 0x00, 0x00, 0xc6, 0x7e, 0x00, 0x00, 0x04, 0x7f, 0x00, 0x00,
-  0x43, 0x7f, 0x00, 0x00, 0x82, 0x7f, 0x00, 0x00, 0xc1, 0x7f, 0x00, 0x00,
-  0xff, 0x7f, 0x00, 0x00, 0x3e, 0x80, 0x00, 0x00, 0x7d, 0x80, 0x00, 0x00,
-  0xbc, 0x80, 0x00, 0x00, 0xfb, 0x80, 0x00, 0x00, 0x3a, 0x81, 0x00, 0x00,
-  0x79, 0x81, 0x00, 0x00, 0xb8, 0x81, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x00,
-  0x37, 0x82, 0x00, 0x00, 0x76, 0x82, 0x00, 0x00, 0xb5, 0x82, 0x00, 0x00,
-  0xf5, 0x82, 0x00, 0x00, 0x34, 0x83, 0x00, 0x00, 0x74, 0x83, 0x00, 0x00,
-  0xb3, 0x83, 0x00, 0x00, 0xf3, 0x83, 0x00, 0x00, 0x33, 0x84, 0x00, 0x00,
-  0x72, 0x84, 0x00, 0x00, 0xb2, 0x84, 0x00, 0x00, 0xf2, 0x84, 0x00, 0x00,
-  0x32, 0x85, 0x00, 0x00, 0x72, 0x85, 0x00, 0x00, 0xb1, 0x85, 0x00, 0x00,
-  0xf1, 0x85, 0x00, 0x00, 0x32, 0x86, 0x00, 0x00, 0x72, 0x86, 0x00, 0x00,
-  0xb2, 0x86, 0x00, 0x00, 0xf2, 0x86, 0x00, 0x00, 0x32, 0x87, 0x00, 0x00,
-  0x73, 0x87, 0x00, 0x00, 0xb3, 0x87, 0x00, 0x00, 0xf3, 0x87, 0x00, 0x00,
-  0x34, 0x88, 0x00, 0x00, 0x74, 0x88, 0x00, 0x00, 0xb5, 0x88, 0x00, 0x00,
-  0xf6, 0x88, 0x00, 0x00, 0x36, 0x89, 0x00, 0x00, 0x77, 0x89, 0x00, 0x00,
-  0xb8, 0x89, 0x00, 0x00, 0xf9, 0x89, 0x00, 0x00, 0x39, 0x8a, 0x00, 0x00,
-  0x7a, 0x8a, 0x00, 0x00, 0xbb, 0x8a, 0x00, 0x00, 0xfc, 0x8a, 0x00, 0x00,
-  0x3e, 0x8b, 0x00, 0x00, 0x7f, 0x8b, 0x00, 0x00, 0xc0, 0x8b, 0x00, 0x00,
-  0x01, 0x8c, 0x00, 0x00, 0x43, 0x8c, 0x00, 0x00, 0x84, 0x8c, 0x00, 0x00,
-  0xc5, 0x8c, 0x00, 0x00, 0x07, 0x8d, 0x00, 0x00, 0x48, 0x8d, 0x00, 0x00,
-  0x8a, 0x8d, 0x00, 0x00, 0xcc, 0x8d, 0x00, 0x00, 0x0d, 0x8e, 0x00, 0x00,
-  0x4f, 0x8e, 0x00, 0x00, 0x91, 0x8e, 0x00, 0x00, 0xd3, 0x8e, 0x00, 0x00,
-  0x15, 0x8f, 0x00, 0x00, 0x57, 0x8f, 0x00, 0x00, 0x99, 0x8f, 0x00, 0x00,
-  0xdb, 0x8f, 0x00, 0x00, 0x1d, 0x90, 0x00, 0x00, 0x5f, 0x90, 0x00, 0x00,
-  0xa2, 0x90, 0x00, 0x00, 0xe4, 0x90, 0x00, 0x00, 0x26, 0x91, 0x00, 0x00,
-  0x69, 0x91, 0x00, 0x00, 0xab, 0x91, 0x00, 0x00, 0xee, 0x91, 0x00, 0x00,
-  0x31, 0x92, 0x00, 0x00, 0x73, 0x92, 0x00, 0x00, 0xb6, 0x92, 0x00, 0x00,
-  0xf9, 0x92, 0x00, 0x00, 0x3c, 0x93, 0x00, 0x00, 0x7f, 0x93, 0x00, 0x00,
-  0xc2, 0x93, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x48, 0x94, 0x00, 0x00,
-  0x8b, 0x94, 0x00, 0x00, 0xce, 0x94, 0x00, 0x00, 0x11, 0x95, 0x00, 0x00,
-  0x55, 0x95, 0x00, 0x00, 0x98, 0x95, 0x00, 0x00, 0xdc, 0x95, 0x00, 0x00,
-  0x1f, 0x96, 0x00, 0x00, 0x63, 0x96, 0x00, 0x00, 0xa6, 0x96, 0x00, 0x00,
-  0xea, 0x96, 0x00, 0x00, 0x2e, 0x97, 0x00, 0x00, 0x72, 0x97, 0x00, 0x00,
-  0xb5, 0x97, 0x00, 0x00, 0xf9, 0x97, 0x00, 0x00, 0x3d, 0x98, 0x00, 0x00,
-  0x82, 0x98, 0x00, 0x00, 0xc6, 0x98, 0x00, 0x00, 0x0a, 0x99, 0x00, 0x00,
-  0x4e, 0x99, 0x00, 0x00, 0x92, 0x99, 0x00, 0x00, 0xd7, 0x99, 0x00, 0x00,
-  0x1b, 0x9a, 0x00, 0x00, 0x60, 0x9a, 0x00, 0x00, 0xa4, 0x9a, 0x00, 0x00,
-  0xe9, 0x9a, 0x00, 0x00, 0x2e, 0x9b, 0x00, 0x00, 0x72, 0x9b, 0x00, 0x00,
-  0xb7, 0x9b, 0x00, 0x00, 0xfc, 0x9b, 0x00, 0x00, 0x41, 0x9c, 0x00, 0x00,
-  0x86, 0x9c, 0x00, 0x00, 0xcb, 0x9c, 0x00, 0x00, 0x10, 0x9d, 0x00, 0x00,
-  0x56, 0x9d, 0x00, 0x00, 0x9b, 0x9d, 0x00, 0x00, 0xe0, 0x9d, 0x00, 0x00,
-  0x26, 0x9e, 0x00, 0x00, 0x6b, 0x9e, 0x00, 0x00, 0xb1, 0x9e, 0x00, 0x00,
-  0xf6, 0x9e, 0x00, 0x00, 0x3c, 0x9f, 0x00, 0x00, 0x82, 0x9f, 0x00, 0x00,
-  0xc8, 0x9f, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x53, 0xa0, 0x00, 0x00,
-  0x99, 0xa0, 0x00, 0x00, 0xe0, 0xa0, 0x00, 0x00, 0x26, 0xa1, 0x00, 0x00,
-  0x6c, 0xa1, 0x00, 0x00, 0xb2, 0xa1, 0x00, 0x00, 0xf9, 0xa1, 0x00, 0x00,
-  0x3f, 0xa2, 0x00, 0x00, 0x85, 0xa2, 0x00, 0x00, 0xcc, 0xa2, 0x00, 0x00,
-  0x13, 0xa3, 0x00, 0x00, 0x59, 0xa3, 0x00, 0x00, 0xa0, 0xa3, 0x00, 0x00,
-  0xe7, 0xa3, 0x00, 0x00, 0x2e, 0xa4, 0x00, 0x00, 0x75, 0xa4, 0x00, 0x00,
-  0xbc, 0xa4, 0x00, 0x00, 0x03, 0xa5, 0x00, 0x00, 0x4a, 0xa5, 0x00, 0x00,
-  0x91, 0xa5, 0x00, 0x00, 0xd9, 0xa5, 0x00, 0x00, 0x20, 0xa6, 0x00, 0x00,
-  0x68, 0xa6, 0x00, 0x00, 0xaf, 0xa6, 0x00, 0x00, 0xf7, 0xa6, 0x00, 0x00,
-  0x3e, 0xa7, 0x00, 0x00, 0x86, 0xa7, 0x00, 0x00, 0xce, 0xa7, 0x00, 0x00,
-  0x16, 0xa8, 0x00, 0x00, 0x5e, 0xa8, 0x00, 0x00, 0xa6, 0xa8, 0x00, 0x00,
-  0xee, 0xa8, 0x00, 0x00, 0x36, 0xa9, 0x00, 0x00, 0x7e, 0xa9, 0x00, 0x00,
-  0xc7, 0xa9, 0x00, 0x00, 0x0f, 0xaa, 0x00, 0x00, 0x58, 0xaa, 0x00, 0x00,
-  0xa0, 0xaa, 0x00, 0x00, 0xe9, 0xaa, 0x00, 0x00, 0x32, 0xab, 0x00, 0x00,
-  0x7a, 0xab, 0x00, 0x00, 0xc3, 0xab, 0x00, 0x00, 0x0c, 0xac, 0x00, 0x00,
-  0x55, 0xac, 0x00, 0x00, 0x9e, 0xac, 0x00, 0x00, 0xe7, 0xac, 0x00, 0x00,
-  0x31, 0xad, 0x00, 0x00, 0x7a, 0xad, 0x00, 0x00, 0xc3, 0xad, 0x00, 0x00,
-  0x0d, 0xae, 0x00, 0x00, 0x56, 0xae, 0x00, 0x00, 0xa0, 0xae, 0x00, 0x00,
-  0xea, 0xae, 0x00, 0x00, 0x33, 0xaf, 0x00, 0x00, 0x7d, 0xaf, 0x00, 0x00,
-  0xc7, 0xaf, 0x00, 0x00, 0x11, 0xb0, 0x00, 0x00, 0x5b, 0xb0, 0x00, 0x00,
-  0xa5, 0xb0, 0x00, 0x00, 0xf0, 0xb0, 0x00, 0x00, 0x3a, 0xb1, 0x00, 0x00,
-  0x84, 0xb1, 0x00, 0x00, 0xcf, 0xb1, 0x00, 0x00, 0x19, 0xb2, 0x00, 0x00,
-  0x64, 0xb2, 0x00, 0x00, 0xaf, 0xb2, 0x00, 0x00, 0xfa, 0xb2, 0x00, 0x00,
-  0x44, 0xb3, 0x00, 0x00, 0x8f, 0xb3, 0x00, 0x00, 0xda, 0xb3, 0x00, 0x00,
-  0x26, 0xb4, 0x00, 0x00, 0x71, 0xb4, 0x00, 0x00, 0xbc, 0xb4, 0x00, 0x00,
-  0x07, 0xb5, 0x00, 0x00, 0x53, 0xb5, 0x00, 0x00, 0x9e, 0xb5, 0x00, 0x00,
-  0xea, 0xb5, 0x00, 0x00, 0x36, 0xb6, 0x00, 0x00, 0x81, 0xb6, 0x00, 0x00,
-  0xcd, 0xb6, 0x00, 0x00, 0x19, 0xb7, 0x00, 0x00, 0x65, 0xb7, 0x00, 0x00,
-  0xb1, 0xb7, 0x00, 0x00, 0xfe, 0xb7, 0x00, 0x00, 0x4a, 0xb8, 0x00, 0x00,
-  0x96, 0xb8, 0x00, 0x00, 0xe3, 0xb8, 0x00, 0x00, 0x2f, 0xb9, 0x00, 0x00,
-  0x7c, 0xb9, 0x00, 0x00, 0xc8, 0xb9, 0x00, 0x00, 0x15, 0xba, 0x00, 0x00,
-  0x62, 0xba, 0x00, 0x00, 0xaf, 0xba, 0x00, 0x00, 0xfc, 0xba, 0x00, 0x00,
-  0x49, 0xbb, 0x00, 0x00, 0x96, 0xbb, 0x00, 0x00, 0xe4, 0xbb, 0x00, 0x00,
-  0x31, 0xbc, 0x00, 0x00, 0x7f, 0xbc, 0x00, 0x00, 0xcc, 0xbc, 0x00, 0x00,
-  0x1a, 0xbd, 0x00, 0x00, 0x68, 0xbd, 0x00, 0x00, 0xb5, 0xbd, 0x00, 0x00,
-  0x03, 0xbe, 0x00, 0x00, 0x51, 0xbe, 0x00, 0x00, 0x9f, 0xbe, 0x00, 0x00,
-  0xee, 0xbe, 0x00, 0x00, 0x3c, 0xbf, 0x00, 0x00, 0x8a, 0xbf, 0x00, 0x00,
-  0xd9, 0xbf, 0x00, 0x00, 0x27, 0xc0, 0x00, 0x00, 0x76, 0xc0, 0x00, 0x00,
-  0xc5, 0xc0, 0x00, 0x00, 0x13, 0xc1, 0x00, 0x00, 0x62, 0xc1, 0x00, 0x00,
-  0xb1, 0xc1, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x50, 0xc2, 0x00, 0x00,
-  0x9f, 0xc2, 0x00, 0x00, 0xee, 0xc2, 0x00, 0x00, 0x3e, 0xc3, 0x00, 0x00,
-  0x8d, 0xc3, 0x00, 0x00, 0xdd, 0xc3, 0x00, 0x00, 0x2d, 0xc4, 0x00, 0x00,
-  0x7c, 0xc4, 0x00, 0x00, 0xcc, 0xc4, 0x00, 0x00, 0x1c, 0xc5, 0x00, 0x00,
-  0x6c, 0xc5, 0x00, 0x00, 0xbd, 0xc5, 0x00, 0x00, 0x0d, 0xc6, 0x00, 0x00,
-  0x5d, 0xc6, 0x00, 0x00, 0xae, 0xc6, 0x00, 0x00, 0xfe, 0xc6, 0x00, 0x00,
-  0x4f, 0xc7, 0x00, 0x00, 0xa0, 0xc7, 0x00, 0x00, 0xf1, 0xc7, 0x00, 0x00,
-  0x42, 0xc8, 0x00, 0x00, 0x93, 0xc8, 0x00, 0x00, 0xe4, 0xc8, 0x00, 0x00,
-  0x35, 0xc9, 0x00, 0x00, 0x87, 0xc9, 0x00, 0x00, 0xd8, 0xc9, 0x00, 0x00,
-  0x2a, 0xca, 0x00, 0x00, 0x7b, 0xca, 0x00, 0x00, 0xcd, 0xca, 0x00, 0x00,
-  0x1f, 0xcb, 0x00, 0x00, 0x71, 0xcb, 0x00, 0x00, 0xc3, 0xcb, 0x00, 0x00,
-  0x15, 0xcc, 0x00, 0x00, 0x67, 0xcc, 0x00, 0x00, 0xba, 0xcc, 0x00, 0x00,
-  0x0c, 0xcd, 0x00, 0x00, 0x5f, 0xcd, 0x00, 0x00, 0xb1, 0xcd, 0x00, 0x00,
-  0x04, 0xce, 0x00, 0x00, 0x57, 0xce, 0x00, 0x00, 0xaa, 0xce, 0x00, 0x00,
-  0xfd, 0xce, 0x00, 0x00, 0x50, 0xcf, 0x00, 0x00, 0xa4, 0xcf, 0x00, 0x00,
-  0xf7, 0xcf, 0x00, 0x00, 0x4a, 0xd0, 0x00, 0x00, 0x9e, 0xd0, 0x00, 0x00,
-  0xf2, 0xd0, 0x00, 0x00, 0x46, 0xd1, 0x00, 0x00, 0x99, 0xd1, 0x00, 0x00,
-  0xed, 0xd1, 0x00, 0x00, 0x42, 0xd2, 0x00, 0x00, 0x96, 0xd2, 0x00, 0x00,
-  0xea, 0xd2, 0x00, 0x00, 0x3f, 0xd3, 0x00, 0x00, 0x93, 0xd3, 0x00, 0x00,
-  0xe8, 0xd3, 0x00, 0x00, 0x3d, 0xd4, 0x00, 0x00, 0x91, 0xd4, 0x00, 0x00,
-  0xe6, 0xd4, 0x00, 0x00, 0x3b, 0xd5, 0x00, 0x00, 0x91, 0xd5, 0x00, 0x00,
-  0xe6, 0xd5, 0x00, 0x00, 0x3b, 0xd6, 0x00, 0x00, 0x91, 0xd6, 0x00, 0x00,
-  0xe7, 0xd6, 0x00, 0x00, 0x3c, 0xd7, 0x00, 0x00, 0x92, 0xd7, 0x00, 0x00,
-  0xe8, 0xd7, 0x00, 0x00, 0x3e, 0xd8, 0x00, 0x00, 0x94, 0xd8, 0x00, 0x00,
-  0xeb, 0xd8, 0x00, 0x00, 0x41, 0xd9, 0x00, 0x00, 0x98, 0xd9, 0x00, 0x00,
-  0xee, 0xd9, 0x00, 0x00, 0x45, 0xda, 0x00, 0x00, 0x9c, 0xda, 0x00, 0x00,
-  0xf3, 0xda, 0x00, 0x00, 0x4a, 0xdb, 0x00, 0x00, 0xa1, 0xdb, 0x00, 0x00,
-  0xf8, 0xdb, 0x00, 0x00, 0x50, 0xdc, 0x00, 0x00, 0xa7, 0xdc, 0x00, 0x00,
-  0xff, 0xdc, 0x00, 0x00, 0x57, 0xdd, 0x00, 0x00, 0xaf, 0xdd, 0x00, 0x00,
-  0x07, 0xde, 0x00, 0x00, 0x5f, 0xde, 0x00, 0x00, 0xb7, 0xde, 0x00, 0x00,
-  0x10, 0xdf, 0x00, 0x00, 0x68, 0xdf, 0x00, 0x00, 0xc1, 0xdf, 0x00, 0x00,
-  0x19, 0xe0, 0x00, 0x00, 0x72, 0xe0, 0x00, 0x00, 0xcb, 0xe0, 0x00, 0x00,
-  0x24, 0xe1, 0x00, 0x00, 0x7d, 0xe1, 0x00, 0x00, 0xd7, 0xe1, 0x00, 0x00,
-  0x30, 0xe2, 0x00, 0x00, 0x8a, 0xe2, 0x00, 0x00, 0xe3, 0xe2, 0x00, 0x00,
-  0x3d, 0xe3, 0x00, 0x00, 0x97, 0xe3, 0x00, 0x00, 0xf1, 0xe3, 0x00, 0x00,
-  0x4b, 0xe4, 0x00, 0x00, 0xa6, 0xe4, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00,
-  0x5b, 0xe5, 0x00, 0x00, 0xb5, 0xe5, 0x00, 0x00, 0x10, 0xe6, 0x00, 0x00,
-  0x6b, 0xe6, 0x00, 0x00, 0xc6, 0xe6, 0x00, 0x00, 0x21, 0xe7, 0x00, 0x00,
-  0x7d, 0xe7, 0x00, 0x00, 0xd8, 0xe7, 0x00, 0x00, 0x34, 0xe8, 0x00, 0x00,
-  0x8f, 0xe8, 0x00, 0x00, 0xeb, 0xe8, 0x00, 0x00, 0x47, 0xe9, 0x00, 0x00,
-  0xa3, 0xe9, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x5c, 0xea, 0x00, 0x00,
-  0xb8, 0xea, 0x00, 0x00, 0x15, 0xeb, 0x00, 0x00, 0x71, 0xeb, 0x00, 0x00,
-  0xce, 0xeb, 0x00, 0x00, 0x2b, 0xec, 0x00, 0x00, 0x88, 0xec, 0x00, 0x00,
-  0xe6, 0xec, 0x00, 0x00, 0x43, 0xed, 0x00, 0x00, 0xa1, 0xed, 0x00, 0x00,
-  0xfe, 0xed, 0x00, 0x00, 0x5c, 0xee, 0x00, 0x00, 0xba, 0xee, 0x00, 0x00,
-  0x18, 0xef, 0x00, 0x00, 0x76, 0xef, 0x00, 0x00, 0xd4, 0xef, 0x00, 0x00,
-  0x33, 0xf0, 0x00, 0x00, 0x91, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00,
-  0x4f, 0xf1, 0x00, 0x00, 0xae, 0xf1, 0x00, 0x00, 0x0d, 0xf2, 0x00, 0x00,
-  0x6c, 0xf2, 0x00, 0x00, 0xcc, 0xf2, 0x00, 0x00, 0x2b, 0xf3, 0x00, 0x00,
-  0x8b, 0xf3, 0x00, 0x00, 0xeb, 0xf3, 0x00, 0x00, 0x4b, 0xf4, 0x00, 0x00,
-  0xab, 0xf4, 0x00, 0x00, 0x0b, 0xf5, 0x00, 0x00, 0x6c, 0xf5, 0x00, 0x00,
-  0xcc, 0xf5, 0x00, 0x00, 0x2d, 0xf6, 0x00, 0x00, 0x8e, 0xf6, 0x00, 0x00,
-  0xef, 0xf6, 0x00, 0x00, 0x50, 0xf7, 0x00, 0x00, 0xb1, 0xf7, 0x00, 0x00,
-  0x12, 0xf8, 0x00, 0x00, 0x74, 0xf8, 0x00, 0x00, 0xd6, 0xf8, 0x00, 0x00,
-  0x37, 0xf9, 0x00, 0x00, 0x99, 0xf9, 0x00, 0x00, 0xfc, 0xf9, 0x00, 0x00,
-  0x5e, 0xfa, 0x00, 0x00, 0xc0, 0xfa, 0x00, 0x00, 0x23, 0xfb, 0x00, 0x00,
-  0x85, 0xfb, 0x00, 0x00, 0xe8, 0xfb, 0x00, 0x00, 0x4b, 0xfc, 0x00, 0x00,
-  0xaf, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0x00, 0x00, 0x75, 0xfd, 0x00, 0x00,
-  0xd9, 0xfd, 0x00, 0x00, 0x3d, 0xfe, 0x00, 0x00, 0xa1, 0xfe, 0x00, 0x00,
-  0x05, 0xff, 0x00, 0x00, 0x69, 0xff, 0x00, 0x00, 0xcd, 0xff, 0x00, 0x00,
-  0x32, 0x00, 0x01, 0x00, 0x96, 0x00, 0x01, 0x00, 0xfb, 0x00, 0x01, 0x00,
-  0x60, 0x01, 0x01, 0x00, 0xc5, 0x01, 0x01, 0x00, 0x2b, 0x02, 0x01, 0x00,
-  0x90, 0x02, 0x01, 0x00, 0xf6, 0x02, 0x01, 0x00, 0x5c, 0x03, 0x01, 0x00,
-  0xc2, 0x03, 0x01, 0x00, 0x28, 0x04, 0x01, 0x00, 0x8e, 0x04, 0x01, 0x00,
-  0xf4, 0x04, 0x01, 0x00, 0x5b, 0x05, 0x01, 0x00, 0xc2, 0x05, 0x01, 0x00,
-  0x29, 0x06, 0x01, 0x00, 0x90, 0x06, 0x01, 0x00, 0xf7, 0x06, 0x01, 0x00,
-  0x5e, 0x07, 0x01, 0x00, 0xc6, 0x07, 0x01, 0x00, 0x2d, 0x08, 0x01, 0x00,
-  0x95, 0x08, 0x01, 0x00, 0xfd, 0x08, 0x01, 0x00, 0x66, 0x09, 0x01, 0x00,
-  0xce, 0x09, 0x01, 0x00, 0x37, 0x0a, 0x01, 0x00, 0x9f, 0x0a, 0x01, 0x00,
-  0x08, 0x0b, 0x01, 0x00, 0x71, 0x0b, 0x01, 0x00, 0xda, 0x0b, 0x01, 0x00,
-  0x44, 0x0c, 0x01, 0x00, 0xad, 0x0c, 0x01, 0x00, 0x17, 0x0d, 0x01, 0x00,
-  0x81, 0x0d, 0x01, 0x00, 0xeb, 0x0d, 0x01, 0x00, 0x55, 0x0e, 0x01, 0x00,
-  0xc0, 0x0e, 0x01, 0x00, 0x2a, 0x0f, 0x01, 0x00, 0x95, 0x0f, 0x01, 0x00,
-  0x00, 0x10, 0x01, 0x00, 0x6b, 0x10, 0x01, 0x00, 0xd6, 0x10, 0x01, 0x00,
-  0x42, 0x11, 0x01, 0x00, 0xad, 0x11, 0x01, 0x00, 0x19, 0x12, 0x01, 0x00,
-  0x85, 0x12, 0x01, 0x00, 0xf1, 0x12, 0x01, 0x00, 0x5e, 0x13, 0x01, 0x00,
-  0xca, 0x13, 0x01, 0x00, 0x37, 0x14, 0x01, 0x00, 0xa4, 0x14, 0x01, 0x00,
-  0x11, 0x15, 0x01, 0x00, 0x7e, 0x15, 0x01, 0x00, 0xeb, 0x15, 0x01, 0x00,
-  0x59, 0x16, 0x01, 0x00, 0xc7, 0x16, 0x01, 0x00, 0x35, 0x17, 0x01, 0x00,
-  0xa3, 0x17, 0x01, 0x00, 0x11, 0x18, 0x01, 0x00, 0x80, 0x18, 0x01, 0x00,
-  0xee, 0x18, 0x01, 0x00, 0x5d, 0x19, 0x01, 0x00, 0xcc, 0x19, 0x01, 0x00,
-  0x3c, 0x1a, 0x01, 0x00, 0xab, 0x1a, 0x01, 0x00, 0x1b, 0x1b, 0x01, 0x00,
-  0x8b, 0x1b, 0x01, 0x00, 0xfb, 0x1b, 0x01, 0x00, 0x6b, 0x1c, 0x01, 0x00,
-  0xdb, 0x1c, 0x01, 0x00, 0x4c, 0x1d, 0x01, 0x00, 0xbd, 0x1d, 0x01, 0x00,
-  0x2e, 0x1e, 0x01, 0x00, 0x9f, 0x1e, 0x01, 0x00, 0x10, 0x1f, 0x01, 0x00,
-  0x82, 0x1f, 0x01, 0x00, 0xf3, 0x1f, 0x01, 0x00, 0x65, 0x20, 0x01, 0x00,
-  0xd8, 0x20, 0x01, 0x00, 0x4a, 0x21, 0x01, 0x00, 0xbc, 0x21, 0x01, 0x00,
-  0x2f, 0x22, 0x01, 0x00, 0xa2, 0x22, 0x01, 0x00, 0x15, 0x23, 0x01, 0x00,
-  0x89, 0x23, 0x01, 0x00, 0xfc, 0x23, 0x01, 0x00, 0x70, 0x24, 0x01, 0x00,
-  0xe4, 0x24, 0x01, 0x00, 0x58, 0x25, 0x01, 0x00, 0xcd, 0x25, 0x01, 0x00,
-  0x41, 0x26, 0x01, 0x00, 0xb6, 0x26, 0x01, 0x00, 0x2b, 0x27, 0x01, 0x00,
-  0xa0, 0x27, 0x01, 0x00, 0x15, 0x28, 0x01, 0x00, 0x8b, 0x28, 0x01, 0x00,
-  0x01, 0x29, 0x01, 0x00, 0x77, 0x29, 0x01, 0x00, 0xed, 0x29, 0x01, 0x00,
-  0x64, 0x2a, 0x01, 0x00, 0xda, 0x2a, 0x01, 0x00, 0x51, 0x2b, 0x01, 0x00,
-  0xc8, 0x2b, 0x01, 0x00, 0x40, 0x2c, 0x01, 0x00, 0xb7, 0x2c, 0x01, 0x00,
-  0x2f, 0x2d, 0x01, 0x00, 0xa7, 0x2d, 0x01, 0x00, 0x1f, 0x2e, 0x01, 0x00,
-  0x97, 0x2e, 0x01, 0x00, 0x10, 0x2f, 0x01, 0x00, 0x89, 0x2f, 0x01, 0x00,
-  0x02, 0x30, 0x01, 0x00, 0x7b, 0x30, 0x01, 0x00, 0xf4, 0x30, 0x01, 0x00,
-  0x6e, 0x31, 0x01, 0x00, 0xe8, 0x31, 0x01, 0x00, 0x62, 0x32, 0x01, 0x00,
-  0xdd, 0x32, 0x01, 0x00, 0x57, 0x33, 0x01, 0x00, 0xd2, 0x33, 0x01, 0x00,
-  0x4d, 0x34, 0x01, 0x00, 0xc8, 0x34, 0x01, 0x00, 0x44, 0x35, 0x01, 0x00,
-  0xc0, 0x35, 0x01, 0x00, 0x3c, 0x36, 0x01, 0x00, 0xb8, 0x36, 0x01, 0x00,
-  0x34, 0x37, 0x01, 0x00, 0xb1, 0x37, 0x01, 0x00, 0x2e, 0x38, 0x01, 0x00,
-  0xab, 0x38, 0x01, 0x00, 0x28, 0x39, 0x01, 0x00, 0xa6, 0x39, 0x01, 0x00,
-  0x24, 0x3a, 0x01, 0x00, 0xa2, 0x3a, 0x01, 0x00, 0x20, 0x3b, 0x01, 0x00,
-  0x9f, 0x3b, 0x01, 0x00, 0x1d, 0x3c, 0x01, 0x00, 0x9d, 0x3c, 0x01, 0x00,
-  0x1c, 0x3d, 0x01, 0x00, 0x9b, 0x3d, 0x01, 0x00, 0x1b, 0x3e, 0x01, 0x00,
-  0x9b, 0x3e, 0x01, 0x00, 0x1b, 0x3f, 0x01, 0x00, 0x9c, 0x3f, 0x01, 0x00,
-  0x1d, 0x40, 0x01, 0x00, 0x9e, 0x40, 0x01, 0x00, 0x1f, 0x41, 0x01, 0x00,
-  0xa0, 0x41, 0x01, 0x00, 0x22, 0x42, 0x01, 0x00, 0xa4, 0x42, 0x01, 0x00,
-  0x26, 0x43, 0x01, 0x00, 0xa9, 0x43, 0x01, 0x00, 0x2b, 0x44, 0x01, 0x00,
-  0xae, 0x44, 0x01, 0x00, 0x32, 0x45, 0x01, 0x00, 0xb5, 0x45, 0x01, 0x00,
-  0x39, 0x46, 0x01, 0x00, 0xbd, 0x46, 0x01, 0x00, 0x41, 0x47, 0x01, 0x00,
-  0xc6, 0x47, 0x01, 0x00, 0x4b, 0x48, 0x01, 0x00, 0xd0, 0x48, 0x01, 0x00,
-  0x55, 0x49, 0x01, 0x00, 0xdb, 0x49, 0x01, 0x00, 0x60, 0x4a, 0x01, 0x00,
-  0xe6, 0x4a, 0x01, 0x00, 0x6d, 0x4b, 0x01, 0x00, 0xf4, 0x4b, 0x01, 0x00,
-  0x7a, 0x4c, 0x01, 0x00, 0x02, 0x4d, 0x01, 0x00, 0x89, 0x4d, 0x01, 0x00,
-  0x11, 0x4e, 0x01, 0x00, 0x99, 0x4e, 0x01, 0x00, 0x21, 0x4f, 0x01, 0x00,
-  0xaa, 0x4f, 0x01, 0x00, 0x32, 0x50, 0x01, 0x00, 0xbc, 0x50, 0x01, 0x00,
-  0x45, 0x51, 0x01, 0x00, 0xcf, 0x51, 0x01, 0x00, 0x58, 0x52, 0x01, 0x00,
-  0xe3, 0x52, 0x01, 0x00, 0x6d, 0x53, 0x01, 0x00, 0xf8, 0x53, 0x01, 0x00,
-  0x83, 0x54, 0x01, 0x00, 0x0e, 0x55, 0x01, 0x00, 0x9a, 0x55, 0x01, 0x00,
-  0x26, 0x56, 0x01, 0x00, 0xb2, 0x56, 0x01, 0x00, 0x3f, 0x57, 0x01, 0x00,
-  0xcb, 0x57, 0x01, 0x00, 0x58, 0x58, 0x01, 0x00, 0xe6, 0x58, 0x01, 0x00,
-  0x73, 0x59, 0x01, 0x00, 0x01, 0x5a, 0x01, 0x00, 0x90, 0x5a, 0x01, 0x00,
-  0x1e, 0x5b, 0x01, 0x00, 0xad, 0x5b, 0x01, 0x00, 0x3c, 0x5c, 0x01, 0x00,
-  0xcc, 0x5c, 0x01, 0x00, 0x5b, 0x5d, 0x01, 0x00, 0xeb, 0x5d, 0x01, 0x00,
-  0x7c, 0x5e, 0x01, 0x00, 0x0c, 0x5f, 0x01, 0x00, 0x9d, 0x5f, 0x01, 0x00,
-  0x2e, 0x60, 0x01, 0x00, 0xc0, 0x60, 0x01, 0x00, 0x52, 0x61, 0x01, 0x00,
-  0xe4, 0x61, 0x01, 0x00, 0x76, 0x62, 0x01, 0x00, 0x09, 0x63, 0x01, 0x00,
-  0x9c, 0x63, 0x01, 0x00, 0x30, 0x64, 0x01, 0x00, 0xc4, 0x64, 0x01, 0x00,
-  0x58, 0x65, 0x01, 0x00, 0xec, 0x65, 0x01, 0x00, 0x81, 0x66, 0x01, 0x00,
-  0x16, 0x67, 0x01, 0x00, 0xab, 0x67, 0x01, 0x00, 0x41, 0x68, 0x01, 0x00,
-  0xd7, 0x68, 0x01, 0x00, 0x6d, 0x69, 0x01, 0x00, 0x03, 0x6a, 0x01, 0x00,
-  0x9a, 0x6a, 0x01, 0x00, 0x32, 0x6b, 0x01, 0x00, 0xc9, 0x6b, 0x01, 0x00,
-  0x61, 0x6c, 0x01, 0x00, 0xfa, 0x6c, 0x01, 0x00, 0x92, 0x6d, 0x01, 0x00,
-  0x2b, 0x6e, 0x01, 0x00, 0xc4, 0x6e, 0x01, 0x00, 0x5e, 0x6f, 0x01, 0x00,
-  0xf8, 0x6f, 0x01, 0x00, 0x92, 0x70, 0x01, 0x00, 0x2d, 0x71, 0x01, 0x00,
-  0xc8, 0x71, 0x01, 0x00, 0x63, 0x72, 0x01, 0x00, 0xff, 0x72, 0x01, 0x00,
-  0x9b, 0x73, 0x01, 0x00, 0x37, 0x74, 0x01, 0x00, 0xd4, 0x74, 0x01, 0x00,
-  0x71, 0x75, 0x01, 0x00, 0x0e, 0x76, 0x01, 0x00, 0xac, 0x76, 0x01, 0x00,
-  0x4a, 0x77, 0x01, 0x00, 0xe9, 0x77, 0x01, 0x00, 0x87, 0x78, 0x01, 0x00,
-  0x27, 0x79, 0x01, 0x00, 0xc6, 0x79, 0x01, 0x00, 0x66, 0x7a, 0x01, 0x00,
-  0x06, 0x7b, 0x01, 0x00, 0xa7, 0x7b, 0x01, 0x00, 0x48, 0x7c, 0x01, 0x00,
-  0xe9, 0x7c, 0x01, 0x00, 0x8b, 0x7d, 0x01, 0x00, 0x2d, 0x7e, 0x01, 0x00,
-  0xd0, 0x7e, 0x01, 0x00, 0x73, 0x7f, 0x01, 0x00, 0x16, 0x80, 0x01, 0x00,
-  0xb9, 0x80, 0x01, 0x00, 0x5d, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00,
-  0xa6, 0x82, 0x01, 0x00, 0x4c, 0x83, 0x01, 0x00, 0xf1, 0x83, 0x01, 0x00,
-  0x97, 0x84, 0x01, 0x00, 0x3d, 0x85, 0x01, 0x00, 0xe4, 0x85, 0x01, 0x00,
-  0x8b, 0x86, 0x01, 0x00, 0x32, 0x87, 0x01, 0x00, 0xda, 0x87, 0x01, 0x00,
-  0x82, 0x88, 0x01, 0x00, 0x2b, 0x89, 0x01, 0x00, 0xd4, 0x89, 0x01, 0x00,
-  0x7e, 0x8a, 0x01, 0x00, 0x27, 0x8b, 0x01, 0x00, 0xd2, 0x8b, 0x01, 0x00,
-  0x7c, 0x8c, 0x01, 0x00, 0x27, 0x8d, 0x01, 0x00, 0xd3, 0x8d, 0x01, 0x00,
-  0x7f, 0x8e, 0x01, 0x00, 0x2b, 0x8f, 0x01, 0x00, 0xd8, 0x8f, 0x01, 0x00,
-  0x85, 0x90, 0x01, 0x00, 0x32, 0x91, 0x01, 0x00, 0xe0, 0x91, 0x01, 0x00,
-  0x8e, 0x92, 0x01, 0x00, 0x3d, 0x93, 0x01, 0x00, 0xec, 0x93, 0x01, 0x00,
-  0x9c, 0x94, 0x01, 0x00, 0x4c, 0x95, 0x01, 0x00, 0xfd, 0x95, 0x01, 0x00,
-  0xad, 0x96, 0x01, 0x00, 0x5f, 0x97, 0x01, 0x00, 0x11, 0x98, 0x01, 0x00,
-  0xc3, 0x98, 0x01, 0x00, 0x75, 0x99, 0x01, 0x00, 0x28, 0x9a, 0x01, 0x00,
-  0xdc, 0x9a, 0x01, 0x00, 0x90, 0x9b, 0x01, 0x00, 0x44, 0x9c, 0x01, 0x00,
-  0xf9, 0x9c, 0x01, 0x00, 0xae, 0x9d, 0x01, 0x00, 0x64, 0x9e, 0x01, 0x00,
-  0x1a, 0x9f, 0x01, 0x00, 0xd1, 0x9f, 0x01, 0x00, 0x88, 0xa0, 0x01, 0x00,
-  0x40, 0xa1, 0x01, 0x00, 0xf8, 0xa1, 0x01, 0x00, 0xb0, 0xa2, 0x01, 0x00,
-  0x69, 0xa3, 0x01, 0x00, 0x23, 0xa4, 0x01, 0x00, 0xdd, 0xa4, 0x01, 0x00,
-  0x97, 0xa5, 0x01, 0x00, 0x52, 0xa6, 0x01, 0x00, 0x0d, 0xa7, 0x01, 0x00,
-  0xc9, 0xa7, 0x01, 0x00, 0x85, 0xa8, 0x01, 0x00, 0x42, 0xa9, 0x01, 0x00,
-  0xff, 0xa9, 0x01, 0x00, 0xbd, 0xaa, 0x01, 0x00, 0x7b, 0xab, 0x01, 0x00,
-  0x3a, 0xac, 0x01, 0x00, 0xf9, 0xac, 0x01, 0x00, 0xb8, 0xad, 0x01, 0x00,
-  0x78, 0xae, 0x01, 0x00, 0x39, 0xaf, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00,
-  0xbc, 0xb0, 0x01, 0x00, 0x7e, 0xb1, 0x01, 0x00, 0x41, 0xb2, 0x01, 0x00,
-  0x04, 0xb3, 0x01, 0x00, 0xc8, 0xb3, 0x01, 0x00, 0x8c, 0xb4, 0x01, 0x00,
-  0x50, 0xb5, 0x01, 0x00, 0x16, 0xb6, 0x01, 0x00, 0xdb, 0xb6, 0x01, 0x00,
-  0xa2, 0xb7, 0x01, 0x00, 0x68, 0xb8, 0x01, 0x00, 0x30, 0xb9, 0x01, 0x00,
-  0xf7, 0xb9, 0x01, 0x00, 0xc0, 0xba, 0x01, 0x00, 0x89, 0xbb, 0x01, 0x00,
-  0x52, 0xbc, 0x01, 0x00, 0x1c, 0xbd, 0x01, 0x00, 0xe7, 0xbd, 0x01, 0x00,
-  0xb2, 0xbe, 0x01, 0x00, 0x7d, 0xbf, 0x01, 0x00, 0x49, 0xc0, 0x01, 0x00,
-  0x16, 0xc1, 0x01, 0x00, 0xe3, 0xc1, 0x01, 0x00, 0xb1, 0xc2, 0x01, 0x00,
-  0x7f, 0xc3, 0x01, 0x00, 0x4e, 0xc4, 0x01, 0x00, 0x1e, 0xc5, 0x01, 0x00,
-  0xee, 0xc5, 0x01, 0x00, 0xbe, 0xc6, 0x01, 0x00, 0x8f, 0xc7, 0x01, 0x00,
-  0x61, 0xc8, 0x01, 0x00, 0x34, 0xc9, 0x01, 0x00, 0x06, 0xca, 0x01, 0x00,
-  0xda, 0xca, 0x01, 0x00, 0xae, 0xcb, 0x01, 0x00, 0x83, 0xcc, 0x01, 0x00,
-  0x58, 0xcd, 0x01, 0x00, 0x2e, 0xce, 0x01, 0x00, 0x04, 0xcf, 0x01, 0x00,
-  0xdb, 0xcf, 0x01, 0x00, 0xb3, 0xd0, 0x01, 0x00, 0x8b, 0xd1, 0x01, 0x00,
-  0x64, 0xd2, 0x01, 0x00, 0x3d, 0xd3, 0x01, 0x00, 0x17, 0xd4, 0x01, 0x00,
-  0xf2, 0xd4, 0x01, 0x00, 0xcd, 0xd5, 0x01, 0x00, 0xa9, 0xd6, 0x01, 0x00,
-  0x85, 0xd7, 0x01, 0x00, 0x62, 0xd8, 0x01, 0x00, 0x40, 0xd9, 0x01, 0x00,
-  0x1e, 0xda, 0x01, 0x00, 0xfd, 0xda, 0x01, 0x00, 0xdd, 0xdb, 0x01, 0x00,
-  0xbd, 0xdc, 0x01, 0x00, 0x9e, 0xdd, 0x01, 0x00, 0x80, 0xde, 0x01, 0x00,
-  0x62, 0xdf, 0x01, 0x00, 0x45, 0xe0, 0x01, 0x00, 0x28, 0xe1, 0x01, 0x00,
-  0x0c, 0xe2, 0x01, 0x00, 0xf1, 0xe2, 0x01, 0x00, 0xd7, 0xe3, 0x01, 0x00,
-  0xbd, 0xe4, 0x01, 0x00, 0xa4, 0xe5, 0x01, 0x00, 0x8b, 0xe6, 0x01, 0x00,
-  0x73, 0xe7, 0x01, 0x00, 0x5c, 0xe8, 0x01, 0x00, 0x46, 0xe9, 0x01, 0x00,
-  0x30, 0xea, 0x01, 0x00, 0x1b, 0xeb, 0x01, 0x00, 0x07, 0xec, 0x01, 0x00,
-  0xf3, 0xec, 0x01, 0x00, 0xe0, 0xed, 0x01, 0x00, 0xcd, 0xee, 0x01, 0x00,
-  0xbc, 0xef, 0x01, 0x00, 0xab, 0xf0, 0x01, 0x00, 0x9b, 0xf1, 0x01, 0x00,
-  0x8b, 0xf2, 0x01, 0x00, 0x7d, 0xf3, 0x01, 0x00, 0x6f, 0xf4, 0x01, 0x00,
-  0x61, 0xf5, 0x01, 0x00, 0x55, 0xf6, 0x01, 0x00, 0x49, 0xf7, 0x01, 0x00,
-  0x3e, 0xf8, 0x01, 0x00, 0x34, 0xf9, 0x01, 0x00, 0x2a, 0xfa, 0x01, 0x00,
-  0x21, 0xfb, 0x01, 0x00, 0x19, 0xfc, 0x01, 0x00, 0x12, 0xfd, 0x01, 0x00,
-  0x0b, 0xfe, 0x01, 0x00, 0x05, 0xff, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0xfc, 0x00, 0x02, 0x00, 0xf8, 0x01, 0x02, 0x00, 0xf6, 0x02, 0x02, 0x00,
-  0xf4, 0x03, 0x02, 0x00, 0xf3, 0x04, 0x02, 0x00, 0xf2, 0x05, 0x02, 0x00,
-  0xf3, 0x06, 0x02, 0x00, 0xf4, 0x07, 0x02, 0x00, 0xf6, 0x08, 0x02, 0x00,
-  0xf9, 0x09, 0x02, 0x00, 0xfc, 0x0a, 0x02, 0x00, 0x01, 0x0c, 0x02, 0x00,
-  0x06, 0x0d, 0x02, 0x00, 0x0c, 0x0e, 0x02, 0x00, 0x13, 0x0f, 0x02, 0x00,
-  0x1b, 0x10, 0x02, 0x00, 0x23, 0x11, 0x02, 0x00, 0x2d, 0x12, 0x02, 0x00,
-  0x37, 0x13, 0x02, 0x00, 0x42, 0x14, 0x02, 0x00, 0x4e, 0x15, 0x02, 0x00,
-  0x5b, 0x16, 0x02, 0x00, 0x69, 0x17, 0x02, 0x00, 0x77, 0x18, 0x02, 0x00,
-  0x87, 0x19, 0x02, 0x00, 0x97, 0x1a, 0x02, 0x00, 0xa8, 0x1b, 0x02, 0x00,
-  0xba, 0x1c, 0x02, 0x00, 0xcd, 0x1d, 0x02, 0x00, 0xe1, 0x1e, 0x02, 0x00,
-  0xf6, 0x1f, 0x02, 0x00, 0x0c, 0x21, 0x02, 0x00, 0x22, 0x22, 0x02, 0x00,
-  0x3a, 0x23, 0x02, 0x00, 0x52, 0x24, 0x02, 0x00, 0x6b, 0x25, 0x02, 0x00,
-  0x86, 0x26, 0x02, 0x00, 0xa1, 0x27, 0x02, 0x00, 0xbd, 0x28, 0x02, 0x00,
-  0xda, 0x29, 0x02, 0x00, 0xf8, 0x2a, 0x02, 0x00, 0x17, 0x2c, 0x02, 0x00,
-  0x37, 0x2d, 0x02, 0x00, 0x58, 0x2e, 0x02, 0x00, 0x7a, 0x2f, 0x02, 0x00,
-  0x9d, 0x30, 0x02, 0x00, 0xc0, 0x31, 0x02, 0x00, 0xe5, 0x32, 0x02, 0x00,
-  0x0b, 0x34, 0x02, 0x00, 0x32, 0x35, 0x02, 0x00, 0x5a, 0x36, 0x02, 0x00,
-  0x82, 0x37, 0x02, 0x00, 0xac, 0x38, 0x02, 0x00, 0xd7, 0x39, 0x02, 0x00,
-  0x03, 0x3b, 0x02, 0x00, 0x30, 0x3c, 0x02, 0x00, 0x5e, 0x3d, 0x02, 0x00,
-  0x8c, 0x3e, 0x02, 0x00, 0xbc, 0x3f, 0x02, 0x00, 0xed, 0x40, 0x02, 0x00,
-  0x20, 0x42, 0x02, 0x00, 0x53, 0x43, 0x02, 0x00, 0x87, 0x44, 0x02, 0x00,
-  0xbc, 0x45, 0x02, 0x00, 0xf3, 0x46, 0x02, 0x00, 0x2a, 0x48, 0x02, 0x00,
-  0x63, 0x49, 0x02, 0x00, 0x9c, 0x4a, 0x02, 0x00, 0xd7, 0x4b, 0x02, 0x00,
-  0x13, 0x4d, 0x02, 0x00, 0x50, 0x4e, 0x02, 0x00, 0x8e, 0x4f, 0x02, 0x00,
-  0xcd, 0x50, 0x02, 0x00, 0x0d, 0x52, 0x02, 0x00, 0x4f, 0x53, 0x02, 0x00,
-  0x92, 0x54, 0x02, 0x00, 0xd5, 0x55, 0x02, 0x00, 0x1a, 0x57, 0x02, 0x00,
-  0x61, 0x58, 0x02, 0x00, 0xa8, 0x59, 0x02, 0x00, 0xf0, 0x5a, 0x02, 0x00,
-  0x3a, 0x5c, 0x02, 0x00, 0x85, 0x5d, 0x02, 0x00, 0xd1, 0x5e, 0x02, 0x00,
-  0x1e, 0x60, 0x02, 0x00, 0x6d, 0x61, 0x02, 0x00, 0xbd, 0x62, 0x02, 0x00,
-  0x0e, 0x64, 0x02, 0x00, 0x60, 0x65, 0x02, 0x00, 0xb3, 0x66, 0x02, 0x00,
-  0x08, 0x68, 0x02, 0x00, 0x5e, 0x69, 0x02, 0x00, 0xb5, 0x6a, 0x02, 0x00,
-  0x0e, 0x6c, 0x02, 0x00, 0x67, 0x6d, 0x02, 0x00, 0xc3, 0x6e, 0x02, 0x00,
-  0x1f, 0x70, 0x02, 0x00, 0x7d, 0x71, 0x02, 0x00, 0xdc, 0x72, 0x02, 0x00,
-  0x3c, 0x74, 0x02, 0x00, 0x9e, 0x75, 0x02, 0x00, 0x01, 0x77, 0x02, 0x00,
-  0x65, 0x78, 0x02, 0x00, 0xcb, 0x79, 0x02, 0x00, 0x32, 0x7b, 0x02, 0x00,
-  0x9a, 0x7c, 0x02, 0x00, 0x04, 0x7e, 0x02, 0x00, 0x6f, 0x7f, 0x02, 0x00,
-  0xdc, 0x80, 0x02, 0x00, 0x4a, 0x82, 0x02, 0x00, 0xb9, 0x83, 0x02, 0x00,
-  0x2a, 0x85, 0x02, 0x00, 0x9c, 0x86, 0x02, 0x00, 0x10, 0x88, 0x02, 0x00,
-  0x85, 0x89, 0x02, 0x00, 0xfb, 0x8a, 0x02, 0x00, 0x73, 0x8c, 0x02, 0x00,
-  0xed, 0x8d, 0x02, 0x00, 0x68, 0x8f, 0x02, 0x00, 0xe4, 0x90, 0x02, 0x00,
-  0x62, 0x92, 0x02, 0x00, 0xe2, 0x93, 0x02, 0x00, 0x63, 0x95, 0x02, 0x00,
-  0xe5, 0x96, 0x02, 0x00, 0x69, 0x98, 0x02, 0x00, 0xef, 0x99, 0x02, 0x00,
-  0x76, 0x9b, 0x02, 0x00, 0xff, 0x9c, 0x02, 0x00, 0x89, 0x9e, 0x02, 0x00,
-  0x15, 0xa0, 0x02, 0x00, 0xa3, 0xa1, 0x02, 0x00, 0x32, 0xa3, 0x02, 0x00,
-  0xc3, 0xa4, 0x02, 0x00, 0x55, 0xa6, 0x02, 0x00, 0xe9, 0xa7, 0x02, 0x00,
-  0x7f, 0xa9, 0x02, 0x00, 0x16, 0xab, 0x02, 0x00, 0xaf, 0xac, 0x02, 0x00,
-  0x4a, 0xae, 0x02, 0x00, 0xe6, 0xaf, 0x02, 0x00, 0x84, 0xb1, 0x02, 0x00,
-  0x24, 0xb3, 0x02, 0x00, 0xc5, 0xb4, 0x02, 0x00, 0x69, 0xb6, 0x02, 0x00,
-  0x0e, 0xb8, 0x02, 0x00, 0xb4, 0xb9, 0x02, 0x00, 0x5d, 0xbb, 0x02, 0x00,
-  0x07, 0xbd, 0x02, 0x00, 0xb3, 0xbe, 0x02, 0x00, 0x61, 0xc0, 0x02, 0x00,
-  0x11, 0xc2, 0x02, 0x00, 0xc2, 0xc3, 0x02, 0x00, 0x76, 0xc5, 0x02, 0x00,
-  0x2b, 0xc7, 0x02, 0x00, 0xe2, 0xc8, 0x02, 0x00, 0x9b, 0xca, 0x02, 0x00,
-  0x56, 0xcc, 0x02, 0x00, 0x13, 0xce, 0x02, 0x00, 0xd2, 0xcf, 0x02, 0x00,
-  0x92, 0xd1, 0x02, 0x00, 0x55, 0xd3, 0x02, 0x00, 0x19, 0xd5, 0x02, 0x00,
-  0xe0, 0xd6, 0x02, 0x00, 0xa8, 0xd8, 0x02, 0x00, 0x73, 0xda, 0x02, 0x00,
-  0x3f, 0xdc, 0x02, 0x00, 0x0e, 0xde, 0x02, 0x00, 0xde, 0xdf, 0x02, 0x00,
-  0xb1, 0xe1, 0x02, 0x00, 0x86, 0xe3, 0x02, 0x00, 0x5d, 0xe5, 0x02, 0x00,
-  0x35, 0xe7, 0x02, 0x00, 0x10, 0xe9, 0x02, 0x00, 0xed, 0xea, 0x02, 0x00,
-  0xcd, 0xec, 0x02, 0x00, 0xae, 0xee, 0x02, 0x00, 0x92, 0xf0, 0x02, 0x00,
-  0x77, 0xf2, 0x02, 0x00, 0x5f, 0xf4, 0x02, 0x00, 0x4a, 0xf6, 0x02, 0x00,
-  0x36, 0xf8, 0x02, 0x00, 0x25, 0xfa, 0x02, 0x00, 0x16, 0xfc, 0x02, 0x00,
-  0x09, 0xfe, 0x02, 0x00, 0xfe, 0xff, 0x02, 0x00, 0xf6, 0x01, 0x03, 0x00,
-  0xf0, 0x03, 0x03, 0x00, 0xed, 0x05, 0x03, 0x00, 0xec, 0x07, 0x03, 0x00,
-  0xed, 0x09, 0x03, 0x00, 0xf0, 0x0b, 0x03, 0x00, 0xf6, 0x0d, 0x03, 0x00,
-  0xff, 0x0f, 0x03, 0x00, 0x0a, 0x12, 0x03, 0x00, 0x17, 0x14, 0x03, 0x00,
-  0x27, 0x16, 0x03, 0x00, 0x39, 0x18, 0x03, 0x00, 0x4e, 0x1a, 0x03, 0x00,
-  0x66, 0x1c, 0x03, 0x00, 0x80, 0x1e, 0x03, 0x00, 0x9c, 0x20, 0x03, 0x00,
-  0xbc, 0x22, 0x03, 0x00, 0xdd, 0x24, 0x03, 0x00, 0x02, 0x27, 0x03, 0x00,
-  0x29, 0x29, 0x03, 0x00, 0x53, 0x2b, 0x03, 0x00, 0x7f, 0x2d, 0x03, 0x00,
-  0xaf, 0x2f, 0x03, 0x00, 0xe0, 0x31, 0x03, 0x00, 0x15, 0x34, 0x03, 0x00,
-  0x4d, 0x36, 0x03, 0x00, 0x87, 0x38, 0x03, 0x00, 0xc4, 0x3a, 0x03, 0x00,
-  0x04, 0x3d, 0x03, 0x00, 0x47, 0x3f, 0x03, 0x00, 0x8d, 0x41, 0x03, 0x00,
-  0xd5, 0x43, 0x03, 0x00, 0x21, 0x46, 0x03, 0x00, 0x6f, 0x48, 0x03, 0x00,
-  0xc1, 0x4a, 0x03, 0x00, 0x15, 0x4d, 0x03, 0x00, 0x6d, 0x4f, 0x03, 0x00,
-  0xc8, 0x51, 0x03, 0x00, 0x25, 0x54, 0x03, 0x00, 0x86, 0x56, 0x03, 0x00,
-  0xea, 0x58, 0x03, 0x00, 0x51, 0x5b, 0x03, 0x00, 0xbb, 0x5d, 0x03, 0x00,
-  0x29, 0x60, 0x03, 0x00, 0x99, 0x62, 0x03, 0x00, 0x0d, 0x65, 0x03, 0x00,
-  0x84, 0x67, 0x03, 0x00, 0xff, 0x69, 0x03, 0x00, 0x7d, 0x6c, 0x03, 0x00,
-  0xfe, 0x6e, 0x03, 0x00, 0x82, 0x71, 0x03, 0x00, 0x0a, 0x74, 0x03, 0x00,
-  0x96, 0x76, 0x03, 0x00, 0x25, 0x79, 0x03, 0x00, 0xb7, 0x7b, 0x03, 0x00,
-  0x4d, 0x7e, 0x03, 0x00, 0xe6, 0x80, 0x03, 0x00, 0x83, 0x83, 0x03, 0x00,
-  0x24, 0x86, 0x03, 0x00, 0xc8, 0x88, 0x03, 0x00, 0x70, 0x8b, 0x03, 0x00,
-  0x1c, 0x8e, 0x03, 0x00, 0xcc, 0x90, 0x03, 0x00, 0x7f, 0x93, 0x03, 0x00,
-  0x36, 0x96, 0x03, 0x00, 0xf1, 0x98, 0x03, 0x00, 0xaf, 0x9b, 0x03, 0x00,
-  0x72, 0x9e, 0x03, 0x00, 0x39, 0xa1, 0x03, 0x00, 0x03, 0xa4, 0x03, 0x00,
-  0xd2, 0xa6, 0x03, 0x00, 0xa4, 0xa9, 0x03, 0x00, 0x7b, 0xac, 0x03, 0x00,
-  0x55, 0xaf, 0x03, 0x00, 0x34, 0xb2, 0x03, 0x00, 0x17, 0xb5, 0x03, 0x00,
-  0xff, 0xb7, 0x03, 0x00, 0xea, 0xba, 0x03, 0x00, 0xda, 0xbd, 0x03, 0x00,
-  0xce, 0xc0, 0x03, 0x00, 0xc7, 0xc3, 0x03, 0x00, 0xc4, 0xc6, 0x03, 0x00,
-  0xc5, 0xc9, 0x03, 0x00, 0xcb, 0xcc, 0x03, 0x00, 0xd5, 0xcf, 0x03, 0x00,
-  0xe4, 0xd2, 0x03, 0x00, 0xf8, 0xd5, 0x03, 0x00, 0x10, 0xd9, 0x03, 0x00,
-  0x2d, 0xdc, 0x03, 0x00, 0x4e, 0xdf, 0x03, 0x00, 0x75, 0xe2, 0x03, 0x00,
-  0xa0, 0xe5, 0x03, 0x00, 0xd0, 0xe8, 0x03, 0x00, 0x05, 0xec, 0x03, 0x00,
-  0x3f, 0xef, 0x03, 0x00, 0x7e, 0xf2, 0x03, 0x00, 0xc2, 0xf5, 0x03, 0x00,
-  0x0b, 0xf9, 0x03, 0x00, 0x59, 0xfc, 0x03, 0x00, 0xac, 0xff, 0x03, 0x00,
-  0x05, 0x03, 0x04, 0x00, 0x63, 0x06, 0x04, 0x00, 0xc6, 0x09, 0x04, 0x00,
-  0x2f, 0x0d, 0x04, 0x00, 0x9d, 0x10, 0x04, 0x00, 0x10, 0x14, 0x04, 0x00,
-  0x89, 0x17, 0x04, 0x00, 0x08, 0x1b, 0x04, 0x00, 0x8d, 0x1e, 0x04, 0x00,
-  0x17, 0x22, 0x04, 0x00, 0xa6, 0x25, 0x04, 0x00, 0x3c, 0x29, 0x04, 0x00,
-  0xd8, 0x2c, 0x04, 0x00, 0x79, 0x30, 0x04, 0x00, 0x21, 0x34, 0x04, 0x00,
-  0xce, 0x37, 0x04, 0x00, 0x82, 0x3b, 0x04, 0x00, 0x3c, 0x3f, 0x04, 0x00,
-  0xfc, 0x42, 0x04, 0x00, 0xc2, 0x46, 0x04, 0x00, 0x8f, 0x4a, 0x04, 0x00,
-  0x62, 0x4e, 0x04, 0x00, 0x3b, 0x52, 0x04, 0x00, 0x1c, 0x56, 0x04, 0x00,
-  0x02, 0x5a, 0x04, 0x00, 0xf0, 0x5d, 0x04, 0x00, 0xe4, 0x61, 0x04, 0x00,
-  0xdf, 0x65, 0x04, 0x00, 0xe1, 0x69, 0x04, 0x00, 0xea, 0x6d, 0x04, 0x00,
-  0xfa, 0x71, 0x04, 0x00, 0x11, 0x76, 0x04, 0x00, 0x2f, 0x7a, 0x04, 0x00,
-  0x55, 0x7e, 0x04, 0x00, 0x82, 0x82, 0x04, 0x00, 0xb6, 0x86, 0x04, 0x00,
-  0xf2, 0x8a, 0x04, 0x00, 0x35, 0x8f, 0x04, 0x00, 0x80, 0x93, 0x04, 0x00,
-  0xd3, 0x97, 0x04, 0x00, 0x2e, 0x9c, 0x04, 0x00, 0x90, 0xa0, 0x04, 0x00,
-  0xfb, 0xa4, 0x04, 0x00, 0x6d, 0xa9, 0x04, 0x00, 0xe8, 0xad, 0x04, 0x00,
-  0x6b, 0xb2, 0x04, 0x00, 0xf7, 0xb6, 0x04, 0x00, 0x8a, 0xbb, 0x04, 0x00,
-  0x27, 0xc0, 0x04, 0x00, 0xcc, 0xc4, 0x04, 0x00, 0x79, 0xc9, 0x04, 0x00,
-  0x30, 0xce, 0x04, 0x00, 0xef, 0xd2, 0x04, 0x00, 0xb8, 0xd7, 0x04, 0x00,
-  0x89, 0xdc, 0x04, 0x00, 0x64, 0xe1, 0x04, 0x00, 0x49, 0xe6, 0x04, 0x00,
-  0x36, 0xeb, 0x04, 0x00, 0x2d, 0xf0, 0x04, 0x00, 0x2e, 0xf5, 0x04, 0x00,
-  0x39, 0xfa, 0x04, 0x00, 0x4e, 0xff, 0x04, 0x00, 0x6c, 0x04, 0x05, 0x00,
-  0x95, 0x09, 0x05, 0x00, 0xc8, 0x0e, 0x05, 0x00, 0x05, 0x14, 0x05, 0x00,
-  0x4d, 0x19, 0x05, 0x00, 0x9f, 0x1e, 0x05, 0x00, 0xfc, 0x23, 0x05, 0x00,
-  0x64, 0x29, 0x05, 0x00, 0xd7, 0x2e, 0x05, 0x00, 0x56, 0x34, 0x05, 0x00,
-  0xdf, 0x39, 0x05, 0x00, 0x74, 0x3f, 0x05, 0x00, 0x14, 0x45, 0x05, 0x00,
-  0xc0, 0x4a, 0x05, 0x00, 0x78, 0x50, 0x05, 0x00, 0x3c, 0x56, 0x05, 0x00,
-  0x0c, 0x5c, 0x05, 0x00, 0xe8, 0x61, 0x05, 0x00, 0xd1, 0x67, 0x05, 0x00,
-  0xc7, 0x6d, 0x05, 0x00, 0xc9, 0x73, 0x05, 0x00, 0xd8, 0x79, 0x05, 0x00,
-  0xf4, 0x7f, 0x05, 0x00, 0x1d, 0x86, 0x05, 0x00, 0x54, 0x8c, 0x05, 0x00,
-  0x98, 0x92, 0x05, 0x00, 0xea, 0x98, 0x05, 0x00, 0x4b, 0x9f, 0x05, 0x00,
-  0xb9, 0xa5, 0x05, 0x00, 0x35, 0xac, 0x05, 0x00, 0xc0, 0xb2, 0x05, 0x00,
-  0x5a, 0xb9, 0x05, 0x00, 0x03, 0xc0, 0x05, 0x00, 0xbb, 0xc6, 0x05, 0x00,
-  0x82, 0xcd, 0x05, 0x00, 0x58, 0xd4, 0x05, 0x00, 0x3f, 0xdb, 0x05, 0x00,
-  0x35, 0xe2, 0x05, 0x00, 0x3b, 0xe9, 0x05, 0x00, 0x52, 0xf0, 0x05, 0x00,
-  0x7a, 0xf7, 0x05, 0x00, 0xb2, 0xfe, 0x05, 0x00, 0xfb, 0x05, 0x06, 0x00,
-  0x56, 0x0d, 0x06, 0x00, 0xc2, 0x14, 0x06, 0x00, 0x40, 0x1c, 0x06, 0x00,
-  0xd0, 0x23, 0x06, 0x00, 0x72, 0x2b, 0x06, 0x00, 0x27, 0x33, 0x06, 0x00,
-  0xef, 0x3a, 0x06, 0x00, 0xca, 0x42, 0x06, 0x00, 0xb8, 0x4a, 0x06, 0x00,
-  0xbb, 0x52, 0x06, 0x00, 0xd1, 0x5a, 0x06, 0x00, 0xfb, 0x62, 0x06, 0x00,
-  0x3a, 0x6b, 0x06, 0x00, 0x8e, 0x73, 0x06, 0x00, 0xf7, 0x7b, 0x06, 0x00,
-  0x75, 0x84, 0x06, 0x00, 0x09, 0x8d, 0x06, 0x00, 0xb4, 0x95, 0x06, 0x00,
-  0x75, 0x9e, 0x06, 0x00, 0x4d, 0xa7, 0x06, 0x00, 0x3c, 0xb0, 0x06, 0x00,
-  0x43, 0xb9, 0x06, 0x00, 0x62, 0xc2, 0x06, 0x00, 0x99, 0xcb, 0x06, 0x00,
-  0xe8, 0xd4, 0x06, 0x00, 0x51, 0xde, 0x06, 0x00, 0xd4, 0xe7, 0x06, 0x00,
-  0x70, 0xf1, 0x06, 0x00, 0x27, 0xfb, 0x06, 0x00, 0xf8, 0x04, 0x07, 0x00,
-  0xe5, 0x0e, 0x07, 0x00, 0xed, 0x18, 0x07, 0x00, 0x12, 0x23, 0x07, 0x00,
-  0x53, 0x2d, 0x07, 0x00, 0xb1, 0x37, 0x07, 0x00, 0x2c, 0x42, 0x07, 0x00,
-  0xc6, 0x4c, 0x07, 0x00, 0x7e, 0x57, 0x07, 0x00, 0x55, 0x62, 0x07, 0x00,
-  0x4c, 0x6d, 0x07, 0x00, 0x63, 0x78, 0x07, 0x00, 0x9b, 0x83, 0x07, 0x00,
-  0xf4, 0x8e, 0x07, 0x00, 0x6f, 0x9a, 0x07, 0x00, 0x0d, 0xa6, 0x07, 0x00,
-  0xcd, 0xb1, 0x07, 0x00, 0xb1, 0xbd, 0x07, 0x00, 0xba, 0xc9, 0x07, 0x00,
-  0xe8, 0xd5, 0x07, 0x00, 0x3b, 0xe2, 0x07, 0x00, 0xb5, 0xee, 0x07, 0x00,
-  0x56, 0xfb, 0x07, 0x00, 0x1e, 0x08, 0x08, 0x00, 0x10, 0x15, 0x08, 0x00,
-  0x2a, 0x22, 0x08, 0x00, 0x6f, 0x2f, 0x08, 0x00, 0xde, 0x3c, 0x08, 0x00,
-  0x7a, 0x4a, 0x08, 0x00, 0x41, 0x58, 0x08, 0x00, 0x37, 0x66, 0x08, 0x00,
-  0x5a, 0x74, 0x08, 0x00, 0xad, 0x82, 0x08, 0x00, 0x30, 0x91, 0x08, 0x00,
-  0xe5, 0x9f, 0x08, 0x00, 0xcb, 0xae, 0x08, 0x00, 0xe5, 0xbd, 0x08, 0x00,
-  0x32, 0xcd, 0x08, 0x00, 0xb5, 0xdc, 0x08, 0x00, 0x6f, 0xec, 0x08, 0x00,
-  0x60, 0xfc, 0x08, 0x00, 0x89, 0x0c, 0x09, 0x00, 0xed, 0x1c, 0x09, 0x00,
-  0x8b, 0x2d, 0x09, 0x00, 0x66, 0x3e, 0x09, 0x00, 0x7e, 0x4f, 0x09, 0x00,
-  0xd5, 0x60, 0x09, 0x00, 0x6d, 0x72, 0x09, 0x00, 0x46, 0x84, 0x09, 0x00,
-  0x63, 0x96, 0x09, 0x00, 0xc4, 0xa8, 0x09, 0x00, 0x6b, 0xbb, 0x09, 0x00,
-  0x5b, 0xce, 0x09, 0x00, 0x94, 0xe1, 0x09, 0x00, 0x18, 0xf5, 0x09, 0x00,
-  0xe8, 0x08, 0x0a, 0x00, 0x08, 0x1d, 0x0a, 0x00, 0x78, 0x31, 0x0a, 0x00,
-  0x3a, 0x46, 0x0a, 0x00, 0x51, 0x5b, 0x0a, 0x00, 0xbf, 0x70, 0x0a, 0x00,
-  0x85, 0x86, 0x0a, 0x00, 0xa6, 0x9c, 0x0a, 0x00, 0x23, 0xb3, 0x0a, 0x00,
-  0x00, 0xca, 0x0a, 0x00, 0x3f, 0xe1, 0x0a, 0x00, 0xe2, 0xf8, 0x0a, 0x00,
-  0xeb, 0x10, 0x0b, 0x00, 0x5e, 0x29, 0x0b, 0x00, 0x3d, 0x42, 0x0b, 0x00,
-  0x8b, 0x5b, 0x0b, 0x00, 0x4a, 0x75, 0x0b, 0x00, 0x7f, 0x8f, 0x0b, 0x00,
-  0x2c, 0xaa, 0x0b, 0x00, 0x53, 0xc5, 0x0b, 0x00, 0xfa, 0xe0, 0x0b, 0x00,
-  0x23, 0xfd, 0x0b, 0x00, 0xd1, 0x19, 0x0c, 0x00, 0x09, 0x37, 0x0c, 0x00,
-  0xcf, 0x54, 0x0c, 0x00, 0x26, 0x73, 0x0c, 0x00, 0x13, 0x92, 0x0c, 0x00,
-  0x9a, 0xb1, 0x0c, 0x00, 0xbf, 0xd1, 0x0c, 0x00, 0x88, 0xf2, 0x0c, 0x00,
-  0xf9, 0x13, 0x0d, 0x00, 0x19, 0x36, 0x0d, 0x00, 0xea, 0x58, 0x0d, 0x00,
-  0x75, 0x7c, 0x0d, 0x00, 0xbd, 0xa0, 0x0d, 0x00, 0xca, 0xc5, 0x0d, 0x00,
-  0xa1, 0xeb, 0x0d, 0x00, 0x4a, 0x12, 0x0e, 0x00, 0xca, 0x39, 0x0e, 0x00,
-  0x29, 0x62, 0x0e, 0x00, 0x6f, 0x8b, 0x0e, 0x00, 0xa3, 0xb5, 0x0e, 0x00,
-  0xce, 0xe0, 0x0e, 0x00, 0xf9, 0x0c, 0x0f, 0x00, 0x2b, 0x3a, 0x0f, 0x00,
-  0x6e, 0x68, 0x0f, 0x00, 0xcd, 0x97, 0x0f, 0x00, 0x52, 0xc8, 0x0f, 0x00,
-  0x06, 0xfa, 0x0f, 0x00, 0xf7, 0x2c, 0x10, 0x00, 0x2f, 0x61, 0x10, 0x00,
-  0xbc, 0x96, 0x10, 0x00, 0xa9, 0xcd, 0x10, 0x00, 0x06, 0x06, 0x11, 0x00,
-  0xe1, 0x3f, 0x11, 0x00, 0x49, 0x7b, 0x11, 0x00, 0x4e, 0xb8, 0x11, 0x00,
-  0x01, 0xf7, 0x11, 0x00, 0x76, 0x37, 0x12, 0x00, 0xbd, 0x79, 0x12, 0x00,
-  0xed, 0xbd, 0x12, 0x00, 0x1a, 0x04, 0x13, 0x00, 0x5a, 0x4c, 0x13, 0x00,
-  0xc7, 0x96, 0x13, 0x00, 0x78, 0xe3, 0x13, 0x00, 0x8a, 0x32, 0x14, 0x00,
-  0x19, 0x84, 0x14, 0x00, 0x44, 0xd8, 0x14, 0x00, 0x2a, 0x2f, 0x15, 0x00,
-  0xf0, 0x88, 0x15, 0x00, 0xb9, 0xe5, 0x15, 0x00, 0xae, 0x45, 0x16, 0x00,
-  0xf9, 0xa8, 0x16, 0x00, 0xc7, 0x0f, 0x17, 0x00, 0x48, 0x7a, 0x17, 0x00,
-  0xb2, 0xe8, 0x17, 0x00, 0x3c, 0x5b, 0x18, 0x00, 0x22, 0xd2, 0x18, 0x00,
-  0xa6, 0x4d, 0x19, 0x00, 0x0d, 0xce, 0x19, 0x00, 0xa4, 0x53, 0x1a, 0x00,
-  0xbc, 0xde, 0x1a, 0x00, 0xaf, 0x6f, 0x1b, 0x00, 0xd6, 0x06, 0x1c, 0x00,
-  0xa9, 0xa4, 0x1c, 0x00, 0x92, 0x49, 0x1d, 0x00, 0x10, 0xf6, 0x1d, 0x00,
-  0xab, 0xaa, 0x1e, 0x00, 0xf9, 0x67, 0x1f, 0x00, 0x9f, 0x2e, 0x20, 0x00,
-  0x54, 0xff, 0x20, 0x00, 0xdf, 0xda, 0x21, 0x00, 0x1f, 0xc2, 0x22, 0x00,
-  0x0a, 0xb6, 0x23, 0x00, 0xb2, 0xb7, 0x24, 0x00, 0x48, 0xc8, 0x25, 0x00,
-  0x24, 0xe9, 0x26, 0x00, 0xc5, 0x1b, 0x28, 0x00, 0xde, 0x61, 0x29, 0x00,
-  0x57, 0xbd, 0x2a, 0x00, 0x5e, 0x30, 0x2c, 0x00, 0x6d, 0xbd, 0x2d, 0x00,
-  0x5b, 0x67, 0x2f, 0x00, 0x6e, 0x31, 0x31, 0x00, 0x6d, 0x1f, 0x33, 0x00,
-  0xbd, 0x35, 0x35, 0x00, 0x86, 0x79, 0x37, 0x00, 0xd6, 0xf0, 0x39, 0x00,
-  0xdf, 0xa2, 0x3c, 0x00, 0x39, 0x98, 0x3f, 0x00, 0x3e, 0xdb, 0x42, 0x00,
-  0x87, 0x78, 0x46, 0x00, 0x8e, 0x7f, 0x4a, 0x00, 0x8b, 0x03, 0x4f, 0x00,
-  0xb0, 0x1c, 0x54, 0x00, 0xd7, 0xe9, 0x59, 0x00, 0x02, 0x93, 0x60, 0x00,
-  0xff, 0x4c, 0x68, 0x00, 0xf8, 0x5e, 0x71, 0x00, 0x37, 0x2b, 0x7c, 0x00,
-  0x65, 0x3d, 0x89, 0x00, 0xe7, 0x62, 0x99, 0x00, 0xab, 0xd6, 0xad, 0x00,
-  0x6f, 0x95, 0xc8, 0x00, 0xef, 0x0d, 0xed, 0x00, 0x04, 0xbc, 0x21, 0x01,
-  0x84, 0x84, 0x74, 0x01, 0x58, 0x87, 0x09, 0x02, 0x78, 0x3a, 0x65, 0x03,
-  0x60, 0xe2, 0x2f, 0x0a
-};
-unsigned int TANGTABL_dat_len = 16384;
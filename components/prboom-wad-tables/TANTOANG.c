@@ -1,686 +0,0 @@
-const unsigned char TANTOANG_dat[] = {
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0x17, 0x05, 0x00, 0x98, 0x2f, 0x0a, 0x00,
-  0x63, 0x47, 0x0f, 0x00, 0x2e, 0x5f, 0x14, 0x00, 0xf9, 0x76, 0x19, 0x00,
-  0xc2, 0x8e, 0x1e, 0x00, 0x8b, 0xa6, 0x23, 0x00, 0x53, 0xbe, 0x28, 0x00,
-  0x19, 0xd6, 0x2d, 0x00, 0xde, 0xed, 0x32, 0x00, 0xa1, 0x05, 0x38, 0x00,
-  0x63, 0x1d, 0x3d, 0x00, 0x23, 0x35, 0x42, 0x00, 0xe0, 0x4c, 0x47, 0x00,
-  0x9c, 0x64, 0x4c, 0x00, 0x55, 0x7c, 0x51, 0x00, 0x0b, 0x94, 0x56, 0x00,
-  0xbf, 0xab, 0x5b, 0x00, 0x70, 0xc3, 0x60, 0x00, 0x1e, 0xdb, 0x65, 0x00,
-  0xc8, 0xf2, 0x6a, 0x00, 0x70, 0x0a, 0x70, 0x00, 0x13, 0x22, 0x75, 0x00,
-  0xb4, 0x39, 0x7a, 0x00, 0x50, 0x51, 0x7f, 0x00, 0xe9, 0x68, 0x84, 0x00,
-  0x7d, 0x80, 0x89, 0x00, 0x0d, 0x98, 0x8e, 0x00, 0x98, 0xaf, 0x93, 0x00,
-  0x1f, 0xc7, 0x98, 0x00, 0xa1, 0xde, 0x9d, 0x00, 0x1e, 0xf6, 0xa2, 0x00,
-  0x96, 0x0d, 0xa8, 0x00, 0x09, 0x25, 0xad, 0x00, 0x77, 0x3c, 0xb2, 0x00,
-  0xde, 0x53, 0xb7, 0x00, 0x41, 0x6b, 0xbc, 0x00, 0x9d, 0x82, 0xc1, 0x00,
-  0xf3, 0x99, 0xc6, 0x00, 0x43, 0xb1, 0xcb, 0x00, 0x8d, 0xc8, 0xd0, 0x00,
-  0xd0, 0xdf, 0xd5, 0x00, 0x0c, 0xf7, 0xda, 0x00, 0x42, 0x0e, 0xe0, 0x00,
-  0x70, 0x25, 0xe5, 0x00, 0x98, 0x3c, 0xea, 0x00, 0xb8, 0x53, 0xef, 0x00,
-  0xd1, 0x6a, 0xf4, 0x00, 0xe2, 0x81, 0xf9, 0x00, 0xeb, 0x98, 0xfe, 0x00,
-  0xec, 0xaf, 0x03, 0x01, 0xe6, 0xc6, 0x08, 0x01, 0xd6, 0xdd, 0x0d, 0x01,
-  0xbe, 0xf4, 0x12, 0x01, 0x9e, 0x0b, 0x18, 0x01, 0x76, 0x22, 0x1d, 0x01,
-  0x44, 0x39, 0x22, 0x01, 0x0a, 0x50, 0x27, 0x01, 0xc6, 0x66, 0x2c, 0x01,
-  0x78, 0x7d, 0x31, 0x01, 0x20, 0x94, 0x36, 0x01, 0xc0, 0xaa, 0x3b, 0x01,
-  0x56, 0xc1, 0x40, 0x01, 0xe2, 0xd7, 0x45, 0x01, 0x62, 0xee, 0x4a, 0x01,
-  0xda, 0x04, 0x50, 0x01, 0x46, 0x1b, 0x55, 0x01, 0xa8, 0x31, 0x5a, 0x01,
-  0x00, 0x48, 0x5f, 0x01, 0x4c, 0x5e, 0x64, 0x01, 0x8c, 0x74, 0x69, 0x01,
-  0xc2, 0x8a, 0x6e, 0x01, 0xec, 0xa0, 0x73, 0x01, 0x0c, 0xb7, 0x78, 0x01,
-  0x1e, 0xcd, 0x7d, 0x01, 0x26, 0xe3, 0x82, 0x01, 0x20, 0xf9, 0x87, 0x01,
-  0x10, 0x0f, 0x8d, 0x01, 0xf2, 0x24, 0x92, 0x01, 0xc8, 0x3a, 0x97, 0x01,
-  0x90, 0x50, 0x9c, 0x01, 0x4e, 0x66, 0xa1, 0x01, 0xfc, 0x7b, 0xa6, 0x01,
-  0x9e, 0x91, 0xab, 0x01, 0x34, 0xa7, 0xb0, 0x01, 0xbc, 0xbc, 0xb5, 0x01,
-  0x34, 0xd2, 0xba, 0x01, 0xa0, 0xe7, 0xbf, 0x01, 0xfe, 0xfc, 0xc4, 0x01,
-  0x4e, 0x12, 0xca, 0x01, 0x90, 0x27, 0xcf, 0x01, 0xc4, 0x3c, 0xd4, 0x01,
-  0xe8, 0x51, 0xd9, 0x01, 0xfe, 0x66, 0xde, 0x01, 0x04, 0x7c, 0xe3, 0x01,
-  0xfc, 0x90, 0xe8, 0x01, 0xe6, 0xa5, 0xed, 0x01, 0xbe, 0xba, 0xf2, 0x01,
-  0x88, 0xcf, 0xf7, 0x01, 0x42, 0xe4, 0xfc, 0x01, 0xec, 0xf8, 0x01, 0x02,
-  0x88, 0x0d, 0x07, 0x02, 0x10, 0x22, 0x0c, 0x02, 0x8c, 0x36, 0x11, 0x02,
-  0xf4, 0x4a, 0x16, 0x02, 0x4c, 0x5f, 0x1b, 0x02, 0x94, 0x73, 0x20, 0x02,
-  0xcc, 0x87, 0x25, 0x02, 0xf4, 0x9b, 0x2a, 0x02, 0x08, 0xb0, 0x2f, 0x02,
-  0x0c, 0xc4, 0x34, 0x02, 0xfc, 0xd7, 0x39, 0x02, 0xdc, 0xeb, 0x3e, 0x02,
-  0xa8, 0xff, 0x43, 0x02, 0x64, 0x13, 0x49, 0x02, 0x10, 0x27, 0x4e, 0x02,
-  0xa8, 0x3a, 0x53, 0x02, 0x2c, 0x4e, 0x58, 0x02, 0xa0, 0x61, 0x5d, 0x02,
-  0x00, 0x75, 0x62, 0x02, 0x4c, 0x88, 0x67, 0x02, 0x84, 0x9b, 0x6c, 0x02,
-  0xac, 0xae, 0x71, 0x02, 0xbc, 0xc1, 0x76, 0x02, 0xbc, 0xd4, 0x7b, 0x02,
-  0xa8, 0xe7, 0x80, 0x02, 0x80, 0xfa, 0x85, 0x02, 0x44, 0x0d, 0x8b, 0x02,
-  0xf4, 0x1f, 0x90, 0x02, 0x8c, 0x32, 0x95, 0x02, 0x14, 0x45, 0x9a, 0x02,
-  0x84, 0x57, 0x9f, 0x02, 0xe4, 0x69, 0xa4, 0x02, 0x28, 0x7c, 0xa9, 0x02,
-  0x5c, 0x8e, 0xae, 0x02, 0x78, 0xa0, 0xb3, 0x02, 0x80, 0xb2, 0xb8, 0x02,
-  0x74, 0xc4, 0xbd, 0x02, 0x50, 0xd6, 0xc2, 0x02, 0x18, 0xe8, 0xc7, 0x02,
-  0xc8, 0xf9, 0xcc, 0x02, 0x64, 0x0b, 0xd2, 0x02, 0xe8, 0x1c, 0xd7, 0x02,
-  0x54, 0x2e, 0xdc, 0x02, 0xac, 0x3f, 0xe1, 0x02, 0xec, 0x50, 0xe6, 0x02,
-  0x14, 0x62, 0xeb, 0x02, 0x24, 0x73, 0xf0, 0x02, 0x20, 0x84, 0xf5, 0x02,
-  0x04, 0x95, 0xfa, 0x02, 0xcc, 0xa5, 0xff, 0x02, 0x80, 0xb6, 0x04, 0x03,
-  0x1c, 0xc7, 0x09, 0x03, 0xa0, 0xd7, 0x0e, 0x03, 0x0c, 0xe8, 0x13, 0x03,
-  0x60, 0xf8, 0x18, 0x03, 0x98, 0x08, 0x1e, 0x03, 0xbc, 0x18, 0x23, 0x03,
-  0xc4, 0x28, 0x28, 0x03, 0xb4, 0x38, 0x2d, 0x03, 0x8c, 0x48, 0x32, 0x03,
-  0x48, 0x58, 0x37, 0x03, 0xec, 0x67, 0x3c, 0x03, 0x74, 0x77, 0x41, 0x03,
-  0xe8, 0x86, 0x46, 0x03, 0x3c, 0x96, 0x4b, 0x03, 0x78, 0xa5, 0x50, 0x03,
-  0x9c, 0xb4, 0x55, 0x03, 0xa4, 0xc3, 0x5a, 0x03, 0x90, 0xd2, 0x5f, 0x03,
-  0x64, 0xe1, 0x64, 0x03, 0x1c, 0xf0, 0x69, 0x03, 0xb8, 0xfe, 0x6e, 0x03,
-  0x3c, 0x0d, 0x74, 0x03, 0xa0, 0x1b, 0x79, 0x03, 0xec, 0x29, 0x7e, 0x03,
-  0x1c, 0x38, 0x83, 0x03, 0x30, 0x46, 0x88, 0x03, 0x28, 0x54, 0x8d, 0x03,
-  0x00, 0x62, 0x92, 0x03, 0xc0, 0x6f, 0x97, 0x03, 0x64, 0x7d, 0x9c, 0x03,
-  0xec, 0x8a, 0xa1, 0x03, 0x54, 0x98, 0xa6, 0x03, 0xa0, 0xa5, 0xab, 0x03,
-  0xd0, 0xb2, 0xb0, 0x03, 0xe4, 0xbf, 0xb5, 0x03, 0xdc, 0xcc, 0xba, 0x03,
-  0xb4, 0xd9, 0xbf, 0x03, 0x6c, 0xe6, 0xc4, 0x03, 0x0c, 0xf3, 0xc9, 0x03,
-  0x88, 0xff, 0xce, 0x03, 0xec, 0x0b, 0xd4, 0x03, 0x2c, 0x18, 0xd9, 0x03,
-  0x54, 0x24, 0xde, 0x03, 0x58, 0x30, 0xe3, 0x03, 0x40, 0x3c, 0xe8, 0x03,
-  0x08, 0x48, 0xed, 0x03, 0xb4, 0x53, 0xf2, 0x03, 0x3c, 0x5f, 0xf7, 0x03,
-  0xa8, 0x6a, 0xfc, 0x03, 0xf8, 0x75, 0x01, 0x04, 0x20, 0x81, 0x06, 0x04,
-  0x30, 0x8c, 0x0b, 0x04, 0x18, 0x97, 0x10, 0x04, 0xe8, 0xa1, 0x15, 0x04,
-  0x98, 0xac, 0x1a, 0x04, 0x20, 0xb7, 0x1f, 0x04, 0x90, 0xc1, 0x24, 0x04,
-  0xd8, 0xcb, 0x29, 0x04, 0x00, 0xd6, 0x2e, 0x04, 0x10, 0xe0, 0x33, 0x04,
-  0xf8, 0xe9, 0x38, 0x04, 0xc0, 0xf3, 0x3d, 0x04, 0x68, 0xfd, 0x42, 0x04,
-  0xe8, 0x06, 0x48, 0x04, 0x50, 0x10, 0x4d, 0x04, 0x90, 0x19, 0x52, 0x04,
-  0xb0, 0x22, 0x57, 0x04, 0xb0, 0x2b, 0x5c, 0x04, 0x88, 0x34, 0x61, 0x04,
-  0x40, 0x3d, 0x66, 0x04, 0xd8, 0x45, 0x6b, 0x04, 0x48, 0x4e, 0x70, 0x04,
-  0x98, 0x56, 0x75, 0x04, 0xc8, 0x5e, 0x7a, 0x04, 0xd8, 0x66, 0x7f, 0x04,
-  0xc0, 0x6e, 0x84, 0x04, 0x80, 0x76, 0x89, 0x04, 0x20, 0x7e, 0x8e, 0x04,
-  0xa0, 0x85, 0x93, 0x04, 0xf8, 0x8c, 0x98, 0x04, 0x30, 0x94, 0x9d, 0x04,
-  0x40, 0x9b, 0xa2, 0x04, 0x28, 0xa2, 0xa7, 0x04, 0xf0, 0xa8, 0xac, 0x04,
-  0x98, 0xaf, 0xb1, 0x04, 0x18, 0xb6, 0xb6, 0x04, 0x70, 0xbc, 0xbb, 0x04,
-  0xa8, 0xc2, 0xc0, 0x04, 0xb8, 0xc8, 0xc5, 0x04, 0xa0, 0xce, 0xca, 0x04,
-  0x68, 0xd4, 0xcf, 0x04, 0x08, 0xda, 0xd4, 0x04, 0x80, 0xdf, 0xd9, 0x04,
-  0xd0, 0xe4, 0xde, 0x04, 0x00, 0xea, 0xe3, 0x04, 0x08, 0xef, 0xe8, 0x04,
-  0xe8, 0xf3, 0xed, 0x04, 0xa0, 0xf8, 0xf2, 0x04, 0x38, 0xfd, 0xf7, 0x04,
-  0xa8, 0x01, 0xfd, 0x04, 0xe8, 0x05, 0x02, 0x05, 0x08, 0x0a, 0x07, 0x05,
-  0x00, 0x0e, 0x0c, 0x05, 0xd8, 0x11, 0x11, 0x05, 0x80, 0x15, 0x16, 0x05,
-  0x00, 0x19, 0x1b, 0x05, 0x58, 0x1c, 0x20, 0x05, 0x88, 0x1f, 0x25, 0x05,
-  0x98, 0x22, 0x2a, 0x05, 0x78, 0x25, 0x2f, 0x05, 0x30, 0x28, 0x34, 0x05,
-  0xc0, 0x2a, 0x39, 0x05, 0x28, 0x2d, 0x3e, 0x05, 0x68, 0x2f, 0x43, 0x05,
-  0x80, 0x31, 0x48, 0x05, 0x70, 0x33, 0x4d, 0x05, 0x30, 0x35, 0x52, 0x05,
-  0xc8, 0x36, 0x57, 0x05, 0x40, 0x38, 0x5c, 0x05, 0x80, 0x39, 0x61, 0x05,
-  0xa0, 0x3a, 0x66, 0x05, 0x98, 0x3b, 0x6b, 0x05, 0x60, 0x3c, 0x70, 0x05,
-  0x00, 0x3d, 0x75, 0x05, 0x70, 0x3d, 0x7a, 0x05, 0xc0, 0x3d, 0x7f, 0x05,
-  0xe0, 0x3d, 0x84, 0x05, 0xd0, 0x3d, 0x89, 0x05, 0xa0, 0x3d, 0x8e, 0x05,
-  0x40, 0x3d, 0x93, 0x05, 0xb0, 0x3c, 0x98, 0x05, 0xf8, 0x3b, 0x9d, 0x05,
-  0x18, 0x3b, 0xa2, 0x05, 0x08, 0x3a, 0xa7, 0x05, 0xd0, 0x38, 0xac, 0x05,
-  0x68, 0x37, 0xb1, 0x05, 0xd8, 0x35, 0xb6, 0x05, 0x18, 0x34, 0xbb, 0x05,
-  0x28, 0x32, 0xc0, 0x05, 0x10, 0x30, 0xc5, 0x05, 0xd0, 0x2d, 0xca, 0x05,
-  0x60, 0x2b, 0xcf, 0x05, 0xc0, 0x28, 0xd4, 0x05, 0xf8, 0x25, 0xd9, 0x05,
-  0x00, 0x23, 0xde, 0x05, 0xd8, 0x1f, 0xe3, 0x05, 0x88, 0x1c, 0xe8, 0x05,
-  0x08, 0x19, 0xed, 0x05, 0x58, 0x15, 0xf2, 0x05, 0x78, 0x11, 0xf7, 0x05,
-  0x70, 0x0d, 0xfc, 0x05, 0x38, 0x09, 0x01, 0x06, 0xd0, 0x04, 0x06, 0x06,
-  0x38, 0x00, 0x0b, 0x06, 0x78, 0xfb, 0x0f, 0x06, 0x88, 0xf6, 0x14, 0x06,
-  0x60, 0xf1, 0x19, 0x06, 0x10, 0xec, 0x1e, 0x06, 0x90, 0xe6, 0x23, 0x06,
-  0xe8, 0xe0, 0x28, 0x06, 0x08, 0xdb, 0x2d, 0x06, 0xf8, 0xd4, 0x32, 0x06,
-  0xb8, 0xce, 0x37, 0x06, 0x50, 0xc8, 0x3c, 0x06, 0xb0, 0xc1, 0x41, 0x06,
-  0xe0, 0xba, 0x46, 0x06, 0xe8, 0xb3, 0x4b, 0x06, 0xb8, 0xac, 0x50, 0x06,
-  0x58, 0xa5, 0x55, 0x06, 0xc8, 0x9d, 0x5a, 0x06, 0x08, 0x96, 0x5f, 0x06,
-  0x18, 0x8e, 0x64, 0x06, 0xf8, 0x85, 0x69, 0x06, 0xa0, 0x7d, 0x6e, 0x06,
-  0x20, 0x75, 0x73, 0x06, 0x68, 0x6c, 0x78, 0x06, 0x80, 0x63, 0x7d, 0x06,
-  0x68, 0x5a, 0x82, 0x06, 0x18, 0x51, 0x87, 0x06, 0x98, 0x47, 0x8c, 0x06,
-  0xf0, 0x3d, 0x91, 0x06, 0x08, 0x34, 0x96, 0x06, 0xf8, 0x29, 0x9b, 0x06,
-  0xb0, 0x1f, 0xa0, 0x06, 0x38, 0x15, 0xa5, 0x06, 0x88, 0x0a, 0xaa, 0x06,
-  0xa8, 0xff, 0xae, 0x06, 0x98, 0xf4, 0xb3, 0x06, 0x50, 0xe9, 0xb8, 0x06,
-  0xd8, 0xdd, 0xbd, 0x06, 0x28, 0xd2, 0xc2, 0x06, 0x48, 0xc6, 0xc7, 0x06,
-  0x38, 0xba, 0xcc, 0x06, 0xf0, 0xad, 0xd1, 0x06, 0x70, 0xa1, 0xd6, 0x06,
-  0xc0, 0x94, 0xdb, 0x06, 0xd8, 0x87, 0xe0, 0x06, 0xc0, 0x7a, 0xe5, 0x06,
-  0x78, 0x6d, 0xea, 0x06, 0xf0, 0x5f, 0xef, 0x06, 0x38, 0x52, 0xf4, 0x06,
-  0x50, 0x44, 0xf9, 0x06, 0x30, 0x36, 0xfe, 0x06, 0xd8, 0x27, 0x03, 0x07,
-  0x48, 0x19, 0x08, 0x07, 0x88, 0x0a, 0x0d, 0x07, 0x90, 0xfb, 0x11, 0x07,
-  0x60, 0xec, 0x16, 0x07, 0x00, 0xdd, 0x1b, 0x07, 0x68, 0xcd, 0x20, 0x07,
-  0x98, 0xbd, 0x25, 0x07, 0x90, 0xad, 0x2a, 0x07, 0x58, 0x9d, 0x2f, 0x07,
-  0xe8, 0x8c, 0x34, 0x07, 0x38, 0x7c, 0x39, 0x07, 0x58, 0x6b, 0x3e, 0x07,
-  0x40, 0x5a, 0x43, 0x07, 0xf8, 0x48, 0x48, 0x07, 0x70, 0x37, 0x4d, 0x07,
-  0xb0, 0x25, 0x52, 0x07, 0xc0, 0x13, 0x57, 0x07, 0x90, 0x01, 0x5c, 0x07,
-  0x30, 0xef, 0x60, 0x07, 0x98, 0xdc, 0x65, 0x07, 0xc0, 0xc9, 0x6a, 0x07,
-  0xb8, 0xb6, 0x6f, 0x07, 0x70, 0xa3, 0x74, 0x07, 0xf8, 0x8f, 0x79, 0x07,
-  0x40, 0x7c, 0x7e, 0x07, 0x50, 0x68, 0x83, 0x07, 0x30, 0x54, 0x88, 0x07,
-  0xd0, 0x3f, 0x8d, 0x07, 0x38, 0x2b, 0x92, 0x07, 0x68, 0x16, 0x97, 0x07,
-  0x58, 0x01, 0x9c, 0x07, 0x18, 0xec, 0xa0, 0x07, 0x98, 0xd6, 0xa5, 0x07,
-  0xe0, 0xc0, 0xaa, 0x07, 0xf0, 0xaa, 0xaf, 0x07, 0xc8, 0x94, 0xb4, 0x07,
-  0x60, 0x7e, 0xb9, 0x07, 0xc0, 0x67, 0xbe, 0x07, 0xe8, 0x50, 0xc3, 0x07,
-  0xd8, 0x39, 0xc8, 0x07, 0x88, 0x22, 0xcd, 0x07, 0x00, 0x0b, 0xd2, 0x07,
-  0x38, 0xf3, 0xd6, 0x07, 0x38, 0xdb, 0xdb, 0x07, 0x00, 0xc3, 0xe0, 0x07,
-  0x88, 0xaa, 0xe5, 0x07, 0xd8, 0x91, 0xea, 0x07, 0xf0, 0x78, 0xef, 0x07,
-  0xc8, 0x5f, 0xf4, 0x07, 0x60, 0x46, 0xf9, 0x07, 0xc8, 0x2c, 0xfe, 0x07,
-  0xf0, 0x12, 0x03, 0x08, 0xd0, 0xf8, 0x07, 0x08, 0x80, 0xde, 0x0c, 0x08,
-  0xf0, 0xc3, 0x11, 0x08, 0x20, 0xa9, 0x16, 0x08, 0x20, 0x8e, 0x1b, 0x08,
-  0xd0, 0x72, 0x20, 0x08, 0x50, 0x57, 0x25, 0x08, 0x90, 0x3b, 0x2a, 0x08,
-  0xa0, 0x1f, 0x2f, 0x08, 0x60, 0x03, 0x34, 0x08, 0xf0, 0xe6, 0x38, 0x08,
-  0x30, 0xca, 0x3d, 0x08, 0x40, 0xad, 0x42, 0x08, 0x10, 0x90, 0x47, 0x08,
-  0xa0, 0x72, 0x4c, 0x08, 0x00, 0x55, 0x51, 0x08, 0x10, 0x37, 0x56, 0x08,
-  0xf0, 0x18, 0x5b, 0x08, 0x80, 0xfa, 0x5f, 0x08, 0xe0, 0xdb, 0x64, 0x08,
-  0x00, 0xbd, 0x69, 0x08, 0xe0, 0x9d, 0x6e, 0x08, 0x80, 0x7e, 0x73, 0x08,
-  0xe0, 0x5e, 0x78, 0x08, 0x00, 0x3f, 0x7d, 0x08, 0xe0, 0x1e, 0x82, 0x08,
-  0x90, 0xfe, 0x86, 0x08, 0xf0, 0xdd, 0x8b, 0x08, 0x10, 0xbd, 0x90, 0x08,
-  0xf0, 0x9b, 0x95, 0x08, 0xa0, 0x7a, 0x9a, 0x08, 0x00, 0x59, 0x9f, 0x08,
-  0x20, 0x37, 0xa4, 0x08, 0x10, 0x15, 0xa9, 0x08, 0xb0, 0xf2, 0xad, 0x08,
-  0x10, 0xd0, 0xb2, 0x08, 0x40, 0xad, 0xb7, 0x08, 0x20, 0x8a, 0xbc, 0x08,
-  0xc0, 0x66, 0xc1, 0x08, 0x20, 0x43, 0xc6, 0x08, 0x40, 0x1f, 0xcb, 0x08,
-  0x20, 0xfb, 0xcf, 0x08, 0xc0, 0xd6, 0xd4, 0x08, 0x20, 0xb2, 0xd9, 0x08,
-  0x40, 0x8d, 0xde, 0x08, 0x20, 0x68, 0xe3, 0x08, 0xb0, 0x42, 0xe8, 0x08,
-  0x10, 0x1d, 0xed, 0x08, 0x20, 0xf7, 0xf1, 0x08, 0xf0, 0xd0, 0xf6, 0x08,
-  0x80, 0xaa, 0xfb, 0x08, 0xd0, 0x83, 0x00, 0x09, 0xe0, 0x5c, 0x05, 0x09,
-  0xb0, 0x35, 0x0a, 0x09, 0x30, 0x0e, 0x0f, 0x09, 0x80, 0xe6, 0x13, 0x09,
-  0x80, 0xbe, 0x18, 0x09, 0x40, 0x96, 0x1d, 0x09, 0xc0, 0x6d, 0x22, 0x09,
-  0xf0, 0x44, 0x27, 0x09, 0xf0, 0x1b, 0x2c, 0x09, 0xa0, 0xf2, 0x30, 0x09,
-  0x10, 0xc9, 0x35, 0x09, 0x30, 0x9f, 0x3a, 0x09, 0x20, 0x75, 0x3f, 0x09,
-  0xc0, 0x4a, 0x44, 0x09, 0x20, 0x20, 0x49, 0x09, 0x40, 0xf5, 0x4d, 0x09,
-  0x10, 0xca, 0x52, 0x09, 0xb0, 0x9e, 0x57, 0x09, 0x00, 0x73, 0x5c, 0x09,
-  0x00, 0x47, 0x61, 0x09, 0xd0, 0x1a, 0x66, 0x09, 0x50, 0xee, 0x6a, 0x09,
-  0x80, 0xc1, 0x6f, 0x09, 0x80, 0x94, 0x74, 0x09, 0x30, 0x67, 0x79, 0x09,
-  0xa0, 0x39, 0x7e, 0x09, 0xc0, 0x0b, 0x83, 0x09, 0xa0, 0xdd, 0x87, 0x09,
-  0x40, 0xaf, 0x8c, 0x09, 0xa0, 0x80, 0x91, 0x09, 0xb0, 0x51, 0x96, 0x09,
-  0x70, 0x22, 0x9b, 0x09, 0x00, 0xf3, 0x9f, 0x09, 0x40, 0xc3, 0xa4, 0x09,
-  0x30, 0x93, 0xa9, 0x09, 0xe0, 0x62, 0xae, 0x09, 0x50, 0x32, 0xb3, 0x09,
-  0x80, 0x01, 0xb8, 0x09, 0x50, 0xd0, 0xbc, 0x09, 0xf0, 0x9e, 0xc1, 0x09,
-  0x40, 0x6d, 0xc6, 0x09, 0x50, 0x3b, 0xcb, 0x09, 0x10, 0x09, 0xd0, 0x09,
-  0x90, 0xd6, 0xd4, 0x09, 0xc0, 0xa3, 0xd9, 0x09, 0xb0, 0x70, 0xde, 0x09,
-  0x50, 0x3d, 0xe3, 0x09, 0xb0, 0x09, 0xe8, 0x09, 0xc0, 0xd5, 0xec, 0x09,
-  0x90, 0xa1, 0xf1, 0x09, 0x20, 0x6d, 0xf6, 0x09, 0x60, 0x38, 0xfb, 0x09,
-  0x50, 0x03, 0x00, 0x0a, 0x00, 0xce, 0x04, 0x0a, 0x60, 0x98, 0x09, 0x0a,
-  0x80, 0x62, 0x0e, 0x0a, 0x50, 0x2c, 0x13, 0x0a, 0xe0, 0xf5, 0x17, 0x0a,
-  0x20, 0xbf, 0x1c, 0x0a, 0x20, 0x88, 0x21, 0x0a, 0xd0, 0x50, 0x26, 0x0a,
-  0x40, 0x19, 0x2b, 0x0a, 0x50, 0xe1, 0x2f, 0x0a, 0x30, 0xa9, 0x34, 0x0a,
-  0xc0, 0x70, 0x39, 0x0a, 0x00, 0x38, 0x3e, 0x0a, 0xf0, 0xfe, 0x42, 0x0a,
-  0xa0, 0xc5, 0x47, 0x0a, 0x00, 0x8c, 0x4c, 0x0a, 0x20, 0x52, 0x51, 0x0a,
-  0xf0, 0x17, 0x56, 0x0a, 0x80, 0xdd, 0x5a, 0x0a, 0xb0, 0xa2, 0x5f, 0x0a,
-  0xa0, 0x67, 0x64, 0x0a, 0x50, 0x2c, 0x69, 0x0a, 0xb0, 0xf0, 0x6d, 0x0a,
-  0xc0, 0xb4, 0x72, 0x0a, 0x80, 0x78, 0x77, 0x0a, 0x00, 0x3c, 0x7c, 0x0a,
-  0x30, 0xff, 0x80, 0x0a, 0x20, 0xc2, 0x85, 0x0a, 0xb0, 0x84, 0x8a, 0x0a,
-  0x00, 0x47, 0x8f, 0x0a, 0x00, 0x09, 0x94, 0x0a, 0xc0, 0xca, 0x98, 0x0a,
-  0x30, 0x8c, 0x9d, 0x0a, 0x50, 0x4d, 0xa2, 0x0a, 0x20, 0x0e, 0xa7, 0x0a,
-  0xb0, 0xce, 0xab, 0x0a, 0xf0, 0x8e, 0xb0, 0x0a, 0xe0, 0x4e, 0xb5, 0x0a,
-  0x80, 0x0e, 0xba, 0x0a, 0xe0, 0xcd, 0xbe, 0x0a, 0xe0, 0x8c, 0xc3, 0x0a,
-  0xa0, 0x4b, 0xc8, 0x0a, 0x10, 0x0a, 0xcd, 0x0a, 0x40, 0xc8, 0xd1, 0x0a,
-  0x10, 0x86, 0xd6, 0x0a, 0xa0, 0x43, 0xdb, 0x0a, 0xe0, 0x00, 0xe0, 0x0a,
-  0xd0, 0xbd, 0xe4, 0x0a, 0x80, 0x7a, 0xe9, 0x0a, 0xd0, 0x36, 0xee, 0x0a,
-  0xe0, 0xf2, 0xf2, 0x0a, 0x90, 0xae, 0xf7, 0x0a, 0x00, 0x6a, 0xfc, 0x0a,
-  0x20, 0x25, 0x01, 0x0b, 0x00, 0xe0, 0x05, 0x0b, 0x80, 0x9a, 0x0a, 0x0b,
-  0xb0, 0x54, 0x0f, 0x0b, 0xa0, 0x0e, 0x14, 0x0b, 0x40, 0xc8, 0x18, 0x0b,
-  0x80, 0x81, 0x1d, 0x0b, 0x80, 0x3a, 0x22, 0x0b, 0x30, 0xf3, 0x26, 0x0b,
-  0x90, 0xab, 0x2b, 0x0b, 0xa0, 0x63, 0x30, 0x0b, 0x70, 0x1b, 0x35, 0x0b,
-  0xe0, 0xd2, 0x39, 0x0b, 0x00, 0x8a, 0x3e, 0x0b, 0xe0, 0x40, 0x43, 0x0b,
-  0x60, 0xf7, 0x47, 0x0b, 0xa0, 0xad, 0x4c, 0x0b, 0x80, 0x63, 0x51, 0x0b,
-  0x20, 0x19, 0x56, 0x0b, 0x60, 0xce, 0x5a, 0x0b, 0x60, 0x83, 0x5f, 0x0b,
-  0x00, 0x38, 0x64, 0x0b, 0x60, 0xec, 0x68, 0x0b, 0x70, 0xa0, 0x6d, 0x0b,
-  0x20, 0x54, 0x72, 0x0b, 0x90, 0x07, 0x77, 0x0b, 0xb0, 0xba, 0x7b, 0x0b,
-  0x70, 0x6d, 0x80, 0x0b, 0xf0, 0x1f, 0x85, 0x0b, 0x10, 0xd2, 0x89, 0x0b,
-  0xf0, 0x83, 0x8e, 0x0b, 0x70, 0x35, 0x93, 0x0b, 0xa0, 0xe6, 0x97, 0x0b,
-  0x90, 0x97, 0x9c, 0x0b, 0x20, 0x48, 0xa1, 0x0b, 0x60, 0xf8, 0xa5, 0x0b,
-  0x50, 0xa8, 0xaa, 0x0b, 0xf0, 0x57, 0xaf, 0x0b, 0x40, 0x07, 0xb4, 0x0b,
-  0x40, 0xb6, 0xb8, 0x0b, 0xf0, 0x64, 0xbd, 0x0b, 0x50, 0x13, 0xc2, 0x0b,
-  0x50, 0xc1, 0xc6, 0x0b, 0x10, 0x6f, 0xcb, 0x0b, 0x70, 0x1c, 0xd0, 0x0b,
-  0x80, 0xc9, 0xd4, 0x0b, 0x40, 0x76, 0xd9, 0x0b, 0xb0, 0x22, 0xde, 0x0b,
-  0xd0, 0xce, 0xe2, 0x0b, 0xa0, 0x7a, 0xe7, 0x0b, 0x10, 0x26, 0xec, 0x0b,
-  0x40, 0xd1, 0xf0, 0x0b, 0x10, 0x7c, 0xf5, 0x0b, 0x90, 0x26, 0xfa, 0x0b,
-  0xc0, 0xd0, 0xfe, 0x0b, 0x90, 0x7a, 0x03, 0x0c, 0x20, 0x24, 0x08, 0x0c,
-  0x50, 0xcd, 0x0c, 0x0c, 0x30, 0x76, 0x11, 0x0c, 0xc0, 0x1e, 0x16, 0x0c,
-  0xf0, 0xc6, 0x1a, 0x0c, 0xe0, 0x6e, 0x1f, 0x0c, 0x70, 0x16, 0x24, 0x0c,
-  0xb0, 0xbd, 0x28, 0x0c, 0xa0, 0x64, 0x2d, 0x0c, 0x30, 0x0b, 0x32, 0x0c,
-  0x80, 0xb1, 0x36, 0x0c, 0x70, 0x57, 0x3b, 0x0c, 0x10, 0xfd, 0x3f, 0x0c,
-  0x50, 0xa2, 0x44, 0x0c, 0x40, 0x47, 0x49, 0x0c, 0xe0, 0xeb, 0x4d, 0x0c,
-  0x30, 0x90, 0x52, 0x0c, 0x30, 0x34, 0x57, 0x0c, 0xd0, 0xd7, 0x5b, 0x0c,
-  0x20, 0x7b, 0x60, 0x0c, 0x10, 0x1e, 0x65, 0x0c, 0xc0, 0xc0, 0x69, 0x0c,
-  0x10, 0x63, 0x6e, 0x0c, 0x00, 0x05, 0x73, 0x0c, 0xb0, 0xa6, 0x77, 0x0c,
-  0x00, 0x48, 0x7c, 0x0c, 0xf0, 0xe8, 0x80, 0x0c, 0xa0, 0x89, 0x85, 0x0c,
-  0xf0, 0x29, 0x8a, 0x0c, 0xe0, 0xc9, 0x8e, 0x0c, 0x90, 0x69, 0x93, 0x0c,
-  0xe0, 0x08, 0x98, 0x0c, 0xe0, 0xa7, 0x9c, 0x0c, 0x80, 0x46, 0xa1, 0x0c,
-  0xd0, 0xe4, 0xa5, 0x0c, 0xc0, 0x82, 0xaa, 0x0c, 0x60, 0x20, 0xaf, 0x0c,
-  0xb0, 0xbd, 0xb3, 0x0c, 0xb0, 0x5a, 0xb8, 0x0c, 0x50, 0xf7, 0xbc, 0x0c,
-  0x90, 0x93, 0xc1, 0x0c, 0x80, 0x2f, 0xc6, 0x0c, 0x20, 0xcb, 0xca, 0x0c,
-  0x70, 0x66, 0xcf, 0x0c, 0x60, 0x01, 0xd4, 0x0c, 0xf0, 0x9b, 0xd8, 0x0c,
-  0x30, 0x36, 0xdd, 0x0c, 0x20, 0xd0, 0xe1, 0x0c, 0xb0, 0x69, 0xe6, 0x0c,
-  0xf0, 0x02, 0xeb, 0x0c, 0xd0, 0x9b, 0xef, 0x0c, 0x60, 0x34, 0xf4, 0x0c,
-  0xa0, 0xcc, 0xf8, 0x0c, 0x80, 0x64, 0xfd, 0x0c, 0x00, 0xfc, 0x01, 0x0d,
-  0x30, 0x93, 0x06, 0x0d, 0x10, 0x2a, 0x0b, 0x0d, 0x90, 0xc0, 0x0f, 0x0d,
-  0xb0, 0x56, 0x14, 0x0d, 0x80, 0xec, 0x18, 0x0d, 0x00, 0x82, 0x1d, 0x0d,
-  0x20, 0x17, 0x22, 0x0d, 0xf0, 0xab, 0x26, 0x0d, 0x60, 0x40, 0x2b, 0x0d,
-  0x70, 0xd4, 0x2f, 0x0d, 0x30, 0x68, 0x34, 0x0d, 0xa0, 0xfb, 0x38, 0x0d,
-  0xb0, 0x8e, 0x3d, 0x0d, 0x60, 0x21, 0x42, 0x0d, 0xc0, 0xb3, 0x46, 0x0d,
-  0xd0, 0x45, 0x4b, 0x0d, 0x70, 0xd7, 0x4f, 0x0d, 0xd0, 0x68, 0x54, 0x0d,
-  0xc0, 0xf9, 0x58, 0x0d, 0x70, 0x8a, 0x5d, 0x0d, 0xb0, 0x1a, 0x62, 0x0d,
-  0xa0, 0xaa, 0x66, 0x0d, 0x40, 0x3a, 0x6b, 0x0d, 0x70, 0xc9, 0x6f, 0x0d,
-  0x60, 0x58, 0x74, 0x0d, 0xe0, 0xe6, 0x78, 0x0d, 0x10, 0x75, 0x7d, 0x0d,
-  0xf0, 0x02, 0x82, 0x0d, 0x70, 0x90, 0x86, 0x0d, 0x90, 0x1d, 0x8b, 0x0d,
-  0x50, 0xaa, 0x8f, 0x0d, 0xc0, 0x36, 0x94, 0x0d, 0xe0, 0xc2, 0x98, 0x0d,
-  0xa0, 0x4e, 0x9d, 0x0d, 0x00, 0xda, 0xa1, 0x0d, 0x00, 0x65, 0xa6, 0x0d,
-  0xb0, 0xef, 0xaa, 0x0d, 0x00, 0x7a, 0xaf, 0x0d, 0x00, 0x04, 0xb4, 0x0d,
-  0xa0, 0x8d, 0xb8, 0x0d, 0xe0, 0x16, 0xbd, 0x0d, 0xc0, 0x9f, 0xc1, 0x0d,
-  0x50, 0x28, 0xc6, 0x0d, 0x90, 0xb0, 0xca, 0x0d, 0x60, 0x38, 0xcf, 0x0d,
-  0xe0, 0xbf, 0xd3, 0x0d, 0x00, 0x47, 0xd8, 0x0d, 0xd0, 0xcd, 0xdc, 0x0d,
-  0x30, 0x54, 0xe1, 0x0d, 0x50, 0xda, 0xe5, 0x0d, 0x00, 0x60, 0xea, 0x0d,
-  0x60, 0xe5, 0xee, 0x0d, 0x60, 0x6a, 0xf3, 0x0d, 0x00, 0xef, 0xf7, 0x0d,
-  0x40, 0x73, 0xfc, 0x0d, 0x30, 0xf7, 0x00, 0x0e, 0xc0, 0x7a, 0x05, 0x0e,
-  0x00, 0xfe, 0x09, 0x0e, 0xd0, 0x80, 0x0e, 0x0e, 0x50, 0x03, 0x13, 0x0e,
-  0x70, 0x85, 0x17, 0x0e, 0x40, 0x07, 0x1c, 0x0e, 0xa0, 0x88, 0x20, 0x0e,
-  0xb0, 0x09, 0x25, 0x0e, 0x60, 0x8a, 0x29, 0x0e, 0xb0, 0x0a, 0x2e, 0x0e,
-  0xb0, 0x8a, 0x32, 0x0e, 0x50, 0x0a, 0x37, 0x0e, 0x90, 0x89, 0x3b, 0x0e,
-  0x70, 0x08, 0x40, 0x0e, 0xf0, 0x86, 0x44, 0x0e, 0x20, 0x05, 0x49, 0x0e,
-  0xf0, 0x82, 0x4d, 0x0e, 0x60, 0x00, 0x52, 0x0e, 0x70, 0x7d, 0x56, 0x0e,
-  0x30, 0xfa, 0x5a, 0x0e, 0x80, 0x76, 0x5f, 0x0e, 0x80, 0xf2, 0x63, 0x0e,
-  0x20, 0x6e, 0x68, 0x0e, 0x60, 0xe9, 0x6c, 0x0e, 0x40, 0x64, 0x71, 0x0e,
-  0xd0, 0xde, 0x75, 0x0e, 0x00, 0x59, 0x7a, 0x0e, 0xc0, 0xd2, 0x7e, 0x0e,
-  0x30, 0x4c, 0x83, 0x0e, 0x50, 0xc5, 0x87, 0x0e, 0x00, 0x3e, 0x8c, 0x0e,
-  0x50, 0xb6, 0x90, 0x0e, 0x50, 0x2e, 0x95, 0x0e, 0xe0, 0xa5, 0x99, 0x0e,
-  0x20, 0x1d, 0x9e, 0x0e, 0x00, 0x94, 0xa2, 0x0e, 0x80, 0x0a, 0xa7, 0x0e,
-  0xa0, 0x80, 0xab, 0x0e, 0x70, 0xf6, 0xaf, 0x0e, 0xd0, 0x6b, 0xb4, 0x0e,
-  0xe0, 0xe0, 0xb8, 0x0e, 0x80, 0x55, 0xbd, 0x0e, 0xd0, 0xc9, 0xc1, 0x0e,
-  0xc0, 0x3d, 0xc6, 0x0e, 0x50, 0xb1, 0xca, 0x0e, 0x80, 0x24, 0xcf, 0x0e,
-  0x50, 0x97, 0xd3, 0x0e, 0xc0, 0x09, 0xd8, 0x0e, 0xd0, 0x7b, 0xdc, 0x0e,
-  0x90, 0xed, 0xe0, 0x0e, 0xe0, 0x5e, 0xe5, 0x0e, 0xe0, 0xcf, 0xe9, 0x0e,
-  0x70, 0x40, 0xee, 0x0e, 0xb0, 0xb0, 0xf2, 0x0e, 0x80, 0x20, 0xf7, 0x0e,
-  0x00, 0x90, 0xfb, 0x0e, 0x20, 0xff, 0xff, 0x0e, 0xe0, 0x6d, 0x04, 0x0f,
-  0x40, 0xdc, 0x08, 0x0f, 0x30, 0x4a, 0x0d, 0x0f, 0xd0, 0xb7, 0x11, 0x0f,
-  0x10, 0x25, 0x16, 0x0f, 0xf0, 0x91, 0x1a, 0x0f, 0x70, 0xfe, 0x1e, 0x0f,
-  0x90, 0x6a, 0x23, 0x0f, 0x50, 0xd6, 0x27, 0x0f, 0xb0, 0x41, 0x2c, 0x0f,
-  0xb0, 0xac, 0x30, 0x0f, 0x60, 0x17, 0x35, 0x0f, 0xa0, 0x81, 0x39, 0x0f,
-  0x80, 0xeb, 0x3d, 0x0f, 0x00, 0x55, 0x42, 0x0f, 0x20, 0xbe, 0x46, 0x0f,
-  0xe0, 0x26, 0x4b, 0x0f, 0x40, 0x8f, 0x4f, 0x0f, 0x40, 0xf7, 0x53, 0x0f,
-  0xe0, 0x5e, 0x58, 0x0f, 0x20, 0xc6, 0x5c, 0x0f, 0x00, 0x2d, 0x61, 0x0f,
-  0x80, 0x93, 0x65, 0x0f, 0xa0, 0xf9, 0x69, 0x0f, 0x50, 0x5f, 0x6e, 0x0f,
-  0xb0, 0xc4, 0x72, 0x0f, 0xb0, 0x29, 0x77, 0x0f, 0x50, 0x8e, 0x7b, 0x0f,
-  0x80, 0xf2, 0x7f, 0x0f, 0x60, 0x56, 0x84, 0x0f, 0xd0, 0xb9, 0x88, 0x0f,
-  0xf0, 0x1c, 0x8d, 0x0f, 0xa0, 0x7f, 0x91, 0x0f, 0x00, 0xe2, 0x95, 0x0f,
-  0xf0, 0x43, 0x9a, 0x0f, 0x80, 0xa5, 0x9e, 0x0f, 0xb0, 0x06, 0xa3, 0x0f,
-  0x80, 0x67, 0xa7, 0x0f, 0xf0, 0xc7, 0xab, 0x0f, 0x00, 0x28, 0xb0, 0x0f,
-  0xb0, 0x87, 0xb4, 0x0f, 0x00, 0xe7, 0xb8, 0x0f, 0xe0, 0x45, 0xbd, 0x0f,
-  0x70, 0xa4, 0xc1, 0x0f, 0x90, 0x02, 0xc6, 0x0f, 0x50, 0x60, 0xca, 0x0f,
-  0xb0, 0xbd, 0xce, 0x0f, 0xb0, 0x1a, 0xd3, 0x0f, 0x50, 0x77, 0xd7, 0x0f,
-  0x90, 0xd3, 0xdb, 0x0f, 0x70, 0x2f, 0xe0, 0x0f, 0xe0, 0x8a, 0xe4, 0x0f,
-  0x00, 0xe6, 0xe8, 0x0f, 0xb0, 0x40, 0xed, 0x0f, 0x00, 0x9b, 0xf1, 0x0f,
-  0xf0, 0xf4, 0xf5, 0x0f, 0x80, 0x4e, 0xfa, 0x0f, 0xb0, 0xa7, 0xfe, 0x0f,
-  0x80, 0x00, 0x03, 0x10, 0xe0, 0x58, 0x07, 0x10, 0xe0, 0xb0, 0x0b, 0x10,
-  0x80, 0x08, 0x10, 0x10, 0xc0, 0x5f, 0x14, 0x10, 0xa0, 0xb6, 0x18, 0x10,
-  0x20, 0x0d, 0x1d, 0x10, 0x40, 0x63, 0x21, 0x10, 0xe0, 0xb8, 0x25, 0x10,
-  0x40, 0x0e, 0x2a, 0x10, 0x20, 0x63, 0x2e, 0x10, 0xc0, 0xb7, 0x32, 0x10,
-  0xe0, 0x0b, 0x37, 0x10, 0xa0, 0x5f, 0x3b, 0x10, 0x00, 0xb3, 0x3f, 0x10,
-  0x00, 0x06, 0x44, 0x10, 0xa0, 0x58, 0x48, 0x10, 0xe0, 0xaa, 0x4c, 0x10,
-  0xc0, 0xfc, 0x50, 0x10, 0x40, 0x4e, 0x55, 0x10, 0x40, 0x9f, 0x59, 0x10,
-  0x00, 0xf0, 0x5d, 0x10, 0x40, 0x40, 0x62, 0x10, 0x20, 0x90, 0x66, 0x10,
-  0xa0, 0xdf, 0x6a, 0x10, 0xc0, 0x2e, 0x6f, 0x10, 0x80, 0x7d, 0x73, 0x10,
-  0xe0, 0xcb, 0x77, 0x10, 0xc0, 0x19, 0x7c, 0x10, 0x60, 0x67, 0x80, 0x10,
-  0x80, 0xb4, 0x84, 0x10, 0x60, 0x01, 0x89, 0x10, 0xc0, 0x4d, 0x8d, 0x10,
-  0xc0, 0x99, 0x91, 0x10, 0x60, 0xe5, 0x95, 0x10, 0xa0, 0x30, 0x9a, 0x10,
-  0x60, 0x7b, 0x9e, 0x10, 0xe0, 0xc5, 0xa2, 0x10, 0xe0, 0x0f, 0xa7, 0x10,
-  0xa0, 0x59, 0xab, 0x10, 0xe0, 0xa2, 0xaf, 0x10, 0xc0, 0xeb, 0xb3, 0x10,
-  0x40, 0x34, 0xb8, 0x10, 0x60, 0x7c, 0xbc, 0x10, 0x00, 0xc4, 0xc0, 0x10,
-  0x60, 0x0b, 0xc5, 0x10, 0x40, 0x52, 0xc9, 0x10, 0xe0, 0x98, 0xcd, 0x10,
-  0x00, 0xdf, 0xd1, 0x10, 0xc0, 0x24, 0xd6, 0x10, 0x00, 0x6a, 0xda, 0x10,
-  0x00, 0xaf, 0xde, 0x10, 0xa0, 0xf3, 0xe2, 0x10, 0xc0, 0x37, 0xe7, 0x10,
-  0x80, 0x7b, 0xeb, 0x10, 0xe0, 0xbe, 0xef, 0x10, 0xe0, 0x01, 0xf4, 0x10,
-  0x80, 0x44, 0xf8, 0x10, 0xc0, 0x86, 0xfc, 0x10, 0x80, 0xc8, 0x00, 0x11,
-  0x00, 0x0a, 0x05, 0x11, 0x00, 0x4b, 0x09, 0x11, 0xa0, 0x8b, 0x0d, 0x11,
-  0xe0, 0xcb, 0x11, 0x11, 0xa0, 0x0b, 0x16, 0x11, 0x20, 0x4b, 0x1a, 0x11,
-  0x20, 0x8a, 0x1e, 0x11, 0xe0, 0xc8, 0x22, 0x11, 0x20, 0x07, 0x27, 0x11,
-  0x00, 0x45, 0x2b, 0x11, 0x60, 0x82, 0x2f, 0x11, 0x80, 0xbf, 0x33, 0x11,
-  0x20, 0xfc, 0x37, 0x11, 0x60, 0x38, 0x3c, 0x11, 0x60, 0x74, 0x40, 0x11,
-  0xc0, 0xaf, 0x44, 0x11, 0xe0, 0xea, 0x48, 0x11, 0xa0, 0x25, 0x4d, 0x11,
-  0xe0, 0x5f, 0x51, 0x11, 0xc0, 0x99, 0x55, 0x11, 0x40, 0xd3, 0x59, 0x11,
-  0x60, 0x0c, 0x5e, 0x11, 0x20, 0x45, 0x62, 0x11, 0x60, 0x7d, 0x66, 0x11,
-  0x40, 0xb5, 0x6a, 0x11, 0xe0, 0xec, 0x6e, 0x11, 0x00, 0x24, 0x73, 0x11,
-  0xa0, 0x5a, 0x77, 0x11, 0x00, 0x91, 0x7b, 0x11, 0xe0, 0xc6, 0x7f, 0x11,
-  0x60, 0xfc, 0x83, 0x11, 0x80, 0x31, 0x88, 0x11, 0x40, 0x66, 0x8c, 0x11,
-  0xa0, 0x9a, 0x90, 0x11, 0x80, 0xce, 0x94, 0x11, 0x00, 0x02, 0x99, 0x11,
-  0x20, 0x35, 0x9d, 0x11, 0xe0, 0x67, 0xa1, 0x11, 0x40, 0x9a, 0xa5, 0x11,
-  0x20, 0xcc, 0xa9, 0x11, 0xc0, 0xfd, 0xad, 0x11, 0xe0, 0x2e, 0xb2, 0x11,
-  0xa0, 0x5f, 0xb6, 0x11, 0xe0, 0x8f, 0xba, 0x11, 0xe0, 0xbf, 0xbe, 0x11,
-  0x60, 0xef, 0xc2, 0x11, 0x80, 0x1e, 0xc7, 0x11, 0x40, 0x4d, 0xcb, 0x11,
-  0x80, 0x7b, 0xcf, 0x11, 0x80, 0xa9, 0xd3, 0x11, 0x00, 0xd7, 0xd7, 0x11,
-  0x20, 0x04, 0xdc, 0x11, 0xe0, 0x30, 0xe0, 0x11, 0x20, 0x5d, 0xe4, 0x11,
-  0x20, 0x89, 0xe8, 0x11, 0xa0, 0xb4, 0xec, 0x11, 0xc0, 0xdf, 0xf0, 0x11,
-  0x80, 0x0a, 0xf5, 0x11, 0xc0, 0x34, 0xf9, 0x11, 0xc0, 0x5e, 0xfd, 0x11,
-  0x40, 0x88, 0x01, 0x12, 0x60, 0xb1, 0x05, 0x12, 0x00, 0xda, 0x09, 0x12,
-  0x60, 0x02, 0x0e, 0x12, 0x40, 0x2a, 0x12, 0x12, 0xc0, 0x51, 0x16, 0x12,
-  0xe0, 0x78, 0x1a, 0x12, 0x80, 0x9f, 0x1e, 0x12, 0xe0, 0xc5, 0x22, 0x12,
-  0xc0, 0xeb, 0x26, 0x12, 0x20, 0x11, 0x2b, 0x12, 0x40, 0x36, 0x2f, 0x12,
-  0x00, 0x5b, 0x33, 0x12, 0x40, 0x7f, 0x37, 0x12, 0x20, 0xa3, 0x3b, 0x12,
-  0x80, 0xc6, 0x3f, 0x12, 0xa0, 0xe9, 0x43, 0x12, 0x40, 0x0c, 0x48, 0x12,
-  0x80, 0x2e, 0x4c, 0x12, 0x60, 0x50, 0x50, 0x12, 0xe0, 0x71, 0x54, 0x12,
-  0xe0, 0x92, 0x58, 0x12, 0x80, 0xb3, 0x5c, 0x12, 0xc0, 0xd3, 0x60, 0x12,
-  0xa0, 0xf3, 0x64, 0x12, 0x00, 0x13, 0x69, 0x12, 0x00, 0x32, 0x6d, 0x12,
-  0xa0, 0x50, 0x71, 0x12, 0xe0, 0x6e, 0x75, 0x12, 0xa0, 0x8c, 0x79, 0x12,
-  0x00, 0xaa, 0x7d, 0x12, 0x00, 0xc7, 0x81, 0x12, 0xa0, 0xe3, 0x85, 0x12,
-  0xe0, 0xff, 0x89, 0x12, 0xa0, 0x1b, 0x8e, 0x12, 0x00, 0x37, 0x92, 0x12,
-  0x00, 0x52, 0x96, 0x12, 0x80, 0x6c, 0x9a, 0x12, 0xa0, 0x86, 0x9e, 0x12,
-  0x60, 0xa0, 0xa2, 0x12, 0xc0, 0xb9, 0xa6, 0x12, 0xc0, 0xd2, 0xaa, 0x12,
-  0x40, 0xeb, 0xae, 0x12, 0x60, 0x03, 0xb3, 0x12, 0x20, 0x1b, 0xb7, 0x12,
-  0x60, 0x32, 0xbb, 0x12, 0x40, 0x49, 0xbf, 0x12, 0xc0, 0x5f, 0xc3, 0x12,
-  0xe0, 0x75, 0xc7, 0x12, 0x80, 0x8b, 0xcb, 0x12, 0xe0, 0xa0, 0xcf, 0x12,
-  0xc0, 0xb5, 0xd3, 0x12, 0x20, 0xca, 0xd7, 0x12, 0x40, 0xde, 0xdb, 0x12,
-  0xe0, 0xf1, 0xdf, 0x12, 0x20, 0x05, 0xe4, 0x12, 0x00, 0x18, 0xe8, 0x12,
-  0x60, 0x2a, 0xec, 0x12, 0x60, 0x3c, 0xf0, 0x12, 0x00, 0x4e, 0xf4, 0x12,
-  0x40, 0x5f, 0xf8, 0x12, 0x00, 0x70, 0xfc, 0x12, 0x60, 0x80, 0x00, 0x13,
-  0x60, 0x90, 0x04, 0x13, 0x00, 0xa0, 0x08, 0x13, 0x20, 0xaf, 0x0c, 0x13,
-  0xe0, 0xbd, 0x10, 0x13, 0x40, 0xcc, 0x14, 0x13, 0x20, 0xda, 0x18, 0x13,
-  0xa0, 0xe7, 0x1c, 0x13, 0xc0, 0xf4, 0x20, 0x13, 0x80, 0x01, 0x25, 0x13,
-  0xe0, 0x0d, 0x29, 0x13, 0xc0, 0x19, 0x2d, 0x13, 0x40, 0x25, 0x31, 0x13,
-  0x40, 0x30, 0x35, 0x13, 0x00, 0x3b, 0x39, 0x13, 0x40, 0x45, 0x3d, 0x13,
-  0x20, 0x4f, 0x41, 0x13, 0x80, 0x58, 0x45, 0x13, 0x80, 0x61, 0x49, 0x13,
-  0x20, 0x6a, 0x4d, 0x13, 0x60, 0x72, 0x51, 0x13, 0x20, 0x7a, 0x55, 0x13,
-  0xa0, 0x81, 0x59, 0x13, 0xa0, 0x88, 0x5d, 0x13, 0x20, 0x8f, 0x61, 0x13,
-  0x40, 0x95, 0x65, 0x13, 0x20, 0x9b, 0x69, 0x13, 0x60, 0xa0, 0x6d, 0x13,
-  0x60, 0xa5, 0x71, 0x13, 0xe0, 0xa9, 0x75, 0x13, 0x00, 0xae, 0x79, 0x13,
-  0xc0, 0xb1, 0x7d, 0x13, 0x00, 0xb5, 0x81, 0x13, 0xe0, 0xb7, 0x85, 0x13,
-  0x60, 0xba, 0x89, 0x13, 0x60, 0xbc, 0x8d, 0x13, 0x20, 0xbe, 0x91, 0x13,
-  0x60, 0xbf, 0x95, 0x13, 0x20, 0xc0, 0x99, 0x13, 0xa0, 0xc0, 0x9d, 0x13,
-  0xa0, 0xc0, 0xa1, 0x13, 0x40, 0xc0, 0xa5, 0x13, 0x60, 0xbf, 0xa9, 0x13,
-  0x40, 0xbe, 0xad, 0x13, 0xa0, 0xbc, 0xb1, 0x13, 0x80, 0xba, 0xb5, 0x13,
-  0x20, 0xb8, 0xb9, 0x13, 0x40, 0xb5, 0xbd, 0x13, 0x00, 0xb2, 0xc1, 0x13,
-  0x40, 0xae, 0xc5, 0x13, 0x20, 0xaa, 0xc9, 0x13, 0xa0, 0xa5, 0xcd, 0x13,
-  0xc0, 0xa0, 0xd1, 0x13, 0x60, 0x9b, 0xd5, 0x13, 0xc0, 0x95, 0xd9, 0x13,
-  0x80, 0x8f, 0xdd, 0x13, 0x00, 0x89, 0xe1, 0x13, 0x00, 0x82, 0xe5, 0x13,
-  0xa0, 0x7a, 0xe9, 0x13, 0xe0, 0x72, 0xed, 0x13, 0xa0, 0x6a, 0xf1, 0x13,
-  0x00, 0x62, 0xf5, 0x13, 0x00, 0x59, 0xf9, 0x13, 0x80, 0x4f, 0xfd, 0x13,
-  0xc0, 0x45, 0x01, 0x14, 0x60, 0x3b, 0x05, 0x14, 0xc0, 0x30, 0x09, 0x14,
-  0xa0, 0x25, 0x0d, 0x14, 0x20, 0x1a, 0x11, 0x14, 0x40, 0x0e, 0x15, 0x14,
-  0xe0, 0x01, 0x19, 0x14, 0x40, 0xf5, 0x1c, 0x14, 0x00, 0xe8, 0x20, 0x14,
-  0x80, 0xda, 0x24, 0x14, 0x80, 0xcc, 0x28, 0x14, 0x20, 0xbe, 0x2c, 0x14,
-  0x60, 0xaf, 0x30, 0x14, 0x20, 0xa0, 0x34, 0x14, 0x80, 0x90, 0x38, 0x14,
-  0x80, 0x80, 0x3c, 0x14, 0x00, 0x70, 0x40, 0x14, 0x20, 0x5f, 0x44, 0x14,
-  0xe0, 0x4d, 0x48, 0x14, 0x40, 0x3c, 0x4c, 0x14, 0x20, 0x2a, 0x50, 0x14,
-  0xa0, 0x17, 0x54, 0x14, 0xc0, 0x04, 0x58, 0x14, 0x60, 0xf1, 0x5b, 0x14,
-  0xa0, 0xdd, 0x5f, 0x14, 0x80, 0xc9, 0x63, 0x14, 0xe0, 0xb4, 0x67, 0x14,
-  0xe0, 0x9f, 0x6b, 0x14, 0x80, 0x8a, 0x6f, 0x14, 0xc0, 0x74, 0x73, 0x14,
-  0x80, 0x5e, 0x77, 0x14, 0xe0, 0x47, 0x7b, 0x14, 0xe0, 0x30, 0x7f, 0x14,
-  0x60, 0x19, 0x83, 0x14, 0x80, 0x01, 0x87, 0x14, 0x40, 0xe9, 0x8a, 0x14,
-  0x80, 0xd0, 0x8e, 0x14, 0x60, 0xb7, 0x92, 0x14, 0xe0, 0x9d, 0x96, 0x14,
-  0x00, 0x84, 0x9a, 0x14, 0xa0, 0x69, 0x9e, 0x14, 0xe0, 0x4e, 0xa2, 0x14,
-  0xa0, 0x33, 0xa6, 0x14, 0x20, 0x18, 0xaa, 0x14, 0x20, 0xfc, 0xad, 0x14,
-  0xa0, 0xdf, 0xb1, 0x14, 0xe0, 0xc2, 0xb5, 0x14, 0xa0, 0xa5, 0xb9, 0x14,
-  0x00, 0x88, 0xbd, 0x14, 0xe0, 0x69, 0xc1, 0x14, 0x60, 0x4b, 0xc5, 0x14,
-  0x80, 0x2c, 0xc9, 0x14, 0x40, 0x0d, 0xcd, 0x14, 0x80, 0xed, 0xd0, 0x14,
-  0x60, 0xcd, 0xd4, 0x14, 0xc0, 0xac, 0xd8, 0x14, 0xe0, 0x8b, 0xdc, 0x14,
-  0x80, 0x6a, 0xe0, 0x14, 0xc0, 0x48, 0xe4, 0x14, 0x80, 0x26, 0xe8, 0x14,
-  0xe0, 0x03, 0xec, 0x14, 0xe0, 0xe0, 0xef, 0x14, 0x60, 0xbd, 0xf3, 0x14,
-  0xa0, 0x99, 0xf7, 0x14, 0x40, 0x75, 0xfb, 0x14, 0xa0, 0x50, 0xff, 0x14,
-  0x80, 0x2b, 0x03, 0x15, 0x00, 0x06, 0x07, 0x15, 0x20, 0xe0, 0x0a, 0x15,
-  0xc0, 0xb9, 0x0e, 0x15, 0x00, 0x93, 0x12, 0x15, 0xe0, 0x6b, 0x16, 0x15,
-  0x40, 0x44, 0x1a, 0x15, 0x60, 0x1c, 0x1e, 0x15, 0xe0, 0xf3, 0x21, 0x15,
-  0x20, 0xcb, 0x25, 0x15, 0xe0, 0xa1, 0x29, 0x15, 0x40, 0x78, 0x2d, 0x15,
-  0x20, 0x4e, 0x31, 0x15, 0xc0, 0x23, 0x35, 0x15, 0xe0, 0xf8, 0x38, 0x15,
-  0x80, 0xcd, 0x3c, 0x15, 0xe0, 0xa1, 0x40, 0x15, 0xc0, 0x75, 0x44, 0x15,
-  0x20, 0x49, 0x48, 0x15, 0x40, 0x1c, 0x4c, 0x15, 0xe0, 0xee, 0x4f, 0x15,
-  0x20, 0xc1, 0x53, 0x15, 0xe0, 0x92, 0x57, 0x15, 0x60, 0x64, 0x5b, 0x15,
-  0x40, 0x35, 0x5f, 0x15, 0xe0, 0x05, 0x63, 0x15, 0x00, 0xd6, 0x66, 0x15,
-  0xc0, 0xa5, 0x6a, 0x15, 0x20, 0x75, 0x6e, 0x15, 0x00, 0x44, 0x72, 0x15,
-  0x80, 0x12, 0x76, 0x15, 0xa0, 0xe0, 0x79, 0x15, 0x40, 0xae, 0x7d, 0x15,
-  0x80, 0x7b, 0x81, 0x15, 0x60, 0x48, 0x85, 0x15, 0xe0, 0x14, 0x89, 0x15,
-  0xe0, 0xe0, 0x8c, 0x15, 0x80, 0xac, 0x90, 0x15, 0xa0, 0x77, 0x94, 0x15,
-  0x80, 0x42, 0x98, 0x15, 0xe0, 0x0c, 0x9c, 0x15, 0xc0, 0xd6, 0x9f, 0x15,
-  0x60, 0xa0, 0xa3, 0x15, 0x80, 0x69, 0xa7, 0x15, 0x20, 0x32, 0xab, 0x15,
-  0x80, 0xfa, 0xae, 0x15, 0x60, 0xc2, 0xb2, 0x15, 0xe0, 0x89, 0xb6, 0x15,
-  0xe0, 0x50, 0xba, 0x15, 0x80, 0x17, 0xbe, 0x15, 0xc0, 0xdd, 0xc1, 0x15,
-  0xa0, 0xa3, 0xc5, 0x15, 0x00, 0x69, 0xc9, 0x15, 0x00, 0x2e, 0xcd, 0x15,
-  0xa0, 0xf2, 0xd0, 0x15, 0xc0, 0xb6, 0xd4, 0x15, 0x80, 0x7a, 0xd8, 0x15,
-  0xe0, 0x3d, 0xdc, 0x15, 0xc0, 0x00, 0xe0, 0x15, 0x40, 0xc3, 0xe3, 0x15,
-  0x60, 0x85, 0xe7, 0x15, 0x20, 0x47, 0xeb, 0x15, 0x60, 0x08, 0xef, 0x15,
-  0x40, 0xc9, 0xf2, 0x15, 0xc0, 0x89, 0xf6, 0x15, 0xc0, 0x49, 0xfa, 0x15,
-  0x60, 0x09, 0xfe, 0x15, 0xa0, 0xc8, 0x01, 0x16, 0x60, 0x87, 0x05, 0x16,
-  0xc0, 0x45, 0x09, 0x16, 0xc0, 0x03, 0x0d, 0x16, 0x40, 0xc1, 0x10, 0x16,
-  0x60, 0x7e, 0x14, 0x16, 0x20, 0x3b, 0x18, 0x16, 0x80, 0xf7, 0x1b, 0x16,
-  0x60, 0xb3, 0x1f, 0x16, 0xe0, 0x6e, 0x23, 0x16, 0x00, 0x2a, 0x27, 0x16,
-  0xa0, 0xe4, 0x2a, 0x16, 0xe0, 0x9e, 0x2e, 0x16, 0xc0, 0x58, 0x32, 0x16,
-  0x20, 0x12, 0x36, 0x16, 0x20, 0xcb, 0x39, 0x16, 0xc0, 0x83, 0x3d, 0x16,
-  0x00, 0x3c, 0x41, 0x16, 0xc0, 0xf3, 0x44, 0x16, 0x20, 0xab, 0x48, 0x16,
-  0x20, 0x62, 0x4c, 0x16, 0xa0, 0x18, 0x50, 0x16, 0xc0, 0xce, 0x53, 0x16,
-  0x80, 0x84, 0x57, 0x16, 0xc0, 0x39, 0x5b, 0x16, 0xa0, 0xee, 0x5e, 0x16,
-  0x20, 0xa3, 0x62, 0x16, 0x40, 0x57, 0x66, 0x16, 0xe0, 0x0a, 0x6a, 0x16,
-  0x20, 0xbe, 0x6d, 0x16, 0x00, 0x71, 0x71, 0x16, 0x60, 0x23, 0x75, 0x16,
-  0x60, 0xd5, 0x78, 0x16, 0x00, 0x87, 0x7c, 0x16, 0x20, 0x38, 0x80, 0x16,
-  0xe0, 0xe8, 0x83, 0x16, 0x40, 0x99, 0x87, 0x16, 0x40, 0x49, 0x8b, 0x16,
-  0xc0, 0xf8, 0x8e, 0x16, 0xe0, 0xa7, 0x92, 0x16, 0xa0, 0x56, 0x96, 0x16,
-  0xe0, 0x04, 0x9a, 0x16, 0xc0, 0xb2, 0x9d, 0x16, 0x40, 0x60, 0xa1, 0x16,
-  0x40, 0x0d, 0xa5, 0x16, 0x00, 0xba, 0xa8, 0x16, 0x20, 0x66, 0xac, 0x16,
-  0x00, 0x12, 0xb0, 0x16, 0x60, 0xbd, 0xb3, 0x16, 0x60, 0x68, 0xb7, 0x16,
-  0x00, 0x13, 0xbb, 0x16, 0x40, 0xbd, 0xbe, 0x16, 0x00, 0x67, 0xc2, 0x16,
-  0x60, 0x10, 0xc6, 0x16, 0x40, 0xb9, 0xc9, 0x16, 0xc0, 0x61, 0xcd, 0x16,
-  0xe0, 0x09, 0xd1, 0x16, 0xa0, 0xb1, 0xd4, 0x16, 0xe0, 0x58, 0xd8, 0x16,
-  0xe0, 0xff, 0xdb, 0x16, 0x40, 0xa6, 0xdf, 0x16, 0x60, 0x4c, 0xe3, 0x16,
-  0x00, 0xf2, 0xe6, 0x16, 0x40, 0x97, 0xea, 0x16, 0x20, 0x3c, 0xee, 0x16,
-  0x80, 0xe0, 0xf1, 0x16, 0x80, 0x84, 0xf5, 0x16, 0x20, 0x28, 0xf9, 0x16,
-  0x60, 0xcb, 0xfc, 0x16, 0x20, 0x6e, 0x00, 0x17, 0x80, 0x10, 0x04, 0x17,
-  0x60, 0xb2, 0x07, 0x17, 0x00, 0x54, 0x0b, 0x17, 0x20, 0xf5, 0x0e, 0x17,
-  0xe0, 0x95, 0x12, 0x17, 0x20, 0x36, 0x16, 0x17, 0x00, 0xd6, 0x19, 0x17,
-  0x80, 0x75, 0x1d, 0x17, 0xa0, 0x14, 0x21, 0x17, 0x40, 0xb3, 0x24, 0x17,
-  0x80, 0x51, 0x28, 0x17, 0x60, 0xef, 0x2b, 0x17, 0xe0, 0x8c, 0x2f, 0x17,
-  0xe0, 0x29, 0x33, 0x17, 0x80, 0xc6, 0x36, 0x17, 0xc0, 0x62, 0x3a, 0x17,
-  0x80, 0xfe, 0x3d, 0x17, 0xe0, 0x99, 0x41, 0x17, 0xe0, 0x34, 0x45, 0x17,
-  0x80, 0xcf, 0x48, 0x17, 0xa0, 0x69, 0x4c, 0x17, 0x60, 0x03, 0x50, 0x17,
-  0xc0, 0x9c, 0x53, 0x17, 0xa0, 0x35, 0x57, 0x17, 0x20, 0xce, 0x5a, 0x17,
-  0x40, 0x66, 0x5e, 0x17, 0x00, 0xfe, 0x61, 0x17, 0x40, 0x95, 0x65, 0x17,
-  0x20, 0x2c, 0x69, 0x17, 0xa0, 0xc2, 0x6c, 0x17, 0xc0, 0x58, 0x70, 0x17,
-  0x60, 0xee, 0x73, 0x17, 0xa0, 0x83, 0x77, 0x17, 0x80, 0x18, 0x7b, 0x17,
-  0xe0, 0xac, 0x7e, 0x17, 0xe0, 0x40, 0x82, 0x17, 0x80, 0xd4, 0x85, 0x17,
-  0xc0, 0x67, 0x89, 0x17, 0x80, 0xfa, 0x8c, 0x17, 0xe0, 0x8c, 0x90, 0x17,
-  0xe0, 0x1e, 0x94, 0x17, 0x80, 0xb0, 0x97, 0x17, 0xa0, 0x41, 0x9b, 0x17,
-  0x60, 0xd2, 0x9e, 0x17, 0xc0, 0x62, 0xa2, 0x17, 0xa0, 0xf2, 0xa5, 0x17,
-  0x20, 0x82, 0xa9, 0x17, 0x40, 0x11, 0xad, 0x17, 0x00, 0xa0, 0xb0, 0x17,
-  0x40, 0x2e, 0xb4, 0x17, 0x40, 0xbc, 0xb7, 0x17, 0xc0, 0x49, 0xbb, 0x17,
-  0xc0, 0xd6, 0xbe, 0x17, 0x80, 0x63, 0xc2, 0x17, 0xc0, 0xef, 0xc5, 0x17,
-  0x80, 0x7b, 0xc9, 0x17, 0x00, 0x07, 0xcd, 0x17, 0x00, 0x92, 0xd0, 0x17,
-  0xa0, 0x1c, 0xd4, 0x17, 0xe0, 0xa6, 0xd7, 0x17, 0xc0, 0x30, 0xdb, 0x17,
-  0x20, 0xba, 0xde, 0x17, 0x20, 0x43, 0xe2, 0x17, 0xc0, 0xcb, 0xe5, 0x17,
-  0xe0, 0x53, 0xe9, 0x17, 0xc0, 0xdb, 0xec, 0x17, 0x20, 0x63, 0xf0, 0x17,
-  0x00, 0xea, 0xf3, 0x17, 0xa0, 0x70, 0xf7, 0x17, 0xc0, 0xf6, 0xfa, 0x17,
-  0x80, 0x7c, 0xfe, 0x17, 0xe0, 0x01, 0x02, 0x18, 0xc0, 0x86, 0x05, 0x18,
-  0x40, 0x0b, 0x09, 0x18, 0x60, 0x8f, 0x0c, 0x18, 0x20, 0x13, 0x10, 0x18,
-  0x80, 0x96, 0x13, 0x18, 0x60, 0x19, 0x17, 0x18, 0xe0, 0x9b, 0x1a, 0x18,
-  0x00, 0x1e, 0x1e, 0x18, 0xa0, 0x9f, 0x21, 0x18, 0xe0, 0x20, 0x25, 0x18,
-  0xc0, 0xa1, 0x28, 0x18, 0x40, 0x22, 0x2c, 0x18, 0x40, 0xa2, 0x2f, 0x18,
-  0x00, 0x22, 0x33, 0x18, 0x40, 0xa1, 0x36, 0x18, 0x00, 0x20, 0x3a, 0x18,
-  0x80, 0x9e, 0x3d, 0x18, 0x80, 0x1c, 0x41, 0x18, 0x20, 0x9a, 0x44, 0x18,
-  0x60, 0x17, 0x48, 0x18, 0x40, 0x94, 0x4b, 0x18, 0xa0, 0x10, 0x4f, 0x18,
-  0xa0, 0x8c, 0x52, 0x18, 0x40, 0x08, 0x56, 0x18, 0x60, 0x83, 0x59, 0x18,
-  0x40, 0xfe, 0x5c, 0x18, 0xa0, 0x78, 0x60, 0x18, 0xa0, 0xf2, 0x63, 0x18,
-  0x20, 0x6c, 0x67, 0x18, 0x60, 0xe5, 0x6a, 0x18, 0x20, 0x5e, 0x6e, 0x18,
-  0x80, 0xd6, 0x71, 0x18, 0x80, 0x4e, 0x75, 0x18, 0x00, 0xc6, 0x78, 0x18,
-  0x20, 0x3d, 0x7c, 0x18, 0xe0, 0xb3, 0x7f, 0x18, 0x40, 0x2a, 0x83, 0x18,
-  0x40, 0xa0, 0x86, 0x18, 0xc0, 0x15, 0x8a, 0x18, 0xe0, 0x8a, 0x8d, 0x18,
-  0xa0, 0xff, 0x90, 0x18, 0xe0, 0x73, 0x94, 0x18, 0xe0, 0xe7, 0x97, 0x18,
-  0x60, 0x5b, 0x9b, 0x18, 0x80, 0xce, 0x9e, 0x18, 0x40, 0x41, 0xa2, 0x18,
-  0x80, 0xb3, 0xa5, 0x18, 0x60, 0x25, 0xa9, 0x18, 0xe0, 0x96, 0xac, 0x18,
-  0x00, 0x08, 0xb0, 0x18, 0xc0, 0x78, 0xb3, 0x18, 0x00, 0xe9, 0xb6, 0x18,
-  0xe0, 0x58, 0xba, 0x18, 0x60, 0xc8, 0xbd, 0x18, 0x80, 0x37, 0xc1, 0x18,
-  0x40, 0xa6, 0xc4, 0x18, 0x80, 0x14, 0xc8, 0x18, 0x60, 0x82, 0xcb, 0x18,
-  0xe0, 0xef, 0xce, 0x18, 0x00, 0x5d, 0xd2, 0x18, 0xa0, 0xc9, 0xd5, 0x18,
-  0xe0, 0x35, 0xd9, 0x18, 0xc0, 0xa1, 0xdc, 0x18, 0x40, 0x0d, 0xe0, 0x18,
-  0x60, 0x78, 0xe3, 0x18, 0x00, 0xe3, 0xe6, 0x18, 0x40, 0x4d, 0xea, 0x18,
-  0x20, 0xb7, 0xed, 0x18, 0xa0, 0x20, 0xf1, 0x18, 0xa0, 0x89, 0xf4, 0x18,
-  0x60, 0xf2, 0xf7, 0x18, 0xa0, 0x5a, 0xfb, 0x18, 0x80, 0xc2, 0xfe, 0x18,
-  0xe0, 0x29, 0x02, 0x19, 0x00, 0x91, 0x05, 0x19, 0xa0, 0xf7, 0x08, 0x19,
-  0xe0, 0x5d, 0x0c, 0x19, 0xc0, 0xc3, 0x0f, 0x19, 0x40, 0x29, 0x13, 0x19,
-  0x40, 0x8e, 0x16, 0x19, 0xe0, 0xf2, 0x19, 0x19, 0x40, 0x57, 0x1d, 0x19,
-  0x00, 0xbb, 0x20, 0x19, 0x80, 0x1e, 0x24, 0x19, 0xa0, 0x81, 0x27, 0x19,
-  0x40, 0xe4, 0x2a, 0x19, 0x80, 0x46, 0x2e, 0x19, 0x60, 0xa8, 0x31, 0x19,
-  0xe0, 0x09, 0x35, 0x19, 0xe0, 0x6a, 0x38, 0x19, 0x80, 0xcb, 0x3b, 0x19,
-  0xe0, 0x2b, 0x3f, 0x19, 0xa0, 0x8b, 0x42, 0x19, 0x20, 0xeb, 0x45, 0x19,
-  0x40, 0x4a, 0x49, 0x19, 0xe0, 0xa8, 0x4c, 0x19, 0x20, 0x07, 0x50, 0x19,
-  0x00, 0x65, 0x53, 0x19, 0x80, 0xc2, 0x56, 0x19, 0xa0, 0x1f, 0x5a, 0x19,
-  0x40, 0x7c, 0x5d, 0x19, 0x80, 0xd8, 0x60, 0x19, 0x60, 0x34, 0x64, 0x19,
-  0xe0, 0x8f, 0x67, 0x19, 0x00, 0xeb, 0x6a, 0x19, 0xa0, 0x45, 0x6e, 0x19,
-  0x00, 0xa0, 0x71, 0x19, 0xe0, 0xf9, 0x74, 0x19, 0x60, 0x53, 0x78, 0x19,
-  0x80, 0xac, 0x7b, 0x19, 0x20, 0x05, 0x7f, 0x19, 0x80, 0x5d, 0x82, 0x19,
-  0x60, 0xb5, 0x85, 0x19, 0xe0, 0x0c, 0x89, 0x19, 0x00, 0x64, 0x8c, 0x19,
-  0xc0, 0xba, 0x8f, 0x19, 0x00, 0x11, 0x93, 0x19, 0x00, 0x67, 0x96, 0x19,
-  0x80, 0xbc, 0x99, 0x19, 0xa0, 0x11, 0x9d, 0x19, 0x60, 0x66, 0xa0, 0x19,
-  0xc0, 0xba, 0xa3, 0x19, 0xa0, 0x0e, 0xa7, 0x19, 0x40, 0x62, 0xaa, 0x19,
-  0x60, 0xb5, 0xad, 0x19, 0x20, 0x08, 0xb1, 0x19, 0x80, 0x5a, 0xb4, 0x19,
-  0x60, 0xac, 0xb7, 0x19, 0x00, 0xfe, 0xba, 0x19, 0x20, 0x4f, 0xbe, 0x19,
-  0x00, 0xa0, 0xc1, 0x19, 0x60, 0xf0, 0xc4, 0x19, 0x60, 0x40, 0xc8, 0x19,
-  0xe0, 0x8f, 0xcb, 0x19, 0x20, 0xdf, 0xce, 0x19, 0x00, 0x2e, 0xd2, 0x19,
-  0x60, 0x7c, 0xd5, 0x19, 0x60, 0xca, 0xd8, 0x19, 0x00, 0x18, 0xdc, 0x19,
-  0x40, 0x65, 0xdf, 0x19, 0x00, 0xb2, 0xe2, 0x19, 0x80, 0xfe, 0xe5, 0x19,
-  0x80, 0x4a, 0xe9, 0x19, 0x40, 0x96, 0xec, 0x19, 0x80, 0xe1, 0xef, 0x19,
-  0x60, 0x2c, 0xf3, 0x19, 0xc0, 0x76, 0xf6, 0x19, 0xe0, 0xc0, 0xf9, 0x19,
-  0x80, 0x0a, 0xfd, 0x19, 0xe0, 0x53, 0x00, 0x1a, 0xc0, 0x9c, 0x03, 0x1a,
-  0x40, 0xe5, 0x06, 0x1a, 0x60, 0x2d, 0x0a, 0x1a, 0x20, 0x75, 0x0d, 0x1a,
-  0x60, 0xbc, 0x10, 0x1a, 0x60, 0x03, 0x14, 0x1a, 0xe0, 0x49, 0x17, 0x1a,
-  0x00, 0x90, 0x1a, 0x1a, 0xc0, 0xd5, 0x1d, 0x1a, 0x20, 0x1b, 0x21, 0x1a,
-  0x20, 0x60, 0x24, 0x1a, 0xc0, 0xa4, 0x27, 0x1a, 0xe0, 0xe8, 0x2a, 0x1a,
-  0xc0, 0x2c, 0x2e, 0x1a, 0x20, 0x70, 0x31, 0x1a, 0x20, 0xb3, 0x34, 0x1a,
-  0xc0, 0xf5, 0x37, 0x1a, 0x00, 0x38, 0x3b, 0x1a, 0xe0, 0x79, 0x3e, 0x1a,
-  0x40, 0xbb, 0x41, 0x1a, 0x60, 0xfc, 0x44, 0x1a, 0x00, 0x3d, 0x48, 0x1a,
-  0x40, 0x7d, 0x4b, 0x1a, 0x40, 0xbd, 0x4e, 0x1a, 0xc0, 0xfc, 0x51, 0x1a,
-  0xc0, 0x3b, 0x55, 0x1a, 0x80, 0x7a, 0x58, 0x1a, 0xe0, 0xb8, 0x5b, 0x1a,
-  0xc0, 0xf6, 0x5e, 0x1a, 0x60, 0x34, 0x62, 0x1a, 0x80, 0x71, 0x65, 0x1a,
-  0x40, 0xae, 0x68, 0x1a, 0xa0, 0xea, 0x6b, 0x1a, 0xa0, 0x26, 0x6f, 0x1a,
-  0x40, 0x62, 0x72, 0x1a, 0x80, 0x9d, 0x75, 0x1a, 0x40, 0xd8, 0x78, 0x1a,
-  0xc0, 0x12, 0x7c, 0x1a, 0xc0, 0x4c, 0x7f, 0x1a, 0x60, 0x86, 0x82, 0x1a,
-  0xc0, 0xbf, 0x85, 0x1a, 0xa0, 0xf8, 0x88, 0x1a, 0x20, 0x31, 0x8c, 0x1a,
-  0x20, 0x69, 0x8f, 0x1a, 0xe0, 0xa0, 0x92, 0x1a, 0x40, 0xd8, 0x95, 0x1a,
-  0x20, 0x0f, 0x99, 0x1a, 0xc0, 0x45, 0x9c, 0x1a, 0xe0, 0x7b, 0x9f, 0x1a,
-  0xa0, 0xb1, 0xa2, 0x1a, 0x00, 0xe7, 0xa5, 0x1a, 0x20, 0x1c, 0xa9, 0x1a,
-  0xa0, 0x50, 0xac, 0x1a, 0xe0, 0x84, 0xaf, 0x1a, 0xc0, 0xb8, 0xb2, 0x1a,
-  0x40, 0xec, 0xb5, 0x1a, 0x40, 0x1f, 0xb9, 0x1a, 0x00, 0x52, 0xbc, 0x1a,
-  0x40, 0x84, 0xbf, 0x1a, 0x20, 0xb6, 0xc2, 0x1a, 0xc0, 0xe7, 0xc5, 0x1a,
-  0xe0, 0x18, 0xc9, 0x1a, 0xa0, 0x49, 0xcc, 0x1a, 0x00, 0x7a, 0xcf, 0x1a,
-  0xe0, 0xa9, 0xd2, 0x1a, 0x80, 0xd9, 0xd5, 0x1a, 0xc0, 0x08, 0xd9, 0x1a,
-  0xa0, 0x37, 0xdc, 0x1a, 0x00, 0x66, 0xdf, 0x1a, 0x00, 0x94, 0xe2, 0x1a,
-  0xc0, 0xc1, 0xe5, 0x1a, 0x00, 0xef, 0xe8, 0x1a, 0xe0, 0x1b, 0xec, 0x1a,
-  0x60, 0x48, 0xef, 0x1a, 0x80, 0x74, 0xf2, 0x1a, 0x40, 0xa0, 0xf5, 0x1a,
-  0xa0, 0xcb, 0xf8, 0x1a, 0xa0, 0xf6, 0xfb, 0x1a, 0x40, 0x21, 0xff, 0x1a,
-  0x80, 0x4b, 0x02, 0x1b, 0x40, 0x75, 0x05, 0x1b, 0xc0, 0x9e, 0x08, 0x1b,
-  0xc0, 0xc7, 0x0b, 0x1b, 0x80, 0xf0, 0x0e, 0x1b, 0xc0, 0x18, 0x12, 0x1b,
-  0xa0, 0x40, 0x15, 0x1b, 0x40, 0x68, 0x18, 0x1b, 0x60, 0x8f, 0x1b, 0x1b,
-  0x20, 0xb6, 0x1e, 0x1b, 0x80, 0xdc, 0x21, 0x1b, 0x80, 0x02, 0x25, 0x1b,
-  0x20, 0x28, 0x28, 0x1b, 0x60, 0x4d, 0x2b, 0x1b, 0x20, 0x72, 0x2e, 0x1b,
-  0xa0, 0x96, 0x31, 0x1b, 0xc0, 0xba, 0x34, 0x1b, 0x60, 0xde, 0x37, 0x1b,
-  0xc0, 0x01, 0x3b, 0x1b, 0xc0, 0x24, 0x3e, 0x1b, 0x40, 0x47, 0x41, 0x1b,
-  0x60, 0x69, 0x44, 0x1b, 0x40, 0x8b, 0x47, 0x1b, 0xa0, 0xac, 0x4a, 0x1b,
-  0xa0, 0xcd, 0x4d, 0x1b, 0x60, 0xee, 0x50, 0x1b, 0xa0, 0x0e, 0x54, 0x1b,
-  0x80, 0x2e, 0x57, 0x1b, 0x00, 0x4e, 0x5a, 0x1b, 0x20, 0x6d, 0x5d, 0x1b,
-  0xe0, 0x8b, 0x60, 0x1b, 0x40, 0xaa, 0x63, 0x1b, 0x40, 0xc8, 0x66, 0x1b,
-  0xe0, 0xe5, 0x69, 0x1b, 0x20, 0x03, 0x6d, 0x1b, 0x00, 0x20, 0x70, 0x1b,
-  0x80, 0x3c, 0x73, 0x1b, 0x80, 0x58, 0x76, 0x1b, 0x40, 0x74, 0x79, 0x1b,
-  0xa0, 0x8f, 0x7c, 0x1b, 0xa0, 0xaa, 0x7f, 0x1b, 0x20, 0xc5, 0x82, 0x1b,
-  0x60, 0xdf, 0x85, 0x1b, 0x40, 0xf9, 0x88, 0x1b, 0xa0, 0x12, 0x8c, 0x1b,
-  0xc0, 0x2b, 0x8f, 0x1b, 0x60, 0x44, 0x92, 0x1b, 0xc0, 0x5c, 0x95, 0x1b,
-  0xa0, 0x74, 0x98, 0x1b, 0x40, 0x8c, 0x9b, 0x1b, 0x60, 0xa3, 0x9e, 0x1b,
-  0x20, 0xba, 0xa1, 0x1b, 0xa0, 0xd0, 0xa4, 0x1b, 0xa0, 0xe6, 0xa7, 0x1b,
-  0x60, 0xfc, 0xaa, 0x1b, 0xa0, 0x11, 0xae, 0x1b, 0x80, 0x26, 0xb1, 0x1b,
-  0x20, 0x3b, 0xb4, 0x1b, 0x40, 0x4f, 0xb7, 0x1b, 0x00, 0x63, 0xba, 0x1b,
-  0x80, 0x76, 0xbd, 0x1b, 0x80, 0x89, 0xc0, 0x1b, 0x20, 0x9c, 0xc3, 0x1b,
-  0x60, 0xae, 0xc6, 0x1b, 0x60, 0xc0, 0xc9, 0x1b, 0xe0, 0xd1, 0xcc, 0x1b,
-  0x00, 0xe3, 0xcf, 0x1b, 0xe0, 0xf3, 0xd2, 0x1b, 0x40, 0x04, 0xd6, 0x1b,
-  0x40, 0x14, 0xd9, 0x1b, 0xe0, 0x23, 0xdc, 0x1b, 0x40, 0x33, 0xdf, 0x1b,
-  0x20, 0x42, 0xe2, 0x1b, 0xa0, 0x50, 0xe5, 0x1b, 0xc0, 0x5e, 0xe8, 0x1b,
-  0xa0, 0x6c, 0xeb, 0x1b, 0x00, 0x7a, 0xee, 0x1b, 0x00, 0x87, 0xf1, 0x1b,
-  0xc0, 0x93, 0xf4, 0x1b, 0x00, 0xa0, 0xf7, 0x1b, 0xe0, 0xab, 0xfa, 0x1b,
-  0x80, 0xb7, 0xfd, 0x1b, 0xa0, 0xc2, 0x00, 0x1c, 0x60, 0xcd, 0x03, 0x1c,
-  0xe0, 0xd7, 0x06, 0x1c, 0xe0, 0xe1, 0x09, 0x1c, 0xa0, 0xeb, 0x0c, 0x1c,
-  0xe0, 0xf4, 0x0f, 0x1c, 0xe0, 0xfd, 0x12, 0x1c, 0x60, 0x06, 0x16, 0x1c,
-  0xa0, 0x0e, 0x19, 0x1c, 0x60, 0x16, 0x1c, 0x1c, 0xe0, 0x1d, 0x1f, 0x1c,
-  0xe0, 0x24, 0x22, 0x1c, 0xa0, 0x2b, 0x25, 0x1c, 0x00, 0x32, 0x28, 0x1c,
-  0xe0, 0x37, 0x2b, 0x1c, 0x80, 0x3d, 0x2e, 0x1c, 0xc0, 0x42, 0x31, 0x1c,
-  0xa0, 0x47, 0x34, 0x1c, 0x00, 0x4c, 0x37, 0x1c, 0x20, 0x50, 0x3a, 0x1c,
-  0xe0, 0x53, 0x3d, 0x1c, 0x40, 0x57, 0x40, 0x1c, 0x40, 0x5a, 0x43, 0x1c,
-  0xe0, 0x5c, 0x46, 0x1c, 0x20, 0x5f, 0x49, 0x1c, 0x00, 0x61, 0x4c, 0x1c,
-  0x80, 0x62, 0x4f, 0x1c, 0xa0, 0x63, 0x52, 0x1c, 0x80, 0x64, 0x55, 0x1c,
-  0xe0, 0x64, 0x58, 0x1c, 0xe0, 0x64, 0x5b, 0x1c, 0xa0, 0x64, 0x5e, 0x1c,
-  0xe0, 0x63, 0x61, 0x1c, 0xc0, 0x62, 0x64, 0x1c, 0x60, 0x61, 0x67, 0x1c,
-  0x80, 0x5f, 0x6a, 0x1c, 0x60, 0x5d, 0x6d, 0x1c, 0xe0, 0x5a, 0x70, 0x1c,
-  0xe0, 0x57, 0x73, 0x1c, 0xa0, 0x54, 0x76, 0x1c, 0x00, 0x51, 0x79, 0x1c,
-  0x00, 0x4d, 0x7c, 0x1c, 0xa0, 0x48, 0x7f, 0x1c, 0xe0, 0x43, 0x82, 0x1c,
-  0xc0, 0x3e, 0x85, 0x1c, 0x40, 0x39, 0x88, 0x1c, 0x60, 0x33, 0x8b, 0x1c,
-  0x40, 0x2d, 0x8e, 0x1c, 0xa0, 0x26, 0x91, 0x1c, 0xc0, 0x1f, 0x94, 0x1c,
-  0x60, 0x18, 0x97, 0x1c, 0xc0, 0x10, 0x9a, 0x1c, 0xa0, 0x08, 0x9d, 0x1c,
-  0x40, 0x00, 0xa0, 0x1c, 0x80, 0xf7, 0xa2, 0x1c, 0x60, 0xee, 0xa5, 0x1c,
-  0xc0, 0xe4, 0xa8, 0x1c, 0xe0, 0xda, 0xab, 0x1c, 0xc0, 0xd0, 0xae, 0x1c,
-  0x20, 0xc6, 0xb1, 0x1c, 0x20, 0xbb, 0xb4, 0x1c, 0xc0, 0xaf, 0xb7, 0x1c,
-  0x20, 0xa4, 0xba, 0x1c, 0x00, 0x98, 0xbd, 0x1c, 0xa0, 0x8b, 0xc0, 0x1c,
-  0xc0, 0x7e, 0xc3, 0x1c, 0xa0, 0x71, 0xc6, 0x1c, 0x20, 0x64, 0xc9, 0x1c,
-  0x40, 0x56, 0xcc, 0x1c, 0x00, 0x48, 0xcf, 0x1c, 0x60, 0x39, 0xd2, 0x1c,
-  0x60, 0x2a, 0xd5, 0x1c, 0x20, 0x1b, 0xd8, 0x1c, 0x60, 0x0b, 0xdb, 0x1c,
-  0x60, 0xfb, 0xdd, 0x1c, 0xe0, 0xea, 0xe0, 0x1c, 0x20, 0xda, 0xe3, 0x1c,
-  0x00, 0xc9, 0xe6, 0x1c, 0x80, 0xb7, 0xe9, 0x1c, 0xa0, 0xa5, 0xec, 0x1c,
-  0x60, 0x93, 0xef, 0x1c, 0xc0, 0x80, 0xf2, 0x1c, 0xc0, 0x6d, 0xf5, 0x1c,
-  0x80, 0x5a, 0xf8, 0x1c, 0xc0, 0x46, 0xfb, 0x1c, 0xc0, 0x32, 0xfe, 0x1c,
-  0x60, 0x1e, 0x01, 0x1d, 0x80, 0x09, 0x04, 0x1d, 0x60, 0xf4, 0x06, 0x1d,
-  0x00, 0xdf, 0x09, 0x1d, 0x20, 0xc9, 0x0c, 0x1d, 0xe0, 0xb2, 0x0f, 0x1d,
-  0x40, 0x9c, 0x12, 0x1d, 0x60, 0x85, 0x15, 0x1d, 0x20, 0x6e, 0x18, 0x1d,
-  0x80, 0x56, 0x1b, 0x1d, 0x60, 0x3e, 0x1e, 0x1d, 0x20, 0x26, 0x21, 0x1d,
-  0x60, 0x0d, 0x24, 0x1d, 0x40, 0xf4, 0x26, 0x1d, 0xc0, 0xda, 0x29, 0x1d,
-  0x00, 0xc1, 0x2c, 0x1d, 0xe0, 0xa6, 0x2f, 0x1d, 0x40, 0x8c, 0x32, 0x1d,
-  0x60, 0x71, 0x35, 0x1d, 0x20, 0x56, 0x38, 0x1d, 0xa0, 0x3a, 0x3b, 0x1d,
-  0xa0, 0x1e, 0x3e, 0x1d, 0x60, 0x02, 0x41, 0x1d, 0xa0, 0xe5, 0x43, 0x1d,
-  0xa0, 0xc8, 0x46, 0x1d, 0x40, 0xab, 0x49, 0x1d, 0x80, 0x8d, 0x4c, 0x1d,
-  0x60, 0x6f, 0x4f, 0x1d, 0xe0, 0x50, 0x52, 0x1d, 0x20, 0x32, 0x55, 0x1d,
-  0xe0, 0x12, 0x58, 0x1d, 0x60, 0xf3, 0x5a, 0x1d, 0x80, 0xd3, 0x5d, 0x1d,
-  0x40, 0xb3, 0x60, 0x1d, 0xa0, 0x92, 0x63, 0x1d, 0xc0, 0x71, 0x66, 0x1d,
-  0x60, 0x50, 0x69, 0x1d, 0xc0, 0x2e, 0x6c, 0x1d, 0xc0, 0x0c, 0x6f, 0x1d,
-  0x60, 0xea, 0x71, 0x1d, 0xa0, 0xc7, 0x74, 0x1d, 0x80, 0xa4, 0x77, 0x1d,
-  0x20, 0x81, 0x7a, 0x1d, 0x40, 0x5d, 0x7d, 0x1d, 0x20, 0x39, 0x80, 0x1d,
-  0xa0, 0x14, 0x83, 0x1d, 0xc0, 0xef, 0x85, 0x1d, 0x80, 0xca, 0x88, 0x1d,
-  0x00, 0xa5, 0x8b, 0x1d, 0x00, 0x7f, 0x8e, 0x1d, 0xc0, 0x58, 0x91, 0x1d,
-  0x20, 0x32, 0x94, 0x1d, 0x20, 0x0b, 0x97, 0x1d, 0xe0, 0xe3, 0x99, 0x1d,
-  0x20, 0xbc, 0x9c, 0x1d, 0x20, 0x94, 0x9f, 0x1d, 0xc0, 0x6b, 0xa2, 0x1d,
-  0x00, 0x43, 0xa5, 0x1d, 0xe0, 0x19, 0xa8, 0x1d, 0x60, 0xf0, 0xaa, 0x1d,
-  0xa0, 0xc6, 0xad, 0x1d, 0x60, 0x9c, 0xb0, 0x1d, 0xe0, 0x71, 0xb3, 0x1d,
-  0x00, 0x47, 0xb6, 0x1d, 0xe0, 0x1b, 0xb9, 0x1d, 0x40, 0xf0, 0xbb, 0x1d,
-  0x60, 0xc4, 0xbe, 0x1d, 0x20, 0x98, 0xc1, 0x1d, 0x80, 0x6b, 0xc4, 0x1d,
-  0x80, 0x3e, 0xc7, 0x1d, 0x20, 0x11, 0xca, 0x1d, 0x80, 0xe3, 0xcc, 0x1d,
-  0x80, 0xb5, 0xcf, 0x1d, 0x20, 0x87, 0xd2, 0x1d, 0x60, 0x58, 0xd5, 0x1d,
-  0x40, 0x29, 0xd8, 0x1d, 0xe0, 0xf9, 0xda, 0x1d, 0x20, 0xca, 0xdd, 0x1d,
-  0x00, 0x9a, 0xe0, 0x1d, 0x80, 0x69, 0xe3, 0x1d, 0xa0, 0x38, 0xe6, 0x1d,
-  0x80, 0x07, 0xe9, 0x1d, 0x00, 0xd6, 0xeb, 0x1d, 0x20, 0xa4, 0xee, 0x1d,
-  0xe0, 0x71, 0xf1, 0x1d, 0x40, 0x3f, 0xf4, 0x1d, 0x60, 0x0c, 0xf7, 0x1d,
-  0x20, 0xd9, 0xf9, 0x1d, 0x80, 0xa5, 0xfc, 0x1d, 0x80, 0x71, 0xff, 0x1d,
-  0x40, 0x3d, 0x02, 0x1e, 0xa0, 0x08, 0x05, 0x1e, 0xa0, 0xd3, 0x07, 0x1e,
-  0x40, 0x9e, 0x0a, 0x1e, 0x80, 0x68, 0x0d, 0x1e, 0x80, 0x32, 0x10, 0x1e,
-  0x20, 0xfc, 0x12, 0x1e, 0x60, 0xc5, 0x15, 0x1e, 0x40, 0x8e, 0x18, 0x1e,
-  0xe0, 0x56, 0x1b, 0x1e, 0x00, 0x1f, 0x1e, 0x1e, 0xe0, 0xe6, 0x20, 0x1e,
-  0x80, 0xae, 0x23, 0x1e, 0xa0, 0x75, 0x26, 0x1e, 0x80, 0x3c, 0x29, 0x1e,
-  0x00, 0x03, 0x2c, 0x1e, 0x20, 0xc9, 0x2e, 0x1e, 0xe0, 0x8e, 0x31, 0x1e,
-  0x60, 0x54, 0x34, 0x1e, 0x80, 0x19, 0x37, 0x1e, 0x40, 0xde, 0x39, 0x1e,
-  0xa0, 0xa2, 0x3c, 0x1e, 0xc0, 0x66, 0x3f, 0x1e, 0x80, 0x2a, 0x42, 0x1e,
-  0xe0, 0xed, 0x44, 0x1e, 0xe0, 0xb0, 0x47, 0x1e, 0xa0, 0x73, 0x4a, 0x1e,
-  0x00, 0x36, 0x4d, 0x1e, 0x00, 0xf8, 0x4f, 0x1e, 0xa0, 0xb9, 0x52, 0x1e,
-  0x00, 0x7b, 0x55, 0x1e, 0x00, 0x3c, 0x58, 0x1e, 0xa0, 0xfc, 0x5a, 0x1e,
-  0xe0, 0xbc, 0x5d, 0x1e, 0xe0, 0x7c, 0x60, 0x1e, 0x80, 0x3c, 0x63, 0x1e,
-  0xc0, 0xfb, 0x65, 0x1e, 0xa0, 0xba, 0x68, 0x1e, 0x40, 0x79, 0x6b, 0x1e,
-  0x80, 0x37, 0x6e, 0x1e, 0x60, 0xf5, 0x70, 0x1e, 0x00, 0xb3, 0x73, 0x1e,
-  0x20, 0x70, 0x76, 0x1e, 0x00, 0x2d, 0x79, 0x1e, 0xa0, 0xe9, 0x7b, 0x1e,
-  0xc0, 0xa5, 0x7e, 0x1e, 0xa0, 0x61, 0x81, 0x1e, 0x20, 0x1d, 0x84, 0x1e,
-  0x40, 0xd8, 0x86, 0x1e, 0x20, 0x93, 0x89, 0x1e, 0xa0, 0x4d, 0x8c, 0x1e,
-  0xc0, 0x07, 0x8f, 0x1e, 0xa0, 0xc1, 0x91, 0x1e, 0x00, 0x7b, 0x94, 0x1e,
-  0x40, 0x34, 0x97, 0x1e, 0x00, 0xed, 0x99, 0x1e, 0x60, 0xa5, 0x9c, 0x1e,
-  0x80, 0x5d, 0x9f, 0x1e, 0x60, 0x15, 0xa2, 0x1e, 0xc0, 0xcc, 0xa4, 0x1e,
-  0xe0, 0x83, 0xa7, 0x1e, 0xa0, 0x3a, 0xaa, 0x1e, 0x00, 0xf1, 0xac, 0x1e,
-  0x20, 0xa7, 0xaf, 0x1e, 0xe0, 0x5c, 0xb2, 0x1e, 0x40, 0x12, 0xb5, 0x1e,
-  0x60, 0xc7, 0xb7, 0x1e, 0x20, 0x7c, 0xba, 0x1e, 0x80, 0x30, 0xbd, 0x1e,
-  0x80, 0xe4, 0xbf, 0x1e, 0x40, 0x98, 0xc2, 0x1e, 0xa0, 0x4b, 0xc5, 0x1e,
-  0xa0, 0xfe, 0xc7, 0x1e, 0x60, 0xb1, 0xca, 0x1e, 0xc0, 0x63, 0xcd, 0x1e,
-  0xc0, 0x15, 0xd0, 0x1e, 0x80, 0xc7, 0xd2, 0x1e, 0xe0, 0x78, 0xd5, 0x1e,
-  0xe0, 0x29, 0xd8, 0x1e, 0x80, 0xda, 0xda, 0x1e, 0xe0, 0x8a, 0xdd, 0x1e,
-  0xe0, 0x3a, 0xe0, 0x1e, 0xa0, 0xea, 0xe2, 0x1e, 0x00, 0x9a, 0xe5, 0x1e,
-  0x00, 0x49, 0xe8, 0x1e, 0xa0, 0xf7, 0xea, 0x1e, 0x00, 0xa6, 0xed, 0x1e,
-  0x00, 0x54, 0xf0, 0x1e, 0xa0, 0x01, 0xf3, 0x1e, 0x00, 0xaf, 0xf5, 0x1e,
-  0x00, 0x5c, 0xf8, 0x1e, 0xc0, 0x08, 0xfb, 0x1e, 0x00, 0xb5, 0xfd, 0x1e,
-  0x00, 0x61, 0x00, 0x1f, 0xc0, 0x0c, 0x03, 0x1f, 0x00, 0xb8, 0x05, 0x1f,
-  0x00, 0x63, 0x08, 0x1f, 0xc0, 0x0d, 0x0b, 0x1f, 0x20, 0xb8, 0x0d, 0x1f,
-  0x20, 0x62, 0x10, 0x1f, 0xc0, 0x0b, 0x13, 0x1f, 0x20, 0xb5, 0x15, 0x1f,
-  0x20, 0x5e, 0x18, 0x1f, 0xc0, 0x06, 0x1b, 0x1f, 0x20, 0xaf, 0x1d, 0x1f,
-  0x20, 0x57, 0x20, 0x1f, 0xe0, 0xfe, 0x22, 0x1f, 0x20, 0xa6, 0x25, 0x1f,
-  0x40, 0x4d, 0x28, 0x1f, 0xe0, 0xf3, 0x2a, 0x1f, 0x40, 0x9a, 0x2d, 0x1f,
-  0x40, 0x40, 0x30, 0x1f, 0x00, 0xe6, 0x32, 0x1f, 0x60, 0x8b, 0x35, 0x1f,
-  0x60, 0x30, 0x38, 0x1f, 0x00, 0xd5, 0x3a, 0x1f, 0x60, 0x79, 0x3d, 0x1f,
-  0x80, 0x1d, 0x40, 0x1f, 0x20, 0xc1, 0x42, 0x1f, 0xa0, 0x64, 0x45, 0x1f,
-  0xa0, 0x07, 0x48, 0x1f, 0x60, 0xaa, 0x4a, 0x1f, 0xc0, 0x4c, 0x4d, 0x1f,
-  0xe0, 0xee, 0x4f, 0x1f, 0x80, 0x90, 0x52, 0x1f, 0x00, 0x32, 0x55, 0x1f,
-  0x00, 0xd3, 0x57, 0x1f, 0xc0, 0x73, 0x5a, 0x1f, 0x40, 0x14, 0x5d, 0x1f,
-  0x60, 0xb4, 0x5f, 0x1f, 0x20, 0x54, 0x62, 0x1f, 0x80, 0xf3, 0x64, 0x1f,
-  0xa0, 0x92, 0x67, 0x1f, 0x60, 0x31, 0x6a, 0x1f, 0xe0, 0xcf, 0x6c, 0x1f,
-  0x00, 0x6e, 0x6f, 0x1f, 0xe0, 0x0b, 0x72, 0x1f, 0x40, 0xa9, 0x74, 0x1f,
-  0x80, 0x46, 0x77, 0x1f, 0x40, 0xe3, 0x79, 0x1f, 0xc0, 0x7f, 0x7c, 0x1f,
-  0x00, 0x1c, 0x7f, 0x1f, 0xc0, 0xb7, 0x81, 0x1f, 0x40, 0x53, 0x84, 0x1f,
-  0x80, 0xee, 0x86, 0x1f, 0x60, 0x89, 0x89, 0x1f, 0xe0, 0x23, 0x8c, 0x1f,
-  0x20, 0xbe, 0x8e, 0x1f, 0x00, 0x58, 0x91, 0x1f, 0xa0, 0xf1, 0x93, 0x1f,
-  0xe0, 0x8a, 0x96, 0x1f, 0xc0, 0x23, 0x99, 0x1f, 0x60, 0xbc, 0x9b, 0x1f,
-  0xa0, 0x54, 0x9e, 0x1f, 0x80, 0xec, 0xa0, 0x1f, 0x20, 0x84, 0xa3, 0x1f,
-  0x80, 0x1b, 0xa6, 0x1f, 0x80, 0xb2, 0xa8, 0x1f, 0x20, 0x49, 0xab, 0x1f,
-  0x60, 0xdf, 0xad, 0x1f, 0x60, 0x75, 0xb0, 0x1f, 0x20, 0x0b, 0xb3, 0x1f,
-  0x80, 0xa0, 0xb5, 0x1f, 0x80, 0x35, 0xb8, 0x1f, 0x40, 0xca, 0xba, 0x1f,
-  0xa0, 0x5e, 0xbd, 0x1f, 0xa0, 0xf2, 0xbf, 0x1f, 0x60, 0x86, 0xc2, 0x1f,
-  0xe0, 0x19, 0xc5, 0x1f, 0xe0, 0xac, 0xc7, 0x1f, 0xc0, 0x3f, 0xca, 0x1f,
-  0x20, 0xd2, 0xcc, 0x1f, 0x40, 0x64, 0xcf, 0x1f, 0x20, 0xf6, 0xd1, 0x1f,
-  0xa0, 0x87, 0xd4, 0x1f, 0xc0, 0x18, 0xd7, 0x1f, 0xa0, 0xa9, 0xd9, 0x1f,
-  0x20, 0x3a, 0xdc, 0x1f, 0x60, 0xca, 0xde, 0x1f, 0x40, 0x5a, 0xe1, 0x1f,
-  0xe0, 0xe9, 0xe3, 0x1f, 0x20, 0x79, 0xe6, 0x1f, 0x00, 0x08, 0xe9, 0x1f,
-  0xa0, 0x96, 0xeb, 0x1f, 0xe0, 0x24, 0xee, 0x1f, 0xe0, 0xb2, 0xf0, 0x1f,
-  0x80, 0x40, 0xf3, 0x1f, 0xe0, 0xcd, 0xf5, 0x1f, 0xe0, 0x5a, 0xf8, 0x1f,
-  0xa0, 0xe7, 0xfa, 0x1f, 0x00, 0x74, 0xfd, 0x1f, 0x00, 0x00, 0x00, 0x20
-};
-unsigned int TANTOANG_dat_len = 8196;
@@ -1,2 +0,0 @@
-extern const unsigned char TANGTABL_dat[];
-extern unsigned int TANGTABL_dat_len;
@@ -1,2 +0,0 @@
-extern const unsigned char TANTOANG_dat[];
-extern unsigned int TANTOANG_dat_len;
@@ -0,0 +1,38 @@
+# The trig tables are turned from the .dat lumps into initialiser lists
+# of 32-bit words at configure time. prboom/tables.c includes them to
+# define finesine, finetangent and tantoangle as typed const arrays.
+# trigtabl.h carries the size and the MD5 of each .dat for the startup
+# self-check. Included by this component and by the host tests.
+
+set(doom_trig_dat_dir ${CMAKE_CURRENT_LIST_DIR})
+
+function(doom_trig_table dir name)
+    set(dat ${doom_trig_dat_dir}/${name}.dat)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${dat})
+
+    file(READ ${dat} hex HEX)
+    file(MD5 ${dat} md5)
+    string(LENGTH "${hex}" len)
+    math(EXPR words "${len} / 8")
+
+    # Little-endian bytes to words, eight to a line
+    string(REGEX REPLACE "(..)(..)(..)(..)" "0x\\4\\3\\2\\1, " body "${hex}")
+    set(w "0x[0-9a-f]+, ")
+    string(REGEX REPLACE "(${w}${w}${w}${w}${w}${w}${w}${w})" "\\1\n" body "${body}")
+
+    file(WRITE ${dir}/${name}.inc.tmp
+        "/* Generated from ${name}.dat, do not edit */\n${body}\n")
+    configure_file(${dir}/${name}.inc.tmp ${dir}/${name}.inc COPYONLY)
+
+    set(trig_header "${trig_header}#define ${name}_WORDS ${words}\n#define ${name}_MD5 \"${md5}\"\n" PARENT_SCOPE)
+endfunction()
+
+# Writes the .inc files and trigtabl.h into dir
+function(doom_trig_tables dir)
+    set(trig_header "/* Generated from the .dat tables, do not edit */\n")
+    doom_trig_table(${dir} SINETABL)
+    doom_trig_table(${dir} TANGTABL)
+    doom_trig_table(${dir} TANTOANG)
+    file(WRITE ${dir}/trigtabl.h.tmp "${trig_header}")
+    configure_file(${dir}/trigtabl.h.tmp ${dir}/trigtabl.h COPYONLY)
+endfunction()
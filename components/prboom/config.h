@@ -64,8 +64,16 @@
 /* Define to 1 if you have the `mmap' function. */
 #define HAVE_MMAP 1
 
-/* Define if you want network game support */
-/* #undef HAVE_NET */
+/* Define if you want network game support (UDP netplay in menuconfig) */
+#include "sdkconfig.h"
+#ifdef CONFIG_DOOM_NETPLAY
+#define HAVE_NET 1
+#endif
+#if defined(CONFIG_DOOM_RENDER_8BIT_ONLY)
+#define RDRAW_ONLY_BITS 8
+#elif defined(CONFIG_DOOM_RENDER_RGB565)
+#define RDRAW_ONLY_BITS 16
+#endif
 
 /* Define to 1 if you have the <sched.h> header file. */
 #define HAVE_SCHED_H 0
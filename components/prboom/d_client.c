@@ -82,6 +82,13 @@ int ticdup = 1;
 static int xtratics = 0;
 int              wanted_player_number;
 
+#ifdef HAVE_NET
+// Tic latency: time from building a ticcmd to the server echoing it
+// back in a PKT_TICS, which is the input lag a netgame adds
+static int       ticbuilt[BACKUPTICS];
+static unsigned  latencysum, latencytics;
+#endif
+
 //ToDo: What is this? - JD
 int ms_to_next_tick;
 
@@ -110,13 +117,14 @@ void D_InitNetGame (void)
     netgame = M_CheckParm("-solo-net");
   } else {
     // Get game info from server
-    packet_header_t *packet = Z_Malloc(1000, PU_STATIC, NULL);
+    packet_header_t *packet = Z_Malloc(NET_MAXRECV, PU_STATIC, NULL);
     struct setup_packet_s *sinfo = (void*)(packet+1);
   struct { packet_header_t head; short pn; } PACKEDATTR initpacket;
 
     I_InitNetwork();
   udp_socket = I_Socket(0);
-  I_ConnectToServer(myargv[i]);
+  if (I_ConnectToServer(myargv[i]))
+    I_Error("D_InitNetGame: Unable to reach server %s", myargv[i]);
 
     do
     {
@@ -126,7 +134,7 @@ void D_InitNetGame (void)
 	packet_set(&initpacket.head, PKT_INIT, 0);
 	I_SendPacket(&initpacket.head, sizeof(initpacket));
 	I_WaitForPacket(5000);
-      } while (!I_GetPacket(packet, 1000));
+      } while (!I_GetPacket(packet, NET_MAXRECV));
       if (packet->type == PKT_DOWN) I_Error("Server aborted the game");
     } while (packet->type != PKT_SETUP);
 
@@ -270,12 +278,14 @@ boolean D_NetGetWad(const char* name)
 void NetUpdate(void)
 {
   static int lastmadetic;
+  static packet_header_t *recvbuf; // allocated once, for the largest packet
   if (isExtraDDisplay)
     return;
   if (server) { // Receive network packets
     size_t recvlen;
-    packet_header_t *packet = Z_Malloc(10000, PU_STATIC, NULL);
-    while ((recvlen = I_GetPacket(packet, 10000))) {
+    packet_header_t *packet = recvbuf ? recvbuf :
+      (recvbuf = Z_Malloc(NET_MAXRECV, PU_STATIC, NULL));
+    while ((recvlen = I_GetPacket(packet, NET_MAXRECV))) {
       switch(packet->type) {
       case PKT_TICS:
   {
@@ -287,6 +297,8 @@ void NetUpdate(void)
       *(byte*)(packet+1) = consoleplayer;
       I_SendPacket(packet, sizeof(*packet)+1);
     } else {
+      int oldremotetic = remotetic, now = I_GetTime_SaveMS();
+
       if (ptic + tics <= (unsigned)remotetic) break; // Will not improve things
       remotetic = ptic;
       while (tics--) {
@@ -298,6 +310,11 @@ void NetUpdate(void)
         }
         remotetic++;
       }
+      for (; oldremotetic < remotetic && oldremotetic < maketic; oldremotetic++)
+        if (maketic - oldremotetic <= BACKUPTICS) {
+          latencysum += now - ticbuilt[oldremotetic%BACKUPTICS];
+          latencytics++;
+        }
     }
   }
   break;
@@ -332,7 +349,6 @@ void NetUpdate(void)
   break;
       }
     }
-    Z_Free(packet);
   }
   { // Build new ticcmds
     int newtics = I_GetTime() - lastmadetic;
@@ -343,6 +359,7 @@ void NetUpdate(void)
       I_StartTic();
       if (maketic - gametic > BACKUPTICS/2) break;
       G_BuildTiccmd(&localcmds[maketic%BACKUPTICS]);
+      ticbuilt[maketic%BACKUPTICS] = I_GetTime_SaveMS();
       maketic++;
     }
     if (server && maketic > remotesend) { // Send the tics to the server
@@ -352,7 +369,7 @@ void NetUpdate(void)
       sendtics = maketic - remotesend;
       {
   size_t pkt_size = sizeof(packet_header_t) + 2 + sendtics * sizeof(ticcmd_t);
-  packet_header_t *packet = Z_Malloc(pkt_size, PU_STATIC, NULL);
+  packet_header_t *packet = I_AllocPacket(pkt_size);
 
   packet_set(packet, PKT_TICC, maketic - sendtics);
   *(byte*)(packet+1) = sendtics;
@@ -365,7 +382,7 @@ void NetUpdate(void)
     }
   }
   I_SendPacket(packet, pkt_size);
-  Z_Free(packet);
+  I_FreePacket(packet);
       }
     }
   }
@@ -530,6 +547,11 @@ static void D_QuitNetGame (void)
   packet_header_t *packet = (void*)buf;
   int i;
 
+  if (latencytics)
+    lprintf(LO_INFO, "D_QuitNetGame: %u tics, average latency %ums, %lu/%lu bytes sent/received\n",
+            latencytics, latencysum / latencytics,
+            (unsigned long)sentbytes, (unsigned long)recvdbytes);
+
   if (!server) return;
   buf[sizeof(packet_header_t)] = consoleplayer;
   packet_set(packet, PKT_QUIT, gametic);
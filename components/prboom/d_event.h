@@ -73,6 +73,7 @@ typedef enum
   ga_completed,
   ga_victory,
   ga_worlddone,
+  ga_rewind,
 } gameaction_t;
 
 
@@ -61,6 +61,8 @@
 #include "m_random.h"
 #include "p_setup.h"
 #include "p_saveg.h"
+#include "p_savestream.h"
+#include "g_snapshot.h"
 #include "p_tick.h"
 #include "p_map.h"
 #include "p_checksum.h"
@@ -87,10 +89,8 @@
 #include "r_demo.h"
 #include "r_fps.h"
 
-#define SAVEGAMESIZE  0x20000
 #define SAVESTRINGSIZE  24
 
-static size_t   savegamesize = SAVEGAMESIZE; // killough
 static boolean  netdemo;
 static const byte *demobuffer;   /* cph - only used for playback */
 static int demolength; // check for overrun (missing DEMOMARKER)
@@ -130,7 +130,6 @@ int             demover;
 boolean         singledemo;           // quit after playing a demo from cmdline
 wbstartstruct_t wminfo;               // parms for world map / intermission
 boolean         haswolflevels = false;// jff 4/18/98 wolf levels present
-static byte     *savebuffer;          // CPhipps - static
 int             autorun = false;      // always running?          // phares
 int             totalleveltimes;      // CPhipps - total time for all completed levels
 int		longtics;
@@ -190,6 +189,7 @@ int     key_quickload;
 int     key_quit;
 int     key_gamma;
 int     key_spy;
+int     key_rewind;
 int     key_pause;
 int     key_setup;
 int     destination_keys[MAXPLAYERS];
@@ -560,6 +560,8 @@ static void G_DoLoadLevel (void)
       //headsecnode = NULL;
   }
 
+  G_ClearSnapshots();   // they belong to the old level
+
   P_SetupLevel (gameepisode, gamemap, 0, gameskill);
   if (!demoplayback) // Don't switch views if playing a demo
     displayplayer = consoleplayer;    // view the guy you are playing
@@ -614,6 +616,15 @@ boolean G_Responder (event_t* ev)
       return true;
     }
 
+  // Rewind to the newest in-memory snapshot. Not in netgames, and not
+  // while recording since the demo can't follow.
+  if (ev->type == ev_keydown && ev->data1 == key_rewind && !netgame &&
+      !demorecording && gamestate == GS_LEVEL && G_NumSnapshots())
+    {
+      G_Rewind();
+      return true;
+    }
+
   // any other key pops up menu if in demos
   //
   // killough 8/2/98: enable automap in -timedemo demos
@@ -754,6 +765,9 @@ void G_Ticker (void)
         case ga_worlddone:
           G_DoWorldDone ();
           break;
+        case ga_rewind:
+          G_DoRewind ();
+          break;
         case ga_nothing:
           break;
         }
@@ -879,6 +893,7 @@ void G_Ticker (void)
     {
     case GS_LEVEL:
       P_Ticker ();
+      G_SnapshotTicker ();
       ST_Ticker ();
       AM_Ticker ();
       HU_Ticker ();
@@ -1329,6 +1344,11 @@ void G_DoCompleted (void)
       lprintf(LO_INFO, "FINISHED: E%dM%d\n", gameepisode, gamemap);
   }
 
+  // Read the next map in while the tally is on screen, unless the
+  // episode ends here and the finale comes next
+  if (gamemode == commercial ? gamemap != 30 : gamemap != 8)
+    P_PrefetchLevel(gameepisode, wminfo.next+1);
+
   WI_Start (&wminfo);
 }
 
@@ -1474,7 +1494,7 @@ void G_LoadGame(int slot, boolean command)
 
 static void G_LoadGameErr(const char *msg)
 {
-  Z_Free(savebuffer);                // Free the savegame buffer
+  P_CloseLoad();                     // Close the savegame stream
   M_ForcedLoadGame(msg);             // Print message asking for 'Y' to force
   if (command_loadgame)              // If this was a command-line -loadgame
     {
@@ -1511,21 +1531,37 @@ static const struct {
 
 static const size_t num_version_headers = sizeof(version_headers) / sizeof(version_headers[0]);
 
+// Read the NUL terminated pwad list from the savegame header
+static char *G_ReadSaveWads(void)
+{
+  size_t len = 0, max = 64;
+  char *wads = malloc(max);
+
+  while ((wads[len++] = P_ReadSaveByte()))
+    if (len == max)
+      wads = realloc(wads, max *= 2);
+  return wads;
+}
+
 void G_DoLoadGame(void)
 {
-  int  length, i;
+  int  i;
   // CPhipps - do savegame filename stuff here
   char name[PATH_MAX+1];     // killough 3/22/98
+  char version[VERSIONSIZE];
+  byte options[GAME_OPTION_SIZE];
   int savegame_compatibility = -1;
+  int starttime;
 
   G_SaveGameName(name,sizeof(name),savegameslot, demoplayback);
 
   gameaction = ga_nothing;
+  starttime = I_GetTime_SaveMS();
 
-  length = M_ReadFile(name, &savebuffer);
-  if (length<=0)
+  if (!P_OpenLoadFile(name))
     I_Error("Couldn't read file %s: %s", name, "(Unknown Error)");
-  save_p = savebuffer + SAVESTRINGSIZE;
+  P_SkipSave(SAVESTRINGSIZE);
+  P_ReadSave(version, VERSIONSIZE);
 
   // CPhipps - read the description field, compare with supported ones
   for (i=0; (size_t)i<num_version_headers; i++) {
@@ -1533,7 +1569,7 @@ void G_DoLoadGame(void)
     // killough 2/22/98: "proprietary" version string :-)
     sprintf (vcheck, version_headers[i].ver_printf, version_headers[i].version);
 
-    if (!strncmp(save_p, vcheck, VERSIONSIZE)) {
+    if (!strncmp(version, vcheck, VERSIONSIZE)) {
       savegame_compatibility = version_headers[i].comp_level;
       i = num_version_headers;
     }
@@ -1547,70 +1583,68 @@ void G_DoLoadGame(void)
     }
   }
 
-  save_p += VERSIONSIZE;
-
   // CPhipps - always check savegames even when forced,
   //  only print a warning if forced
   {  // killough 3/16/98: check lump name checksum (independent of order)
-    uint_64_t checksum = 0;
+    uint_64_t checksum = 0, saved;
+    char *wads;
 
     checksum = G_Signature();
+    P_ReadSave(&saved, sizeof saved);
+    wads = G_ReadSaveWads();
 
-    if (memcmp(&checksum, save_p, sizeof checksum)) {
+    if (memcmp(&checksum, &saved, sizeof checksum)) {
       if (!forced_loadgame) {
-        char *msg = malloc(strlen(save_p + sizeof checksum) + 128);
+        char *msg = malloc(strlen(wads) + 128);
         strcpy(msg,"Incompatible Savegame!!!\n");
-        if (save_p[sizeof checksum])
-          strcat(strcat(msg,"Wads expected:\n\n"), save_p + sizeof checksum);
+        if (wads[0])
+          strcat(strcat(msg,"Wads expected:\n\n"), wads);
         strcat(msg, "\nAre you sure?");
+        free(wads);
         G_LoadGameErr(msg);
         free(msg);
         return;
       } else
   lprintf(LO_WARN, "G_DoLoadGame: Incompatible savegame\n");
     }
-    save_p += sizeof checksum;
+    free(wads);
    }
 
-  save_p += strlen(save_p)+1;
-
-  compatibility_level = (savegame_compatibility >= prboom_4_compatibility) ? *save_p : savegame_compatibility;
+  i = P_ReadSaveByte();
+  compatibility_level = (savegame_compatibility >= prboom_4_compatibility) ? i : savegame_compatibility;
   if (savegame_compatibility < prboom_6_compatibility)
     compatibility_level = map_old_comp_levels[compatibility_level];
-  save_p++;
 
-  gameskill = *save_p++;
-  gameepisode = *save_p++;
-  gamemap = *save_p++;
+  gameskill = P_ReadSaveByte();
+  gameepisode = P_ReadSaveByte();
+  gamemap = P_ReadSaveByte();
 
   for (i=0 ; i<MAXPLAYERS ; i++)
-    playeringame[i] = *save_p++;
-  save_p += MIN_MAXPLAYERS-MAXPLAYERS;         // killough 2/28/98
+    playeringame[i] = P_ReadSaveByte();
+  P_SkipSave(MIN_MAXPLAYERS-MAXPLAYERS);         // killough 2/28/98
 
-  idmusnum = *save_p++;           // jff 3/17/98 restore idmus music
+  idmusnum = P_ReadSaveByte();    // jff 3/17/98 restore idmus music
   if (idmusnum==255) idmusnum=-1; // jff 3/18/98 account for unsigned byte
 
   /* killough 3/1/98: Read game options
    * killough 11/98: move down to here
    */
-  save_p = (char*)G_ReadOptions(save_p);
+  P_ReadSave(options, GAME_OPTION_SIZE);
+  G_ReadOptions(options);
 
   // load a base level
   G_InitNew (gameskill, gameepisode, gamemap);
 
   /* get the times - killough 11/98: save entire word */
-  memcpy(&leveltime, save_p, sizeof leveltime);
-  save_p += sizeof leveltime;
+  P_ReadSave(&leveltime, sizeof leveltime);
 
   /* cph - total episode time */
-  if (compatibility_level >= prboom_2_compatibility) {
-    memcpy(&totalleveltimes, save_p, sizeof totalleveltimes);
-    save_p += sizeof totalleveltimes;
-  }
+  if (compatibility_level >= prboom_2_compatibility)
+    P_ReadSave(&totalleveltimes, sizeof totalleveltimes);
   else totalleveltimes = 0;
 
   // killough 11/98: load revenant tracer state
-  basetic = gametic - *save_p++;
+  basetic = gametic - P_ReadSaveByte();
 
   // dearchive all the modifications
   P_MapStart();
@@ -1623,11 +1657,15 @@ void G_DoLoadGame(void)
   P_MapEnd();
   R_SmoothPlaying_Reset(NULL); // e6y
 
-  if (*save_p != 0xe6)
+  if (P_ReadSaveByte() != 0xe6)
     I_Error ("G_DoLoadGame: Bad savegame");
 
   // done
-  Z_Free (savebuffer);
+  if (!P_CloseLoad())
+    I_Error ("G_DoLoadGame: Savegame CRC mismatch");
+  lprintf(LO_INFO, "G_DoLoadGame: %u bytes (%u stored) in %dms\n",
+          (unsigned)P_SaveStreamPos(), (unsigned)P_SaveStreamStored(),
+          I_GetTime_SaveMS() - starttime);
 
   if (setsizeneeded)
     R_ExecuteSetViewSize ();
@@ -1671,30 +1709,6 @@ void G_SaveGame(int slot, char *description)
 #endif
 }
 
-// Check for overrun and realloc if necessary -- Lee Killough 1/22/98
-void (CheckSaveGame)(size_t size, const char* file, int line)
-{
-  size_t pos = save_p - savebuffer;
-
-#ifdef RANGECHECK
-  /* cph 2006/08/07 - after-the-fact sanity checking of CheckSaveGame calls */
-  static size_t prev_check;
-  static const char* prevf;
-  static int prevl;
-
-  if (pos > prev_check)
-    I_Error("CheckSaveGame at %s:%d called for insufficient buffer (%u < %u)", prevf, prevl, prev_check, pos);
-  prev_check = size + pos;
-  prevf = file;
-  prevl = line;
-#endif
-
-  size += 1024;  // breathing room
-  if (pos+size > savegamesize)
-    save_p = (savebuffer = realloc(savebuffer,
-           savegamesize += (size+1023) & ~1023)) + pos;
-}
-
 /* killough 3/22/98: form savegame name in one location
  * (previously code was scattered around in multiple places)
  * cph - Avoid possible buffer overflow problems by passing
@@ -1715,7 +1729,9 @@ static void G_DoSaveGame (boolean menu)
   char name[PATH_MAX+1];
   char name2[VERSIONSIZE];
   char *description;
-  int  length, i;
+  byte options[GAME_OPTION_SIZE];
+  int  i, starttime;
+  boolean ok;
 
   gameaction = ga_nothing; // cph - cancel savegame at top of this function,
     // in case later problems cause a premature exit
@@ -1723,12 +1739,18 @@ static void G_DoSaveGame (boolean menu)
   G_SaveGameName(name,sizeof(name),savegameslot, demoplayback && !menu);
 
   description = savedescription;
+  starttime = I_GetTime_SaveMS();
 
-  save_p = savebuffer = malloc(savegamesize);
+  // The savegame is streamed straight to the file in small chunks,
+  // rather than built up in memory first
+  if (!P_OpenSaveFile(name, savegame_compress))
+    {
+      doom_printf("Game save failed!");
+      savedescription[0] = 0;
+      return;
+    }
 
-  CheckSaveGame(SAVESTRINGSIZE+VERSIONSIZE+sizeof(uint_64_t));
-  memcpy (save_p, description, SAVESTRINGSIZE);
-  save_p += SAVESTRINGSIZE;
+  P_WriteSave(description, SAVESTRINGSIZE);
   memset (name2,0,sizeof(name2));
 
   // CPhipps - scan for the version header
@@ -1736,16 +1758,14 @@ static void G_DoSaveGame (boolean menu)
     if (version_headers[i].comp_level == best_compatibility) {
       // killough 2/22/98: "proprietary" version string :-)
       sprintf (name2,version_headers[i].ver_printf,version_headers[i].version);
-      memcpy (save_p, name2, VERSIONSIZE);
       i = num_version_headers+1;
     }
 
-  save_p += VERSIONSIZE;
+  P_WriteSave(name2, VERSIONSIZE);
 
   { /* killough 3/16/98, 12/98: store lump name checksum */
     uint_64_t checksum = G_Signature();
-    memcpy(save_p, &checksum, sizeof checksum);
-    save_p += sizeof checksum;
+    P_WriteSave(&checksum, sizeof checksum);
   }
 
   // killough 3/16/98: store pwad filenames in savegame
@@ -1755,46 +1775,40 @@ static void G_DoSaveGame (boolean menu)
     for (i = 0; i<numwadfiles; i++)
       {
         const char *const w = wadfiles[i].name;
-        CheckSaveGame(strlen(w)+2);
-        strcpy(save_p, w);
-        save_p += strlen(save_p);
-        *save_p++ = '\n';
+        P_WriteSave(w, strlen(w));
+        P_WriteSaveByte('\n');
       }
-    *save_p++ = 0;
+    P_WriteSaveByte(0);
   }
 
-  CheckSaveGame(GAME_OPTION_SIZE+MIN_MAXPLAYERS+14);
+  P_WriteSaveByte(compatibility_level);
 
-  *save_p++ = compatibility_level;
-
-  *save_p++ = gameskill;
-  *save_p++ = gameepisode;
-  *save_p++ = gamemap;
+  P_WriteSaveByte(gameskill);
+  P_WriteSaveByte(gameepisode);
+  P_WriteSaveByte(gamemap);
 
   for (i=0 ; i<MAXPLAYERS ; i++)
-    *save_p++ = playeringame[i];
+    P_WriteSaveByte(playeringame[i]);
 
   for (;i<MIN_MAXPLAYERS;i++)         // killough 2/28/98
-    *save_p++ = 0;
+    P_WriteSaveByte(0);
 
-  *save_p++ = idmusnum;               // jff 3/17/98 save idmus state
+  P_WriteSaveByte(idmusnum);          // jff 3/17/98 save idmus state
 
-  save_p = G_WriteOptions(save_p);    // killough 3/1/98: save game options
+  G_WriteOptions(options);            // killough 3/1/98: save game options
+  P_WriteSave(options, GAME_OPTION_SIZE);
 
   /* cph - FIXME - endianness? */
   /* killough 11/98: save entire word */
-  memcpy(save_p, &leveltime, sizeof leveltime);
-  save_p += sizeof leveltime;
+  P_WriteSave(&leveltime, sizeof leveltime);
 
   /* cph - total episode time */
-  if (compatibility_level >= prboom_2_compatibility) {
-    memcpy(save_p, &totalleveltimes, sizeof totalleveltimes);
-    save_p += sizeof totalleveltimes;
-  }
+  if (compatibility_level >= prboom_2_compatibility)
+    P_WriteSave(&totalleveltimes, sizeof totalleveltimes);
   else totalleveltimes = 0;
 
   // killough 11/98: save revenant tracer state
-  *save_p++ = (gametic-basetic) & 255;
+  P_WriteSaveByte((gametic-basetic) & 255);
 
   // killough 3/22/98: add Z_CheckHeap after each call to ensure consistency
   Z_CheckHeap();
@@ -1822,17 +1836,17 @@ static void G_DoSaveGame (boolean menu)
   Z_CheckHeap();
   P_ArchiveMap();    // killough 1/22/98: save automap information
 
-  *save_p++ = 0xe6;   // consistancy marker
-
-  length = save_p - savebuffer;
+  P_WriteSaveByte(0xe6);   // consistancy marker
 
   Z_CheckHeap();
-  doom_printf( "%s", M_WriteFile(name, savebuffer, length)
+  ok = P_CloseSave();
+  doom_printf( "%s", ok
          ? s_GGSAVED /* Ty - externalised */
          : "Game save failed!"); // CPhipps - not externalised
-
-  free(savebuffer);  // killough
-  savebuffer = save_p = NULL;
+  if (ok)
+    lprintf(LO_INFO, "G_DoSaveGame: %u bytes (%u stored) in %dms\n",
+            (unsigned)P_SaveStreamPos(), (unsigned)P_SaveStreamStored(),
+            I_GetTime_SaveMS() - starttime);
 
   savedescription[0] = 0;
 }
@@ -2150,6 +2164,18 @@ void G_InitNew(skill_t skill, int episode, int map)
 
 #define DEMOMARKER    0x80
 
+/* Demo read position, so that snapshots can rewind demo playback */
+int G_GetDemoOffset(void)
+{
+  return demoplayback && demobuffer ? demo_p - demobuffer : -1;
+}
+
+void G_SetDemoOffset(int offset)
+{
+  if (demoplayback && demobuffer && offset >= 0)
+    demo_p = demobuffer + offset;
+}
+
 void G_ReadDemoTiccmd (ticcmd_t* cmd)
 {
   unsigned char at = 0; // e6y: tasdoom stuff
@@ -69,6 +69,8 @@ void G_DoReborn(int playernum);
 void G_DoPlayDemo(void);
 void G_DoCompleted(void);
 void G_ReadDemoTiccmd(ticcmd_t *cmd);
+int G_GetDemoOffset(void);
+void G_SetDemoOffset(int offset);
 void G_WriteDemoTiccmd(ticcmd_t *cmd);
 void G_DoWorldDone(void);
 void G_Compatibility(void);
@@ -122,6 +124,7 @@ extern int  key_quicksave;
 extern int  key_endgame;
 extern int  key_messages;
 extern int  key_quickload;
+extern int  key_rewind;
 extern int  key_quit;
 extern int  key_gamma;
 extern int  key_spy;
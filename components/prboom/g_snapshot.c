@@ -0,0 +1,373 @@
+/* Emacs style mode select   -*- C++ -*-
+ *-----------------------------------------------------------------------------
+ *
+ *
+ *  PrBoom: a Doom port merged with LxDoom and LSDLDoom
+ *  based on BOOM, a modified and improved DOOM engine
+ *  Copyright (C) 1999 by
+ *  id Software, Chi Hoang, Lee Killough, Jim Flynn, Rand Phares, Ty Halderman
+ *  Copyright (C) 1999-2000 by
+ *  Jess Haas, Nicolas Kalkhof, Colin Phipps, Florian Schulze
+ *  Copyright 2005, 2006 by
+ *  Florian Schulze, Colin Phipps, Neil Stevens, Andrey Budko
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ *  02111-1307, USA.
+ *
+ * DESCRIPTION:
+ *      In-memory game state snapshots.
+ *
+ *  Every snapshot_interval tics the level state is serialised with the
+ *  same P_Archive* functions the savegame code uses, into a memory
+ *  save stream, and kept in a ring of snapshot_count entries. Every
+ *  SNAPSHOT_KEYFRAMES'th snapshot (or more often, in a small ring) is
+ *  a keyframe, the ones in between are stored XORed against it, so
+ *  that they compress to a small fraction of the state. Restoring one
+ *  takes milliseconds and touches no files.
+ *
+ *  Each snapshot records the CRC32 of its state. Logging those for two
+ *  runs of the same demo narrows a desync down to one interval, which
+ *  can then be replayed from the snapshot with P_Checksum recording.
+ *
+ *-----------------------------------------------------------------------------*/
+
+#include "doomstat.h"
+#include "g_game.h"
+#include "p_saveg.h"
+#include "p_savestream.h"
+#include "p_map.h"
+#include "p_maputl.h"
+#include "p_spec.h"
+#include "p_tick.h"
+#include "r_fps.h"
+#include "r_demo.h"
+#include "s_sound.h"
+#include "i_system.h"
+#include "lprintf.h"
+#include "g_snapshot.h"
+
+int snapshot_interval = 0;
+int snapshot_count = 8;
+
+#define SNAPSHOT_KEYFRAMES 8
+
+typedef struct {
+  byte   *data;       // packed save stream
+  size_t len;         // size of the packed stream
+  size_t rawlen;      // size of the state it unpacks to
+  int    key;         // ring slot of the keyframe, or -1 if it is one
+  int    leveltime;
+  int    ticdiff;     // gametic - basetic at the time
+  int    demopos;     // demo read offset, -1 if no demo was playing
+  unsigned int crc;   // CRC32 of the state
+} snapshot_t;
+
+static snapshot_t *snapshots;
+static int numslots;
+static int snaptail;  // oldest
+static int numsnaps;
+static int sincekey;  // snapshots since the last keyframe
+static int lastsnaptime = -1;
+
+// Unpacked copy of the newest keyframe, the base for new deltas
+static byte *keyraw;
+static size_t keyrawlen;
+static int keyslot = -1;
+
+// Snapshots per keyframe group. A full ring evicts the oldest group
+// whole, so groups are kept to at most half the ring, and there is
+// always history left behind the one being evicted.
+static int G_KeyframeGroup(void)
+{
+  int group = numslots / 2;
+
+  if (group > SNAPSHOT_KEYFRAMES)
+    group = SNAPSHOT_KEYFRAMES;
+  return group > 1 ? group : 1;
+}
+
+static int G_SnapshotSlot(int n)
+{
+  return (snaptail + numsnaps - 1 - n) % numslots;
+}
+
+static void G_FreeSnapshot(int slot)
+{
+  free(snapshots[slot].data);
+  snapshots[slot].data = NULL;
+}
+
+void G_ClearSnapshots(void)
+{
+  while (numsnaps)
+    {
+      G_FreeSnapshot(snaptail);
+      snaptail = (snaptail + 1) % numslots;
+      numsnaps--;
+    }
+  free(keyraw);
+  keyraw = NULL;
+  keyrawlen = 0;
+  keyslot = -1;
+  sincekey = 0;
+  lastsnaptime = -1;
+}
+
+// Drop the oldest snapshot. Deltas can't outlive their keyframe, so
+// dropping a keyframe drops everything up to the next one as well.
+static void G_DropOldestSnapshot(void)
+{
+  do
+    {
+      if (snaptail == keyslot)
+        {
+          free(keyraw);
+          keyraw = NULL;
+          keyslot = -1;
+        }
+      G_FreeSnapshot(snaptail);
+      snaptail = (snaptail + 1) % numslots;
+      numsnaps--;
+    }
+  while (numsnaps && snapshots[snaptail].key >= 0);
+}
+
+// Unpack a snapshot's state into a malloc'ed buffer
+static byte *G_UnpackSnapshot(const snapshot_t *snap)
+{
+  byte *raw = malloc(snap->rawlen);
+
+  P_OpenLoadMem(snap->data, snap->len, NULL, 0);
+  P_ReadSave(raw, snap->rawlen);
+  if (!P_CloseLoad())
+    I_Error("G_UnpackSnapshot: Snapshot corrupt");
+  return raw;
+}
+
+static void G_ArchiveSnapshot(void)
+{
+  P_ArchivePlayers();
+  P_ThinkerToIndex();
+  P_ArchiveWorld();
+  P_ArchiveThinkers();
+  P_IndexToThinker();
+  P_ArchiveSpecials();
+  P_ArchiveRNG();
+  P_ArchiveMap();
+}
+
+static void G_TakeSnapshot(void)
+{
+  snapshot_t *snap;
+  boolean key;
+  byte *data;
+  size_t len;
+  int slot, starttime = I_GetTime_SaveMS();
+
+  if (!snapshots || numslots != snapshot_count)
+    {
+      G_ClearSnapshots();
+      free(snapshots);
+      numslots = snapshot_count;
+      snapshots = calloc(numslots, sizeof *snapshots);
+      snaptail = 0;
+    }
+
+  if (numsnaps == numslots)
+    G_DropOldestSnapshot();
+
+  key = keyslot < 0 || sincekey >= G_KeyframeGroup()-1;
+
+  P_OpenSaveMem(true, key ? NULL : keyraw, keyrawlen);
+  G_ArchiveSnapshot();
+  if (!(data = P_CloseSaveMem(&len)))
+    {
+      lprintf(LO_WARN, "G_TakeSnapshot: Out of memory, tic %d not kept\n", leveltime);
+      return;
+    }
+
+  slot = (snaptail + numsnaps++) % numslots;
+  snap = &snapshots[slot];
+  snap->data = data;
+  snap->len = len;
+  snap->rawlen = P_SaveStreamPos();
+  snap->crc = P_SaveStreamCRC();
+  snap->key = key ? -1 : keyslot;
+  snap->leveltime = leveltime;
+  snap->ticdiff = gametic - basetic;
+  snap->demopos = G_GetDemoOffset();
+
+  if (key)
+    {
+      free(keyraw);
+      keyraw = G_UnpackSnapshot(snap);
+      keyrawlen = snap->rawlen;
+      keyslot = slot;
+      sincekey = 0;
+    }
+  else
+    sincekey++;
+
+  lprintf(LO_DEBUG, "G_TakeSnapshot: tic %d crc %08x, %u/%u bytes%s, %dms\n",
+          leveltime, snap->crc, (unsigned)snap->len, (unsigned)snap->rawlen,
+          key ? " (key)" : "", I_GetTime_SaveMS() - starttime);
+}
+
+void G_SnapshotTicker(void)
+{
+  // A timedemo is a benchmark; don't bill it for the snapshots
+  if (!snapshot_interval || netgame || timingdemo ||
+      leveltime == lastsnaptime || leveltime % snapshot_interval)
+    return;
+
+  lastsnaptime = leveltime;
+  G_TakeSnapshot();
+}
+
+int G_NumSnapshots(void)
+{
+  return numsnaps;
+}
+
+int G_SnapshotTime(int n)
+{
+  return n >= 0 && n < numsnaps ? snapshots[G_SnapshotSlot(n)].leveltime : -1;
+}
+
+unsigned int G_SnapshotCRC(int n)
+{
+  return n >= 0 && n < numsnaps ? snapshots[G_SnapshotSlot(n)].crc : 0;
+}
+
+//
+// G_ClearLevelThinkers
+//
+// Unlink and free every thinker in the level, so the snapshot's can
+// take their place. P_UnArchiveThinkers only marks mobjs as removed,
+// which is fine after P_SetupLevel has reset the zone but would leak
+// a level's worth of mobjs on every rewind here.
+//
+
+static void G_ClearLevelThinkers(void)
+{
+  thinker_t *th, *next;
+
+  R_StopAllInterpolations();
+  P_RemoveAllActiveCeilings();
+  P_RemoveAllActivePlats();
+
+  for (th = thinkercap.next; th != &thinkercap; th = th->next)
+    if (th->function == P_MobjThinker)
+      {
+        mobj_t *mo = (mobj_t *) th;
+
+        P_UnsetThingPosition(mo);
+        if (sector_list)
+          {
+            P_DelSeclist(sector_list);
+            sector_list = NULL;
+          }
+        S_StopSound(mo);
+      }
+
+  for (th = thinkercap.next; th != &thinkercap; th = next)
+    {
+      next = th->next;
+      Z_Free(th);
+    }
+  P_InitThinkers();
+  bodyqueslot = 0;
+}
+
+boolean G_RestoreSnapshot(int n)
+{
+  snapshot_t *snap;
+  byte *base = NULL;
+  int slot, starttime = I_GetTime_SaveMS();
+
+  if (n < 0 || n >= numsnaps)
+    return false;
+
+  slot = G_SnapshotSlot(n);
+  snap = &snapshots[slot];
+
+  if (snap->key >= 0)
+    base = snap->key == keyslot ? keyraw : G_UnpackSnapshot(&snapshots[snap->key]);
+
+  P_OpenLoadMem(snap->data, snap->len, base, base ? snapshots[snap->key].rawlen : 0);
+
+  G_ClearLevelThinkers();
+  P_MapStart();
+  P_UnArchivePlayers();
+  P_UnArchiveWorld();
+  P_UnArchiveThinkers();
+  P_UnArchiveSpecials();
+  P_UnArchiveRNG();
+  P_UnArchiveMap();
+  P_MapEnd();
+  R_SmoothPlaying_Reset(NULL);
+
+  if (!P_CloseLoad())
+    I_Error("G_RestoreSnapshot: Snapshot corrupt");
+  if (base && base != keyraw)
+    free(base);
+
+  leveltime = lastsnaptime = snap->leveltime;
+  basetic = gametic - snap->ticdiff;
+  G_SetDemoOffset(snap->demopos);
+
+  // Anything newer belongs to the timeline we just left
+  while (n--)
+    {
+      int newest = G_SnapshotSlot(0);
+
+      if (newest == keyslot)
+        {
+          free(keyraw);
+          keyraw = NULL;
+          keyslot = -1;
+        }
+      G_FreeSnapshot(newest);
+      numsnaps--;
+    }
+  if (keyslot < 0)
+    {
+      // Next snapshot must be a keyframe
+      sincekey = SNAPSHOT_KEYFRAMES;
+    }
+  else
+    {
+      sincekey = 0;
+      for (n = 0; n < numsnaps && snapshots[G_SnapshotSlot(n)].key >= 0; n++)
+        sincekey++;
+    }
+
+  lprintf(LO_DEBUG, "G_RestoreSnapshot: tic %d in %dms\n",
+          leveltime, I_GetTime_SaveMS() - starttime);
+  return true;
+}
+
+void G_Rewind(void)
+{
+  if (numsnaps)
+    gameaction = ga_rewind;
+}
+
+void G_DoRewind(void)
+{
+  gameaction = ga_nothing;
+  if (G_RestoreSnapshot(0))
+    doom_printf("Rewound to %d:%02d", leveltime/TICRATE/60, leveltime/TICRATE%60);
+}
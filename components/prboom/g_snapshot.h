@@ -0,0 +1,63 @@
+/* Emacs style mode select   -*- C++ -*-
+ *-----------------------------------------------------------------------------
+ *
+ *
+ *  PrBoom: a Doom port merged with LxDoom and LSDLDoom
+ *  based on BOOM, a modified and improved DOOM engine
+ *  Copyright (C) 1999 by
+ *  id Software, Chi Hoang, Lee Killough, Jim Flynn, Rand Phares, Ty Halderman
+ *  Copyright (C) 1999-2000 by
+ *  Jess Haas, Nicolas Kalkhof, Colin Phipps, Florian Schulze
+ *  Copyright 2005, 2006 by
+ *  Florian Schulze, Colin Phipps, Neil Stevens, Andrey Budko
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ *  02111-1307, USA.
+ *
+ * DESCRIPTION:
+ *      In-memory game state snapshots for rewind and desync hunting.
+ *
+ *-----------------------------------------------------------------------------*/
+
+#ifndef __G_SNAPSHOT__
+#define __G_SNAPSHOT__
+
+#include "doomtype.h"
+
+extern int snapshot_interval; /* tics between snapshots, 0 = off */
+extern int snapshot_count;    /* size of the snapshot ring */
+
+/* Drop all snapshots, called whenever a level is (re)loaded */
+void G_ClearSnapshots(void);
+
+/* Take a snapshot every snapshot_interval tics of leveltime */
+void G_SnapshotTicker(void);
+
+/* Number of snapshots held, and the leveltime and state CRC of one
+ * (0 is the newest). Comparing CRCs between two runs of a demo finds
+ * the interval a desync happened in. */
+int G_NumSnapshots(void);
+int G_SnapshotTime(int n);
+unsigned int G_SnapshotCRC(int n);
+
+/* Restore snapshot n (0 is the newest), discarding any newer ones.
+ * Returns false if there is no such snapshot. */
+boolean G_RestoreSnapshot(int n);
+
+/* Queue a rewind to the newest snapshot for the next G_Ticker */
+void G_Rewind(void);
+void G_DoRewind(void);
+
+#endif
@@ -231,7 +231,7 @@ static void gld_AddPatchToTexture_UnTranslated(GLTexture *gltexture, unsigned ch
         js=-y;
       if ((je+y)>gltexture->realtexheight)
         je+=(gltexture->realtexheight-(je+y));
-      source = column->pixels + post->topdelta;
+      source = column->pixels + post->pixofs;
       if (paletted) {
         pos=(((js+y)*gltexture->buffer_width)+x+originx);
         for (j=js;j<je;j++,pos+=(gltexture->buffer_width))
@@ -325,7 +325,7 @@ void gld_AddPatchToTexture(GLTexture *gltexture, unsigned char *buffer, const rp
         js=-y;
       if ((je+y)>gltexture->realtexheight)
         je+=(gltexture->realtexheight-(je+y));
-      source = column->pixels + post->topdelta;
+      source = column->pixels + post->pixofs;
       if (paletted) {
         pos=(((js+y)*gltexture->buffer_width)+x+originx);
         for (j=js;j<je;j++,pos+=(gltexture->buffer_width))
@@ -42,9 +42,20 @@
  #define UDP_CHANNEL int
  extern UDP_SOCKET udp_socket;
 #else
+ #define UDP_SOCKET int
+ #define UDP_PACKET packet_header_t
  #define UDP_CHANNEL struct sockaddr
+ extern UDP_SOCKET udp_socket;
 #endif
 
+/* Largest packet we send; keeps clear of IP fragmentation */
+#define NET_MAXPACKET 1400
+
+/* Largest packet the server sends us, what PrBoom's client has always
+ * received into: a PKT_SETUP with its WAD list or a PKT_TICS catching
+ * up on many tics goes past NET_MAXPACKET, fragmented */
+#define NET_MAXRECV 10000
+
 #ifndef IPPORT_RESERVED
         #define IPPORT_RESERVED 1024
 #endif
@@ -60,8 +71,19 @@ int I_ConnectToServer(const char *serv);
 UDP_CHANNEL I_RegisterPlayer(IPaddress *ipaddr);
 void I_UnRegisterPlayer(UDP_CHANNEL channel);
 extern IPaddress sentfrom_addr;
+#else
+UDP_SOCKET I_Socket(unsigned short port);
+void I_CloseSocket(UDP_SOCKET sock);
+int I_ConnectToServer(const char *serv);
+void I_Disconnect(void);
 #endif
 
+/* Packet buffers of up to NET_MAXPACKET bytes from a pool set up by
+ * I_InitNetwork, so the tic loop doesn't go through the zone. Packets
+ * can be received into and sent from them directly. */
+UDP_PACKET *I_AllocPacket(int size);
+void I_FreePacket(UDP_PACKET *packet);
+
 #ifdef AF_INET
 void I_SendPacketTo(packet_header_t* packet, size_t len, UDP_CHANNEL *to);
 void I_SetupSocket(int sock, int port, int family);
@@ -91,6 +91,17 @@ void I_Close(int fd);
 void *I_Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset);
 int I_Munmap(void *addr, size_t length);
 
+/* Run job on the other core while the game carries on, e.g. to read
+ * lumps ahead with I_Mmap. I_WaitBackground blocks until it returns.
+ * One job at a time; returns false, without running it, if the job
+ * can't be started. */
+boolean I_StartBackground(void (*job)(void));
+void I_WaitBackground(void);
+
+/* Same without blocking: true once the job has returned (or if there
+ * is none), after which the next one can be started. */
+boolean I_BackgroundDone(void);
+
 int isValidPtr(void *ptr);
 // void freeUnusedMmaps(void);
 #endif
@@ -70,6 +70,8 @@
 #include "r_draw.h"
 #include "r_demo.h"
 #include "r_fps.h"
+#include "p_savestream.h"
+#include "g_snapshot.h"
 
 /* cph - disk icon not implemented */
 static inline void I_BeginRead(void) {}
@@ -201,6 +203,18 @@ default_t defaults[] =
    def_hex, ss_none}, // 0, +1 for colours, +2 for non-ascii chars, +4 for skip-last-line
   {"level_precache",{(int*)&precache},{0},0,1,
    def_bool,ss_none}, // precache level data?
+  {"level_prefetch_kb",{&lump_prefetch_kb},{512},0,4096,
+   def_int,ss_none}, // KB of next level's lumps read during intermission, 0 = off
+  {"texture_cache_kb",{&texture_cache_kb},{2048},0,65536,
+   def_int,ss_none}, // KB of composed wall textures kept, 0 = no limit
+  {"texture_warm",{&texture_warm},{0},0,1,
+   def_bool,ss_none}, // read ahead patches of textures next to the view
+  {"savegame_compress",{&savegame_compress},{1},0,1,
+   def_bool,ss_none}, // LZ compress savegames as they are streamed out
+  {"snapshot_interval",{&snapshot_interval},{0},0,35*60,
+   def_int,ss_none}, // tics between in-memory rewind snapshots, 0 = off
+  {"snapshot_count",{&snapshot_count},{8},1,64,
+   def_int,ss_none}, // number of rewind snapshots kept
   {"demo_smoothturns", {&demo_smoothturns},  {0},0,1,
    def_bool,ss_stat},
   {"demo_smoothturnsfactor", {&demo_smoothturnsfactor},  {6},1,SMOOTH_PLAYING_MAXFACTOR,
@@ -330,7 +344,10 @@ default_t defaults[] =
    def_int,ss_none}, // set percentage of foreground/background translucency mix
   {"screenblocks",{&screenblocks},{10},3,11,  // killough 2/21/98: default to 10
    def_int,ss_none},
-  {"usegamma",{&usegamma},{3},0,4, //jff 3/6/98 fix erroneous upper limit in range
+  // Saved as usegamma until gamma was applied on the LCD. Configs kept
+  // 3, the old default, without it ever showing; under a new name they
+  // come up at 0, looking as they did, rather than brighter.
+  {"gamma_level",{&usegamma},{0},0,4, //jff 3/6/98 fix erroneous upper limit in range
    def_int,ss_none}, // gamma correction level // killough 1/18/98
   {"uncapped_framerate", {&movement_smooth},  {0},0,1,
    def_bool,ss_stat},
@@ -453,6 +470,8 @@ default_t defaults[] =
    0,MAX_KEY,def_key,ss_keys}, // key to toggle message enable
   {"key_quickload",   {&key_quickload},      {KEYD_F9}        ,
    0,MAX_KEY,def_key,ss_keys}, // key to load from quicksave
+  {"key_rewind",      {&key_rewind},         {KEYD_INSERT}    ,
+   0,MAX_KEY,def_key,ss_keys}, // key to rewind to the last snapshot
   {"key_quit",        {&key_quit},           {KEYD_F10}       ,
    0,MAX_KEY,def_key,ss_keys}, // key to quit game
   {"key_gamma",       {&key_gamma},          {KEYD_F11}       ,
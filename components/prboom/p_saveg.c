@@ -41,12 +41,7 @@
 #include "am_map.h"
 #include "p_enemy.h"
 #include "lprintf.h"
-
-byte *save_p;
-
-// Pads save_p to a 4-byte boundary
-//  so that the load/save works on SGI&Gecko.
-#define PADSAVEP()    do { save_p += (4 - ((int) save_p & 3)) & 3; } while (0)
+#include "p_savestream.h"
 //
 // P_ArchivePlayers
 //
@@ -54,21 +49,19 @@ void P_ArchivePlayers (void)
 {
   int i;
 
-  CheckSaveGame(sizeof(player_t) * MAXPLAYERS); // killough
   for (i=0 ; i<MAXPLAYERS ; i++)
     if (playeringame[i])
       {
         int      j;
-        player_t *dest;
+        player_t dest;
 
-        PADSAVEP();
-        dest = (player_t *) save_p;
-        memcpy(dest, &players[i], sizeof(player_t));
-        save_p += sizeof(player_t);
+        P_PadSave();
+        memcpy(&dest, &players[i], sizeof(player_t));
         for (j=0; j<NUMPSPRITES; j++)
-          if (dest->psprites[j].state)
-            dest->psprites[j].state =
-              (state_t *)(dest->psprites[j].state-states);
+          if (dest.psprites[j].state)
+            dest.psprites[j].state =
+              (state_t *)(dest.psprites[j].state-states);
+        P_WriteSave(&dest, sizeof(player_t));
       }
 }
 
@@ -84,10 +77,9 @@ void P_UnArchivePlayers (void)
       {
         int j;
 
-        PADSAVEP();
+        P_PadLoad();
 
-        memcpy(&players[i], save_p, sizeof(player_t));
-        save_p += sizeof(player_t);
+        P_ReadSave(&players[i], sizeof(player_t));
 
         // will be set when unarc thinker
         players[i].mo = NULL;
@@ -102,6 +94,21 @@ void P_UnArchivePlayers (void)
 }
 
 
+// Sector and line fields are stored as shorts, native endian
+
+static void P_WriteSaveShort(short v)
+{
+  P_WriteSave(&v, sizeof v);
+}
+
+static short P_ReadSaveShort(void)
+{
+  short v;
+
+  P_ReadSave(&v, sizeof v);
+  return v;
+}
+
 //
 // P_ArchiveWorld
 //
@@ -111,44 +118,21 @@ void P_ArchiveWorld (void)
   const sector_t *sec;
   const line_t   *li;
   const side_t   *si;
-  short          *put;
-
-  // killough 3/22/98: fix bug caused by hoisting save_p too early
-  // killough 10/98: adjust size for changes below
-  size_t size =
-    (sizeof(short)*5 + sizeof sec->floorheight + sizeof sec->ceilingheight)
-    * numsectors + sizeof(short)*3*numlines + 4;
-
-  for (i=0; i<numlines; i++)
-    {
-      if (lines[i].sidenum[0] != NO_INDEX)
-        size +=
-    sizeof(short)*3 + sizeof si->textureoffset + sizeof si->rowoffset;
-      if (lines[i].sidenum[1] != NO_INDEX)
-  size +=
-    sizeof(short)*3 + sizeof si->textureoffset + sizeof si->rowoffset;
-    }
-
-  CheckSaveGame(size); // killough
 
-  PADSAVEP();                // killough 3/22/98
-
-  put = (short *)save_p;
+  P_PadSave();                // killough 3/22/98
 
   // do sectors
   for (i=0, sec = sectors ; i<numsectors ; i++,sec++)
     {
       // killough 10/98: save full floor & ceiling heights, including fraction
-      memcpy(put, &sec->floorheight, sizeof sec->floorheight);
-      put = (void *)((char *) put + sizeof sec->floorheight);
-      memcpy(put, &sec->ceilingheight, sizeof sec->ceilingheight);
-      put = (void *)((char *) put + sizeof sec->ceilingheight);
-
-      *put++ = sec->floorpic;
-      *put++ = sec->ceilingpic;
-      *put++ = sec->lightlevel;
-      *put++ = sec->special;            // needed?   yes -- transfer types
-      *put++ = sec->tag;                // needed?   need them -- killough
+      P_WriteSave(&sec->floorheight, sizeof sec->floorheight);
+      P_WriteSave(&sec->ceilingheight, sizeof sec->ceilingheight);
+
+      P_WriteSaveShort(sec->floorpic);
+      P_WriteSaveShort(sec->ceilingpic);
+      P_WriteSaveShort(sec->lightlevel);
+      P_WriteSaveShort(sec->special);   // needed?   yes -- transfer types
+      P_WriteSaveShort(sec->tag);       // needed?   need them -- killough
     }
 
   // do lines
@@ -156,9 +140,9 @@ void P_ArchiveWorld (void)
     {
       int j;
 
-      *put++ = li->flags;
-      *put++ = li->special;
-      *put++ = li->tag;
+      P_WriteSaveShort(li->flags);
+      P_WriteSaveShort(li->special);
+      P_WriteSaveShort(li->tag);
 
       for (j=0; j<2; j++)
         if (li->sidenum[j] != NO_INDEX)
@@ -168,17 +152,14 @@ void P_ArchiveWorld (void)
       // killough 10/98: save full sidedef offsets,
       // preserving fractional scroll offsets
 
-      memcpy(put, &si->textureoffset, sizeof si->textureoffset);
-      put = (void *)((char *) put + sizeof si->textureoffset);
-      memcpy(put, &si->rowoffset, sizeof si->rowoffset);
-      put = (void *)((char *) put + sizeof si->rowoffset);
+      P_WriteSave(&si->textureoffset, sizeof si->textureoffset);
+      P_WriteSave(&si->rowoffset, sizeof si->rowoffset);
 
-            *put++ = si->toptexture;
-            *put++ = si->bottomtexture;
-            *put++ = si->midtexture;
+            P_WriteSaveShort(si->toptexture);
+            P_WriteSaveShort(si->bottomtexture);
+            P_WriteSaveShort(si->midtexture);
           }
     }
-  save_p = (byte *) put;
 }
 
 
@@ -191,27 +172,22 @@ void P_UnArchiveWorld (void)
   int          i;
   sector_t     *sec;
   line_t       *li;
-  const short  *get;
-
-  PADSAVEP();                // killough 3/22/98
 
-  get = (short *) save_p;
+  P_PadLoad();                // killough 3/22/98
 
   // do sectors
   for (i=0, sec = sectors ; i<numsectors ; i++,sec++)
     {
       // killough 10/98: load full floor & ceiling heights, including fractions
 
-      memcpy(&sec->floorheight, get, sizeof sec->floorheight);
-      get = (void *)((char *) get + sizeof sec->floorheight);
-      memcpy(&sec->ceilingheight, get, sizeof sec->ceilingheight);
-      get = (void *)((char *) get + sizeof sec->ceilingheight);
+      P_ReadSave(&sec->floorheight, sizeof sec->floorheight);
+      P_ReadSave(&sec->ceilingheight, sizeof sec->ceilingheight);
 
-      sec->floorpic = *get++;
-      sec->ceilingpic = *get++;
-      sec->lightlevel = *get++;
-      sec->special = *get++;
-      sec->tag = *get++;
+      sec->floorpic = P_ReadSaveShort();
+      sec->ceilingpic = P_ReadSaveShort();
+      sec->lightlevel = P_ReadSaveShort();
+      sec->special = P_ReadSaveShort();
+      sec->tag = P_ReadSaveShort();
       sec->ceilingdata = 0; //jff 2/22/98 now three thinker fields, not two
       sec->floordata = 0;
       sec->lightingdata = 0;
@@ -223,9 +199,9 @@ void P_UnArchiveWorld (void)
     {
       int j;
 
-      li->flags = *get++;
-      li->special = *get++;
-      li->tag = *get++;
+      li->flags = P_ReadSaveShort();
+      li->special = P_ReadSaveShort();
+      li->tag = P_ReadSaveShort();
       for (j=0 ; j<2 ; j++)
         if (li->sidenum[j] != NO_INDEX)
           {
@@ -233,17 +209,14 @@ void P_UnArchiveWorld (void)
 
       // killough 10/98: load full sidedef offsets, including fractions
 
-      memcpy(&si->textureoffset, get, sizeof si->textureoffset);
-      get = (void *)((char *) get + sizeof si->textureoffset);
-      memcpy(&si->rowoffset, get, sizeof si->rowoffset);
-      get = (void *)((char *) get + sizeof si->rowoffset);
+      P_ReadSave(&si->textureoffset, sizeof si->textureoffset);
+      P_ReadSave(&si->rowoffset, sizeof si->rowoffset);
 
-            si->toptexture = *get++;
-            si->bottomtexture = *get++;
-            si->midtexture = *get++;
+            si->toptexture = P_ReadSaveShort();
+            si->bottomtexture = P_ReadSaveShort();
+            si->midtexture = P_ReadSaveShort();
           }
     }
-  save_p = (byte *) get;
 }
 
 //
@@ -296,29 +269,17 @@ void P_ArchiveThinkers (void)
 {
   thinker_t *th;
 
-  CheckSaveGame(sizeof brain);      // killough 3/26/98: Save boss brain state
-  memcpy(save_p, &brain, sizeof brain);
-  save_p += sizeof brain;
-
-  /* check that enough room is available in savegame buffer
-   * - killough 2/14/98
-   * cph - use number_of_thinkers saved by P_ThinkerToIndex above
-   * size per object is sizeof(mobj_t) - 2*sizeof(void*) - 4*sizeof(fixed_t) plus
-   * padded type (4) plus 5*sizeof(void*), i.e. sizeof(mobj_t) + 4 +
-   * 3*sizeof(void*)
-   * cph - +1 for the tc_end
-   */
-  CheckSaveGame(number_of_thinkers*(sizeof(mobj_t)-3*sizeof(fixed_t)+4+3*sizeof(void*)) +1);
+  P_WriteSave(&brain, sizeof brain); // killough 3/26/98: Save boss brain state
 
   // save off the current thinkers
   for (th = thinkercap.next ; th != &thinkercap ; th=th->next)
     if (th->function == P_MobjThinker)
       {
-        mobj_t *mobj;
+        mobj_t mobj;
+        void *tail[5] = { NULL };
 
-        *save_p++ = tc_mobj;
-        PADSAVEP();
-        mobj = (mobj_t *)save_p;
+        P_WriteSaveByte(tc_mobj);
+        P_PadSave();
 	/* cph 2006/07/30 - 
 	 * The end of mobj_t changed from
 	 *  boolean invisible;
@@ -336,10 +297,8 @@ void P_ArchiveThinkers (void)
 	 * last 2 words of mobj_t, write 5 words of 0 and then write lastenemy
 	 * into the second of these.
 	 */
-        memcpy (mobj, th, sizeof(*mobj) - 2*sizeof(void*));
-        save_p += sizeof(*mobj) - 2*sizeof(void*) - 4*sizeof(fixed_t);
-        memset (save_p, 0, 5*sizeof(void*));
-        mobj->state = (state_t *)(mobj->state - states);
+        memcpy (&mobj, th, sizeof(mobj) - 2*sizeof(void*));
+        mobj.state = (state_t *)(mobj.state - states);
 
         // killough 2/14/98: convert pointers into indices.
         // Fixes many savegame problems, by properly saving
@@ -347,39 +306,38 @@ void P_ArchiveThinkers (void)
         // the thinker pointed to by these fields is not a
         // mobj thinker.
 
-        if (mobj->target)
-          mobj->target = mobj->target->thinker.function ==
+        if (mobj.target)
+          mobj.target = mobj.target->thinker.function ==
             P_MobjThinker ?
-            (mobj_t *) mobj->target->thinker.prev : NULL;
+            (mobj_t *) mobj.target->thinker.prev : NULL;
 
-        if (mobj->tracer)
-          mobj->tracer = mobj->tracer->thinker.function ==
+        if (mobj.tracer)
+          mobj.tracer = mobj.tracer->thinker.function ==
             P_MobjThinker ?
-            (mobj_t *) mobj->tracer->thinker.prev : NULL;
+            (mobj_t *) mobj.tracer->thinker.prev : NULL;
 
         // killough 2/14/98: new field: save last known enemy. Prevents
         // monsters from going to sleep after killing monsters and not
         // seeing player anymore.
 
-        if (((mobj_t*)th)->lastenemy && ((mobj_t*)th)->lastenemy->thinker.function == P_MobjThinker) {
-          memcpy (save_p + sizeof(void*), &(((mobj_t*)th)->lastenemy->thinker.prev), sizeof(void*));
-	}
+        if (((mobj_t*)th)->lastenemy && ((mobj_t*)th)->lastenemy->thinker.function == P_MobjThinker)
+          tail[1] = ((mobj_t*)th)->lastenemy->thinker.prev;
 
         // killough 2/14/98: end changes
 
-        save_p += 5*sizeof(void*);
+        if (mobj.player)
+          mobj.player = (player_t *)((mobj.player-players) + 1);
 
-        if (mobj->player)
-          mobj->player = (player_t *)((mobj->player-players) + 1);
+        P_WriteSave(&mobj, sizeof(mobj) - 2*sizeof(void*) - 4*sizeof(fixed_t));
+        P_WriteSave(tail, sizeof tail);
       }
 
   // add a terminating marker
-  *save_p++ = tc_end;
+  P_WriteSaveByte(tc_end);
 
   // killough 9/14/98: save soundtargets
   {
     int i;
-    CheckSaveGame(numsectors * sizeof(mobj_t *));       // killough 9/14/98
     for (i = 0; i < numsectors; i++)
     {
       mobj_t *target = sectors[i].soundtarget;
@@ -389,8 +347,7 @@ void P_ArchiveThinkers (void)
         target = (mobj_t *) target->thinker.prev;
       else
         target = NULL;
-      memcpy(save_p, &target, sizeof target);
-      save_p += sizeof target;
+      P_WriteSave(&target, sizeof target);
     }
   }
 }
@@ -429,11 +386,12 @@ void P_UnArchiveThinkers (void)
   thinker_t *th;
   mobj_t    **mobj_p;    // killough 2/14/98: Translation table
   size_t    size;        // killough 2/14/98: size of or index into table
+  size_t    maxsize;
+  byte      tclass;
 
   totallive = 0;
   // killough 3/26/98: Load boss brain state
-  memcpy(&brain, save_p, sizeof brain);
-  save_p += sizeof brain;
+  P_ReadSave(&brain, sizeof brain);
 
   // remove all the current thinkers
   for (th = thinkercap.next; th != &thinkercap; )
@@ -447,33 +405,23 @@ void P_UnArchiveThinkers (void)
     }
   P_InitThinkers ();
 
-  // killough 2/14/98: count number of thinkers by skipping through them
-  {
-    byte *sp = save_p;     // save pointer and skip header
-    for (size = 1; *save_p++ == tc_mobj; size++)  // killough 2/14/98
-      {                     // skip all entries, adding up count
-        PADSAVEP();
-	/* cph 2006/07/30 - see comment below for change in layout of mobj_t */
-        save_p += sizeof(mobj_t)+3*sizeof(void*)-4*sizeof(fixed_t);
-      }
-
-    if (*--save_p != tc_end)
-      I_Error ("P_UnArchiveThinkers: Unknown tclass %i in savegame", *save_p);
-
-    // first table entry special: 0 maps to NULL
-    *(mobj_p = malloc(size * sizeof *mobj_p)) = 0;   // table of pointers
-    save_p = sp;           // restore save pointer
-  }
+  // The stream can't be rewound to count the thinkers first, so the
+  // translation table grows as they are read.
+  // first table entry special: 0 maps to NULL
+  maxsize = 256;
+  *(mobj_p = malloc(maxsize * sizeof *mobj_p)) = 0;   // table of pointers
 
   // read in saved thinkers
-  for (size = 1; *save_p++ == tc_mobj; size++)    // killough 2/14/98
+  for (size = 1; (tclass = P_ReadSaveByte()) == tc_mobj; size++)    // killough 2/14/98
     {
       mobj_t *mobj = Z_Malloc(sizeof(mobj_t), PU_LEVEL, NULL);
 
       // killough 2/14/98 -- insert pointers to thinkers into table, in order:
+      if (size == maxsize)
+        mobj_p = realloc(mobj_p, (maxsize *= 2) * sizeof *mobj_p);
       mobj_p[size] = mobj;
 
-      PADSAVEP();
+      P_PadLoad();
       /* cph 2006/07/30 - 
        * The end of mobj_t changed from
        *  boolean invisible;
@@ -492,10 +440,10 @@ void P_UnArchiveThinkers (void)
        * fields of our current mobj_t. We then pull lastenemy from the 2nd of
        * the 5 leftover words, and skip the others.
        */
-      memcpy (mobj, save_p, sizeof(mobj_t)-2*sizeof(void*)-4*sizeof(fixed_t));
-      save_p += sizeof(mobj_t)-sizeof(void*)-4*sizeof(fixed_t);
-      memcpy (&(mobj->lastenemy), save_p, sizeof(void*));
-      save_p += 4*sizeof(void*);
+      P_ReadSave (mobj, sizeof(mobj_t)-2*sizeof(void*)-4*sizeof(fixed_t));
+      P_SkipSave (sizeof(void*));
+      P_ReadSave (&(mobj->lastenemy), sizeof(void*));
+      P_SkipSave (3*sizeof(void*));
       mobj->state = states + (int) mobj->state;
 
       if (mobj->player)
@@ -516,6 +464,9 @@ void P_UnArchiveThinkers (void)
         totallive++;
     }
 
+  if (tclass != tc_end)
+    I_Error ("P_UnArchiveThinkers: Unknown tclass %i in savegame", tclass);
+
   // killough 2/14/98: adjust target and tracer fields, plus
   // lastenemy field, to correctly point to mobj thinkers.
   // NULL entries automatically handled by first table entry.
@@ -539,8 +490,7 @@ void P_UnArchiveThinkers (void)
     for (i = 0; i < numsectors; i++)
     {
       mobj_t *target;
-      memcpy(&target, save_p, sizeof target);
-      save_p += sizeof target;
+      P_ReadSave(&target, sizeof target);
       // Must verify soundtarget. See P_ArchiveThinkers.
       P_SetNewTarget(&sectors[i].soundtarget, mobj_p[P_GetMobj(target,size)]);
     }
@@ -590,45 +540,6 @@ enum {
 void P_ArchiveSpecials (void)
 {
   thinker_t *th;
-  size_t    size = 0;          // killough
-
-  // save off the current thinkers (memory size calculation -- killough)
-
-  for (th = thinkercap.next ; th != &thinkercap ; th=th->next)
-    if (!th->function)
-      {
-        platlist_t *pl;
-        ceilinglist_t *cl;     //jff 2/22/98 need this for ceilings too now
-        for (pl=activeplats; pl; pl=pl->next)
-          if (pl->plat == (plat_t *) th)   // killough 2/14/98
-            {
-              size += 4+sizeof(plat_t);
-              goto end;
-            }
-        for (cl=activeceilings; cl; cl=cl->next) // search for activeceiling
-          if (cl->ceiling == (ceiling_t *) th)   //jff 2/22/98
-            {
-              size += 4+sizeof(ceiling_t);
-              goto end;
-            }
-      end:;
-      }
-    else
-      size +=
-        th->function==T_MoveCeiling  ? 4+sizeof(ceiling_t) :
-        th->function==T_VerticalDoor ? 4+sizeof(vldoor_t)  :
-        th->function==T_MoveFloor    ? 4+sizeof(floormove_t):
-        th->function==T_PlatRaise    ? 4+sizeof(plat_t)    :
-        th->function==T_LightFlash   ? 4+sizeof(lightflash_t):
-        th->function==T_StrobeFlash  ? 4+sizeof(strobe_t)  :
-        th->function==T_Glow         ? 4+sizeof(glow_t)    :
-        th->function==T_MoveElevator ? 4+sizeof(elevator_t):
-        th->function==T_Scroll       ? 4+sizeof(scroll_t)  :
-        th->function==T_Pusher       ? 4+sizeof(pusher_t)  :
-        th->function==T_FireFlicker? 4+sizeof(fireflicker_t) :
-      0;
-
-  CheckSaveGame(size + 1);    // killough; cph: +1 for the tc_endspecials
 
   // save off the current thinkers
   for (th=thinkercap.next; th!=&thinkercap; th=th->next)
@@ -656,124 +567,114 @@ void P_ArchiveSpecials (void)
 
       if (th->function == T_MoveCeiling)
         {
-          ceiling_t *ceiling;
+          ceiling_t ceiling;
         ceiling:                               // killough 2/14/98
-          *save_p++ = tc_ceiling;
-          PADSAVEP();
-          ceiling = (ceiling_t *)save_p;
-          memcpy (ceiling, th, sizeof(*ceiling));
-          save_p += sizeof(*ceiling);
-          ceiling->sector = (sector_t *)(ceiling->sector - sectors);
+          P_WriteSaveByte(tc_ceiling);
+          P_PadSave();
+          memcpy (&ceiling, th, sizeof ceiling);
+          ceiling.sector = (sector_t *)(ceiling.sector - sectors);
+          P_WriteSave(&ceiling, sizeof ceiling);
           continue;
         }
 
       if (th->function == T_VerticalDoor)
         {
-          vldoor_t *door;
-          *save_p++ = tc_door;
-          PADSAVEP();
-          door = (vldoor_t *) save_p;
-          memcpy (door, th, sizeof *door);
-          save_p += sizeof(*door);
-          door->sector = (sector_t *)(door->sector - sectors);
+          vldoor_t door;
+          P_WriteSaveByte(tc_door);
+          P_PadSave();
+          memcpy (&door, th, sizeof door);
+          door.sector = (sector_t *)(door.sector - sectors);
           //jff 1/31/98 archive line remembered by door as well
-          door->line = (line_t *) (door->line ? door->line-lines : -1);
+          door.line = (line_t *) (door.line ? door.line-lines : -1);
+          P_WriteSave(&door, sizeof door);
           continue;
         }
 
       if (th->function == T_MoveFloor)
         {
-          floormove_t *floor;
-          *save_p++ = tc_floor;
-          PADSAVEP();
-          floor = (floormove_t *)save_p;
-          memcpy (floor, th, sizeof(*floor));
-          save_p += sizeof(*floor);
-          floor->sector = (sector_t *)(floor->sector - sectors);
+          floormove_t floor;
+          P_WriteSaveByte(tc_floor);
+          P_PadSave();
+          memcpy (&floor, th, sizeof floor);
+          floor.sector = (sector_t *)(floor.sector - sectors);
+          P_WriteSave(&floor, sizeof floor);
           continue;
         }
 
       if (th->function == T_PlatRaise)
         {
-          plat_t *plat;
+          plat_t plat;
         plat:   // killough 2/14/98: added fix for original plat height above
-          *save_p++ = tc_plat;
-          PADSAVEP();
-          plat = (plat_t *)save_p;
-          memcpy (plat, th, sizeof(*plat));
-          save_p += sizeof(*plat);
-          plat->sector = (sector_t *)(plat->sector - sectors);
+          P_WriteSaveByte(tc_plat);
+          P_PadSave();
+          memcpy (&plat, th, sizeof plat);
+          plat.sector = (sector_t *)(plat.sector - sectors);
+          P_WriteSave(&plat, sizeof plat);
           continue;
         }
 
       if (th->function == T_LightFlash)
         {
-          lightflash_t *flash;
-          *save_p++ = tc_flash;
-          PADSAVEP();
-          flash = (lightflash_t *)save_p;
-          memcpy (flash, th, sizeof(*flash));
-          save_p += sizeof(*flash);
-          flash->sector = (sector_t *)(flash->sector - sectors);
+          lightflash_t flash;
+          P_WriteSaveByte(tc_flash);
+          P_PadSave();
+          memcpy (&flash, th, sizeof flash);
+          flash.sector = (sector_t *)(flash.sector - sectors);
+          P_WriteSave(&flash, sizeof flash);
           continue;
         }
 
       if (th->function == T_StrobeFlash)
         {
-          strobe_t *strobe;
-          *save_p++ = tc_strobe;
-          PADSAVEP();
-          strobe = (strobe_t *)save_p;
-          memcpy (strobe, th, sizeof(*strobe));
-          save_p += sizeof(*strobe);
-          strobe->sector = (sector_t *)(strobe->sector - sectors);
+          strobe_t strobe;
+          P_WriteSaveByte(tc_strobe);
+          P_PadSave();
+          memcpy (&strobe, th, sizeof strobe);
+          strobe.sector = (sector_t *)(strobe.sector - sectors);
+          P_WriteSave(&strobe, sizeof strobe);
           continue;
         }
 
       if (th->function == T_Glow)
         {
-          glow_t *glow;
-          *save_p++ = tc_glow;
-          PADSAVEP();
-          glow = (glow_t *)save_p;
-          memcpy (glow, th, sizeof(*glow));
-          save_p += sizeof(*glow);
-          glow->sector = (sector_t *)(glow->sector - sectors);
+          glow_t glow;
+          P_WriteSaveByte(tc_glow);
+          P_PadSave();
+          memcpy (&glow, th, sizeof glow);
+          glow.sector = (sector_t *)(glow.sector - sectors);
+          P_WriteSave(&glow, sizeof glow);
           continue;
         }
 
       // killough 10/4/98: save flickers
       if (th->function == T_FireFlicker)
         {
-          fireflicker_t *flicker;
-          *save_p++ = tc_flicker;
-          PADSAVEP();
-          flicker = (fireflicker_t *)save_p;
-          memcpy (flicker, th, sizeof(*flicker));
-          save_p += sizeof(*flicker);
-          flicker->sector = (sector_t *)(flicker->sector - sectors);
+          fireflicker_t flicker;
+          P_WriteSaveByte(tc_flicker);
+          P_PadSave();
+          memcpy (&flicker, th, sizeof flicker);
+          flicker.sector = (sector_t *)(flicker.sector - sectors);
+          P_WriteSave(&flicker, sizeof flicker);
           continue;
         }
 
       //jff 2/22/98 new case for elevators
       if (th->function == T_MoveElevator)
         {
-          elevator_t *elevator;         //jff 2/22/98
-          *save_p++ = tc_elevator;
-          PADSAVEP();
-          elevator = (elevator_t *)save_p;
-          memcpy (elevator, th, sizeof(*elevator));
-          save_p += sizeof(*elevator);
-          elevator->sector = (sector_t *)(elevator->sector - sectors);
+          elevator_t elevator;         //jff 2/22/98
+          P_WriteSaveByte(tc_elevator);
+          P_PadSave();
+          memcpy (&elevator, th, sizeof elevator);
+          elevator.sector = (sector_t *)(elevator.sector - sectors);
+          P_WriteSave(&elevator, sizeof elevator);
           continue;
         }
 
       // killough 3/7/98: Scroll effect thinkers
       if (th->function == T_Scroll)
         {
-          *save_p++ = tc_scroll;
-          memcpy (save_p, th, sizeof(scroll_t));
-          save_p += sizeof(scroll_t);
+          P_WriteSaveByte(tc_scroll);
+          P_WriteSave(th, sizeof(scroll_t));
           continue;
         }
 
@@ -781,15 +682,14 @@ void P_ArchiveSpecials (void)
 
       if (th->function == T_Pusher)
         {
-          *save_p++ = tc_pusher;
-          memcpy (save_p, th, sizeof(pusher_t));
-          save_p += sizeof(pusher_t);
+          P_WriteSaveByte(tc_pusher);
+          P_WriteSave(th, sizeof(pusher_t));
           continue;
         }
     }
 
   // add a terminating marker
-  *save_p++ = tc_endspecials;
+  P_WriteSaveByte(tc_endspecials);
 }
 
 
@@ -801,15 +701,14 @@ void P_UnArchiveSpecials (void)
   byte tclass;
 
   // read in saved thinkers
-  while ((tclass = *save_p++) != tc_endspecials)  // killough 2/14/98
+  while ((tclass = P_ReadSaveByte()) != tc_endspecials)  // killough 2/14/98
     switch (tclass)
       {
       case tc_ceiling:
-        PADSAVEP();
+        P_PadLoad();
         {
           ceiling_t *ceiling = Z_Malloc (sizeof(*ceiling), PU_LEVEL, NULL);
-          memcpy (ceiling, save_p, sizeof(*ceiling));
-          save_p += sizeof(*ceiling);
+          P_ReadSave (ceiling, sizeof(*ceiling));
           ceiling->sector = &sectors[(int)ceiling->sector];
           ceiling->sector->ceilingdata = ceiling; //jff 2/22/98
 
@@ -822,11 +721,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_door:
-        PADSAVEP();
+        P_PadLoad();
         {
           vldoor_t *door = Z_Malloc (sizeof(*door), PU_LEVEL, NULL);
-          memcpy (door, save_p, sizeof(*door));
-          save_p += sizeof(*door);
+          P_ReadSave (door, sizeof(*door));
           door->sector = &sectors[(int)door->sector];
 
           //jff 1/31/98 unarchive line remembered by door as well
@@ -839,11 +737,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_floor:
-        PADSAVEP();
+        P_PadLoad();
         {
           floormove_t *floor = Z_Malloc (sizeof(*floor), PU_LEVEL, NULL);
-          memcpy (floor, save_p, sizeof(*floor));
-          save_p += sizeof(*floor);
+          P_ReadSave (floor, sizeof(*floor));
           floor->sector = &sectors[(int)floor->sector];
           floor->sector->floordata = floor; //jff 2/22/98
           floor->thinker.function = T_MoveFloor;
@@ -852,11 +749,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_plat:
-        PADSAVEP();
+        P_PadLoad();
         {
           plat_t *plat = Z_Malloc (sizeof(*plat), PU_LEVEL, NULL);
-          memcpy (plat, save_p, sizeof(*plat));
-          save_p += sizeof(*plat);
+          P_ReadSave (plat, sizeof(*plat));
           plat->sector = &sectors[(int)plat->sector];
           plat->sector->floordata = plat; //jff 2/22/98
 
@@ -869,11 +765,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_flash:
-        PADSAVEP();
+        P_PadLoad();
         {
           lightflash_t *flash = Z_Malloc (sizeof(*flash), PU_LEVEL, NULL);
-          memcpy (flash, save_p, sizeof(*flash));
-          save_p += sizeof(*flash);
+          P_ReadSave (flash, sizeof(*flash));
           flash->sector = &sectors[(int)flash->sector];
           flash->thinker.function = T_LightFlash;
           P_AddThinker (&flash->thinker);
@@ -881,11 +776,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_strobe:
-        PADSAVEP();
+        P_PadLoad();
         {
           strobe_t *strobe = Z_Malloc (sizeof(*strobe), PU_LEVEL, NULL);
-          memcpy (strobe, save_p, sizeof(*strobe));
-          save_p += sizeof(*strobe);
+          P_ReadSave (strobe, sizeof(*strobe));
           strobe->sector = &sectors[(int)strobe->sector];
           strobe->thinker.function = T_StrobeFlash;
           P_AddThinker (&strobe->thinker);
@@ -893,11 +787,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_glow:
-        PADSAVEP();
+        P_PadLoad();
         {
           glow_t *glow = Z_Malloc (sizeof(*glow), PU_LEVEL, NULL);
-          memcpy (glow, save_p, sizeof(*glow));
-          save_p += sizeof(*glow);
+          P_ReadSave (glow, sizeof(*glow));
           glow->sector = &sectors[(int)glow->sector];
           glow->thinker.function = T_Glow;
           P_AddThinker (&glow->thinker);
@@ -905,11 +798,10 @@ void P_UnArchiveSpecials (void)
         }
 
       case tc_flicker:           // killough 10/4/98
-        PADSAVEP();
+        P_PadLoad();
         {
           fireflicker_t *flicker = Z_Malloc (sizeof(*flicker), PU_LEVEL, NULL);
-          memcpy (flicker, save_p, sizeof(*flicker));
-          save_p += sizeof(*flicker);
+          P_ReadSave (flicker, sizeof(*flicker));
           flicker->sector = &sectors[(int)flicker->sector];
           flicker->thinker.function = T_FireFlicker;
           P_AddThinker (&flicker->thinker);
@@ -918,11 +810,10 @@ void P_UnArchiveSpecials (void)
 
         //jff 2/22/98 new case for elevators
       case tc_elevator:
-        PADSAVEP();
+        P_PadLoad();
         {
           elevator_t *elevator = Z_Malloc (sizeof(*elevator), PU_LEVEL, NULL);
-          memcpy (elevator, save_p, sizeof(*elevator));
-          save_p += sizeof(*elevator);
+          P_ReadSave (elevator, sizeof(*elevator));
           elevator->sector = &sectors[(int)elevator->sector];
           elevator->sector->floordata = elevator; //jff 2/22/98
           elevator->sector->ceilingdata = elevator; //jff 2/22/98
@@ -934,8 +825,7 @@ void P_UnArchiveSpecials (void)
       case tc_scroll:       // killough 3/7/98: scroll effect thinkers
         {
           scroll_t *scroll = Z_Malloc (sizeof(scroll_t), PU_LEVEL, NULL);
-          memcpy (scroll, save_p, sizeof(scroll_t));
-          save_p += sizeof(scroll_t);
+          P_ReadSave (scroll, sizeof(scroll_t));
           scroll->thinker.function = T_Scroll;
           P_AddThinker(&scroll->thinker);
           break;
@@ -944,8 +834,7 @@ void P_UnArchiveSpecials (void)
       case tc_pusher:   // phares 3/22/98: new Push/Pull effect thinkers
         {
           pusher_t *pusher = Z_Malloc (sizeof(pusher_t), PU_LEVEL, NULL);
-          memcpy (pusher, save_p, sizeof(pusher_t));
-          save_p += sizeof(pusher_t);
+          P_ReadSave (pusher, sizeof(pusher_t));
           pusher->thinker.function = T_Pusher;
           pusher->source = P_GetPushThing(pusher->affectee);
           P_AddThinker(&pusher->thinker);
@@ -961,15 +850,12 @@ void P_UnArchiveSpecials (void)
 
 void P_ArchiveRNG(void)
 {
-  CheckSaveGame(sizeof rng);
-  memcpy(save_p, &rng, sizeof rng);
-  save_p += sizeof rng;
+  P_WriteSave(&rng, sizeof rng);
 }
 
 void P_UnArchiveRNG(void)
 {
-  memcpy(&rng, save_p, sizeof rng);
-  save_p += sizeof rng;
+  P_ReadSave(&rng, sizeof rng);
 }
 
 // killough 2/22/98: Save/restore automap state
@@ -977,53 +863,34 @@ void P_UnArchiveRNG(void)
 void P_ArchiveMap(void)
 {
   int zero = 0, one = 1;
-  CheckSaveGame(2 * sizeof zero + sizeof markpointnum +
-                markpointnum * sizeof *markpoints +
-                sizeof automapmode + sizeof one);
-
-  memcpy(save_p, &automapmode, sizeof automapmode);
-  save_p += sizeof automapmode;
-  memcpy(save_p, &one, sizeof one);   // CPhipps - used to be viewactive, now
-  save_p += sizeof one;               // that's worked out locally by D_Display
-  memcpy(save_p, &zero, sizeof zero); // CPhipps - used to be followplayer
-  save_p += sizeof zero;              //  that is now part of automapmode
-  memcpy(save_p, &zero, sizeof zero); // CPhipps - used to be automap_grid, ditto
-  save_p += sizeof zero;
-  memcpy(save_p, &markpointnum, sizeof markpointnum);
-  save_p += sizeof markpointnum;
+
+  P_WriteSave(&automapmode, sizeof automapmode);
+  P_WriteSave(&one, sizeof one);   // CPhipps - used to be viewactive, now
+                                   // that's worked out locally by D_Display
+  P_WriteSave(&zero, sizeof zero); // CPhipps - used to be followplayer
+                                   //  that is now part of automapmode
+  P_WriteSave(&zero, sizeof zero); // CPhipps - used to be automap_grid, ditto
+  P_WriteSave(&markpointnum, sizeof markpointnum);
 
   if (markpointnum)
-    {
-      memcpy(save_p, markpoints, sizeof *markpoints * markpointnum);
-      save_p += markpointnum * sizeof *markpoints;
-    }
+    P_WriteSave(markpoints, sizeof *markpoints * markpointnum);
 }
 
 void P_UnArchiveMap(void)
 {
-  int unused;
-  memcpy(&automapmode, save_p, sizeof automapmode);
-  save_p += sizeof automapmode;
-  memcpy(&unused, save_p, sizeof unused);
-  save_p += sizeof unused;
-  memcpy(&unused, save_p, sizeof unused);
-  save_p += sizeof unused;
-  memcpy(&unused, save_p, sizeof unused);
-  save_p += sizeof unused;
+  P_ReadSave(&automapmode, sizeof automapmode);
+  P_SkipSave(3 * sizeof(int));
 
   if (automapmode & am_active)
     AM_Start();
 
-  memcpy(&markpointnum, save_p, sizeof markpointnum);
-  save_p += sizeof markpointnum;
+  P_ReadSave(&markpointnum, sizeof markpointnum);
 
   if (markpointnum)
     {
       while (markpointnum >= markpointnum_max)
         markpoints = realloc(markpoints, sizeof *markpoints *
          (markpointnum_max = markpointnum_max ? markpointnum_max*2 : 16));
-      memcpy(markpoints, save_p, markpointnum * sizeof *markpoints);
-      save_p += markpointnum * sizeof *markpoints;
+      P_ReadSave(markpoints, markpointnum * sizeof *markpoints);
     }
 }
-
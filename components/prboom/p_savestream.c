@@ -0,0 +1,708 @@
+/* Emacs style mode select   -*- C++ -*-
+ *-----------------------------------------------------------------------------
+ *
+ *
+ *  PrBoom: a Doom port merged with LxDoom and LSDLDoom
+ *  based on BOOM, a modified and improved DOOM engine
+ *  Copyright (C) 1999 by
+ *  id Software, Chi Hoang, Lee Killough, Jim Flynn, Rand Phares, Ty Halderman
+ *  Copyright (C) 1999-2000 by
+ *  Jess Haas, Nicolas Kalkhof, Colin Phipps, Florian Schulze
+ *  Copyright 2005, 2006 by
+ *  Florian Schulze, Colin Phipps, Neil Stevens, Andrey Budko
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ *  02111-1307, USA.
+ *
+ * DESCRIPTION:
+ *      Streaming savegame I/O.
+ *
+ *  The savegame used to be assembled in one realloc-grown buffer and
+ *  written out in one go, which on this port means a large transient
+ *  PSRAM allocation. Instead the P_Archive* functions now push bytes
+ *  through a SAVESTREAM_CHUNK sized staging buffer which is flushed to
+ *  the file whenever it fills.
+ *
+ *  File layout:
+ *    header   "PRSV", format version, flags, 2 reserved bytes
+ *    chunks   u16 rawlen, u16 packedlen, packedlen bytes of data
+ *             (packedlen == rawlen means the chunk is stored as is)
+ *    end      a chunk header with rawlen 0
+ *    trailer  u32 CRC32 and u32 length of the uncompressed stream
+ *  All integers little endian. The uncompressed stream is byte for
+ *  byte the old savegame format, and files without the header are
+ *  read as old-style savegames.
+ *
+ *  Compression is a plain LZSS with a 4K window, which is exactly one
+ *  chunk, so chunks decode independently.
+ *
+ *  The same stream can also live in memory (for in-level snapshots),
+ *  optionally XORed against an earlier stream before compression so
+ *  that unchanged state packs down to almost nothing.
+ *
+ *-----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "doomstat.h"
+#include "z_zone.h"
+#include "lprintf.h"
+#include "p_savestream.h"
+
+int savegame_compress = 1;
+
+#define SAVESTREAM_MAGIC   "PRSV"
+#define SAVESTREAM_VERSION 1
+#define SAVESTREAM_LZ      1 /* flags: chunks may be compressed */
+
+#define LZ_HASHBITS  12
+#define LZ_HASHSIZE  (1 << LZ_HASHBITS)
+#define LZ_MINMATCH  3
+#define LZ_MAXMATCH  (LZ_MINMATCH + 15 + 255)
+#define LZ_MAXOFFSET 4096
+
+static struct {
+  boolean open;
+  FILE    *fp;        /* file backing store, or NULL for memory */
+  char    *name;      /* kept so a failed save can be removed */
+  byte    *mem;       /* memory backing store */
+  size_t  memlen, memmax;
+  const byte *base;   /* delta base, XORed into the logical stream */
+  size_t  baselen;
+  boolean writing;
+  boolean compress;
+  boolean legacy;     /* reading an old unframed savegame */
+  boolean eof;        /* end chunk seen */
+  boolean error;
+  byte    *chunk;     /* uncompressed staging data */
+  byte    *packed;    /* compressed chunk */
+  short   *hash;      /* LZ match finder, writing only */
+  size_t  chunkpos, chunklen;
+  size_t  chunkstart; /* logical offset of the staged chunk */
+  size_t  pos;        /* logical bytes written/consumed */
+  size_t  total;      /* logical bytes decoded, loading only */
+  size_t  stored;     /* bytes in the file */
+  unsigned int crc;
+} stream;
+
+//
+// CRC32 (IEEE 802.3), nibble table to keep it out of the way in DRAM
+//
+
+static const unsigned int crc_nibble[16] = {
+  0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+  0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+  0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+  0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+static unsigned int CRC32_Update(unsigned int crc, const byte *p, size_t len)
+{
+  crc = ~crc;
+  while (len--)
+    {
+      crc ^= *p++;
+      crc = (crc >> 4) ^ crc_nibble[crc & 15];
+      crc = (crc >> 4) ^ crc_nibble[crc & 15];
+    }
+  return ~crc;
+}
+
+//
+// LZSS
+//
+// A flag byte precedes each group of 8 tokens, bit set for a match.
+// Literal: 1 byte. Match: 12 bit (offset-1), 4 bit (length-3), and if
+// the length nibble is 15 an extra byte with the rest of the length.
+//
+
+#define LZ_HASH(p) \
+  ((((p)[0] << 16 | (p)[1] << 8 | (p)[2]) * 2654435761u) >> (32 - LZ_HASHBITS))
+
+// Returns the packed length, or 0 if the result would not fit in dstmax
+static size_t LZ_Compress(const byte *src, size_t len, byte *dst, size_t dstmax)
+{
+  short *head = stream.hash;
+  size_t ip = 0, op = 0;
+  byte *flagp = NULL;
+  int bit = 8;
+
+  memset(head, 0xff, LZ_HASHSIZE * sizeof *head);
+
+  while (ip < len)
+    {
+      size_t mlen = 0, moff = 0;
+
+      if (bit == 8)
+        {
+          if (op >= dstmax)
+            return 0;
+          *(flagp = dst + op++) = 0;
+          bit = 0;
+        }
+
+      if (ip + LZ_MINMATCH <= len)
+        {
+          unsigned int h = LZ_HASH(src + ip);
+          int cand = head[h];
+
+          head[h] = ip;
+          if (cand >= 0 && ip - cand <= LZ_MAXOFFSET)
+            {
+              size_t max = len - ip;
+
+              if (max > LZ_MAXMATCH)
+                max = LZ_MAXMATCH;
+              while (mlen < max && src[cand + mlen] == src[ip + mlen])
+                mlen++;
+              moff = ip - cand;
+            }
+        }
+
+      if (mlen >= LZ_MINMATCH)
+        {
+          size_t k, code = mlen - LZ_MINMATCH;
+
+          if (op + 2 + (code >= 15) > dstmax)
+            return 0;
+          *flagp |= 1 << bit;
+          dst[op++] = (moff - 1) >> 4;
+          dst[op++] = ((moff - 1) & 15) << 4 | (code < 15 ? code : 15);
+          if (code >= 15)
+            dst[op++] = code - 15;
+
+          for (k = 1; k < mlen && ip + k + LZ_MINMATCH <= len; k++)
+            head[LZ_HASH(src + ip + k)] = ip + k;
+          ip += mlen;
+        }
+      else
+        {
+          if (op >= dstmax)
+            return 0;
+          dst[op++] = src[ip++];
+        }
+      bit++;
+    }
+  return op;
+}
+
+static boolean LZ_Decompress(const byte *src, size_t srclen, byte *dst, size_t dstlen)
+{
+  size_t ip = 0, op = 0;
+  int flags = 0, bit = 8;
+
+  while (op < dstlen)
+    {
+      if (bit == 8)
+        {
+          if (ip >= srclen)
+            return false;
+          flags = src[ip++];
+          bit = 0;
+        }
+
+      if (flags & (1 << bit))
+        {
+          size_t moff, mlen;
+
+          if (ip + 2 > srclen)
+            return false;
+          moff = (src[ip] << 4 | src[ip+1] >> 4) + 1;
+          mlen = (src[ip+1] & 15) + LZ_MINMATCH;
+          ip += 2;
+          if (mlen == LZ_MINMATCH + 15)
+            {
+              if (ip >= srclen)
+                return false;
+              mlen += src[ip++];
+            }
+          if (moff > op || op + mlen > dstlen)
+            return false;
+          for (; mlen; mlen--, op++)
+            dst[op] = dst[op - moff];
+        }
+      else
+        {
+          if (ip >= srclen)
+            return false;
+          dst[op++] = src[ip++];
+        }
+      bit++;
+    }
+  return ip == srclen;
+}
+
+//
+// Backing store
+//
+
+static void SS_Put(const void *src, size_t len)
+{
+  if (stream.error)
+    return;
+  if (stream.fp)
+    {
+      if (fwrite(src, 1, len, stream.fp) != len)
+        stream.error = true;
+    }
+  else
+    {
+      if (stream.memlen + len > stream.memmax)
+        {
+          size_t max = stream.memmax;
+          byte *mem;
+
+          while (stream.memlen + len > max)
+            max = max ? max*2 : SAVESTREAM_CHUNK;
+          if (!(mem = realloc(stream.mem, max)))
+            {
+              stream.error = true;   // the old block is still ours to free
+              return;
+            }
+          stream.mem = mem;
+          stream.memmax = max;
+        }
+      memcpy(stream.mem + stream.memlen, src, len);
+      stream.memlen += len;
+    }
+  stream.stored += len;
+}
+
+static boolean SS_Get(void *dst, size_t len)
+{
+  if (stream.fp)
+    {
+      if (fread(dst, 1, len, stream.fp) != len)
+        return false;
+    }
+  else
+    {
+      if (stream.stored + len > stream.memlen)
+        return false;
+      memcpy(dst, stream.mem + stream.stored, len);
+    }
+  stream.stored += len;
+  return true;
+}
+
+// XOR the staged chunk with the matching part of the delta base
+static void SS_ApplyBase(size_t len)
+{
+  size_t i, n = 0;
+
+  if (stream.chunkstart < stream.baselen)
+    n = stream.baselen - stream.chunkstart;
+  if (n > len)
+    n = len;
+  for (i = 0; i < n; i++)
+    stream.chunk[i] ^= stream.base[stream.chunkstart + i];
+}
+
+static void SS_PutLong(byte *p, unsigned int v)
+{
+  p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static unsigned int SS_GetLong(const byte *p)
+{
+  return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int)p[3] << 24;
+}
+
+static void SS_FlushChunk(void)
+{
+  byte hdr[4];
+  size_t len = stream.chunkpos, plen = 0;
+
+  if (!len)
+    return;
+
+  stream.crc = CRC32_Update(stream.crc, stream.chunk, len);
+  SS_ApplyBase(len);
+
+  if (stream.compress)
+    plen = LZ_Compress(stream.chunk, len, stream.packed, len - 1);
+
+  hdr[0] = len; hdr[1] = len >> 8;
+  if (plen)
+    {
+      hdr[2] = plen; hdr[3] = plen >> 8;
+      SS_Put(hdr, 4);
+      SS_Put(stream.packed, plen);
+    }
+  else
+    {
+      hdr[2] = hdr[0]; hdr[3] = hdr[1];
+      SS_Put(hdr, 4);
+      SS_Put(stream.chunk, len);
+    }
+  stream.chunkstart += len;
+  stream.chunkpos = 0;
+}
+
+// Load the next chunk into the staging buffer. Returns false at the
+// end of the stream.
+static boolean SS_FillChunk(void)
+{
+  byte hdr[4];
+  size_t len, plen;
+
+  stream.chunkstart += stream.chunklen;
+  stream.chunkpos = stream.chunklen = 0;
+  if (stream.eof)
+    return false;
+
+  if (stream.legacy)
+    {
+      len = fread(stream.chunk, 1, SAVESTREAM_CHUNK, stream.fp);
+      stream.stored += len;
+      stream.total += len;
+      stream.chunklen = len;
+      stream.eof = len < SAVESTREAM_CHUNK;
+      return len > 0;
+    }
+
+  if (!SS_Get(hdr, 4))
+    I_Error("P_ReadSave: Savegame truncated");
+  len = hdr[0] | hdr[1] << 8;
+  plen = hdr[2] | hdr[3] << 8;
+  if (!len && !plen)
+    return !(stream.eof = true);
+  if (len > SAVESTREAM_CHUNK || plen > len)
+    I_Error("P_ReadSave: Corrupt savegame chunk");
+
+  if (plen == len)
+    {
+      if (!SS_Get(stream.chunk, len))
+        I_Error("P_ReadSave: Savegame truncated");
+    }
+  else if (!SS_Get(stream.packed, plen) ||
+           !LZ_Decompress(stream.packed, plen, stream.chunk, len))
+    I_Error("P_ReadSave: Corrupt savegame chunk");
+
+  SS_ApplyBase(len);
+  stream.crc = CRC32_Update(stream.crc, stream.chunk, len);
+  stream.total += len;
+  stream.chunklen = len;
+  return true;
+}
+
+static void SS_Open(const char *name, FILE *fp, boolean writing)
+{
+  if (stream.open)
+    I_Error("SS_Open: Savegame stream already open");
+
+  memset(&stream, 0, sizeof stream);
+  stream.open = true;
+  stream.fp = fp;
+  stream.writing = writing;
+  stream.name = name ? strdup(name) : NULL;
+  stream.chunk = malloc(SAVESTREAM_CHUNK);
+  stream.packed = malloc(SAVESTREAM_CHUNK);
+}
+
+static void SS_Close(void)
+{
+  if (stream.fp)
+    fclose(stream.fp);
+  free(stream.chunk);
+  free(stream.packed);
+  free(stream.hash);
+  free(stream.name);
+  stream.open = false;
+  stream.fp = NULL;
+  stream.chunk = stream.packed = NULL;
+  stream.hash = NULL;
+  stream.name = NULL;
+}
+
+//
+// P_OpenSaveFile
+//
+
+static void SS_StartSave(boolean compress)
+{
+  byte hdr[8];
+
+  stream.compress = compress;
+  if (compress)
+    stream.hash = malloc(LZ_HASHSIZE * sizeof *stream.hash);
+
+  memcpy(hdr, SAVESTREAM_MAGIC, 4);
+  hdr[4] = SAVESTREAM_VERSION;
+  hdr[5] = compress ? SAVESTREAM_LZ : 0;
+  hdr[6] = hdr[7] = 0;
+  SS_Put(hdr, sizeof hdr);
+}
+
+boolean P_OpenSaveFile(const char *name, boolean compress)
+{
+  FILE *fp;
+
+  if (!(fp = fopen(name, "wb")))
+    return false;
+
+  SS_Open(name, fp, true);
+  SS_StartSave(compress);
+  return true;
+}
+
+//
+// P_OpenSaveMem
+//
+
+void P_OpenSaveMem(boolean compress, const byte *base, size_t baselen)
+{
+  SS_Open(NULL, NULL, true);
+  stream.base = base;
+  stream.baselen = base ? baselen : 0;
+  SS_StartSave(compress);
+}
+
+static boolean SS_StartLoad(void)
+{
+  byte hdr[8];
+
+  if (!SS_Get(hdr, sizeof hdr) || memcmp(hdr, SAVESTREAM_MAGIC, 4))
+    return false;
+  if (hdr[4] != SAVESTREAM_VERSION)
+    I_Error("SS_StartLoad: Unknown savegame stream version %d", hdr[4]);
+  stream.compress = (hdr[5] & SAVESTREAM_LZ) != 0;
+  return true;
+}
+
+//
+// P_OpenLoadFile
+//
+
+boolean P_OpenLoadFile(const char *name)
+{
+  FILE *fp;
+
+  if (!(fp = fopen(name, "rb")))
+    return false;
+
+  SS_Open(name, fp, false);
+
+  if (!SS_StartLoad())
+    {
+      // cph - old savegame, read the bytes as they are
+      stream.legacy = true;
+      stream.stored = 0;
+      fseek(fp, 0, SEEK_SET);
+    }
+  return true;
+}
+
+//
+// P_OpenLoadMem
+//
+
+void P_OpenLoadMem(const byte *data, size_t len, const byte *base, size_t baselen)
+{
+  SS_Open(NULL, NULL, false);
+  stream.mem = (byte *)data;
+  stream.memlen = len;
+  stream.base = base;
+  stream.baselen = base ? baselen : 0;
+  if (!SS_StartLoad())
+    I_Error("P_OpenLoadMem: Not a savegame stream");
+}
+
+//
+// P_CloseSave
+//
+
+boolean P_CloseSave(void)
+{
+  byte trailer[12];
+  boolean ok;
+
+  SS_FlushChunk();
+  memset(trailer, 0, 4);
+  SS_PutLong(trailer + 4, stream.crc);
+  SS_PutLong(trailer + 8, stream.pos);
+  SS_Put(trailer, sizeof trailer);
+
+  ok = !stream.error && !fflush(stream.fp);
+  if (!ok && stream.name)
+    {
+      fclose(stream.fp);             // Remove partially written file
+      stream.fp = NULL;
+      remove(stream.name);
+    }
+  SS_Close();
+  return ok;
+}
+
+//
+// P_CloseSaveMem
+//
+// Returns the stream, which the caller must free, or NULL if it ran
+// out of memory on the way
+//
+
+byte *P_CloseSaveMem(size_t *len)
+{
+  byte trailer[12];
+  byte *mem;
+
+  SS_FlushChunk();
+  memset(trailer, 0, 4);
+  SS_PutLong(trailer + 4, stream.crc);
+  SS_PutLong(trailer + 8, stream.pos);
+  SS_Put(trailer, sizeof trailer);
+
+  if (stream.error)
+    {
+      free(stream.mem);
+      mem = NULL;
+      stream.memlen = 0;
+    }
+  else if (!(mem = realloc(stream.mem, stream.memlen)))  // trim the slack
+    mem = stream.mem;
+  *len = stream.memlen;
+  stream.mem = NULL;
+  SS_Close();
+  return mem;
+}
+
+//
+// P_CloseLoad
+//
+
+boolean P_CloseLoad(void)
+{
+  boolean ok = true;
+
+  if (!stream.legacy)
+    {
+      byte trailer[8];
+
+      // Consume whatever the loader didn't need so the CRC covers it all
+      while (SS_FillChunk())
+        ;
+      ok = SS_Get(trailer, sizeof trailer) &&
+        SS_GetLong(trailer) == stream.crc &&
+        SS_GetLong(trailer + 4) == stream.total;
+    }
+  SS_Close();
+  return ok;
+}
+
+size_t P_SaveStreamPos(void)
+{
+  return stream.pos;
+}
+
+size_t P_SaveStreamStored(void)
+{
+  return stream.stored;
+}
+
+unsigned int P_SaveStreamCRC(void)
+{
+  return stream.crc;
+}
+
+//
+// Writing
+//
+
+void P_WriteSave(const void *src, size_t len)
+{
+  const byte *p = src;
+
+  stream.pos += len;
+  while (len)
+    {
+      size_t n = SAVESTREAM_CHUNK - stream.chunkpos;
+
+      if (n > len)
+        n = len;
+      memcpy(stream.chunk + stream.chunkpos, p, n);
+      stream.chunkpos += n;
+      p += n;
+      len -= n;
+      if (stream.chunkpos == SAVESTREAM_CHUNK)
+        SS_FlushChunk();
+    }
+}
+
+void P_WriteSaveByte(int b)
+{
+  byte c = b;
+
+  P_WriteSave(&c, 1);
+}
+
+// Pads to a 4-byte boundary so that the load/save works on SGI&Gecko.
+// Alignment is relative to the start of the (uncompressed) stream,
+// which matches the old malloc'ed savebuffer.
+void P_PadSave(void)
+{
+  static const byte zero[4];
+
+  P_WriteSave(zero, (4 - (stream.pos & 3)) & 3);
+}
+
+//
+// Reading
+//
+
+void P_ReadSave(void *dst, size_t len)
+{
+  byte *p = dst;
+
+  stream.pos += len;
+  while (len)
+    {
+      size_t n = stream.chunklen - stream.chunkpos;
+
+      if (!n)
+        {
+          if (!SS_FillChunk())
+            I_Error("P_ReadSave: Savegame truncated");
+          continue;
+        }
+      if (n > len)
+        n = len;
+      if (p)
+        {
+          memcpy(p, stream.chunk + stream.chunkpos, n);
+          p += n;
+        }
+      stream.chunkpos += n;
+      len -= n;
+    }
+}
+
+int P_ReadSaveByte(void)
+{
+  byte c;
+
+  P_ReadSave(&c, 1);
+  return c;
+}
+
+void P_SkipSave(size_t len)
+{
+  P_ReadSave(NULL, len);
+}
+
+void P_PadLoad(void)
+{
+  P_SkipSave((4 - (stream.pos & 3)) & 3);
+}
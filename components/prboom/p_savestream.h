@@ -0,0 +1,84 @@
+/* Emacs style mode select   -*- C++ -*-
+ *-----------------------------------------------------------------------------
+ *
+ *
+ *  PrBoom: a Doom port merged with LxDoom and LSDLDoom
+ *  based on BOOM, a modified and improved DOOM engine
+ *  Copyright (C) 1999 by
+ *  id Software, Chi Hoang, Lee Killough, Jim Flynn, Rand Phares, Ty Halderman
+ *  Copyright (C) 1999-2000 by
+ *  Jess Haas, Nicolas Kalkhof, Colin Phipps, Florian Schulze
+ *  Copyright 2005, 2006 by
+ *  Florian Schulze, Colin Phipps, Neil Stevens, Andrey Budko
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ *  02111-1307, USA.
+ *
+ * DESCRIPTION:
+ *      Streaming savegame I/O: fixed-size chunks written straight to
+ *      the file, optional LZ compression, CRC32 over the whole stream.
+ *
+ *-----------------------------------------------------------------------------*/
+
+#ifndef __P_SAVESTREAM__
+#define __P_SAVESTREAM__
+
+#include "doomtype.h"
+
+/* Size of the staging chunk; also the unit of compression */
+#define SAVESTREAM_CHUNK 4096
+
+/* Compress newly written savegames (config file setting) */
+extern int savegame_compress;
+
+/* Open the save stream for writing to / reading from a file.
+ * Only one stream can be open at a time. */
+boolean P_OpenSaveFile(const char *name, boolean compress);
+boolean P_OpenLoadFile(const char *name);
+
+/* Same on memory, for in-level snapshots. If base is not NULL the
+ * stream is stored XORed against it (a delta against an earlier
+ * stream), and must be loaded with the same base. */
+void P_OpenSaveMem(boolean compress, const byte *base, size_t baselen);
+void P_OpenLoadMem(const byte *data, size_t len, const byte *base, size_t baselen);
+
+/* Flush and close the stream. Returns false if any write failed, or
+ * (when loading) if the CRC or length in the trailer does not match. */
+boolean P_CloseSave(void);
+boolean P_CloseLoad(void);
+
+/* Close a memory stream, returning the malloc'ed data and its length,
+ * or NULL if memory ran out while writing it */
+byte *P_CloseSaveMem(size_t *len);
+
+/* Bytes of logical (uncompressed) stream produced/consumed so far */
+size_t P_SaveStreamPos(void);
+
+/* Bytes actually written to / read from the backing store */
+size_t P_SaveStreamStored(void);
+
+/* CRC32 of the logical stream so far */
+unsigned int P_SaveStreamCRC(void);
+
+void P_WriteSave(const void *src, size_t len);
+void P_WriteSaveByte(int b);
+void P_PadSave(void);   /* pad logical stream to a 4-byte boundary */
+
+void P_ReadSave(void *dst, size_t len);
+int  P_ReadSaveByte(void);
+void P_SkipSave(size_t len);
+void P_PadLoad(void);
+
+#endif
@@ -53,6 +53,7 @@
 #include "r_demo.h"
 #include "r_fps.h"
 #include "i_system.h"
+#include "md5.h"
 //
 // MAP related Lookup tables.
 // Store VERTEXES, LINEDEFS, SIDEDEFS, etc.
@@ -336,11 +337,13 @@ static int checkGLVertex(int num)
 }
 
 
+#ifdef GL_DOOM
 static float GetDistance(int dx, int dy)
 {
   float fx = (float)(dx)/FRACUNIT, fy = (float)(dy)/FRACUNIT;
   return (float)sqrt(fx*fx + fy*fy);
 }
+#endif
 
 
 static int GetOffset(vertex_t *v1, vertex_t *v2)
@@ -381,7 +384,9 @@ static void P_LoadSegs (int lump)
       int side, linedef;
       line_t *ldef;
 
+#ifdef GL_DOOM
       li->iSegID = i; // proff 11/05/2000: needed for OpenGL
+#endif
 
       v1 = (unsigned short)SHORT(ml->v1);
       v2 = (unsigned short)SHORT(ml->v2);
@@ -389,7 +394,9 @@ static void P_LoadSegs (int lump)
       li->v2 = &vertexes[v2];
 
       li->miniseg = false; // figgi -- there are no minisegs in classic BSP nodes
+#ifdef GL_DOOM
       li->length  = GetDistance(li->v2->x - li->v1->x, li->v2->y - li->v1->y);
+#endif
       li->angle = (SHORT(ml->angle))<<16;
       li->offset =(SHORT(ml->offset))<<16;
       linedef = (unsigned short)SHORT(ml->linedef);
@@ -444,7 +451,9 @@ static void P_LoadGLSegs(int lump)
   {             // check for gl-vertices
     segs[i].v1 = &vertexes[checkGLVertex(SHORT(ml->v1))];
     segs[i].v2 = &vertexes[checkGLVertex(SHORT(ml->v2))];
+#ifdef GL_DOOM
     segs[i].iSegID  = i;
+#endif
 
     if(ml->linedef != (unsigned short)-1) // skip minisegs
     {
@@ -454,7 +463,9 @@ static void P_LoadGLSegs(int lump)
       segs[i].angle = R_PointToAngle2(segs[i].v1->x,segs[i].v1->y,segs[i].v2->x,segs[i].v2->y);
 
       segs[i].sidedef = &sides[ldef->sidenum[ml->side]];
+#ifdef GL_DOOM
       segs[i].length  = GetDistance(segs[i].v2->x - segs[i].v1->x, segs[i].v2->y - segs[i].v1->y);
+#endif
       segs[i].frontsector = sides[ldef->sidenum[ml->side]].sector;
       if (ldef->flags & ML_TWOSIDED)
         segs[i].backsector = sides[ldef->sidenum[ml->side^1]].sector;
@@ -471,7 +482,9 @@ static void P_LoadGLSegs(int lump)
       segs[i].miniseg = true;
       segs[i].angle  = 0;
       segs[i].offset  = 0;
+#ifdef GL_DOOM
       segs[i].length  = 0;
+#endif
       segs[i].linedef = NULL;
       segs[i].sidedef = NULL;
       segs[i].frontsector = NULL;
@@ -520,6 +533,9 @@ static void P_LoadSectors (int lump)
   int  i;
 
   numsectors = W_LumpLength (lump) / sizeof(mapsector_t);
+  if (numsectors > SHRT_MAX)  // sector_t keeps sector numbers in shorts
+    I_Error("P_LoadSectors: %d sectors, at most %d supported",
+            numsectors, SHRT_MAX);
   sectors = Z_Calloc (numsectors,sizeof(sector_t),PU_LEVEL,0);
   data = W_CacheLumpNum (lump); // cph - wad lump handling updated
 
@@ -528,7 +544,9 @@ static void P_LoadSectors (int lump)
       sector_t *ss = sectors + i;
       const mapsector_t *ms = (const mapsector_t *) data + i;
 
+#ifdef GL_DOOM
       ss->iSectorID=i; // proff 04/05/2000: needed for OpenGL
+#endif
       ss->floorheight = SHORT(ms->floorheight)<<FRACBITS;
       ss->ceilingheight = SHORT(ms->ceilingheight)<<FRACBITS;
       ss->floorpic = R_FlatNumForName(ms->floorpic);
@@ -566,6 +584,62 @@ static void P_LoadSectors (int lump)
 }
 
 
+//
+// P_SortNodes
+//
+// Number the nodes depth first, front child before back child, from
+// the top of the array down, so that the root stays the last node and
+// a descent from it walks down through neighbouring entries instead of
+// jumping around the lump order. Returns the new number of each lump
+// node, or NULL if the nodes don't form a tree, in which case the lump
+// order is kept.
+//
+
+static int *P_SortNodes(const mapnode_t *data)
+{
+  int *newnum = malloc(numnodes * sizeof(*newnum));
+  int *stack = malloc(numnodes * sizeof(*stack));
+  int i, sp = 0, next = numnodes;
+
+  for (i=0; i<numnodes; i++)
+    newnum[i] = -1;
+
+  stack[sp++] = numnodes-1;
+  while (sp)
+    {
+      int n = stack[--sp];
+      int j;
+
+      if (newnum[n] >= 0)
+        break;
+      newnum[n] = --next;
+      for (j=1; j>=0; j--)  // back child first, so the front one pops next
+        {
+          int child = (unsigned short)SHORT(data[n].children[j]);
+
+          if (child & NF_SUBSECTOR)
+            continue;
+          if (child >= numnodes || sp == numnodes)
+            {
+              next = -1;
+              break;
+            }
+          stack[sp++] = child;
+        }
+      if (next < 0)
+        break;
+    }
+
+  free(stack);
+  if (sp || next)
+    {
+      lprintf(LO_WARN, "P_SortNodes: nodes are not a tree, keeping lump order\n");
+      free(newnum);
+      return NULL;
+    }
+  return newnum;
+}
+
 //
 // P_LoadNodes
 //
@@ -574,6 +648,7 @@ static void P_LoadSectors (int lump)
 static void P_LoadNodes (int lump)
 {
   const byte *data; // cph - const*
+  int  *newnum = NULL;
   int  i;
 
   numnodes = W_LumpLength (lump) / sizeof(mapnode_t);
@@ -589,27 +664,32 @@ static void P_LoadNodes (int lump)
     else
       I_Error("P_LoadNodes: no nodes in level");
   }
+  else
+    newnum = P_SortNodes((const mapnode_t *) data);
 
   for (i=0; i<numnodes; i++)
     {
-      node_t *no = nodes + i;
+      node_t *no = nodes + (newnum ? newnum[i] : i);
       const mapnode_t *mn = (const mapnode_t *) data + i;
       int j;
 
-      no->x = SHORT(mn->x)<<FRACBITS;
-      no->y = SHORT(mn->y)<<FRACBITS;
-      no->dx = SHORT(mn->dx)<<FRACBITS;
-      no->dy = SHORT(mn->dy)<<FRACBITS;
+      no->x = SHORT(mn->x);
+      no->y = SHORT(mn->y);
+      no->dx = SHORT(mn->dx);
+      no->dy = SHORT(mn->dy);
 
       for (j=0 ; j<2 ; j++)
         {
           int k;
           no->children[j] = SHORT(mn->children[j]);
+          if (newnum && !(no->children[j] & NF_SUBSECTOR))
+            no->children[j] = newnum[no->children[j]];
           for (k=0 ; k<4 ; k++)
-            no->bbox[j][k] = SHORT(mn->bbox[j][k])<<FRACBITS;
+            no->bbox[j][k] = SHORT(mn->bbox[j][k]);
         }
     }
 
+  free(newnum);
   W_UnlockLumpNum(lump); // cph - release the data
 }
 
@@ -716,7 +796,9 @@ static void P_LoadLineDefs (int lump)
       ld->soundorg.x = ld->bbox[BOXLEFT] / 2 + ld->bbox[BOXRIGHT] / 2;
       ld->soundorg.y = ld->bbox[BOXTOP] / 2 + ld->bbox[BOXBOTTOM] / 2;
 
+#ifdef GL_DOOM
       ld->iLineID=i; // proff 04/05/2000: needed for OpenGL
+#endif
       ld->sidenum[0] = SHORT(mld->sidenum[0]);
       ld->sidenum[1] = SHORT(mld->sidenum[1]);
 
@@ -912,9 +994,10 @@ static void AddBlockLine
 // This finds the intersection of each linedef with the column and
 // row lines at the left and bottom of each blockmap cell. It then
 // adds the line to all block lists touching the intersection.
+// Returns the number of entries in the lump.
 //
 
-static void P_CreateBlockMap(void)
+static long P_CreateBlockMap(void)
 {
   int xorg,yorg;                 // blockmap origin (lower left)
   int nrows,ncols;               // blockmap dimensions
@@ -1171,11 +1254,110 @@ static void P_CreateBlockMap(void)
   free (blocklists);
   free (blockcount);
   free (blockdone);
+
+  return 4+NBlocks+linetotal;
 }
 
 // jff 10/6/98
 // End new code added to speed up calculation of internal blockmap
 
+//
+// P_CacheBlockMap
+//
+// Building a blockmap clears a per-cell array for every linedef, which
+// takes seconds on a large map. The result is cached in a file named
+// after the MD5 of the vertexes and linedef endpoints it was built
+// from; the header repeats the full digest and the size, so a stale or
+// colliding file is detected and simply rebuilt.
+//
+
+typedef struct {
+  char id[8];
+  byte digest[16];
+  int  count;      // entries in blockmaplump
+  byte entrysize;  // sizeof(*blockmaplump)
+} blockmap_cache_t;
+
+static const char blockmap_id[8] = "BLOCKMP1";
+
+static void P_BlockMapKey(blockmap_cache_t *key)
+{
+  struct MD5Context md5;
+  int ends[2*64];
+  int i, n;
+
+  memset(key, 0, sizeof *key);
+  memcpy(key->id, blockmap_id, sizeof key->id);
+  key->entrysize = sizeof(*blockmaplump);
+
+  MD5Init(&md5);
+  MD5Update(&md5, (const void *)vertexes, numvertexes * sizeof(*vertexes));
+  for (i = n = 0; i < numlines; i++)
+    {
+      ends[n++] = lines[i].v1 - vertexes;
+      ends[n++] = lines[i].v2 - vertexes;
+      if (n == sizeof ends / sizeof *ends || i == numlines-1)
+        {
+          MD5Update(&md5, (const void *)ends, n * sizeof *ends);
+          n = 0;
+        }
+    }
+  MD5Final(key->digest, &md5);
+}
+
+static void P_CacheBlockMap(void)
+{
+  char fname[PATH_MAX+1];
+  blockmap_cache_t want, cache;
+  FILE *cachefp;
+  int starttime = I_GetTime_SaveMS();
+
+  P_BlockMapKey(&want);
+  snprintf(fname, sizeof fname, "%s/bm%02x%02x%02x.dat", I_DoomExeDir(),
+           want.digest[0], want.digest[1], want.digest[2]);
+
+  if ((cachefp = fopen(fname, "rb")) != NULL)
+    {
+      if (fread(&cache, 1, sizeof cache, cachefp) == sizeof cache &&
+          !memcmp(cache.id, want.id, sizeof want.id) &&
+          !memcmp(cache.digest, want.digest, sizeof want.digest) &&
+          cache.entrysize == want.entrysize && cache.count > 4)
+        {
+          blockmaplump = Z_Malloc(sizeof(*blockmaplump) * cache.count,
+                                  PU_LEVEL, 0);
+          if (fread(blockmaplump, sizeof(*blockmaplump), cache.count, cachefp)
+              == (size_t)cache.count &&
+              blockmaplump[2] > 0 && blockmaplump[3] > 0 &&
+              4 + blockmaplump[2]*blockmaplump[3] < cache.count)
+            {
+              fclose(cachefp);
+              bmaporgx = blockmaplump[0];
+              bmaporgy = blockmaplump[1];
+              bmapwidth = blockmaplump[2];
+              bmapheight = blockmaplump[3];
+              lprintf(LO_INFO, "P_CacheBlockMap: loaded %s in %dms\n",
+                      fname, I_GetTime_SaveMS() - starttime);
+              return;
+            }
+          Z_Free(blockmaplump);
+        }
+      fclose(cachefp);
+    }
+
+  want.count = P_CreateBlockMap();
+  lprintf(LO_INFO, "P_CacheBlockMap: built in %dms\n",
+          I_GetTime_SaveMS() - starttime);
+
+  if ((cachefp = fopen(fname, "wb")) != NULL)
+    {
+      if (fwrite(&want, 1, sizeof want, cachefp) != sizeof want ||
+          fwrite(blockmaplump, sizeof(*blockmaplump), want.count, cachefp)
+          != (size_t)want.count)
+        lprintf(LO_WARN, "P_CacheBlockMap: Couldn't write %s\n", fname);
+      fclose(cachefp);
+    }
+}
+
 //
 // P_LoadBlockMap
 //
@@ -1191,7 +1373,7 @@ static void P_LoadBlockMap (int lump)
   long count;
 
   if (M_CheckParm("-blockmap") || W_LumpLength(lump)<8 || (count = W_LumpLength(lump)/2) >= 0x10000) //e6y
-    P_CreateBlockMap();
+    P_CacheBlockMap();
   else
     {
       long i;
@@ -1493,6 +1675,93 @@ static void P_RemoveSlimeTrails(void)         // killough 10/98
   free(hit);
 }
 
+//
+// P_PrefetchLevel
+//
+// Start reading the map lumps of a level in the background, in the
+// order P_SetupLevel loads them, so the intermission screen or the
+// decoding of the lumps before each one hides the card reads. Does
+// nothing if the map isn't in the wad.
+//
+
+void P_PrefetchLevel(int episode, int map)
+{
+  static const int maplumps[] = {
+    ML_VERTEXES, ML_SECTORS, ML_SIDEDEFS, ML_LINEDEFS, ML_BLOCKMAP,
+    ML_SSECTORS, ML_NODES, ML_SEGS, ML_REJECT, ML_THINGS
+  };
+  // with GL nodes, the GL lumps take the place of the vanilla BSP
+  static const int glmaplumps[] = {
+    ML_VERTEXES, -ML_GL_VERTS, ML_SECTORS, ML_SIDEDEFS, ML_LINEDEFS,
+    ML_BLOCKMAP, -ML_GL_SSECT, -ML_GL_NODES, -ML_GL_SEGS, ML_REJECT,
+    ML_THINGS
+  };
+  int  lumps[sizeof glmaplumps/sizeof *glmaplumps];
+  char lumpname[9], gl_lumpname[9];
+  int  lumpnum, gl_lumpnum, count = 0;
+  size_t i;
+
+  if (gamemode == commercial)
+  {
+    sprintf(lumpname, "map%02d", map);
+    sprintf(gl_lumpname, "gl_map%02d", map);
+  }
+  else
+  {
+    sprintf(lumpname, "E%dM%d", episode, map);
+    sprintf(gl_lumpname, "GL_E%iM%i", episode, map);
+  }
+
+  if ((lumpnum = W_CheckNumForName(lumpname)) == -1)
+    return;
+  gl_lumpnum = W_CheckNumForName(gl_lumpname);
+
+  if (gl_lumpnum == -1)
+  {
+    for (i = 0; i < sizeof maplumps/sizeof *maplumps; i++)
+      if (lumpnum + maplumps[i] < numlumps)
+        lumps[count++] = lumpnum + maplumps[i];
+  }
+  else
+  {
+    for (i = 0; i < sizeof glmaplumps/sizeof *glmaplumps; i++)
+    {
+      int l = glmaplumps[i] < 0 ? gl_lumpnum - glmaplumps[i] : lumpnum + glmaplumps[i];
+
+      if (l < numlumps)
+        lumps[count++] = l;
+    }
+  }
+
+  W_PrefetchLumps(lumps, count);
+}
+
+//
+// P_SetupLevel stage timing
+//
+// Each step of loading a level adds its time since the previous one to
+// a line that is logged once the level is up.
+//
+
+static char stagelog[320];
+static int  stagetime;
+
+static void P_StartStages(void)
+{
+  stagelog[0] = 0;
+  stagetime = I_GetTime_SaveMS();
+}
+
+static void P_StageDone(const char *name)
+{
+  int    now = I_GetTime_SaveMS();
+  size_t len = strlen(stagelog);
+
+  if (len < sizeof stagelog)
+    snprintf(stagelog + len, sizeof stagelog - len, " %s %d", name, now - stagetime);
+  stagetime = now;
+}
+
 //
 // P_SetupLevel
 //
@@ -1506,6 +1775,14 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
 
   char  gl_lumpname[9];
   int   gl_lumpnum;
+  int   starttime = I_GetTime_SaveMS();
+
+  // Read the map lumps ahead in load order, so each is already coming
+  // off the card while the one before it is decoded. What was read
+  // during the intermission is kept, if that's all of them this just
+  // waits for that job.
+  P_StartStages();
+  P_PrefetchLevel(episode, map);
 
   R_StopAllInterpolations();
 
@@ -1526,6 +1803,7 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     W_UnlockLumpNum(rejectlump);
     rejectlump = -1;
   }
+  P_StageDone("free");
 
 #ifdef GL_DOOM
 // proff 11/99: clean the memory from textures etc.
@@ -1573,12 +1851,16 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     P_LoadVertexes2 (lumpnum+ML_VERTEXES,gl_lumpnum+ML_GL_VERTS);
   else
     P_LoadVertexes  (lumpnum+ML_VERTEXES);
+  P_StageDone("vertexes");
   P_LoadSectors   (lumpnum+ML_SECTORS);
+  P_StageDone("sectors");
   P_LoadSideDefs  (lumpnum+ML_SIDEDEFS);
   P_LoadLineDefs  (lumpnum+ML_LINEDEFS);
   P_LoadSideDefs2 (lumpnum+ML_SIDEDEFS);
   P_LoadLineDefs2 (lumpnum+ML_LINEDEFS);
+  P_StageDone("lines");
   P_LoadBlockMap  (lumpnum+ML_BLOCKMAP);
+  P_StageDone("blockmap");
 
   if (nodesVersion > 0)
   {
@@ -1592,6 +1874,7 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     P_LoadNodes(lumpnum + ML_NODES);
     P_LoadSegs(lumpnum + ML_SEGS);
   }
+  P_StageDone("bsp");
 
 #else
 
@@ -1610,13 +1893,19 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
 
   // reject loading and underflow padding separated out into new function
   // P_GroupLines modified to return a number the underflow padding needs
-  P_LoadReject(lumpnum, P_GroupLines());
+  i = P_GroupLines();
+  P_StageDone("group");
+  P_LoadReject(lumpnum, i);
+  P_StageDone("reject");
 
   // e6y
   // Correction of desync on dv04-423.lmp/dv.wad
   // http://www.doomworld.com/vb/showthread.php?s=&postid=627257#post627257
   if (compatibility_level>=lxdoom_1_compatibility || M_CheckParm("-force_remove_slime_trails") > 0)
+  {
     P_RemoveSlimeTrails();    // killough 10/98: remove slime trails from wad
+    P_StageDone("slime");
+  }
 
   // Note: you don't need to clear player queue slots --
   // a much simpler fix is in g_game.c -- killough 10/98
@@ -1632,6 +1921,7 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
   P_MapStart();
 
   P_LoadThings(lumpnum+ML_THINGS);
+  P_StageDone("things");
 
   // if deathmatch, randomly spawn the active players
   if (deathmatch)
@@ -1661,10 +1951,16 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
   P_SpawnSpecials();
 
   P_MapEnd();
+  P_StageDone("specials");
+
+  R_TrimLevelTextures();
 
   // preload graphics
   if (precache)
+  {
     R_PrecacheLevel();
+    P_StageDone("precache");
+  }
 
 #ifdef GL_DOOM
   if (V_GetMode() == VID_MODEGL)
@@ -1675,6 +1971,10 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
 #endif
 
   R_SmoothPlaying_Reset(NULL); // e6y
+
+  lprintf(LO_INFO, "P_SetupLevel: %s in %dms, %d lumps prefetched\n",
+          lumpname, I_GetTime_SaveMS() - starttime, W_DropPrefetch());
+  lprintf(LO_INFO, "P_SetupLevel: ms per stage:%s\n", stagelog);
 }
 
 //
@@ -41,6 +41,7 @@
 #endif
 
 void P_SetupLevel(int episode, int map, int playermask, skill_t skill);
+void P_PrefetchLevel(int episode, int map); /* read ahead during intermission */
 void P_Init(void);               /* Called by startup code. */
 
 extern const byte *rejectmatrix;   /* for fast sight rejection -  cph - const* */
@@ -200,43 +200,80 @@ static boolean P_CrossSubsector(int num)
 // cph - Made to use R_PointOnSide instead of P_DivlineSide, since the latter
 //  could return 2 which was ambigous, and the former is
 //  better optimised; also removes two casts :-)
+//
+// Where the partition is crossed, the ending side is pushed on a stack
+// and the starting side is crossed first; the first subsector that
+// blocks ends the whole check, as the recursive version did.
+//
+
+static int *sightstack;
+static int maxsightstack;
 
 static boolean P_CrossBSPNode_LxDoom(int bspnum)
 {
-  while (!(bspnum & NF_SUBSECTOR))
+  int sp = 0;
+
+  for (;;)
     {
-      register const node_t *bsp = nodes + bspnum;
-      int side,side2;
-      side = R_PointOnSide(los.strace.x, los.strace.y, bsp);
-      side2 = R_PointOnSide(los.t2x, los.t2y, bsp);
-      if (side == side2)
-         bspnum = bsp->children[side]; // doesn't touch the other side
-      else         // the partition plane is crossed here
-        if (!P_CrossBSPNode_LxDoom(bsp->children[side]))
-          return 0;  // cross the starting side
-        else
-          bspnum = bsp->children[side^1];  // cross the ending side
+      while (!(bspnum & NF_SUBSECTOR))
+        {
+          register const node_t *bsp = nodes + bspnum;
+          int side,side2;
+          side = R_PointOnSide(los.strace.x, los.strace.y, bsp);
+          side2 = R_PointOnSide(los.t2x, los.t2y, bsp);
+          if (side != side2)  // the partition plane is crossed here
+            {
+              if (sp == maxsightstack)
+                {
+                  maxsightstack = maxsightstack ? maxsightstack*2 : 64;
+                  sightstack = realloc(sightstack, maxsightstack*sizeof(*sightstack));
+                }
+              sightstack[sp++] = bsp->children[side^1];  // cross the ending side
+            }
+          bspnum = bsp->children[side];  // cross the starting side
+        }
+      if (!P_CrossSubsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR))
+        return false;
+      if (!sp)
+        return true;
+      bspnum = sightstack[--sp];
     }
-  return P_CrossSubsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
 }
 
 static boolean P_CrossBSPNode_PrBoom(int bspnum)
 {
-  while (!(bspnum & NF_SUBSECTOR))
+  int sp = 0;
+
+  for (;;)
     {
-      register const node_t *bsp = nodes + bspnum;
-      int side,side2;
-      side = P_DivlineSide(los.strace.x,los.strace.y,(const divline_t *)bsp)&1;
-      side2= P_DivlineSide(los.t2x, los.t2y, (const divline_t *) bsp);
-      if (side == side2)
-         bspnum = bsp->children[side]; // doesn't touch the other side
-      else         // the partition plane is crossed here
-        if (!P_CrossBSPNode_PrBoom(bsp->children[side]))
-          return 0;  // cross the starting side
-        else
-          bspnum = bsp->children[side^1];  // cross the ending side
+      while (!(bspnum & NF_SUBSECTOR))
+        {
+          register const node_t *bsp = nodes + bspnum;
+          divline_t divl;
+          int side,side2;
+          divl.x = bsp->x<<FRACBITS;
+          divl.y = bsp->y<<FRACBITS;
+          divl.dx = bsp->dx<<FRACBITS;
+          divl.dy = bsp->dy<<FRACBITS;
+          side = P_DivlineSide(los.strace.x,los.strace.y,&divl)&1;
+          side2= P_DivlineSide(los.t2x, los.t2y, &divl);
+          if (side != side2)  // the partition plane is crossed here
+            {
+              if (sp == maxsightstack)
+                {
+                  maxsightstack = maxsightstack ? maxsightstack*2 : 64;
+                  sightstack = realloc(sightstack, maxsightstack*sizeof(*sightstack));
+                }
+              sightstack[sp++] = bsp->children[side^1];  // cross the ending side
+            }
+          bspnum = bsp->children[side];  // cross the starting side
+        }
+      if (!P_CrossSubsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR))
+        return false;
+      if (!sp)
+        return true;
+      bspnum = sightstack[--sp];
     }
-  return P_CrossSubsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
 }
 
 /* proff - Moved the compatibility check outside the functions
@@ -431,13 +431,19 @@ static const int checkcoord[12][4] = // killough -- static const
 };
 
 // killough 1/28/98: static // CPhipps - const parameter, reformatted
-static boolean R_CheckBBox(const fixed_t *bspcoord)
+static boolean R_CheckBBox(const short *bspbox)
 {
   angle_t angle1, angle2;
 
   {
     int        boxpos;
     const int* check;
+    fixed_t    bspcoord[4];
+
+    bspcoord[BOXTOP] = bspbox[BOXTOP]<<FRACBITS;
+    bspcoord[BOXBOTTOM] = bspbox[BOXBOTTOM]<<FRACBITS;
+    bspcoord[BOXLEFT] = bspbox[BOXLEFT]<<FRACBITS;
+    bspcoord[BOXRIGHT] = bspbox[BOXRIGHT]<<FRACBITS;
 
     // Find the corners of the box
     // that define the edges from current viewpoint.
@@ -644,29 +650,55 @@ static void R_Subsector(int num)
 
 //
 // RenderBSPNode
-// Renders all subsectors below a given node,
-//  traversing subtree recursively.
+// Renders all subsectors below a given node.
 // Just call with BSP root.
 //
 // killough 5/2/98: reformatted, removed tail recursion
+//
+// The recursion is replaced by a stack of nodes whose back side is
+// still to be checked. Each is popped once the front side is done, in
+// the same order the recursive version returned to them.
+//
+
+static int *bspstack;
+static int maxbspstack;
 
 void R_RenderBSPNode(int bspnum)
 {
-  while (!(bspnum & NF_SUBSECTOR))  // Found a subsector?
-    {
-      const node_t *bsp = &nodes[bspnum];
+  int sp = 0;
 
-      // Decide which side the view point is on.
-      int side = R_PointOnSide(viewx, viewy, bsp);
-      // Recursively divide front space.
-      R_RenderBSPNode(bsp->children[side]);
+  for (;;)
+    {
+      while (!(bspnum & NF_SUBSECTOR))  // Found a subsector?
+        {
+          const node_t *bsp = &nodes[bspnum];
 
-      // Possibly divide back space.
+          // Decide which side the view point is on.
+          int side = R_PointOnSide(viewx, viewy, bsp);
 
-      if (!R_CheckBBox(bsp->bbox[side^1]))
-        return;
+          if (sp == maxbspstack)
+            {
+              maxbspstack = maxbspstack ? maxbspstack*2 : 64;
+              bspstack = realloc(bspstack, maxbspstack*sizeof(*bspstack));
+            }
+          // Divide front space first, remember the back space.
+          bspstack[sp++] = bspnum*2 + (side^1);
+          bspnum = bsp->children[side];
+        }
+      R_Subsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
 
-      bspnum = bsp->children[side^1];
+      // Possibly divide back space.
+      do
+        {
+          const node_t *bsp;
+          int side;
+
+          if (!sp)
+            return;
+          bsp = &nodes[bspstack[--sp]>>1];
+          side = bspstack[sp]&1;
+          bspnum = R_CheckBBox(bsp->bbox[side]) ? bsp->children[side] : -1;
+        }
+      while (bspnum == -1);
     }
-  R_Subsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
 }
@@ -42,6 +42,7 @@
 #include "r_things.h"
 #include "p_tick.h"
 #include "lprintf.h"  // jff 08/03/98 - declaration of lprintf
+#include "md5.h"
 #include "p_tick.h"
 
 //
@@ -408,19 +409,50 @@ int R_ColormapNumForName(const char *name)
 static inline int between(int l,int u,int x)
 { return (l > x ? l : x > u ? u : x); }
 
+/*
+ * R_LightBase
+ *
+ * The light level half of R_ColourMap. It only depends on the sector
+ * light and the seg being drawn, so wall loops work it out once per seg
+ * and pass it to R_ScaleColourMap for each column.
+ */
+
+int R_LightBase(int lightlevel)
+{
+  if (curline)
+    if (curline->v1->y == curline->v2->y)
+      lightlevel -= 1 << LIGHTSEGSHIFT;
+    else
+      if (curline->v1->x == curline->v2->x)
+        lightlevel += 1 << LIGHTSEGSHIFT;
+
+  lightlevel += extralight << LIGHTSEGSHIFT;
+
+  return ((256-lightlevel)*2*NUMCOLORMAPS/256) - 4;
+}
+
+/*
+ * R_ScaleLight / R_LightColourMap
+ *
+ * The scale half: R_ScaleLight gives the number of colour maps the scale
+ * brightens by, R_LightColourMap clamps the result to the maps we have.
+ */
+
+int R_ScaleLight(fixed_t spryscale)
+{
+  return FixedMul(spryscale,pspriteiscale)/2 >> LIGHTSCALESHIFT;
+}
+
+const lighttable_t* R_LightColourMap(int light)
+{
+  return fixedcolormap ? fixedcolormap :
+    fullcolormap + between(0,NUMCOLORMAPS-1,light)*256;
+}
+
 const lighttable_t* R_ColourMap(int lightlevel, fixed_t spryscale)
 {
   if (fixedcolormap) return fixedcolormap;
   else {
-    if (curline)
-      if (curline->v1->y == curline->v2->y)
-        lightlevel -= 1 << LIGHTSEGSHIFT;
-      else
-        if (curline->v1->x == curline->v2->x)
-          lightlevel += 1 << LIGHTSEGSHIFT;
-
-    lightlevel += extralight << LIGHTSEGSHIFT;
-
     /* cph 2001/11/17 -
      * Work out what colour map to use, remembering to clamp it to the number of
      * colour maps we actually have. This formula is basically the one from the
@@ -432,13 +464,181 @@ const lighttable_t* R_ColourMap(int lightlevel, fixed_t spryscale)
      * precision until the final step, so slight scale differences can count
      * against slight light level variations.
      */
-    return fullcolormap + between(0,NUMCOLORMAPS-1,
-          ((256-lightlevel)*2*NUMCOLORMAPS/256) - 4
-          - (FixedMul(spryscale,pspriteiscale)/2 >> LIGHTSCALESHIFT)
-          )*256;
+    return R_LightColourMap(R_LightBase(lightlevel) - R_ScaleLight(spryscale));
   }
 }
 
+//
+// Translucency filter map
+//
+
+int tran_filter_pct = 66;       // filter percent
+
+#define TSC 12        /* number of fixed point digits in filter percent */
+
+// The filter map entry for (i,j) is the palette colour nearest to the
+// blend of i and j. Rather than trying all 256 colours for each of the
+// 65536 blends, RGB space is cut into TRANGRID^3 cells, and each cell
+// lists the colours that can be nearest to some point in it: those no
+// further from the cell than the closest colour's far corner. A blend
+// only tries its cell's list. The lists run from colour 255 down, and
+// the error sums are the same as ever, so ties still go to the highest
+// colour and the map comes out byte for byte what the full search gave.
+//
+// The rows are split between this core and a background job.
+
+#define TRANGRID_SHIFT 5
+#define TRANGRID (256>>TRANGRID_SHIFT)
+#define TRANCELLS (TRANGRID*TRANGRID*TRANGRID)
+
+typedef struct {
+  long pal[3][256], pal_w1[3][256], tot[256];
+  long w2;
+  // Squared distance along each axis from each colour to the nearest
+  // and furthest point of each slab of cells
+  unsigned short axnear[3][TRANGRID][256], axfar[3][TRANGRID][256];
+  int  start[TRANCELLS+1];      // cell's list is cand[start[cell]..start[cell+1])
+  byte *cand;
+  byte *map;
+} tranbuild_t;
+
+static tranbuild_t *tranbuild;
+
+// Fill in the cells' colour lists, or with cand NULL just count them
+static int R_TranMapCells(byte *cand)
+{
+  tranbuild_t *tb = tranbuild;
+  int cell, n = 0;
+
+  for (cell = 0; cell < TRANCELLS; cell++)
+    {
+      const unsigned short *near0 = tb->axnear[0][cell / (TRANGRID*TRANGRID)];
+      const unsigned short *near1 = tb->axnear[1][cell / TRANGRID % TRANGRID];
+      const unsigned short *near2 = tb->axnear[2][cell % TRANGRID];
+      const unsigned short *far0 = tb->axfar[0][cell / (TRANGRID*TRANGRID)];
+      const unsigned short *far1 = tb->axfar[1][cell / TRANGRID % TRANGRID];
+      const unsigned short *far2 = tb->axfar[2][cell % TRANGRID];
+      int c, minfar = INT_MAX;
+
+      for (c = 0; c < 256; c++)
+        {
+          int dfar = far0[c] + far1[c] + far2[c];
+          if (dfar < minfar)
+            minfar = dfar;
+        }
+
+      tb->start[cell] = n;
+      for (c = 255; c >= 0; c--)
+        if (near0[c] + near1[c] + near2[c] <= minfar)
+          {
+            if (cand)
+              cand[n] = c;
+            n++;
+          }
+    }
+  return tb->start[TRANCELLS] = n;
+}
+
+static void R_TranMapRows(int first, int last, int progress)
+{
+  const tranbuild_t *tb = tranbuild;
+  byte *tp = tb->map + first*256;
+  int i, j;
+
+  for (i = first; i < last; i++)
+    {
+      long r1 = tb->pal[0][i] * tb->w2;
+      long g1 = tb->pal[1][i] * tb->w2;
+      long b1 = tb->pal[2][i] * tb->w2;
+
+      if (progress && !((i - first) % ((last - first) >> 3)))
+        //jff 8/3/98 use logical output routine
+        lprintf(LO_INFO,".");
+      for (j = 0; j < 256; j++, tp++)
+        {
+          long r = tb->pal_w1[0][j] + r1;
+          long g = tb->pal_w1[1][j] + g1;
+          long b = tb->pal_w1[2][j] + b1;
+          int cell = (((r >> (TSC+TRANGRID_SHIFT)) * TRANGRID +
+                       (g >> (TSC+TRANGRID_SHIFT))) * TRANGRID) +
+                       (b >> (TSC+TRANGRID_SHIFT));
+          const byte *cp = tb->cand + tb->start[cell];
+          const byte *end = tb->cand + tb->start[cell+1];
+          long err, best = LONG_MAX;
+          int nearest = 0;
+
+          do
+            {
+              int color = *cp;
+              if ((err = tb->tot[color] - tb->pal[0][color]*r
+                   - tb->pal[1][color]*g - tb->pal[2][color]*b) < best)
+                best = err, nearest = color;
+            }
+          while (++cp < end);
+          *tp = nearest;
+        }
+    }
+}
+
+static void R_TranMapJob(void)
+{
+  R_TranMapRows(128, 256, false);
+}
+
+static void R_BuildTranMap(const byte *playpal, byte *map, int progress)
+{
+  tranbuild_t *tb;
+  long w1 = ((unsigned long) tran_filter_pct<<TSC)/100;
+  boolean split;
+  int i, j, k;
+
+  tranbuild = tb = Z_Malloc(sizeof *tb, PU_STATIC, 0);
+  tb->w2 = (1l<<TSC)-w1;
+  tb->map = map;
+
+  // Transpose playpal into long int type, for fast inner-loop
+  // calculations. Precompute tot array.
+  for (i = 0; i < 256; i++)
+    {
+      long d = 0;
+      for (k = 0; k < 3; k++)
+        {
+          long t = playpal[i*3+k];
+          tb->pal[k][i] = t;
+          tb->pal_w1[k][i] = t * w1;
+          d += t*t;
+        }
+      tb->tot[i] = d << (TSC-1);
+    }
+
+  for (k = 0; k < 3; k++)
+    for (j = 0; j < TRANGRID; j++)
+      for (i = 0; i < 256; i++)
+        {
+          int p = tb->pal[k][i];
+          int lo = j << TRANGRID_SHIFT, hi = MIN(lo + (1<<TRANGRID_SHIFT), 255);
+          int d = p < lo ? lo - p : p > hi ? p - hi : 0;
+          int f = p - lo > hi - p ? p - lo : hi - p;
+          tb->axnear[k][j][i] = d*d;
+          tb->axfar[k][j][i] = f*f;
+        }
+
+  tb->cand = Z_Malloc(R_TranMapCells(NULL), PU_STATIC, 0);
+  R_TranMapCells(tb->cand);
+
+  if (progress)
+    lprintf(LO_INFO, "Tranmap build [        ]\x08\x08\x08\x08\x08\x08\x08\x08\x08");
+
+  split = I_StartBackground(R_TranMapJob);
+  R_TranMapRows(0, split ? 128 : 256, progress);
+  if (split)
+    I_WaitBackground();
+
+  Z_Free(tb->cand);
+  Z_Free(tb);
+  tranbuild = NULL;
+}
+
 //
 // R_InitTranMap
 //
@@ -446,10 +646,17 @@ const lighttable_t* R_ColourMap(int lightlevel, fixed_t spryscale)
 //
 // By Lee Killough 2/21/98
 //
+// The map is cached in tranmap.dat, keyed by the filter percentage and
+// the MD5 of the palette it was built from.
+//
 
-int tran_filter_pct = 66;       // filter percent
+typedef struct {
+  char id[8];
+  byte pct;
+  byte digest[16];
+} tranmap_cache_t;
 
-#define TSC 12        /* number of fixed point digits in filter percent */
+static const char tranmap_id[8] = "TRANMAP1";
 
 void R_InitTranMap(int progress)
 {
@@ -462,16 +669,23 @@ void R_InitTranMap(int progress)
   else if (W_CheckNumForName("PLAYPAL")!=-1) // can be called before WAD loaded
     {   // Compose a default transparent filter map based on PLAYPAL.
       lprintf(LO_INFO, "R_InitTranMap: PLAYPAL lump: %d\n", W_GetNumForName("PLAYPAL"));
-      byte *playpal = W_CacheLumpName("PLAYPAL");
+      const byte *playpal = W_CacheLumpName("PLAYPAL");
       lprintf(LO_INFO, "R_InitTranMap: PLAYPAL cache: %p\n", playpal);
       byte       *my_tranmap;
 
       char fname[PATH_MAX+1];
-      struct {
-        unsigned char pct;
-        unsigned char playpal[256];
-      } cache;
-      FILE *cachefp = NULL; //fopen(strcat(strcpy(fname, I_DoomExeDir()), "/tranmap.dat"),"rb");
+      struct MD5Context md5;
+      tranmap_cache_t want, cache;
+      FILE *cachefp;
+
+      memcpy(want.id, tranmap_id, sizeof want.id);
+      want.pct = tran_filter_pct;
+      MD5Init(&md5);
+      MD5Update(&md5, playpal, 256*3);
+      MD5Final(want.digest, &md5);
+
+      snprintf(fname, sizeof fname, "%s/tranmap.dat", I_DoomExeDir());
+      cachefp = fopen(fname, "rb");
 
       main_tranmap = my_tranmap = Z_Malloc(256*256, PU_STATIC, 0);  // killough 4/11/98
 
@@ -479,75 +693,24 @@ void R_InitTranMap(int progress)
 
       if (!cachefp ||
           fread(&cache, 1, sizeof cache, cachefp) != sizeof cache ||
-          cache.pct != tran_filter_pct ||
-          memcmp(cache.playpal, playpal, sizeof cache.playpal) ||
+          memcmp(&cache, &want, sizeof cache) ||
           fread(my_tranmap, 256, 256, cachefp) != 256 ) // killough 4/11/98
         {
-          long pal[3][256], tot[256], pal_w1[3][256];
-          long w1 = ((unsigned long) tran_filter_pct<<TSC)/100;
-          long w2 = (1l<<TSC)-w1;
-
-          if (progress)
-            lprintf(LO_INFO, "Tranmap build [        ]\x08\x08\x08\x08\x08\x08\x08\x08\x08");
+          int starttime = I_GetTime_SaveMS();
 
-          // First, convert playpal into long int type, and transpose array,
-          // for fast inner-loop calculations. Precompute tot array.
+          if (cachefp)
+            fclose(cachefp);
 
-          {
-            register int i = 255;
-            register const unsigned char *p = playpal+255*3;
-            do
-              {
-                register long t,d;
-                pal_w1[0][i] = (pal[0][i] = t = p[0]) * w1;
-                d = t*t;
-                pal_w1[1][i] = (pal[1][i] = t = p[1]) * w1;
-                d += t*t;
-                pal_w1[2][i] = (pal[2][i] = t = p[2]) * w1;
-                d += t*t;
-                p -= 3;
-                tot[i] = d << (TSC-1);
-              }
-            while (--i>=0);
-          }
+          R_BuildTranMap(playpal, my_tranmap, progress);
+          lprintf(LO_INFO, "R_InitTranMap: built in %dms\n",
+                  I_GetTime_SaveMS() - starttime);
 
-          // Next, compute all entries using minimum arithmetic.
-
-          {
-            int i,j;
-            byte *tp = my_tranmap;
-            for (i=0;i<256;i++)
-              {
-                long r1 = pal[0][i] * w2;
-                long g1 = pal[1][i] * w2;
-                long b1 = pal[2][i] * w2;
-                if (!(i & 31) && progress)
-                  //jff 8/3/98 use logical output routine
-                  lprintf(LO_INFO,".");
-                for (j=0;j<256;j++,tp++)
-                  {
-                    register int color = 255;
-                    register long err;
-                    long r = pal_w1[0][j] + r1;
-                    long g = pal_w1[1][j] + g1;
-                    long b = pal_w1[2][j] + b1;
-                    long best = LONG_MAX;
-                    do
-                      if ((err = tot[color] - pal[0][color]*r
-                          - pal[1][color]*g - pal[2][color]*b) < best)
-                        best = err, *tp = color;
-                    while (--color >= 0);
-                  }
-              }
-          }
-          //if ((cachefp = fopen(fname,"wb")) != NULL) // write out the cached translucency map
-			if(0) 
+          // write out the cached translucency map
+          if ((cachefp = fopen(fname, "wb")) != NULL)
             {
-              cache.pct = tran_filter_pct;
-              memcpy(cache.playpal, playpal, 256);
-              fseek(cachefp, 0, SEEK_SET);
-              fwrite(&cache, 1, sizeof cache, cachefp);
-              fwrite(main_tranmap, 256, 256, cachefp);
+              if (fwrite(&want, 1, sizeof want, cachefp) != sizeof want ||
+                  fwrite(main_tranmap, 256, 256, cachefp) != 256)
+                lprintf(LO_WARN, "R_InitTranMap: Couldn't write %s\n", fname);
               // CPhipps - leave close for a few lines...
             }
         }
@@ -647,6 +810,27 @@ int PUREFUNC R_SafeTextureNumForName(const char *name, int snum)
   return i;
 }
 
+//
+// R_TrimLevelTextures
+// Frees the composites of the previous level's textures that this
+// level doesn't use, and logs what that level cost to compose.
+//
+
+void R_TrimLevelTextures(void)
+{
+  byte *hitlist = calloc(numtextures, 1);
+  int i;
+
+  for (i = numsides; --i >= 0;)
+    hitlist[sides[i].bottomtexture] =
+      hitlist[sides[i].toptexture] =
+      hitlist[sides[i].midtexture] = 1;
+  hitlist[skytexture] = 1;
+
+  R_TrimTextureComposites(hitlist);
+  free(hitlist);
+}
+
 //
 // R_PrecacheLevel
 // Preloads all relevant graphics for the level.
@@ -670,7 +854,7 @@ void R_PrecacheLevel(void)
 
   {
     size_t size = numflats > numsprites  ? numflats : numsprites;
-    hitlist = malloc((size_t)numtextures > size ? numtextures : size);
+    hitlist = malloc(size);
   }
 
   // Precache flats.
@@ -684,32 +868,9 @@ void R_PrecacheLevel(void)
     if (hitlist[i])
       precache_lump(firstflat + i);
 
-  // Precache textures.
-
-  memset(hitlist, 0, numtextures);
-
-  for (i = numsides; --i >= 0;)
-    hitlist[sides[i].bottomtexture] =
-      hitlist[sides[i].toptexture] =
-      hitlist[sides[i].midtexture] = 1;
-
-  // Sky texture is always present.
-  // Note that F_SKY1 is the name used to
-  //  indicate a sky floor/ceiling as a flat,
-  //  while the sky texture is stored like
-  //  a wall texture, with an episode dependend
-  //  name.
-
-  hitlist[skytexture] = 1;
-
-  for (i = numtextures; --i >= 0; )
-    if (hitlist[i])
-      {
-        texture_t *texture = textures[i];
-        int j = texture->patchcount;
-        while (--j >= 0)
-          precache_lump(texture->patches[j].patch);
-      }
+  // Textures aren't touched here: composites are built the first time
+  // the wall renderer needs one (see R_TrimLevelTextures), and reading
+  // their patches now would only throw them away again.
 
   // Precache sprites.
   memset(hitlist, 0, numsprites);
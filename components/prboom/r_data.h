@@ -79,6 +79,7 @@ const byte *R_GetTextureColumn(const rpatch_t *texpatch, int col);
 
 // I/O, setting up the stuff.
 void R_InitData (void);
+void R_TrimLevelTextures (void);
 void R_PrecacheLevel (void);
 
 
@@ -100,6 +101,11 @@ void R_InitTranMap(int);      // killough 3/6/98: translucency initialization
 int R_ColormapNumForName(const char *name);      // killough 4/4/98
 /* cph 2001/11/17 - new func to do lighting calcs and get suitable colour map */
 const lighttable_t* R_ColourMap(int lightlevel, fixed_t spryscale);
+/* The same in two halves, for loops that draw many columns at one light:
+ * R_ColourMap(l,s) == R_LightColourMap(R_LightBase(l) - R_ScaleLight(s)) */
+int R_LightBase(int lightlevel);
+int R_ScaleLight(fixed_t spryscale);
+const lighttable_t* R_LightColourMap(int light);
 
 extern const byte *main_tranmap, *tranmap;
 
@@ -87,49 +87,39 @@ typedef struct
 // The SECTORS record, at runtime.
 // Stores things/mobjs.
 //
+// Fields the renderer and the movement code read every tic come first,
+// so that a sector's hot state shares a cache line or two; specials,
+// tag chains, sound propagation and thinker links follow. Sector
+// numbers are kept in shorts, like the sidedefs that reference them.
+//
 
 typedef struct
 {
-  int iSectorID; // proff 04/05/2000: needed for OpenGL and used in debugmode by the HUD to draw sectornum
-  boolean no_toptextures;
-  boolean no_bottomtextures;
   fixed_t floorheight;
   fixed_t ceilingheight;
-  int nexttag,firsttag;  // killough 1/30/98: improves searches for tags.
-  int soundtraversed;    // 0 = untraversed, 1,2 = sndlines-1
-  mobj_t *soundtarget;   // thing that made a sound (or null)
-  int blockbox[4];       // mapblock bounding box for height changes
-  degenmobj_t soundorg;  // origin for any sounds played by the sector
-  int validcount;        // if == validcount, already checked
-  mobj_t *thinglist;     // list of mobjs in sector
-
-  /* killough 8/28/98: friction is a sector property, not an mobj property.
-   * these fields used to be in mobj_t, but presented performance problems
-   * when processed as mobj properties. Fix is to make them sector properties.
-   */
-  int friction,movefactor;
+  short floorpic;
+  short ceilingpic;
+  short lightlevel;
+  short special;
 
-  // thinker_t for reversable actions
-  void *floordata;    // jff 2/22/98 make thinkers on
-  void *ceilingdata;  // floors, ceilings, lighting,
-  void *lightingdata; // independent of one another
+  // killough 3/7/98: support flat heights drawn at another sector's heights
+  short heightsec;    // other sector, or -1 if no other sector
 
-  // jff 2/26/98 lockout machinery for stairbuilding
-  int stairlock;   // -2 on first locked -1 after thinker done 0 normally
-  int prevsec;     // -1 or number of sector for previous step
-  int nextsec;     // -1 or number of next step sector
+  // killough 4/11/98: support for lightlevels coming from another sector
+  short floorlightsec, ceilinglightsec;
 
-  // killough 3/7/98: support flat heights drawn at another sector's heights
-  int heightsec;    // other sector, or -1 if no other sector
+  short bottommap, midmap, topmap; // killough 4/4/98: dynamic colormaps
 
-  int bottommap, midmap, topmap; // killough 4/4/98: dynamic colormaps
+  int validcount;        // if == validcount, already checked
+  mobj_t *thinglist;     // list of mobjs in sector
 
   // list of mobjs that are at least partially in the sector
   // thinglist is a subset of touching_thinglist
   struct msecnode_s *touching_thinglist;               // phares 3/14/98
 
-  int linecount;
-  struct line_s **lines;
+  // killough 3/7/98: floor and ceiling texture offsets
+  fixed_t   floor_xoffs,   floor_yoffs;
+  fixed_t ceiling_xoffs, ceiling_yoffs;
 
   // killough 10/98: support skies coming from sidedefs. Allows scrolling
   // skies and other effects. No "level info" kind of lump is needed,
@@ -140,19 +130,40 @@ typedef struct
 
   int sky;
 
-  // killough 3/7/98: floor and ceiling texture offsets
-  fixed_t   floor_xoffs,   floor_yoffs;
-  fixed_t ceiling_xoffs, ceiling_yoffs;
+  /* killough 8/28/98: friction is a sector property, not an mobj property.
+   * these fields used to be in mobj_t, but presented performance problems
+   * when processed as mobj properties. Fix is to make them sector properties.
+   */
+  int friction,movefactor;
 
-  // killough 4/11/98: support for lightlevels coming from another sector
-  int floorlightsec, ceilinglightsec;
+  int linecount;
+  struct line_s **lines;
+
+  int blockbox[4];       // mapblock bounding box for height changes
+
+  // thinker_t for reversable actions
+  void *floordata;    // jff 2/22/98 make thinkers on
+  void *ceilingdata;  // floors, ceilings, lighting,
+  void *lightingdata; // independent of one another
 
-  short floorpic;
-  short ceilingpic;
-  short lightlevel;
-  short special;
   short oldspecial;      //jff 2/16/98 remembers if sector WAS secret (automap)
   short tag;
+  int nexttag,firsttag;  // killough 1/30/98: improves searches for tags.
+
+  // jff 2/26/98 lockout machinery for stairbuilding
+  short stairlock;   // -2 on first locked -1 after thinker done 0 normally
+  short prevsec;     // -1 or number of sector for previous step
+  short nextsec;     // -1 or number of next step sector
+
+  short soundtraversed;  // 0 = untraversed, 1,2 = sndlines-1
+  mobj_t *soundtarget;   // thing that made a sound (or null)
+  degenmobj_t soundorg;  // origin for any sounds played by the sector
+
+#ifdef GL_DOOM
+  int iSectorID; // proff 04/05/2000: needed for OpenGL and used in debugmode by the HUD to draw sectornum
+  boolean no_toptextures;
+  boolean no_bottomtextures;
+#endif
 } sector_t;
 
 //
@@ -187,32 +198,37 @@ typedef enum
   ST_NEGATIVE
 } slopetype_t;
 
+enum {                   // cph: line_t r_flags
+  RF_TOP_TILE  = 1,      // Upper texture needs tiling
+  RF_MID_TILE = 2,       // Mid texture needs tiling
+  RF_BOT_TILE = 4,       // Lower texture needs tiling
+  RF_IGNORE   = 8,       // Renderer can skip this line
+  RF_CLOSED   =16,       // Line blocks view
+};
+
+// What sight checks, movement clipping and R_AddLine read comes first.
 typedef struct line_s
 {
-  int iLineID;           // proff 04/05/2000: needed for OpenGL
   vertex_t *v1, *v2;     // Vertices, from v1 to v2.
   fixed_t dx, dy;        // Precalculated v2 - v1 for side checking.
-  unsigned short flags;           // Animation related.
-  short special;
-  short tag;
-  unsigned short sidenum[2];        // Visual appearance: SideDefs.
   fixed_t bbox[4];       // A bounding box, for the linedef's extent
-  slopetype_t slopetype; // To aid move clipping.
+  int validcount;        // if == validcount, already checked
+  unsigned short flags;           // Animation related.
+  unsigned char slopetype; // slopetype_t, to aid move clipping.
+  unsigned char r_flags;   // cph: RF_* flags
   sector_t *frontsector; // Front and back sector.
   sector_t *backsector;
-  int validcount;        // if == validcount, already checked
-  void *specialdata;     // thinker_t for reversable actions
+  int r_validcount;      // cph: if == gametic, r_flags already done
+  unsigned short sidenum[2];        // Visual appearance: SideDefs.
+  short special;
+  short tag;
   int tranlump;          // killough 4/11/98: translucency filter, -1 == none
+  void *specialdata;     // thinker_t for reversable actions
   int firsttag,nexttag;  // killough 4/17/98: improves searches for tags.
-  int r_validcount;      // cph: if == gametic, r_flags already done
-  enum {                 // cph:
-    RF_TOP_TILE  = 1,     // Upper texture needs tiling
-    RF_MID_TILE = 2,     // Mid texture needs tiling
-    RF_BOT_TILE = 4,     // Lower texture needs tiling
-    RF_IGNORE   = 8,     // Renderer can skip this line
-    RF_CLOSED   =16,     // Line blocks view
-  } r_flags;
   degenmobj_t soundorg;  // sound origin for switches/buttons
+#ifdef GL_DOOM
+  int iLineID;           // proff 04/05/2000: needed for OpenGL
+#endif
 } line_t;
 
 
@@ -254,18 +270,20 @@ typedef struct
   side_t* sidedef;
   line_t* linedef;
 
-  int iSegID; // proff 11/05/2000: needed for OpenGL
-  // figgi -- needed for glnodes
-  float     length;
-  boolean   miniseg;
-
-
   // Sector references.
   // Could be retrieved from linedef, too
   // (but that would be slower -- killough)
   // backsector is NULL for one sided lines
 
   sector_t *frontsector, *backsector;
+
+  // figgi -- needed for glnodes
+  boolean   miniseg;
+
+#ifdef GL_DOOM
+  int iSegID; // proff 11/05/2000: needed for OpenGL
+  float     length;
+#endif
 } seg_t;
 
 
@@ -286,11 +304,14 @@ typedef struct subsector_s
 
 //
 // BSP node.
+// Coordinates are in map units, as in the lump, so a node fits in 28
+// bytes instead of 52; shift by FRACBITS to compare with fixed_t.
+// P_LoadNodes lays the nodes out depth first, see there.
 //
 typedef struct
 {
-  fixed_t  x,  y, dx, dy;        // Partition line.
-  fixed_t bbox[2][4];            // Bounding box for each child.
+  short x, y, dx, dy;            // Partition line.
+  short bbox[2][4];              // Bounding box for each child.
   unsigned short children[2];    // If NF_SUBSECTOR its a subsector.
 } node_t;
 
@@ -87,9 +87,12 @@ typedef enum
 
 static int    temp_x = 0;
 static int    tempyl[4], tempyh[4];
-static byte           byte_tempbuf[MAX_SCREENHEIGHT * 4];
-static unsigned short short_tempbuf[MAX_SCREENHEIGHT * 4];
 static unsigned int   int_tempbuf[MAX_SCREENHEIGHT * 4];
+// Only one depth is drawn per frame, so the 8 and 16 bit pipelines share
+// the 32 bit buffer. That also keeps every quad row 32 bit aligned for
+// the word stores in R_FlushQuadColumn.
+#define byte_tempbuf  ((byte *)int_tempbuf)
+#define short_tempbuf ((unsigned short *)int_tempbuf)
 static int    startx = 0;
 static int    temptype = COL_NONE;
 static int    commontop, commonbot;
@@ -120,6 +123,21 @@ static int fuzzoffset[FUZZTABLE];
 
 static int fuzzpos = 0;
 
+// Storage of the draw kernels. A build for one bit depth (RDRAW_ONLY_BITS,
+// see config.h) compiles just the point sampled kernels for that depth;
+// they are small enough to go in IRAM, and r_draw.h calls them directly
+// instead of through the tables.
+#ifdef RDRAW_ONLY_BITS
+#include "esp_attr.h"
+#define RDRAW_HAVE_BITS(bits) (RDRAW_ONLY_BITS == (bits))
+#define RDRAW_KERNEL IRAM_ATTR
+#define RDRAW_FLUSH static IRAM_ATTR
+#else
+#define RDRAW_HAVE_BITS(bits) 1
+#define RDRAW_KERNEL static
+#define RDRAW_FLUSH static
+#endif
+
 // render pipelines
 #define RDC_STANDARD      1
 #define RDC_TRANSLUCENT   2
@@ -207,6 +225,7 @@ void R_ResetColumnBuffer(void)
    R_FlushQuadColumn   = R_QuadFlushError;
 }
 
+#if RDRAW_HAVE_BITS(8)
 #define R_DRAWCOLUMN_PIPELINE RDC_STANDARD
 #define R_DRAWCOLUMN_PIPELINE_BITS 8
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole8
@@ -227,7 +246,9 @@ void R_ResetColumnBuffer(void)
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz8
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz8
 #include "r_drawflush.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(15)
 #define R_DRAWCOLUMN_PIPELINE RDC_STANDARD
 #define R_DRAWCOLUMN_PIPELINE_BITS 15
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole15
@@ -248,7 +269,9 @@ void R_ResetColumnBuffer(void)
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz15
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz15
 #include "r_drawflush.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(16)
 #define R_DRAWCOLUMN_PIPELINE RDC_STANDARD
 #define R_DRAWCOLUMN_PIPELINE_BITS 16
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole16
@@ -269,7 +292,9 @@ void R_ResetColumnBuffer(void)
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz16
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz16
 #include "r_drawflush.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(32)
 #define R_DRAWCOLUMN_PIPELINE RDC_STANDARD
 #define R_DRAWCOLUMN_PIPELINE_BITS 32
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole32
@@ -290,6 +315,7 @@ void R_ResetColumnBuffer(void)
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz32
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz32
 #include "r_drawflush.inl"
+#endif
 
 //
 // R_DrawColumn
@@ -308,33 +334,41 @@ byte *translationtables;
 #define R_DRAWCOLUMN_PIPELINE_TYPE RDC_PIPELINE_STANDARD
 #define R_DRAWCOLUMN_PIPELINE_BASE RDC_STANDARD
 
+#if RDRAW_HAVE_BITS(8)
 #define R_DRAWCOLUMN_PIPELINE_BITS 8
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawColumn8 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole8
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT8
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad8
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(15)
 #define R_DRAWCOLUMN_PIPELINE_BITS 15
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawColumn15 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole15
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT15
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad15
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(16)
 #define R_DRAWCOLUMN_PIPELINE_BITS 16
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawColumn16 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole16
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT16
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad16
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(32)
 #define R_DRAWCOLUMN_PIPELINE_BITS 32
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawColumn32 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole32
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT32
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad32
 #include "r_drawcolpipeline.inl"
+#endif
 
 #undef R_DRAWCOLUMN_PIPELINE_BASE
 #undef R_DRAWCOLUMN_PIPELINE_TYPE
@@ -354,33 +388,41 @@ byte *translationtables;
 #define R_DRAWCOLUMN_PIPELINE_TYPE RDC_PIPELINE_TRANSLUCENT
 #define R_DRAWCOLUMN_PIPELINE_BASE RDC_TRANSLUCENT
 
+#if RDRAW_HAVE_BITS(8)
 #define R_DRAWCOLUMN_PIPELINE_BITS 8
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTLColumn8 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeTL8
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTTL8
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadTL8
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(15)
 #define R_DRAWCOLUMN_PIPELINE_BITS 15
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTLColumn15 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeTL15
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTTL15
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadTL15
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(16)
 #define R_DRAWCOLUMN_PIPELINE_BITS 16
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTLColumn16 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeTL16
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTTL16
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadTL16
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(32)
 #define R_DRAWCOLUMN_PIPELINE_BITS 32
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTLColumn32 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeTL32
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTTL32
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadTL32
 #include "r_drawcolpipeline.inl"
+#endif
 
 #undef R_DRAWCOLUMN_PIPELINE_BASE
 #undef R_DRAWCOLUMN_PIPELINE_TYPE
@@ -398,33 +440,41 @@ byte *translationtables;
 #define R_DRAWCOLUMN_PIPELINE_TYPE RDC_PIPELINE_TRANSLATED
 #define R_DRAWCOLUMN_PIPELINE_BASE RDC_TRANSLATED
 
+#if RDRAW_HAVE_BITS(8)
 #define R_DRAWCOLUMN_PIPELINE_BITS 8
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTranslatedColumn8 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole8
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT8
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad8
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(15)
 #define R_DRAWCOLUMN_PIPELINE_BITS 15
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTranslatedColumn15 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole15
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT15
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad15
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(16)
 #define R_DRAWCOLUMN_PIPELINE_BITS 16
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTranslatedColumn16 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole16
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT16
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad16
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(32)
 #define R_DRAWCOLUMN_PIPELINE_BITS 32
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawTranslatedColumn32 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWhole32
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHT32
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuad32
 #include "r_drawcolpipeline.inl"
+#endif
 
 #undef R_DRAWCOLUMN_PIPELINE_BASE
 #undef R_DRAWCOLUMN_PIPELINE_TYPE
@@ -441,37 +491,76 @@ byte *translationtables;
 #define R_DRAWCOLUMN_PIPELINE_TYPE RDC_PIPELINE_FUZZ
 #define R_DRAWCOLUMN_PIPELINE_BASE RDC_FUZZ
 
+#if RDRAW_HAVE_BITS(8)
 #define R_DRAWCOLUMN_PIPELINE_BITS 8
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawFuzzColumn8 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeFuzz8
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz8
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz8
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(15)
 #define R_DRAWCOLUMN_PIPELINE_BITS 15
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawFuzzColumn15 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeFuzz15
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz15
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz15
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(16)
 #define R_DRAWCOLUMN_PIPELINE_BITS 16
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawFuzzColumn16 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeFuzz16
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz16
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz16
 #include "r_drawcolpipeline.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(32)
 #define R_DRAWCOLUMN_PIPELINE_BITS 32
 #define R_DRAWCOLUMN_FUNCNAME_COMPOSITE(postfix) R_DrawFuzzColumn32 ## postfix
 #define R_FLUSHWHOLE_FUNCNAME R_FlushWholeFuzz32
 #define R_FLUSHHEADTAIL_FUNCNAME R_FlushHTFuzz32
 #define R_FLUSHQUAD_FUNCNAME R_FlushQuadFuzz32
 #include "r_drawcolpipeline.inl"
+#endif
 
 #undef R_DRAWCOLUMN_PIPELINE_BASE
 #undef R_DRAWCOLUMN_PIPELINE_TYPE
 
+#ifdef RDRAW_ONLY_BITS
+#if RDRAW_ONLY_BITS == 8
+const R_DrawColumn_f drawcolumnfuncs_noz[RDC_PIPELINE_MAXPIPELINES] = {
+  R_DrawColumn8_PointUV,
+  R_DrawTLColumn8_PointUV,
+  R_DrawTranslatedColumn8_PointUV,
+  R_DrawFuzzColumn8_PointUV,
+};
+
+const R_DrawColumn_f drawcolumnfuncs_z[RDC_PIPELINE_MAXPIPELINES] = {
+  R_DrawColumn8_PointUV_PointZ,
+  R_DrawTLColumn8_PointUV_PointZ,
+  R_DrawTranslatedColumn8_PointUV_PointZ,
+  R_DrawFuzzColumn8_PointUV_PointZ,
+};
+#elif RDRAW_ONLY_BITS == 16
+const R_DrawColumn_f drawcolumnfuncs_noz[RDC_PIPELINE_MAXPIPELINES] = {
+  R_DrawColumn16_PointUV,
+  R_DrawTLColumn16_PointUV,
+  R_DrawTranslatedColumn16_PointUV,
+  R_DrawFuzzColumn16_PointUV,
+};
+
+const R_DrawColumn_f drawcolumnfuncs_z[RDC_PIPELINE_MAXPIPELINES] = {
+  R_DrawColumn16_PointUV_PointZ,
+  R_DrawTLColumn16_PointUV_PointZ,
+  R_DrawTranslatedColumn16_PointUV_PointZ,
+  R_DrawFuzzColumn16_PointUV_PointZ,
+};
+#endif
+#else
 static R_DrawColumn_f drawcolumnfuncs[VID_MODEMAX][RDRAW_FILTER_MAXFILTERS][RDRAW_FILTER_MAXFILTERS][RDC_PIPELINE_MAXPIPELINES] = {
   {
     {
@@ -672,6 +761,28 @@ R_DrawColumn_f R_GetDrawColumnFunc(enum column_pipeline_e type,
             type, filter, filterz);
   return result;
 }
+#endif // RDRAW_ONLY_BITS
+
+//
+// R_BindDrawFuncs
+//
+// A single depth build has its kernels bound at compile time; make sure
+// the video mode and config file did not ask for anything it can't draw.
+//
+
+void R_BindDrawFuncs(void)
+{
+#ifdef RDRAW_ONLY_BITS
+  if (V_GetNumPixelBits() != RDRAW_ONLY_BITS)
+    I_Error("R_BindDrawFuncs: Renderer built for %d-bit video only (mode %d)",
+            RDRAW_ONLY_BITS, V_GetMode());
+  drawvars.filterwall = RDRAW_FILTER_POINT;
+  drawvars.filterfloor = RDRAW_FILTER_POINT;
+  drawvars.filtersprite = RDRAW_FILTER_POINT;
+  drawvars.filterz = RDRAW_FILTER_POINT;
+  drawvars.filterpatch = RDRAW_FILTER_POINT;
+#endif
+}
 
 void R_SetDefaultDrawColumnVars(draw_column_vars_t *dcvars) {
   dcvars->x = dcvars->yl = dcvars->yh = dcvars->z = 0;
@@ -683,6 +794,53 @@ void R_SetDefaultDrawColumnVars(draw_column_vars_t *dcvars) {
   dcvars->edgetype = drawvars.sprite_edges;
 }
 
+//
+// 16-bit colormaps
+//
+// In 16-bit mode a lit pixel would be looked up twice, in the colormap
+// and then in V_Palette16. colormaps16 holds every colormap already
+// run through the current palette so the kernels do it once. The set
+// is rebuilt by V_SetPalette, which is all a damage or pickup flash
+// costs: 34*256 entries per colormap lump.
+//
+
+#define COLORMAP16_SIZE ((NUMCOLORMAPS+2)*256)
+
+static unsigned short *colormaps16;
+
+void R_UpdateColormaps16(void)
+{
+  int i, j;
+
+  if (!colormaps)
+    return;
+  if (!V_Palette16)
+    V_UpdateTrueColorPalette(VID_MODE16);
+  if (!colormaps16)
+    colormaps16 = malloc(numcolormaps * COLORMAP16_SIZE * sizeof(*colormaps16));
+
+  for (i = 0; i < numcolormaps; i++)
+    {
+      unsigned short *dest = colormaps16 + i*COLORMAP16_SIZE;
+
+      for (j = 0; j < COLORMAP16_SIZE; j++)
+        dest[j] = VID_PAL16(colormaps[i][j], VID_COLORWEIGHTMASK);
+    }
+}
+
+const unsigned short *R_Colormap16(const lighttable_t *colormap)
+{
+  int i;
+
+  if (!colormaps16)
+    R_UpdateColormaps16();
+  for (i = 0; i < numcolormaps; i++)
+    if (colormap >= colormaps[i] && colormap < colormaps[i] + COLORMAP16_SIZE)
+      return colormaps16 + i*COLORMAP16_SIZE + (colormap - colormaps[i]);
+  I_Error("R_Colormap16: Colormap is not in a COLORMAP lump");
+  return NULL;
+}
+
 //
 // R_InitTranslationTables
 // Creates the translation tables to map
@@ -744,11 +902,14 @@ void R_InitTranslationTables (void)
 //  and the inner loop has to step in texture space u and v.
 //
 
+#if RDRAW_HAVE_BITS(8)
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan8_PointUV_PointZ
 #define R_DRAWSPAN_PIPELINE_BITS 8
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD)
 #include "r_drawspan.inl"
+#endif
 
+#ifndef RDRAW_ONLY_BITS
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan8_PointUV_LinearZ
 #define R_DRAWSPAN_PIPELINE_BITS 8
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_DITHERZ)
@@ -773,12 +934,16 @@ void R_InitTranslationTables (void)
 #define R_DRAWSPAN_PIPELINE_BITS 8
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_ROUNDED | RDC_DITHERZ)
 #include "r_drawspan.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(15)
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan15_PointUV_PointZ
 #define R_DRAWSPAN_PIPELINE_BITS 15
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD)
 #include "r_drawspan.inl"
+#endif
 
+#ifndef RDRAW_ONLY_BITS
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan15_PointUV_LinearZ
 #define R_DRAWSPAN_PIPELINE_BITS 15
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_DITHERZ)
@@ -803,12 +968,16 @@ void R_InitTranslationTables (void)
 #define R_DRAWSPAN_PIPELINE_BITS 15
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_ROUNDED | RDC_DITHERZ)
 #include "r_drawspan.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(16)
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan16_PointUV_PointZ
 #define R_DRAWSPAN_PIPELINE_BITS 16
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD)
 #include "r_drawspan.inl"
+#endif
 
+#ifndef RDRAW_ONLY_BITS
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan16_PointUV_LinearZ
 #define R_DRAWSPAN_PIPELINE_BITS 16
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_DITHERZ)
@@ -833,12 +1002,16 @@ void R_InitTranslationTables (void)
 #define R_DRAWSPAN_PIPELINE_BITS 16
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_ROUNDED | RDC_DITHERZ)
 #include "r_drawspan.inl"
+#endif
 
+#if RDRAW_HAVE_BITS(32)
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan32_PointUV_PointZ
 #define R_DRAWSPAN_PIPELINE_BITS 32
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD)
 #include "r_drawspan.inl"
+#endif
 
+#ifndef RDRAW_ONLY_BITS
 #define R_DRAWSPAN_FUNCNAME R_DrawSpan32_PointUV_LinearZ
 #define R_DRAWSPAN_PIPELINE_BITS 32
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_DITHERZ)
@@ -863,7 +1036,9 @@ void R_InitTranslationTables (void)
 #define R_DRAWSPAN_PIPELINE_BITS 32
 #define R_DRAWSPAN_PIPELINE (RDC_STANDARD | RDC_ROUNDED | RDC_DITHERZ)
 #include "r_drawspan.inl"
+#endif
 
+#ifndef RDRAW_ONLY_BITS
 static R_DrawSpan_f drawspanfuncs[VID_MODEMAX][RDRAW_FILTER_MAXFILTERS][RDRAW_FILTER_MAXFILTERS] = {
   {
     {
@@ -983,6 +1158,7 @@ R_DrawSpan_f R_GetDrawSpanFunc(enum draw_filter_type_e filter,
 void R_DrawSpan(draw_span_vars_t *dsvars) {
   R_GetDrawSpanFunc(drawvars.filterfloor, drawvars.filterz)(dsvars);
 }
+#endif // RDRAW_ONLY_BITS
 
 //
 // R_InitBuffer
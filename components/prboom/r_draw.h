@@ -134,16 +134,68 @@ extern byte playernumtotrans[MAXPLAYERS]; // CPhipps - what translation table fo
 extern byte       *translationtables;
 
 typedef void (*R_DrawColumn_f)(draw_column_vars_t *dcvars);
-R_DrawColumn_f R_GetDrawColumnFunc(enum column_pipeline_e type,
-                                   enum draw_filter_type_e filter,
-                                   enum draw_filter_type_e filterz);
 
 // Span blitting for rows, floor/ceiling. No Spectre effect needed.
 typedef void (*R_DrawSpan_f)(draw_span_vars_t *dsvars);
+
+#ifdef RDRAW_ONLY_BITS
+
+// Only the point sampled kernels for one bit depth are built, so there
+// is nothing to look up: the filter is always point and the only choice
+// left is whether the column is lit (filterz != RDRAW_FILTER_NONE).
+#if RDRAW_ONLY_BITS == 8
+void R_DrawColumn8_PointUV(draw_column_vars_t *dcvars);
+void R_DrawTLColumn8_PointUV(draw_column_vars_t *dcvars);
+void R_DrawTranslatedColumn8_PointUV(draw_column_vars_t *dcvars);
+void R_DrawFuzzColumn8_PointUV(draw_column_vars_t *dcvars);
+void R_DrawColumn8_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawTLColumn8_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawTranslatedColumn8_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawFuzzColumn8_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawSpan8_PointUV_PointZ(draw_span_vars_t *dsvars);
+#define R_DrawSpan(dsvars) R_DrawSpan8_PointUV_PointZ(dsvars)
+#elif RDRAW_ONLY_BITS == 16
+void R_DrawColumn16_PointUV(draw_column_vars_t *dcvars);
+void R_DrawTLColumn16_PointUV(draw_column_vars_t *dcvars);
+void R_DrawTranslatedColumn16_PointUV(draw_column_vars_t *dcvars);
+void R_DrawFuzzColumn16_PointUV(draw_column_vars_t *dcvars);
+void R_DrawColumn16_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawTLColumn16_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawTranslatedColumn16_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawFuzzColumn16_PointUV_PointZ(draw_column_vars_t *dcvars);
+void R_DrawSpan16_PointUV_PointZ(draw_span_vars_t *dsvars);
+#define R_DrawSpan(dsvars) R_DrawSpan16_PointUV_PointZ(dsvars)
+#else
+#error RDRAW_ONLY_BITS must be 8 or 16
+#endif
+
+extern const R_DrawColumn_f drawcolumnfuncs_noz[RDC_PIPELINE_MAXPIPELINES];
+extern const R_DrawColumn_f drawcolumnfuncs_z[RDC_PIPELINE_MAXPIPELINES];
+
+#define R_GetDrawColumnFunc(type, filter, filterz) \
+  ((void)(filter), \
+   ((filterz) == RDRAW_FILTER_NONE ? drawcolumnfuncs_noz : drawcolumnfuncs_z)[type])
+
+#else
+
+R_DrawColumn_f R_GetDrawColumnFunc(enum column_pipeline_e type,
+                                   enum draw_filter_type_e filter,
+                                   enum draw_filter_type_e filterz);
 R_DrawSpan_f R_GetDrawSpanFunc(enum draw_filter_type_e filter,
                                enum draw_filter_type_e filterz);
 void R_DrawSpan(draw_span_vars_t *dsvars);
 
+#endif // RDRAW_ONLY_BITS
+
+// Check the video mode and filter settings against the kernels that
+// were built; called whenever the view is set up
+void R_BindDrawFuncs(void);
+
+// 16-bit colormaps with the current palette folded in: the one that
+// corresponds to an 8-bit colormap, and rebuilding them for a new palette
+const unsigned short *R_Colormap16(const lighttable_t *colormap);
+void R_UpdateColormaps16(void);
+
 void R_InitBuffer(int width, int height);
 
 // Initialize color translation tables, for player rendering etc.
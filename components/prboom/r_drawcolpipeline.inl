@@ -9,6 +9,7 @@
 #define R_DRAWCOLUMN_PIPELINE R_DRAWCOLUMN_PIPELINE_BASE
 #include "r_drawcolumn.inl"
 
+#ifndef RDRAW_ONLY_BITS
 // z-dither
 #define R_DRAWCOLUMN_FUNCNAME R_DRAWCOLUMN_FUNCNAME_COMPOSITE(_PointUV_LinearZ)
 #define R_DRAWCOLUMN_PIPELINE (R_DRAWCOLUMN_PIPELINE_BASE | RDC_DITHERZ)
@@ -43,6 +44,7 @@
 #define R_DRAWCOLUMN_FUNCNAME R_DRAWCOLUMN_FUNCNAME_COMPOSITE(_RoundedUV_LinearZ)
 #define R_DRAWCOLUMN_PIPELINE (R_DRAWCOLUMN_PIPELINE_BASE | RDC_ROUNDED | RDC_DITHERZ)
 #include "r_drawcolumn.inl"
+#endif // RDRAW_ONLY_BITS
 
 #undef R_FLUSHWHOLE_FUNCNAME
 #undef R_FLUSHHEADTAIL_FUNCNAME
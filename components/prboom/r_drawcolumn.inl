@@ -32,15 +32,19 @@
 #if (R_DRAWCOLUMN_PIPELINE_BITS == 8)
 #define SCREENTYPE byte
 #define TEMPBUF byte_tempbuf
+#define TOPLEFT byte_topleft
 #elif (R_DRAWCOLUMN_PIPELINE_BITS == 15)
 #define SCREENTYPE unsigned short
 #define TEMPBUF short_tempbuf
+#define TOPLEFT short_topleft
 #elif (R_DRAWCOLUMN_PIPELINE_BITS == 16)
 #define SCREENTYPE unsigned short
 #define TEMPBUF short_tempbuf
+#define TOPLEFT short_topleft
 #elif (R_DRAWCOLUMN_PIPELINE_BITS == 32)
 #define SCREENTYPE unsigned int
 #define TEMPBUF int_tempbuf
+#define TOPLEFT int_topleft
 #endif
 
 #define GETDESTCOLOR8(col) (col)
@@ -64,6 +68,13 @@
   #endif
 #endif
 
+// Lit point sampled 16-bit columns use the colormap with the palette
+// folded in (see R_Colormap16), one lookup per pixel instead of two
+#if (R_DRAWCOLUMN_PIPELINE_BITS == 16) && \
+    !(R_DRAWCOLUMN_PIPELINE & (RDC_NOCOLMAP|RDC_DITHERZ|RDC_BILINEAR|RDC_ROUNDED))
+#define R_DRAWCOLUMN_COLORMAP16
+#endif
+
 #if (R_DRAWCOLUMN_PIPELINE & RDC_BILINEAR)
  #define GETCOL8(frac, nextfrac) GETCOL8_DEPTH(filter_getDitheredForColumn(x,y,frac,nextfrac))
  #define GETCOL15(frac, nextfrac) filter_getFilteredForColumn15(GETCOL8_DEPTH,frac,nextfrac)
@@ -77,7 +88,11 @@
 #else
  #define GETCOL8(frac, nextfrac) GETCOL8_DEPTH(source[(frac)>>FRACBITS])
  #define GETCOL15(frac, nextfrac) VID_PAL15(GETCOL8_DEPTH(source[(frac)>>FRACBITS]), VID_COLORWEIGHTMASK)
- #define GETCOL16(frac, nextfrac) VID_PAL16(GETCOL8_DEPTH(source[(frac)>>FRACBITS]), VID_COLORWEIGHTMASK)
+ #ifdef R_DRAWCOLUMN_COLORMAP16
+  #define GETCOL16(frac, nextfrac) colormap16[GETCOL8_MAPPED(source[(frac)>>FRACBITS])]
+ #else
+  #define GETCOL16(frac, nextfrac) VID_PAL16(GETCOL8_DEPTH(source[(frac)>>FRACBITS]), VID_COLORWEIGHTMASK)
+ #endif
  #define GETCOL32(frac, nextfrac) VID_PAL32(GETCOL8_DEPTH(source[(frac)>>FRACBITS]), VID_COLORWEIGHTMASK)
 #endif
 
@@ -109,7 +124,7 @@
   #define GETDESTCOLOR(col) GETDESTCOLOR32(col)
 #endif
 
-static void R_DRAWCOLUMN_FUNCNAME(draw_column_vars_t *dcvars)
+RDRAW_KERNEL void R_DRAWCOLUMN_FUNCNAME(draw_column_vars_t *dcvars)
 {
   int              count;
   SCREENTYPE       *dest;            // killough
@@ -212,8 +227,11 @@ static void R_DRAWCOLUMN_FUNCNAME(draw_column_vars_t *dcvars)
    // SoM: MAGIC
    {
       // haleyjd: reordered predicates
+      // Quads also break at every 4 pixel boundary of the framebuffer,
+      // so a full quad always flushes with aligned word stores.
       if(temp_x == 4 ||
-         (temp_x && (temptype != COLTYPE || temp_x + startx != dcvars->x)))
+         (temp_x && (temptype != COLTYPE || temp_x + startx != dcvars->x ||
+                     !((size_t)(drawvars.TOPLEFT + dcvars->x) & (4*sizeof(SCREENTYPE)-1)))))
          R_FlushColumns();
 
       if(!temp_x)
@@ -251,6 +269,9 @@ static void R_DRAWCOLUMN_FUNCNAME(draw_column_vars_t *dcvars)
     const byte          *source = dcvars->source;
     const lighttable_t  *colormap = dcvars->colormap;
     const byte          *translation = dcvars->translation;
+#ifdef R_DRAWCOLUMN_COLORMAP16
+    const unsigned short *colormap16 = R_Colormap16(colormap);
+#endif
 #if (R_DRAWCOLUMN_PIPELINE & (RDC_BILINEAR|RDC_ROUNDED|RDC_DITHERZ))
     int y = dcvars->yl;
     const int x = dcvars->x;
@@ -370,8 +391,10 @@ static void R_DRAWCOLUMN_FUNCNAME(draw_column_vars_t *dcvars)
 #undef GETCOL
 #undef INCY
 #undef INCFRAC
+#undef R_DRAWCOLUMN_COLORMAP16
 #undef COLTYPE
 #undef TEMPBUF
+#undef TOPLEFT
 #undef SCREENTYPE
 
 #undef R_DRAWCOLUMN_FUNCNAME
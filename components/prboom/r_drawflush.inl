@@ -96,7 +96,7 @@
 // This is used when a quad flush isn't possible.
 // Opaque version -- no remapping whatsoever.
 //
-static void R_FLUSHWHOLE_FUNCNAME(void)
+RDRAW_FLUSH void R_FLUSHWHOLE_FUNCNAME(void)
 {
    SCREENTYPE *source;
    SCREENTYPE *dest;
@@ -137,7 +137,7 @@ static void R_FLUSHWHOLE_FUNCNAME(void)
 // preparation for a quad flush.
 // Opaque version -- no remapping whatsoever.
 //
-static void R_FLUSHHEADTAIL_FUNCNAME(void)
+RDRAW_FLUSH void R_FLUSHHEADTAIL_FUNCNAME(void)
 {
    SCREENTYPE *source;
    SCREENTYPE *dest;
@@ -208,7 +208,7 @@ static void R_FLUSHHEADTAIL_FUNCNAME(void)
    }
 }
 
-static void R_FLUSHQUAD_FUNCNAME(void)
+RDRAW_FLUSH void R_FLUSHQUAD_FUNCNAME(void)
 {
    SCREENTYPE *source = &TEMPBUF[commontop << 2];
    SCREENTYPE *dest = drawvars.TOPLEFT + commontop*drawvars.PITCH + startx;
@@ -250,7 +250,7 @@ static void R_FLUSHQUAD_FUNCNAME(void)
    }
 #else
   #if (R_DRAWCOLUMN_PIPELINE_BITS == 8)
-   if ((sizeof(int) == 4) && (((int)source % 4) == 0) && (((int)dest % 4) == 0)) {
+   if ((sizeof(int) == 4) && ((((size_t)source | (size_t)dest) & 3) == 0)) {
       while(--count >= 0)
       {
          *(int *)dest = *(int *)source;
@@ -268,6 +268,26 @@ static void R_FLUSHQUAD_FUNCNAME(void)
          dest += drawvars.PITCH * sizeof(byte);
       }
    }
+  #elif (R_DRAWCOLUMN_PIPELINE_BITS == 15) || (R_DRAWCOLUMN_PIPELINE_BITS == 16)
+   if ((sizeof(int) == 4) && ((((size_t)source | (size_t)dest) & 3) == 0)) {
+      while(--count >= 0)
+      {
+         ((unsigned int *)dest)[0] = ((const unsigned int *)source)[0];
+         ((unsigned int *)dest)[1] = ((const unsigned int *)source)[1];
+         source += 4;
+         dest += drawvars.PITCH;
+      }
+   } else {
+      while(--count >= 0)
+      {
+         dest[0] = source[0];
+         dest[1] = source[1];
+         dest[2] = source[2];
+         dest[3] = source[3];
+         source += 4;
+         dest += drawvars.PITCH;
+      }
+   }
   #else
    while(--count >= 0)
    {
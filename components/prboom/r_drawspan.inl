@@ -63,7 +63,13 @@
   #define GETCOL_POINT(col) VID_PAL15(GETDEPTHMAP(col), VID_COLORWEIGHTMASK)
   #define GETCOL_LINEAR(col) filter_getFilteredForSpan15(GETDEPTHMAP, xfrac, yfrac)
 #elif (R_DRAWSPAN_PIPELINE_BITS == 16)
-  #define GETCOL_POINT(col) VID_PAL16(GETDEPTHMAP(col), VID_COLORWEIGHTMASK)
+  #if !(R_DRAWSPAN_PIPELINE & (RDC_DITHERZ|RDC_BILINEAR))
+    // palette folded into the colormap, see R_Colormap16
+    #define R_DRAWSPAN_COLORMAP16
+    #define GETCOL_POINT(col) colormap16[(col)]
+  #else
+    #define GETCOL_POINT(col) VID_PAL16(GETDEPTHMAP(col), VID_COLORWEIGHTMASK)
+  #endif
   #define GETCOL_LINEAR(col) filter_getFilteredForSpan16(GETDEPTHMAP, xfrac, yfrac)
 #elif (R_DRAWSPAN_PIPELINE_BITS == 32)
   #define GETCOL_POINT(col) VID_PAL32(GETDEPTHMAP(col), VID_COLORWEIGHTMASK)
@@ -76,7 +82,7 @@
  #define GETCOL(col) GETCOL_POINT(col)
 #endif
 
-static void R_DRAWSPAN_FUNCNAME(draw_span_vars_t *dsvars)
+RDRAW_KERNEL void R_DRAWSPAN_FUNCNAME(draw_span_vars_t *dsvars)
 {
 #if (R_DRAWSPAN_PIPELINE & (RDC_ROUNDED|RDC_BILINEAR))
   // drop back to point filtering if we're minifying
@@ -97,6 +103,9 @@ static void R_DRAWSPAN_FUNCNAME(draw_span_vars_t *dsvars)
   const fixed_t ystep = dsvars->ystep;
   const byte *source = dsvars->source;
   const byte *colormap = dsvars->colormap;
+#ifdef R_DRAWSPAN_COLORMAP16
+  const unsigned short *colormap16 = R_Colormap16(colormap);
+#endif
   SCREENTYPE *dest = drawvars.TOPLEFT + dsvars->y*drawvars.PITCH + dsvars->x1;
 #if (R_DRAWSPAN_PIPELINE & (RDC_DITHERZ|RDC_BILINEAR))
   const int y = dsvars->y;
@@ -151,6 +160,7 @@ static void R_DRAWSPAN_FUNCNAME(draw_span_vars_t *dsvars)
 #undef GETCOL_LINEAR
 #undef GETCOL_POINT
 #undef GETCOL
+#undef R_DRAWSPAN_COLORMAP16
 #undef PITCH
 #undef TOPLEFT
 #undef SCREENTYPE
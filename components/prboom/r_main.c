@@ -127,18 +127,18 @@ int extralight;                           // bumped light from gun blasts
 PUREFUNC int R_PointOnSide(fixed_t x, fixed_t y, const node_t *node)
 {
   if (!node->dx)
-    return x <= node->x ? node->dy > 0 : node->dy < 0;
+    return x <= node->x<<FRACBITS ? node->dy > 0 : node->dy < 0;
 
   if (!node->dy)
-    return y <= node->y ? node->dx < 0 : node->dx > 0;
+    return y <= node->y<<FRACBITS ? node->dx < 0 : node->dx > 0;
 
-  x -= node->x;
-  y -= node->y;
+  x -= node->x<<FRACBITS;
+  y -= node->y<<FRACBITS;
 
   // Try to quickly decide by looking at sign bits.
   if ((node->dy ^ node->dx ^ x ^ y) < 0)
     return (node->dy ^ x) < 0;  // (left is negative)
-  return FixedMul(y, node->dx>>FRACBITS) >= FixedMul(node->dy>>FRACBITS, x);
+  return FixedMul(y, node->dx) >= FixedMul(node->dy, x);
 }
 
 // killough 5/2/98: reformatted
@@ -396,6 +396,7 @@ void R_ExecuteSetViewSize (void)
 // proff 11/06/98: Added for high-res
   projectiony = ((SCREENHEIGHT * centerx * 320) / 200) / SCREENWIDTH * FRACUNIT;
 
+  R_BindDrawFuncs();
   R_InitBuffer (scaledviewwidth, viewheight);
 
   R_InitTextureMapping();
@@ -437,8 +438,8 @@ void R_Init (void)
   // CPhipps - R_DrawColumn isn't constant anymore, so must
   //  initialise in code
   // current column draw function
-  lprintf(LO_INFO, "\nR_LoadTrigTables: ");
-  R_LoadTrigTables();
+  lprintf(LO_INFO, "\nR_CheckTrigTables: ");
+  R_CheckTrigTables();
   lprintf(LO_INFO, "\nR_InitData: ");
   R_InitData();
   R_SetViewSize(screenblocks);
@@ -532,7 +533,7 @@ int autodetect_hom = 0;       // killough 2/7/98: HOM autodetection flag
 //
 // R_ShowStats
 //
-int rendered_visplanes, rendered_segs, rendered_vissprites;
+int rendered_visplanes, rendered_segs, rendered_vissprites, rendered_wallcols;
 boolean rendering_stats=1;
 
 static void R_ShowStats(void)
@@ -546,9 +547,9 @@ static void R_ShowStats(void)
   {
     doom_printf((V_GetMode() == VID_MODEGL)
                 ?"Frame rate %d fps\nWalls %d, Flats %d, Sprites %d"
-                :"Frame rate %d fps\nSegs %d, Visplanes %d, Sprites %d",
+                :"Frame rate %d fps\nSegs %d, Visplanes %d, Sprites %d\nWall columns %d",
     1000 * FPS_FrameCount / (tick - FPS_SavedTick), rendered_segs,
-    rendered_visplanes, rendered_vissprites);
+    rendered_visplanes, rendered_vissprites, rendered_wallcols);
     FPS_SavedTick = tick;
     FPS_FrameCount = 0;
   }
@@ -561,9 +562,9 @@ static void R_ShowStats(void)
   if (now - showtime > 35) {
     doom_printf((V_GetMode() == VID_MODEGL)
                 ?"Frame rate %d fps\nWalls %d, Flats %d, Sprites %d"
-                :"Frame rate %d fps\nSegs %d, Visplanes %d, Sprites %d",
+                :"Frame rate %d fps\nSegs %d, Visplanes %d, Sprites %d\nWall columns %d",
     (35*KEEPTIMES)/(now - keeptime[0]), rendered_segs,
-    rendered_visplanes, rendered_vissprites);
+    rendered_visplanes, rendered_vissprites, rendered_wallcols);
     showtime = now;
   }
   memmove(keeptime, keeptime+1, sizeof(keeptime[0]) * (KEEPTIMES-1));
@@ -585,7 +586,7 @@ void R_RenderPlayerView (player_t* player)
   R_ClearPlanes ();
   R_ClearSprites ();
 
-  rendered_segs = rendered_visplanes = 0;
+  rendered_segs = rendered_visplanes = rendered_wallcols = 0;
   if (V_GetMode() == VID_MODEGL)
   {
 #ifdef GL_DOOM
@@ -644,6 +645,9 @@ void R_RenderPlayerView (player_t* player)
 #endif
   }
 
+  R_WarmTextureComposites();
+  R_UnpinTextureComposites();
+
   if (rendering_stats) R_ShowStats();
 
   R_RestoreInterpolations();
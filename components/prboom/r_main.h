@@ -65,7 +65,7 @@ extern int      validcount;
 // Rendering stats
 //
 
-extern int rendered_visplanes, rendered_segs, rendered_vissprites;
+extern int rendered_visplanes, rendered_segs, rendered_vissprites, rendered_wallcols;
 extern boolean rendering_stats;
 
 //
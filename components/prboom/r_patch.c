@@ -76,6 +76,27 @@ static rpatch_t *patches = 0;
 
 static rpatch_t *texture_composites = 0;
 
+// Composites pinned for the frame being rendered, see R_PinTextureComposite
+static byte *texture_pinned = 0;
+static int *pinned_list = 0;
+static int numpinned = 0;
+
+// Composite residency, for the texture_cache_kb budget
+typedef struct {
+  unsigned int lastuse;  // composite_clock at the last cache call
+  int size;              // bytes held, 0 if not resident
+} compositeuse_t;
+
+static compositeuse_t *composite_use = 0;
+static unsigned int composite_clock;
+static int composite_resident;
+
+int texture_cache_kb = 2048;
+
+// Per level counters, see R_TrimTextureComposites
+static int composites_built, composites_evicted;
+static int composite_build_ms, composite_peak;
+
 //---------------------------------------------------------------------------
 void R_InitPatches(void) {
   if (!patches)
@@ -89,6 +110,11 @@ void R_InitPatches(void) {
     texture_composites = (rpatch_t*)malloc(numtextures * sizeof(rpatch_t));
     // clear out new patches to signal they're uninitialized
     memset(texture_composites, 0, sizeof(rpatch_t)*numtextures);
+    texture_pinned = calloc(numtextures, sizeof *texture_pinned);
+    pinned_list = malloc(numtextures * sizeof *pinned_list);
+    numpinned = 0;
+    composite_use = calloc(numtextures, sizeof *composite_use);
+    composite_resident = 0;
   }
 }
 
@@ -111,6 +137,14 @@ void R_FlushAllPatches(void) {
         free(texture_composites[i].data);
     free(texture_composites);
     texture_composites = NULL;
+    free(texture_pinned);
+    texture_pinned = NULL;
+    free(pinned_list);
+    pinned_list = NULL;
+    numpinned = 0;
+    free(composite_use);
+    composite_use = NULL;
+    composite_resident = 0;
   }
 }
 
@@ -185,20 +219,63 @@ static int getColumnEdgeSlope(const column_t *prevcolumn, const column_t *nextco
   return 0;
 }
 
+//---------------------------------------------------------------------------
+// Fill the holes in an expanded width*height image, copying the image
+// down and to the right, to eliminate the black halo from bilinear
+// filtering
+//---------------------------------------------------------------------------
+static void fillPatchHoles(unsigned char *image, int width, int height) {
+  int x, y;
+
+  for (x=0; x<width; x++) {
+    unsigned char *column = image + x*height;
+    const unsigned char *prevColumn = x ? column - height : column;
+
+    if (column[0] == 0xff) {
+      // force the first pixel (which is a hole), to use
+      // the color from the next solid spot in the column
+      for (y=0; y<height; y++) {
+        if (column[y] != 0xff) {
+          column[0] = column[y];
+          break;
+        }
+      }
+    }
+
+    // copy from above or to the left
+    for (y=1; y<height; y++) {
+      if (column[y] != 0xff) continue;
+
+      // this pixel is a hole
+
+      if (x && prevColumn[y-1] != 0xff) {
+        // copy the color from the left
+        column[y] = prevColumn[y];
+      }
+      else {
+        // copy the color from above
+        column[y] = column[y-1];
+      }
+    }
+  }
+}
+
 //---------------------------------------------------------------------------
 static void createPatch(int id) {
   rpatch_t *patch;
   const int patchNum = id;
   const patch_t *oldPatch = (const patch_t*)W_CacheLumpNum(patchNum);
   const column_t *oldColumn, *oldPrevColumn, *oldNextColumn;
-  int x, y;
+  int x;
+  int imageSize;
   int pixelDataSize;
   int columnsDataSize;
   int postsDataSize;
   int dataSize;
-  int *numPostsInColumn;
   int numPostsTotal;
-  const unsigned char *oldColumnPixelData;
+  int numPixelsTotal;
+  unsigned char *image;
+  unsigned char *packed;
   int numPostsUsedSoFar;
   int edgeSlope;
 
@@ -215,25 +292,26 @@ static void createPatch(int id) {
   patch->leftoffset = SHORT(oldPatch->leftoffset);
   patch->topoffset = SHORT(oldPatch->topoffset);
   patch->isNotTileable = getPatchIsNotTileable(oldPatch);
+  patch->isPacked = 1;
 
-  // work out how much memory we need to allocate for this patch's data
-  pixelDataSize = (patch->width * patch->height + 4) & ~3;
-  columnsDataSize = sizeof(rcolumn_t) * patch->width;
-
-  // count the number of posts in each column
-  numPostsInColumn = (int*)malloc(sizeof(int) * patch->width);
+  // count the posts, and the pixels they keep with one halo pixel each
   numPostsTotal = 0;
+  numPixelsTotal = 0;
 
   for (x=0; x<patch->width; x++) {
     oldColumn = (const column_t *)((const byte *)oldPatch + LONG(oldPatch->columnofs[x]));
-    numPostsInColumn[x] = 0;
     while (oldColumn->topdelta != 0xff) {
-      numPostsInColumn[x]++;
       numPostsTotal++;
+      numPixelsTotal += oldColumn->length + 1;
       oldColumn = (const column_t *)((const byte *)oldColumn + oldColumn->length + 4);
     }
   }
 
+  // work out how much memory we need to allocate for this patch's data;
+  // the drawers wrap their texture coordinate at the patch height, so
+  // leave that much slack after the last post
+  pixelDataSize = (numPixelsTotal + patch->height + 3) & ~3;
+  columnsDataSize = sizeof(rcolumn_t) * patch->width;
   postsDataSize = numPostsTotal * sizeof(rpost_t);
 
   // allocate our data chunk
@@ -249,9 +327,14 @@ static void createPatch(int id) {
   // sanity check that we've got all the memory allocated we need
   assert((((byte*)patch->posts  + numPostsTotal*sizeof(rpost_t)) - (byte*)patch->data) == dataSize);
 
-  memset(patch->pixels, 0xff, (patch->width*patch->height));
+  // the halo is worked out on the expanded image, which is dropped
+  // once the posts have been packed
+  imageSize = patch->width*patch->height;
+  image = malloc(imageSize + 1);
+  memset(image, 0xff, imageSize);
+  image[imageSize] = 0;
 
-  // fill in the pixels, posts, and columns
+  // fill in the image, posts, and columns
   numPostsUsedSoFar = 0;
   for (x=0; x<patch->width; x++) {
 
@@ -275,81 +358,55 @@ static void createPatch(int id) {
     }
 
     // setup the column's data
-    patch->columns[x].pixels = patch->pixels + (x*patch->height) + 0;
-    patch->columns[x].numPosts = numPostsInColumn[x];
     patch->columns[x].posts = patch->posts + numPostsUsedSoFar;
 
     while (oldColumn->topdelta != 0xff) {
+      rpost_t *post = &patch->posts[numPostsUsedSoFar];
+
       // set up the post's data
-      patch->posts[numPostsUsedSoFar].topdelta = oldColumn->topdelta;
-      patch->posts[numPostsUsedSoFar].length = oldColumn->length;
-      patch->posts[numPostsUsedSoFar].slope = 0;
+      post->topdelta = oldColumn->topdelta;
+      post->length = oldColumn->length;
+      post->slope = 0;
 
       edgeSlope = getColumnEdgeSlope(oldPrevColumn, oldNextColumn, oldColumn->topdelta);
-      if (edgeSlope == 1) patch->posts[numPostsUsedSoFar].slope |= RDRAW_EDGESLOPE_TOP_UP;
-      else if (edgeSlope == -1) patch->posts[numPostsUsedSoFar].slope |= RDRAW_EDGESLOPE_TOP_DOWN;
+      if (edgeSlope == 1) post->slope |= RDRAW_EDGESLOPE_TOP_UP;
+      else if (edgeSlope == -1) post->slope |= RDRAW_EDGESLOPE_TOP_DOWN;
 
       edgeSlope = getColumnEdgeSlope(oldPrevColumn, oldNextColumn, oldColumn->topdelta+oldColumn->length);
-      if (edgeSlope == 1) patch->posts[numPostsUsedSoFar].slope |= RDRAW_EDGESLOPE_BOT_UP;
-      else if (edgeSlope == -1) patch->posts[numPostsUsedSoFar].slope |= RDRAW_EDGESLOPE_BOT_DOWN;
+      if (edgeSlope == 1) post->slope |= RDRAW_EDGESLOPE_BOT_UP;
+      else if (edgeSlope == -1) post->slope |= RDRAW_EDGESLOPE_BOT_DOWN;
 
-      // fill in the post's pixels
-      oldColumnPixelData = (const byte *)oldColumn + 3;
-      for (y=0; y<oldColumn->length; y++) {
-        patch->pixels[x * patch->height + oldColumn->topdelta + y] = oldColumnPixelData[y];
-      }
+      // fill in the post's pixels, clipped to the patch like before
+      memcpy(image + x*patch->height + post->topdelta, (const byte *)oldColumn + 3,
+             MAX(0, MIN(post->length, patch->height - post->topdelta)));
 
       oldColumn = (const column_t *)((const byte *)oldColumn + oldColumn->length + 4);
+      patch->columns[x].numPosts++;
       numPostsUsedSoFar++;
     }
   }
 
-  if (1 || patch->isNotTileable) {
-    const rcolumn_t *column, *prevColumn;
-
-    // copy the patch image down and to the right where there are
-    // holes to eliminate the black halo from bilinear filtering
-    for (x=0; x<patch->width; x++) {
-      //oldColumn = (const column_t *)((const byte *)oldPatch + oldPatch->columnofs[x]);
-
-      column = R_GetPatchColumnClamped(patch, x);
-      prevColumn = R_GetPatchColumnClamped(patch, x-1);
-
-      if (column->pixels[0] == 0xff) {
-        // force the first pixel (which is a hole), to use
-        // the color from the next solid spot in the column
-        for (y=0; y<patch->height; y++) {
-          if (column->pixels[y] != 0xff) {
-            column->pixels[0] = column->pixels[y];
-            break;
-          }
-        }
-      }
+  fillPatchHoles(image, patch->width, patch->height);
 
-      // copy from above or to the left
-      for (y=1; y<patch->height; y++) {
-        //if (getIsSolidAtSpot(oldColumn, y)) continue;
-        if (column->pixels[y] != 0xff) continue;
+  // pack each post's pixels, plus the one after it in the image
+  packed = patch->pixels;
+  for (x=0; x<patch->width; x++) {
+    rcolumn_t *column = &patch->columns[x];
+    int i;
 
-        // this pixel is a hole
+    column->pixels = packed;
+    for (i=0; i<column->numPosts; i++) {
+      rpost_t *post = &column->posts[i];
+      int start = MIN(x*patch->height + post->topdelta, imageSize);
 
-        if (x && prevColumn->pixels[y-1] != 0xff) {
-          // copy the color from the left
-          column->pixels[y] = prevColumn->pixels[y];
-        }
-        else {
-          // copy the color from above
-          column->pixels[y] = column->pixels[y-1];
-        }
-      }
+      post->pixofs = packed - column->pixels;
+      memcpy(packed, image + start, MIN(post->length + 1, imageSize + 1 - start));
+      packed += post->length + 1;
     }
-
-    // verify that the patch truly is non-rectangular since
-    // this determines tiling later on
   }
 
+  free(image);
   W_UnlockLumpNum(patchNum);
-  free(numPostsInColumn);
 }
 
 typedef struct {
@@ -424,6 +481,7 @@ static void createTextureCompositePatch(int id) {
   composite_patch->leftoffset = 0;
   composite_patch->topoffset = 0;
   composite_patch->isNotTileable = 0;
+  composite_patch->isPacked = 0;
 
   // work out how much memory we need to allocate for this patch's data
   pixelDataSize = (composite_patch->width * composite_patch->height + 4) & ~3;
@@ -619,51 +677,20 @@ static void createTextureCompositePatch(int id) {
     }
   }
 
-  if (1 || composite_patch->isNotTileable) {
-    const rcolumn_t *column, *prevColumn;
-
-    // copy the patch image down and to the right where there are
-    // holes to eliminate the black halo from bilinear filtering
-    for (x=0; x<composite_patch->width; x++) {
-      //oldColumn = (const column_t *)((const byte *)oldPatch + oldPatch->columnofs[x]);
-
-      column = R_GetPatchColumnClamped(composite_patch, x);
-      prevColumn = R_GetPatchColumnClamped(composite_patch, x-1);
-
-      if (column->pixels[0] == 0xff) {
-        // force the first pixel (which is a hole), to use
-        // the color from the next solid spot in the column
-        for (y=0; y<composite_patch->height; y++) {
-          if (column->pixels[y] != 0xff) {
-            column->pixels[0] = column->pixels[y];
-            break;
-          }
-        }
-      }
-
-      // copy from above or to the left
-      for (y=1; y<composite_patch->height; y++) {
-        //if (getIsSolidAtSpot(oldColumn, y)) continue;
-        if (column->pixels[y] != 0xff) continue;
-
-        // this pixel is a hole
-
-        if (x && prevColumn->pixels[y-1] != 0xff) {
-          // copy the color from the left
-          column->pixels[y] = prevColumn->pixels[y];
-        }
-        else {
-          // copy the color from above
-          column->pixels[y] = column->pixels[y-1];
-        }
-      }
-    }
+  // composites keep whole columns, so a post's pixels are at its row
+  for (x=0; x<texture->width; x++) {
+    rcolumn_t *column = &composite_patch->columns[x];
 
-    // verify that the patch truly is non-rectangular since
-    // this determines tiling later on
+    for (i=0; i<column->numPosts; i++)
+      column->posts[i].pixofs = column->posts[i].topdelta;
   }
 
+  fillPatchHoles(composite_patch->pixels, composite_patch->width, composite_patch->height);
+
   free(countsInColumn);
+
+  composite_use[id].size = dataSize;
+  composite_resident += dataSize;
 }
 
 //---------------------------------------------------------------------------
@@ -715,6 +742,70 @@ void R_UnlockPatchNum(int id)
     Z_ChangeTag(patches[id].data, PU_CACHE);
 }
 
+//---------------------------------------------------------------------------
+// Composite working set
+//
+// Composites are built the first time the renderer asks for one and
+// dropped to PU_CACHE once unlocked. Left to the zone, they pile up
+// until an allocation fails and then all go at once, so instead the
+// least recently used unlocked ones are freed as soon as the total
+// goes over texture_cache_kb. The zone may still purge one under us,
+// which the scan notices by its data pointer having been cleared.
+//---------------------------------------------------------------------------
+static void R_FreeTextureComposite(int id) {
+  Z_Free(texture_composites[id].data);
+  composite_resident -= composite_use[id].size;
+  composite_use[id].size = 0;
+}
+
+static void R_EvictTextureComposites(int keep) {
+  while (texture_cache_kb && composite_resident > texture_cache_kb*1024) {
+    int i, lru = -1;
+
+    for (i=0; i<numtextures; i++) {
+      if (!texture_composites[i].data) {
+        if (composite_use[i].size) {
+          composite_resident -= composite_use[i].size;
+          composite_use[i].size = 0;
+        }
+        continue;
+      }
+      if (texture_composites[i].locks || i == keep)
+        continue;
+      if (lru < 0 || composite_use[i].lastuse < composite_use[lru].lastuse)
+        lru = i;
+    }
+    if (lru < 0)
+      break;  // all in use this frame, let it grow
+    R_FreeTextureComposite(lru);
+    composites_evicted++;
+  }
+}
+
+void R_TrimTextureComposites(const byte *keep) {
+  int i, count = 0;
+
+  for (i=0; i<numtextures; i++) {
+    if (!texture_composites[i].data) {
+      composite_resident -= composite_use[i].size;
+      composite_use[i].size = 0;
+    } else if (!keep[i] && !texture_composites[i].locks)
+      R_FreeTextureComposite(i);
+    else
+      count++;
+  }
+
+  if (composites_built)
+    lprintf(LO_INFO, "R_TrimTextureComposites: last level built %d composites "
+            "in %dms, peak %dKB, %d evicted\n", composites_built,
+            composite_build_ms, composite_peak/1024, composites_evicted);
+  lprintf(LO_INFO, "R_TrimTextureComposites: %d composites kept, %dKB\n",
+          count, composite_resident/1024);
+
+  composites_built = composites_evicted = composite_build_ms = 0;
+  composite_peak = composite_resident;
+}
+
 //---------------------------------------------------------------------------
 const rpatch_t *R_CacheTextureCompositePatchNum(int id) {
   const int locks = 1;
@@ -727,8 +818,17 @@ const rpatch_t *R_CacheTextureCompositePatchNum(int id) {
     I_Error("createTextureCompositePatch: %i >= numtextures", id);
 #endif
 
-  if (!texture_composites[id].data)
+  if (!texture_composites[id].data) {
+    int starttime = I_GetTime_SaveMS();
+
     createTextureCompositePatch(id);
+    composite_build_ms += I_GetTime_SaveMS() - starttime;
+    composites_built++;
+    R_EvictTextureComposites(id);
+    if (composite_resident > composite_peak)
+      composite_peak = composite_resident;
+  }
+  composite_use[id].lastuse = ++composite_clock;
 
   /* cph - if wasn't locked but now is, tell z_zone to hold it */
   if (!texture_composites[id].locks && locks) {
@@ -765,6 +865,95 @@ void R_UnlockTextureCompositePatchNum(int id)
     Z_ChangeTag(texture_composites[id].data, PU_CACHE);
 }
 
+//---------------------------------------------------------------------------
+// Frame-scoped texture residency
+//
+// The wall renderer used to cache and unlock a composite around every
+// column it drew, each lock count crossing zero costing a Z_ChangeTag.
+// Instead a composite is locked the first time a frame uses it and
+// stays locked until R_UnpinTextureComposites at the end of
+// R_RenderPlayerView, so repeated lookups are a flag test.
+//---------------------------------------------------------------------------
+const rpatch_t *R_PinTextureComposite(int id) {
+  if (!texture_pinned[id]) {
+    R_CacheTextureCompositePatchNum(id);
+    texture_pinned[id] = 1;
+    pinned_list[numpinned++] = id;
+  }
+  return &texture_composites[id];
+}
+
+void R_UnpinTextureComposites(void) {
+  while (numpinned) {
+    int id = pinned_list[--numpinned];
+
+    texture_pinned[id] = 0;
+    R_UnlockTextureCompositePatchNum(id);
+  }
+}
+
+//---------------------------------------------------------------------------
+// Composite warming
+//
+// A composite can't be built off the main thread, the zone isn't
+// thread safe, but most of what a cold one costs is reading its
+// patches off the card. So after each frame, the textures on the lines
+// just drawn that aren't resident - tiers that are shut this frame,
+// the far side of two sided lines - have their patch lumps read ahead
+// by W_PrefetchLumps, for the renderer to pick up when it needs them.
+//---------------------------------------------------------------------------
+int texture_warm = 0;
+
+#define WARM_TEXTURES 16
+#define WARM_LUMPS 64
+
+static int addWarmTexture(int *list, int count, int id) {
+  int i;
+
+  if (!id || count == WARM_TEXTURES)
+    return count;
+  id = texturetranslation[id];
+  if (texture_composites[id].data)
+    return count;
+  for (i=0; i<count; i++)
+    if (list[i] == id)
+      return count;
+  list[count] = id;
+  return count+1;
+}
+
+void R_WarmTextureComposites(void) {
+  int texlist[WARM_TEXTURES], lumplist[WARM_LUMPS];
+  int i, j, numtex = 0, count = 0;
+  const drawseg_t *ds;
+
+  if (!texture_warm || W_PrefetchBusy())
+    return;
+
+  for (ds = drawsegs; ds < ds_p && numtex < WARM_TEXTURES; ds++) {
+    const line_t *line = ds->curline->linedef;
+
+    for (i=0; i<2; i++)
+      if (line->sidenum[i] != NO_INDEX) {
+        const side_t *side = &sides[line->sidenum[i]];
+
+        numtex = addWarmTexture(texlist, numtex, side->toptexture);
+        numtex = addWarmTexture(texlist, numtex, side->midtexture);
+        numtex = addWarmTexture(texlist, numtex, side->bottomtexture);
+      }
+  }
+
+  for (i=0; i<numtex; i++) {
+    const texture_t *texture = textures[texlist[i]];
+
+    for (j=0; j<texture->patchcount && count<WARM_LUMPS; j++)
+      lumplist[count++] = texture->patches[j].patch;
+  }
+
+  // with nothing left to warm this drops what was read ahead last time
+  W_PrefetchLumps(lumplist, count);
+}
+
 //---------------------------------------------------------------------------
 const rcolumn_t *R_GetPatchColumnWrapped(const rpatch_t *patch, int columnIndex) {
   while (columnIndex < 0) columnIndex += patch->width;
@@ -43,9 +43,10 @@ typedef enum {
 } edgeslope_t;
 
 typedef struct {
-  int topdelta;
-  int length;
-  edgeslope_t slope;
+  short topdelta;
+  short length;
+  unsigned short pixofs;  // the post's pixels are at its column's pixels + pixofs
+  unsigned char slope;    // edgeslope_t
 } rpost_t;
 
 typedef struct {
@@ -54,12 +55,20 @@ typedef struct {
   unsigned char *pixels;
 } rcolumn_t;
 
+// Patches from R_CachePatchNum are packed: each column keeps only its
+// posts' pixels, back to back, each post followed by one pixel of the
+// filtering halo so a drawer stepping just past its end reads what it
+// always did. column->pixels + y is only a row of the patch for
+// texture composites, which walls sample at any height; the filtered
+// drawers fall back to the post itself for its neighbours otherwise.
+
 typedef struct {
   int width;
   int height;
   unsigned  widthmask;
     
   unsigned char isNotTileable;
+  unsigned char isPacked;     // posts only, see above
   
   int leftoffset;
   int topoffset;
@@ -88,6 +97,22 @@ void R_UnlockPatchNum(int id);
 const rpatch_t *R_CacheTextureCompositePatchNum(int id);
 void R_UnlockTextureCompositePatchNum(int id);
 
+// Lock a composite until the end of the frame; cheap to call repeatedly
+const rpatch_t *R_PinTextureComposite(int id);
+void R_UnpinTextureComposites(void);
+
+// Composites are freed least recently used first once they take more
+// than texture_cache_kb (0 = no limit). R_TrimTextureComposites frees
+// those not marked in keep[numtextures] and logs the last level's
+// build time and peak residency.
+extern int texture_cache_kb;
+void R_TrimTextureComposites(const byte *keep);
+
+// Read ahead the patches of textures near the frame just drawn that
+// aren't composed yet, on the background task (texture_warm)
+extern int texture_warm;
+void R_WarmTextureComposites(void);
+
 
 // Size query funcs
 int R_NumPatchWidth(int lump) ;
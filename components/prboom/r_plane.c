@@ -218,7 +218,7 @@ void R_ClearPlanes(void)
   lastopening = openings;
 
   // texture calculation
-  memset (cachedheight, 0, MAX_SCREENHEIGHT);
+  memset (cachedheight, 0, MAX_SCREENHEIGHT * sizeof(*cachedheight));
 
   // scale will be unit scale at SCREENWIDTH/2 distance
   basexscale = FixedDiv (viewsin,projection);
@@ -345,6 +345,61 @@ static void R_MakeSpans(int x, unsigned int t1, unsigned int b1,
     spanstart[b2--] = x;
 }
 
+//
+// R_SkyColumn
+//
+// The sky column at a screen x only depends on the view angle, the sky's
+// own offset and flip, and the texture, so the column pointers are kept
+// until one of those changes. For a player who isn't turning that is
+// every frame; sky sidedefs with their own angle simply refill it.
+// Columns are filled as visplanes first need them. The pointers are into
+// the composite's data, which can be purged and rebuilt between frames,
+// so that is part of the key too; a rebuild at the same address lays the
+// texture out the same way.
+//
+
+static struct {
+  const rpatch_t *patch;
+  const unsigned char *data;
+  int      texture;
+  angle_t  an, flip;
+  int      width;
+  unsigned gen;
+  unsigned colgen[MAX_SCREENWIDTH];
+  const byte *source[MAX_SCREENWIDTH];
+} skycache;
+
+static void R_SetSkyCache(const rpatch_t *patch, int texture, angle_t an, angle_t flip)
+{
+  if (skycache.patch != patch || skycache.data != patch->data ||
+      skycache.texture != texture ||
+      skycache.an != an || skycache.flip != flip || skycache.width != viewwidth)
+    {
+      skycache.patch = patch;
+      skycache.data = patch->data;
+      skycache.texture = texture;
+      skycache.an = an;
+      skycache.flip = flip;
+      skycache.width = viewwidth;
+      if (!++skycache.gen)
+        {
+          memset(skycache.colgen, 0, sizeof(skycache.colgen));
+          skycache.gen = 1;
+        }
+    }
+}
+
+static inline const byte *R_SkyColumn(int x)
+{
+  if (skycache.colgen[x] != skycache.gen)
+    {
+      skycache.colgen[x] = skycache.gen;
+      skycache.source[x] = R_GetTextureColumn(skycache.patch,
+        ((skycache.an + xtoviewangle[x])^skycache.flip) >> ANGLETOSKYSHIFT);
+    }
+  return skycache.source[x];
+}
+
 // New function, by Lee Killough
 
 static void IRAM_ATTR R_DoDrawPlane(visplane_t *pl)
@@ -420,12 +475,24 @@ static void IRAM_ATTR R_DoDrawPlane(visplane_t *pl)
       dcvars.iscale = FRACUNIT*200/viewheight;
 
       tex_patch = R_CacheTextureCompositePatchNum(texture);
+      R_SetSkyCache(tex_patch, texture, an, flip);
 
   // killough 10/98: Use sky scrolling offset, and possibly flip picture
+      if (drawvars.filterwall == RDRAW_FILTER_POINT)
+        {
+          // the neighbouring columns are only read when filtering
+          for (x = pl->minx; (dcvars.x = x) <= pl->maxx; x++)
+            if ((dcvars.yl = pl->top[x]) != -1 && dcvars.yl <= (dcvars.yh = pl->bottom[x])) // dropoff overflow
+              {
+                dcvars.source = dcvars.prevsource = dcvars.nextsource = R_SkyColumn(x);
+                colfunc(&dcvars);
+              }
+        }
+      else
         for (x = pl->minx; (dcvars.x = x) <= pl->maxx; x++)
           if ((dcvars.yl = pl->top[x]) != -1 && dcvars.yl <= (dcvars.yh = pl->bottom[x])) // dropoff overflow
             {
-              dcvars.source = R_GetTextureColumn(tex_patch, ((an + xtoviewangle[x])^flip) >> ANGLETOSKYSHIFT);
+              dcvars.source = R_SkyColumn(x);
               dcvars.prevsource = R_GetTextureColumn(tex_patch, ((an + xtoviewangle[x-1])^flip) >> ANGLETOSKYSHIFT);
               dcvars.nextsource = R_GetTextureColumn(tex_patch, ((an + xtoviewangle[x+1])^flip) >> ANGLETOSKYSHIFT);
               colfunc(&dcvars);
@@ -469,11 +536,45 @@ static void IRAM_ATTR R_DoDrawPlane(visplane_t *pl)
 // At the end of each frame.
 //
 
+// Visplanes are drawn sorted by flat, so that each flat is fetched into
+// the cache once per frame instead of once per plane, and by height
+// within a flat, so that consecutive planes find their rows in the
+// R_MapPlane cache. Visplanes never overlap, so the order doesn't
+// change the picture.
+
+static visplane_t **sortedplanes;
+static int maxsortedplanes;
+
+static int R_ComparePlanes(const void *a, const void *b)
+{
+  const visplane_t *pa = *(const visplane_t *const *)a;
+  const visplane_t *pb = *(const visplane_t *const *)b;
+
+  if (pa->picnum != pb->picnum)
+    return pa->picnum < pb->picnum ? -1 : 1;
+  if (pa->height != pb->height)
+    return pa->height < pb->height ? -1 : 1;
+  return pa->lightlevel - pb->lightlevel;
+}
+
 void R_DrawPlanes (void)
 {
   visplane_t *pl;
-  int i;
+  int i, numplanes = 0;
+
   for (i=0;i<MAXVISPLANES;i++)
-    for (pl=visplanes[i]; pl; pl=pl->next, rendered_visplanes++)
-      R_DoDrawPlane(pl);
+    for (pl=visplanes[i]; pl; pl=pl->next)
+      {
+        if (numplanes == maxsortedplanes)
+          {
+            maxsortedplanes = maxsortedplanes ? maxsortedplanes*2 : 128;
+            sortedplanes = realloc(sortedplanes, maxsortedplanes * sizeof(*sortedplanes));
+          }
+        sortedplanes[numplanes++] = pl;
+      }
+
+  qsort(sortedplanes, numplanes, sizeof(*sortedplanes), R_ComparePlanes);
+
+  for (i=0;i<numplanes;i++, rendered_visplanes++)
+    R_DoDrawPlane(sortedplanes[i]);
 }
@@ -58,6 +58,8 @@ static boolean  maskedtexture;
 static int      toptexture;
 static int      bottomtexture;
 static int      midtexture;
+// Composites for the tiers, resolved once per seg (see R_PinTextureComposite)
+static const rpatch_t *toptexpatch, *bottomtexpatch, *midtexpatch;
 
 static fixed_t  toptexheight, midtexheight, bottomtexheight; // cph
 
@@ -78,6 +80,7 @@ static fixed_t  rw_midtexturemid;
 static fixed_t  rw_toptexturemid;
 static fixed_t  rw_bottomtexturemid;
 static int      rw_lightlevel;
+static int      rw_lightbase, rw_nextlightbase; // R_LightBase of the above and +1
 static int      worldtop;
 static int      worldbottom;
 static int      worldhigh;
@@ -125,6 +128,7 @@ void IRAM_ATTR R_RenderMaskedSegRange(drawseg_t *ds, int x1, int x2)
   R_DrawColumn_f colfunc;
   draw_column_vars_t dcvars;
   angle_t angle;
+  int light;
 
   R_SetDefaultDrawColumnVars(&dcvars);
 
@@ -156,6 +160,8 @@ void IRAM_ATTR R_RenderMaskedSegRange(drawseg_t *ds, int x1, int x2)
 
   // killough 4/13/98: get correct lightlevel for 2s normal textures
   rw_lightlevel = R_FakeFlat(frontsector, &tempsec, NULL, NULL, false) ->lightlevel;
+  rw_lightbase = R_LightBase(rw_lightlevel);
+  rw_nextlightbase = R_LightBase(rw_lightlevel+1);
 
   maskedtexturecol = ds->maskedtexturecol;
 
@@ -199,8 +205,9 @@ void IRAM_ATTR R_RenderMaskedSegRange(drawseg_t *ds, int x1, int x2)
 
         if (!fixedcolormap)
           dcvars.z = spryscale; // for filtering -- POPE
-        dcvars.colormap = R_ColourMap(rw_lightlevel,spryscale);
-        dcvars.nextcolormap = R_ColourMap(rw_lightlevel+1,spryscale); // for filtering -- POPE
+        light = R_ScaleLight(spryscale);
+        dcvars.colormap = R_LightColourMap(rw_lightbase - light);
+        dcvars.nextcolormap = R_LightColourMap(rw_nextlightbase - light); // for filtering -- POPE
 
         // killough 3/2/98:
         //
@@ -266,14 +273,16 @@ static int didsolidcol; /* True if at least one column was marked solid */
 
 static void IRAM_ATTR R_RenderSegLoop (void)
 {
-  const rpatch_t *tex_patch;
   R_DrawColumn_f colfunc = R_GetDrawColumnFunc(RDC_PIPELINE_STANDARD, drawvars.filterwall, drawvars.filterz);
   draw_column_vars_t dcvars;
   fixed_t  texturecolumn = 0;   // shut up compiler warning
+  fixed_t  lastscale = 0;       // never a valid scale
+  int      light, lastlight = INT_MIN;
 
   R_SetDefaultDrawColumnVars(&dcvars);
 
   rendered_segs++;
+  rendered_wallcols += rw_stopx - rw_x;
   for ( ; rw_x < rw_stopx ; rw_x++)
     {
 
@@ -336,12 +345,23 @@ static void IRAM_ATTR R_RenderSegLoop (void)
           dcvars.texu = texturecolumn; // for filtering -- POPE
           texturecolumn >>= FRACBITS;
 
-          dcvars.colormap = R_ColourMap(rw_lightlevel,rw_scale);
-          dcvars.nextcolormap = R_ColourMap(rw_lightlevel+1,rw_scale); // for filtering -- POPE
+          // The light changes with the scale only every few columns,
+          // and the scale not at all on walls parallel to the view plane
+          light = R_ScaleLight(rw_scale);
+          if (light != lastlight)
+            {
+              lastlight = light;
+              dcvars.colormap = R_LightColourMap(rw_lightbase - light);
+              dcvars.nextcolormap = R_LightColourMap(rw_nextlightbase - light); // for filtering -- POPE
+            }
           dcvars.z = rw_scale; // for filtering -- POPE
 
           dcvars.x = rw_x;
-          dcvars.iscale = 0xffffffffu / (unsigned)rw_scale;
+          if (rw_scale != lastscale)
+            {
+              lastscale = rw_scale;
+              dcvars.iscale = 0xffffffffu / (unsigned)rw_scale;
+            }
         }
 
       // draw the wall tiers
@@ -351,14 +371,11 @@ static void IRAM_ATTR R_RenderSegLoop (void)
           dcvars.yl = yl;     // single sided line
           dcvars.yh = yh;
           dcvars.texturemid = rw_midtexturemid;
-          tex_patch = R_CacheTextureCompositePatchNum(midtexture);
-          dcvars.source = R_GetTextureColumn(tex_patch, texturecolumn);
-          dcvars.prevsource = R_GetTextureColumn(tex_patch, texturecolumn-1);
-          dcvars.nextsource = R_GetTextureColumn(tex_patch, texturecolumn+1);
+          dcvars.source = R_GetTextureColumn(midtexpatch, texturecolumn);
+          dcvars.prevsource = R_GetTextureColumn(midtexpatch, texturecolumn-1);
+          dcvars.nextsource = R_GetTextureColumn(midtexpatch, texturecolumn+1);
           dcvars.texheight = midtexheight;
           colfunc (&dcvars);
-          R_UnlockTextureCompositePatchNum(midtexture);
-          tex_patch = NULL;
           ceilingclip[rw_x] = viewheight;
           floorclip[rw_x] = -1;
         }
@@ -380,14 +397,11 @@ static void IRAM_ATTR R_RenderSegLoop (void)
                   dcvars.yl = yl;
                   dcvars.yh = mid;
                   dcvars.texturemid = rw_toptexturemid;
-                  tex_patch = R_CacheTextureCompositePatchNum(toptexture);
-                  dcvars.source = R_GetTextureColumn(tex_patch,texturecolumn);
-                  dcvars.prevsource = R_GetTextureColumn(tex_patch,texturecolumn-1);
-                  dcvars.nextsource = R_GetTextureColumn(tex_patch,texturecolumn+1);
+                  dcvars.source = R_GetTextureColumn(toptexpatch, texturecolumn);
+                  dcvars.prevsource = R_GetTextureColumn(toptexpatch, texturecolumn-1);
+                  dcvars.nextsource = R_GetTextureColumn(toptexpatch, texturecolumn+1);
                   dcvars.texheight = toptexheight;
                   colfunc (&dcvars);
-                  R_UnlockTextureCompositePatchNum(toptexture);
-                  tex_patch = NULL;
                   ceilingclip[rw_x] = mid;
                 }
               else
@@ -414,14 +428,11 @@ static void IRAM_ATTR R_RenderSegLoop (void)
                   dcvars.yl = mid;
                   dcvars.yh = yh;
                   dcvars.texturemid = rw_bottomtexturemid;
-                  tex_patch = R_CacheTextureCompositePatchNum(bottomtexture);
-                  dcvars.source = R_GetTextureColumn(tex_patch, texturecolumn);
-                  dcvars.prevsource = R_GetTextureColumn(tex_patch, texturecolumn-1);
-                  dcvars.nextsource = R_GetTextureColumn(tex_patch, texturecolumn+1);
+                  dcvars.source = R_GetTextureColumn(bottomtexpatch, texturecolumn);
+                  dcvars.prevsource = R_GetTextureColumn(bottomtexpatch, texturecolumn-1);
+                  dcvars.nextsource = R_GetTextureColumn(bottomtexpatch, texturecolumn+1);
                   dcvars.texheight = bottomtexheight;
                   colfunc (&dcvars);
-                  R_UnlockTextureCompositePatchNum(bottomtexture);
-                  tex_patch = NULL;
                   floorclip[rw_x] = mid;
                 }
               else
@@ -742,6 +753,8 @@ void R_StoreWallRange(const int start, const int stop)
       rw_centerangle = ANG90 + viewangle - rw_normalangle;
 
       rw_lightlevel = frontsector->lightlevel;
+      rw_lightbase = R_LightBase(rw_lightlevel);
+      rw_nextlightbase = R_LightBase(rw_lightlevel+1);
     }
 
   // Remember the vars used to determine fractional U texture
@@ -814,6 +827,13 @@ void R_StoreWallRange(const int start, const int stop)
       markfloor = 0;
   }
 
+  if (midtexture)
+    midtexpatch = R_PinTextureComposite(midtexture);
+  if (toptexture)
+    toptexpatch = R_PinTextureComposite(toptexture);
+  if (bottomtexture)
+    bottomtexpatch = R_PinTextureComposite(bottomtexture);
+
   didsolidcol = 0;
   R_RenderSegLoop();
 
@@ -263,7 +263,16 @@ static void R_InitSpriteDefs(const char * const * namelist)
 //
 
 static vissprite_t *vissprites, **vissprite_ptrs;  // killough
-static size_t num_vissprite, num_vissprite_alloc, num_vissprite_ptrs;
+static size_t num_vissprite, num_vissprite_alloc;
+
+// Sort keys for R_SortVisSprites, twice num_vissprite_alloc long: the
+// merge and radix sorts ping-pong between the two halves
+typedef struct {
+  unsigned int key;   // scale, mapped so that ascending key is descending scale
+  unsigned int index; // into vissprites
+} vissort_t;
+
+static vissort_t *vissprite_sort;
 
 //
 // R_InitSprites
@@ -301,6 +310,8 @@ static vissprite_t *R_NewVisSprite(void)
       num_vissprite_alloc = num_vissprite_alloc ? num_vissprite_alloc*2 : 128;
       lprintf(LO_DEBUG, "R_NewVisSprite: reallocing vissprites array to %d\n", num_vissprite_alloc);
       vissprites = realloc(vissprites,num_vissprite_alloc*sizeof(*vissprites));
+      vissprite_ptrs = realloc(vissprite_ptrs,num_vissprite_alloc*sizeof(*vissprite_ptrs));
+      vissprite_sort = realloc(vissprite_sort,2*num_vissprite_alloc*sizeof(*vissprite_sort));
 
       //e6y: set all fields to zero
       memset(vissprites + num_vissprite_alloc_prev, 0,
@@ -355,9 +366,13 @@ void R_DrawMaskedColumn(
       // killough 3/2/98, 3/27/98: Failsafe against overflow/crash:
       if (dcvars->yl <= dcvars->yh && dcvars->yh < viewheight)
         {
-          dcvars->source = column->pixels + post->topdelta;
-          dcvars->prevsource = prevcolumn->pixels + post->topdelta;
-          dcvars->nextsource = nextcolumn->pixels + post->topdelta;
+          dcvars->source = column->pixels + post->pixofs;
+          if (patch->isPacked)
+            dcvars->prevsource = dcvars->nextsource = dcvars->source;
+          else {
+            dcvars->prevsource = prevcolumn->pixels + post->topdelta;
+            dcvars->nextsource = nextcolumn->pixels + post->topdelta;
+          }
 
           dcvars->texturemid = basetexturemid - (post->topdelta<<FRACBITS);
 
@@ -425,14 +440,18 @@ static void R_DrawVisSprite(vissprite_t *vis, int x1, int x2)
 // proff 11/06/98: Changed for high-res
   dcvars.iscale = FixedDiv (FRACUNIT, vis->scale);
   dcvars.texturemid = vis->texturemid;
-  frac = vis->startfrac;
+  frac = vis->startfrac + (x1 - vis->x1) * vis->xiscale;
   if (filter == RDRAW_FILTER_LINEAR)
     frac -= (FRACUNIT>>1);
   spryscale = vis->scale;
   sprtopscreen = centeryfrac - FixedMul(dcvars.texturemid,spryscale);
 
-  for (dcvars.x=vis->x1 ; dcvars.x<=vis->x2 ; dcvars.x++, frac += vis->xiscale)
+  for (dcvars.x=x1 ; dcvars.x<=x2 ; dcvars.x++, frac += vis->xiscale)
     {
+      // nothing of the column is left between the clips
+      if (mceilingclip[dcvars.x] >= mfloorclip[dcvars.x] - 1)
+        continue;
+
       texturecolumn = frac>>FRACBITS;
       dcvars.texu = frac;
 
@@ -453,7 +472,7 @@ static void R_DrawVisSprite(vissprite_t *vis, int x1, int x2)
 // Generates a vissprite for a thing if it might be visible.
 //
 
-static void R_ProjectSprite (mobj_t* thing, int lightlevel)
+static void R_ProjectSprite (mobj_t* thing, int lightbase)
 {
   fixed_t   gzt;               // killough 3/27/98
   fixed_t   tx;
@@ -651,7 +670,7 @@ static void R_ProjectSprite (mobj_t* thing, int lightlevel)
     vis->colormap = fullcolormap;     // full bright  // killough 3/20/98
   else
     {      // diminished light
-      vis->colormap = R_ColourMap(lightlevel,xscale);
+      vis->colormap = R_LightColourMap(lightbase - R_ScaleLight(xscale));
     }
 }
 
@@ -664,6 +683,7 @@ void R_AddSprites(subsector_t* subsec, int lightlevel)
 {
   sector_t* sec=subsec->sector;
   mobj_t *thing;
+  int lightbase;
 
   // BSP is traversed by subsector.
   // A sector might have been split into several
@@ -677,9 +697,11 @@ void R_AddSprites(subsector_t* subsec, int lightlevel)
   sec->validcount = validcount;
 
   // Handle all things in sector.
+  // They share the light level, only their scale differs.
 
+  lightbase = R_LightBase(lightlevel);
   for (thing = sec->thinglist; thing; thing = thing->snext)
-    R_ProjectSprite(thing, lightlevel);
+    R_ProjectSprite(thing, lightbase);
 }
 
 //
@@ -836,81 +858,200 @@ void R_DrawPlayerSprites(void)
 // Rewritten by Lee Killough to avoid using unnecessary
 // linked lists, and to use faster sorting algorithm.
 //
+// Sorts vissprite_ptrs nearest (largest scale) first. The sort is stable,
+// sprites at the same scale stay in the order they were projected in.
+// The sprites come out of the BSP roughly in order already, so an
+// insertion sort usually finishes the job. If it needs too many moves,
+// a merge sort takes over, or for a lot of sprites an LSD radix sort on
+// the scale, one byte per pass, skipping passes where every key has the
+// same byte.
+// Nothing is allocated here, R_NewVisSprite grows the arrays.
+//
 
-#ifdef DJGPP
-
-// killough 9/22/98: inlined memcpy of pointer arrays
-// CPhipps - added memory as modified
-#define bcopyp(d, s, n) asm(" cld; rep; movsl;" :: "D"(d), "S"(s), "c"(n) : "%cc", "%esi", "%edi", "%ecx", "memory")
+// Insertion sort moves allowed, per sprite and in total on top of that,
+// before one of the others is the cheaper option
+#define VISSPRITE_INSERTMOVES 4
+#define VISSPRITE_INSERTBASE  64
 
-#else
+// The radix sort clears and sums its histograms however few sprites
+// there are; below this many, merging is faster. The merge starts from
+// runs this long, insertion sorted.
+#define VISSPRITE_RADIXMIN    256
+#define VISSPRITE_MERGERUN    16
 
-#define bcopyp(d, s, n) memcpy(d, s, (n) * sizeof(void *))
+// Insertion sorts s until done or out of moves; returns how far it got.
+// Stopping part way still leaves equal keys in order.
+static size_t R_InsertVisSprites(vissort_t *s, size_t n, long moves)
+{
+  size_t i;
 
-#endif
+  for (i = 1; i < n && moves > 0; i++)
+    if (s[i-1].key > s[i].key)
+      {
+        vissort_t temp = s[i];
+        size_t j = i;
 
-// killough 9/2/98: merge sort
+        do
+          {
+            s[j] = s[j-1];
+            j--;
+            moves--;
+          }
+        while (j && s[j-1].key > temp.key);
+        s[j] = temp;
+      }
+  return i;
+}
 
-static void msort(vissprite_t **s, vissprite_t **t, int n)
+void R_SortVisSprites (void)
 {
-  if (n >= 16)
+  vissort_t *src = vissprite_sort, *dst = vissprite_sort + num_vissprite_alloc;
+  size_t n = num_vissprite, i, sorted;
+
+  if (!n)
+    return;
+
+  for (i = 0; i < n; i++)
     {
-      int n1 = n/2, n2 = n - n1;
-      vissprite_t **s1 = s, **s2 = s + n1, **d = t;
+      src[i].key = ~((unsigned int)vissprites[i].scale ^ 0x80000000u);
+      src[i].index = i;
+    }
 
-      msort(s1, t, n1);
-      msort(s2, t, n2);
+  sorted = R_InsertVisSprites(src, n, (long)n * VISSPRITE_INSERTMOVES + VISSPRITE_INSERTBASE);
 
-      while ((*s1)->scale > (*s2)->scale ?
-             (*d++ = *s1++, --n1) : (*d++ = *s2++, --n2));
+  if (sorted < n && n < VISSPRITE_RADIXMIN)
+    {
+      size_t width, run;
 
-      if (n2)
-        bcopyp(d, s2, n2);
-      else
-        bcopyp(d, s1, n1);
+      for (run = 0; run < n; run += VISSPRITE_MERGERUN)
+        R_InsertVisSprites(src + run, n - run < VISSPRITE_MERGERUN ?
+                           n - run : VISSPRITE_MERGERUN,
+                           VISSPRITE_MERGERUN * VISSPRITE_MERGERUN);
+
+      // Merge pairs of runs into the other half, ties from the left;
+      // pairs already in order, as BSP order mostly is, are just copied
+      for (width = VISSPRITE_MERGERUN; width < n; width *= 2)
+        {
+          vissort_t *swap;
 
-      bcopyp(s, t, n);
+          for (run = 0; run < n; run += 2*width)
+            {
+              vissort_t *a = src + run, *b = run + width < n ? a + width : src + n;
+              vissort_t *aend = b, *bend = run + 2*width < n ? b + width : src + n;
+              vissort_t *d = dst + run;
+
+              if (b < bend && aend[-1].key > b->key)
+                while (a < aend && b < bend)
+                  *d++ = b->key < a->key ? *b++ : *a++;
+              memcpy(d, a, (aend - a) * sizeof *d);
+              d += aend - a;
+              memcpy(d, b, (bend - b) * sizeof *d);
+            }
+
+          swap = src;
+          src = dst;
+          dst = swap;
+        }
     }
-  else
+  else if (sorted < n)
     {
-      int i;
-      for (i = 1; i < n; i++)
+      unsigned int count[4][256];
+      int pass, b;
+
+      memset(count, 0, sizeof count);
+      for (i = 0; i < n; i++)
+        for (pass = 0; pass < 4; pass++)
+          count[pass][(src[i].key >> 8*pass) & 255]++;
+
+      for (pass = 0; pass < 4; pass++)
         {
-          vissprite_t *temp = s[i];
-          if (s[i-1]->scale < temp->scale)
+          unsigned int *c = count[pass], sum = 0;
+          int shift = 8*pass;
+          vissort_t *swap;
+
+          if (c[(src[0].key >> shift) & 255] == n)
+            continue;
+
+          for (b = 0; b < 256; b++)
             {
-              int j = i;
-              while ((s[j] = s[j-1])->scale < temp->scale && --j);
-              s[j] = temp;
+              unsigned int t = c[b];
+              c[b] = sum;
+              sum += t;
             }
+
+          for (i = 0; i < n; i++)
+            dst[c[(src[i].key >> shift) & 255]++] = src[i];
+
+          swap = src;
+          src = dst;
+          dst = swap;
         }
     }
+
+  for (i = 0; i < n; i++)
+    vissprite_ptrs[i] = vissprites + src[i].index;
 }
 
-void R_SortVisSprites (void)
+//
+// Drawseg index for sprite clipping
+//
+// R_DrawSprite used to scan every drawseg for every sprite. Only drawsegs
+// with a silhouette or a masked mid texture matter, and only those that
+// overlap the sprite. They are indexed once per frame in DS_LEVELS levels
+// of screen column bins, 1, 4, 16... bins across the view; each bin lists
+// the drawsegs overlapping it in their original order. A sprite scans the
+// bin of the finest level that holds it whole, so it sees exactly the
+// drawsegs the full scan would have acted on, in the same order.
+//
+
+#define DS_LEVELS 3
+
+typedef struct {
+  int binwidth;
+  int start[(1 << 2*(DS_LEVELS-1)) + 1];  // bin b is segs[start[b]..start[b+1]-1]
+  drawseg_t **segs;
+  int maxsegs;
+} dsindex_t;
+
+static dsindex_t dsindex[DS_LEVELS];
+
+static void R_IndexDrawSegs(void)
 {
-  if (num_vissprite)
+  int level;
+
+  for (level = 0; level < DS_LEVELS; level++)
     {
-      int i = num_vissprite;
+      dsindex_t *index = &dsindex[level];
+      int nbins = 1 << 2*level, b, total = 0;
+      int fill[(1 << 2*(DS_LEVELS-1))];
+      drawseg_t *ds;
 
-      // If we need to allocate more pointers for the vissprites,
-      // allocate as many as were allocated for sprites -- killough
-      // killough 9/22/98: allocate twice as many
+      index->binwidth = (viewwidth + nbins - 1) / nbins;
+      memset(fill, 0, sizeof fill);
 
-      if (num_vissprite_ptrs < num_vissprite*2)
+      for (ds = drawsegs; ds < ds_p; ds++)
+        if (ds->silhouette || ds->maskedtexturecol)
+          for (b = ds->x1 / index->binwidth; b <= ds->x2 / index->binwidth; b++)
+            fill[b]++;
+
+      for (b = 0; b < nbins; b++)
         {
-          free(vissprite_ptrs);  // better than realloc -- no preserving needed
-          vissprite_ptrs = malloc((num_vissprite_ptrs = num_vissprite_alloc*2)
-                                  * sizeof *vissprite_ptrs);
+          index->start[b] = total;
+          total += fill[b];
+          fill[b] = index->start[b];
         }
+      index->start[nbins] = total;
 
-      while (--i>=0)
-        vissprite_ptrs[i] = vissprites+i;
-
-      // killough 9/22/98: replace qsort with merge sort, since the keys
-      // are roughly in order to begin with, due to BSP rendering.
+      if (total > index->maxsegs)
+        {
+          index->maxsegs = total * 2;
+          index->segs = realloc(index->segs, index->maxsegs * sizeof(*index->segs));
+        }
 
-      msort(vissprite_ptrs, vissprite_ptrs + num_vissprite, num_vissprite);
+      for (ds = drawsegs; ds < ds_p; ds++)
+        if (ds->silhouette || ds->maskedtexturecol)
+          for (b = ds->x1 / index->binwidth; b <= ds->x2 / index->binwidth; b++)
+            index->segs[fill[b]++] = ds;
     }
 }
 
@@ -920,7 +1061,7 @@ void R_SortVisSprites (void)
 
 static void R_DrawSprite (vissprite_t* spr)
 {
-  drawseg_t *ds;
+  drawseg_t **segs, **seg;
   int     clipbot[MAX_SCREENWIDTH]; // killough 2/8/98: // dropoff overflow
   int     cliptop[MAX_SCREENWIDTH]; // change to MAX_*  // dropoff overflow
   int     x;
@@ -928,23 +1069,27 @@ static void R_DrawSprite (vissprite_t* spr)
   int     r2;
   fixed_t scale;
   fixed_t lowscale;
+  int     level, bin;
 
   for (x = spr->x1 ; x<=spr->x2 ; x++)
     clipbot[x] = cliptop[x] = -2;
 
+  // Find the smallest bin holding the whole sprite
+  for (level = DS_LEVELS-1; level > 0; level--)
+    if (spr->x1 / dsindex[level].binwidth == spr->x2 / dsindex[level].binwidth)
+      break;
+  bin = spr->x1 / dsindex[level].binwidth;
+  segs = dsindex[level].segs + dsindex[level].start[bin];
+  seg = dsindex[level].segs + dsindex[level].start[bin+1];
+
   // Scan drawsegs from end to start for obscuring segs.
   // The first drawseg that has a greater scale is the clip seg.
 
-  // Modified by Lee Killough:
-  // (pointer check was originally nonportable
-  // and buggy, by going past LEFT end of array):
-
-  //    for (ds=ds_p-1 ; ds >= drawsegs ; ds--)    old buggy code
-
-  for (ds=ds_p ; ds-- > drawsegs ; )  // new -- killough
+  while (seg-- > segs)
     {      // determine if the drawseg obscures the sprite
-      if (ds->x1 > spr->x2 || ds->x2 < spr->x1 ||
-          (!ds->silhouette && !ds->maskedtexturecol))
+      drawseg_t *ds = *seg;
+
+      if (ds->x1 > spr->x2 || ds->x2 < spr->x1)
         continue;      // does not cover sprite
 
       r1 = ds->x1 < spr->x1 ? spr->x1 : ds->x1;
@@ -1052,6 +1197,7 @@ void R_DrawMasked(void)
   drawseg_t *ds;
 
   R_SortVisSprites();
+  R_IndexDrawSegs();
 
   // draw all vissprites back to front
 
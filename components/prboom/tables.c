@@ -45,18 +45,17 @@
  *-----------------------------------------------------------------------------
  */
 
-#ifdef HAVE_CONFIG_H
 #include "config.h"
-#endif
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
-#include "w_wad.h"
+#include <string.h>
 #include "tables.h"
-
-#include "SINETABL.h"
-#include "TANGTABL.h"
-#include "TANTOANG.h"
+#include "md5.h"
+#include "m_swap.h"
+#include "i_system.h"
+#include "lprintf.h"
 
 #define FINEANGLES     8192
 #define FINESINE_SIZE  (5*FINEANGLES/4)
@@ -74,80 +73,146 @@ int SlopeDiv(unsigned num, unsigned den)
   return ans <= SLOPERANGE ? ans : SLOPERANGE;
 }
 
-//fixed_t finetangent[4096];
-//fixed_t finesine[10240];
-//angle_t tantoangle[2049];
+//
+// The tables are generated from SINETABL.dat, TANGTABL.dat and
+// TANTOANG.dat by the prboom-wad-tables CMakeLists.txt, as lists of
+// words included below. Being typed const arrays they are word aligned
+// and indexed directly, no pointer to load first. They sit in flash
+// (DROM) unless menuconfig asks for internal RAM, which is faster to
+// read but costs 64K of DRAM.
+//
+
+#include "trigtabl.h"
 
-fixed_t *finetangent;
-fixed_t *finesine;
-angle_t *tantoangle;
-fixed_t * finecosine;
+#if SINETABL_WORDS != FINESINE_SIZE || TANGTABL_WORDS != FINETAN_SIZE || \
+    TANTOANG_WORDS != SLOPERANGE+1
+#error Trig table .dat files have the wrong size
+#endif
 
-#include "m_swap.h"
-#include "lprintf.h"
+#ifdef CONFIG_DOOM_TRIG_TABLES_DRAM
+#include "esp_attr.h"
+#define TRIG_TABLE DRAM_ATTR
+#else
+#define TRIG_TABLE
+#endif
+
+#ifdef CONFIG_DOOM_TRIG_TABLES_TIME
+#include "esp_heap_caps.h"
+#endif
+
+const fixed_t TRIG_TABLE finesine[FINESINE_SIZE] = {
+#include "SINETABL.inc"
+};
+
+const fixed_t TRIG_TABLE finetangent[FINETAN_SIZE] = {
+#include "TANGTABL.inc"
+};
 
-// R_LoadTrigTables
-// Load trig tables from a wad file lump
-// CPhipps 24/12/98 - fix endianness (!)
+const angle_t TRIG_TABLE tantoangle[SLOPERANGE+1] = {
+#include "TANTOANG.inc"
+};
+
+//
+// R_CheckTrigTables
+// Compare the tables against the MD5 of the .dat files they were
+// generated from, hashed in the .dat (little-endian) byte order.
 //
-void R_LoadTrigTables(void)
+
+static void R_CheckTrigTable(const char *name, const void *table, int words,
+                             const char *want)
 {
-	finetangent=(fixed_t*)&TANGTABL_dat[0];
-	finesine=(fixed_t*)&SINETABL_dat[0];
-	tantoangle=(angle_t*)&TANTOANG_dat[0];
-	finecosine = finesine + (FINEANGLES/4);
-
-#if 0
-	I_Error("Loading trig tables");
-	finetangent=malloc(4096*sizeof(fixed_t));
-	finesine=malloc(10240*sizeof(fixed_t));
-	tantoangle=malloc(2049*sizeof(angle_t));
-	finecosine = finesine + (FINEANGLES/4);
-  int lump;
-  {
-    lump = (W_CheckNumForName)("SINETABL",ns_prboom);
-    if (lump == -1) I_Error("Failed to locate trig tables");
-    if (W_LumpLength(lump) != sizeof(finesine))
-      I_Error("R_LoadTrigTables: Invalid SINETABL");
-    W_ReadLump(lump,(unsigned char*)finesine);
-  }
-  {
-    lump = (W_CheckNumForName)("TANGTABL",ns_prboom);
-    if (lump == -1) I_Error("Failed to locate trig tables");
-    if (W_LumpLength(lump) != sizeof(finetangent))
-      I_Error("R_LoadTrigTables: Invalid TANGTABL");
-    W_ReadLump(lump,(unsigned char*)finetangent);
-  }
-  {
-    lump = (W_CheckNumForName)("TANTOANG",ns_prboom);
-    if (lump == -1) I_Error("Failed to locate trig tables");
-    if (W_LumpLength(lump) != sizeof(tantoangle))
-      I_Error("R_LoadTrigTables: Invalid TANTOANG");
-    W_ReadLump(lump,(unsigned char*)tantoangle);
-  }
-#endif
-  // Endianness correction - might still be non-portable, but is fast where possible
-  {
-    size_t n;
-    lprintf(LO_INFO, "Endianness...");
-
-    // This test doesn't assume the endianness of the tables, but deduces them from
-    // en entry. I hope this is portable.
-    if ((10 < finesine[1]) && (finesine[1] < 100)) {
-      lprintf(LO_INFO, "ok.");
-      return; // Endianness is correct
+  const uint32_t *p = table;
+  struct MD5Context md5;
+  unsigned char digest[16];
+  char hex[33];
+  int i;
+
+  MD5Init(&md5);
+  while (words)
+    {
+      uint32_t buf[256];
+      int n = words < 256 ? words : 256;
+
+      for (i = 0; i < n; i++)
+        buf[i] = LONG(p[i]);
+      MD5Update(&md5, (const void *)buf, n*sizeof(*buf));
+      p += n;
+      words -= n;
     }
+  MD5Final(digest, &md5);
+
+  for (i = 0; i < 16; i++)
+    sprintf(hex + 2*i, "%02x", digest[i]);
+  if (strcmp(hex, want))
+    I_Error("R_CheckTrigTables: %s does not match %s.dat", name, name);
+}
+
+#ifdef CONFIG_DOOM_TRIG_TABLES_TIME
+//
+// R_TimeTrigLookups
+// Scattered finesine lookups, angle to fine angle as the renderer makes
+// them; best of three runs, in ms.
+//
+
+#define TRIG_LOOKUPS (1<<20)
 
-    // Must correct endianness of every long loaded (!)
-    for (n = 0; n < FINESINE_SIZE; n++)
-        finesine[n] = doom_swap_l(finesine[n]);
+static volatile fixed_t trig_sink;
 
-    for (n = 0; n < FINETAN_SIZE; n++)
-        finetangent[n] = doom_swap_l(finetangent[n]);
+static int R_TimeTrigLookups(const fixed_t *table)
+{
+  int best = INT_MAX, run, i;
+
+  for (run = 0; run < 3; run++)
+    {
+      int starttime = I_GetTime_SaveMS(), t;
+      uint32_t angle = 1;
+      fixed_t sum = 0;
+
+      for (i = 0; i < TRIG_LOOKUPS; i++)
+        {
+          angle = angle*1664525 + 1013904223;
+          sum += table[angle >> ANGLETOFINESHIFT];
+        }
+      trig_sink = sum;
+      t = I_GetTime_SaveMS() - starttime;
+      if (t < best)
+        best = t;
+    }
+  return best;
+}
+#endif
 
-    for (n = 0; n < FINEANGLES; n++)
-        tantoangle[n] = doom_swap_l(tantoangle[n]);
+void R_CheckTrigTables(void)
+{
+  int starttime = I_GetTime_SaveMS();
+
+  R_CheckTrigTable("SINETABL", finesine, FINESINE_SIZE, SINETABL_MD5);
+  R_CheckTrigTable("TANGTABL", finetangent, FINETAN_SIZE, TANGTABL_MD5);
+  R_CheckTrigTable("TANTOANG", tantoangle, SLOPERANGE+1, TANTOANG_MD5);
+  lprintf(LO_INFO, "%s, ok in %dms",
+#ifdef CONFIG_DOOM_TRIG_TABLES_DRAM
+          "DRAM",
+#else
+          "flash",
+#endif
+          I_GetTime_SaveMS() - starttime);
 
-    lprintf(LO_INFO, "corrected.");
+#ifdef CONFIG_DOOM_TRIG_TABLES_TIME
+  {
+    // The placement's own timing against internal RAM's, on this board
+    fixed_t *copy = heap_caps_malloc(sizeof finesine, MALLOC_CAP_INTERNAL|MALLOC_CAP_8BIT);
+
+    if (copy)
+      {
+        int here, dram;
+
+        memcpy(copy, finesine, sizeof finesine);
+        here = R_TimeTrigLookups(finesine);
+        dram = R_TimeTrigLookups(copy);
+        lprintf(LO_INFO, ", %dK lookups in %dms, %dms from internal RAM",
+                TRIG_LOOKUPS >> 10, here, dram);
+        heap_caps_free(copy);
+      }
   }
+#endif
 }
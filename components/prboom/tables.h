@@ -71,25 +71,22 @@
 
 typedef uint32_t angle_t;
 
-// Load trig tables if needed
-void R_LoadTrigTables(void);
+// Verify the trig tables against the .dat files they came from
+void R_CheckTrigTables(void);
 
 // Effective size is 10240.
-//extern fixed_t finesine[5*FINEANGLES/4];
-extern fixed_t *finesine;
+extern const fixed_t finesine[5*FINEANGLES/4];
 
 // Re-use data, is just PI/2 phase shift.
-extern fixed_t *finecosine;
+#define finecosine (finesine+FINEANGLES/4)
 
 // Effective size is 4096.
-//extern fixed_t finetangent[FINEANGLES/2];
-extern fixed_t *finetangent;
+extern const fixed_t finetangent[FINEANGLES/2];
 
 // Effective size is 2049;
 // The +1 size is to handle the case when x==y without additional checking.
 
-//extern angle_t tantoangle[SLOPERANGE+1];
-extern angle_t *tantoangle;
+extern const angle_t tantoangle[SLOPERANGE+1];
 
 // Utility function, called by R_PointToAngle.
 int SlopeDiv(unsigned num, unsigned den);
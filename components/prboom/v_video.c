@@ -304,7 +304,7 @@ static void IRAM_ATTR V_DrawMemPatch(int x, int y, int scrn, const rpatch_t *pat
         const rpost_t *post = &column->posts[i];
         // killough 2/21/98: Unrolled and performance-tuned
 
-        const byte *source = column->pixels + post->topdelta;
+        const byte *source = column->pixels + post->pixofs;
         byte *dest = desttop + post->topdelta*screens[scrn].byte_pitch;
         int count = post->length;
 
@@ -467,9 +467,9 @@ static void IRAM_ATTR V_DrawMemPatch(int x, int y, int scrn, const rpatch_t *pat
           dcvars.edgeslope &= ~RDRAW_EDGESLOPE_TOP_MASK;
         }
 
-        dcvars.source = column->pixels + post->topdelta + yoffset;
-        dcvars.prevsource = prevcolumn ? prevcolumn->pixels + post->topdelta + yoffset: dcvars.source;
-        dcvars.nextsource = nextcolumn ? nextcolumn->pixels + post->topdelta + yoffset: dcvars.source;
+        dcvars.source = column->pixels + post->pixofs + yoffset;
+        dcvars.prevsource = prevcolumn && !patch->isPacked ? prevcolumn->pixels + post->topdelta + yoffset: dcvars.source;
+        dcvars.nextsource = nextcolumn && !patch->isPacked ? nextcolumn->pixels + post->topdelta + yoffset: dcvars.source;
 
         dcvars.texturemid = -((dcvars.yl-centery)*dcvars.iscale);
 
@@ -517,13 +517,11 @@ void V_UpdateTrueColorPalette(video_mode_t mode) {
   static int usegammaOnLastPaletteGeneration = -1;
   
   int pplump = W_GetNumForName("PLAYPAL");
-  const byte *pal = W_CacheLumpNum(pplump);
+  const byte *pal = NULL;
   // opengl doesn't use the gamma
-//  const byte *const gtable = 
-  //  (const byte *)GAMMATBL_dat + 
-    //(V_GetMode() == VID_MODEGL ? 0 : 256*(usegamma)) ;
-
-  const byte *const gtable = (const byte *)GAMMATBL_dat;
+  const byte *const gtable = 
+    (const byte *)GAMMATBL_dat + 
+    (V_GetMode() == VID_MODEGL ? 0 : 256*(usegamma)) ;
 
   int numPals = W_LumpLength(pplump) / (3*256);
   const float dontRoundAbove = 220;
@@ -538,6 +536,13 @@ void V_UpdateTrueColorPalette(video_mode_t mode) {
     Palettes32 = NULL;
     usegammaOnLastPaletteGeneration = usegamma;      
   }
+
+  // PLAYPAL is only read when the tables for this mode have to be
+  // built, a palette change after that is just the pointer update
+  if ((mode == VID_MODE32 && !Palettes32) ||
+      (mode == VID_MODE16 && !Palettes16) ||
+      (mode == VID_MODE15 && !Palettes15))
+    pal = W_CacheLumpNum(pplump);
   
   if (mode == VID_MODE32) {
     if (!Palettes32) {
@@ -556,7 +561,7 @@ void V_UpdateTrueColorPalette(video_mode_t mode) {
           roundUpB = (b > dontRoundAbove) ? 0 : 0.5f;
                   
           for (w=0; w<VID_NUMCOLORWEIGHTS; w++) {
-            t = (float)(w)/(float)(VID_NUMCOLORWEIGHTS-1);
+            t = VID_NUMCOLORWEIGHTS > 1 ? (float)(w)/(float)(VID_NUMCOLORWEIGHTS-1) : 1.0f;
             nr = (int)(r*t+roundUpR);
             ng = (int)(g*t+roundUpG);
             nb = (int)(b*t+roundUpB);
@@ -586,7 +591,7 @@ void V_UpdateTrueColorPalette(video_mode_t mode) {
           roundUpB = (b > dontRoundAbove) ? 0 : 0.5f;
                    
           for (w=0; w<VID_NUMCOLORWEIGHTS; w++) {
-            t = (float)(w)/(float)(VID_NUMCOLORWEIGHTS-1);
+            t = VID_NUMCOLORWEIGHTS > 1 ? (float)(w)/(float)(VID_NUMCOLORWEIGHTS-1) : 1.0f;
             nr = (int)((r>>3)*t+roundUpR);
             ng = (int)((g>>2)*t+roundUpG);
             nb = (int)((b>>3)*t+roundUpB);
@@ -616,7 +621,7 @@ void V_UpdateTrueColorPalette(video_mode_t mode) {
           roundUpB = (b > dontRoundAbove) ? 0 : 0.5f;
                    
           for (w=0; w<VID_NUMCOLORWEIGHTS; w++) {
-            t = (float)(w)/(float)(VID_NUMCOLORWEIGHTS-1);
+            t = VID_NUMCOLORWEIGHTS > 1 ? (float)(w)/(float)(VID_NUMCOLORWEIGHTS-1) : 1.0f;
             nr = (int)((r>>3)*t+roundUpR);
             ng = (int)((g>>3)*t+roundUpG);
             nb = (int)((b>>3)*t+roundUpB);
@@ -630,7 +635,8 @@ void V_UpdateTrueColorPalette(video_mode_t mode) {
     V_Palette15 = Palettes15 + paletteNum*256*VID_NUMCOLORWEIGHTS;
   }       
    
-  W_UnlockLumpNum(pplump);
+  if (pal)
+    W_UnlockLumpNum(pplump);
 //  W_UnlockLumpNum(gtlump);
 }
 
@@ -683,6 +689,8 @@ void V_SetPalette(int pal)
       // we've loaded any wads, which prevents us from reading the palette - POPE
       if (W_CheckNumForName("PLAYPAL") >= 0) {
         V_UpdateTrueColorPalette(V_GetMode());
+        if (V_GetMode() == VID_MODE16)
+          R_UpdateColormaps16();
       }
     }
   }
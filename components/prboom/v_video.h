@@ -95,9 +95,18 @@ extern int          usegamma;
 // table for fast blending operations. These macros decide how many weights
 // to create for each color. The lower the number, the lower the blend
 // accuracy, which can produce very bad artifacts in texture filtering.
+//
+// A single depth build (RDRAW_ONLY_BITS) has no filtered kernels, so it
+// keeps the full weight colour only: 7K of palettes instead of 448K.
+#ifdef RDRAW_ONLY_BITS
+#define VID_NUMCOLORWEIGHTS 1
+#define VID_COLORWEIGHTMASK 0
+#define VID_COLORWEIGHTBITS 0
+#else
 #define VID_NUMCOLORWEIGHTS 64
 #define VID_COLORWEIGHTMASK (VID_NUMCOLORWEIGHTS-1)
 #define VID_COLORWEIGHTBITS 6
+#endif
 
 // Palettes for converting from 8 bit color to 16 and 32 bit. Also
 // contains the weighted versions of each palette color for filtering
@@ -172,6 +181,7 @@ extern V_DrawNumPatch_f V_DrawNumPatch;
 typedef void (*V_DrawBackground_f)(const char* flatname, int scrn);
 extern V_DrawBackground_f V_DrawBackground;
 
+void V_UpdateTrueColorPalette(video_mode_t mode);
 void V_DestroyUnusedTrueColorPalettes(void);
 // CPhipps - function to set the palette to palette number pal.
 void V_SetPalette(int pal);
@@ -54,12 +54,25 @@
 static struct {
   void *cache;
   void *mmapadr;
+  void *prefetch;   // read ahead by W_PrefetchJob, not yet handed out
+  int prefetchpos;  // 1 + position on the prefetch list, 0 if not on it
 #ifdef TIMEDIAG
   int locktic;
 #endif
   int locks;
 } *cachelump;
 
+int lump_prefetch_kb = 512;
+
+static int *prefetch_list;
+static unsigned char *prefetch_claim;  // set by whoever reads the entry
+static int prefetch_count;
+static int prefetch_used;
+static boolean prefetching;
+static int prefetch_done;  // list entries the job is through with
+
+static void W_WaitPrefetched(int pos);
+
 
 
 #ifdef HEAPDUMP
@@ -123,10 +136,162 @@ const void* W_CacheLumpNum(int lump)
     I_Error ("W_CacheLumpNum: %i >= numlumps",lump);
 #endif
 //  lprintf(LO_INFO, "W_CacheLumpNum: Lump length: %d, ifd: %d, offset: %d\n", W_LumpLength(lump), lumpinfo[lump].wadfile->handle, lumpinfo[lump].position);
+  if (cachelump[lump].prefetchpos) {
+    W_WaitPrefetched(cachelump[lump].prefetchpos);
+    cachelump[lump].prefetchpos = 0;
+  }
+  if (__atomic_load_n(&cachelump[lump].prefetch, __ATOMIC_ACQUIRE)) {
+    cachelump[lump].mmapadr = cachelump[lump].prefetch;
+    cachelump[lump].prefetch = NULL;
+    prefetch_used++;
+    return (char*)cachelump[lump].mmapadr;
+  }
 	cachelump[lump].mmapadr=I_Mmap(NULL, (size_t)W_LumpLength(lump), 0, 0, lumpinfo[lump].wadfile->handle, (off_t)lumpinfo[lump].position);
 	return (char*)cachelump[lump].mmapadr;
 }
 
+//
+// Lump prefetching
+//
+// W_PrefetchLumps reads a list of lumps on a background task, while
+// the game carries on with something that doesn't need them (the
+// intermission screen), or with the lumps before them on the list (the
+// level loader). Each buffer is parked in cachelump[].prefetch and
+// handed over by the first W_CacheLumpNum of that lump, instead of
+// going to the card for it again.
+//
+// Each list entry is claimed, once, by whichever side reads it. Asked
+// for a lump the job has claimed, W_CacheLumpNum waits for the job to
+// be through with it; one the job hasn't got to yet, it claims and
+// reads itself, and the job skips it.
+//
+// The job only touches the prefetch pointers of entries it claimed,
+// publishing them before prefetch_done, and allocates through I_Mmap,
+// never the zone, which isn't thread safe.
+//
+
+static void W_PrefetchJob(void)
+{
+  size_t budget = (size_t)lump_prefetch_kb * 1024;
+  int i;
+
+  for (i = 0; i < prefetch_count; i++)
+    {
+      int lump = prefetch_list[i];
+      size_t len = W_LumpLength(lump);
+
+      if (len > budget)
+        break;
+      if (__atomic_exchange_n(&prefetch_claim[i], 1, __ATOMIC_ACQ_REL))
+        continue;
+      budget -= len;
+      if (len && !cachelump[lump].prefetch)
+        {
+          void *buf = I_Mmap(NULL, len, 0, 0,
+            lumpinfo[lump].wadfile->handle, (off_t)lumpinfo[lump].position);
+
+          if (!buf)
+            break;
+          __atomic_store_n(&cachelump[lump].prefetch, buf, __ATOMIC_RELEASE);
+        }
+      __atomic_store_n(&prefetch_done, i+1, __ATOMIC_RELEASE);
+    }
+  __atomic_store_n(&prefetch_done, prefetch_count, __ATOMIC_RELEASE);
+}
+
+static void W_WaitPrefetched(int pos)
+{
+  if (!prefetching ||
+      !__atomic_exchange_n(&prefetch_claim[pos-1], 1, __ATOMIC_ACQ_REL))
+    return;
+  while (prefetching && __atomic_load_n(&prefetch_done, __ATOMIC_ACQUIRE) < pos)
+    if (I_BackgroundDone())
+      prefetching = false;
+    else
+      I_uSleep(1000);
+}
+
+// Buffers of lumps that are on the new list as well are kept, and the
+// job is only started if something on it still has to be read.
+void W_PrefetchLumps(const int *lumps, int count)
+{
+  int i, j;
+
+  W_FinishPrefetch();
+  if (!lump_prefetch_kb)
+    count = 0;
+
+  for (i = 0; i < prefetch_count; i++)
+    {
+      int lump = prefetch_list[i];
+
+      cachelump[lump].prefetchpos = 0;
+      for (j = 0; j < count && lumps[j] != lump; j++)
+        ;
+      if (j == count && cachelump[lump].prefetch)
+        {
+          I_Munmap(cachelump[lump].prefetch, W_LumpLength(lump));
+          cachelump[lump].prefetch = NULL;
+        }
+    }
+  prefetch_count = prefetch_used = 0;
+
+  for (i = 0; i < count && cachelump[lumps[i]].prefetch; i++)
+    ;
+  if (count <= 0)
+    return;
+
+  prefetch_list = realloc(prefetch_list, count * sizeof *prefetch_list);
+  memcpy(prefetch_list, lumps, count * sizeof *prefetch_list);
+  prefetch_claim = realloc(prefetch_claim, count);
+  memset(prefetch_claim, 0, count);
+  prefetch_count = count;
+  if (i == count)
+    return;
+
+  for (i = count; i--; )
+    cachelump[lumps[i]].prefetchpos = i+1;
+  prefetch_done = 0;
+  prefetching = I_StartBackground(W_PrefetchJob);
+}
+
+void W_FinishPrefetch(void)
+{
+  if (prefetching)
+    {
+      I_WaitBackground();
+      prefetching = false;
+    }
+}
+
+boolean W_PrefetchBusy(void)
+{
+  if (prefetching && I_BackgroundDone())
+    prefetching = false;
+  return prefetching;
+}
+
+int W_DropPrefetch(void)
+{
+  int i, used;
+
+  W_FinishPrefetch();
+  for (i = 0; i < prefetch_count; i++)
+    {
+      int lump = prefetch_list[i];
+
+      cachelump[lump].prefetchpos = 0;
+      if (cachelump[lump].prefetch)
+        {
+          I_Munmap(cachelump[lump].prefetch, W_LumpLength(lump));
+          cachelump[lump].prefetch = NULL;
+        }
+    }
+  used = prefetch_used;
+  prefetch_count = prefetch_used = 0;
+  return used;
+}
+
 /*
  * W_LockLumpNum
  *
@@ -296,68 +296,254 @@ unsigned W_LumpNameHash(const char *s)
 }
 
 //
-// W_CheckNumForName
-// Returns -1 if name not found.
+// Lump directory index
 //
-// Rewritten by Lee Killough to use hash table for performance. Significantly
-// cuts down on time -- increases Doom performance over 300%. This is the
-// single most important optimization of the original Doom sources, because
-// lump name lookup is used so often, and the original Doom used a sequential
-// search. For large wads with > 1000 lumps this meant an average of over
-// 500 were probed during every search. Now the average is under 2 probes per
-// search. There is no significant benefit to packing the names into longwords
-// with this new hashing algorithm, because the work to do the packing is
-// just as much work as simply doing the string comparisons with the new
-// algorithm, which minimizes the expected number of comparisons to under 2.
+// killough's chained hash above did a strncasecmp per probe, and
+// names that are in the directory many times over, like the lumps of
+// each map in a big PWAD, all end up in one chain that every miss
+// hashing there has to walk. The directory doesn't change after
+// W_Init, so W_HashLumps builds a minimal perfect hash over its
+// distinct (name, namespace) pairs instead. Names are upper-cased and
+// packed into two 32-bit words. One hash picks a bucket, and the
+// bucket's displacement d turns a second into the one slot the name
+// can be in, so a lookup, hit or miss, is two hashes and one compare
+// of two words.
 //
-// killough 4/17/98: add namespace parameter to prevent collisions
-// between different resources such as flats, sprites, colormaps
+// Buckets are placed largest first, trying displacements until all
+// their names land on free slots. Single name buckets, most of the
+// rest, then just take a free slot each, stored as -1-slot.
 //
 
-int (W_CheckNumForName)(register const char *name, register int li_namespace)
+typedef struct {
+  unsigned int name[2]; // upper-cased, NUL padded
+  int li_namespace;
+  int lump;
+} lumpkey_t;
+
+static lumpkey_t *lumpkeys;  // numlumpkeys slots, placed by the hash
+static int *lumpdisp;        // displacement of each bucket
+static int numlumpkeys, numlumpbuckets;
+static unsigned lumpseed;
+
+#define LUMPS_PER_BUCKET 2
+#define LUMP_DISPLACEMENTS (1<<16)
+
+static void W_PackName(const char *name, unsigned int *w)
 {
-  // Hash function maps the name to one of possibly numlump chains.
-  // It has been tuned so that the average chain length never exceeds 2.
+  unsigned char c[8] = {0};
+  int i;
 
-  // proff 2001/09/07 - check numlumps==0, this happens when called before WAD loaded
-  register int i = (numlumps==0)?(-1):(lumpinfo[W_LumpNameHash(name) % (unsigned) numlumps].index);
+  for (i=0; i<8 && name[i]; i++)
+    c[i] = toupper((unsigned char)name[i]);
+  w[0] = c[0] | c[1]<<8 | c[2]<<16 | (unsigned)c[3]<<24;
+  w[1] = c[4] | c[5]<<8 | c[6]<<16 | (unsigned)c[7]<<24;
+}
+
+static unsigned W_KeyHash(const unsigned int *w, int li_namespace, unsigned seed)
+{
+  unsigned h = (seed ^ w[0]) * 0x9e3779b1u;
 
-  // We search along the chain until end, looking for case-insensitive
-  // matches which also match a namespace tag. Separate hash tables are
-  // not used for each namespace, because the performance benefit is not
-  // worth the overhead, considering namespace collisions are rare in
-  // Doom wads.
+  h ^= h >> 15;
+  h = (h ^ w[1]) * 0x85ebca77u;
+  h ^= h >> 13;
+  h = (h ^ li_namespace) * 0xc2b2ae3du;
+  return h ^ (h >> 16);
+}
 
-  while (i >= 0 && (strncasecmp(lumpinfo[i].name, name, 8) ||
-                    lumpinfo[i].li_namespace != li_namespace)) 
-	    i = lumpinfo[i].next;
+// Map a hash onto 0..n-1 with a multiply instead of a divide
+#define W_HashRange(h, n) ((int)(((uint_64_t)(unsigned)(h) * (unsigned)(n)) >> 32))
 
-  // Return the matching lump, or -1 if none found.
+// Bucket hash, and the second hash the displacement is applied to
+#define W_BucketHash(w, ns) W_KeyHash(w, ns, lumpseed)
+#define W_SlotHash(w, ns) W_KeyHash(w, ns, ~lumpseed)
 
-  return i;
+static int W_KeySlot(unsigned h, unsigned g, int d)
+{
+  return d < 0 ? -1-d : W_HashRange(g + d*(h|1), numlumpkeys);
+}
+
+// Place the distinct keys with the current seed. Returns false if some
+// bucket can't be placed, for the caller to try another seed.
+static boolean W_PlaceKeys(const lumpkey_t *keys)
+{
+  unsigned *hash = malloc(2 * numlumpkeys * sizeof *hash);
+  int *count = calloc(numlumpbuckets + 1, sizeof *count);
+  int *first = malloc((numlumpbuckets + 1) * sizeof *first);
+  int *members = malloc(numlumpkeys * sizeof *members);
+  int *order = malloc(numlumpbuckets * sizeof *order);
+  int *bysize = calloc(numlumpkeys + 2, sizeof *bysize);
+  byte *taken = calloc(numlumpkeys, 1);
+  int slots[64];
+  int i, j, b, d, n, freeslot = 0;
+  boolean placed = true;
+
+  // both hashes of each key, and its bucket
+  for (i=0; i<numlumpkeys; i++)
+    {
+      hash[2*i] = W_BucketHash(keys[i].name, keys[i].li_namespace);
+      hash[2*i+1] = W_SlotHash(keys[i].name, keys[i].li_namespace);
+      count[W_HashRange(hash[2*i], numlumpbuckets)]++;
+    }
+
+  // bucket members, grouped by bucket
+  for (b=n=0; b<numlumpbuckets; b++)
+    first[b] = n, n += count[b];
+  first[b] = n;
+  for (i=0; i<numlumpkeys; i++)
+    members[first[W_HashRange(hash[2*i], numlumpbuckets)]++] = i;
+  for (b=numlumpbuckets; b>0; b--)
+    first[b] = first[b-1];
+  first[0] = 0;
+
+  // buckets largest first (counting sort on size)
+  for (b=0; b<numlumpbuckets; b++)
+    bysize[count[b]]++;
+  for (n=0, i=numlumpkeys+1; i>=0; i--)
+    d = bysize[i], bysize[i] = n, n += d;
+  for (b=0; b<numlumpbuckets; b++)
+    order[bysize[count[b]]++] = b;
+
+  for (j=0; j<numlumpbuckets && placed; j++)
+    {
+      const int *member;
+
+      b = order[j];
+      n = count[b];
+      member = &members[first[b]];
+      if (n > (int)(sizeof slots/sizeof *slots))
+        placed = false;
+      else if (n > 1)
+        for (d=0; ; d++)
+          {
+            if (d == LUMP_DISPLACEMENTS)
+              {
+                placed = false;
+                break;
+              }
+            for (i=0; i<n; i++)
+              {
+                int k;
+
+                slots[i] = W_KeySlot(hash[2*member[i]], hash[2*member[i]+1], d);
+                if (taken[slots[i]])
+                  break;
+                for (k=0; k<i && slots[k]!=slots[i]; k++)
+                  ;
+                if (k < i)
+                  break;
+              }
+            if (i == n)
+              break;
+          }
+      else if (n == 1)
+        {
+          while (taken[freeslot])
+            freeslot++;
+          d = -1-freeslot;
+          slots[0] = freeslot;
+        }
+      else
+        d = 0;  // empty, any lookup landing here misses
+
+      if (placed)
+        {
+          lumpdisp[b] = d;
+          for (i=0; i<n; i++)
+            {
+              taken[slots[i]] = 1;
+              lumpkeys[slots[i]] = keys[member[i]];
+            }
+        }
+    }
+
+  free(taken);
+  free(bysize);
+  free(order);
+  free(members);
+  free(first);
+  free(count);
+  free(hash);
+  return placed;
 }
 
 //
-// killough 1/31/98: Initialize lump hash table
+// W_HashLumps
 //
 
 void W_HashLumps(void)
 {
-  int i;
+  lumpkey_t *keys = malloc(numlumps * sizeof *keys);
+  int size, *seen, i, n = 0, starttime = I_GetTime_SaveMS();
+
+  // Collect the distinct names, last lump first so that it is the one
+  // kept, observing pwad ordering rules; a plain open addressed table
+  // finds the repeats.
+  for (size = 1; size < 2*numlumps; size <<= 1)
+    ;
+  seen = malloc(size * sizeof *seen);
+  memset(seen, -1, size * sizeof *seen);
+  lumpseed = 0;
+
+  for (i=numlumps; --i >= 0; )
+    {
+      lumpkey_t *key = &keys[n];
+      int j;
+
+      W_PackName(lumpinfo[i].name, key->name);
+      key->li_namespace = lumpinfo[i].li_namespace;
+      key->lump = i;
+
+      for (j = W_BucketHash(key->name, key->li_namespace) & (size-1);
+           seen[j] >= 0; j = (j+1) & (size-1))
+        if (keys[seen[j]].name[0] == key->name[0] &&
+            keys[seen[j]].name[1] == key->name[1] &&
+            keys[seen[j]].li_namespace == key->li_namespace)
+          break;
+      if (seen[j] < 0)
+        seen[j] = n++;
+    }
+  free(seen);
 
-  for (i=0; i<numlumps; i++)
-    lumpinfo[i].index = -1;                     // mark slots empty
+  free(lumpkeys);
+  free(lumpdisp);
+  numlumpkeys = n;
+  numlumpbuckets = n / LUMPS_PER_BUCKET + 1;
+  lumpkeys = malloc((n ? n : 1) * sizeof *lumpkeys);
+  lumpdisp = malloc(numlumpbuckets * sizeof *lumpdisp);
 
-  // Insert nodes to the beginning of each chain, in first-to-last
-  // lump order, so that the last lump of a given name appears first
-  // in any chain, observing pwad ordering rules. killough
+  while (!W_PlaceKeys(keys))
+    if (++lumpseed == 16)
+      I_Error("W_HashLumps: Can't index %d lump names", n);
 
-  for (i=0; i<numlumps; i++)
-    {                                           // hash function:
-      int j = W_LumpNameHash(lumpinfo[i].name) % (unsigned) numlumps;
-      lumpinfo[i].next = lumpinfo[j].index;     // Prepend to list
-      lumpinfo[j].index = i;
-    }
+  free(keys);
+  lprintf(LO_INFO, "W_HashLumps: %d names in %dms\n", n, I_GetTime_SaveMS() - starttime);
+}
+
+//
+// W_CheckNumForName
+// Returns -1 if name not found.
+//
+// killough 4/17/98: add namespace parameter to prevent collisions
+// between different resources such as flats, sprites, colormaps
+//
+
+int (W_CheckNumForName)(const char *name, int li_namespace)
+{
+  const lumpkey_t *key;
+  unsigned int w[2], h;
+
+  // proff 2001/09/07 - check numlumps==0, this happens when called before WAD loaded
+  if (!numlumpkeys)
+    return -1;
+
+  W_PackName(name, w);
+  h = W_BucketHash(w, li_namespace);
+  key = &lumpkeys[W_KeySlot(h, W_SlotHash(w, li_namespace),
+                            lumpdisp[W_HashRange(h, numlumpbuckets)])];
+
+  if (key->name[0] != w[0] || key->name[1] != w[1] || key->li_namespace != li_namespace)
+    return -1;
+  return key->lump;
 }
 
 // End of lump hashing -- killough 1/31/98
@@ -439,6 +625,7 @@ void W_ReleaseAllWads(void)
 	numlumps = 0;
 	free(lumpinfo);
 	lumpinfo = NULL;
+	numlumpkeys = 0;
 }
 
 //
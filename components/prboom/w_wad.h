@@ -98,9 +98,6 @@ typedef struct
   char  name[9];
   int   size;
 
-  // killough 1/31/98: hash table fields, used for ultra-fast hash table lookup
-  int index, next;
-
   // killough 4/17/98: namespace tags, to prevent conflicts between resources
   enum {
     ns_global=0,
@@ -131,6 +128,16 @@ const void* W_CacheLumpNum (int lump);
 const void* W_LockLumpNum(int lump);
 void    W_UnlockLumpNum(int lump);
 
+// Read a list of lumps ahead on a background task; W_CacheLumpNum
+// takes them from there once W_FinishPrefetch has waited for it.
+// W_DropPrefetch frees whatever wasn't used and returns how many were.
+// W_PrefetchBusy polls for the job, true while it is still reading.
+extern int lump_prefetch_kb;  // byte budget for one prefetch, 0 = off
+void    W_PrefetchLumps(const int *lumps, int count);
+void    W_FinishPrefetch(void);
+boolean W_PrefetchBusy(void);
+int     W_DropPrefetch(void);
+
 // CPhipps - convenience macros
 //#define W_CacheLumpNum(num) (W_CacheLumpNum)((num),1)
 #define W_CacheLumpName(name) W_CacheLumpNum (W_GetNumForName(name))
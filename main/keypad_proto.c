@@ -0,0 +1,133 @@
+#include <string.h>
+#include "keypad_proto.h"
+
+uint8_t kp_crc8(const uint8_t *p, size_t len)
+{
+    uint8_t crc = 0;
+    int i;
+
+    while (len--) {
+        crc ^= *p++;
+        for (i = 0; i < 8; i++)
+            crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+static size_t kp_finish(uint8_t *out, size_t len)
+{
+    out[len] = kp_crc8(out + 1, len - 1);
+    return len + 1;
+}
+
+size_t kp_encode_keys(uint8_t *out, uint8_t seq, const uint16_t *masks, int count)
+{
+    size_t len = 3;
+    int i;
+
+    if (count > KP_MAXBATCH)
+        count = KP_MAXBATCH;
+    out[0] = KP_SYNC;
+    out[1] = (KP_TYPE_KEYS << 4) | count;
+    out[2] = seq;
+    for (i = 0; i < count; i++) {
+        out[len++] = masks[i] & 0xff;
+        out[len++] = masks[i] >> 8;
+    }
+    return kp_finish(out, len);
+}
+
+size_t kp_encode_status(uint8_t *out, uint8_t seq, uint8_t status)
+{
+    out[0] = KP_SYNC;
+    out[1] = (KP_TYPE_STATUS << 4) | 1;
+    out[2] = seq;
+    out[3] = status;
+    return kp_finish(out, 4);
+}
+
+void kp_parser_init(kp_parser_t *p)
+{
+    memset(p, 0, sizeof *p);
+    p->seq = -1;
+}
+
+// Full length of the frame whose first two bytes are in buf, or 0 if
+// the header is not a valid one
+static int kp_framelen(const uint8_t *buf)
+{
+    int type = buf[1] >> 4, count = buf[1] & 15;
+
+    if (type == KP_TYPE_KEYS && count >= 1 && count <= KP_MAXBATCH)
+        return 3 + count*2 + 1;
+    if (type == KP_TYPE_STATUS && count == 1)
+        return 3 + 1 + 1;
+    return 0;
+}
+
+static void kp_decode(kp_parser_t *p, int len, kp_handler_t handler, void *ctx)
+{
+    kp_frame_t frame;
+    int i;
+
+    frame.type = p->buf[1] >> 4;
+    frame.count = p->buf[1] & 15;
+    frame.seq = p->buf[2];
+    frame.status = 0;
+    if (frame.type == KP_TYPE_STATUS)
+        frame.status = p->buf[3];
+    else
+        for (i = 0; i < frame.count; i++)
+            frame.masks[i] = p->buf[3 + i*2] | (p->buf[4 + i*2] << 8);
+
+    if (p->seq >= 0)
+        p->lost += (uint8_t)(frame.seq - p->seq - 1);
+    p->seq = frame.seq;
+    p->frames++;
+    handler(&frame, ctx);
+}
+
+void kp_parse(kp_parser_t *p, const uint8_t *data, size_t len,
+              kp_handler_t handler, void *ctx)
+{
+    while (len) {
+        int want;
+
+        if (!p->len) {
+            // Hunting for sync; skip straight to the next one
+            const uint8_t *sync = memchr(data, KP_SYNC, len);
+
+            if (!sync)
+                return;
+            len -= sync - data;
+            data = sync;
+        }
+
+        p->buf[p->len++] = *data++;
+        len--;
+
+        if (p->len < 2)
+            continue;
+        if (!(want = kp_framelen(p->buf))) {
+            // False sync; the second byte may be the real one
+            p->len = p->buf[1] == KP_SYNC;
+            continue;
+        }
+        if (p->len < want)
+            continue;
+
+        if (kp_crc8(p->buf + 1, want - 2) == p->buf[want - 1]) {
+            kp_decode(p, want, handler, ctx);
+            p->len = 0;
+        } else {
+            // The sync was probably a data byte. Rescan what we have
+            // after it, so a real frame starting inside isn't lost.
+            uint8_t tmp[KP_MAXFRAME];
+
+            p->crcerrors++;
+            memcpy(tmp, p->buf + 1, want - 1);
+            p->len = 0;
+            kp_parse(p, tmp, want - 1, handler, ctx);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+// Binary framing for the keypad controller link (arduino/main/main.ino
+// carries its own copy of the encoder; keep the two in step).
+//
+//   0xA5 | type<<4 | count | seq | payload | crc8
+//
+// The CRC8 (poly 0x07, init 0) covers everything after the sync byte.
+// A keys frame carries count little-endian 16-bit key-state bitmasks,
+// oldest first, one per keypad scan that changed something since the
+// last frame; bit n is key n of the 4x4 keymap in row order. A status
+// frame carries one byte. seq increments by one per frame, so the
+// receiver can count lost frames; the sender repeats the current state
+// as a heartbeat so a lost frame is corrected within one period.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define KP_SYNC          0xA5
+#define KP_TYPE_KEYS     0
+#define KP_TYPE_STATUS   1
+#define KP_MAXBATCH      8
+#define KP_MAXFRAME      (3 + KP_MAXBATCH*2 + 1)
+
+#define KP_STATUS_LOCKED   0
+#define KP_STATUS_UNLOCKED 1
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  count;         // bitmasks in masks[]
+    uint8_t  seq;
+    uint8_t  status;        // KP_TYPE_STATUS only
+    uint16_t masks[KP_MAXBATCH];
+} kp_frame_t;
+
+typedef void (*kp_handler_t)(const kp_frame_t *frame, void *ctx);
+
+typedef struct {
+    uint8_t  buf[KP_MAXFRAME];
+    int      len;           // bytes of the current frame collected
+    int      seq;           // last sequence number seen, -1 for none
+    unsigned frames;        // good frames
+    unsigned crcerrors;
+    unsigned lost;          // frames missing from the sequence
+} kp_parser_t;
+
+uint8_t kp_crc8(const uint8_t *p, size_t len);
+
+// Build a frame into out (at least KP_MAXFRAME bytes), return its length
+size_t kp_encode_keys(uint8_t *out, uint8_t seq, const uint16_t *masks, int count);
+size_t kp_encode_status(uint8_t *out, uint8_t seq, uint8_t status);
+
+void kp_parser_init(kp_parser_t *p);
+
+// Feed received bytes, calling handler for each good frame. Frames can
+// be split across calls in any way; garbage and bad frames are skipped.
+void kp_parse(kp_parser_t *p, const uint8_t *data, size_t len,
+              kp_handler_t handler, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,15 +1,73 @@
 #include "driver/uart.h"
 #include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "sdkconfig.h"
+#include "i_input.h"
+#include "keypad_proto.h"
 #include "uart_control.h"
 #define UART_PORT UART_NUM_1
-#define BUF_SIZE  128
+#define BUF_SIZE  256
 
 static const char *TAG = "UART_CTRL";
 
+static QueueHandle_t uart_queue;
+
+// Keypad keys in bitmask order, as laid out in the sketch's keymap
+static const char keypadKeys[16] = "123A456B789C*0#D";
+
+// Keypad character -> input action, -1 for unmapped keys
+static int keypadAction(char c)
+{
+    switch (c) {
+    case '2': return IA_UP;
+    case '8': return IA_DOWN;
+    case '4': return IA_LEFT;
+    case '6': return IA_RIGHT;
+    case '5': return IA_FIRE;
+    case '0': return IA_USE;
+    case '1': return IA_STRAFELEFT;
+    case '3': return IA_STRAFERIGHT;
+    case '#': return IA_ENTER;
+    case '*': return IA_ESCAPE;
+    case 'A': return IA_MAP;
+    case 'B': return IA_WEAPONTOGGLE;
+    default:  return -1;
+    }
+}
+
+static uint16_t keystate;
+
+// Post a press or release for every key whose bit changed
+static void keypadMask(uint16_t mask)
+{
+    uint16_t changed = mask ^ keystate;
+    int i, action;
+
+    for (i = 0; changed; i++, changed >>= 1)
+        if ((changed & 1) && (action = keypadAction(keypadKeys[i])) >= 0)
+            I_PostInput(action, (mask >> i) & 1);
+    keystate = mask;
+}
+
+static void keypadFrame(const kp_frame_t *frame, void *ctx)
+{
+    int i;
+
+    if (frame->type == KP_TYPE_STATUS) {
+        ESP_LOGI(TAG, "keypad %s", frame->status == KP_STATUS_UNLOCKED ? "unlocked" : "locked");
+        if (frame->status != KP_STATUS_UNLOCKED)
+            keypadMask(0);
+        return;
+    }
+    for (i = 0; i < frame->count; i++)
+        keypadMask(frame->masks[i]);
+}
+
 void uart_control_init(void)
 {
     uart_config_t cfg = {
-        .baud_rate = 115200,
+        .baud_rate = CONFIG_KEYPAD_UART_BAUD,
         .data_bits = UART_DATA_8_BITS,
         .parity    = UART_PARITY_DISABLE,
         .stop_bits = UART_STOP_BITS_1,
@@ -18,18 +76,57 @@ void uart_control_init(void)
 
     uart_param_config(UART_PORT, &cfg);
     uart_set_pin(UART_PORT, 17, 16, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-    uart_driver_install(UART_PORT, BUF_SIZE * 2, 0, 0, NULL, 0);
+    uart_driver_install(UART_PORT, BUF_SIZE * 2, 0, 16, &uart_queue, 0);
+
+    // Hand bytes over after a 3 symbol gap rather than the default 10,
+    // so a frame is seen as soon as it has arrived
+    uart_set_rx_timeout(UART_PORT, 3);
 }
 
+// Sleep on the driver's event queue and parse whatever arrived straight
+// out of the read buffer. The parser is incremental, so frames split
+// across reads cost nothing extra.
 void uart_control_task(void *arg)
 {
-    uint8_t data[BUF_SIZE];
+    static kp_parser_t parser;
+    static uint8_t data[BUF_SIZE];
+    uart_event_t event;
+    unsigned lastlost = 0, lastcrc = 0;
+
+    kp_parser_init(&parser);
 
     while (1) {
-        int len = uart_read_bytes(UART_PORT, data, BUF_SIZE - 1, pdMS_TO_TICKS(100));
-        if (len > 0) {
-            data[len] = 0;
-            ESP_LOGI(TAG, "RX: %s", (char *)data);
+        if (!xQueueReceive(uart_queue, &event, portMAX_DELAY))
+            continue;
+
+        switch (event.type) {
+        case UART_DATA: {
+            size_t avail;
+            int len;
+
+            uart_get_buffered_data_len(UART_PORT, &avail);
+            while (avail && (len = uart_read_bytes(UART_PORT, data,
+                                   avail < BUF_SIZE ? avail : BUF_SIZE, 0)) > 0) {
+                kp_parse(&parser, data, len, keypadFrame, NULL);
+                avail -= len;
+            }
+            break;
+        }
+        case UART_FIFO_OVF:
+        case UART_BUFFER_FULL:
+            ESP_LOGW(TAG, "rx overflow");
+            uart_flush_input(UART_PORT);
+            xQueueReset(uart_queue);
+            break;
+        default:
+            break;
+        }
+
+        if (parser.lost != lastlost || parser.crcerrors != lastcrc) {
+            ESP_LOGW(TAG, "%u frames, %u lost, %u bad CRC",
+                     parser.frames, parser.lost, parser.crcerrors);
+            lastlost = parser.lost;
+            lastcrc = parser.crcerrors;
         }
     }
 }
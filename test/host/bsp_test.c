@@ -0,0 +1,714 @@
+/*
+ * BSP node layout and walk tests, and benchmark
+ *
+ * p_setup.c, p_sight.c and r_bsp.c are included whole and run on a
+ * synthetic map: a kd-tree of about 32000 nodes, written in the post
+ * order node builders use, with one subsector per leaf. Against the
+ * recursive walks over lump-order, fixed_t nodes that they replaced:
+ *
+ *  - P_LoadNodes keeps the tree, numbered depth first from the root
+ *    down, and keeps the lump order when the nodes are not a tree
+ *  - R_RenderBSPNode visits subsectors and checks bboxes in the same
+ *    order, with subsectors filling the screen as they are visited
+ *  - P_CrossBSPNode, both variants, crosses the same subsectors and
+ *    gives the same answer, with some subsectors blocking sight
+ *
+ * then times old and new. Neither clips or draws anything; the times
+ * are the walks, R_CheckBBox and the stubs below.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../components/prboom/p_setup.c"
+#include "../../components/prboom/p_sight.c"
+#include "../../components/prboom/r_bsp.c"
+#include "host_support.h"
+
+/*
+ * What the three files link against. The level setup, sprites and
+ * wall clipping are never reached from the walks.
+ */
+
+int bodyqueslot, consoleplayer, gametic, iquehead, iquetail, leveltime;
+int comp[COMP_TOTAL];
+complevel_t compatibility_level;
+boolean deathmatch, precache, playeringame[MAXPLAYERS];
+GameMode_t gamemode;
+player_t players[MAXPLAYERS], *viewplayer;
+wbstartstruct_t wminfo;
+int totalitems, totalkills, totallive, totalsecret, validcount;
+lumpinfo_t *lumpinfo;
+int numlumps, skyflatnum = -1, rw_angle1;
+const char *sprnames[] = { NULL };
+fixed_t *textureheight;
+int *texturetranslation;
+visplane_t *floorplane, *ceilingplane;
+angle_t clipangle, viewangle;
+int *viewangletox;
+fixed_t viewx, viewy, viewz;
+
+void G_DeathMatchSpawnPlayer(int playernum) {}
+const char *I_DoomExeDir(void) { return "."; }
+int I_GetTime_SaveMS(void) { return 0; }
+int M_CheckParm(const char *check) { return 0; }
+void MD5Init(struct MD5Context *context) {}
+void MD5Update(struct MD5Context *context, md5byte const *buf, unsigned len) {}
+void MD5Final(unsigned char digest[16], struct MD5Context *context) {}
+void P_InitPicAnims(void) {}
+void P_InitSwitchList(void) {}
+void P_InitThinkers(void) {}
+fixed_t P_InterceptVector(const divline_t *v2, const divline_t *v1) { return FRACUNIT/2; }
+fixed_t P_InterceptVector2(const divline_t *v2, const divline_t *v1) { return FRACUNIT/2; }
+boolean P_IsDoomnumAllowed(int doomnum) { return true; }
+void P_MapEnd(void) {}
+void P_MapStart(void) {}
+void P_SpawnBrainTargets(void) {}
+void P_SpawnMapThing(const mapthing_t *mthing) {}
+void P_SpawnSpecials(void) {}
+int R_ColormapNumForName(const char *name) { return 0; }
+int R_FlatNumForName(const char *name) { return 0; }
+void R_InitSprites(const char * const *namelist) {}
+angle_t R_PointToAngle2(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2) { return 0; }
+void R_PrecacheLevel(void) {}
+int R_SafeTextureNumForName(const char *name, int snum) { return 0; }
+void R_SmoothPlaying_Reset(player_t *player) {}
+void R_StopAllInterpolations(void) {}
+void R_StoreWallRange(const int start, const int stop) {}
+int R_TextureNumForName(const char *name) { return 0; }
+void R_TrimLevelTextures(void) {}
+void S_Start(void) {}
+int (W_CheckNumForName)(const char *name, int ns) { return -1; }
+int W_DropPrefetch(void) { return 0; }
+int W_GetNumForName(const char *name) { return -1; }
+void W_PrefetchLumps(const int *lumps, int count) {}
+void (Z_FreeTags)(int lowtag, int hightag) {}
+visplane_t *R_FindPlane(fixed_t height, int picnum, int lightlevel,
+                        fixed_t xoffs, fixed_t yoffs) { return NULL; }
+
+/* r_main.c's R_PointOnSide, for the node_t in r_defs.h */
+int R_PointOnSide(fixed_t x, fixed_t y, const node_t *node)
+{
+  if (!node->dx)
+    return x <= node->x<<FRACBITS ? node->dy > 0 : node->dy < 0;
+
+  if (!node->dy)
+    return y <= node->y<<FRACBITS ? node->dx < 0 : node->dx > 0;
+
+  x -= node->x<<FRACBITS;
+  y -= node->y<<FRACBITS;
+
+  // Try to quickly decide by looking at sign bits.
+  if ((node->dy ^ node->dx ^ x ^ y) < 0)
+    return (node->dy ^ x) < 0;  // (left is negative)
+  return FixedMul(y, node->dx) >= FixedMul(node->dy, x);
+}
+
+/*
+ * The walks are traced through the calls they make: R_CheckBBox calls
+ * R_PointToAngle for each box that isn't around the viewer, and
+ * R_Subsector calls R_AddSprites once per subsector. Both fold what
+ * they are given into walktrace, so two walks that differ in order
+ * anywhere end with different traces.
+ */
+
+static unsigned walktrace, tracecalls;
+
+angle_t R_PointToAngle(fixed_t x, fixed_t y)
+{
+  walktrace = walktrace * 31 + (x ^ y * 7);
+  return (angle_t)(long long)(atan2((double)y - viewy, (double)x - viewx) *
+                              (2147483648.0 / M_PI));
+}
+
+// Every few subsectors turn a run of columns solid, as their walls
+// would, so the bbox checks start failing and the walk finishes early
+void R_AddSprites(subsector_t *subsec, int lightlevel)
+{
+  int num = subsec - subsectors;
+
+  walktrace = walktrace * 31 + num;
+  tracecalls++;
+  if (num % 7 == 0)
+    {
+      int x = num * 37 % SCREENWIDTH, n = 1 + num % 13;
+
+      memset(solidcol + x, 1, x + n > SCREENWIDTH ? SCREENWIDTH - x : n);
+    }
+}
+
+static const byte *lumpdata;
+static int lumpsize;
+
+int W_LumpLength(int lump) { return lumpsize; }
+const void *W_CacheLumpNum(int lump) { return lumpdata; }
+void W_UnlockLumpNum(int lump) {}
+
+/*
+ * The synthetic map. A kd-tree over a square, split across the longer
+ * side at a random point, with some of the horizontal partitions
+ * slightly sloped so the general case of R_PointOnSide runs too.
+ * Written children first, as node builders do, so the root is last.
+ */
+
+#define MAXNODES 32000   /* nodes started; those under way finish, up to 42 more */
+#define MAXDEPTH 40
+#define HALFSIZE 16000
+
+static mapnode_t *lump;
+static int lumpnodes, leaves;
+static unsigned rng = 12345;
+
+static unsigned Random(void)
+{
+  rng = rng * 1103515245 + 12345;
+  return rng >> 8;
+}
+
+static int BuildNode(int l, int b, int r, int t, int depth)
+{
+  int w = r - l, h = t - b, c0, c1;
+  mapnode_t n;
+
+  if (lumpnodes >= MAXNODES || w < 64 || h < 64 || depth > MAXDEPTH)
+    return NF_SUBSECTOR | leaves++;
+
+  memset(&n, 0, sizeof n);
+  if (w > h)
+    {
+      int x = l + w/4 + Random() % (w/2);
+
+      n.x = x; n.y = b; n.dx = 0; n.dy = h;
+      c0 = BuildNode(x, b, r, t, depth+1);
+      c1 = BuildNode(l, b, x, t, depth+1);
+      n.bbox[0][BOXTOP] = t; n.bbox[0][BOXBOTTOM] = b;
+      n.bbox[0][BOXLEFT] = x; n.bbox[0][BOXRIGHT] = r;
+      n.bbox[1][BOXTOP] = t; n.bbox[1][BOXBOTTOM] = b;
+      n.bbox[1][BOXLEFT] = l; n.bbox[1][BOXRIGHT] = x;
+    }
+  else
+    {
+      int y = b + h/4 + Random() % (h/2);
+
+      n.x = l; n.y = y; n.dx = w; n.dy = (int)(Random() % 3) - 1;
+      c0 = BuildNode(l, b, r, y, depth+1);
+      c1 = BuildNode(l, y, r, t, depth+1);
+      n.bbox[0][BOXTOP] = y+1; n.bbox[0][BOXBOTTOM] = b;
+      n.bbox[0][BOXLEFT] = l; n.bbox[0][BOXRIGHT] = r;
+      n.bbox[1][BOXTOP] = t; n.bbox[1][BOXBOTTOM] = y-1;
+      n.bbox[1][BOXLEFT] = l; n.bbox[1][BOXRIGHT] = r;
+    }
+  n.children[0] = c0;
+  n.children[1] = c1;
+  lump[lumpnodes] = n;
+  return lumpnodes++;
+}
+
+static sector_t sector;
+static vertex_t blockv1, blockv2;
+
+// One seg per subsector. Those of every blockmod'th subsector are one
+// sided, between two vertices put across each line of sight, so sight
+// stops there; the rest are two sided and never block.
+static void BuildMap(int blockmod)
+{
+  int i;
+
+  numsectors = 1;
+  sectors = &sector;
+  sector.heightsec = -1;
+  sector.floorheight = 0;
+  sector.ceilingheight = 128<<FRACBITS;
+  viewz = 41<<FRACBITS;
+
+  numsubsectors = numsegs = numlines = leaves;
+  subsectors = calloc(leaves, sizeof *subsectors);
+  segs = calloc(leaves, sizeof *segs);
+  lines = calloc(leaves, sizeof *lines);
+  for (i = 0; i < leaves; i++)
+    {
+      line_t *line = &lines[i];
+
+      subsectors[i].sector = &sector;
+      subsectors[i].firstline = i;
+      subsectors[i].numlines = 1;
+      segs[i].linedef = line;
+      segs[i].miniseg = true;   // the renderer leaves it alone
+      segs[i].frontsector = segs[i].backsector = &sector;
+      line->v1 = &blockv1;
+      line->v2 = &blockv2;
+      line->bbox[BOXTOP] = line->bbox[BOXRIGHT] = INT_MAX;
+      line->bbox[BOXBOTTOM] = line->bbox[BOXLEFT] = INT_MIN;
+      line->flags = blockmod && i % blockmod == 0 ? 0 : ML_TWOSIDED;
+    }
+}
+
+static void SetBlockMod(int blockmod)
+{
+  int i;
+
+  for (i = 0; i < leaves; i++)
+    lines[i].flags = blockmod && i % blockmod == 0 ? 0 : ML_TWOSIDED;
+}
+
+/*
+ * The code the new layout and walks replaced, from before they were
+ * changed: nodes in lump order with fixed_t coordinates, and recursion.
+ */
+
+typedef struct
+{
+  fixed_t  x,  y, dx, dy;        // Partition line.
+  fixed_t bbox[2][4];            // Bounding box for each child.
+  unsigned short children[2];    // If NF_SUBSECTOR its a subsector.
+} oldnode_t;
+
+static oldnode_t *oldnodes;
+
+static void Old_LoadNodes(void)
+{
+  int i, j, k;
+
+  oldnodes = malloc(lumpnodes * sizeof *oldnodes);
+  for (i=0; i<lumpnodes; i++)
+    {
+      oldnode_t *no = oldnodes + i;
+      const mapnode_t *mn = lump + i;
+
+      no->x = SHORT(mn->x)<<FRACBITS;
+      no->y = SHORT(mn->y)<<FRACBITS;
+      no->dx = SHORT(mn->dx)<<FRACBITS;
+      no->dy = SHORT(mn->dy)<<FRACBITS;
+      for (j=0 ; j<2 ; j++)
+        {
+          no->children[j] = SHORT(mn->children[j]);
+          for (k=0 ; k<4 ; k++)
+            no->bbox[j][k] = SHORT(mn->bbox[j][k])<<FRACBITS;
+        }
+    }
+}
+
+static int Old_PointOnSide(fixed_t x, fixed_t y, const oldnode_t *node)
+{
+  if (!node->dx)
+    return x <= node->x ? node->dy > 0 : node->dy < 0;
+
+  if (!node->dy)
+    return y <= node->y ? node->dx < 0 : node->dx > 0;
+
+  x -= node->x;
+  y -= node->y;
+
+  // Try to quickly decide by looking at sign bits.
+  if ((node->dy ^ node->dx ^ x ^ y) < 0)
+    return (node->dy ^ x) < 0;  // (left is negative)
+  return FixedMul(y, node->dx>>FRACBITS) >= FixedMul(node->dy>>FRACBITS, x);
+}
+
+// R_CheckBBox took the fixed_t box; it is the lump's shifted up, so
+// handing it the shorts back is the same check
+static boolean Old_CheckBBox(const fixed_t *bspcoord)
+{
+  short box[4];
+  int k;
+
+  for (k = 0; k < 4; k++)
+    box[k] = bspcoord[k]>>FRACBITS;
+  return R_CheckBBox(box);
+}
+
+static void Old_RenderBSPNode(int bspnum)
+{
+  while (!(bspnum & NF_SUBSECTOR))  // Found a subsector?
+    {
+      const oldnode_t *bsp = &oldnodes[bspnum];
+
+      // Decide which side the view point is on.
+      int side = Old_PointOnSide(viewx, viewy, bsp);
+      // Recursively divide front space.
+      Old_RenderBSPNode(bsp->children[side]);
+
+      // Possibly divide back space.
+
+      if (!Old_CheckBBox(bsp->bbox[side^1]))
+        return;
+
+      bspnum = bsp->children[side^1];
+    }
+  R_Subsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
+}
+
+static boolean Old_CrossBSPNode_LxDoom(int bspnum)
+{
+  while (!(bspnum & NF_SUBSECTOR))
+    {
+      register const oldnode_t *bsp = oldnodes + bspnum;
+      int side,side2;
+      side = Old_PointOnSide(los.strace.x, los.strace.y, bsp);
+      side2 = Old_PointOnSide(los.t2x, los.t2y, bsp);
+      if (side == side2)
+         bspnum = bsp->children[side]; // doesn't touch the other side
+      else         // the partition plane is crossed here
+        if (!Old_CrossBSPNode_LxDoom(bsp->children[side]))
+          return 0;  // cross the starting side
+        else
+          bspnum = bsp->children[side^1];  // cross the ending side
+    }
+  return P_CrossSubsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
+}
+
+static boolean Old_CrossBSPNode_PrBoom(int bspnum)
+{
+  while (!(bspnum & NF_SUBSECTOR))
+    {
+      register const oldnode_t *bsp = oldnodes + bspnum;
+      int side,side2;
+      side = P_DivlineSide(los.strace.x,los.strace.y,(const divline_t *)bsp)&1;
+      side2= P_DivlineSide(los.t2x, los.t2y, (const divline_t *) bsp);
+      if (side == side2)
+         bspnum = bsp->children[side]; // doesn't touch the other side
+      else         // the partition plane is crossed here
+        if (!Old_CrossBSPNode_PrBoom(bsp->children[side]))
+          return 0;  // cross the starting side
+        else
+          bspnum = bsp->children[side^1];  // cross the ending side
+    }
+  return P_CrossSubsector(bspnum == -1 ? 0 : bspnum & ~NF_SUBSECTOR);
+}
+
+static boolean Old_CrossBSPNode(int bspnum)
+{
+  if (compatibility_level == lxdoom_1_compatibility)
+    return Old_CrossBSPNode_LxDoom(bspnum);
+  else
+    return Old_CrossBSPNode_PrBoom(bspnum);
+}
+
+/*
+ * Views and lines of sight
+ */
+
+static fixed_t RandomCoord(void)
+{
+  return (fixed_t)(Random() % (2*HALFSIZE - 64) - HALFSIZE + 32) * FRACUNIT +
+    (Random() & 0xffff);
+}
+
+static int viewangletox_table[FINEANGLES/2];
+
+// A 90 degree field of view over SCREENWIDTH columns
+static void SetupView(void)
+{
+  int i;
+
+  clipangle = ANG45;
+  for (i = 0; i < FINEANGLES/2; i++)
+    {
+      int x = (FINEANGLES*3/8 - i) * SCREENWIDTH / (FINEANGLES/4);
+
+      viewangletox_table[i] = x < 0 ? 0 : x > SCREENWIDTH ? SCREENWIDTH : x;
+    }
+  viewangletox = viewangletox_table;
+}
+
+static void SetView(fixed_t x, fixed_t y, angle_t angle)
+{
+  viewx = x;
+  viewy = y;
+  viewangle = angle;
+  R_ClearClipSegs();
+  walktrace = tracecalls = 0;
+}
+
+// As P_CheckSight sets up los, with the blocking vertices put across
+// the middle of the line of sight
+static void SetSight(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2)
+{
+  double dx = (double)x2 - x1, dy = (double)y2 - y1;
+  double len = sqrt(dx*dx + dy*dy), mx = x1 + dx/2, my = y1 + dy/2;
+  double px = len ? -dy / len * (64 << FRACBITS) : 0;
+  double py = len ? dx / len * (64 << FRACBITS) : 64 << FRACBITS;
+
+  blockv1.x = mx + px; blockv1.y = my + py;
+  blockv2.x = mx - px; blockv2.y = my - py;
+
+  validcount++;
+  los.sightzstart = 41<<FRACBITS;
+  los.topslope = 128<<FRACBITS;
+  los.bottomslope = -(128<<FRACBITS);
+  los.strace.dx = (los.t2x = x2) - (los.strace.x = x1);
+  los.strace.dy = (los.t2y = y2) - (los.strace.y = y1);
+  los.bbox[BOXLEFT] = x1 < x2 ? x1 : x2;
+  los.bbox[BOXRIGHT] = x1 < x2 ? x2 : x1;
+  los.bbox[BOXBOTTOM] = y1 < y2 ? y1 : y2;
+  los.bbox[BOXTOP] = y1 < y2 ? y2 : y1;
+  los.maxz = INT_MAX;
+  los.minz = INT_MIN;
+}
+
+// Trace of the subsectors a sight check went through: their lines are
+// marked with the current validcount
+static unsigned SightTrace(unsigned *count)
+{
+  unsigned t = 0;
+  int i;
+
+  *count = 0;
+  for (i = 0; i < leaves; i++)
+    if (lines[i].validcount == validcount)
+      {
+        t = t * 31 + i;
+        (*count)++;
+      }
+  return t;
+}
+
+/*
+ * Tests
+ */
+
+// Walk the lump tree and the loaded one together: the same partitions,
+// boxes and leaves, and the loaded one numbered depth first, front
+// child first, from numnodes-1 down
+static void TestLoad(void)
+{
+  int *stack = malloc(2 * lumpnodes * sizeof *stack);
+  int sp = 0, next = numnodes - 1, ok = 1;
+
+  CHECK(numnodes == lumpnodes);
+  stack[sp++] = lumpnodes - 1;
+  stack[sp++] = numnodes - 1;
+  while (sp && ok)
+    {
+      int n = stack[--sp], m = stack[--sp], j, k;
+      const mapnode_t *mn = &lump[m];
+      const node_t *no = &nodes[n];
+
+      ok &= n == next--;
+      ok &= no->x == mn->x && no->y == mn->y && no->dx == mn->dx && no->dy == mn->dy;
+      for (j = 0; j < 2; j++)
+        for (k = 0; k < 4; k++)
+          ok &= no->bbox[j][k] == mn->bbox[j][k];
+      for (j = 1; j >= 0; j--)
+        if (mn->children[j] & NF_SUBSECTOR)
+          ok &= no->children[j] == mn->children[j];
+        else
+          {
+            stack[sp++] = mn->children[j];
+            stack[sp++] = no->children[j];
+          }
+    }
+  CHECK(ok && next == -1);
+  free(stack);
+}
+
+// Nodes that aren't a tree are loaded in lump order
+static void TestLoadNotTree(void)
+{
+  mapnode_t *bad = malloc(lumpnodes * sizeof *bad);
+  int i, j, k, ok = 1;
+
+  memcpy(bad, lump, lumpnodes * sizeof *bad);
+  for (i = 0; i < lumpnodes && (bad[i].children[0] & NF_SUBSECTOR); i++)
+    ;
+  bad[i].children[0] = lumpnodes - 1;  // a cycle back to the root
+  lumpdata = (const byte *)bad;
+  P_LoadNodes(0);
+  for (i = 0; i < numnodes; i++)
+    {
+      ok &= nodes[i].x == bad[i].x && nodes[i].dy == bad[i].dy;
+      for (j = 0; j < 2; j++)
+        {
+          ok &= nodes[i].children[j] == bad[i].children[j];
+          for (k = 0; k < 4; k++)
+            ok &= nodes[i].bbox[j][k] == bad[i].bbox[j][k];
+        }
+    }
+  CHECK(ok);
+  Z_Free(nodes);
+  free(bad);
+
+  lumpdata = (const byte *)lump;
+  P_LoadNodes(0);
+}
+
+#define VIEWS 2000
+#define SIGHTS 20000
+#define SIGHTCHECKS 2000   /* each scans every line for the trace */
+
+static fixed_t px[SIGHTS], py[SIGHTS], qx[SIGHTS], qy[SIGHTS];
+
+static void TestRender(void)
+{
+  unsigned long long visited = 0;
+  int i, ok = 1;
+
+  for (i = 0; i < VIEWS; i++)
+    {
+      angle_t angle = Random() << 8;
+      unsigned oldtrace, oldcalls;
+
+      SetView(px[i], py[i], angle);
+      Old_RenderBSPNode(lumpnodes-1);
+      oldtrace = walktrace;
+      oldcalls = tracecalls;
+      SetView(px[i], py[i], angle);
+      R_RenderBSPNode(numnodes-1);
+      ok &= walktrace == oldtrace && tracecalls == oldcalls;
+      visited += tracecalls;
+    }
+  CHECK(ok);
+  printf("render: %d views, %.0f subsectors each\n", VIEWS, (double)visited / VIEWS);
+}
+
+// blockmod 0 is none blocking
+static void TestSight(complevel_t level, int blockmod)
+{
+  unsigned long long crossed = 0;
+  int i, seen = 0, ok = 1;
+
+  compatibility_level = level;
+  SetBlockMod(blockmod);
+  for (i = 0; i < SIGHTCHECKS; i++)
+    {
+      // Mostly short lines of sight, as monsters have
+      fixed_t x2 = i % 4 ? px[i] + (qx[i] >> 3) : qx[i];
+      fixed_t y2 = i % 4 ? py[i] + (qy[i] >> 3) : qy[i];
+      boolean oldr, newr;
+      unsigned oldtrace, oldcount, newtrace, newcount;
+
+      SetSight(px[i], py[i], x2, y2);
+      oldr = Old_CrossBSPNode(lumpnodes-1);
+      oldtrace = SightTrace(&oldcount);
+      SetSight(px[i], py[i], x2, y2);
+      newr = P_CrossBSPNode(numnodes-1);
+      newtrace = SightTrace(&newcount);
+      ok &= oldr == newr && oldtrace == newtrace && oldcount == newcount;
+      seen += newr;
+      crossed += newcount;
+    }
+  CHECK(ok);
+  printf("sight, %s, %s blocking: %d of %d seen, %.1f subsectors each\n",
+         level == lxdoom_1_compatibility ? "LxDoom" : "PrBoom",
+         blockmod == 97 ? "1 in 97" : blockmod == 13 ? "1 in 13" : "none",
+         seen, SIGHTCHECKS, (double)crossed / SIGHTCHECKS);
+}
+
+/*
+ * Benchmark: best of several runs
+ */
+
+#define RUNS 9
+
+static double Best(void (*run)(void))
+{
+  double best = 1e9;
+  int r;
+
+  for (r = 0; r < RUNS; r++)
+    {
+      double start = host_now(), t;
+
+      run();
+      if ((t = host_now() - start) < best)
+        best = t;
+    }
+  return best;
+}
+
+static void RunOldRender(void)
+{
+  int i;
+
+  for (i = 0; i < VIEWS/4; i++)
+    {
+      SetView(px[i], py[i], i * 0x9e3779b9u);
+      Old_RenderBSPNode(lumpnodes-1);
+    }
+}
+
+static void RunNewRender(void)
+{
+  int i;
+
+  for (i = 0; i < VIEWS/4; i++)
+    {
+      SetView(px[i], py[i], i * 0x9e3779b9u);
+      R_RenderBSPNode(numnodes-1);
+    }
+}
+
+static void RunOldSight(void)
+{
+  int i;
+
+  for (i = 0; i < SIGHTS/4; i++)
+    {
+      SetSight(px[i], py[i], px[i] + (qx[i] >> 3), py[i] + (qy[i] >> 3));
+      Old_CrossBSPNode(lumpnodes-1);
+    }
+}
+
+static void RunNewSight(void)
+{
+  int i;
+
+  for (i = 0; i < SIGHTS/4; i++)
+    {
+      SetSight(px[i], py[i], px[i] + (qx[i] >> 3), py[i] + (qy[i] >> 3));
+      P_CrossBSPNode(numnodes-1);
+    }
+}
+
+static void Benchmark(void)
+{
+  double oldr, newr, olds, news;
+
+  compatibility_level = prboom_6_compatibility;
+  SetBlockMod(97);
+  oldr = Best(RunOldRender);
+  newr = Best(RunNewRender);
+  olds = Best(RunOldSight);
+  news = Best(RunNewSight);
+  printf("best of %d, old -> new: R_RenderBSPNode %.1f -> %.1f us, "
+         "P_CrossBSPNode %.2f -> %.2f us\n", RUNS,
+         oldr / (VIEWS/4) * 1e6, newr / (VIEWS/4) * 1e6,
+         olds / (SIGHTS/4) * 1e6, news / (SIGHTS/4) * 1e6);
+  printf("node size %u -> %u bytes\n", (unsigned)sizeof(oldnode_t), (unsigned)sizeof(node_t));
+}
+
+int main(void)
+{
+  int i;
+
+  lump = malloc((MAXNODES + MAXDEPTH + 2) * sizeof *lump);
+  BuildNode(-HALFSIZE, -HALFSIZE, HALFSIZE, HALFSIZE, 0);
+  lumpdata = (const byte *)lump;
+  lumpsize = lumpnodes * sizeof *lump;
+  printf("%d nodes, %d subsectors\n", lumpnodes, leaves);
+
+  BuildMap(0);
+  Old_LoadNodes();
+  P_LoadNodes(0);
+  TestLoad();
+  TestLoadNotTree();
+  TestLoad();
+
+  for (i = 0; i < SIGHTS; i++)
+    {
+      px[i] = RandomCoord();
+      py[i] = RandomCoord();
+      qx[i] = RandomCoord();
+      qy[i] = RandomCoord();
+    }
+  SetupView();
+  TestRender();
+  TestSight(lxdoom_1_compatibility, 0);
+  TestSight(lxdoom_1_compatibility, 97);
+  TestSight(prboom_6_compatibility, 0);
+  TestSight(prboom_6_compatibility, 13);
+
+  Benchmark();
+  return host_finish("bsp_test");
+}
@@ -0,0 +1,521 @@
+/*
+ * Column drawer tests, and benchmark
+ *
+ * r_draw.c is included whole, with the point sampled kernels for one
+ * depth: 8-bit, or 16-bit when built with HOST_RENDER_RGB565. The
+ * kernels gather up to four adjacent columns in a buffer and flush them
+ * together, the rows they share a quad at a time. Gathering is only
+ * worth having if it draws what the columns drawn one at a time would:
+ *
+ *  - walls, one column at every x, and sprites, a few posts a column,
+ *    opaque, translucent and translated, at every alignment of the view
+ *    window in the frame buffer, are the same pixels flushed in quads as
+ *    flushed one column at a time
+ *  - opaque walls and sprites are the same pixels as gathered the way
+ *    the kernels did before quads broke at 4 pixel boundaries, kept
+ *    here as it was
+ *  - fuzz columns, which read their neighbours and so depend on how
+ *    they are flushed, write nothing outside their own columns
+ *
+ * then times the gathering as it was against as it is.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../components/prboom/r_draw.c"
+#include "md5.h"
+#include "host_support.h"
+
+/*
+ * What r_draw.c links against. The border, the view window and the
+ * translation tables are never set up.
+ */
+
+int centery, numcolormaps, mapcolor_plyr[4];
+const lighttable_t **colormaps, *fullcolormap;
+GameMode_t gamemode;
+screeninfo_t screens[NUM_SCREENS];
+unsigned short *V_Palette16;
+V_DrawBackground_f V_DrawBackground;
+V_DrawNumPatch_f V_DrawNumPatch;
+
+video_mode_t V_GetMode(void) { return RDRAW_ONLY_BITS == 8 ? VID_MODE8 : VID_MODE16; }
+int V_GetNumPixelBits(void) { return RDRAW_ONLY_BITS; }
+int V_GetPixelDepth(void) { return RDRAW_ONLY_BITS / 8; }
+void V_UpdateTrueColorPalette(video_mode_t mode) {}
+int W_GetNumForName(const char *name) { return -1; }
+const void *W_CacheLumpNum(int lump) { return NULL; }
+void W_UnlockLumpNum(int lump) {}
+void MD5Init(struct MD5Context *context) {}
+void MD5Update(struct MD5Context *context, md5byte const *buf, unsigned len) {}
+void MD5Final(unsigned char digest[16], struct MD5Context *context) {}
+
+#if RDRAW_ONLY_BITS == 8
+typedef byte pixel_t;
+#define R_DrawColumnKernel R_DrawColumn8_PointUV_PointZ
+#define R_DrawTLColumnKernel R_DrawTLColumn8_PointUV_PointZ
+#define R_DrawTranslatedColumnKernel R_DrawTranslatedColumn8_PointUV_PointZ
+#define R_DrawFuzzColumnKernel R_DrawFuzzColumn8_PointUV_PointZ
+#define SCREEN_TOPLEFT byte_topleft
+#define SCREEN_PITCH byte_pitch
+#else
+typedef unsigned short pixel_t;
+#define R_DrawColumnKernel R_DrawColumn16_PointUV_PointZ
+#define R_DrawTLColumnKernel R_DrawTLColumn16_PointUV_PointZ
+#define R_DrawTranslatedColumnKernel R_DrawTranslatedColumn16_PointUV_PointZ
+#define R_DrawFuzzColumnKernel R_DrawFuzzColumn16_PointUV_PointZ
+#define SCREEN_TOPLEFT short_topleft
+#define SCREEN_PITCH short_pitch
+#endif
+
+/*
+ * Opaque columns gathered as they were before quads broke at 4 pixel
+ * boundaries: a quad was any four adjacent columns, and only the 8-bit
+ * flush used word stores, when the quad happened to be aligned.
+ * Textures are a power of 2 high.
+ */
+
+static pixel_t old_tempbuf[MAX_SCREENHEIGHT * 4];
+static int old_temp_x, old_startx, old_commontop, old_commonbot;
+static int old_tempyl[4], old_tempyh[4];
+
+static void Old_FlushWhole(void)
+{
+  while (--old_temp_x >= 0)
+    {
+      int yl = old_tempyl[old_temp_x], count = old_tempyh[old_temp_x] - yl + 1;
+      pixel_t *source = &old_tempbuf[old_temp_x + (yl << 2)];
+      pixel_t *dest = drawvars.SCREEN_TOPLEFT + yl*drawvars.SCREEN_PITCH + old_startx + old_temp_x;
+
+      while (--count >= 0)
+        {
+          *dest = *source;
+          source += 4;
+          dest += drawvars.SCREEN_PITCH;
+        }
+    }
+}
+
+static void Old_FlushHT(void)
+{
+  int colnum;
+
+  for (colnum = 0; colnum < 4; colnum++)
+    {
+      int yl = old_tempyl[colnum], yh = old_tempyh[colnum], count, y;
+
+      for (y = yl, count = old_commontop - yl; count > 0; y++, count--)
+        drawvars.SCREEN_TOPLEFT[y*drawvars.SCREEN_PITCH + old_startx + colnum] =
+          old_tempbuf[colnum + (y << 2)];
+      for (y = old_commonbot + 1, count = yh - old_commonbot; count > 0; y++, count--)
+        drawvars.SCREEN_TOPLEFT[y*drawvars.SCREEN_PITCH + old_startx + colnum] =
+          old_tempbuf[colnum + (y << 2)];
+    }
+}
+
+static void Old_FlushQuad(void)
+{
+  pixel_t *source = &old_tempbuf[old_commontop << 2];
+  pixel_t *dest = drawvars.SCREEN_TOPLEFT + old_commontop*drawvars.SCREEN_PITCH + old_startx;
+  int count = old_commonbot - old_commontop + 1;
+
+#if RDRAW_ONLY_BITS == 8
+  if ((sizeof(int) == 4) && ((((int)(size_t)source | (int)(size_t)dest) & 3) == 0))
+    {
+      while (--count >= 0)
+        {
+          *(int *)dest = *(int *)source;
+          source += 4;
+          dest += drawvars.SCREEN_PITCH;
+        }
+      return;
+    }
+#endif
+  while (--count >= 0)
+    {
+      dest[0] = source[0];
+      dest[1] = source[1];
+      dest[2] = source[2];
+      dest[3] = source[3];
+      source += 4;
+      dest += drawvars.SCREEN_PITCH;
+    }
+}
+
+static void Old_FlushColumns(void)
+{
+  if (old_temp_x != 4 || old_commontop >= old_commonbot)
+    Old_FlushWhole();
+  else
+    {
+      Old_FlushHT();
+      Old_FlushQuad();
+    }
+  old_temp_x = 0;
+}
+
+static void Old_ResetColumnBuffer(void)
+{
+  if (old_temp_x)
+    Old_FlushColumns();
+}
+
+static void Old_DrawColumn(draw_column_vars_t *dcvars)
+{
+  int count = dcvars->yh - dcvars->yl;
+  const fixed_t fracstep = dcvars->iscale;
+  fixed_t frac = dcvars->texturemid + (dcvars->yl-centery)*fracstep;
+  const fixed_t mask = ((dcvars->texheight-1)<<FRACBITS)|0xffff;
+  const byte *source = dcvars->source;
+#if RDRAW_ONLY_BITS == 8
+  const lighttable_t *colormap = dcvars->colormap;
+#else
+  const unsigned short *colormap = R_Colormap16(dcvars->colormap);
+#endif
+  pixel_t *dest;
+
+  if (count < 0)
+    return;
+
+  if (old_temp_x == 4 || (old_temp_x && old_temp_x + old_startx != dcvars->x))
+    Old_FlushColumns();
+  if (!old_temp_x)
+    {
+      old_startx = dcvars->x;
+      old_tempyl[0] = old_commontop = dcvars->yl;
+      old_tempyh[0] = old_commonbot = dcvars->yh;
+      dest = &old_tempbuf[dcvars->yl << 2];
+    }
+  else
+    {
+      old_tempyl[old_temp_x] = dcvars->yl;
+      old_tempyh[old_temp_x] = dcvars->yh;
+      if (dcvars->yl > old_commontop)
+        old_commontop = dcvars->yl;
+      if (dcvars->yh < old_commonbot)
+        old_commonbot = dcvars->yh;
+      dest = &old_tempbuf[(dcvars->yl << 2) + old_temp_x];
+    }
+  old_temp_x++;
+
+  // The kernel's own loops, so that only the gathering differs
+  count++;
+  if (dcvars->texheight == 128)
+    while (count--)
+      {
+        *dest = colormap[source[(frac & mask) >> FRACBITS]];
+        dest += 4;
+        frac += fracstep;
+      }
+  else
+    {
+      while ((count -= 2) >= 0)
+        {
+          *dest = colormap[source[(frac & mask) >> FRACBITS]];
+          dest += 4;
+          frac += fracstep;
+          *dest = colormap[source[(frac & mask) >> FRACBITS]];
+          dest += 4;
+          frac += fracstep;
+        }
+      if (count & 1)
+        *dest = colormap[source[(frac & mask) >> FRACBITS]];
+    }
+}
+
+/*
+ * The view and its frame buffers. Rows are a little wider than the view
+ * and there is a row above and below, so anything drawn out of place
+ * shows as a difference. The view starts up to 3 pixels into a row.
+ */
+
+#define FRAMEWIDTH  320
+#define FRAMEHEIGHT 200
+#define PITCH      (FRAMEWIDTH + 8)
+#define SCREENSIZE ((FRAMEHEIGHT + 2) * PITCH)
+
+static pixel_t screen_new[SCREENSIZE], screen_old[SCREENSIZE];
+static int viewoffset;
+
+static void SetScreen(pixel_t *screen)
+{
+  drawvars.SCREEN_TOPLEFT = screen + PITCH + viewoffset;
+}
+
+static void ClearScreens(void)
+{
+  int i;
+
+  for (i = 0; i < SCREENSIZE; i++)
+    screen_new[i] = screen_old[i] = (pixel_t)(0x5aa5 + i);
+}
+
+#define NUMTEXTURES 4
+#define TEXHEIGHT   128
+
+static byte wallsources[NUMTEXTURES][TEXHEIGHT];
+static byte translation[256];
+
+// Random colormaps, palette, translucency map and textures
+static void Setup(void)
+{
+  static lighttable_t colormap[(NUMCOLORMAPS+2)*256];
+  static const lighttable_t *maps[1];
+  static byte tranmap_data[256*256];
+  int i, j;
+
+  for (i = 0; i < sizeof colormap; i++)
+    colormap[i] = rand();
+  maps[0] = colormap;
+  colormaps = maps;
+  numcolormaps = 1;
+  fullcolormap = colormap;
+
+  V_Palette16 = malloc(256 * VID_NUMCOLORWEIGHTS * sizeof *V_Palette16);
+  for (i = 0; i < 256 * VID_NUMCOLORWEIGHTS; i++)
+    V_Palette16[i] = rand();
+
+  for (i = 0; i < sizeof tranmap_data; i++)
+    tranmap_data[i] = rand();
+  tranmap = tranmap_data;
+  for (i = 0; i < 256; i++)
+    translation[i] = rand();
+  for (i = 0; i < NUMTEXTURES; i++)
+    for (j = 0; j < TEXHEIGHT; j++)
+      wallsources[i][j] = rand();
+  for (i = 0; i < FUZZTABLE; i++)
+    fuzzoffset[i] = fuzzoffset_org[i] * PITCH;
+
+  drawvars.SCREEN_PITCH = PITCH;
+  viewwidth = FRAMEWIDTH;
+  viewheight = FRAMEHEIGHT;
+  centery = FRAMEHEIGHT / 2;
+}
+
+/*
+ * Columns, as R_RenderSegLoop and R_DrawMaskedColumn would hand them
+ * to the drawers: walls one at every x, taller or shorter than their
+ * neighbours in runs; sprites a few at a time, each column split into
+ * one to three posts
+ */
+
+#define MAXCOLUMNS (FRAMEWIDTH * 8)
+
+static draw_column_vars_t columns[MAXCOLUMNS];
+static int numcolumns;
+
+static draw_column_vars_t *NewColumn(int x, int yl, int yh, fixed_t iscale)
+{
+  draw_column_vars_t *dc = &columns[numcolumns++];
+
+  R_SetDefaultDrawColumnVars(dc);
+  dc->x = x;
+  dc->yl = yl;
+  dc->yh = yh;
+  dc->iscale = iscale;
+  dc->texturemid = (rand() % TEXHEIGHT) << FRACBITS;
+  dc->texheight = rand() % 4 ? TEXHEIGHT : TEXHEIGHT / 2;
+  dc->source = wallsources[rand() % NUMTEXTURES];
+  dc->colormap = colormaps[0] + rand() % NUMCOLORMAPS * 256;
+  dc->translation = translation;
+  return dc;
+}
+
+static void BuildWalls(void)
+{
+  int x = 0;
+
+  numcolumns = 0;
+  while (x < FRAMEWIDTH)
+    {
+      int x2 = x + rand() % 40, top = rand() % (FRAMEHEIGHT / 2);
+      int bottom = FRAMEHEIGHT / 2 + rand() % (FRAMEHEIGHT / 2);
+      int slope = rand() % 5 - 2;
+      fixed_t iscale = FRACUNIT / 4 + rand() % (2 * FRACUNIT);
+
+      for (; x <= x2 && x < FRAMEWIDTH; x++)
+        {
+          top = top + slope < 0 ? 0 : top + slope;
+          bottom = bottom - slope >= FRAMEHEIGHT ? FRAMEHEIGHT - 1 : bottom - slope;
+          NewColumn(x, top, bottom, iscale);
+        }
+    }
+}
+
+static void BuildSprites(int count)
+{
+  numcolumns = 0;
+  while (count--)
+    {
+      int width = 1 + rand() % 40, x = rand() % FRAMEWIDTH, i;
+      int top = rand() % FRAMEHEIGHT, height = 1 + rand() % 120;
+      fixed_t iscale = FRACUNIT / 2 + rand() % FRACUNIT;
+
+      for (i = 0; i < width && x + i < FRAMEWIDTH; i++)
+        {
+          int posts = 1 + rand() % 3, yl = top + rand() % 4;
+
+          while (posts-- && yl < FRAMEHEIGHT && numcolumns < MAXCOLUMNS)
+            {
+              int yh = yl + rand() % (height / 2 + 1);
+
+              if (yh >= FRAMEHEIGHT)
+                yh = FRAMEHEIGHT - 1;
+              NewColumn(x + i, yl, yh, iscale)->drawingmasked = 1;
+              yl = yh + 2 + rand() % 8;
+            }
+        }
+    }
+}
+
+// Draws the columns; alone flushes each before the next is drawn
+static void DrawColumns(R_DrawColumn_f draw, pixel_t *screen, int alone)
+{
+  int i;
+
+  SetScreen(screen);
+  for (i = 0; i < numcolumns; i++)
+    {
+      draw_column_vars_t dc = columns[i];
+
+      draw(&dc);
+      if (alone)
+        R_ResetColumnBuffer();
+    }
+  R_ResetColumnBuffer();
+}
+
+static void Old_DrawColumns(pixel_t *screen)
+{
+  int i;
+
+  SetScreen(screen);
+  for (i = 0; i < numcolumns; i++)
+    Old_DrawColumn(&columns[i]);
+  Old_ResetColumnBuffer();
+}
+
+static void TestColumns(void)
+{
+  static const R_DrawColumn_f kernels[] = {
+    R_DrawColumnKernel, R_DrawTLColumnKernel, R_DrawTranslatedColumnKernel
+  };
+  int k, round, quads = 0, alone = 1, old = 1;
+
+  for (viewoffset = 0; viewoffset < 4; viewoffset++)
+    for (round = 0; round < 16; round++)
+      {
+        if (round & 1)
+          BuildWalls();
+        else
+          BuildSprites(12);
+
+        for (k = 0; k < sizeof kernels / sizeof *kernels; k++)
+          {
+            ClearScreens();
+            DrawColumns(kernels[k], screen_new, 0);
+            DrawColumns(kernels[k], screen_old, 1);
+            alone &= !memcmp(screen_new, screen_old, sizeof screen_new);
+          }
+
+        ClearScreens();
+        DrawColumns(R_DrawColumnKernel, screen_new, 0);
+        Old_DrawColumns(screen_old);
+        old &= !memcmp(screen_new, screen_old, sizeof screen_new);
+      }
+  CHECK(alone);
+  CHECK(old);
+
+  // Enough full quads that the quad flush was tested, not just the
+  // column at a time one
+  viewoffset = 0;
+  BuildWalls();
+  SetScreen(screen_new);
+  for (k = 0; k < numcolumns; k++)
+    {
+      draw_column_vars_t dc = columns[k];
+
+      R_DrawColumnKernel(&dc);
+      quads += temp_x == 4 && commontop < commonbot;
+    }
+  R_ResetColumnBuffer();
+  CHECK(quads >= FRAMEWIDTH / 4 - 16);
+}
+
+static void TestFuzz(void)
+{
+  static byte inside[SCREENSIZE];
+  int i, ok = 1;
+
+  for (viewoffset = 0; viewoffset < 4; viewoffset++)
+    {
+      BuildSprites(12);
+      memset(inside, 0, sizeof inside);
+      for (i = 0; i < numcolumns; i++)
+        {
+          int y;
+
+          for (y = columns[i].yl; y <= columns[i].yh; y++)
+            inside[PITCH + viewoffset + y * PITCH + columns[i].x] = 1;
+        }
+      ClearScreens();
+      DrawColumns(R_DrawFuzzColumnKernel, screen_new, 0);
+      for (i = 0; i < SCREENSIZE; i++)
+        ok &= inside[i] || screen_new[i] == screen_old[i];
+    }
+  CHECK(ok);
+}
+
+/*
+ * Timings, the two taking turns, best of several runs, in microseconds
+ * per frame of walls and per frame of sprites
+ */
+
+static void Time(const char *what)
+{
+  double oldt = 1e9, newt = 1e9;
+  int run, r;
+
+  for (run = 0; run < 9; run++)
+    {
+      double start = host_now(), t;
+
+      for (r = 0; r < 200; r++)
+        Old_DrawColumns(screen_old);
+      t = (host_now() - start) * 1e6 / 200;
+      if (t < oldt)
+        oldt = t;
+
+      start = host_now();
+      for (r = 0; r < 200; r++)
+        DrawColumns(R_DrawColumnKernel, screen_new, 0);
+      t = (host_now() - start) * 1e6 / 200;
+      if (t < newt)
+        newt = t;
+    }
+  printf("%d-bit, %s: any 4 columns %.1fus, aligned quads %.1fus\n",
+         RDRAW_ONLY_BITS, what, oldt, newt);
+}
+
+static void Benchmark(void)
+{
+  for (viewoffset = 0; viewoffset < 4; viewoffset += 3)
+    {
+      printf("view %d pixels into the row\n", viewoffset);
+      BuildWalls();
+      Time("walls");
+      BuildSprites(40);
+      Time("sprites");
+    }
+}
+
+int main(void)
+{
+  srand(1);
+  Setup();
+  TestColumns();
+  TestFuzz();
+  Benchmark();
+  return host_finish(RDRAW_ONLY_BITS == 8 ? "column_test" : "column_test16");
+}
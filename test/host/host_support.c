@@ -0,0 +1,116 @@
+/*
+ * Shared pieces for host tests that link engine sources; see
+ * host_support.h.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "doomtype.h"
+#include "lprintf.h"
+#include "z_zone.h"
+#include "host_support.h"
+
+/* The zone macros would turn the libc calls below into recursion */
+#undef malloc
+#undef free
+#undef realloc
+#undef calloc
+#undef strdup
+
+int failures;
+jmp_buf error_jmp;
+int error_catch;
+char error_msg[256];
+int zone_failrealloc;
+
+int lprintf(OutputLevels pri, const char *fmt, ...)
+{
+  va_list ap;
+  int r = 0;
+
+  if (getenv("HOST_VERBOSE"))
+    {
+      va_start(ap, fmt);
+      r = vfprintf(stderr, fmt, ap);
+      va_end(ap);
+    }
+  return r;
+}
+
+void I_Error(const char *error, ...)
+{
+  va_list ap;
+
+  va_start(ap, error);
+  vsnprintf(error_msg, sizeof error_msg, error, ap);
+  va_end(ap);
+  if (error_catch)
+    {
+      error_catch = 0;
+      longjmp(error_jmp, 1);
+    }
+  fprintf(stderr, "I_Error: %s\n", error_msg);
+  exit(2);
+}
+
+void *(Z_Malloc)(size_t size, int tag, void **user)
+{
+  void *p = malloc(size ? size : 1);
+
+  if (!p)
+    I_Error("Z_Malloc: Failure trying to allocate %lu bytes", (unsigned long)size);
+  if (user)
+    *user = p;
+  return p;
+}
+
+void (Z_Free)(void *p)
+{
+  free(p);
+}
+
+void *(Z_Calloc)(size_t n, size_t n2, int tag, void **user)
+{
+  return memset((Z_Malloc)(n * n2, tag, user), 0, n * n2);
+}
+
+void *(Z_Realloc)(void *p, size_t n, int tag, void **user)
+{
+  if (zone_failrealloc)
+    {
+      zone_failrealloc--;
+      return NULL;
+    }
+  p = realloc(p, n ? n : 1);
+  if (!p)
+    I_Error("Z_Realloc: Failure trying to allocate %lu bytes", (unsigned long)n);
+  if (user)
+    *user = p;
+  return p;
+}
+
+char *(Z_Strdup)(const char *s, int tag, void **user)
+{
+  return strcpy((Z_Malloc)(strlen(s) + 1, tag, user), s);
+}
+
+double host_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int host_finish(const char *name)
+{
+  if (failures)
+    printf("%s: %d checks failed\n", name, failures);
+  else
+    printf("%s: all checks passed\n", name);
+  return !!failures;
+}
@@ -0,0 +1,38 @@
+/*
+ * Shared pieces for host tests that link engine sources: a CHECK
+ * macro, I_Error that a test can catch, lprintf to stderr when
+ * HOST_VERBOSE is set, and the zone on top of libc.
+ */
+
+#ifndef HOST_SUPPORT_H
+#define HOST_SUPPORT_H
+
+#include <setjmp.h>
+#include <stdio.h>
+
+extern int failures;
+
+#define CHECK(cond) do { if (!(cond)) { \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    failures++; } } while (0)
+
+/* While error_catch is set, I_Error longjmps to error_jmp with the
+ * message in error_msg instead of exiting */
+extern jmp_buf error_jmp;
+extern int error_catch;
+extern char error_msg[256];
+
+#define CATCH_ERROR() (error_catch = 1, setjmp(error_jmp))
+#define END_CATCH()   (error_catch = 0)
+
+/* Make the next n zone reallocs fail, as libc's would, so callers'
+ * NULL checks can be exercised; the real zone I_Errors instead */
+extern int zone_failrealloc;
+
+/* Seconds on the monotonic clock, for the benchmarks */
+double host_now(void);
+
+/* Exit status for main: prints the summary line */
+int host_finish(const char *name);
+
+#endif
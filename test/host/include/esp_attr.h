@@ -0,0 +1,5 @@
+/* Host stand-in: no IRAM/DRAM placement off the chip */
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
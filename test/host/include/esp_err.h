@@ -0,0 +1,6 @@
+/* Host stand-in */
+#pragma once
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
@@ -0,0 +1,11 @@
+/* Host stand-in: one heap, whatever the caps */
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT     (1<<2)
+#define MALLOC_CAP_SPIRAM   (1<<10)
+#define MALLOC_CAP_INTERNAL (1<<11)
+
+static inline void *heap_caps_malloc(size_t size, unsigned caps) { return malloc(size); }
+static inline void heap_caps_free(void *p) { free(p); }
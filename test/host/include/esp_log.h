@@ -0,0 +1,10 @@
+/* Host stand-in; each test supplies esp_log_write */
+#pragma once
+
+typedef enum { ESP_LOG_ERROR = 1, ESP_LOG_WARN, ESP_LOG_INFO } esp_log_level_t;
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...);
+
+#define ESP_LOGE(tag, format, ...) esp_log_write(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) esp_log_write(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) esp_log_write(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
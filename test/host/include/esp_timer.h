@@ -0,0 +1,6 @@
+/* Host stand-in; each test supplies the clock */
+#pragma once
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
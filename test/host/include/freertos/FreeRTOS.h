@@ -0,0 +1,11 @@
+/* Host stand-in: just the types and constants the code under test uses */
+#pragma once
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define portMAX_DELAY ((TickType_t)0xffffffff)
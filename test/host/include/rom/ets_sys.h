@@ -0,0 +1,2 @@
+/* Host stand-in: nothing from the ROM is used */
+#pragma once
@@ -0,0 +1,12 @@
+/* Host stand-in for the menuconfig output, just what the code under
+ * test looks at. Renderer tests built with HOST_RENDER_RGB565 get the
+ * 16-bit kernels instead of the 8-bit ones. */
+#pragma once
+
+#define CONFIG_DOOM_NETPLAY 1
+#define CONFIG_KEYPAD_UART_BAUD 115200
+#ifdef HOST_RENDER_RGB565
+#define CONFIG_DOOM_RENDER_RGB565 1
+#else
+#define CONFIG_DOOM_RENDER_8BIT_ONLY 1
+#endif
@@ -0,0 +1,315 @@
+/*
+ * Input ring tests
+ *
+ * Scripted events go in through I_PostInput and come out of
+ * I_ProcessInput into D_PostEvent, against a fake esp_timer clock:
+ * ordering and key mapping, the latency line, a full ring dropping and
+ * counting, many laps of wrap, and several producer threads posting
+ * against a consumer at once.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "doomtype.h"
+#include "d_event.h"
+#include "i_input.h"
+#include "lprintf.h"
+
+#define RINGSIZE 64   /* INPUT_RINGSIZE in i_input.c */
+#define LATENCYBATCH 256
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    failures++; } } while (0)
+
+/* The bindings I_ProcessInput maps actions through */
+int key_up = 'u', key_down = 'd', key_left = 'l', key_right = 'r';
+int key_fire = 'f', key_use = ' ', key_strafeleft = ',', key_straferight = '.';
+int key_enter = 13, key_escape = 27, key_map = 9, key_weapontoggle = '0';
+
+static const int *const keys[NUMINPUTACTIONS] = {
+    &key_up, &key_down, &key_left, &key_right, &key_fire, &key_use,
+    &key_strafeleft, &key_straferight, &key_enter, &key_escape, &key_map,
+    &key_weapontoggle,
+};
+
+static long long clock_us;
+
+int64_t esp_timer_get_time(void)
+{
+    return __atomic_load_n(&clock_us, __ATOMIC_RELAXED);
+}
+
+#define MAXEVENTS 1024
+
+static event_t events[MAXEVENTS];
+static int numevents;
+
+void D_PostEvent(event_t *ev)
+{
+    if (numevents < MAXEVENTS)
+        events[numevents] = *ev;
+    numevents++;
+}
+
+/* The latency line I_ProcessInput logs every LATENCYBATCH events */
+static unsigned lat_avg, lat_max, lat_dropped;
+static int lat_lines;
+
+int lprintf(OutputLevels pri, const char *fmt, ...)
+{
+    char buf[256];
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof buf, fmt, ap);
+    va_end(ap);
+    if (sscanf(buf, "I_ProcessInput: latency avg %uus max %uus, %u dropped",
+               &lat_avg, &lat_max, &lat_dropped) == 3)
+        lat_lines++;
+    return 0;
+}
+
+void I_Error(const char *error, ...)
+{
+    exit(1);
+}
+
+/* Events delivered so far, which the latency counter is also at */
+static unsigned delivered;
+
+static void Process(void)
+{
+    int before = numevents;
+
+    I_ProcessInput();
+    delivered += numevents - before;
+}
+
+static void TestOrder(void)
+{
+    static const struct { inputaction_t action; boolean down; } script[] = {
+        { IA_UP, true }, { IA_FIRE, true }, { IA_UP, false },
+        { IA_STRAFELEFT, true }, { IA_FIRE, false }, { IA_STRAFELEFT, false },
+        { IA_ESCAPE, true }, { IA_ESCAPE, false },
+    };
+    int i, n = sizeof script / sizeof *script;
+
+    numevents = 0;
+    for (i = 0; i < n; i++)
+        I_PostInput(script[i].action, script[i].down);
+    CHECK(numevents == 0);
+
+    /* Rebinding before the drain applies to what is queued */
+    key_fire = 'F';
+    Process();
+    CHECK(numevents == n);
+    for (i = 0; i < n && i < numevents; i++) {
+        CHECK(events[i].type == (script[i].down ? ev_keydown : ev_keyup));
+        CHECK(events[i].data1 == *keys[script[i].action]);
+    }
+    key_fire = 'f';
+
+    /* Nothing left over */
+    Process();
+    CHECK(numevents == n);
+}
+
+static void TestLatency(void)
+{
+    static const int delays[] = { 100, 400, 200, 300 };
+    int round, i;
+
+    /* Fill out the current batch with zero latency events first, so the
+     * next line covers only what follows */
+    while (delivered % LATENCYBATCH) {
+        numevents = 0;
+        I_PostInput(IA_USE, true);
+        Process();
+    }
+    lat_lines = 0;
+
+    /* Four rounds of events posted at one time and drained later */
+    for (round = 0; round < 4; round++) {
+        numevents = 0;
+        for (i = 0; i < LATENCYBATCH/4; i++) {
+            clock_us += 3;
+            I_PostInput(i & 1 ? IA_LEFT : IA_RIGHT, i & 2);
+        }
+        clock_us += delays[round];
+        Process();
+        CHECK(numevents == LATENCYBATCH/4);
+    }
+    CHECK(lat_lines == 1);
+    /* Each round's events are 3us apart, so on top of the delay they
+     * averaged (LATENCYBATCH/4 - 1) / 2 * 3us older */
+    CHECK(lat_avg == 250 + (LATENCYBATCH/4 - 1) * 3 / 2);
+    CHECK(lat_max == 400 + (LATENCYBATCH/4 - 1) * 3);
+    CHECK(lat_dropped == 0);
+}
+
+static void TestFull(void)
+{
+    int i;
+
+    /* A full ring keeps the oldest events and counts the rest */
+    numevents = 0;
+    for (i = 0; i < RINGSIZE + 10; i++)
+        I_PostInput(IA_MAP, i < RINGSIZE);
+    Process();
+    CHECK(numevents == RINGSIZE);
+    for (i = 0; i < numevents; i++)
+        CHECK(events[i].type == ev_keydown);
+
+    /* Drained, it takes events again */
+    numevents = 0;
+    I_PostInput(IA_MAP, false);
+    Process();
+    CHECK(numevents == 1 && events[0].type == ev_keyup);
+
+    /* The drop count shows on the next latency line */
+    lat_lines = 0;
+    while (!lat_lines) {
+        numevents = 0;
+        I_PostInput(IA_USE, false);
+        Process();
+    }
+    CHECK(lat_dropped == 10);
+}
+
+static void TestWrap(void)
+{
+    int lap, i, ok = 1;
+
+    /* Batches that don't divide the ring, so every slot is reused at
+     * every offset, for many laps */
+    for (lap = 0; lap < 1000; lap++) {
+        int n = 1 + lap % (RINGSIZE - 1);
+
+        numevents = 0;
+        for (i = 0; i < n; i++)
+            I_PostInput((lap + i) % NUMINPUTACTIONS, (lap + i) & 1);
+        Process();
+        ok &= numevents == n;
+        for (i = 0; i < n && i < numevents; i++)
+            ok &= events[i].data1 == *keys[(lap + i) % NUMINPUTACTIONS] &&
+                events[i].type == ((lap + i) & 1 ? ev_keydown : ev_keyup);
+    }
+    CHECK(ok);
+}
+
+/* Several producers posting against the consumer. Each owns an action
+ * and posts it down, up, down, up... Held to RINGSIZE/PRODUCERS events
+ * ahead of the consumer the ring never fills, so every action must come
+ * out strictly alternating: nothing torn, duplicated, lost or reordered.
+ * Unthrottled, everything posted must be delivered or counted dropped. */
+
+#define PRODUCERS 4
+#define PERPRODUCER 10000
+
+static int throttle;
+static unsigned consumed[PRODUCERS];
+static int producing;
+
+static void *Producer(void *arg)
+{
+    int p = (int)(long)arg, i;
+
+    for (i = 0; i < PERPRODUCER; i++) {
+        while (throttle && i - __atomic_load_n(&consumed[p], __ATOMIC_ACQUIRE) >= RINGSIZE/PRODUCERS)
+            sched_yield();
+        I_PostInput((inputaction_t)p, !(i & 1));
+    }
+    __atomic_fetch_sub(&producing, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/* Drain until a latency line has been logged after everything so far */
+static void FlushLatency(void)
+{
+    do {
+        numevents = 0;
+        I_PostInput(IA_USE, true);
+        Process();
+    } while (delivered % LATENCYBATCH);
+}
+
+static void RunProducers(int throttled)
+{
+    pthread_t threads[PRODUCERS];
+    int nextdown[PRODUCERS];
+    unsigned dropsbefore, total = 0;
+    int p, i, ok = 1;
+
+    FlushLatency();
+    dropsbefore = lat_dropped;
+
+    throttle = throttled;
+    producing = PRODUCERS;
+    for (p = 0; p < PRODUCERS; p++) {
+        nextdown[p] = 1;
+        consumed[p] = 0;
+        pthread_create(&threads[p], NULL, Producer, (void *)(long)p);
+    }
+
+    for (;;) {
+        int done = !__atomic_load_n(&producing, __ATOMIC_ACQUIRE);
+
+        numevents = 0;
+        Process();
+        CHECK(numevents <= MAXEVENTS);
+        for (i = 0; i < numevents && i < MAXEVENTS; i++) {
+            for (p = 0; p < PRODUCERS && events[i].data1 != *keys[p]; p++)
+                ;
+            if (p == PRODUCERS) {
+                ok = 0;
+                continue;
+            }
+            if (throttled && (events[i].type == ev_keydown) != nextdown[p])
+                ok = 0;
+            nextdown[p] = events[i].type != ev_keydown;
+            __atomic_fetch_add(&consumed[p], 1, __ATOMIC_RELEASE);
+        }
+        total += numevents;
+        if (done)
+            break;
+    }
+    for (p = 0; p < PRODUCERS; p++)
+        pthread_join(threads[p], NULL);
+    CHECK(ok);
+
+    FlushLatency();
+    CHECK(total + (lat_dropped - dropsbefore) == PRODUCERS * PERPRODUCER);
+    if (throttled)
+        CHECK(lat_dropped == dropsbefore);
+    printf("%d producers%s: %u delivered, %u dropped\n", PRODUCERS,
+           throttled ? " throttled" : "", total, lat_dropped - dropsbefore);
+}
+
+static void TestProducers(void)
+{
+    RunProducers(1);
+    RunProducers(0);
+}
+
+int main(void)
+{
+    TestOrder();
+    TestLatency();
+    TestFull();
+    TestWrap();
+    TestProducers();
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("input ring: all checks passed\n");
+    return !!failures;
+}
@@ -0,0 +1,114 @@
+/*
+ * keypad_proto benchmark
+ *
+ * Parser throughput on the host, and the latency a key change sees on
+ * the wire: a frame of a given batch size takes its length in UART
+ * characters (10 bits each) to arrive, plus the 3 character idle gap
+ * uart_control_init sets as the rx timeout, plus the time kp_parse takes
+ * to hand it over. There is no poll interval on top.
+ *
+ *   keypad_proto_bench [MB of frames to parse]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "keypad_proto.h"
+
+static const int bauds[] = { 115200, 250000, 500000, 1000000 };
+
+static unsigned long long frames, masks;
+
+static void Count(const kp_frame_t *frame, void *ctx)
+{
+    frames++;
+    masks += frame->count;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    size_t size = (argc > 1 ? atoi(argv[1]) : 16) << 20;
+    uint8_t *stream = malloc(size + KP_MAXFRAME);
+    size_t len = 0, wantframes = 0, chunk;
+    kp_parser_t parser;
+    uint16_t batch[KP_MAXBATCH];
+    double start, secs;
+    int i, b;
+
+    if (!stream)
+        return 1;
+
+    // What a player produces: mostly single changes, some bursts, and
+    // the heartbeat status frames
+    srand(1);
+    while (len < size) {
+        int count = rand() % 4 ? 1 : 1 + rand() % KP_MAXBATCH;
+
+        for (i = 0; i < count; i++)
+            batch[i] = rand();
+        if (rand() % 16)
+            len += kp_encode_keys(stream + len, wantframes, batch, count);
+        else
+            len += kp_encode_status(stream + len, wantframes, KP_STATUS_UNLOCKED);
+        wantframes++;
+    }
+
+    printf("kp_parse throughput, %zu frames in %.1fMB:\n", wantframes, len / 1048576.0);
+    // 128 is the UART reader's buffer; 1 is the worst case
+    for (chunk = 1; chunk <= 4096; chunk *= 8) {
+        size_t pos;
+
+        kp_parser_init(&parser);
+        frames = masks = 0;
+        start = Now();
+        for (pos = 0; pos < len; pos += chunk)
+            kp_parse(&parser, stream + pos, len - pos < chunk ? len - pos : chunk, Count, NULL);
+        secs = Now() - start;
+        printf("  %4zu byte reads: %7.1f MB/s, %6.1f Mframes/s, %5.1f ns/frame%s\n",
+               chunk, len / secs / 1048576.0, frames / secs / 1e6, secs / frames * 1e9,
+               frames == wantframes && !parser.crcerrors && !parser.lost ? "" : "  MISMATCH");
+    }
+
+    // Per-frame parse cost for the latency table, one frame per call
+    {
+        uint8_t frame[KP_MAXFRAME];
+        size_t flen = kp_encode_keys(frame, 0, batch, 1);
+        int n = 1 << 22;
+
+        kp_parser_init(&parser);
+        start = Now();
+        for (i = 0; i < n; i++) {
+            frame[2] = i;
+            frame[flen - 1] = kp_crc8(frame + 1, flen - 2);
+            kp_parse(&parser, frame, flen, Count, NULL);
+        }
+        secs = (Now() - start) / n;
+    }
+
+    printf("\nkey change to handler, wire time + rx timeout + %.0fns parse:\n", secs * 1e9);
+    printf("  batch");
+    for (b = 0; b < sizeof bauds / sizeof *bauds; b++)
+        printf(" %9d", bauds[b]);
+    printf("  baud\n");
+    for (i = 1; i <= KP_MAXBATCH; i *= 2) {
+        int bytes = 3 + i*2 + 1 + 3;
+
+        printf("  %5d", i);
+        for (b = 0; b < sizeof bauds / sizeof *bauds; b++)
+            printf(" %7.0fus", bytes * 10.0 / bauds[b] * 1e6 + secs * 1e6);
+        printf("\n");
+    }
+
+    free(stream);
+    return 0;
+}
@@ -0,0 +1,274 @@
+/*
+ * keypad_proto tests
+ *
+ * Feeds encoded frames, split and corrupted in the ways a UART does,
+ * through kp_parse and checks what comes out: framing, resync after a
+ * CRC error, sequence gap counting and batched bitmasks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "keypad_proto.h"
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    failures++; } } while (0)
+
+#define MAXFRAMES 4096
+
+static kp_frame_t got[MAXFRAMES];
+static int numgot;
+
+static void Collect(const kp_frame_t *frame, void *ctx)
+{
+    if (numgot < MAXFRAMES)
+        got[numgot] = *frame;
+    numgot++;
+}
+
+static kp_parser_t parser;
+
+static void Reset(void)
+{
+    kp_parser_init(&parser);
+    numgot = 0;
+}
+
+// Feed a buffer in chunks of chunk bytes; 0 means in one go
+static void Feed(const uint8_t *data, size_t len, size_t chunk)
+{
+    if (!chunk)
+        chunk = len;
+    while (len) {
+        size_t n = len < chunk ? len : chunk;
+
+        kp_parse(&parser, data, n, Collect, NULL);
+        data += n;
+        len -= n;
+    }
+}
+
+static int SameFrame(const kp_frame_t *a, const kp_frame_t *b)
+{
+    int i;
+
+    if (a->type != b->type || a->count != b->count || a->seq != b->seq)
+        return 0;
+    if (a->type == KP_TYPE_STATUS)
+        return a->status == b->status;
+    for (i = 0; i < a->count; i++)
+        if (a->masks[i] != b->masks[i])
+            return 0;
+    return 1;
+}
+
+static void TestCRC(void)
+{
+    // CRC-8/SMBUS check value
+    CHECK(kp_crc8((const uint8_t *)"123456789", 9) == 0xF4);
+    CHECK(kp_crc8(NULL, 0) == 0);
+}
+
+static void TestFraming(void)
+{
+    static const size_t chunks[] = { 0, 1, 2, 3, 5, 7 };
+    uint8_t stream[64 * KP_MAXFRAME];
+    kp_frame_t want[64];
+    size_t len = 0;
+    int i, j, c;
+
+    // Every batch size, and status frames between them
+    for (i = 0; i < 64; i++) {
+        kp_frame_t *f = &want[i];
+
+        memset(f, 0, sizeof *f);
+        f->seq = i;
+        if (i % 9 == 8) {
+            f->type = KP_TYPE_STATUS;
+            f->count = 1;
+            f->status = i & 1 ? KP_STATUS_UNLOCKED : KP_STATUS_LOCKED;
+            len += kp_encode_status(stream + len, f->seq, f->status);
+        } else {
+            f->type = KP_TYPE_KEYS;
+            f->count = i % 9 + 1 > KP_MAXBATCH ? KP_MAXBATCH : i % 9 + 1;
+            for (j = 0; j < f->count; j++)
+                f->masks[j] = (uint16_t)(0xA5A5 ^ (i * 0x1111) ^ (j << 3));
+            len += kp_encode_keys(stream + len, f->seq, f->masks, f->count);
+        }
+    }
+
+    for (c = 0; c < sizeof chunks / sizeof *chunks; c++) {
+        Reset();
+        Feed(stream, len, chunks[c]);
+        CHECK(numgot == 64);
+        for (i = 0; i < 64 && i < numgot; i++)
+            CHECK(SameFrame(&got[i], &want[i]));
+        CHECK(parser.frames == 64);
+        CHECK(parser.crcerrors == 0);
+        CHECK(parser.lost == 0);
+    }
+}
+
+static void TestGarbage(void)
+{
+    static const uint8_t noise[] = { 0x00, KP_SYNC, 0xFF, KP_SYNC, KP_SYNC, 0x3C, KP_SYNC };
+    uint8_t stream[256];
+    uint16_t mask = 0x0201;
+    size_t len = 0;
+
+    // Noise, sync bytes with bad headers included, before and between
+    memcpy(stream + len, noise, sizeof noise);
+    len += sizeof noise;
+    len += kp_encode_keys(stream + len, 1, &mask, 1);
+    memcpy(stream + len, noise, sizeof noise);
+    len += sizeof noise;
+    len += kp_encode_status(stream + len, 2, KP_STATUS_UNLOCKED);
+
+    Reset();
+    Feed(stream, len, 1);
+    CHECK(numgot == 2);
+    CHECK(got[0].type == KP_TYPE_KEYS && got[0].masks[0] == mask);
+    CHECK(got[1].type == KP_TYPE_STATUS && got[1].status == KP_STATUS_UNLOCKED);
+    CHECK(parser.lost == 0);
+}
+
+static void TestResync(void)
+{
+    uint8_t stream[256];
+    uint16_t masks[KP_MAXBATCH] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    size_t len = 0, first;
+
+    // A corrupted CRC drops that frame only
+    first = kp_encode_keys(stream, 0, masks, 2);
+    stream[first - 1] ^= 0x40;
+    len = first;
+    len += kp_encode_keys(stream + len, 1, masks + 2, 2);
+
+    Reset();
+    Feed(stream, len, 0);
+    CHECK(numgot == 1);
+    CHECK(got[0].seq == 1 && got[0].masks[0] == 4 && got[0].masks[1] == 8);
+    CHECK(parser.crcerrors == 1);
+
+    // A frame cut short by a dropped byte: the next frame is taken as
+    // the rest of it, fails the CRC, and must be found again on rescan
+    len = kp_encode_keys(stream, 5, masks, KP_MAXBATCH) - 6;
+    len += kp_encode_keys(stream + len, 6, masks + 1, 1);
+    len += kp_encode_keys(stream + len, 7, masks + 2, 1);
+
+    Reset();
+    Feed(stream, len, 1);
+    CHECK(numgot == 2);
+    CHECK(numgot >= 1 && got[0].seq == 6 && got[0].masks[0] == 2);
+    CHECK(numgot >= 2 && got[1].seq == 7 && got[1].masks[0] == 4);
+    CHECK(parser.crcerrors == 1);
+
+    // Data bytes that look like sync inside a corrupted frame. Here the
+    // rescan lands on a false header asking for a long frame, which holds
+    // up the frames behind it until that one fails its CRC in turn; they
+    // are late, but none is lost.
+    masks[0] = KP_SYNC | (KP_SYNC << 8);
+    len = kp_encode_keys(stream, 9, masks, 1);
+    stream[2] ^= 0x01;
+    len += kp_encode_keys(stream + len, 10, masks, 1);
+    len += kp_encode_keys(stream + len, 11, masks + 1, 1);
+    len += kp_encode_keys(stream + len, 12, masks + 2, 1);
+
+    Reset();
+    Feed(stream, len, 0);
+    CHECK(numgot == 3);
+    CHECK(numgot >= 1 && got[0].seq == 10 && got[0].masks[0] == masks[0]);
+    CHECK(numgot >= 3 && got[2].seq == 12 && got[2].masks[0] == 4);
+    CHECK(parser.lost == 0);
+}
+
+static void TestSequence(void)
+{
+    static const uint8_t seqs[] = { 250, 251, 253, 254, 255, 0, 1, 5 };
+    static const unsigned lost[] = { 0, 0, 1, 1, 1, 1, 1, 4 };
+    uint8_t buf[KP_MAXFRAME];
+    uint16_t mask = 0;
+    int i;
+
+    Reset();
+    for (i = 0; i < sizeof seqs; i++) {
+        size_t len = kp_encode_keys(buf, seqs[i], &mask, 1);
+
+        Feed(buf, len, 0);
+        CHECK(parser.seq == seqs[i]);
+        CHECK(parser.lost == lost[i]);
+    }
+    CHECK(numgot == sizeof seqs);
+}
+
+static void TestBatching(void)
+{
+    uint16_t masks[KP_MAXBATCH + 4];
+    uint8_t buf[KP_MAXFRAME];
+    size_t len;
+    int i;
+
+    for (i = 0; i < KP_MAXBATCH + 4; i++)
+        masks[i] = (uint16_t)(1u << i | 0x8000);
+
+    // Oldest first, and anything past KP_MAXBATCH is not sent
+    len = kp_encode_keys(buf, 3, masks, KP_MAXBATCH + 4);
+    CHECK(len == KP_MAXFRAME);
+
+    Reset();
+    Feed(buf, len, 0);
+    CHECK(numgot == 1);
+    CHECK(got[0].count == KP_MAXBATCH);
+    for (i = 0; i < KP_MAXBATCH; i++)
+        CHECK(got[0].masks[i] == masks[i]);
+
+    // A bad count in the header is never a frame
+    buf[1] = (KP_TYPE_KEYS << 4) | (KP_MAXBATCH + 1);
+    Reset();
+    Feed(buf, len, 0);
+    CHECK(numgot == 0);
+}
+
+static void TestNoise(void)
+{
+    static uint8_t noise[1 << 16];
+    uint8_t buf[KP_MAXFRAME];
+    uint16_t mask = 0x1234;
+    size_t i, len;
+
+    // Random bytes must not upset the parser; a frame after them still
+    // gets through once the parser is back in sync
+    srand(1);
+    for (i = 0; i < sizeof noise; i++)
+        noise[i] = rand();
+
+    Reset();
+    Feed(noise, sizeof noise, 13);
+    numgot = 0;
+    len = kp_encode_keys(buf, 77, &mask, 1);
+    for (i = 0; i < KP_MAXFRAME && !numgot; i++)
+        Feed(buf, len, 0);
+    CHECK(numgot >= 1);
+    CHECK(got[numgot - 1].seq == 77 && got[numgot - 1].masks[0] == mask);
+}
+
+int main(void)
+{
+    TestCRC();
+    TestFraming();
+    TestGarbage();
+    TestResync();
+    TestSequence();
+    TestBatching();
+    TestNoise();
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("keypad_proto: all checks passed\n");
+    return !!failures;
+}
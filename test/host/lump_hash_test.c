@@ -0,0 +1,321 @@
+/*
+ * Lump directory index tests, and benchmark
+ *
+ * w_wad.c is included whole and given directories built the way W_Init
+ * would leave them: an IWAD's worth of lumps, some of them sprites,
+ * flats and colormaps in their own namespaces, then PWADs with maps,
+ * each map repeating the same ten lump names, and lumps that replace
+ * ones before them. For
+ * every lump name in the directory, in the namespace it is in and with
+ * its case changed, and for names that aren't there, W_CheckNumForName
+ * must return what killough's hash chains, kept here as they were,
+ * return: the last lump of that name and namespace, or -1.
+ *
+ * Then times building the index and looking names up, 10k lumps and
+ * more, against the hash chains.
+ */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../components/prboom/w_wad.c"
+#include "host_support.h"
+
+/*
+ * What w_wad.c links against. Nothing is read from a file.
+ */
+
+int I_GetTime_SaveMS(void) { return 0; }
+void W_InitCache(void) {}
+void W_DoneCache(void) {}
+int I_Filelength(int handle) { return 0; }
+char *I_FindFile(const char *wfname, const char *ext) { return NULL; }
+void I_Read(int fd, void *buf, size_t sz) {}
+int I_Open(const char *wad, int flags) { return -1; }
+int I_Lseek(int fd, off_t offset, int whence) { return 0; }
+boolean D_NetGetWad(const char *name) { return false; }
+
+/*
+ * The hash chains W_CheckNumForName walked before, with the index and
+ * next fields lumpinfo_t had for them
+ */
+
+static int *old_index, *old_next;
+
+static void Old_HashLumps(void)
+{
+  int i;
+
+  old_index = realloc(old_index, (numlumps ? numlumps : 1) * sizeof *old_index);
+  old_next = realloc(old_next, (numlumps ? numlumps : 1) * sizeof *old_next);
+  for (i=0; i<numlumps; i++)
+    old_index[i] = -1;
+  for (i=0; i<numlumps; i++)
+    {
+      int j = W_LumpNameHash(lumpinfo[i].name) % (unsigned) numlumps;
+      old_next[i] = old_index[j];
+      old_index[j] = i;
+    }
+}
+
+static int Old_CheckNumForName(const char *name, int li_namespace)
+{
+  int i = (numlumps==0)?(-1):(old_index[W_LumpNameHash(name) % (unsigned) numlumps]);
+
+  while (i >= 0 && (strncasecmp(lumpinfo[i].name, name, 8) ||
+                    lumpinfo[i].li_namespace != li_namespace))
+    i = old_next[i];
+  return i;
+}
+
+/*
+ * Directories
+ */
+
+static const char *const maplumps[10] = {
+  "THINGS", "LINEDEFS", "SIDEDEFS", "VERTEXES", "SEGS",
+  "SSECTORS", "NODES", "SECTORS", "REJECT", "BLOCKMAP"
+};
+
+static const char namechars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_-[]";
+
+static void RandomName(char *name)
+{
+  int len = 1 + rand() % 8, i;
+
+  memset(name, 0, 9);
+  for (i = 0; i < len; i++)
+    name[i] = namechars[rand() % (sizeof namechars - 1)];
+}
+
+static lumpinfo_t *AddLump(int li_namespace)
+{
+  lumpinfo_t *lump;
+
+  lumpinfo = realloc(lumpinfo, (numlumps + 1) * sizeof *lumpinfo);
+  lump = &lumpinfo[numlumps++];
+  memset(lump, 0, sizeof *lump);
+  lump->li_namespace = li_namespace;
+  RandomName(lump->name);
+  return lump;
+}
+
+// lumps random lumps, of which maps are maps of ten lumps each after
+// their marker. One in twenty replaces a lump before it, in the
+// IWAD's namespace, as a PWAD's would.
+static void BuildDirectory(int lumps, int maps)
+{
+  int i, m;
+
+  free(lumpinfo);
+  lumpinfo = NULL;
+  numlumps = 0;
+
+  for (i = 0; numlumps < lumps - maps * 11; i++)
+    {
+      int ns = i % 8 == 0 ? ns_sprites : i % 8 == 1 ? ns_flats :
+               i % 64 == 2 ? ns_colormaps : ns_global;
+      lumpinfo_t *lump = AddLump(ns);
+
+      if (numlumps > 1 && rand() % 20 == 0)
+        {
+          const lumpinfo_t *old = &lumpinfo[rand() % (numlumps - 1)];
+
+          strcpy(lump->name, old->name);
+          lump->li_namespace = old->li_namespace;
+        }
+    }
+
+  for (m = 0; m < maps; m++)
+    {
+      sprintf(AddLump(ns_global)->name, m < 100 ? "MAP%02d" : "M%05d", m);
+      for (i = 0; i < 10; i++)
+        strcpy(AddLump(ns_global)->name, maplumps[i]);
+    }
+
+  W_HashLumps();
+  Old_HashLumps();
+}
+
+// The last lump of that name in that namespace, by a plain search
+static int LastLump(const char *name, int li_namespace)
+{
+  int i;
+
+  for (i = numlumps; --i >= 0; )
+    if (!strncasecmp(lumpinfo[i].name, name, 8) && lumpinfo[i].li_namespace == li_namespace)
+      return i;
+  return -1;
+}
+
+static int CheckName(const char *name, int li_namespace)
+{
+  int n = (W_CheckNumForName)(name, li_namespace);
+
+  return n == Old_CheckNumForName(name, li_namespace) ? n : -2;
+}
+
+static void TestDirectory(int lumps, int maps)
+{
+  int i, ns, ok = 1, last = 1, misses = 0;
+
+  BuildDirectory(lumps, maps);
+  for (i = 0; i < numlumps; i++)
+    {
+      const lumpinfo_t *lump = &lumpinfo[i];
+      char name[16];
+      int n = CheckName(lump->name, lump->li_namespace), j;
+
+      ok &= n >= i;
+      if (i % 16 == 0)
+        last &= n == LastLump(lump->name, lump->li_namespace);
+
+      // Any case, and anything past the eighth character, finds it
+      strcpy(name, lump->name);
+      for (j = 0; name[j]; j++)
+        if (rand() & 1)
+          name[j] = tolower((unsigned char)name[j]);
+      ok &= CheckName(name, lump->li_namespace) == n;
+      if (strlen(name) == 8)
+        {
+          strcat(name, "XY");
+          ok &= CheckName(name, lump->li_namespace) == n;
+        }
+
+      // In every other namespace it's there or not as the chains say
+      for (ns = ns_global; ns <= ns_prboom; ns++)
+        ok &= CheckName(lump->name, ns) != -2;
+
+      // So is any prefix of it
+      strcpy(name, lump->name);
+      name[strlen(name) - 1] = 0;
+      ok &= !name[0] || CheckName(name, lump->li_namespace) != -2;
+    }
+
+  // Names that aren't there
+  for (i = 0; i < 20000; i++)
+    {
+      char name[9];
+
+      RandomName(name);
+      ns = rand() % (ns_prboom + 1);
+      if (CheckName(name, ns) == -1)
+        misses++;
+      else
+        ok &= CheckName(name, ns) != -2;
+    }
+
+  CHECK(ok);
+  CHECK(last);
+  CHECK(misses > 10000);
+  if (!ok || !last)
+    fprintf(stderr, "%d lumps, %d maps: lookups differ\n", lumps, maps);
+}
+
+static void TestEmpty(void)
+{
+  free(lumpinfo);
+  lumpinfo = NULL;
+  numlumps = 0;
+  W_HashLumps();
+  CHECK((W_CheckNumForName)("PLAYPAL", ns_global) == -1);
+  CHECK((W_CheckNumForName)("", ns_global) == -1);
+}
+
+/*
+ * Timings: building the index for a directory, and a million lookups,
+ * half hits in any case and namespace, half random names, nearly all
+ * misses. The two take turns,
+ * best of several runs.
+ */
+
+#define QUERIES 4096
+#define LOOKUPS (1<<20)
+
+static char queries[QUERIES][9];
+static int query_ns[QUERIES];
+
+static void BuildQueries(void)
+{
+  int i, j;
+
+  for (i = 0; i < QUERIES; i++)
+    {
+      if (i & 1)
+        {
+          const lumpinfo_t *lump = &lumpinfo[rand() % numlumps];
+
+          strcpy(queries[i], lump->name);
+          query_ns[i] = lump->li_namespace;
+          for (j = 0; queries[i][j]; j++)
+            if (rand() & 1)
+              queries[i][j] = tolower((unsigned char)queries[i][j]);
+        }
+      else
+        {
+          RandomName(queries[i]);
+          query_ns[i] = rand() % (ns_prboom + 1);
+        }
+    }
+}
+
+static volatile int sink;
+
+static void Time(int lumps, int maps)
+{
+  double build[2] = { 1e9, 1e9 }, lookup[2] = { 1e9, 1e9 };
+  int run, r, which;
+
+  BuildDirectory(lumps, maps);
+  BuildQueries();
+  for (run = 0; run < 7; run++)
+    for (which = 0; which < 2; which++)
+      {
+        double start = host_now(), t;
+        int sum = 0;
+
+        if (which)
+          W_HashLumps();
+        else
+          Old_HashLumps();
+        t = (host_now() - start) * 1e3;
+        if (t < build[which])
+          build[which] = t;
+
+        start = host_now();
+        if (which)
+          for (r = 0; r < LOOKUPS; r++)
+            sum += (W_CheckNumForName)(queries[r % QUERIES], query_ns[r % QUERIES]);
+        else
+          for (r = 0; r < LOOKUPS; r++)
+            sum += Old_CheckNumForName(queries[r % QUERIES], query_ns[r % QUERIES]);
+        t = (host_now() - start) * 1e9 / LOOKUPS;
+        if (t < lookup[which])
+          lookup[which] = t;
+        sink = sum;
+      }
+  printf("%6d %6d %8.2f/%-8.2f %6.1f/%-6.1f\n", numlumps, maps,
+         build[0], build[1], lookup[0], lookup[1]);
+}
+
+int main(void)
+{
+  static const int dirs[][2] = {
+    { 3000, 20 }, { 11300, 300 }, { 21000, 1000 }, { 20000, 0 }, { 52000, 2000 }
+  };
+  int i;
+
+  srand(1);
+  TestEmpty();
+  TestDirectory(1, 0);
+  TestDirectory(300, 0);
+  for (i = 0; i < sizeof dirs / sizeof *dirs; i++)
+    TestDirectory(dirs[i][0], dirs[i][1]);
+
+  printf(" lumps   maps  build old/new ms  lookup old/new ns\n");
+  for (i = 0; i < sizeof dirs / sizeof *dirs; i++)
+    Time(dirs[i][0], dirs[i][1]);
+
+  return host_finish("lump_hash_test");
+}
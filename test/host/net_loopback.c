@@ -0,0 +1,348 @@
+/*
+ * Netplay loopback harness
+ *
+ * Runs a server and two clients in one process over 127.0.0.1, using
+ * the real i_network.c: I_Socket, I_ConnectToServer, I_SendPacket,
+ * I_SendPacketTo, I_GetPacket and the packet pool. The clients send
+ * PKT_TICC the way NetUpdate does and the server answers with PKT_TICS
+ * once it has both players' tics, so the round trip measured is the
+ * input lag the network layer adds to a netgame, without Wi-Fi.
+ *
+ * i_network.c works on the one global udp_socket, so each role swaps
+ * its own socket in before calling it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+#include "protocol.h"
+#include "i_network.h"
+#include "lprintf.h"
+
+#define NUMCLIENTS 2
+#define NUMTICS    5000
+#define MAXSEND    8      /* tics per PKT_TICC, as BACKUPTICS bounds it */
+#define POOLSIZE   8      /* NET_POOLSIZE in i_network.c */
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    failures++; } } while (0)
+
+static int droppedwarnings;   /* I_GetPacket's, for packets cut short */
+
+int lprintf(OutputLevels pri, const char *fmt, ...)
+{
+  va_list ap;
+  int r;
+
+  if (!strncmp(fmt, "I_GetPacket: dropped", 20))
+    droppedwarnings++;
+  va_start(ap, fmt);
+  r = vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  return r;
+}
+
+void I_Error(const char *error, ...)
+{
+  va_list ap;
+
+  va_start(ap, error);
+  vfprintf(stderr, error, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+  exit(1);
+}
+
+static unsigned long long now_us(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000ull + ts.tv_nsec / 1000;
+}
+
+/* The ticcmd player n builds for tic t, so every side can check what it
+ * is given without keeping the other's state */
+static ticcmd_t MakeCmd(int n, unsigned t)
+{
+  ticcmd_t cmd;
+
+  memset(&cmd, 0, sizeof cmd);
+  cmd.forwardmove = (signed char)(t * 3 + n);
+  cmd.sidemove = (signed char)(n - (int)t);
+  cmd.angleturn = (short)(t * 257 + n * 1000);
+  cmd.consistancy = (short)(t ^ (n << 12));
+  cmd.buttons = (byte)(t >> 3);
+  return cmd;
+}
+
+static int SameCmd(const ticcmd_t *a, const ticcmd_t *b)
+{
+  return a->forwardmove == b->forwardmove && a->sidemove == b->sidemove &&
+    a->angleturn == b->angleturn && a->consistancy == b->consistancy &&
+    a->chatchar == b->chatchar && a->buttons == b->buttons;
+}
+
+/* Packets in the loop must come from the pool, not the heap fallback */
+static byte *poolbase;
+
+static UDP_PACKET *PoolPacket(int size)
+{
+  UDP_PACKET *p = I_AllocPacket(size);
+
+  CHECK((byte *)p >= poolbase && (byte *)p < poolbase + POOLSIZE*NET_MAXPACKET);
+  return p;
+}
+
+static void TestPool(void)
+{
+  UDP_PACKET *p[POOLSIZE+1];
+  int i;
+
+  for (i = 0; i <= POOLSIZE; i++)
+    p[i] = I_AllocPacket(NET_MAXPACKET);
+  poolbase = (byte *)p[0];
+  for (i = 1; i < POOLSIZE; i++)
+    CHECK((byte *)p[i] == poolbase + i*NET_MAXPACKET);
+  /* Exhausted, this one comes from the heap */
+  CHECK((byte *)p[POOLSIZE] < poolbase ||
+        (byte *)p[POOLSIZE] >= poolbase + POOLSIZE*NET_MAXPACKET);
+  for (i = POOLSIZE; i >= 0; i--)
+    I_FreePacket(p[i]);
+
+  /* Freed entries are handed out again, lowest first */
+  p[0] = I_AllocPacket(16);
+  CHECK((byte *)p[0] == poolbase);
+  I_FreePacket(p[0]);
+}
+
+static UDP_SOCKET serversock;
+
+static UDP_CHANNEL clientaddr[NUMCLIENTS];
+static ticcmd_t servercmds[NUMCLIENTS][NUMTICS];
+static unsigned serverhave[NUMCLIENTS];  /* tics received from each */
+
+static struct {
+  UDP_SOCKET sock;
+  unsigned maketic;         /* tics built */
+  unsigned remotetic;       /* tics received back from the server */
+  unsigned long long built[NUMTICS];
+  unsigned long long latencysum, latencymax;
+  unsigned latencytics;
+} clients[NUMCLIENTS];
+
+static size_t serverrecv, clientrecv;
+
+/* A packet past NET_MAXPACKET, as a PKT_SETUP with a long WAD list is:
+ * cut short into a buffer that size it is dropped with a warning, and
+ * a NET_MAXRECV buffer, NetUpdate's, takes it whole */
+static void TestLarge(void)
+{
+  static byte sent[4000], got[NET_MAXRECV];
+  packet_header_t *packet = (void *)sent;
+  size_t len;
+  int i;
+
+  packet_set(packet, PKT_SETUP, 0);
+  for (i = sizeof *packet; i < (int)sizeof sent; i++)
+    sent[i] = (byte)(i * 7);
+
+  udp_socket = clients[0].sock;
+  I_SendPacket(packet, sizeof sent);
+  udp_socket = serversock;
+  I_WaitForPacket(1000);
+  CHECK(I_GetPacket((void *)got, NET_MAXPACKET) == 0);
+  CHECK(droppedwarnings == 1);
+
+  udp_socket = clients[0].sock;
+  I_SendPacket(packet, sizeof sent);
+  udp_socket = serversock;
+  I_WaitForPacket(1000);
+  len = I_GetPacket((void *)got, NET_MAXRECV);
+  CHECK(len == sizeof sent && !memcmp(got, sent, len));
+  CHECK(droppedwarnings == 1);
+}
+
+static void ServerUpdate(void)
+{
+  packet_header_t *packet = PoolPacket(NET_MAXPACKET);
+  size_t len;
+
+  udp_socket = serversock;
+  while ((len = I_GetPacket(packet, NET_MAXPACKET))) {
+    const byte *p = (const byte *)(packet+1);
+    unsigned tic = doom_ntohl(packet->tic), complete;
+    int tics, n, i;
+
+    serverrecv++;
+    if (packet->type != PKT_TICC || len < sizeof *packet + 2)
+      continue;
+    tics = *p++;
+    n = *p++;
+    CHECK(n >= 0 && n < NUMCLIENTS);
+    CHECK(len == sizeof *packet + 2 + tics * sizeof(ticcmd_t));
+    memcpy(&clientaddr[n], &sentfrom, sizeof sentfrom);
+
+    for (i = 0; i < tics; i++, p += sizeof(ticcmd_t)) {
+      if (tic + i >= NUMTICS)
+        break;
+      RawToTic(&servercmds[n][tic + i], p);
+      if (tic + i == serverhave[n])
+        serverhave[n]++;
+    }
+
+    /* Send the client everything it hasn't confirmed that all players
+     * have made; the PKT_TICC's tic is where it is up to */
+    complete = serverhave[0] < serverhave[1] ? serverhave[0] : serverhave[1];
+    if (complete > tic) {
+      packet_header_t *out = PoolPacket(NET_MAXPACKET);
+      byte *q = (byte *)(out+1);
+      unsigned t;
+
+      tics = complete - tic > MAXSEND ? MAXSEND : complete - tic;
+      packet_set(out, PKT_TICS, tic);
+      *q++ = tics;
+      for (t = tic; t < tic + tics; t++) {
+        *q++ = NUMCLIENTS;
+        for (i = 0; i < NUMCLIENTS; i++) {
+          *q++ = i;
+          TicToRaw(q, &servercmds[i][t]);
+          q += sizeof(ticcmd_t);
+        }
+      }
+      I_SendPacketTo(out, q - (byte *)out, &clientaddr[n]);
+      I_FreePacket(out);
+    }
+  }
+  I_FreePacket(packet);
+}
+
+static void ClientUpdate(int n)
+{
+  packet_header_t *packet = PoolPacket(NET_MAXPACKET);
+  size_t len;
+
+  udp_socket = clients[n].sock;
+
+  /* Take in tics, as the PKT_TICS case of NetUpdate */
+  while ((len = I_GetPacket(packet, NET_MAXPACKET))) {
+    const byte *p = (const byte *)(packet+1);
+    unsigned ptic = doom_ntohl(packet->tic);
+    unsigned long long now = now_us();
+    int tics;
+
+    clientrecv++;
+    CHECK(packet->type == PKT_TICS);
+    tics = *p++;
+    if (ptic > clients[n].remotetic || ptic + tics <= clients[n].remotetic)
+      continue;   /* a gap or nothing new; the next PKT_TICC asks again */
+    for (; tics--; ptic++) {
+      int players = *p++;
+
+      CHECK(players == NUMCLIENTS);
+      while (players--) {
+        int m = *p++;
+        ticcmd_t cmd, want = MakeCmd(m, ptic);
+
+        RawToTic(&cmd, p);
+        p += sizeof(ticcmd_t);
+        CHECK(SameCmd(&cmd, &want));
+      }
+      if (ptic == clients[n].remotetic) {
+        unsigned long long latency = now - clients[n].built[ptic];
+
+        clients[n].latencysum += latency;
+        if (latency > clients[n].latencymax)
+          clients[n].latencymax = latency;
+        clients[n].latencytics++;
+        clients[n].remotetic++;
+      }
+    }
+  }
+  I_FreePacket(packet);
+
+  /* Build a tic and send everything the server hasn't returned yet */
+  if (clients[n].maketic < NUMTICS && clients[n].maketic - clients[n].remotetic < MAXSEND)
+    clients[n].built[clients[n].maketic++] = now_us();
+  if (clients[n].maketic > clients[n].remotetic) {
+    unsigned start = clients[n].remotetic;
+    int sendtics = clients[n].maketic - start;
+    size_t size = sizeof(packet_header_t) + 2 + sendtics * sizeof(ticcmd_t);
+    byte *q;
+
+    packet = PoolPacket(size);
+    packet_set(packet, PKT_TICC, start);
+    q = (byte *)(packet+1);
+    *q++ = sendtics;
+    *q++ = n;
+    for (; sendtics--; start++, q += sizeof(ticcmd_t)) {
+      ticcmd_t cmd = MakeCmd(n, start);
+      TicToRaw(q, &cmd);
+    }
+    I_SendPacket(packet, size);
+    I_FreePacket(packet);
+  }
+}
+
+int main(void)
+{
+  struct sockaddr_in addr;
+  socklen_t addrlen = sizeof addr;
+  unsigned long long start;
+  char server[32];
+  int n, rounds = 0;
+
+  I_InitNetwork();
+  TestPool();
+
+  serversock = I_Socket(0);
+  CHECK(getsockname(serversock, (struct sockaddr *)&addr, &addrlen) == 0);
+  sprintf(server, "127.0.0.1:%u", ntohs(addr.sin_port));
+
+  for (n = 0; n < NUMCLIENTS; n++) {
+    udp_socket = clients[n].sock = I_Socket(0);
+    CHECK(I_ConnectToServer(server) == 0);
+  }
+  TestLarge();
+
+  start = now_us();
+  while (clients[0].remotetic < NUMTICS || clients[1].remotetic < NUMTICS) {
+    for (n = 0; n < NUMCLIENTS; n++)
+      ClientUpdate(n);
+    udp_socket = serversock;
+    I_WaitForPacket(1);
+    ServerUpdate();
+    if (++rounds > NUMTICS * 100) {
+      fprintf(stderr, "stalled at tics %u/%u\n", clients[0].remotetic, clients[1].remotetic);
+      failures++;
+      break;
+    }
+  }
+
+  printf("%d tics, %d rounds, %.1fms, %zu server / %zu client packets, "
+         "%zu bytes sent, %zu received\n", NUMTICS, rounds,
+         (now_us() - start) / 1000.0, serverrecv, clientrecv, sentbytes, recvdbytes);
+  for (n = 0; n < NUMCLIENTS; n++) {
+    CHECK(clients[n].latencytics == NUMTICS);
+    printf("client %d: tic latency avg %lluus max %lluus\n", n,
+           clients[n].latencytics ? clients[n].latencysum / clients[n].latencytics : 0,
+           clients[n].latencymax);
+  }
+
+  for (n = 0; n < NUMCLIENTS; n++)
+    I_CloseSocket(clients[n].sock);
+  I_CloseSocket(serversock);
+  udp_socket = -1;
+
+  if (failures)
+    printf("%d checks failed\n", failures);
+  return !!failures;
+}
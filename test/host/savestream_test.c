@@ -0,0 +1,330 @@
+/*
+ * Save stream tests
+ *
+ * Round trips through p_savestream.c, in memory and through a file:
+ * stored and LZ compressed chunks, deltas XORed against a base, and
+ * streams that are truncated or corrupted, which must fail to load
+ * rather than hand back wrong state. p_savestream.c is included
+ * whole so that a stream left open by a caught I_Error can be reset.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../components/prboom/p_savestream.c"
+#include "host_support.h"
+
+#define MAXSIZE (16 * SAVESTREAM_CHUNK + 123)
+
+static byte data[MAXSIZE], base[MAXSIZE], out[MAXSIZE];
+
+// Sizes around the chunk boundaries
+static const size_t sizes[] = {
+  0, 1, 3, SAVESTREAM_CHUNK - 1, SAVESTREAM_CHUNK, SAVESTREAM_CHUNK + 1,
+  3 * SAVESTREAM_CHUNK + 17, MAXSIZE
+};
+#define NUMSIZES (sizeof sizes / sizeof *sizes)
+
+// Level-like state: runs of zeroes and repeated structures with some
+// noise, which compresses about as well as a real savegame
+static void FillLevel(byte *p, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; i++)
+    p[i] = i % 64 < 40 ? (i / 64) & 0x0f : i % 64 < 48 ? 0 : rand();
+}
+
+static void FillNoise(byte *p, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; i++)
+    p[i] = rand();
+}
+
+// Write len bytes of data in uneven pieces, as the P_Archive* functions do
+static void WriteData(size_t len)
+{
+  size_t pos = 0;
+
+  while (pos < len)
+    {
+      size_t n = 1 + rand() % 700;
+
+      if (n > len - pos)
+        n = len - pos;
+      if (n == 1)
+        P_WriteSaveByte(data[pos]);
+      else
+        P_WriteSave(data + pos, n);
+      pos += n;
+    }
+}
+
+static byte *SaveMem(size_t len, boolean compress, const byte *b, size_t *stored)
+{
+  P_OpenSaveMem(compress, b, b ? len : 0);
+  WriteData(len);
+  CHECK(P_SaveStreamPos() == len);
+  return P_CloseSaveMem(stored);
+}
+
+// 1 if it loaded and matched, 0 if the load failed: either an I_Error
+// or a trailer mismatch. Wrong data with a good trailer is a failure.
+static int LoadMem(const byte *mem, size_t stored, size_t len, const byte *b)
+{
+  volatile int ok = 0;
+
+  memset(out, 0xee, len);
+  if (!CATCH_ERROR())
+    {
+      P_OpenLoadMem(mem, stored, b, b ? len : 0);
+      P_ReadSave(out, len);
+      ok = P_CloseLoad();
+      END_CATCH();
+      if (ok)
+        CHECK(!memcmp(out, data, len));
+    }
+  else if (stream.open)
+    SS_Close();
+  return ok;
+}
+
+static void TestRaw(void)
+{
+  int i;
+
+  for (i = 0; i < NUMSIZES; i++)
+    {
+      size_t len = sizes[i], stored, chunks = (len + SAVESTREAM_CHUNK - 1) / SAVESTREAM_CHUNK;
+      byte *mem;
+
+      FillNoise(data, len);
+      mem = SaveMem(len, false, NULL, &stored);
+      CHECK(mem != NULL);
+      // header, chunk headers, data, end chunk, trailer
+      CHECK(stored == 8 + chunks * 4 + len + 4 + 8);
+      CHECK(LoadMem(mem, stored, len, NULL));
+      free(mem);
+    }
+}
+
+static void TestLZ(void)
+{
+  int i;
+
+  for (i = 0; i < NUMSIZES; i++)
+    {
+      size_t len = sizes[i], stored;
+      byte *mem;
+
+      FillLevel(data, len);
+      mem = SaveMem(len, true, NULL, &stored);
+      CHECK(LoadMem(mem, stored, len, NULL));
+      if (len >= SAVESTREAM_CHUNK)
+        CHECK(stored < len / 2);
+      free(mem);
+
+      // Incompressible chunks are stored as they are, not grown
+      FillNoise(data, len);
+      mem = SaveMem(len, true, NULL, &stored);
+      CHECK(LoadMem(mem, stored, len, NULL));
+      CHECK(stored <= 8 + (len / SAVESTREAM_CHUNK + 1) * 4 + len + 4 + 8);
+      free(mem);
+    }
+
+  // Long matches, over the extra length byte
+  memset(data, 'x', MAXSIZE);
+  {
+    size_t stored;
+    byte *mem = SaveMem(MAXSIZE, true, NULL, &stored);
+
+    CHECK(LoadMem(mem, stored, MAXSIZE, NULL));
+    CHECK(stored < MAXSIZE / 50);
+    free(mem);
+  }
+}
+
+static void TestDelta(void)
+{
+  size_t i, stored, keystored;
+  byte *mem, *key;
+
+  // A keyframe and a delta a few scattered bytes away from it
+  FillLevel(base, MAXSIZE);
+  memcpy(data, base, MAXSIZE);
+  key = SaveMem(MAXSIZE, true, NULL, &keystored);
+  for (i = 0; i < 64; i++)
+    data[rand() % MAXSIZE] = rand();
+
+  mem = SaveMem(MAXSIZE, true, base, &stored);
+  CHECK(LoadMem(mem, stored, MAXSIZE, base));
+  CHECK(stored < keystored / 4);
+
+  // Against the wrong base it must not load: the CRC is of the state,
+  // not of what is stored
+  base[MAXSIZE / 2] ^= 0x10;
+  CHECK(!LoadMem(mem, stored, MAXSIZE, base));
+  base[MAXSIZE / 2] ^= 0x10;
+  CHECK(!LoadMem(mem, stored, MAXSIZE, NULL));
+  free(mem);
+
+  // A base shorter than the stream: the rest is stored as it is
+  mem = SaveMem(MAXSIZE, true, base, &stored);
+  free(mem);
+  P_OpenSaveMem(false, base, 100);
+  WriteData(MAXSIZE);
+  mem = P_CloseSaveMem(&stored);
+  P_OpenLoadMem(mem, stored, base, 100);
+  P_ReadSave(out, MAXSIZE);
+  CHECK(P_CloseLoad());
+  CHECK(!memcmp(out, data, MAXSIZE));
+  free(mem);
+  free(key);
+}
+
+static void TestTruncated(void)
+{
+  static const boolean compress[] = { false, true };
+  int c;
+
+  for (c = 0; c < 2; c++)
+    {
+      size_t len = 2 * SAVESTREAM_CHUNK + 500, stored, cut;
+      byte *mem;
+      int ok = 1;
+
+      FillLevel(data, len);
+      mem = SaveMem(len, compress[c], NULL, &stored);
+      for (cut = 0; cut < stored; cut++)
+        ok &= !LoadMem(mem, cut, len, NULL);
+      CHECK(ok);
+      CHECK(LoadMem(mem, stored, len, NULL));
+
+      // Reading past the end of the state is an error too
+      error_msg[0] = 0;
+      if (!CATCH_ERROR())
+        {
+          P_OpenLoadMem(mem, stored, NULL, 0);
+          P_ReadSave(out, len);
+          P_ReadSave(out, 1);
+          END_CATCH();
+        }
+      CHECK(!strcmp(error_msg, "P_ReadSave: Savegame truncated"));
+      if (stream.open)
+        SS_Close();
+      free(mem);
+    }
+}
+
+static void TestCorrupt(void)
+{
+  static const boolean compress[] = { false, true };
+  int c;
+
+  for (c = 0; c < 2; c++)
+    {
+      size_t len = 2 * SAVESTREAM_CHUNK + 500, stored, i;
+      byte *mem;
+      int ok = 1;
+
+      FillLevel(data, len);
+      mem = SaveMem(len, compress[c], NULL, &stored);
+
+      // The trailer's CRC and length
+      for (i = stored - 8; i < stored; i++)
+        {
+          mem[i] ^= 0x01;
+          ok &= !LoadMem(mem, stored, len, NULL);
+          mem[i] ^= 0x01;
+        }
+      CHECK(ok);
+
+      // A flipped bit past the header fails the load one way or another.
+      // In LZ data it can also turn a match into an equivalent one,
+      // which is harmless: LoadMem checks that what loads is right.
+      for (i = 8; i < stored - 8; i++)
+        {
+          byte bit = 1 << (i % 8);
+
+          mem[i] ^= bit;
+          if (LoadMem(mem, stored, len, NULL))
+            ok &= compress[c];
+          mem[i] ^= bit;
+        }
+      CHECK(ok);
+      CHECK(LoadMem(mem, stored, len, NULL));
+      free(mem);
+    }
+}
+
+static void TestFile(void)
+{
+  char name[] = "/tmp/savestream_testXXXXXX";
+  int fd = mkstemp(name);
+  FILE *fp;
+  size_t len = 5 * SAVESTREAM_CHUNK + 7;
+
+  CHECK(fd >= 0);
+  close(fd);
+
+  FillLevel(data, len);
+  CHECK(P_OpenSaveFile(name, true));
+  WriteData(len);
+  CHECK(P_CloseSave());
+  CHECK(P_OpenLoadFile(name));
+  P_ReadSave(out, len);
+  CHECK(P_CloseLoad());
+  CHECK(!memcmp(out, data, len));
+
+  // An old savegame, with no stream header, reads as it is
+  fp = fopen(name, "wb");
+  fwrite(data, 1, len, fp);
+  fclose(fp);
+  CHECK(P_OpenLoadFile(name));
+  P_ReadSave(out, len);
+  CHECK(P_CloseLoad());
+  CHECK(!memcmp(out, data, len));
+
+  remove(name);
+}
+
+static void TestOutOfMemory(void)
+{
+  size_t len = 3 * SAVESTREAM_CHUNK, stored = 1;
+  byte *mem;
+
+  // Growing the buffer fails partway through
+  FillNoise(data, len);
+  P_OpenSaveMem(false, NULL, 0);
+  P_WriteSave(data, SAVESTREAM_CHUNK);
+  zone_failrealloc = 1;
+  P_WriteSave(data + SAVESTREAM_CHUNK, len - SAVESTREAM_CHUNK);
+  mem = P_CloseSaveMem(&stored);
+  CHECK(mem == NULL && stored == 0);
+  CHECK(!stream.open);
+
+  // Trimming the slack fails: the untrimmed buffer is as good
+  P_OpenSaveMem(false, NULL, 0);
+  P_WriteSave(data, 100);
+  zone_failrealloc = 1;
+  mem = P_CloseSaveMem(&stored);
+  CHECK(zone_failrealloc == 0);
+  CHECK(mem != NULL && LoadMem(mem, stored, 100, NULL));
+  free(mem);
+}
+
+int main(void)
+{
+  srand(1);
+  TestRaw();
+  TestLZ();
+  TestDelta();
+  TestTruncated();
+  TestCorrupt();
+  TestFile();
+  TestOutOfMemory();
+  return host_finish("savestream_test");
+}
@@ -0,0 +1,240 @@
+/*
+ * Snapshot ring tests
+ *
+ * g_snapshot.c and p_savestream.c run as they are; the P_Archive*
+ * functions are replaced by ones that stream a block of fake level
+ * state, changed a little every tic, so keyframes and deltas behave as
+ * they do on a real level. Checks taking, restoring and evicting over
+ * a range of snapshot_count values: the ring holds contiguous history,
+ * never drops below half full once it has filled, and every snapshot
+ * it holds restores to exactly the state it was taken from.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "doomstat.h"
+#include "d_think.h"
+#include "p_tick.h"
+#include "p_mobj.h"
+#include "p_map.h"
+#include "p_saveg.h"
+#include "p_savestream.h"
+#include "p_spec.h"
+#include "r_demo.h"
+#include "r_fps.h"
+#include "s_sound.h"
+#include "g_game.h"
+#include "i_system.h"
+#include "g_snapshot.h"
+#include "host_support.h"
+
+#define STATESIZE 20000   /* a few chunks, like a small level */
+#define MAXTICS   200
+
+/* The level as the fake archive functions see it */
+static byte world[STATESIZE];
+static byte history[MAXTICS + 1][STATESIZE];
+
+int leveltime, gametic, basetic, bodyqueslot;
+boolean netgame, timingdemo;
+gameaction_t gameaction;
+msecnode_t *sector_list;
+thinker_t thinkerclasscap[th_all+1];
+static int demooffset;
+
+void P_ArchivePlayers(void) { P_WriteSave(world, sizeof world); }
+void P_UnArchivePlayers(void) { P_ReadSave(world, sizeof world); }
+void P_ArchiveWorld(void) {}
+void P_UnArchiveWorld(void) {}
+void P_ArchiveThinkers(void) {}
+void P_UnArchiveThinkers(void) {}
+void P_ArchiveSpecials(void) {}
+void P_UnArchiveSpecials(void) {}
+void P_ArchiveRNG(void) {}
+void P_UnArchiveRNG(void) {}
+void P_ArchiveMap(void) {}
+void P_UnArchiveMap(void) {}
+void P_ThinkerToIndex(void) {}
+void P_IndexToThinker(void) {}
+void P_InitThinkers(void)
+{
+  thinkercap.next = thinkercap.prev = &thinkercap;
+}
+void P_MobjThinker(mobj_t *mobj) {}
+void P_UnsetThingPosition(mobj_t *thing) {}
+void P_DelSeclist(msecnode_t *node) {}
+void P_RemoveAllActiveCeilings(void) {}
+void P_RemoveAllActivePlats(void) {}
+void P_MapStart(void) {}
+void P_MapEnd(void) {}
+void S_StopSound(void *origin) {}
+void R_StopAllInterpolations(void) {}
+void R_SmoothPlaying_Reset(player_t *player) {}
+int G_GetDemoOffset(void) { return demooffset; }
+void G_SetDemoOffset(int offset) { demooffset = offset; }
+void doom_printf(const char *s, ...) {}
+int I_GetTime_SaveMS(void) { return 0; }
+
+// One tic of play: a few scattered changes, so deltas stay small
+static void Tic(void)
+{
+  int i;
+
+  leveltime++;
+  gametic++;
+  demooffset = leveltime * 10;
+  for (i = 0; i < 16; i++)
+    world[rand() % STATESIZE] = rand();
+  memcpy(history[leveltime], world, STATESIZE);
+  G_SnapshotTicker();
+}
+
+static void Restart(int count)
+{
+  int i;
+
+  G_ClearSnapshots();
+  snapshot_count = count;
+  snapshot_interval = 1;
+  leveltime = gametic = basetic = 0;
+  for (i = 0; i < STATESIZE; i++)
+    world[i] = i * 7;
+  memcpy(history[0], world, STATESIZE);
+  P_InitThinkers();
+}
+
+// Snapshots are one tic apart, newest is leveltime
+static int Contiguous(void)
+{
+  int n;
+
+  for (n = 0; n < G_NumSnapshots(); n++)
+    if (G_SnapshotTime(n) != leveltime - n)
+      return 0;
+  return 1;
+}
+
+static void TestEviction(int count)
+{
+  int t, low = count, ok = 1;
+
+  Restart(count);
+  for (t = 0; t < 6 * count + 5 && leveltime < MAXTICS; t++)
+    {
+      Tic();
+      ok &= Contiguous();
+      if (t >= count && G_NumSnapshots() < low)
+        low = G_NumSnapshots();
+      ok &= G_NumSnapshots() <= count;
+    }
+  CHECK(ok);
+  // Eviction takes at most one keyframe group, at most half the ring
+  CHECK(low >= (count + 1) / 2);
+  if (low < (count + 1) / 2)
+    fprintf(stderr, "snapshot_count %d: ring dropped to %d\n", count, low);
+}
+
+// Restore every snapshot held, newest first: each restore discards
+// just the one after it. Returns false on any mismatch.
+static int WalkBack(void)
+{
+  int ok = G_RestoreSnapshot(0);
+
+  ok &= leveltime == G_SnapshotTime(0);
+  ok &= !memcmp(world, history[leveltime], STATESIZE);
+  while (G_NumSnapshots() > 1)
+    {
+      int when = G_SnapshotTime(1), left = G_NumSnapshots();
+
+      memset(world, 0, STATESIZE);
+      ok &= G_RestoreSnapshot(1);
+      ok &= leveltime == when && G_NumSnapshots() == left - 1;
+      ok &= !memcmp(world, history[when], STATESIZE);
+      ok &= demooffset == when * 10;
+    }
+  return ok;
+}
+
+static void TestRestore(int count)
+{
+  int n, t;
+
+  Restart(count);
+  for (t = 0; t < 3 * count + 2; t++)
+    Tic();
+  CHECK(WalkBack());
+
+  // Restore an older one and play on from there: later snapshots must
+  // delta against the right base
+  Restart(count);
+  for (t = 0; t < 2 * count + 3; t++)
+    Tic();
+  n = G_NumSnapshots() / 2;
+  t = G_SnapshotTime(n);
+  CHECK(G_RestoreSnapshot(n));
+  CHECK(leveltime == t && G_SnapshotTime(0) == t);
+  CHECK(!memcmp(world, history[t], STATESIZE));
+  for (t = 0; t < count + 3; t++)
+    Tic();
+  CHECK(Contiguous());
+  CHECK(WalkBack());
+
+  CHECK(!G_RestoreSnapshot(G_NumSnapshots()));
+  CHECK(!G_RestoreSnapshot(-1));
+}
+
+static void TestOff(void)
+{
+  Restart(8);
+  snapshot_interval = 0;
+  Tic();
+  CHECK(G_NumSnapshots() == 0);
+
+  // Timedemos and netgames take none either
+  snapshot_interval = 1;
+  timingdemo = true;
+  Tic();
+  CHECK(G_NumSnapshots() == 0);
+  timingdemo = false;
+  netgame = true;
+  Tic();
+  CHECK(G_NumSnapshots() == 0);
+  netgame = false;
+  Tic();
+  CHECK(G_NumSnapshots() == 1);
+}
+
+// A snapshot that runs out of memory is not kept, and the ring carries on
+static void TestOutOfMemory(void)
+{
+  int t;
+
+  Restart(8);
+  for (t = 0; t < 5; t++)
+    Tic();
+  zone_failrealloc = 1;
+  Tic();
+  CHECK(G_NumSnapshots() == 5 && G_SnapshotTime(0) == leveltime - 1);
+  Tic();
+  CHECK(G_NumSnapshots() == 6 && G_SnapshotTime(0) == leveltime);
+  CHECK(G_RestoreSnapshot(0));
+  CHECK(!memcmp(world, history[leveltime], STATESIZE));
+}
+
+int main(void)
+{
+  static const int counts[] = { 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 24 };
+  int i;
+
+  srand(1);
+  for (i = 0; i < sizeof counts / sizeof *counts; i++)
+    {
+      TestEviction(counts[i]);
+      TestRestore(counts[i]);
+    }
+  TestOff();
+  TestOutOfMemory();
+  G_ClearSnapshots();
+  return host_finish("snapshot_test");
+}
@@ -0,0 +1,440 @@
+/*
+ * Span drawer and visplane tests, and benchmark
+ *
+ * r_draw.c and r_plane.c are included whole, with the point sampled
+ * kernels for one depth: 8-bit, or 16-bit when built with
+ * HOST_RENDER_RGB565. Against a reference span loop kept here, so that
+ * changes to R_DrawSpan's kernel can be checked pixel for pixel and
+ * timed, and the hash order R_DrawPlanes drew visplanes in before it
+ * sorted them by flat:
+ *
+ *  - random spans, every start alignment and length, any step, draw
+ *    the same pixels and nothing either side of them
+ *  - frames of floor and ceiling visplanes built the way R_StoreWallRange
+ *    builds them, drawn sorted with R_DrawSpan, are the same frames
+ *    drawn in hash order with the reference loop
+ *
+ * then times both. Everything outside the planes' spans is left alone.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../components/prboom/r_draw.c"
+
+// R_MapPlane's spans go through whichever drawer is being tested
+static void (*drawspan)(draw_span_vars_t *dsvars);
+#undef R_DrawSpan
+#define R_DrawSpan(dsvars) drawspan(dsvars)
+
+#include "../../components/prboom/r_plane.c"
+#include "md5.h"
+#include "host_support.h"
+
+/*
+ * What the two files link against. Walls, skies, the border and the
+ * translation tables are never drawn.
+ */
+
+int centery, extralight, firstflat, numcolormaps, rendered_visplanes;
+int skyflatnum = -1, skytexture, skytexturemid;
+int comp[COMP_TOTAL], mapcolor_plyr[4];
+int *flattranslation, *texturetranslation;
+fixed_t projection, viewx, viewy, viewz, viewcos, viewsin, *textureheight;
+angle_t viewangle, xtoviewangle[MAX_SCREENWIDTH+1];
+const lighttable_t **colormaps, *fullcolormap, *fixedcolormap;
+const lighttable_t *(*zlight)[MAXLIGHTZ];
+GameMode_t gamemode;
+line_t *lines;
+side_t *sides;
+screeninfo_t screens[NUM_SCREENS];
+unsigned short *V_Palette16;
+V_DrawBackground_f V_DrawBackground;
+V_DrawNumPatch_f V_DrawNumPatch;
+
+video_mode_t V_GetMode(void) { return RDRAW_ONLY_BITS == 8 ? VID_MODE8 : VID_MODE16; }
+int V_GetNumPixelBits(void) { return RDRAW_ONLY_BITS; }
+int V_GetPixelDepth(void) { return RDRAW_ONLY_BITS / 8; }
+void V_UpdateTrueColorPalette(video_mode_t mode) {}
+int W_GetNumForName(const char *name) { return -1; }
+void W_UnlockLumpNum(int lump) {}
+const rpatch_t *R_CacheTextureCompositePatchNum(int id) { return NULL; }
+void R_UnlockTextureCompositePatchNum(int id) {}
+const byte *R_GetTextureColumn(const rpatch_t *texpatch, int col) { return NULL; }
+int I_GetTime_SaveMS(void) { return 0; }
+void MD5Init(struct MD5Context *context) {}
+void MD5Update(struct MD5Context *context, md5byte const *buf, unsigned len) {}
+void MD5Final(unsigned char digest[16], struct MD5Context *context) {}
+
+#define NUMFLATS 6
+
+static byte flats[NUMFLATS][64*64];
+
+const void *W_CacheLumpNum(int lump)
+{
+  return flats[lump];
+}
+
+#if RDRAW_ONLY_BITS == 8
+typedef byte pixel_t;
+#define R_DrawSpanKernel R_DrawSpan8_PointUV_PointZ
+#define SCREEN_TOPLEFT byte_topleft
+#define SCREEN_PITCH byte_pitch
+#else
+typedef unsigned short pixel_t;
+#define R_DrawSpanKernel R_DrawSpan16_PointUV_PointZ
+#define SCREEN_TOPLEFT short_topleft
+#define SCREEN_PITCH short_pitch
+#endif
+
+/*
+ * The point sampled span loop, one pixel at a time, for this depth
+ */
+
+static void Old_DrawSpan(draw_span_vars_t *dsvars)
+{
+  unsigned count = dsvars->x2 - dsvars->x1 + 1;
+  fixed_t xfrac = dsvars->xfrac;
+  fixed_t yfrac = dsvars->yfrac;
+  const fixed_t xstep = dsvars->xstep;
+  const fixed_t ystep = dsvars->ystep;
+  const byte *source = dsvars->source;
+#if RDRAW_ONLY_BITS == 8
+  const byte *colormap = dsvars->colormap;
+#else
+  const unsigned short *colormap = R_Colormap16(dsvars->colormap);
+#endif
+  pixel_t *dest = drawvars.SCREEN_TOPLEFT + dsvars->y*drawvars.SCREEN_PITCH + dsvars->x1;
+
+  while (count) {
+    const fixed_t xtemp = (xfrac >> 16) & 63;
+    const fixed_t ytemp = (yfrac >> 10) & 4032;
+    const fixed_t spot = xtemp | ytemp;
+    xfrac += xstep;
+    yfrac += ystep;
+    *dest++ = colormap[source[spot]];
+    count--;
+  }
+}
+
+// R_DrawPlanes as it was, in hash order
+static void Old_DrawPlanes(void)
+{
+  visplane_t *pl;
+  int i;
+
+  for (i=0;i<MAXVISPLANES;i++)
+    for (pl=visplanes[i]; pl; pl=pl->next, rendered_visplanes++)
+      R_DoDrawPlane(pl);
+}
+
+/*
+ * The view and its frame buffers. Rows are a little wider than the view
+ * and there is a row above and below, so anything drawn out of place
+ * shows as a difference.
+ */
+
+#define FRAMEWIDTH  320
+#define FRAMEHEIGHT 200
+#define PITCH      (FRAMEWIDTH + 8)
+#define SCREENSIZE ((FRAMEHEIGHT + 2) * PITCH)
+
+static pixel_t screen_new[SCREENSIZE], screen_old[SCREENSIZE];
+
+static void SetScreen(pixel_t *screen)
+{
+  drawvars.SCREEN_TOPLEFT = screen + PITCH;
+}
+
+static void ClearScreens(void)
+{
+  int i;
+
+  for (i = 0; i < SCREENSIZE; i++)
+    screen_new[i] = screen_old[i] = (pixel_t)(0x5aa5 + i);
+}
+
+// Random colormaps, palette and flats, and the view tables that
+// R_ExecuteSetViewSize would set up for a full size view
+static void Setup(void)
+{
+  static lighttable_t colormap[(NUMCOLORMAPS+2)*256];
+  static const lighttable_t *maps[1];
+  static int translation[NUMFLATS];
+  int i, j;
+
+  for (i = 0; i < sizeof colormap; i++)
+    colormap[i] = rand();
+  maps[0] = colormap;
+  colormaps = maps;
+  numcolormaps = 1;
+  fullcolormap = colormap;
+
+  V_Palette16 = malloc(256 * VID_NUMCOLORWEIGHTS * sizeof *V_Palette16);
+  for (i = 0; i < 256 * VID_NUMCOLORWEIGHTS; i++)
+    V_Palette16[i] = rand();
+
+  for (i = 0; i < NUMFLATS; i++)
+    {
+      translation[i] = i;
+      for (j = 0; j < 64*64; j++)
+        flats[i][j] = rand();
+    }
+  flattranslation = translation;
+
+  zlight = malloc(LIGHTLEVELS * sizeof *zlight);
+  for (i = 0; i < LIGHTLEVELS; i++)
+    for (j = 0; j < MAXLIGHTZ; j++)
+      zlight[i][j] = colormap + ((i * 2 + j / 8) % NUMCOLORMAPS) * 256;
+
+  drawvars.SCREEN_PITCH = PITCH;
+  viewwidth = FRAMEWIDTH;
+  viewheight = FRAMEHEIGHT;
+  centery = FRAMEHEIGHT / 2;
+  projection = FRAMEWIDTH / 2 * FRACUNIT;
+
+  R_InitPlanes();
+  for (i = 0; i <= FRAMEWIDTH; i++)
+    xtoviewangle[i] = (angle_t)(long long)
+      (atan2(FRAMEWIDTH / 2 - i - 0.5, FRAMEWIDTH / 2) * (2147483648.0 / M_PI));
+  for (i = 0; i < FRAMEWIDTH; i++)
+    distscale[i] = FixedDiv(FRACUNIT, D_abs(finecosine[xtoviewangle[i] >> ANGLETOFINESHIFT]));
+  for (i = 0; i < FRAMEHEIGHT; i++)
+    yslope[i] = FixedDiv(FRAMEWIDTH / 2 * FRACUNIT,
+                         D_abs(((i - FRAMEHEIGHT / 2) << FRACBITS) + FRACUNIT / 2));
+}
+
+/*
+ * Single spans
+ */
+
+#define NUMSPANS 4096
+
+static draw_span_vars_t spans[NUMSPANS];
+
+static void RandomSpans(void)
+{
+  int i;
+
+  for (i = 0; i < NUMSPANS; i++)
+    {
+      draw_span_vars_t *ds = &spans[i];
+      int len = i % 16 == 0 ? 1 + rand() % FRAMEWIDTH : 1 + rand() % 24;
+
+      ds->y = rand() % FRAMEHEIGHT;
+      ds->x1 = rand() % FRAMEWIDTH;
+      ds->x2 = ds->x1 + len - 1 < FRAMEWIDTH ? ds->x1 + len - 1 : FRAMEWIDTH - 1;
+      ds->xfrac = (unsigned)rand() * 65599u;
+      ds->yfrac = (unsigned)rand() * 65599u;
+      ds->xstep = rand() % (8 * FRACUNIT) - 4 * FRACUNIT;
+      ds->ystep = rand() % (8 * FRACUNIT) - 4 * FRACUNIT;
+      ds->source = flats[rand() % NUMFLATS];
+      ds->colormap = colormaps[0] + rand() % NUMCOLORMAPS * 256;
+      ds->nextcolormap = ds->colormap;
+      ds->z = 0;
+    }
+}
+
+static void DrawSpans(void (*draw)(draw_span_vars_t *), pixel_t *screen)
+{
+  int i;
+
+  SetScreen(screen);
+  for (i = 0; i < NUMSPANS; i++)
+    draw(&spans[i]);
+}
+
+static void TestSpans(void)
+{
+  int round, ok = 1;
+
+  for (round = 0; round < 16; round++)
+    {
+      RandomSpans();
+      ClearScreens();
+      DrawSpans(R_DrawSpanKernel, screen_new);
+      DrawSpans(Old_DrawSpan, screen_old);
+      ok &= !memcmp(screen_new, screen_old, sizeof screen_new);
+    }
+  CHECK(ok);
+
+  // Every start alignment with every short length, one row each
+  ClearScreens();
+  for (round = 0; round < 2; round++)
+    {
+      int x1, len, y = 0;
+
+      SetScreen(round ? screen_old : screen_new);
+      for (x1 = 0; x1 < 8; x1++)
+        for (len = 1; len <= 12; len++, y++)
+          {
+            draw_span_vars_t ds = spans[y];
+
+            ds.y = y % FRAMEHEIGHT;
+            ds.x1 = x1 + y / FRAMEHEIGHT * 24;
+            ds.x2 = ds.x1 + len - 1;
+            (round ? Old_DrawSpan : R_DrawSpanKernel)(&ds);
+          }
+    }
+  CHECK(!memcmp(screen_new, screen_old, sizeof screen_new));
+}
+
+/*
+ * Whole frames of visplanes: runs of columns, as walls would leave
+ * them, each with a ceiling from the top of the view and a floor to
+ * the bottom, sometimes a lower floor beyond. Heights, flats and light
+ * come from small sets so planes are shared and extended across runs.
+ */
+
+static void BuildFrame(void)
+{
+  int x = 0;
+
+  viewangle = (angle_t)rand() << 20;
+  viewsin = finesine[viewangle >> ANGLETOFINESHIFT];
+  viewcos = finecosine[viewangle >> ANGLETOFINESHIFT];
+  viewx = (rand() % 4096) << FRACBITS;
+  viewy = (rand() % 4096) << FRACBITS;
+  viewz = 41 * FRACUNIT;
+  R_ClearPlanes();
+
+  while (x < FRAMEWIDTH)
+    {
+      int x2 = x + rand() % 48, i, light = rand() % 4 * 64 + 48;
+      int c0 = rand() % (FRAMEHEIGHT / 2), c1 = rand() % (FRAMEHEIGHT / 2);
+      int f0 = FRAMEHEIGHT / 2 + rand() % (FRAMEHEIGHT / 2);
+      int f1 = FRAMEHEIGHT / 2 + rand() % (FRAMEHEIGHT / 2);
+      int step = rand() % 3 == 0;
+      visplane_t *ceil, *floor, *low = NULL;
+
+      if (x2 >= FRAMEWIDTH)
+        x2 = FRAMEWIDTH - 1;
+      ceil = R_FindPlane(viewz + (16 + rand() % 4 * 32) * FRACUNIT,
+                         rand() % NUMFLATS, light, 0, 0);
+      floor = R_FindPlane(viewz - (8 + rand() % 3 * 24) * FRACUNIT,
+                          rand() % NUMFLATS, light, 0, (rand() % 2) << 20);
+      ceil = R_CheckPlane(ceil, x, x2);
+      floor = R_CheckPlane(floor, x, x2);
+      if (step)
+        low = R_CheckPlane(R_FindPlane(viewz - 128 * FRACUNIT, rand() % NUMFLATS,
+                                       light, 0, 0), x, x2);
+
+      for (i = x; i <= x2; i++)
+        {
+          int c = c0 + (c1 - c0) * (i - x) / (x2 - x + 1);
+          int f = f0 + (f1 - f0) * (i - x) / (x2 - x + 1);
+
+          ceil->top[i] = 0;
+          ceil->bottom[i] = c;
+          floor->top[i] = f;
+          floor->bottom[i] = FRAMEHEIGHT - 1;
+          if (low)
+            {
+              low->top[i] = c + 1 + (f - c - 1) / 2;
+              low->bottom[i] = f - 1;
+            }
+        }
+      x = x2 + 1;
+    }
+}
+
+static void DrawFrame(int old)
+{
+  memset(cachedheight, 0, MAX_SCREENHEIGHT * sizeof(*cachedheight));
+  if (old)
+    {
+      SetScreen(screen_old);
+      drawspan = Old_DrawSpan;
+      Old_DrawPlanes();
+    }
+  else
+    {
+      SetScreen(screen_new);
+      drawspan = R_DrawSpanKernel;
+      R_DrawPlanes();
+    }
+}
+
+static void TestFrames(void)
+{
+  int frame, ok = 1, planes = 0;
+
+  for (frame = 0; frame < 50; frame++)
+    {
+      BuildFrame();
+      ClearScreens();
+      rendered_visplanes = 0;
+      DrawFrame(0);
+      planes += rendered_visplanes;
+      DrawFrame(1);
+      ok &= !memcmp(screen_new, screen_old, sizeof screen_new);
+    }
+  CHECK(ok);
+  // Enough planes that the sort changed the order
+  CHECK(planes > 50 * 10);
+}
+
+/*
+ * Timings, the two taking turns, best of several runs, in microseconds
+ * per NUMSPANS spans and per frame of visplanes
+ */
+
+static void Benchmark(void)
+{
+  double oldt = 1e9, newt = 1e9;
+  int run, r;
+
+  RandomSpans();
+  for (run = 0; run < 9; run++)
+    {
+      double start = host_now(), t;
+
+      for (r = 0; r < 20; r++)
+        DrawSpans(Old_DrawSpan, screen_old);
+      t = (host_now() - start) * 1e6 / 20;
+      if (t < oldt)
+        oldt = t;
+
+      start = host_now();
+      for (r = 0; r < 20; r++)
+        DrawSpans(R_DrawSpanKernel, screen_new);
+      t = (host_now() - start) * 1e6 / 20;
+      if (t < newt)
+        newt = t;
+    }
+  printf("%d-bit, %d spans: reference %.1fus, R_DrawSpan %.1fus\n",
+         RDRAW_ONLY_BITS, NUMSPANS, oldt, newt);
+
+  oldt = newt = 1e9;
+  BuildFrame();
+  for (run = 0; run < 9; run++)
+    {
+      double start = host_now(), t;
+
+      for (r = 0; r < 50; r++)
+        DrawFrame(1);
+      t = (host_now() - start) * 1e6 / 50;
+      if (t < oldt)
+        oldt = t;
+
+      start = host_now();
+      for (r = 0; r < 50; r++)
+        DrawFrame(0);
+      t = (host_now() - start) * 1e6 / 50;
+      if (t < newt)
+        newt = t;
+    }
+  printf("%d-bit, visplanes per frame: hash order %.1fus, sorted %.1fus\n",
+         RDRAW_ONLY_BITS, oldt, newt);
+}
+
+int main(void)
+{
+  srand(1);
+  Setup();
+  TestSpans();
+  TestFrames();
+  Benchmark();
+  return host_finish(RDRAW_ONLY_BITS == 8 ? "span_test" : "span_test16");
+}
@@ -0,0 +1,346 @@
+/*
+ * Wall texture pinning tests, and benchmark
+ *
+ * r_patch.c is included whole. Composites are set up already built, as
+ * they are once a level has been played a little, in a zone that keeps
+ * a list per purge tag as z_zone.c does, so Z_ChangeTag costs what it
+ * does there. Checks that:
+ *
+ *  - R_PinTextureComposite hands back what R_CacheTextureCompositePatchNum
+ *    does, locks a composite once however often a frame asks for it,
+ *    and R_UnpinTextureComposites unlocks each one pinned, leaving
+ *    locks held elsewhere alone
+ *  - frames after the first pin again from scratch
+ *
+ * then times the composite lookups R_RenderSegLoop makes for a frame of
+ * segs: cached and unlocked around every column of every tier, as it
+ * did, against pinned once a seg.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../components/prboom/r_patch.c"
+#include "host_support.h"
+
+/*
+ * What r_patch.c links against. Patches and composites are never built
+ * and nothing is warmed.
+ */
+
+int numlumps, numtextures;
+texture_t **textures;
+int *texturetranslation;
+lumpinfo_t *lumpinfo;
+side_t *sides;
+drawseg_t *drawsegs, *ds_p;
+
+const void *W_CacheLumpNum(int lump) { return NULL; }
+void W_UnlockLumpNum(int lump) {}
+boolean W_PrefetchBusy(void) { return false; }
+void W_PrefetchLumps(const int *lumps, int count) {}
+int I_GetTime_SaveMS(void) { return 0; }
+
+/*
+ * Z_ChangeTag as z_zone.c does it: each block is on a ring for its tag
+ * and moves to the other ring when the tag changes. The rest of the
+ * zone is host_support.c's.
+ */
+
+typedef struct zblock_s {
+  struct zblock_s *prev, *next;
+  int tag;
+} zblock_t;
+
+static zblock_t *blockbytag[PU_MAX];
+
+static void Z_Link(zblock_t *block, int tag)
+{
+  block->tag = tag;
+  if (!blockbytag[tag])
+    {
+      blockbytag[tag] = block;
+      block->next = block->prev = block;
+    }
+  else
+    {
+      blockbytag[tag]->prev->next = block;
+      block->prev = blockbytag[tag]->prev;
+      block->next = blockbytag[tag];
+      blockbytag[tag]->prev = block;
+    }
+}
+
+void (Z_ChangeTag)(void *ptr, int tag)
+{
+  zblock_t *block = (zblock_t *)ptr - 1;
+
+  if (!ptr || tag == block->tag)
+    return;
+  if (block == block->next)
+    blockbytag[block->tag] = NULL;
+  else if (blockbytag[block->tag] == block)
+    blockbytag[block->tag] = block->next;
+  block->prev->next = block->next;
+  block->next->prev = block->prev;
+  Z_Link(block, tag);
+}
+
+static int Tag(int id)
+{
+  return ((zblock_t *)texture_composites[id].data - 1)->tag;
+}
+
+// R_GetTextureColumn as r_data.c has it
+static const byte *GetTextureColumn(const rpatch_t *texpatch, int col)
+{
+  while (col < 0)
+    col += texpatch->width;
+  col &= texpatch->widthmask;
+
+  return texpatch->columns[col].pixels;
+}
+
+/*
+ * Composites 64 to 256 wide and 128 high, as they are left in the zone
+ * once built and unlocked
+ */
+
+#define NUMTEXTURES 128
+#define TEXHEIGHT   128
+
+static void Setup(void)
+{
+  int id, x;
+
+  numtextures = NUMTEXTURES;
+  texture_cache_kb = 0;
+  R_InitPatches();
+  for (id = 0; id < NUMTEXTURES; id++)
+    {
+      rpatch_t *patch = &texture_composites[id];
+      int width = 64 << (id % 3);
+      zblock_t *block = malloc(sizeof *block + width * (sizeof(rcolumn_t) + TEXHEIGHT));
+
+      Z_Link(block, PU_CACHE);
+      patch->data = (unsigned char *)(block + 1);
+      patch->width = width;
+      patch->height = TEXHEIGHT;
+      patch->widthmask = width - 1;
+      patch->columns = (rcolumn_t *)patch->data;
+      patch->pixels = patch->data + width * sizeof(rcolumn_t);
+      for (x = 0; x < width; x++)
+        {
+          patch->columns[x].numPosts = 0;
+          patch->columns[x].posts = NULL;
+          patch->columns[x].pixels = patch->pixels + x * TEXHEIGHT;
+        }
+    }
+}
+
+static void TestPin(void)
+{
+  int frame, id, ok = 1;
+
+  // Held outside the renderer, as a switch texture might be
+  R_CacheTextureCompositePatchNum(5);
+
+  for (frame = 0; frame < 3; frame++)
+    {
+      for (id = 0; id < NUMTEXTURES; id += 3)
+        {
+          const rpatch_t *patch = R_PinTextureComposite(id);
+
+          ok &= patch == &texture_composites[id];
+          ok &= R_PinTextureComposite(id) == patch;
+          ok &= patch->locks == 1 + (id == 5);
+          ok &= Tag(id) == PU_STATIC;
+        }
+      ok &= numpinned == (NUMTEXTURES + 2) / 3;
+      ok &= R_CacheTextureCompositePatchNum(9) == &texture_composites[9];
+      R_UnlockTextureCompositePatchNum(9);
+
+      R_UnpinTextureComposites();
+      ok &= numpinned == 0;
+      for (id = 0; id < NUMTEXTURES; id++)
+        {
+          ok &= !texture_pinned[id];
+          ok &= texture_composites[id].locks == (id == 5);
+          ok &= Tag(id) == (id == 5 ? PU_STATIC : PU_CACHE);
+        }
+    }
+  CHECK(ok);
+
+  R_UnlockTextureCompositePatchNum(5);
+  CHECK(Tag(5) == PU_CACHE);
+}
+
+/*
+ * Frames of segs as R_StoreWallRange hands them to R_RenderSegLoop:
+ * one sided with a middle tier, or two sided with an upper and lower,
+ * a few to a few dozen columns each, textures from a level's worth
+ */
+
+#define MAXSEGS 256
+#define FRAMES  8
+
+typedef struct {
+  int width, texturecolumn;
+  int top, mid, bottom;   // 0 for none
+} seg_test_t;
+
+static seg_test_t frames[FRAMES][MAXSEGS];
+static int segcount[FRAMES];
+static const byte *volatile sink;
+
+static void BuildFrames(void)
+{
+  int f, i;
+
+  for (f = 0; f < FRAMES; f++)
+    {
+      int columns = 0;
+
+      for (i = 0; i < MAXSEGS && columns < 320 * 2; i++)
+        {
+          seg_test_t *seg = &frames[f][i];
+
+          seg->width = 1 + rand() % 32;
+          seg->texturecolumn = rand() % 256 - 32;
+          seg->top = seg->mid = seg->bottom = 0;
+          if (rand() % 3)
+            seg->mid = 1 + rand() % (NUMTEXTURES - 1);
+          else
+            {
+              seg->top = 1 + rand() % (NUMTEXTURES - 1);
+              seg->bottom = 1 + rand() % (NUMTEXTURES - 1);
+            }
+          columns += seg->width;
+        }
+      segcount[f] = i;
+    }
+}
+
+// The three columns a tier's column looks up, for the filtered drawers
+static void Tier(const rpatch_t *patch, int texturecolumn)
+{
+  sink = GetTextureColumn(patch, texturecolumn);
+  sink = GetTextureColumn(patch, texturecolumn-1);
+  sink = GetTextureColumn(patch, texturecolumn+1);
+}
+
+static void Old_TierColumn(int texture, int texturecolumn)
+{
+  const rpatch_t *patch = R_CacheTextureCompositePatchNum(texture);
+
+  Tier(patch, texturecolumn);
+  R_UnlockTextureCompositePatchNum(texture);
+}
+
+static long Old_Frame(const seg_test_t *segs, int count)
+{
+  long columns = 0;
+  int i, x;
+
+  for (i = 0; i < count; i++)
+    for (x = 0; x < segs[i].width; x++)
+      {
+        int texturecolumn = segs[i].texturecolumn + x;
+
+        if (segs[i].mid)
+          Old_TierColumn(segs[i].mid, texturecolumn), columns++;
+        if (segs[i].top)
+          Old_TierColumn(segs[i].top, texturecolumn), columns++;
+        if (segs[i].bottom)
+          Old_TierColumn(segs[i].bottom, texturecolumn), columns++;
+      }
+  return columns;
+}
+
+static long New_Frame(const seg_test_t *segs, int count)
+{
+  long columns = 0;
+  int i, x;
+
+  for (i = 0; i < count; i++)
+    {
+      const rpatch_t *mid = segs[i].mid ? R_PinTextureComposite(segs[i].mid) : NULL;
+      const rpatch_t *top = segs[i].top ? R_PinTextureComposite(segs[i].top) : NULL;
+      const rpatch_t *bottom = segs[i].bottom ? R_PinTextureComposite(segs[i].bottom) : NULL;
+
+      for (x = 0; x < segs[i].width; x++)
+        {
+          int texturecolumn = segs[i].texturecolumn + x;
+
+          if (mid)
+            Tier(mid, texturecolumn), columns++;
+          if (top)
+            Tier(top, texturecolumn), columns++;
+          if (bottom)
+            Tier(bottom, texturecolumn), columns++;
+        }
+    }
+  R_UnpinTextureComposites();
+  return columns;
+}
+
+/*
+ * Timings, the two taking turns over the same frames, best of several
+ * runs, in nanoseconds per tier column. With every composite also held
+ * elsewhere no lock count crosses zero, which is the old code at its
+ * best.
+ */
+
+static void Time(const char *what)
+{
+  double oldt = 1e9, newt = 1e9;
+  int run, r;
+
+  for (run = 0; run < 9; run++)
+    {
+      double start = host_now(), t;
+      long columns = 0;
+
+      for (r = 0; r < 400; r++)
+        columns += Old_Frame(frames[r % FRAMES], segcount[r % FRAMES]);
+      t = (host_now() - start) * 1e9 / columns;
+      if (t < oldt)
+        oldt = t;
+
+      start = host_now();
+      columns = 0;
+      for (r = 0; r < 400; r++)
+        columns += New_Frame(frames[r % FRAMES], segcount[r % FRAMES]);
+      t = (host_now() - start) * 1e9 / columns;
+      if (t < newt)
+        newt = t;
+    }
+  printf("%s: per column %.2fns, pinned %.2fns\n", what, oldt, newt);
+}
+
+static void Benchmark(void)
+{
+  int id;
+
+  BuildFrames();
+  Time("unlocked composites");
+
+  for (id = 0; id < NUMTEXTURES; id++)
+    R_CacheTextureCompositePatchNum(id);
+  Time("held composites");
+  for (id = 0; id < NUMTEXTURES; id++)
+    R_UnlockTextureCompositePatchNum(id);
+
+  // Neither leaves anything locked
+  for (id = 0; id < NUMTEXTURES; id++)
+    CHECK(!texture_composites[id].locks && Tag(id) == PU_CACHE);
+}
+
+int main(void)
+{
+  srand(1);
+  Setup();
+  TestPin();
+  Benchmark();
+  return host_finish("texture_pin_test");
+}
@@ -0,0 +1,512 @@
+/*
+ * UART control tests over a pseudo terminal
+ *
+ * main/uart_control.c runs as it is, uart_control_task on a thread of
+ * its own, with the ESP-IDF UART driver and event queue stood in for by
+ * the slave side of a PTY: an event is data becoming readable, and the
+ * driver's buffer is the terminal's input queue. The test writes frames
+ * to the master side as the keypad sketch would, in pieces, with bad
+ * CRCs, noise and dropped bytes between them, and an overflow event
+ * partway through a frame, and checks the presses and releases that
+ * come out of I_PostInput: every good frame's changes and nothing from
+ * the bad ones. What should come out is what kp_parse makes of the same
+ * bytes, fed to it directly. Then how many frames a second get through.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <pty.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "doomtype.h"
+#include "i_input.h"
+#include "keypad_proto.h"
+#include "uart_control.h"
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    failures++; } } while (0)
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void Sleep(int us)
+{
+    struct timespec ts = { 0, us * 1000L };
+
+    nanosleep(&ts, NULL);
+}
+
+/*
+ * The driver: the PTY's slave side is the UART
+ */
+
+static int master, slave;
+static int baud;
+static volatile int stopping;
+static volatile int overflow;       // an overflow event waiting to be taken
+static struct QueueDefinition { int unused; } eventqueue;
+
+esp_err_t uart_param_config(uart_port_t port, const uart_config_t *config)
+{
+    baud = config->baud_rate;
+    return ESP_OK;
+}
+
+esp_err_t uart_set_pin(uart_port_t port, int tx, int rx, int rts, int cts)
+{
+    return ESP_OK;
+}
+
+esp_err_t uart_driver_install(uart_port_t port, int rx_buffer_size, int tx_buffer_size,
+                              int queue_size, QueueHandle_t *queue, int intr_alloc_flags)
+{
+    *queue = &eventqueue;
+    return ESP_OK;
+}
+
+esp_err_t uart_set_rx_timeout(uart_port_t port, uint8_t tout_thresh)
+{
+    return ESP_OK;
+}
+
+esp_err_t uart_get_buffered_data_len(uart_port_t port, size_t *size)
+{
+    int avail = 0;
+
+    ioctl(slave, FIONREAD, &avail);
+    *size = avail;
+    return ESP_OK;
+}
+
+int uart_read_bytes(uart_port_t port, void *buf, uint32_t length, TickType_t ticks_to_wait)
+{
+    return read(slave, buf, length);
+}
+
+esp_err_t uart_flush_input(uart_port_t port)
+{
+    tcflush(slave, TCIFLUSH);
+    return ESP_OK;
+}
+
+// Wait for data or an overflow; once the test is done and everything
+// written has been read, the task ends here
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait)
+{
+    uart_event_t *event = item;
+    struct pollfd pfd = { slave, POLLIN, 0 };
+
+    for (;;) {
+        size_t avail;
+
+        if (__atomic_load_n(&overflow, __ATOMIC_ACQUIRE)) {
+            event->type = UART_FIFO_OVF;
+            event->size = 0;
+            __atomic_store_n(&overflow, 0, __ATOMIC_RELEASE);
+            return pdTRUE;
+        }
+        if (poll(&pfd, 1, 10) > 0) {
+            uart_get_buffered_data_len(UART_NUM_1, &avail);
+            event->type = UART_DATA;
+            event->size = avail;
+            return pdTRUE;
+        }
+        if (stopping)
+            pthread_exit(NULL);
+    }
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    return pdTRUE;
+}
+
+/* The counters the task logs whenever a frame is lost or bad */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned logframes, loglost, logcrc;
+static int loglocked, logoverflows;
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    char buf[256];
+    va_list ap;
+
+    va_start(ap, format);
+    vsnprintf(buf, sizeof buf, format, ap);
+    va_end(ap);
+
+    pthread_mutex_lock(&lock);
+    if (!strcmp(buf, "keypad locked"))
+        loglocked++;
+    else if (!strcmp(buf, "rx overflow"))
+        logoverflows++;
+    else
+        sscanf(buf, "%u frames, %u lost, %u bad CRC", &logframes, &loglost, &logcrc);
+    pthread_mutex_unlock(&lock);
+}
+
+/*
+ * What comes out: presses and releases, in order
+ */
+
+#define MAXEVENTS (1 << 20)
+
+typedef struct {
+    int action, down;
+} input_t;
+
+static input_t got[MAXEVENTS], want[MAXEVENTS];
+static int numgot, numwant;
+
+void I_PostInput(inputaction_t action, boolean down)
+{
+    pthread_mutex_lock(&lock);
+    if (numgot < MAXEVENTS) {
+        got[numgot].action = action;
+        got[numgot].down = down;
+    }
+    numgot++;
+    pthread_mutex_unlock(&lock);
+}
+
+/*
+ * What should come out: every byte written is also fed to a parser of
+ * the test's own, and its frames worked through the keymap the sketch
+ * scans keys in, bit n being key n of "123A456B789C*0#D"
+ */
+
+static const int bitaction[16] = {
+    IA_STRAFELEFT, IA_UP, IA_STRAFERIGHT, IA_MAP,
+    IA_LEFT, IA_FIRE, IA_RIGHT, IA_WEAPONTOGGLE,
+    -1, IA_DOWN, -1, -1,
+    IA_ESCAPE, IA_USE, IA_ENTER, -1,
+};
+
+static uint16_t keystate;
+
+static void Expect(uint16_t mask)
+{
+    int i;
+
+    for (i = 0; i < 16; i++)
+        if (((mask ^ keystate) >> i & 1) && bitaction[i] >= 0 && numwant < MAXEVENTS) {
+            want[numwant].action = bitaction[i];
+            want[numwant].down = mask >> i & 1;
+            numwant++;
+        }
+    keystate = mask;
+}
+
+static kp_parser_t ref;
+
+static void RefFrame(const kp_frame_t *frame, void *ctx)
+{
+    int i;
+
+    if (frame->type == KP_TYPE_STATUS) {
+        if (frame->status != KP_STATUS_UNLOCKED)
+            Expect(0);
+        return;
+    }
+    for (i = 0; i < frame->count; i++)
+        Expect(frame->masks[i]);
+}
+
+/*
+ * The sender
+ */
+
+static uint8_t seq;
+static unsigned sentgood, sentbad;
+
+static void Write(const uint8_t *p, size_t len)
+{
+    kp_parse(&ref, p, len, RefFrame, NULL);
+    while (len) {
+        ssize_t n = write(master, p, len);
+
+        if (n < 0 && errno != EINTR && errno != EAGAIN) {
+            perror("write");
+            exit(2);
+        }
+        if (n > 0)
+            p += n, len -= n;
+    }
+}
+
+// Write a buffer in random pieces, sometimes letting the reader catch up
+static void WriteSplit(const uint8_t *p, size_t len)
+{
+    while (len) {
+        size_t n = 1 + rand() % 24;
+
+        if (n > len)
+            n = len;
+        Write(p, n);
+        p += n;
+        len -= n;
+        if (rand() % 8 == 0)
+            Sleep(200);
+    }
+}
+
+static size_t KeysFrame(uint8_t *buf, int good)
+{
+    uint16_t masks[KP_MAXBATCH];
+    int count = rand() % 4 ? 1 : 1 + rand() % KP_MAXBATCH, i;
+    size_t len;
+
+    for (i = 0; i < count; i++)
+        masks[i] = rand();
+    len = kp_encode_keys(buf, seq++, masks, count);
+    if (good)
+        sentgood++;
+    else {
+        // One bit flipped anywhere after the sync byte: the CRC catches
+        // every single bit error
+        buf[1 + rand() % (len - 1)] ^= 1 << rand() % 8;
+        sentbad++;
+    }
+    return len;
+}
+
+// Wait until the task has handed over every event expected, or a while
+static void Settle(void)
+{
+    double start = Now();
+
+    for (;;) {
+        int n, avail = 0;
+
+        pthread_mutex_lock(&lock);
+        n = numgot;
+        pthread_mutex_unlock(&lock);
+        ioctl(slave, FIONREAD, &avail);
+        if ((n >= numwant && !avail) || Now() - start > 5)
+            break;
+        Sleep(1000);
+    }
+    Sleep(20000);
+}
+
+static int SameEvents(void)
+{
+    int ok;
+
+    pthread_mutex_lock(&lock);
+    ok = numgot == numwant && !memcmp(got, want, numgot * sizeof *got);
+    pthread_mutex_unlock(&lock);
+    return ok;
+}
+
+// The task's counters, as it last logged them, which it does whenever
+// a frame is lost or bad, are the test's parser's; and every good frame
+// and no bad one got through
+static int SameCounts(void)
+{
+    int ok;
+
+    pthread_mutex_lock(&lock);
+    ok = loglost == ref.lost && logcrc == ref.crcerrors;
+    pthread_mutex_unlock(&lock);
+    return ok && ref.frames == sentgood && ref.lost == sentbad;
+}
+
+static void TestGood(void)
+{
+    static uint8_t stream[500 * KP_MAXFRAME];
+    size_t len = 0;
+    int i;
+
+    for (i = 0; i < 500; i++)
+        len += KeysFrame(stream + len, 1);
+    WriteSplit(stream, len);
+    Settle();
+    CHECK(numwant > 500);
+    CHECK(SameEvents());
+    CHECK(SameCounts());
+}
+
+static void TestBad(void)
+{
+    static uint8_t stream[2000 * (KP_MAXFRAME + 4)];
+    size_t len = 0;
+    int i, j;
+
+    for (i = 0; i < 2000; i++) {
+        // The last good, so the task has seen every loss by the end
+        len += KeysFrame(stream + len, i == 1999 || rand() % 10 != 0);
+
+        // Noise between frames, false sync bytes among it
+        if (rand() % 10 == 0)
+            for (j = rand() % 4; j >= 0; j--)
+                stream[len++] = rand() % 3 ? KP_SYNC : rand();
+    }
+    WriteSplit(stream, len);
+    Settle();
+    CHECK(SameEvents());
+    CHECK(SameCounts());
+    CHECK(ref.crcerrors > sentbad / 2);
+}
+
+static void TestTruncated(void)
+{
+    uint8_t buf[KP_MAXFRAME];
+    size_t len;
+    int i;
+
+    // The tail of a frame never arrives; the frames after it all do
+    for (i = 0; i < 50; i++) {
+        len = KeysFrame(buf, 0);
+        Write(buf, 1 + rand() % (len - 1));
+        len = KeysFrame(buf, 1);
+        Write(buf, len);
+    }
+    Settle();
+    CHECK(SameEvents());
+    CHECK(SameCounts());
+}
+
+static void TestOverflow(void)
+{
+    uint8_t buf[KP_MAXFRAME];
+    size_t len;
+    int i, avail;
+
+    // Half a frame is read, then the driver overflows and drops the
+    // rest: the frames after it still get through
+    for (i = 0; i < 20; i++) {
+        len = KeysFrame(buf, 0);
+        Write(buf, len / 2);
+        do {
+            Sleep(1000);
+            ioctl(slave, FIONREAD, &avail);
+        } while (avail);
+        Sleep(5000);
+        __atomic_store_n(&overflow, 1, __ATOMIC_RELEASE);
+        while (__atomic_load_n(&overflow, __ATOMIC_ACQUIRE))
+            Sleep(1000);
+        len = KeysFrame(buf, 1);
+        Write(buf, len);
+        Settle();
+    }
+    CHECK(SameEvents());
+    CHECK(SameCounts());
+    CHECK(logoverflows == 20);
+}
+
+static void TestLocked(void)
+{
+    uint8_t buf[KP_MAXFRAME];
+    uint16_t held = 0x2222;    // up, fire, weapon toggle, down
+    size_t len;
+
+    // Locking releases whatever is held
+    len = kp_encode_keys(buf, seq++, &held, 1);
+    Write(buf, len);
+    len = kp_encode_status(buf, seq++, KP_STATUS_LOCKED);
+    Write(buf, len);
+    sentgood += 2;
+    Settle();
+    CHECK(SameEvents());
+    CHECK(keystate == 0);
+    CHECK(loglocked == 1);
+}
+
+/*
+ * Frames through the PTY, every 50th with a bad CRC, as fast as the
+ * task can take them
+ */
+
+static void Benchmark(void)
+{
+    static uint8_t stream[20000 * KP_MAXFRAME];
+    size_t len = 0;
+    double start;
+    int i;
+
+    for (i = 0; i < 20000; i++)
+        len += KeysFrame(stream + len, i % 50 != 25);
+    start = Now();
+    Write(stream, len);
+    for (;;) {
+        int n, avail = 0;
+
+        pthread_mutex_lock(&lock);
+        n = numgot;
+        pthread_mutex_unlock(&lock);
+        ioctl(slave, FIONREAD, &avail);
+        if ((n >= numwant && !avail) || Now() - start > 10)
+            break;
+        Sleep(100);
+    }
+    printf("20000 frames over the PTY, 400 bad: %.0f frames/s\n", 20000 / (Now() - start));
+    Settle();
+    CHECK(SameEvents());
+    CHECK(SameCounts());
+}
+
+static void *Task(void *arg)
+{
+    uart_control_task(NULL);
+    return NULL;
+}
+
+int main(void)
+{
+    struct termios tio;
+    pthread_t task;
+
+    if (openpty(&master, &slave, NULL, NULL, NULL) < 0) {
+        perror("openpty");
+        return 2;
+    }
+    // Bytes as they are, no line discipline
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+
+    srand(1);
+    kp_parser_init(&ref);
+    uart_control_init();
+    CHECK(baud == CONFIG_KEYPAD_UART_BAUD);
+    pthread_create(&task, NULL, Task, NULL);
+
+    TestGood();
+    TestBad();
+    TestTruncated();
+    TestOverflow();
+    TestLocked();
+    Benchmark();
+
+    stopping = 1;
+    pthread_join(task, NULL);
+    close(master);
+    close(slave);
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("uart_pty_test: all checks passed\n");
+    return !!failures;
+}
@@ -0,0 +1,265 @@
+/*
+ * R_SortVisSprites test and benchmark
+ *
+ * r_things.c is included whole and its sprite list filled through
+ * R_NewVisSprite, 16 to 4096 sprites, in three orders: as the BSP walk
+ * projects them, nearest first with some out of place; shuffled; and
+ * only a few distinct scales, as a room full of one kind of thing
+ * at one distance gives. R_SortVisSprites must order them nearest first
+ * with ties kept in projection order, the same scales as the merge sort
+ * it replaced gave. Then times the two.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../components/prboom/r_things.c"
+#include "host_support.h"
+
+/*
+ * What r_things.c links against. Only the sort runs; projecting and
+ * drawing sprites is never reached.
+ */
+
+fixed_t centerxfrac, centeryfrac, projection, projectiony, viewheightfrac;
+fixed_t viewx, viewy, viewz, viewcos, viewsin;
+int viewwidth, viewheight, viewangleoffset, validcount, firstspritelump, lastspritelump;
+int movement_smooth, rendered_vissprites;
+boolean general_translucency;
+const lighttable_t *fullcolormap, *fixedcolormap;
+const byte *main_tranmap, *tranmap;
+byte *translationtables;
+lumpinfo_t *lumpinfo;
+sector_t *sectors;
+player_t *viewplayer;
+drawseg_t *drawsegs, *ds_p;
+draw_vars_t drawvars;
+tic_vars_t tic_vars;
+const R_DrawColumn_f drawcolumnfuncs_noz[RDC_PIPELINE_MAXPIPELINES];
+const R_DrawColumn_f drawcolumnfuncs_z[RDC_PIPELINE_MAXPIPELINES];
+
+const rpatch_t *R_CachePatchNum(int id) { return NULL; }
+void R_UnlockPatchNum(int id) {}
+const rcolumn_t *R_GetPatchColumnClamped(const rpatch_t *patch, int columnIndex) { return NULL; }
+const lighttable_t *R_ColourMap(int lightlevel, fixed_t spryscale) { return NULL; }
+int R_LightBase(int lightlevel) { return 0; }
+int R_ScaleLight(fixed_t spryscale) { return 0; }
+const lighttable_t *R_LightColourMap(int light) { return NULL; }
+int R_PointOnSegSide(fixed_t x, fixed_t y, const seg_t *line) { return 0; }
+angle_t R_PointToAngle(fixed_t x, fixed_t y) { return 0; }
+void R_RenderMaskedSegRange(drawseg_t *ds, int x1, int x2) {}
+void R_SetDefaultDrawColumnVars(draw_column_vars_t *dcvars) {}
+video_mode_t V_GetMode(void) { return VID_MODE8; }
+
+/*
+ * The merge sort R_SortVisSprites replaced, as it was. It is not
+ * stable: merging takes the second half first on equal scales.
+ */
+
+#define bcopyp(d, s, n) memcpy(d, s, (n) * sizeof(void *))
+
+static void msort(vissprite_t **s, vissprite_t **t, int n)
+{
+  if (n >= 16)
+    {
+      int n1 = n/2, n2 = n - n1;
+      vissprite_t **s1 = s, **s2 = s + n1, **d = t;
+
+      msort(s1, t, n1);
+      msort(s2, t, n2);
+
+      while ((*s1)->scale > (*s2)->scale ?
+             (*d++ = *s1++, --n1) : (*d++ = *s2++, --n2));
+
+      if (n2)
+        bcopyp(d, s2, n2);
+      else
+        bcopyp(d, s1, n1);
+
+      bcopyp(s, t, n);
+    }
+  else
+    {
+      int i;
+      for (i = 1; i < n; i++)
+        {
+          vissprite_t *temp = s[i];
+          if (s[i-1]->scale < temp->scale)
+            {
+              int j = i;
+              while ((s[j] = s[j-1])->scale < temp->scale && --j);
+              s[j] = temp;
+            }
+        }
+    }
+}
+
+static vissprite_t **old_ptrs, **old_temp;
+
+static void Old_SortVisSprites(void)
+{
+  int i = num_vissprite;
+
+  while (--i >= 0)
+    old_ptrs[i] = vissprites + i;
+  msort(old_ptrs, old_temp, num_vissprite);
+}
+
+/* Nearest first, then projection order */
+static int CompareSprites(const void *a, const void *b)
+{
+  const vissprite_t *x = *(vissprite_t *const *)a, *y = *(vissprite_t *const *)b;
+
+  if (x->scale != y->scale)
+    return x->scale > y->scale ? -1 : 1;
+  return x < y ? -1 : x > y;
+}
+
+enum { ORDER_BSP, ORDER_RANDOM, ORDER_FEW, NUMORDERS };
+static const char *const ordernames[NUMORDERS] = { "bsp", "random", "few" };
+
+#define MAXSPRITES 4096
+
+static vissprite_t *ref[MAXSPRITES];
+
+static fixed_t RandomScale(void)
+{
+  return FRACUNIT/64 + (rand() & 0xffff) * 64 + (rand() & 63);
+}
+
+static void Fill(int n, int order)
+{
+  int i;
+
+  R_ClearSprites();
+  for (i = 0; i < n; i++)
+    {
+      vissprite_t *vis = R_NewVisSprite();
+
+      switch (order)
+        {
+        case ORDER_BSP:
+          // Nearest first, each sprite a little further than the last,
+          // with one in eight swapped out of place by a subsector or two
+          vis->scale = 64*FRACUNIT - i * (48*FRACUNIT / n) - (rand() & 0xfff);
+          if (i && !(rand() & 7))
+            {
+              fixed_t t = vis->scale;
+              vis->scale = vis[-1].scale;
+              vis[-1].scale = t;
+            }
+          break;
+        case ORDER_RANDOM:
+          vis->scale = RandomScale();
+          break;
+        case ORDER_FEW:
+          vis->scale = FRACUNIT/4 + (rand() & 7) * (FRACUNIT/2);
+          break;
+        }
+    }
+}
+
+static void TestSort(int n, int order)
+{
+  int i, ok = 1;
+
+  Fill(n, order);
+  for (i = 0; i < n; i++)
+    ref[i] = vissprites + i;
+  qsort(ref, n, sizeof *ref, CompareSprites);
+
+  R_SortVisSprites();
+  Old_SortVisSprites();
+  for (i = 0; i < n; i++)
+    {
+      ok &= vissprite_ptrs[i] == ref[i];
+      ok &= old_ptrs[i]->scale == ref[i]->scale;
+    }
+  CHECK(ok);
+  if (!ok)
+    fprintf(stderr, "%d sprites, %s order: wrong order\n", n, ordernames[order]);
+}
+
+/*
+ * Timings sort SETS different lists in turn: sorting one list over and
+ * over, the branch predictor learns it, which flatters the insertion
+ * sorts. Old and new take turns so that anything else running on the
+ * machine hits both alike. Best of several runs, in microseconds.
+ */
+
+#define SETS 8
+
+static vissprite_t *sets[SETS];
+
+static void Time(int n, int order, double *oldt, double *newt)
+{
+  vissprite_t *list = vissprites;
+  int reps = 200000 / n, run, r;
+
+  for (r = 0; r < SETS; r++)
+    {
+      Fill(n, order);
+      sets[r] = malloc(n * sizeof *sets[r]);
+      memcpy(sets[r], vissprites, n * sizeof *sets[r]);
+    }
+
+  *oldt = *newt = 1e9;
+  for (run = 0; run < 15; run++)
+    {
+      double start = host_now(), t;
+
+      for (r = 0; r < reps; r++)
+        {
+          vissprites = sets[r % SETS];
+          Old_SortVisSprites();
+        }
+      t = (host_now() - start) * 1e6 / reps;
+      if (t < *oldt)
+        *oldt = t;
+
+      start = host_now();
+      for (r = 0; r < reps; r++)
+        {
+          vissprites = sets[r % SETS];
+          R_SortVisSprites();
+        }
+      t = (host_now() - start) * 1e6 / reps;
+      if (t < *newt)
+        *newt = t;
+    }
+
+  vissprites = list;
+  for (r = 0; r < SETS; r++)
+    free(sets[r]);
+}
+
+int main(void)
+{
+  static const int counts[] = { 1, 2, 15, 16, 17, 63, 64, 65, 127, 128, 129, 1000 };
+  int i, order, n;
+
+  srand(1);
+  old_ptrs = malloc(MAXSPRITES * sizeof *old_ptrs);
+  old_temp = malloc(MAXSPRITES * sizeof *old_temp);
+
+  R_ClearSprites();
+  R_SortVisSprites();
+  for (i = 0; i < sizeof counts / sizeof *counts; i++)
+    for (order = 0; order < NUMORDERS; order++)
+      TestSort(counts[i], order);
+
+  printf("%-6s %-8s %10s %10s\n", "count", "order", "old us", "new us");
+  for (n = 16; n <= MAXSPRITES; n *= 2)
+    for (order = 0; order < NUMORDERS; order++)
+      {
+        double oldt, newt;
+
+        TestSort(n, order);
+        Time(n, order, &oldt, &newt);
+        printf("%-6d %-8s %10.2f %10.2f\n", n, ordernames[order], oldt, newt);
+      }
+
+  free(old_ptrs);
+  free(old_temp);
+  return host_finish("vissprite_sort_test");
+}